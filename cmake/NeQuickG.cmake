@@ -0,0 +1,43 @@
+# NeQuick-G model data
+#
+# The MODIP grid and the CCIR coefficients of the NeQuick-G ionosphere model are distributed by the European GNSS Service
+# Centre together with the reference implementation and are not part of this repository. Set NEQUICKG_DATA_DIR to the
+# directory with the unpacked files to install them into 'resources/data/NeQuickG', where the program and the tests load
+# them from. The optional file 'validation.txt' holds the reference vectors for the conformance test (see the README in
+# 'resources/data/NeQuickG').
+
+set(NEQUICKG_DATA_DIR
+    ""
+    CACHE PATH "Directory with the NeQuick-G files 'modipNeQG_wrapped.asc' and 'ccir11.asc' to 'ccir22.asc'")
+
+set(NEQUICKG_DATA_FILES modipNeQG_wrapped.asc)
+foreach(MONTH RANGE 11 22)
+  list(APPEND NEQUICKG_DATA_FILES ccir${MONTH}.asc)
+endforeach()
+
+set(NEQUICKG_INSTALL_DIR "${CMAKE_SOURCE_DIR}/resources/data/NeQuickG")
+
+if(NEQUICKG_DATA_DIR)
+  foreach(DATA_FILE ${NEQUICKG_DATA_FILES})
+    if(NOT EXISTS "${NEQUICKG_DATA_DIR}/${DATA_FILE}")
+      message(FATAL_ERROR "NEQUICKG_DATA_DIR is set, but '${NEQUICKG_DATA_DIR}/${DATA_FILE}' does not exist")
+    endif()
+    configure_file("${NEQUICKG_DATA_DIR}/${DATA_FILE}" "${NEQUICKG_INSTALL_DIR}/${DATA_FILE}" COPYONLY)
+  endforeach()
+  if(EXISTS "${NEQUICKG_DATA_DIR}/validation.txt")
+    configure_file("${NEQUICKG_DATA_DIR}/validation.txt" "${NEQUICKG_INSTALL_DIR}/validation.txt" COPYONLY)
+  endif()
+endif()
+
+set(NEQUICKG_DATA_FOUND TRUE)
+foreach(DATA_FILE ${NEQUICKG_DATA_FILES})
+  if(NOT EXISTS "${NEQUICKG_INSTALL_DIR}/${DATA_FILE}")
+    set(NEQUICKG_DATA_FOUND FALSE)
+  endif()
+endforeach()
+
+if(NEQUICKG_DATA_FOUND)
+  message(STATUS "NeQuick-G model data found in '${NEQUICKG_INSTALL_DIR}'")
+else()
+  message(STATUS "NeQuick-G model data not found. The model will not be available (set NEQUICKG_DATA_DIR to install it)")
+endif()
@@ -10,13 +10,16 @@
 
 #include <vector>
 #include <array>
-#include "internal/gui/widgets/EnumCombo.hpp"
+#include <imgui.h>
 #include "util/Logger.hpp"
 
 #include "Models/Klobuchar.hpp"
+#include "Models/BeiDouKlobuchar.hpp"
+#include "Models/NeQuickG.hpp"
 
 #include "Navigation/GNSS/Functions.hpp"
 #include "Navigation/Constants.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
 
 namespace NAV
 {
@@ -29,6 +32,10 @@ const char* to_string(IonosphereModel ionosphereModel)
         return "None";
     case IonosphereModel::Klobuchar:
         return "Klobuchar / Broadcast";
+    case IonosphereModel::NeQuickG:
+        return "NeQuick-G (Galileo)";
+    case IonosphereModel::BeiDouKlobuchar:
+        return "Klobuchar (BeiDou)";
     case IonosphereModel::COUNT:
         break;
     }
@@ -37,11 +44,42 @@ const char* to_string(IonosphereModel ionosphereModel)
 
 bool ComboIonosphereModel(const char* label, IonosphereModel& ionosphereModel)
 {
-    return gui::widgets::EnumCombo(label, ionosphereModel);
+    bool clicked = false;
+    if (ImGui::BeginCombo(label, to_string(ionosphereModel)))
+    {
+        for (size_t i = 0; i < static_cast<size_t>(IonosphereModel::COUNT); i++)
+        {
+            auto model = static_cast<IonosphereModel>(i);
+            // Models without their data files can not be evaluated, so they are not offered
+            if (model != ionosphereModel && !isIonosphereModelAvailable(model)) { continue; }
+
+            const bool is_selected = (ionosphereModel == model);
+            if (ImGui::Selectable(to_string(model), is_selected))
+            {
+                ionosphereModel = model;
+                clicked = true;
+            }
+
+            // Set the initial focus when opening the combo (scrolling + keyboard navigation focus)
+            if (is_selected)
+            {
+                ImGui::SetItemDefaultFocus();
+            }
+        }
+
+        ImGui::EndCombo();
+    }
+    return clicked;
 }
 
-double calcIonosphericDelay(double tow, Frequency freq, int8_t freqNum,
-                            const Eigen::Vector3d& lla_pos,
+bool isIonosphereModelAvailable(IonosphereModel ionosphereModel)
+{
+    if (ionosphereModel == IonosphereModel::NeQuickG) { return NeQuickG::DefaultData() != nullptr; }
+    return true;
+}
+
+double calcIonosphericDelay(const InsTime& insTime, Frequency freq, int8_t freqNum,
+                            const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& e_satPos,
                             double elevation, double azimuth,
                             IonosphereModel ionosphereModel,
                             const IonosphericCorrections* corrections)
@@ -56,6 +94,7 @@ double calcIonosphericDelay(double tow, Frequency freq, int8_t freqNum,
             const auto* beta = corrections->get(GPS, IonosphericCorrections::Beta);
             if (alpha && beta)
             {
+                auto tow = static_cast<double>(insTime.toGPSweekTow().tow);
                 return calcIonosphericTimeDelay_Klobuchar(tow, freq, freqNum, lla_pos(0), lla_pos(1), elevation, azimuth, *alpha, *beta)
                        * InsConst<>::C;
             }
@@ -64,6 +103,49 @@ double calcIonosphericDelay(double tow, Frequency freq, int8_t freqNum,
         LOG_ERROR("Ionosphere model Klobuchar/Broadcast needs correction parameters. Ionospheric time delay will be 0.");
         break;
     }
+    case IonosphereModel::NeQuickG:
+    {
+        auto data = NeQuickG::DefaultData();
+        if (!data)
+        {
+            LOG_ERROR("Ionosphere model NeQuick-G needs the model data in 'resources/data/NeQuickG'. Ionospheric time delay will be 0.");
+            break;
+        }
+        if (corrections)
+        {
+            if (const auto* alpha = corrections->get(GAL, IonosphericCorrections::Alpha))
+            {
+                auto gpsWeekTow = insTime.toGPSweekTow();
+                auto gpsTime = static_cast<double>(gpsWeekTow.gpsCycle * InsTimeUtil::WEEKS_PER_GPS_CYCLE + gpsWeekTow.gpsWeek) * InsTimeUtil::SECONDS_PER_WEEK
+                               + static_cast<double>(gpsWeekTow.tow);
+                auto ymdhms = insTime.toYMDHMS(UTC);
+                double UT = ymdhms.hour + ymdhms.min / 60.0 + static_cast<double>(ymdhms.sec) / 3600.0;
+
+                double stec = NeQuickG::calcSTECCached(*data, gpsTime, ymdhms.month, UT, *alpha, lla_pos, trafo::ecef2lla_WGS84(e_satPos));
+                return NeQuickG::stec2timeDelay(stec, freq, freqNum) * InsConst<>::C;
+            }
+        }
+
+        LOG_ERROR("Ionosphere model NeQuick-G needs the Galileo correction parameters. Ionospheric time delay will be 0.");
+        break;
+    }
+    case IonosphereModel::BeiDouKlobuchar:
+    {
+        if (corrections)
+        {
+            const auto* alpha = corrections->get(BDS, IonosphericCorrections::Alpha);
+            const auto* beta = corrections->get(BDS, IonosphericCorrections::Beta);
+            if (alpha && beta)
+            {
+                auto sow = static_cast<double>(insTime.toGPSweekTow(BDT).tow);
+                return calcIonosphericTimeDelay_BeiDouKlobuchar(sow, freq, freqNum, lla_pos(0), lla_pos(1), elevation, azimuth, *alpha, *beta)
+                       * InsConst<>::C;
+            }
+        }
+
+        LOG_ERROR("Ionosphere model Klobuchar (BeiDou) needs the BeiDou correction parameters. Ionospheric time delay will be 0.");
+        break;
+    }
     case IonosphereModel::None:
     case IonosphereModel::COUNT:
         break;
@@ -16,6 +16,7 @@
 #include <vector>
 #include <Eigen/Core>
 #include "Navigation/GNSS/Core/Frequency.hpp"
+#include "Navigation/Time/InsTime.hpp"
 #include "IonosphericCorrections.hpp"
 
 namespace NAV
@@ -24,9 +25,11 @@ namespace NAV
 /// Available Ionosphere Models
 enum class IonosphereModel : int
 {
-    None,      ///< Ionosphere model turned off
-    Klobuchar, ///< Klobuchar model (GPS), also called Broadcast sometimes
-    COUNT,     ///< Amount of items in the enum
+    None,            ///< Ionosphere model turned off
+    Klobuchar,       ///< Klobuchar model (GPS), also called Broadcast sometimes
+    NeQuickG,        ///< NeQuick-G model (Galileo)
+    BeiDouKlobuchar, ///< Klobuchar model of the BeiDou navigation message
+    COUNT,           ///< Amount of items in the enum
 };
 
 /// @brief Converts the enum to a string
@@ -35,22 +38,30 @@ enum class IonosphereModel : int
 const char* to_string(IonosphereModel ionosphereModel);
 
 /// @brief Shows a ComboBox to select the ionosphere model
+///
+/// Models whose data files are not available are not offered (unless already selected, e.g. by a loaded flow)
 /// @param[in] label Label to show beside the combo box. This has to be a unique id for ImGui.
 /// @param[in] ionosphereModel Reference to the ionosphere model to select
 bool ComboIonosphereModel(const char* label, IonosphereModel& ionosphereModel);
 
+/// @brief Checks whether the data files needed by the ionosphere model could be loaded
+/// @param[in] ionosphereModel Ionosphere model to check
+/// @return False if the model can not be evaluated
+bool isIonosphereModelAvailable(IonosphereModel ionosphereModel);
+
 /// @brief Calculates the ionospheric delay
-/// @param[in] tow GPS time of week in [s]
+/// @param[in] insTime Time of the signal reception
 /// @param[in] freq Frequency of the signal
 /// @param[in] freqNum Frequency number. Only used for GLONASS G1 and G2
 /// @param[in] lla_pos [𝜙, λ, h]^T Geodetic latitude, longitude and height in [rad, rad, m]
+/// @param[in] e_satPos Satellite position in ECEF frame coordinates [m]. Only used by NeQuick-G
 /// @param[in] elevation Angle between the user and satellite [rad]
 /// @param[in] azimuth Angle between the user and satellite, measured clockwise positive from the true North [rad]
 /// @param[in] ionosphereModel Ionosphere model to use
 /// @param[in] corrections Ionospheric correction parameters
 /// @return Ionospheric time delay in [m]
-double calcIonosphericDelay(double tow, Frequency freq, int8_t freqNum,
-                            const Eigen::Vector3d& lla_pos,
+double calcIonosphericDelay(const InsTime& insTime, Frequency freq, int8_t freqNum,
+                            const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& e_satPos,
                             double elevation, double azimuth,
                             IonosphereModel ionosphereModel = IonosphereModel::None,
                             const IonosphericCorrections* corrections = nullptr);
@@ -19,6 +19,15 @@ namespace NAV
 
 IonosphericCorrections::IonosphericCorrections(const std::vector<const GnssNavInfo*>& gnssNavInfos)
 {
+    assign(gnssNavInfos);
+}
+
+IonosphericCorrections::IonosphericCorrections(std::vector<Corrections> corrections)
+    : m_ionosphericCorrections(std::move(corrections)) {}
+
+void IonosphericCorrections::assign(const std::vector<const GnssNavInfo*>& gnssNavInfos)
+{
+    m_ionosphericCorrections.clear();
     for (const auto* gnssNavInfo : gnssNavInfos)
     {
         for (const auto& correction : gnssNavInfo->ionosphericCorrections.data())
@@ -31,7 +40,4 @@ IonosphericCorrections::IonosphericCorrections(const std::vector<const GnssNavIn
     }
 }
 
-IonosphericCorrections::IonosphericCorrections(std::vector<Corrections> corrections)
-    : m_ionosphericCorrections(std::move(corrections)) {}
-
 } // namespace NAV
\ No newline at end of file
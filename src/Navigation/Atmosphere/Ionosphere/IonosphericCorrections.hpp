@@ -92,7 +92,8 @@ class IonosphericCorrections
     /// @param[in] satSys Satellite System to search the value for
     /// @param[in] alphaBeta Alpha or beta values (Galileo only alpha)
     /// @param[in] values Values to add [s, s/semi-circle, s/semi-circle^2, s/semi-circle^3]
-    void insert(SatelliteSystem satSys, AlphaBeta alphaBeta, const std::array<double, 4>& values)
+    /// @return True if the values changed
+    bool insert(SatelliteSystem satSys, AlphaBeta alphaBeta, const std::array<double, 4>& values)
     {
         auto iter = std::find_if(m_ionosphericCorrections.begin(), m_ionosphericCorrections.end(), [satSys, alphaBeta](const Corrections& c) {
             return c.satSys == satSys && c.alphaBeta == alphaBeta;
@@ -100,13 +101,18 @@ class IonosphericCorrections
         if (iter == m_ionosphericCorrections.end())
         {
             m_ionosphericCorrections.push_back({ satSys, alphaBeta, values });
+            return true;
         }
-        else
-        {
-            iter->data = values;
-        }
+        if (iter->data == values) { return false; }
+        iter->data = values;
+        return true;
     }
 
+    /// @brief Replaces the data with the ionospheric parameters collected from the Navigation infos
+    /// @param[in] gnssNavInfos List of GNSS navigation infos
+    /// @note Keeps the allocated memory, so that calling this every epoch does not allocate
+    void assign(const std::vector<const GnssNavInfo*>& gnssNavInfos);
+
     /// @brief Empties the data
     void clear()
     {
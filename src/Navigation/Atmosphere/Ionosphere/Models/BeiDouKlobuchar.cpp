@@ -0,0 +1,76 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "BeiDouKlobuchar.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+double calcIonosphericTimeDelay_BeiDouKlobuchar(double sow, Frequency freq, int8_t freqNum,
+                                                double latitude, double longitude,
+                                                double elevation, double azimuth,
+                                                const std::array<double, 4>& alpha, const std::array<double, 4>& beta)
+{
+    constexpr double R = 6378.0; // Mean radius of the earth [km]
+    constexpr double h = 375.0;  // Height of the ionospheric single layer [km]
+
+    // Earth's central angle between the user position and the ionospheric pierce point [rad]
+    double psi = M_PI / 2.0 - elevation - std::asin(R / (R + h) * std::cos(elevation));
+    LOG_DATA("psi {} [rad] (Earth's central angle)", psi);
+
+    // Geographic latitude of the ionospheric pierce point [rad]
+    double phi_M = std::asin(std::sin(latitude) * std::cos(psi) + std::cos(latitude) * std::sin(psi) * std::cos(azimuth));
+    LOG_DATA("phi_M {} [rad] (Latitude of the pierce point)", phi_M);
+
+    // Geographic longitude of the ionospheric pierce point [rad]
+    double lambda_M = longitude + std::asin(std::clamp(std::sin(psi) * std::sin(azimuth) / std::cos(phi_M), -1.0, 1.0));
+    LOG_DATA("lambda_M {} [rad] (Longitude of the pierce point)", lambda_M);
+
+    // Local time [s]
+    double t = std::fmod(sow + lambda_M * 43200.0 / M_PI, InsTimeUtil::SECONDS_PER_DAY);
+    if (t < 0)
+    {
+        t += InsTimeUtil::SECONDS_PER_DAY;
+    }
+    LOG_DATA("t {} [s] (Local time)", t);
+
+    // Amplitude and period of the vertical delay in [s]
+    double A2 = 0.0;
+    double A4 = 0.0;
+    double phi_sc = std::abs(phi_M / M_PI);
+    for (size_t n = 0; n < alpha.size(); ++n)
+    {
+        A2 += alpha.at(n) * std::pow(phi_sc, n);
+        A4 += beta.at(n) * std::pow(phi_sc, n);
+    }
+    A2 = std::max(A2, 0.0);
+    A4 = std::clamp(A4, 72000.0, 172800.0);
+    LOG_DATA("A2 {} [s], A4 {} [s] (Amplitude and period of the vertical delay)", A2, A4);
+
+    // Vertical delay [s]
+    double Iz = std::abs(t - 50400.0) < A4 / 4.0 ? 5e-9 + A2 * std::cos(2.0 * M_PI * (t - 50400.0) / A4)
+                                                 : 5e-9;
+    LOG_DATA("Iz {} [s] (Vertical delay)", Iz);
+
+    // Slant delay on B1I [s]
+    double T_iono = Iz / std::sqrt(1.0 - std::pow(R / (R + h) * std::cos(elevation), 2));
+    LOG_DATA("T_iono_B1I {} [s] (Ionospheric delay)", T_iono);
+
+    T_iono *= ratioFreqSquared(B02, freq, 0, freqNum);
+    LOG_DATA("T_iono     {} [s] (Ionospheric delay for requested frequency)", T_iono);
+
+    return T_iono;
+}
+
+} // namespace NAV
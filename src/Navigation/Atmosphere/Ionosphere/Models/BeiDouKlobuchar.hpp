@@ -0,0 +1,42 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file BeiDouKlobuchar.hpp
+/// @brief BeiDou broadcast ionospheric correction model (Klobuchar model of the BDS-2 navigation message)
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include "Navigation/GNSS/Core/Frequency.hpp"
+
+namespace NAV
+{
+
+/// @brief Calculates the ionospheric time delay with the BeiDou Klobuchar model
+/// @param[in] sow BeiDou time (BDT) seconds of week in [s]
+/// @param[in] freq Frequency of the signal
+/// @param[in] freqNum Frequency number. Only used for GLONASS G1 and G2
+/// @param[in] latitude 𝜙 Geodetic latitude in [rad]
+/// @param[in] longitude λ Geodetic longitude in [rad]
+/// @param[in] elevation Angle between the user and satellite [rad]
+/// @param[in] azimuth Angle between the user and satellite, measured clockwise positive from the true North [rad]
+/// @param[in] alpha The coefficients of a cubic equation representing the amplitude of the vertical delay
+/// @param[in] beta The coefficients of a cubic equation representing the period of the model
+/// @return Ionospheric time delay in [s]
+/// @note See \cite BDS-SIS-ICD-2.1 BeiDou SIS-ICD B1I ch. 5.2.4.7
+///
+/// In contrast to the GPS model, the pierce point is calculated on a thin shell at 375 km height, the coefficients are
+/// evaluated with the geographic latitude of the pierce point and the cosine is not approximated. The delay refers
+/// to the B1I frequency and gets adapted to the given frequency automatically.
+double calcIonosphericTimeDelay_BeiDouKlobuchar(double sow, Frequency freq, int8_t freqNum,
+                                                double latitude, double longitude,
+                                                double elevation, double azimuth,
+                                                const std::array<double, 4>& alpha, const std::array<double, 4>& beta);
+
+} // namespace NAV
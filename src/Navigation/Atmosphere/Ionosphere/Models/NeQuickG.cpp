@@ -0,0 +1,564 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "NeQuickG.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV::NeQuickG
+{
+
+namespace
+{
+
+/// Earth radius used by the model [km]
+constexpr double R_E = 6371.2;
+
+/// @brief Smoothly joins two functions at the origin of x
+/// @param[in] f1 Function value for x > 0
+/// @param[in] f2 Function value for x < 0
+/// @param[in] alpha Transition parameter
+/// @param[in] x Transition variable
+double neqJoin(double f1, double f2, double alpha, double x)
+{
+    double ee = std::exp(std::clamp(alpha * x, -80.0, 80.0));
+    return (f1 * ee + f2) / (ee + 1.0);
+}
+
+/// @brief Epstein function
+/// @param[in] X Peak amplitude
+/// @param[in] Y Peak height
+/// @param[in] Z Thickness parameter
+/// @param[in] W Height
+double epstein(double X, double Y, double Z, double W)
+{
+    double ee = std::exp(std::clamp((W - Y) / Z, -80.0, 80.0));
+    return X * ee / std::pow(1.0 + ee, 2);
+}
+
+/// @brief Third order interpolation between z[1] and z[2]
+/// @param[in] z Four equidistant values
+/// @param[in] x Position between z[1] (x = 0) and z[2] (x = 1)
+double interpolate(const std::array<double, 4>& z, double x)
+{
+    if (std::abs(2.0 * x) < 1e-10) { return z[1]; }
+    double delta = 2.0 * x - 1.0;
+    double g1 = z[2] + z[1];
+    double g2 = z[2] - z[1];
+    double g3 = z[3] + z[0];
+    double g4 = (z[3] - z[0]) / 3.0;
+    double a0 = 9.0 * g1 - g3;
+    double a1 = 9.0 * g2 - g4;
+    double a2 = g3 - g1;
+    double a3 = g4 - g2;
+    return (a0 + delta * (a1 + delta * (a2 + delta * a3))) / 16.0;
+}
+
+/// @brief Quantities which are the same for all points of an epoch (month, universal time and ionisation level)
+struct Epoch
+{
+    const Data* data = nullptr; ///< Model data
+    int month = 0;              ///< Month [1, 12]
+    double UT = -1.0;           ///< Universal time [h]
+    double Az = -1.0;           ///< Effective ionisation level [sfu]
+
+    double Az_R = 0.0;              ///< Effective sunspot number
+    double sinDec = 0.0;            ///< Sine of the solar declination
+    double cosDec = 0.0;            ///< Cosine of the solar declination
+    std::array<double, 76> CF2{};   ///< foF2 coefficients, evaluated for the time and solar activity
+    std::array<double, 49> Cm3{};   ///< M(3000)F2 coefficients, evaluated for the time and solar activity
+};
+
+/// @brief Returns the epoch quantities, which are only recalculated if the epoch changes
+/// @param[in] data Model data
+/// @param[in] month Month [1, 12]
+/// @param[in] UT Universal time [h]
+/// @param[in] Az Effective ionisation level [sfu]
+const Epoch& getEpoch(const Data& data, int month, double UT, double Az)
+{
+    thread_local Epoch epoch;
+    if (epoch.data == &data && epoch.month == month && epoch.UT == UT && epoch.Az == Az) { return epoch; }
+
+    epoch.data = &data;
+    epoch.month = month;
+    epoch.UT = UT;
+    epoch.Az = Az;
+
+    epoch.Az_R = std::sqrt(167273.0 + (Az - 63.7) * 1123.6) - 408.99;
+
+    // Solar declination
+    double doy = 30.5 * month - 15.0;
+    double t = doy + (18.0 - UT) / 24.0;
+    double am = deg2rad(0.9856 * t - 3.289);
+    double al = am + deg2rad(1.916 * std::sin(am) + 0.020 * std::sin(2.0 * am) + 282.634);
+    epoch.sinDec = 0.39782 * std::sin(al);
+    epoch.cosDec = std::sqrt(1.0 - epoch.sinDec * epoch.sinDec);
+
+    // Interpolation in solar activity and Fourier series in time
+    const auto& ccir = data.ccir.at(static_cast<size_t>(month - 1));
+    double T = deg2rad(15.0 * UT - 180.0);
+    std::array<double, 7> sinT{};
+    std::array<double, 7> cosT{};
+    for (size_t k = 1; k < sinT.size(); k++)
+    {
+        sinT.at(k) = std::sin(static_cast<double>(k) * T);
+        cosT.at(k) = std::cos(static_cast<double>(k) * T);
+    }
+    double w1 = epoch.Az_R / 100.0;
+    double w0 = 1.0 - w1;
+    for (size_t i = 0; i < epoch.CF2.size(); i++)
+    {
+        auto a = [&](size_t j) { return w0 * ccir.F2[0][i][j] + w1 * ccir.F2[1][i][j]; };
+        epoch.CF2.at(i) = a(0);
+        for (size_t k = 1; k <= 6; k++) { epoch.CF2.at(i) += a(2 * k - 1) * sinT.at(k) + a(2 * k) * cosT.at(k); }
+    }
+    for (size_t i = 0; i < epoch.Cm3.size(); i++)
+    {
+        auto a = [&](size_t j) { return w0 * ccir.Fm3[0][i][j] + w1 * ccir.Fm3[1][i][j]; };
+        epoch.Cm3.at(i) = a(0);
+        for (size_t k = 1; k <= 4; k++) { epoch.Cm3.at(i) += a(2 * k - 1) * sinT.at(k) + a(2 * k) * cosT.at(k); }
+    }
+
+    return epoch;
+}
+
+/// @brief Parameters of the vertical electron density profile at a location
+struct Profile
+{
+    double NmF2 = 0.0;  ///< F2 peak electron density [10^11 / m^3]
+    double hmE = 120.0; ///< E layer peak height [km]
+    double hmF1 = 0.0;  ///< F1 layer peak height [km]
+    double hmF2 = 0.0;  ///< F2 layer peak height [km]
+    double B2bot = 0.0; ///< F2 bottomside thickness [km]
+    double B1top = 0.0; ///< F1 topside thickness [km]
+    double B1bot = 0.0; ///< F1 bottomside thickness [km]
+    double BEtop = 0.0; ///< E topside thickness [km]
+    double BEbot = 5.0; ///< E bottomside thickness [km]
+    double A1 = 0.0;    ///< F2 Epstein amplitude
+    double A2 = 0.0;    ///< F1 Epstein amplitude
+    double A3 = 0.0;    ///< E Epstein amplitude
+    double H0 = 0.0;    ///< Topside thickness [km]
+};
+
+/// @brief Calculates the profile parameters
+/// @param[in] epoch Epoch quantities
+/// @param[in] latitude Geographic latitude [rad]
+/// @param[in] longitude Geographic longitude [rad]
+/// @param[in] modip Modified dip latitude [deg]
+Profile calcProfile(const Epoch& epoch, double latitude, double longitude, double modip)
+{
+    Profile p;
+
+    // ---------------------------------------------- E layer ------------------------------------------------
+    double LT = epoch.UT + rad2deg(longitude) / 15.0;
+    double cosChi = std::sin(latitude) * epoch.sinDec + std::cos(latitude) * epoch.cosDec * std::cos(M_PI / 12.0 * (12.0 - LT));
+    double chi = rad2deg(std::atan2(std::sqrt(std::max(1.0 - cosChi * cosChi, 0.0)), cosChi));
+    double chiEff = neqJoin(90.0 - 0.24 * std::exp(std::min(20.0 - 0.2 * chi, 80.0)), chi, 12.0, chi - 86.23292796211615);
+
+    double seas = 0.0;
+    if (epoch.month == 1 || epoch.month == 2 || epoch.month == 11 || epoch.month == 12) { seas = -1.0; }
+    else if (epoch.month >= 5 && epoch.month <= 8) { seas = 1.0; }
+    double ee = std::exp(0.3 * rad2deg(latitude));
+    double seasp = seas * (ee - 1.0) / (ee + 1.0);
+    double foE = std::sqrt(std::pow(1.112 - 0.019 * seasp, 2) * std::sqrt(epoch.Az) * std::pow(std::cos(deg2rad(chiEff)), 0.6) + 0.49);
+    double NmE = 0.124 * foE * foE;
+
+    // ------------------------------------------ F2 layer (CCIR) --------------------------------------------
+    std::array<double, 12> M{};
+    M[0] = 1.0;
+    double sinModip = std::sin(deg2rad(modip));
+    for (size_t k = 1; k < M.size(); k++) { M.at(k) = M.at(k - 1) * sinModip; }
+    std::array<double, 9> P{};
+    std::array<double, 9> S{};
+    std::array<double, 9> C{};
+    P[0] = 1.0;
+    double cosLat = std::cos(latitude);
+    for (size_t n = 1; n < P.size(); n++)
+    {
+        P.at(n) = P.at(n - 1) * cosLat;
+        S.at(n) = std::sin(static_cast<double>(n) * longitude);
+        C.at(n) = std::cos(static_cast<double>(n) * longitude);
+    }
+
+    constexpr std::array<size_t, 9> Q = { 12, 12, 9, 5, 2, 1, 1, 1, 1 };
+    double foF2 = 0.0;
+    for (size_t k = 0; k < Q[0]; k++) { foF2 += epoch.CF2.at(k) * M.at(k); }
+    for (size_t n = 1, idx = Q[0]; n < Q.size(); n++)
+    {
+        for (size_t k = 0; k < Q.at(n); k++, idx += 2)
+        {
+            foF2 += (epoch.CF2.at(idx) * C.at(n) + epoch.CF2.at(idx + 1) * S.at(n)) * M.at(k) * P.at(n);
+        }
+    }
+
+    constexpr std::array<size_t, 7> R = { 7, 8, 6, 3, 2, 1, 1 };
+    double M3000 = 0.0;
+    for (size_t k = 0; k < R[0]; k++) { M3000 += epoch.Cm3.at(k) * M.at(k); }
+    for (size_t n = 1, idx = R[0]; n < R.size(); n++)
+    {
+        for (size_t k = 0; k < R.at(n); k++, idx += 2)
+        {
+            M3000 += (epoch.Cm3.at(idx) * C.at(n) + epoch.Cm3.at(idx + 1) * S.at(n)) * M.at(k) * P.at(n);
+        }
+    }
+    p.NmF2 = 0.124 * foF2 * foF2;
+
+    // ---------------------------------------------- F1 layer -----------------------------------------------
+    double foF1 = neqJoin(1.4 * foE, 0.0, 1000.0, foE - 2.0);
+    foF1 = neqJoin(0.0, foF1, 1000.0, foE - foF1);
+    foF1 = neqJoin(foF1, 0.85 * foF2, 60.0, 0.85 * foF2 - foF1);
+    if (foF1 < 1e-6) { foF1 = 0.0; }
+    double NmF1 = foF1 <= 0.0 && foE > 2.0 ? 0.124 * std::pow(foE + 0.5, 2) : 0.124 * foF1 * foF1;
+
+    // ------------------------------------------ Peak heights -----------------------------------------------
+    double ratio = foF2 / foE;
+    double rho = neqJoin(ratio, 1.75, 20.0, ratio - 1.75);
+    double deltaM = foE >= 1e-30 ? 0.253 / (rho - 1.215) - 0.012 : -0.012;
+    p.hmF2 = 1490.0 * M3000 * std::sqrt((0.0196 * M3000 * M3000 + 1.0) / (1.2967 * M3000 * M3000 - 1.0)) / (M3000 + deltaM) - 176.0;
+    p.hmF1 = (p.hmF2 + p.hmE) / 2.0;
+
+    // -------------------------------------------- Thicknesses ----------------------------------------------
+    p.B2bot = 0.385 * p.NmF2 / (0.01 * std::exp(-3.467 + 0.857 * std::log(foF2 * foF2) + 2.02 * std::log(M3000)));
+    p.B1top = 0.3 * (p.hmF2 - p.hmF1);
+    p.B1bot = 0.5 * (p.hmF1 - p.hmE);
+    p.BEtop = std::max(p.B1bot, 7.0);
+
+    // -------------------------------------------- Amplitudes -----------------------------------------------
+    p.A1 = 4.0 * p.NmF2;
+    double A3a = 0.0;
+    if (foF1 < 0.5)
+    {
+        A3a = 4.0 * (NmE - epstein(p.A1, p.hmF2, p.B2bot, p.hmE));
+    }
+    else
+    {
+        A3a = 4.0 * NmE;
+        double A2a = 0.0;
+        for (int i = 0; i < 5; i++)
+        {
+            A2a = 4.0 * (NmF1 - epstein(p.A1, p.hmF2, p.B2bot, p.hmF1) - epstein(A3a, p.hmE, p.BEtop, p.hmF1));
+            A2a = neqJoin(A2a, 0.8 * NmF1, 1.0, A2a - 0.8 * NmF1);
+            A3a = 4.0 * (NmE - epstein(A2a, p.hmF1, p.B1bot, p.hmE) - epstein(p.A1, p.hmF2, p.B2bot, p.hmE));
+        }
+        p.A2 = A2a;
+    }
+    p.A3 = neqJoin(A3a, 0.05, 60.0, A3a - 0.005);
+
+    // ---------------------------------------------- Topside ------------------------------------------------
+    double k = 3.22 - 0.0538 * foF2 - 0.00664 * p.hmF2 + 0.113 * p.hmF2 / p.B2bot + 0.00257 * epoch.Az_R;
+    k = neqJoin(k, 1.0, 2.0, k - 1.0);
+    p.H0 = k * p.B2bot;
+
+    return p;
+}
+
+/// @brief Electron density of the profile
+/// @param[in] p Profile parameters
+/// @param[in] h Height [km]
+/// @return Electron density [10^11 / m^3]
+double density(const Profile& p, double h)
+{
+    if (h > p.hmF2) // Topside
+    {
+        constexpr double g = 0.125;
+        constexpr double r = 100.0;
+        double dh = h - p.hmF2;
+        double z = dh / (p.H0 * (1.0 + r * g * dh / (r * p.H0 + g * dh)));
+        double ea = std::exp(std::min(z, 80.0));
+        if (ea > 1e11) { return 4.0 * p.NmF2 / ea; }
+        return 4.0 * p.NmF2 * ea / std::pow(1.0 + ea, 2);
+    }
+
+    // Bottomside
+    double hb = std::max(h, 100.0);
+    double BE = hb > p.hmE ? p.BEtop : p.BEbot;
+    double BF1 = hb > p.hmF1 ? p.B1top : p.B1bot;
+    double fade = std::exp(10.0 / (1.0 + std::abs(hb - p.hmF2)));
+    std::array<double, 3> alpha = { (hb - p.hmF2) / p.B2bot, (hb - p.hmF1) / BF1 * fade, (hb - p.hmE) / BE * fade };
+    std::array<double, 3> A = { p.A1, p.A2, p.A3 };
+    std::array<double, 3> B = { p.B2bot, BF1, BE };
+
+    double sum = 0.0;
+    double dsum = 0.0;
+    for (size_t i = 0; i < alpha.size(); i++)
+    {
+        if (std::abs(alpha.at(i)) > 25.0) { continue; }
+        double ea = std::exp(alpha.at(i));
+        double s = A.at(i) * ea / std::pow(1.0 + ea, 2);
+        sum += s;
+        dsum += s * (1.0 - ea) / (B.at(i) * (1.0 + ea));
+    }
+    if (h >= 100.0) { return sum; }
+
+    // Below 100 km the density decays with a Chapman layer
+    if (sum <= 0.0) { return 0.0; }
+    double BC = 1.0 - 10.0 * dsum / sum;
+    double z = (h - 100.0) / 10.0;
+    return sum * std::exp(1.0 - BC * z - std::exp(-z));
+}
+
+/// @brief Gauss-Kronrod G7-K15 nodes on [0, 1] (positive half)
+constexpr std::array<double, 8> GK_NODES = { 0.0,
+                                             0.207784955007898467600689403773245,
+                                             0.405845151377397166906606412076961,
+                                             0.586087235467691130294144845693013,
+                                             0.741531185599394439863864773280788,
+                                             0.864864423359769072789712788640926,
+                                             0.949107912342758524526189684047851,
+                                             0.991455371120812639206854697526329 };
+/// @brief Kronrod weights of the nodes
+constexpr std::array<double, 8> K15_WEIGHTS = { 0.209482141084727828012999174891714,
+                                                0.204432940075298892414161999234649,
+                                                0.190350578064785409913256402421014,
+                                                0.169004726639267902826583426598550,
+                                                0.140653259715525918745189590510238,
+                                                0.104790010322250183839876322541518,
+                                                0.063092092629978553290700663189204,
+                                                0.022935322010529224963732008058970 };
+/// @brief Gauss weights of the nodes (only at the even indices)
+constexpr std::array<double, 8> G7_WEIGHTS = { 0.417959183673469387755102040816327, 0.0,
+                                               0.381830050505118944950369775488975, 0.0,
+                                               0.279705391489276667901467771423780, 0.0,
+                                               0.129484966168869693270611432679082, 0.0 };
+
+/// @brief Adaptive Gauss-Kronrod integration
+/// @param[in] f Function to integrate
+/// @param[in] a Lower bound
+/// @param[in] b Upper bound
+/// @param[in] tolerance Relative tolerance
+/// @param[in] depth Remaining recursion depth
+template<typename Func>
+double integrate(const Func& f, double a, double b, double tolerance, int depth)
+{
+    double center = 0.5 * (a + b);
+    double halfLength = 0.5 * (b - a);
+
+    double fc = f(center);
+    double G = G7_WEIGHTS[0] * fc;
+    double K = K15_WEIGHTS[0] * fc;
+    for (size_t i = 1; i < GK_NODES.size(); i++)
+    {
+        double dx = halfLength * GK_NODES.at(i);
+        double sum = f(center - dx) + f(center + dx);
+        G += G7_WEIGHTS.at(i) * sum;
+        K += K15_WEIGHTS.at(i) * sum;
+    }
+    G *= halfLength;
+    K *= halfLength;
+
+    if (std::abs(K - G) <= tolerance * std::abs(K) || depth <= 0)
+    {
+        return K;
+    }
+    return integrate(f, a, center, tolerance, depth - 1) + integrate(f, center, b, tolerance, depth - 1);
+}
+
+/// @brief Cached slant TEC of a satellite
+struct CacheEntry
+{
+    const Data* data = nullptr;                     ///< Model data
+    std::array<double, 4> ai{};                     ///< Broadcast coefficients
+    double gpsTime = 0.0;                           ///< Time of the calculation [s]
+    Eigen::Vector3d e_pos = Eigen::Vector3d::Zero(); ///< Receiver position [m]
+    Eigen::Vector3d e_satPos = Eigen::Vector3d::Zero(); ///< Satellite position [m]
+    double stec = 0.0;                              ///< Slant TEC [TECU]
+};
+
+/// @brief Reads all numbers of a file
+/// @param[in] path Path to the file
+std::vector<double> readNumbers(const std::filesystem::path& path)
+{
+    std::vector<double> numbers;
+    std::ifstream file(path);
+    double value = 0.0;
+    while (file >> value) { numbers.push_back(value); }
+    return numbers;
+}
+
+} // namespace
+
+std::shared_ptr<const Data> LoadData(const std::filesystem::path& directory)
+{
+    auto data = std::make_shared<Data>();
+
+    auto modipValues = readNumbers(directory / "modipNeQG_wrapped.asc");
+    if (modipValues.size() != 39 * 39)
+    {
+        LOG_ERROR("NeQuick-G: Could not read the MODIP grid from '{}' ({} values)", (directory / "modipNeQG_wrapped.asc").string(), modipValues.size());
+        return nullptr;
+    }
+    for (size_t i = 0; i < 39; i++)
+    {
+        for (size_t j = 0; j < 39; j++) { data->modip.at(i).at(j) = modipValues.at(i * 39 + j); }
+    }
+
+    for (size_t m = 0; m < 12; m++)
+    {
+        auto path = directory / fmt::format("ccir{}.asc", m + 11);
+        auto values = readNumbers(path);
+        if (values.size() != 2 * 76 * 13 + 2 * 49 * 9)
+        {
+            LOG_ERROR("NeQuick-G: Could not read the CCIR coefficients from '{}' ({} values)", path.string(), values.size());
+            return nullptr;
+        }
+        // File order of the official files: time index fastest, then the spatial index, then the solar activity
+        size_t v = 0;
+        auto& ccir = data->ccir.at(m);
+        for (auto& solar : ccir.F2)
+        {
+            for (auto& spatial : solar)
+            {
+                for (auto& coeff : spatial) { coeff = values.at(v++); }
+            }
+        }
+        for (auto& solar : ccir.Fm3)
+        {
+            for (auto& spatial : solar)
+            {
+                for (auto& coeff : spatial) { coeff = values.at(v++); }
+            }
+        }
+    }
+
+    LOG_DEBUG("NeQuick-G: Loaded the model data from '{}'", directory.string());
+    return data;
+}
+
+std::shared_ptr<const Data> DefaultData()
+{
+    static const std::shared_ptr<const Data> data = LoadData("resources/data/NeQuickG");
+    return data;
+}
+
+double modip(const Data& data, double latitude, double longitude)
+{
+    double lat = rad2deg(latitude);
+    if (lat <= -90.0) { return -90.0; }
+    if (lat >= 90.0) { return 90.0; }
+    double lon = rad2deg(longitude);
+    lon = std::fmod(lon + 180.0, 360.0);
+    if (lon < 0.0) { lon += 360.0; }
+
+    // Grid position (row 1 is -90°, column 1 is -180°)
+    double row = lat / 5.0 + 19.0;
+    double col = lon / 10.0 + 1.0;
+    auto r0 = std::clamp(static_cast<size_t>(std::floor(row)) - 1, size_t(0), size_t(35));
+    auto c0 = std::clamp(static_cast<size_t>(std::floor(col)) - 1, size_t(0), size_t(35));
+
+    std::array<double, 4> z{};
+    for (size_t k = 0; k < 4; k++)
+    {
+        std::array<double, 4> zLat{};
+        for (size_t j = 0; j < 4; j++) { zLat.at(j) = data.modip.at(r0 + j).at(c0 + k); }
+        z.at(k) = interpolate(zLat, row - static_cast<double>(r0 + 1));
+    }
+    return interpolate(z, col - static_cast<double>(c0 + 1));
+}
+
+double effectiveIonisationLevel(const std::array<double, 4>& ai, double modip)
+{
+    if (ai[0] == 0.0 && ai[1] == 0.0 && ai[2] == 0.0) { return 63.7; }
+    return std::clamp(ai[0] + ai[1] * modip + ai[2] * modip * modip, 0.0, 400.0);
+}
+
+double electronDensity(const Data& data, int month, double UT, double Az, const Eigen::Vector3d& lla_pos)
+{
+    const auto& epoch = getEpoch(data, month, UT, Az);
+    auto profile = calcProfile(epoch, lla_pos(0), lla_pos(1), modip(data, lla_pos(0), lla_pos(1)));
+    return density(profile, lla_pos(2) * 1e-3) * 1e11;
+}
+
+double calcSTEC(const Data& data, int month, double UT, const std::array<double, 4>& ai,
+                const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& lla_satPos, const Settings& settings)
+{
+    double Az = effectiveIonisationLevel(ai, modip(data, lla_pos(0), lla_pos(1)));
+    const auto& epoch = getEpoch(data, month, UT, Az);
+
+    // The model uses a spherical earth with the geographic coordinates as spherical coordinates [km]
+    auto toSphere = [](const Eigen::Vector3d& lla) {
+        double r = R_E + lla(2) * 1e-3;
+        return Eigen::Vector3d(r * std::cos(lla(0)) * std::cos(lla(1)), r * std::cos(lla(0)) * std::sin(lla(1)), r * std::sin(lla(0)));
+    };
+    Eigen::Vector3d p1 = toSphere(lla_pos);
+    Eigen::Vector3d p2 = toSphere(lla_satPos);
+    Eigen::Vector3d u = (p2 - p1).normalized();
+    // Ray perigee, the point of the ray closest to the earth center
+    double s1 = p1.dot(u);
+    double s2 = p2.dot(u);
+    Eigen::Vector3d perigee = p1 - s1 * u;
+    double rp = perigee.norm();
+
+    auto integrand = [&](double s) {
+        Eigen::Vector3d x = perigee + s * u;
+        double r = x.norm();
+        double latitude = std::asin(x(2) / r);
+        double longitude = std::atan2(x(1), x(0));
+        auto profile = calcProfile(epoch, latitude, longitude, modip(data, latitude, longitude));
+        return density(profile, r - R_E);
+    };
+
+    // Distance from the perigee where the ray reaches the height, clamped to the ray
+    auto sAtHeight = [&](double h) {
+        double r = R_E + h;
+        return std::clamp(r > rp ? std::sqrt(r * r - rp * rp) : 0.0, s1, s2);
+    };
+    double sa = sAtHeight(1000.0);
+    double sb = sAtHeight(2000.0);
+
+    double tec = 0.0;
+    if (sa > s1) { tec += integrate(integrand, s1, sa, settings.toleranceLow, settings.maxRecursion); }
+    if (sb > sa) { tec += integrate(integrand, sa, sb, settings.toleranceHigh, settings.maxRecursion); }
+    if (s2 > sb) { tec += integrate(integrand, sb, s2, settings.toleranceHigh, settings.maxRecursion); }
+
+    // [10^11 / m^3 * km] = 10^14 / m^2 = 0.01 TECU
+    return tec * 0.01;
+}
+
+double calcSTECCached(const Data& data, double gpsTime, int month, double UT, const std::array<double, 4>& ai,
+                      const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& lla_satPos, const Settings& settings)
+{
+    if (settings.cacheMaxAge <= 0.0) { return calcSTEC(data, month, UT, ai, lla_pos, lla_satPos, settings); }
+
+    thread_local std::vector<CacheEntry> cache;
+
+    Eigen::Vector3d e_pos = trafo::lla2ecef_WGS84(lla_pos);
+    Eigen::Vector3d e_satPos = trafo::lla2ecef_WGS84(lla_satPos);
+
+    // Forget old values, so that the cache only holds the visible satellites
+    std::erase_if(cache, [&](const CacheEntry& entry) { return std::abs(gpsTime - entry.gpsTime) > settings.cacheMaxAge; });
+
+    auto iter = std::find_if(cache.begin(), cache.end(), [&](const CacheEntry& entry) {
+        return entry.data == &data && entry.ai == ai
+               && (entry.e_satPos - e_satPos).norm() <= settings.cacheMaxSatelliteDistance
+               && (entry.e_pos - e_pos).norm() <= settings.cacheMaxReceiverDistance;
+    });
+    if (iter != cache.end()) { return iter->stec; }
+
+    double stec = calcSTEC(data, month, UT, ai, lla_pos, lla_satPos, settings);
+    cache.push_back(CacheEntry{ .data = &data, .ai = ai, .gpsTime = gpsTime, .e_pos = e_pos, .e_satPos = e_satPos, .stec = stec });
+    return stec;
+}
+
+double stec2timeDelay(double stec, Frequency freq, int8_t freqNum)
+{
+    double f = freq.getFrequency(freqNum);
+    return 40.3e16 * stec / (f * f) / InsConst<>::C;
+}
+
+} // namespace NAV::NeQuickG
@@ -0,0 +1,128 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NeQuickG.hpp
+/// @brief NeQuick-G ionospheric correction model for Galileo single frequency users
+/// @date 2026-10-18
+/// @note See \cite NeQuickG2016 European GNSS (Galileo) Open Service - Ionospheric Correction Algorithm for Galileo Single Frequency Users, Issue 1.2
+
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Navigation/GNSS/Core/Frequency.hpp"
+
+namespace NAV::NeQuickG
+{
+
+/// @brief CCIR coefficients of one month
+struct CcirCoefficients
+{
+    /// foF2 coefficients [solar activity R12 = 0 / 100][spatial][time]
+    std::array<std::array<std::array<double, 13>, 76>, 2> F2{};
+    /// M(3000)F2 coefficients [solar activity R12 = 0 / 100][spatial][time]
+    std::array<std::array<std::array<double, 9>, 49>, 2> Fm3{};
+};
+
+/// @brief Model data of NeQuick-G
+struct Data
+{
+    /// Modified dip latitude (MODIP) grid [deg]. Rows from -95° to 95° latitude in 5° steps, columns from -190° to 190° longitude
+    /// in 10° steps (the outer rows and columns wrap around the poles and the date line)
+    std::array<std::array<double, 39>, 39> modip{};
+    /// CCIR coefficients for January to December
+    std::array<CcirCoefficients, 12> ccir{};
+};
+
+/// @brief Reads the model data from the official files 'modipNeQG_wrapped.asc' and 'ccir11.asc' to 'ccir22.asc'
+/// @param[in] directory Directory containing the files
+/// @return The data or nullptr if a file is missing or incomplete
+[[nodiscard]] std::shared_ptr<const Data> LoadData(const std::filesystem::path& directory);
+
+/// @brief Model data from 'resources/data/NeQuickG', loaded on the first call
+/// @return The data or nullptr if the files are not available
+[[nodiscard]] std::shared_ptr<const Data> DefaultData();
+
+/// @brief Settings which trade accuracy for speed
+struct Settings
+{
+    /// Relative tolerance of the integration below 1000 km
+    double toleranceLow = 1e-3;
+    /// Relative tolerance of the integration above 1000 km
+    double toleranceHigh = 1e-2;
+    /// Maximum recursion depth of the adaptive integration
+    int maxRecursion = 50;
+    /// Slant TEC of a satellite is reused for this time [s] (0 disables the cache)
+    double cacheMaxAge = 1.0;
+    /// Slant TEC is reused if the receiver moved less than this distance [m]
+    double cacheMaxReceiverDistance = 100.0;
+    /// Slant TEC is reused if the satellite moved less than this distance [m]
+    double cacheMaxSatelliteDistance = 5000.0;
+};
+
+/// @brief Interpolates the modified dip latitude (MODIP) from the grid
+/// @param[in] data Model data
+/// @param[in] latitude Geographic latitude [rad]
+/// @param[in] longitude Geographic longitude [rad]
+/// @return MODIP [deg]
+[[nodiscard]] double modip(const Data& data, double latitude, double longitude);
+
+/// @brief Effective ionisation level Az from the broadcast coefficients
+/// @param[in] ai Broadcast coefficients [sfu, sfu/deg, sfu/deg^2]
+/// @param[in] modip Modified dip latitude of the receiver [deg]
+/// @return Az [sfu]
+[[nodiscard]] double effectiveIonisationLevel(const std::array<double, 4>& ai, double modip);
+
+/// @brief Electron density
+/// @param[in] data Model data
+/// @param[in] month Month [1, 12]
+/// @param[in] UT Universal time [h]
+/// @param[in] Az Effective ionisation level [sfu]
+/// @param[in] lla_pos [𝜙, λ, h]^T Geographic latitude, longitude and height in [rad, rad, m]
+/// @return Electron density [1/m^3]
+[[nodiscard]] double electronDensity(const Data& data, int month, double UT, double Az, const Eigen::Vector3d& lla_pos);
+
+/// @brief Calculates the slant total electron content between receiver and satellite
+/// @param[in] data Model data
+/// @param[in] month Month [1, 12]
+/// @param[in] UT Universal time [h]
+/// @param[in] ai Broadcast coefficients [sfu, sfu/deg, sfu/deg^2]
+/// @param[in] lla_pos [𝜙, λ, h]^T Receiver latitude, longitude and height in [rad, rad, m]
+/// @param[in] lla_satPos [𝜙, λ, h]^T Satellite latitude, longitude and height in [rad, rad, m]
+/// @param[in] settings Integration settings (the cache settings are not used)
+/// @return Slant TEC [TECU]
+[[nodiscard]] double calcSTEC(const Data& data, int month, double UT, const std::array<double, 4>& ai,
+                              const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& lla_satPos, const Settings& settings = {});
+
+/// @brief Calculates the slant total electron content, reusing cached values of the same satellite
+///
+/// The cache is kept per thread, so every node computing on its own worker thread gets reproducible results.
+/// @param[in] data Model data
+/// @param[in] gpsTime Time as seconds since the GPS epoch, only used for the cache [s]
+/// @param[in] month Month [1, 12]
+/// @param[in] UT Universal time [h]
+/// @param[in] ai Broadcast coefficients [sfu, sfu/deg, sfu/deg^2]
+/// @param[in] lla_pos [𝜙, λ, h]^T Receiver latitude, longitude and height in [rad, rad, m]
+/// @param[in] lla_satPos [𝜙, λ, h]^T Satellite latitude, longitude and height in [rad, rad, m]
+/// @param[in] settings Integration and cache settings
+/// @return Slant TEC [TECU]
+[[nodiscard]] double calcSTECCached(const Data& data, double gpsTime, int month, double UT, const std::array<double, 4>& ai,
+                                    const Eigen::Vector3d& lla_pos, const Eigen::Vector3d& lla_satPos, const Settings& settings = {});
+
+/// @brief Converts slant TEC into the ionospheric time delay
+/// @param[in] stec Slant TEC [TECU]
+/// @param[in] freq Frequency of the signal
+/// @param[in] freqNum Frequency number. Only used for GLONASS G1 and G2
+/// @return Ionospheric time delay in [s]
+[[nodiscard]] double stec2timeDelay(double stec, Frequency freq, int8_t freqNum);
+
+} // namespace NAV::NeQuickG
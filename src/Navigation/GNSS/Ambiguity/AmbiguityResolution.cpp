@@ -0,0 +1,289 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AmbiguityResolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <Eigen/LU>
+
+namespace NAV::Ambiguity
+{
+
+namespace
+{
+
+/// @brief Sign function used for the zig-zag enumeration of the search
+/// @param[in] x Value
+/// @return -1 for x ≤ 0, otherwise 1
+double sign(double x)
+{
+    return x <= 0.0 ? -1.0 : 1.0;
+}
+
+/// @brief Integer Gauss transformation, which reduces the element L(i,j) to |L(i,j)| ≤ 0.5
+/// @param[in, out] L Unit lower triangular matrix
+/// @param[in, out] Z Transformation matrix
+/// @param[in] i Row index
+/// @param[in] j Column index
+void gaussTransformation(Eigen::MatrixXd& L, Eigen::MatrixXd& Z, Eigen::Index i, Eigen::Index j)
+{
+    double mu = std::round(L(i, j));
+    if (mu == 0.0) { return; }
+
+    L.col(j).tail(L.rows() - i) -= mu * L.col(i).tail(L.rows() - i);
+    Z.col(j) -= mu * Z.col(i);
+}
+
+/// @brief Permutes the ambiguities j and j+1 and updates the decomposition accordingly
+/// @param[in, out] L Unit lower triangular matrix
+/// @param[in, out] D Conditional variances
+/// @param[in] j Index of the ambiguity to permute with its successor
+/// @param[in] delta New conditional variance of the ambiguity j+1
+/// @param[in, out] Z Transformation matrix
+void permute(Eigen::MatrixXd& L, Eigen::VectorXd& D, Eigen::Index j, double delta, Eigen::MatrixXd& Z)
+{
+    double eta = D(j) / delta;
+    double lambda = D(j + 1) * L(j + 1, j) / delta;
+    D(j) = eta * D(j + 1);
+    D(j + 1) = delta;
+    for (Eigen::Index k = 0; k < j; k++)
+    {
+        double a0 = L(j, k);
+        double a1 = L(j + 1, k);
+        L(j, k) = -L(j + 1, j) * a0 + a1;
+        L(j + 1, k) = eta * a0 + lambda * a1;
+    }
+    L(j + 1, j) = lambda;
+    auto n = L.rows();
+    L.col(j).tail(n - j - 2).swap(L.col(j + 1).tail(n - j - 2));
+    Z.col(j).swap(Z.col(j + 1));
+}
+
+} // namespace
+
+bool LtDLdecomposition(const Eigen::MatrixXd& Q, Eigen::MatrixXd& L, Eigen::VectorXd& D)
+{
+    auto n = Q.rows();
+    Eigen::MatrixXd A = Q;
+    L = Eigen::MatrixXd::Zero(n, n);
+    D = Eigen::VectorXd::Zero(n);
+
+    for (Eigen::Index i = n - 1; i >= 0; i--)
+    {
+        D(i) = A(i, i);
+        if (D(i) <= 0.0 || !std::isfinite(D(i))) { return false; }
+
+        double a = std::sqrt(D(i));
+        L.row(i).head(i + 1) = A.row(i).head(i + 1) / a;
+        for (Eigen::Index j = 0; j < i; j++)
+        {
+            A.row(j).head(j + 1) -= L(i, j) * L.row(i).head(j + 1);
+        }
+        L.row(i).head(i + 1) /= L(i, i);
+    }
+    return true;
+}
+
+std::optional<Decorrelation> decorrelate(const Eigen::MatrixXd& Q)
+{
+    auto n = Q.rows();
+    Decorrelation dec{ .Z = Eigen::MatrixXd::Identity(n, n), .L = {}, .D = {} };
+    if (!LtDLdecomposition(Q, dec.L, dec.D)) { return std::nullopt; }
+    if (n < 2) { return dec; }
+
+    Eigen::Index j = n - 2;
+    Eigen::Index k = n - 2;
+    while (j >= 0)
+    {
+        if (j <= k)
+        {
+            for (Eigen::Index i = j + 1; i < n; i++) { gaussTransformation(dec.L, dec.Z, i, j); }
+        }
+        double delta = dec.D(j) + std::pow(dec.L(j + 1, j), 2) * dec.D(j + 1);
+        if (delta + 1e-6 < dec.D(j + 1))
+        {
+            permute(dec.L, dec.D, j, delta, dec.Z);
+            k = j;
+            j = n - 2;
+        }
+        else
+        {
+            j--;
+        }
+    }
+    return dec;
+}
+
+std::vector<Candidate> search(const Eigen::Ref<const Eigen::MatrixXd>& L, const Eigen::Ref<const Eigen::VectorXd>& D, const Eigen::Ref<const Eigen::VectorXd>& z_float, size_t nCandidates)
+{
+    auto n = z_float.size();
+    std::vector<Candidate> candidates;
+    if (n == 0 || nCandidates == 0) { return candidates; }
+    candidates.reserve(nCandidates);
+
+    Eigen::MatrixXd S = Eigen::MatrixXd::Zero(n, n); // Accumulated conditional adjustments
+    Eigen::VectorXd dist = Eigen::VectorXd::Zero(n); // Partial squared distances
+    Eigen::VectorXd zb(n);                           // Conditional float ambiguities
+    Eigen::VectorXd z(n);                            // Current integer vector
+    Eigen::VectorXd step(n);                         // Steps of the zig-zag enumeration
+    size_t iMax = 0;                                 // Index of the worst candidate
+    double maxDist = std::numeric_limits<double>::infinity();
+
+    Eigen::Index k = n - 1;
+    zb(k) = z_float(k);
+    z(k) = std::round(zb(k));
+    double y = zb(k) - z(k);
+    step(k) = sign(y);
+
+    while (true)
+    {
+        double newDist = dist(k) + y * y / D(k);
+        if (newDist < maxDist)
+        {
+            if (k != 0) // Move down
+            {
+                dist(--k) = newDist;
+                S.row(k).head(k + 1) = S.row(k + 1).head(k + 1) + (z(k + 1) - zb(k + 1)) * L.row(k + 1).head(k + 1);
+                zb(k) = z_float(k) + S(k, k);
+                z(k) = std::round(zb(k));
+                y = zb(k) - z(k);
+                step(k) = sign(y);
+            }
+            else // Store the candidate and try the next integer on the same level
+            {
+                if (candidates.size() < nCandidates)
+                {
+                    if (candidates.empty() || newDist > candidates.at(iMax).squaredNorm) { iMax = candidates.size(); }
+                    candidates.push_back(Candidate{ .z = z, .squaredNorm = newDist });
+                    if (candidates.size() == nCandidates) { maxDist = candidates.at(iMax).squaredNorm; }
+                }
+                else if (newDist < candidates.at(iMax).squaredNorm)
+                {
+                    candidates.at(iMax) = Candidate{ .z = z, .squaredNorm = newDist };
+                    iMax = static_cast<size_t>(std::distance(candidates.begin(),
+                                                             std::max_element(candidates.begin(), candidates.end(),
+                                                                              [](const Candidate& lhs, const Candidate& rhs) { return lhs.squaredNorm < rhs.squaredNorm; })));
+                    maxDist = candidates.at(iMax).squaredNorm;
+                }
+                z(0) += step(0);
+                y = zb(0) - z(0);
+                step(0) = -step(0) - sign(step(0));
+            }
+        }
+        else // Move up
+        {
+            if (k == n - 1) { break; }
+            k++;
+            z(k) += step(k);
+            y = zb(k) - z(k);
+            step(k) = -step(k) - sign(step(k));
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) { return lhs.squaredNorm < rhs.squaredNorm; });
+    return candidates;
+}
+
+Candidate bootstrap(const Eigen::Ref<const Eigen::MatrixXd>& L, const Eigen::Ref<const Eigen::VectorXd>& D, const Eigen::Ref<const Eigen::VectorXd>& z_float)
+{
+    auto n = z_float.size();
+    Candidate candidate{ .z = Eigen::VectorXd(n), .squaredNorm = 0.0 };
+    Eigen::VectorXd residual(n); // z - zb of the already fixed ambiguities
+
+    for (Eigen::Index k = n - 1; k >= 0; k--)
+    {
+        double zb = z_float(k) + L.col(k).tail(n - k - 1).dot(residual.tail(n - k - 1));
+        candidate.z(k) = std::round(zb);
+        residual(k) = candidate.z(k) - zb;
+        candidate.squaredNorm += residual(k) * residual(k) / D(k);
+    }
+    return candidate;
+}
+
+double bootstrappingSuccessRate(const Eigen::Ref<const Eigen::VectorXd>& D)
+{
+    // 2 Φ(x) - 1 = erf(x / √2)
+    return std::transform_reduce(D.begin(), D.end(), 1.0, std::multiplies<>(), [](double d) { return std::erf(1.0 / (2.0 * std::sqrt(2.0 * d))); });
+}
+
+Resolution resolve(const Eigen::VectorXd& a_float, const Eigen::MatrixXd& Q, const Options& options)
+{
+    Resolution result;
+    auto n = a_float.size();
+    if (n == 0) { return result; }
+
+    auto dec = decorrelate(Q);
+    if (!dec)
+    {
+        LOG_WARN("The ambiguity covariance matrix is not positive definite. Ambiguity resolution not possible.");
+        return result;
+    }
+
+    // The integer part is removed before the search to keep the numbers small
+    Eigen::VectorXd a_int = a_float.array().round();
+    Eigen::VectorXd z_frac = dec->Z.transpose() * (a_float - a_int);
+    Eigen::VectorXd z_int = dec->Z.transpose() * a_int;
+
+    Eigen::Index maxStart = 0;
+    if (options.strategy == Strategy::Partial)
+    {
+        if (static_cast<size_t>(n) < options.minFixed) { return result; }
+        maxStart = n - static_cast<Eigen::Index>(options.minFixed);
+    }
+
+    // The decorrelated ambiguities at the end have the smallest conditional variances, so subsets are dropped from the front
+    for (Eigen::Index k = 0; k <= maxStart; k++)
+    {
+        auto m = n - k;
+        double successRate = bootstrappingSuccessRate(dec->D.tail(m));
+        if (successRate < options.minSuccessRate)
+        {
+            LOG_DATA("Fixing {} of {} ambiguities: Success rate {} too low", m, n, successRate);
+            continue;
+        }
+
+        Eigen::VectorXd z;
+        double ratio = 0.0;
+        if (options.estimator == Estimator::IntegerLeastSquares)
+        {
+            auto candidates = search(dec->L.bottomRightCorner(m, m), dec->D.tail(m), z_frac.tail(m), 2);
+            if (candidates.empty()) { continue; }
+            ratio = candidates.size() < 2 || candidates.front().squaredNorm == 0.0
+                        ? std::numeric_limits<double>::infinity()
+                        : candidates.at(1).squaredNorm / candidates.front().squaredNorm;
+            if (ratio < options.ratioThreshold)
+            {
+                LOG_DATA("Fixing {} of {} ambiguities: Ratio test failed with {}", m, n, ratio);
+                continue;
+            }
+            z = std::move(candidates.front().z);
+        }
+        else
+        {
+            z = bootstrap(dec->L.bottomRightCorner(m, m), dec->D.tail(m), z_frac.tail(m)).z;
+        }
+
+        result.fixed = true;
+        result.nFixed = static_cast<size_t>(m);
+        result.ratio = ratio;
+        result.successRate = successRate;
+        result.Z_fixed = dec->Z.rightCols(m);
+        result.z_fixed = z + z_int.tail(m);
+        result.z_float = z_frac.tail(m) + z_int.tail(m);
+        LOG_DATA("Fixed {} of {} ambiguities with ratio {} and success rate {}", m, n, ratio, successRate);
+        return result;
+    }
+
+    return result;
+}
+
+} // namespace NAV::Ambiguity
@@ -0,0 +1,164 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AmbiguityResolution.hpp
+/// @brief Integer ambiguity resolution with the LAMBDA method and the modified search of MLAMBDA
+/// @date 2026-10-18
+/// @note See \cite Teunissen1995, \cite Chang2005 and \cite verhagen2013
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "util/Assert.h"
+#include "util/Container/KeyedMatrix.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV::Ambiguity
+{
+
+/// @brief Decorrelated ambiguity search space
+///
+/// The integer transformation Z decorrelates the ambiguities ẑ = Zᵀ â with Q_ẑ = Zᵀ Q_â Z = Lᵀ D L.
+/// L is unit lower triangular and the conditional variances D are (approximately) sorted descending.
+struct Decorrelation
+{
+    Eigen::MatrixXd Z; ///< Unimodular integer transformation matrix (n x n)
+    Eigen::MatrixXd L; ///< Unit lower triangular factor of the decorrelated covariance matrix (n x n)
+    Eigen::VectorXd D; ///< Conditional variances of the decorrelated ambiguities (n x 1)
+};
+
+/// @brief Integer candidate of the search
+struct Candidate
+{
+    Eigen::VectorXd z;         ///< Integer vector
+    double squaredNorm = 0.0;  ///< Squared norm ‖ẑ - z‖² in the metric of the covariance matrix
+};
+
+/// @brief Integer estimators
+enum class Estimator
+{
+    IntegerLeastSquares, ///< Integer least squares search, validated with the ratio test
+    Bootstrapping,       ///< Sequential conditional rounding, validated with the success rate
+};
+
+/// @brief Strategies to fix the ambiguities
+enum class Strategy
+{
+    Full,    ///< Fix all ambiguities or none
+    Partial, ///< Fix the largest subset of decorrelated ambiguities which passes the validation
+};
+
+/// @brief Options of the ambiguity resolution
+struct Options
+{
+    Estimator estimator = Estimator::IntegerLeastSquares; ///< Integer estimator
+    Strategy strategy = Strategy::Partial;                ///< Fixing strategy
+    double ratioThreshold = 3.0;                          ///< Minimum ratio between the second best and best candidate (only integer least squares)
+    double minSuccessRate = 0.999;                        ///< Minimum bootstrapped success rate of the fixed (sub)set
+    size_t minFixed = 4;                                  ///< Minimum amount of fixed ambiguities for partial fixing
+};
+
+/// @brief Result of the ambiguity resolution
+struct Resolution
+{
+    bool fixed = false;        ///< Whether (a subset of) the ambiguities could be fixed
+    size_t nFixed = 0;         ///< Amount of fixed integer combinations
+    double ratio = 0.0;        ///< Ratio test value of the fixed (sub)set
+    double successRate = 0.0;  ///< Bootstrapped success rate of the fixed (sub)set
+    Eigen::MatrixXd Z_fixed;   ///< Fixed integer combinations of the float ambiguities (n x nFixed), so that Z_fixedᵀ â is integer
+    Eigen::VectorXd z_fixed;   ///< Integer values of the fixed combinations (nFixed x 1)
+    Eigen::VectorXd z_float;   ///< Float values of the fixed combinations (nFixed x 1)
+};
+
+/// @brief Decomposes a symmetric positive definite matrix into Q = Lᵀ D L
+/// @param[in] Q Covariance matrix (n x n)
+/// @param[out] L Unit lower triangular matrix (n x n)
+/// @param[out] D Diagonal elements (n x 1)
+/// @return False if the matrix is not positive definite
+bool LtDLdecomposition(const Eigen::MatrixXd& Q, Eigen::MatrixXd& L, Eigen::VectorXd& D);
+
+/// @brief Decorrelates the ambiguities with integer Gauss transformations and permutations (LAMBDA reduction)
+/// @param[in] Q Covariance matrix of the float ambiguities (n x n)
+/// @return The decorrelation or nothing if the covariance matrix is not positive definite
+std::optional<Decorrelation> decorrelate(const Eigen::MatrixXd& Q);
+
+/// @brief Integer least squares search in the decorrelated space with shrinking search ellipsoid (MLAMBDA)
+/// @param[in] L Unit lower triangular factor (n x n)
+/// @param[in] D Conditional variances (n x 1)
+/// @param[in] z_float Decorrelated float ambiguities (n x 1)
+/// @param[in] nCandidates Amount of best candidates to return
+/// @return The best candidates sorted by ascending squared norm
+std::vector<Candidate> search(const Eigen::Ref<const Eigen::MatrixXd>& L, const Eigen::Ref<const Eigen::VectorXd>& D, const Eigen::Ref<const Eigen::VectorXd>& z_float, size_t nCandidates = 2);
+
+/// @brief Integer bootstrapping (sequential conditional rounding) in the decorrelated space
+/// @param[in] L Unit lower triangular factor (n x n)
+/// @param[in] D Conditional variances (n x 1)
+/// @param[in] z_float Decorrelated float ambiguities (n x 1)
+/// @return The bootstrapped integer vector
+Candidate bootstrap(const Eigen::Ref<const Eigen::MatrixXd>& L, const Eigen::Ref<const Eigen::VectorXd>& D, const Eigen::Ref<const Eigen::VectorXd>& z_float);
+
+/// @brief Success rate of integer bootstrapping, which is a sharp lower bound for the integer least squares success rate
+/// @param[in] D Conditional variances (n x 1)
+/// @return P = ∏ (2 Φ(1 / (2 √dᵢ)) - 1)
+double bootstrappingSuccessRate(const Eigen::Ref<const Eigen::VectorXd>& D);
+
+/// @brief Resolves the integer ambiguities
+/// @param[in] a_float Float ambiguities in [cycles] (n x 1)
+/// @param[in] Q Covariance matrix of the float ambiguities in [cycles²] (n x n)
+/// @param[in] options Options of the resolution
+/// @return The (partially) fixed integer combinations
+Resolution resolve(const Eigen::VectorXd& a_float, const Eigen::MatrixXd& Q, const Options& options = {});
+
+/// @brief Keyed state conditioned on the fixed ambiguities
+template<typename StateKeyType>
+struct KeyedResolution
+{
+    Resolution resolution;                             ///< Result of the integer resolution
+    KeyedVectorXd<StateKeyType> x;                     ///< State vector conditioned on the fixed ambiguities
+    KeyedMatrixXd<StateKeyType, StateKeyType> P;       ///< Covariance matrix conditioned on the fixed ambiguities
+};
+
+/// @brief Resolves the ambiguities of a keyed state (e.g. of the KeyedKalmanFilter) and conditions the whole state on the fixed ambiguities
+///
+/// With the fixed integer combinations ž = Z_pᵀ a, the state is adjusted by
+/// x̌ = x̂ - P_x,ẑ Q_ẑ⁻¹ (ẑ - ž) and P̌ = P - P_x,ẑ Q_ẑ⁻¹ P_ẑ,x
+/// @param[in] x State vector with float ambiguities in [cycles]
+/// @param[in] P Covariance matrix of the state
+/// @param[in] ambiguityKeys Keys of the ambiguity states
+/// @param[in] options Options of the resolution
+/// @return The resolution with the conditioned state. If nothing could be fixed, the state is returned unchanged.
+template<typename StateKeyType>
+KeyedResolution<StateKeyType> resolve(const KeyedVectorXd<StateKeyType>& x,
+                                      const KeyedMatrixXd<StateKeyType, StateKeyType>& P,
+                                      const std::vector<StateKeyType>& ambiguityKeys,
+                                      const Options& options = {})
+{
+    INS_ASSERT_USER_ERROR(x.rowKeys() == P.rowKeys() && P.rowKeys() == P.colKeys(), "The state vector and covariance matrix need the same keys");
+
+    KeyedResolution<StateKeyType> result{ .resolution = resolve(x(ambiguityKeys), P(ambiguityKeys, ambiguityKeys), options), .x = x, .P = P };
+    const auto& resolution = result.resolution;
+    if (!resolution.fixed) { return result; }
+
+    // Covariance between the state and the fixed combinations
+    Eigen::MatrixXd P_xz = P(all, ambiguityKeys) * resolution.Z_fixed;
+    Eigen::MatrixXd Q_z = resolution.Z_fixed.transpose() * P(ambiguityKeys, ambiguityKeys) * resolution.Z_fixed;
+    auto Q_z_ldlt = Q_z.ldlt();
+    LOG_DATA("Conditioning the state on {} fixed ambiguity combinations", resolution.nFixed);
+
+    result.x(all) -= P_xz * Q_z_ldlt.solve(resolution.z_float - resolution.z_fixed);
+    result.P(all, all) -= P_xz * Q_z_ldlt.solve(P_xz.transpose());
+
+    return result;
+}
+
+} // namespace NAV::Ambiguity
@@ -0,0 +1,84 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AntennaCorrections.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV
+{
+
+Eigen::Vector3d e_calcSunPosition(const InsTime& time)
+{
+    auto jd = time.toJD(UTC);
+    // Days since J2000 (the difference between UT1 and TT is neglected)
+    double d = static_cast<double>(jd.jd_day - 2451545) + static_cast<double>(jd.jd_frac);
+    double T = d / 36525.0;
+
+    // Mean anomaly, ecliptic longitude (referred to the mean equinox of date) and distance
+    double M = deg2rad(357.5256 + 35999.049 * T);
+    double lambda = deg2rad(282.9400 + 1.3972 * T) + M + deg2rad(6892.0 / 3600.0) * std::sin(M) + deg2rad(72.0 / 3600.0) * std::sin(2.0 * M);
+    double r = (149.619 - 2.499 * std::cos(M) - 0.021 * std::cos(2.0 * M)) * 1e9;
+
+    // Equatorial coordinates
+    double epsilon = deg2rad(23.43929111);
+    Eigen::Vector3d i_sunPos = r * Eigen::Vector3d(std::cos(lambda), std::sin(lambda) * std::cos(epsilon), std::sin(lambda) * std::sin(epsilon));
+
+    // Rotation with the Greenwich mean sidereal time
+    double gmst = deg2rad(280.46061837 + 360.98564736629 * d);
+    return Eigen::Vector3d(std::cos(gmst) * i_sunPos.x() + std::sin(gmst) * i_sunPos.y(),
+                           -std::sin(gmst) * i_sunPos.x() + std::cos(gmst) * i_sunPos.y(),
+                           i_sunPos.z());
+}
+
+double calcReceiverAntennaCorrection(const AntennaPattern::Calibration& calibration,
+                                     const Eigen::Vector3d& lla_recvPos,
+                                     const Eigen::Vector3d& e_pLOS,
+                                     double satElevation,
+                                     double satAzimuth)
+{
+    Eigen::Vector3d n_pLOS = trafo::n_Quat_e(lla_recvPos(0), lla_recvPos(1)) * e_pLOS;
+    const auto& pco = calibration.pco(); // North, East, Up
+
+    return -(pco(0) * n_pLOS(0) + pco(1) * n_pLOS(1) - pco(2) * n_pLOS(2))
+           + calibration.pcv(M_PI_2 - satElevation, satAzimuth);
+}
+
+double calcSatelliteAntennaCorrection(const AntennaPattern::Calibration& calibration,
+                                      const Eigen::Vector3d& e_satPos,
+                                      const Eigen::Vector3d& e_sunPos,
+                                      const Eigen::Vector3d& e_pLOS)
+{
+    // Satellite body frame axes
+    Eigen::Vector3d e_z = -e_satPos.normalized();
+    Eigen::Vector3d e_y = e_z.cross(e_sunPos - e_satPos);
+    const auto& pco = calibration.pco();
+
+    // Direction from the satellite to the receiver
+    Eigen::Vector3d e_u = -e_pLOS;
+    double nadir = std::acos(std::clamp(e_z.dot(e_u), -1.0, 1.0));
+
+    if (e_y.norm() < 1e-6 * e_sunPos.norm()) // Sun, Earth and satellite are collinear, the yaw angle is undefined
+    {
+        return -pco(2) * e_z.dot(e_u) + calibration.pcv(nadir, 0.0);
+    }
+    e_y.normalize();
+    Eigen::Vector3d e_x = e_y.cross(e_z);
+
+    // Azimuth counted clockwise from the y-axis towards the x-axis when looking towards the satellite
+    double azimuth = std::atan2(e_x.dot(e_u), e_y.dot(e_u));
+
+    Eigen::Vector3d e_pco = pco(0) * e_x + pco(1) * e_y + pco(2) * e_z;
+    return e_pLOS.dot(e_pco) + calibration.pcv(nadir, azimuth);
+}
+
+} // namespace NAV
@@ -0,0 +1,55 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AntennaCorrections.hpp
+/// @brief Antenna phase center offset and variation corrections of the range
+/// @date 2026-10-18
+
+#pragma once
+
+#include "Navigation/GNSS/Antenna/AntennaPattern.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief Calculates the position of the Sun with an accuracy of about 0.1 deg
+/// @param[in] time Time
+/// @return Position of the Sun in ECEF frame coordinates [m]
+/// @note See \cite Montenbruck2000 Montenbruck, Gill: Satellite Orbits (ch. 3.3.2)
+[[nodiscard]] Eigen::Vector3d e_calcSunPosition(const InsTime& time);
+
+/// @brief Calculates the range correction for the phase center offset and variation of the receiver antenna
+/// @param[in] calibration Calibration of the receiver antenna for the frequency
+/// @param[in] lla_recvPos Receiver position in LLA frame [rad, rad, m]
+/// @param[in] e_pLOS Line-of-sight unit vector from the receiver to the satellite in ECEF frame coordinates
+/// @param[in] satElevation Satellite elevation [rad]
+/// @param[in] satAzimuth Satellite azimuth [rad]
+/// @return Correction which is added to the geometric range between the antenna reference points [m]
+[[nodiscard]] double calcReceiverAntennaCorrection(const AntennaPattern::Calibration& calibration,
+                                                   const Eigen::Vector3d& lla_recvPos,
+                                                   const Eigen::Vector3d& e_pLOS,
+                                                   double satElevation,
+                                                   double satAzimuth);
+
+/// @brief Calculates the range correction for the phase center offset and variation of the satellite antenna
+///
+/// The satellite body frame follows the nominal yaw-steering attitude (z-axis towards the Earth, y-axis perpendicular to the Sun).
+/// Yaw maneuvers around noon and midnight are not modeled.
+/// @param[in] calibration Calibration of the satellite antenna for the frequency
+/// @param[in] e_satPos Position of the satellite center of mass in ECEF frame coordinates [m]
+/// @param[in] e_sunPos Position of the Sun in ECEF frame coordinates [m]
+/// @param[in] e_pLOS Line-of-sight unit vector from the receiver to the satellite in ECEF frame coordinates
+/// @return Correction which is added to the geometric range to the satellite center of mass [m]
+[[nodiscard]] double calcSatelliteAntennaCorrection(const AntennaPattern::Calibration& calibration,
+                                                    const Eigen::Vector3d& e_satPos,
+                                                    const Eigen::Vector3d& e_sunPos,
+                                                    const Eigen::Vector3d& e_pLOS);
+
+} // namespace NAV
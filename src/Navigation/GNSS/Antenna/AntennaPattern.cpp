@@ -0,0 +1,108 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AntennaPattern.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// @brief Linear interpolation in an equally spaced grid
+/// @param[in] values Values of the grid
+/// @param[in] x Position in units of the grid spacing
+double interpolateGrid(const std::vector<double>& values, double x)
+{
+    if (values.size() == 1) { return values.front(); }
+    x = std::clamp(x, 0.0, static_cast<double>(values.size() - 1));
+    auto i = std::min(static_cast<size_t>(x), values.size() - 2);
+    double f = x - static_cast<double>(i);
+    return (1.0 - f) * values[i] + f * values[i + 1];
+}
+
+} // namespace
+
+AntennaPattern::Calibration::Calibration(const Eigen::Vector3d& pco, double zen1, double zen2, double dzen, double dazi,
+                                         const std::vector<double>& noazi, const std::vector<std::vector<double>>& grid)
+    : _pco(pco),
+      _zen1(zen1),
+      _nZen(static_cast<size_t>(std::floor((zen2 - zen1) / RESOLUTION + 1e-9)) + 1),
+      _nAzi(dazi > 0.0 && !grid.empty() ? static_cast<size_t>(std::lround(360.0 / RESOLUTION)) + 1 : 0)
+{
+    _pcv.resize(_nZen * std::max(_nAzi, size_t(1)));
+    for (size_t i = 0; i < _nZen; i++)
+    {
+        double x = static_cast<double>(i) * RESOLUTION / dzen;
+        if (_nAzi == 0)
+        {
+            _pcv[i] = noazi.empty() ? 0.0 : interpolateGrid(noazi, x);
+            continue;
+        }
+
+        // Interpolate along the zenith in every azimuth row of the calibration first
+        std::vector<double> column(grid.size());
+        for (size_t r = 0; r < grid.size(); r++) { column[r] = interpolateGrid(grid[r], x); }
+        for (size_t j = 0; j < _nAzi; j++)
+        {
+            _pcv[i * _nAzi + j] = interpolateGrid(column, static_cast<double>(j) * RESOLUTION / dazi);
+        }
+    }
+}
+
+double AntennaPattern::Calibration::pcv(double zenith, double azimuth) const
+{
+    constexpr double INV_RESOLUTION = 1.0 / RESOLUTION;
+
+    double z = std::clamp((rad2deg(zenith) - _zen1) * INV_RESOLUTION, 0.0, static_cast<double>(_nZen - 1));
+    auto i = std::min(static_cast<size_t>(z), _nZen > 1 ? _nZen - 2 : 0);
+    double fz = z - static_cast<double>(i);
+    size_t i1 = std::min(i + 1, _nZen - 1);
+
+    if (_nAzi == 0) { return (1.0 - fz) * _pcv[i] + fz * _pcv[i1]; }
+
+    double a = rad2deg(azimuth);
+    a -= 360.0 * std::floor(a / 360.0);
+    a *= INV_RESOLUTION;
+    auto j = std::min(static_cast<size_t>(a), _nAzi - 2);
+    double fa = a - static_cast<double>(j);
+
+    const double* row0 = &_pcv[i * _nAzi + j];
+    const double* row1 = &_pcv[i1 * _nAzi + j];
+    return (1.0 - fz) * ((1.0 - fa) * row0[0] + fa * row0[1])
+           + fz * ((1.0 - fa) * row1[0] + fa * row1[1]);
+}
+
+void AntennaPattern::addCalibration(Frequency freq, Calibration calibration)
+{
+    _calibrations.insert_or_assign(freq, std::move(calibration));
+}
+
+const AntennaPattern::Calibration* AntennaPattern::calibration(Frequency freq) const
+{
+    if (auto iter = _calibrations.find(freq); iter != _calibrations.end()) { return &iter->second; }
+
+    // L1 band frequencies (1559 - 1610 MHz) use the GPS L1 calibration, the others the GPS L2 calibration
+    Frequency fallback = Frequency::GetFrequency(freq, 0) > 1.5e9 ? G01 : G02;
+    if (auto iter = _calibrations.find(fallback); iter != _calibrations.end()) { return &iter->second; }
+    return nullptr;
+}
+
+Frequency AntennaPattern::frequencies() const
+{
+    Frequency freqs = Freq_None;
+    for (const auto& [freq, calibration] : _calibrations) { freqs |= freq; }
+    return freqs;
+}
+
+} // namespace NAV
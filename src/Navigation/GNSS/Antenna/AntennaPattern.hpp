@@ -0,0 +1,88 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AntennaPattern.hpp
+/// @brief Phase center offsets and variations of a GNSS antenna
+/// @date 2026-10-18
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "Navigation/GNSS/Core/Frequency.hpp"
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief Phase center offsets (PCO) and variations (PCV) of a GNSS antenna for several frequencies
+class AntennaPattern
+{
+  public:
+    /// @brief Calibration of the antenna for a single frequency
+    ///
+    /// The calibration grid is resampled into a dense table with a fixed resolution on construction,
+    /// so that the variations can be looked up with a direct index calculation for every observation.
+    class Calibration
+    {
+      public:
+        /// @brief Resolution of the lookup table in zenith (nadir) and azimuth direction [deg]
+        static constexpr double RESOLUTION = 1.0;
+
+        /// @brief Constructor
+        /// @param[in] pco Phase center offset [m] (Receiver: North, East, Up / Satellite: x, y, z in the body frame)
+        /// @param[in] zen1 First zenith (nadir) angle of the grid [deg]
+        /// @param[in] zen2 Last zenith (nadir) angle of the grid [deg]
+        /// @param[in] dzen Zenith (nadir) increment of the grid [deg]
+        /// @param[in] dazi Azimuth increment of the grid [deg] (0 if the variations do not depend on the azimuth)
+        /// @param[in] noazi Azimuth independent variations [m] for every zenith (nadir) angle
+        /// @param[in] grid Azimuth dependent variations [m] as rows from 0 to 360 deg azimuth (empty if not available)
+        Calibration(const Eigen::Vector3d& pco, double zen1, double zen2, double dzen, double dazi,
+                    const std::vector<double>& noazi, const std::vector<std::vector<double>>& grid);
+
+        /// @brief Phase center offset [m] (Receiver: North, East, Up / Satellite: x, y, z in the body frame)
+        [[nodiscard]] const Eigen::Vector3d& pco() const { return _pco; }
+
+        /// @brief Phase center variation [m]
+        /// @param[in] zenith Zenith angle (receiver) or nadir angle (satellite) [rad]
+        /// @param[in] azimuth Azimuth [rad]
+        [[nodiscard]] double pcv(double zenith, double azimuth) const;
+
+        /// @brief Whether the variations depend on the azimuth
+        [[nodiscard]] bool isAzimuthDependent() const { return _nAzi != 0; }
+
+      private:
+        Eigen::Vector3d _pco;      ///< Phase center offset [m]
+        double _zen1 = 0.0;        ///< First zenith (nadir) angle of the table [deg]
+        size_t _nZen = 0;          ///< Amount of zenith (nadir) angles in the table
+        size_t _nAzi = 0;          ///< Amount of azimuths in the table (including 0 and 360 deg), 0 if azimuth independent
+        std::vector<double> _pcv;  ///< Variations [m], row-major with one row per zenith (nadir) angle
+    };
+
+    /// @brief Adds the calibration of a frequency
+    /// @param[in] freq Frequency of the calibration
+    /// @param[in] calibration Calibration
+    void addCalibration(Frequency freq, Calibration calibration);
+
+    /// @brief Returns the calibration of the frequency
+    ///
+    /// Frequencies without own calibration use the GPS L1 calibration (L1 band) or the GPS L2 calibration (other bands)
+    /// @param[in] freq Frequency to get the calibration for
+    /// @return Pointer to the calibration or nullptr if not available
+    [[nodiscard]] const Calibration* calibration(Frequency freq) const;
+
+    /// @brief Frequencies with a calibration
+    [[nodiscard]] Frequency frequencies() const;
+
+  private:
+    /// Calibrations of the frequencies
+    std::unordered_map<Frequency, Calibration> _calibrations;
+};
+
+} // namespace NAV
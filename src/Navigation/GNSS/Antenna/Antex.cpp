@@ -0,0 +1,284 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Antex.hpp"
+
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "util/Logger.hpp"
+#include "util/StringUtil.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// Frequency codes of the ANTEX format. BeiDou uses 'C' as in RINEX.
+constexpr std::array<std::pair<std::string_view, Frequency_>, 27> ANTEX_FREQUENCIES = { {
+    { "G01", G01 },
+    { "G02", G02 },
+    { "G05", G05 },
+    { "E01", E01 },
+    { "E05", E05 },
+    { "E06", E06 },
+    { "E07", E07 },
+    { "E08", E08 },
+    { "R01", R01 },
+    { "R02", R02 },
+    { "R03", R03 },
+    { "R04", R04 },
+    { "R06", R06 },
+    { "C01", B01 },
+    { "C02", B02 },
+    { "C05", B05 },
+    { "C06", B06 },
+    { "C07", B07 },
+    { "C08", B08 },
+    { "J01", J01 },
+    { "J02", J02 },
+    { "J05", J05 },
+    { "J06", J06 },
+    { "I05", I05 },
+    { "I09", I09 },
+    { "S01", S01 },
+    { "S05", S05 },
+} };
+
+/// @brief Converts an ANTEX frequency code into a frequency
+/// @param[in] code Frequency code (e.g. 'G01')
+/// @return The frequency or Freq_None if the code is unknown
+Frequency antexFrequency(std::string_view code)
+{
+    for (const auto& [antexCode, freq] : ANTEX_FREQUENCIES)
+    {
+        if (antexCode == code) { return freq; }
+    }
+    return Freq_None;
+}
+
+/// @brief Parses the epoch of the 'VALID FROM' and 'VALID UNTIL' lines
+/// @param[in] line Line of the file
+InsTime antexEpoch(const std::string& line)
+{
+    return { std::stoi(line.substr(0, 6)), std::stoi(line.substr(6, 6)), std::stoi(line.substr(12, 6)),
+             std::stoi(line.substr(18, 6)), std::stoi(line.substr(24, 6)), std::stold(line.substr(30, 13)), GPST };
+}
+
+} // namespace
+
+bool Antex::read(const std::filesystem::path& filepath, const std::vector<std::string>& receiverAntennaTypes, const std::string& nameId)
+{
+    clear();
+
+    std::ifstream fs{ filepath, std::ios_base::binary };
+    if (!fs.good())
+    {
+        LOG_ERROR("{}: Could not open the ANTEX file {}", nameId, filepath);
+        return false;
+    }
+
+    std::unordered_set<std::string> requestedTypes;
+    for (const auto& antennaType : receiverAntennaTypes)
+    {
+        if (auto type = normalizeAntennaType(antennaType); !type.empty()) { requestedTypes.insert(type); }
+    }
+
+    // State of the antenna currently read
+    std::string antennaType;
+    std::optional<SatId> satId;
+    bool skipAntenna = false;
+    InsTime validFrom;
+    InsTime validUntil;
+    double dazi = 0.0;
+    double zen1 = 0.0;
+    double zen2 = 0.0;
+    double dzen = 1.0;
+    AntennaPattern pattern;
+
+    // State of the frequency currently read
+    bool inFrequency = false;
+    bool inFrequencyRms = false;
+    Frequency freq = Freq_None;
+    Eigen::Vector3d pco = Eigen::Vector3d::Zero();
+    std::vector<double> noazi;
+    std::vector<std::vector<double>> grid;
+
+    /// @brief Reads the variations of a grid line [m]
+    auto readVariations = [&](const std::string& line) {
+        auto nZen = static_cast<size_t>(std::lround((zen2 - zen1) / dzen)) + 1;
+        std::vector<double> values(nZen);
+        for (size_t k = 0; k < nZen; k++) { values[k] = std::stod(line.substr(8 + 8 * k, 8)) * 1e-3; }
+        return values;
+    };
+
+    size_t lineNumber = 0;
+    std::string line;
+    try
+    {
+        while (std::getline(fs, line))
+        {
+            lineNumber++;
+            str::rtrim(line);
+            std::string label = line.size() > 60 ? str::trim_copy(line.substr(60)) : "";
+
+            if (lineNumber == 1 && label != "ANTEX VERSION / SYST")
+            {
+                LOG_ERROR("{}: Not a valid ANTEX file {}", nameId, filepath);
+                return false;
+            }
+            if (label == "COMMENT") { continue; }
+
+            if (inFrequency && label != "NORTH / EAST / UP" && label != "END OF FREQUENCY")
+            {
+                if (!skipAntenna)
+                {
+                    if (line.starts_with("   NOAZI")) { noazi = readVariations(line); }
+                    else { grid.push_back(readVariations(line)); }
+                }
+                continue;
+            }
+            if (inFrequencyRms)
+            {
+                inFrequencyRms = label != "END OF FREQ RMS";
+                continue;
+            }
+
+            if (label == "START OF ANTENNA")
+            {
+                antennaType.clear();
+                satId.reset();
+                skipAntenna = false;
+                validFrom = InsTime();
+                validUntil = InsTime();
+                dazi = 0.0;
+                pattern = AntennaPattern();
+            }
+            else if (label == "TYPE / SERIAL NO")
+            {
+                antennaType = normalizeAntennaType(line.substr(0, 20));
+                auto serial = str::trim_copy(line.substr(20, 20));
+                if (serial.size() == 3 && std::isdigit(static_cast<unsigned char>(serial[1])) && std::isdigit(static_cast<unsigned char>(serial[2]))
+                    && SatelliteSystem::fromChar(serial[0]) != SatSys_None)
+                {
+                    satId = SatId(SatelliteSystem::fromChar(serial[0]), static_cast<uint16_t>(std::stoul(serial.substr(1))));
+                }
+                // Individual receiver antenna calibrations (with serial number) are not supported
+                skipAntenna = !satId && (!serial.empty() || !requestedTypes.contains(antennaType));
+            }
+            else if (label == "DAZI") { dazi = std::stod(line.substr(2, 6)); }
+            else if (label == "ZEN1 / ZEN2 / DZEN")
+            {
+                zen1 = std::stod(line.substr(2, 6));
+                zen2 = std::stod(line.substr(8, 6));
+                dzen = std::stod(line.substr(14, 6));
+            }
+            else if (label == "VALID FROM") { validFrom = antexEpoch(line); }
+            else if (label == "VALID UNTIL") { validUntil = antexEpoch(line); }
+            else if (label == "START OF FREQUENCY")
+            {
+                inFrequency = true;
+                freq = antexFrequency(str::trim_copy(std::string_view(line).substr(3, 3)));
+                pco.setZero();
+                noazi.clear();
+                grid.clear();
+            }
+            else if (label == "NORTH / EAST / UP")
+            {
+                pco = 1e-3 * Eigen::Vector3d(std::stod(line.substr(0, 10)), std::stod(line.substr(10, 10)), std::stod(line.substr(20, 10)));
+            }
+            else if (label == "END OF FREQUENCY")
+            {
+                inFrequency = false;
+                if (!skipAntenna && freq != Freq_None)
+                {
+                    pattern.addCalibration(freq, AntennaPattern::Calibration(pco, zen1, zen2, dzen, dazi, noazi, grid));
+                }
+            }
+            else if (label == "START OF FREQ RMS") { inFrequencyRms = true; }
+            else if (label == "END OF ANTENNA" && !skipAntenna)
+            {
+                if (satId) { _satelliteAntennas[*satId].push_back({ .validFrom = validFrom, .validUntil = validUntil, .pattern = std::move(pattern) }); }
+                else { _receiverAntennas.insert_or_assign(antennaType, std::move(pattern)); }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: The ANTEX file '{}' is corrupt in line {}: {}", nameId, filepath, lineNumber, e.what());
+        clear();
+        return false;
+    }
+
+    for (const auto& type : requestedTypes)
+    {
+        if (!_receiverAntennas.contains(type))
+        {
+            LOG_WARN("{}: The receiver antenna '{}' is not contained in the ANTEX file {}", nameId, type, filepath);
+        }
+    }
+    LOG_DEBUG("{}: Read {} receiver and {} satellite antennas from {}", nameId, _receiverAntennas.size(), _satelliteAntennas.size(), filepath);
+
+    return true;
+}
+
+void Antex::clear()
+{
+    _receiverAntennas.clear();
+    _satelliteAntennas.clear();
+}
+
+bool Antex::empty() const
+{
+    return _receiverAntennas.empty() && _satelliteAntennas.empty();
+}
+
+const AntennaPattern* Antex::receiverAntenna(const std::string& antennaType) const
+{
+    auto type = normalizeAntennaType(antennaType);
+    if (auto iter = _receiverAntennas.find(type); iter != _receiverAntennas.end()) { return &iter->second; }
+    if (type.find(' ') == std::string::npos)
+    {
+        if (auto iter = _receiverAntennas.find(type + " NONE"); iter != _receiverAntennas.end()) { return &iter->second; }
+    }
+    return nullptr;
+}
+
+const AntennaPattern* Antex::satelliteAntenna(const SatId& satId, const InsTime& time) const
+{
+    auto iter = _satelliteAntennas.find(satId);
+    if (iter == _satelliteAntennas.end()) { return nullptr; }
+
+    for (const auto& antenna : iter->second)
+    {
+        if ((antenna.validFrom.empty() || antenna.validFrom <= time)
+            && (antenna.validUntil.empty() || time < antenna.validUntil))
+        {
+            return &antenna.pattern;
+        }
+    }
+    return nullptr;
+}
+
+std::string Antex::normalizeAntennaType(const std::string& antennaType)
+{
+    std::string type;
+    for (const auto& part : str::split_wo_empty(antennaType, ' '))
+    {
+        if (!type.empty()) { type += ' '; }
+        type += part;
+    }
+    return type;
+}
+
+} // namespace NAV
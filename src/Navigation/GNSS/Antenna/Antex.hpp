@@ -0,0 +1,79 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Antex.hpp
+/// @brief Antenna calibrations from ANTEX files
+/// @date 2026-10-18
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Navigation/GNSS/Antenna/AntennaPattern.hpp"
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV
+{
+
+/// @brief Receiver and satellite antenna calibrations read from an ANTEX file
+/// @note See \cite Rothacher2010
+class Antex
+{
+  public:
+    /// @brief Reads the antenna calibrations of an ANTEX 1.4 file
+    ///
+    /// All satellite antennas are read, but only the receiver antennas which are requested,
+    /// because the lookup tables of azimuth dependent receiver calibrations are large.
+    /// @param[in] filepath Path of the ANTEX file
+    /// @param[in] receiverAntennaTypes Receiver antenna types with radome to read (e.g. 'TRM59800.00 NONE')
+    /// @param[in] nameId Name and Id of the node used for log messages only
+    /// @return False if the file could not be read
+    bool read(const std::filesystem::path& filepath, const std::vector<std::string>& receiverAntennaTypes, const std::string& nameId);
+
+    /// @brief Removes all calibrations
+    void clear();
+
+    /// @brief Whether no calibrations are loaded
+    [[nodiscard]] bool empty() const;
+
+    /// @brief Returns the calibration of a receiver antenna
+    /// @param[in] antennaType Antenna type with radome (e.g. 'TRM59800.00 NONE'). Without radome 'NONE' is assumed.
+    /// @return Pointer to the antenna or nullptr if not available
+    [[nodiscard]] const AntennaPattern* receiverAntenna(const std::string& antennaType) const;
+
+    /// @brief Returns the calibration of a satellite antenna
+    /// @param[in] satId Satellite identifier
+    /// @param[in] time Time at which the calibration has to be valid
+    /// @return Pointer to the antenna or nullptr if not available
+    [[nodiscard]] const AntennaPattern* satelliteAntenna(const SatId& satId, const InsTime& time) const;
+
+    /// @brief Normalizes an antenna type to the form 'TYPE RADOME' with single spaces
+    /// @param[in] antennaType Antenna type as written in the ANTEX or RINEX file
+    [[nodiscard]] static std::string normalizeAntennaType(const std::string& antennaType);
+
+  private:
+    /// @brief Satellite antenna, which is valid for a certain time
+    struct SatelliteAntenna
+    {
+        InsTime validFrom;      ///< Start of the validity (empty if valid since always)
+        InsTime validUntil;     ///< End of the validity (empty if still valid)
+        AntennaPattern pattern; ///< Calibration
+    };
+
+    /// Receiver antennas with the normalized antenna type as key
+    std::unordered_map<std::string, AntennaPattern> _receiverAntennas;
+    /// Satellite antennas
+    std::unordered_map<SatId, std::vector<SatelliteAntenna>> _satelliteAntennas;
+};
+
+} // namespace NAV
@@ -254,11 +254,6 @@ std::vector<SatelliteSystem> SatelliteSystem::toVector() const
     return ToVector(value);
 }
 
-std::vector<SatelliteSystem> SatelliteSystem::GetAll()
-{
-    return { GPS, GAL, GLO, BDS, QZSS, IRNSS, SBAS };
-}
-
 void to_json(json& j, const SatelliteSystem& data)
 {
     j = std::string(data);
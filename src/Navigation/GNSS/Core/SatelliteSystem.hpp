@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <fmt/format.h>
@@ -151,7 +152,10 @@ struct SatelliteSystem
     [[nodiscard]] std::vector<SatelliteSystem> toVector() const;
 
     /// @brief Returns a list with all possible satellite systems
-    static std::vector<SatelliteSystem> GetAll();
+    constexpr static std::array<SatelliteSystem, 7> GetAll()
+    {
+        return { GPS, GAL, GLO, BDS, QZSS, IRNSS, SBAS };
+    }
 
   private:
     /// @brief Internal value
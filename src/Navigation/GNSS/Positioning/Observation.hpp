@@ -14,8 +14,10 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <set>
 #include <unordered_set>
+#include <vector>
 
 #include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
 #include "Navigation/GNSS/Functions.hpp"
@@ -33,15 +35,25 @@
 namespace NAV
 {
 
-/// Observation storage type
+/// @brief Observation storage type
+/// @note All containers use the memory resource of the allocator, so that an epoch can be calculated in an arena
 struct Observations
 {
+    /// Allocator used for the containers
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     /// @brief Receiver specific observation of the signal
     struct SignalObservation
     {
+        /// Allocator used for the containers
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /// Receiver specific data
         struct ReceiverSpecificData
         {
+            /// Allocator used for the containers
+            using allocator_type = std::pmr::polymorphic_allocator<>;
+
             /// Observations
             struct Observation
             {
@@ -59,6 +71,7 @@ struct Observations
             /// @param[in] e_satPos Satellite position in e frame
             /// @param[in] e_satVel Satellite velocity in e frame
             /// @param[in] satClock Satellite clock information
+            /// @param[in] alloc Allocator for the observations
             ReceiverSpecificData(std::shared_ptr<const GnssObs> gnssObs,
                                  size_t obsIdx,
                                  const Eigen::Vector3d& e_recPos,
@@ -66,8 +79,9 @@ struct Observations
                                  const Eigen::Vector3d& e_recVel,
                                  const Eigen::Vector3d& e_satPos,
                                  const Eigen::Vector3d& e_satVel,
-                                 Clock::Corrections satClock)
-                : _gnssObs(std::move(gnssObs)), _obsIdx(obsIdx), _e_satPos(e_satPos), _e_satVel(e_satVel), _satClock(satClock)
+                                 Clock::Corrections satClock,
+                                 const allocator_type& alloc = {})
+                : obs(alloc), _gnssObs(std::move(gnssObs)), _obsIdx(obsIdx), _e_satPos(e_satPos), _e_satVel(e_satVel), _satClock(satClock)
             {
                 _e_pLOS = e_calcLineOfSightUnitVector(e_recPos, e_satPos);
                 _e_vLOS = (e_recVel - e_satVel) / (e_recPos - e_satPos).norm();
@@ -81,8 +95,20 @@ struct Observations
                 LOG_DATA("    satAzimuth   {}°", rad2deg(_satAzimuth));
             }
 
+            /// @brief Copy constructor with allocator
+            /// @param[in] other Object to copy
+            /// @param[in] alloc Allocator for the observations
+            ReceiverSpecificData(const ReceiverSpecificData& other, const allocator_type& alloc)
+                : obs(other.obs, alloc), terms(other.terms), _gnssObs(other._gnssObs), _obsIdx(other._obsIdx), _e_satPos(other._e_satPos), _e_satVel(other._e_satVel), _e_pLOS(other._e_pLOS), _e_vLOS(other._e_vLOS), _satClock(other._satClock), _satElevation(other._satElevation), _satAzimuth(other._satAzimuth) {}
+
+            /// @brief Move constructor with allocator
+            /// @param[in] other Object to move
+            /// @param[in] alloc Allocator for the observations
+            ReceiverSpecificData(ReceiverSpecificData&& other, const allocator_type& alloc)
+                : obs(std::move(other.obs), alloc), terms(other.terms), _gnssObs(std::move(other._gnssObs)), _obsIdx(other._obsIdx), _e_satPos(other._e_satPos), _e_satVel(other._e_satVel), _e_pLOS(other._e_pLOS), _e_vLOS(other._e_vLOS), _satClock(other._satClock), _satElevation(other._satElevation), _satAzimuth(other._satAzimuth) {}
+
             /// Receiver observation of the signal
-            unordered_map<GnssObs::ObservationType, Observation> obs;
+            pmr::unordered_map<GnssObs::ObservationType, Observation> obs;
 
             /// @brief Returns the observation data
             [[nodiscard]] const GnssObs::ObservationData& gnssObsData() const { return _gnssObs->data.at(_obsIdx); }
@@ -109,6 +135,8 @@ struct Observations
                 double dpsr_T_r_s = 0.0;      ///< Estimated troposphere propagation error [m]
                 double dpsr_I_r_s = 0.0;      ///< Estimated ionosphere propagation error [m]
                 double dpsr_ie_r_s = 0.0;     ///< Sagnac correction [m]
+                double dpsr_ant_r = 0.0;      ///< Receiver antenna phase center offset and variation correction [m]
+                double dpsr_ant_s = 0.0;      ///< Satellite antenna phase center offset and variation correction [m]
             };
             CalcTerms terms; ///< Sub terms used in the calculation
 
@@ -127,13 +155,28 @@ struct Observations
         /// @brief Constructor
         /// @param[in] navData Satellite Navigation data
         /// @param[in] freqNum Frequency number. Only used for GLONASS G1 and G2
+        /// @param[in] alloc Allocator for the receiver specific data
         SignalObservation(std::shared_ptr<SatNavData> navData,
-                          int8_t freqNum)
-            : _navData(std::move(navData)),
+                          int8_t freqNum,
+                          const allocator_type& alloc = {})
+            : recvObs(alloc),
+              _navData(std::move(navData)),
               _freqNum(freqNum) {}
 
+        /// @brief Copy constructor with allocator
+        /// @param[in] other Object to copy
+        /// @param[in] alloc Allocator for the receiver specific data
+        SignalObservation(const SignalObservation& other, const allocator_type& alloc)
+            : recvObs(other.recvObs, alloc), _navData(other._navData), _freqNum(other._freqNum) {}
+
+        /// @brief Move constructor with allocator
+        /// @param[in] other Object to move
+        /// @param[in] alloc Allocator for the receiver specific data
+        SignalObservation(SignalObservation&& other, const allocator_type& alloc)
+            : recvObs(std::move(other.recvObs), alloc), _navData(std::move(other._navData)), _freqNum(other._freqNum) {}
+
         /// @brief Receiver specific data
-        std::vector<ReceiverSpecificData> recvObs;
+        std::pmr::vector<ReceiverSpecificData> recvObs;
 
         /// @brief Satellite Navigation data
         [[nodiscard]] const std::shared_ptr<const SatNavData>& navData() const { return _navData; }
@@ -145,9 +188,17 @@ struct Observations
         int8_t _freqNum = -128;                               ///< Frequency number. Only used for GLONASS G1 and G2
     };
 
-    unordered_map<SatSigId, SignalObservation> signals;                               ///< Observations and calculated data for each signal
-    std::set<SatelliteSystem> systems;                                                ///< Satellite systems used
-    std::unordered_set<SatId> satellites;                                             ///< Satellites used
+    /// @brief Default constructor
+    Observations() = default;
+
+    /// @brief Constructor
+    /// @param[in] alloc Allocator for the containers
+    explicit Observations(const allocator_type& alloc)
+        : signals(alloc), systems(alloc), satellites(alloc) {}
+
+    pmr::unordered_map<SatSigId, SignalObservation> signals;                          ///< Observations and calculated data for each signal
+    std::pmr::set<SatelliteSystem> systems;                                           ///< Satellite systems used
+    std::pmr::unordered_set<SatId> satellites;                                        ///< Satellites used
     std::array<size_t, GnssObs::ObservationType_COUNT> nObservables{};                ///< Number of observables
     std::array<size_t, GnssObs::ObservationType_COUNT> nObservablesUniqueSatellite{}; ///< Number of observables (counted once for each satellite)
 };
@@ -13,13 +13,21 @@
 
 #pragma once
 
+#include <filesystem>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <imgui.h>
+#include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/FileDialog.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
 #include "internal/gui/widgets/imgui_ex.hpp"
 
 #include "Navigation/Atmosphere/Ionosphere/Ionosphere.hpp"
 #include "Navigation/Atmosphere/Troposphere/Troposphere.hpp"
+#include "Navigation/GNSS/Antenna/AntennaCorrections.hpp"
+#include "Navigation/GNSS/Antenna/Antex.hpp"
 #include "Navigation/GNSS/Errors/MeasurementErrors.hpp"
 #include "Navigation/GNSS/Positioning/Observation.hpp"
 #include "Navigation/GNSS/Positioning/Receiver.hpp"
@@ -42,6 +50,29 @@ class ObservationEstimator
         DoubleDifference, ///< Double Difference
     };
 
+    /// @brief Checks the data of the ionosphere model and loads the antenna calibrations of the ANTEX file
+    /// @param[in] nameId Name and Id of the node used for log messages only
+    /// @return False if the data of the ionosphere model is missing or the ANTEX file could not be read
+    bool initialize(const std::string& nameId)
+    {
+        if (!isIonosphereModelAvailable(_ionosphereModel))
+        {
+            LOG_ERROR("{}: The data files of the ionosphere model '{}' are missing", nameId, NAV::to_string(_ionosphereModel));
+            return false;
+        }
+
+        _antex.clear();
+        if (_antexPath.empty()) { return true; }
+
+        std::filesystem::path filepath{ _antexPath };
+        if (filepath.is_relative())
+        {
+            filepath = flow::GetInputPath();
+            filepath /= _antexPath;
+        }
+        return _antex.read(filepath, { _receiverAntennaType }, nameId);
+    }
+
     /// @brief Calculates the observation estimates
     /// @param[in, out] observations List of GNSS observation data used for the calculation of this epoch
     /// @param[in] ionosphericCorrections Ionospheric correction parameters collected from the Nav data
@@ -57,6 +88,9 @@ class ObservationEstimator
     {
         LOG_DATA("{}: Calculating observation estimates:", nameId);
 
+        const AntennaPattern* receiverAntenna = _antex.empty() ? nullptr : _antex.receiverAntenna(_receiverAntennaType);
+        std::optional<Eigen::Vector3d> e_sunPos;
+
         for (auto& [satSigId, observation] : observations.signals)
         {
             const Frequency freq = satSigId.freq();
@@ -79,13 +113,32 @@ class ObservationEstimator
                 double dpsr_T_r_s = tropo_r_s.ZHD * tropo_r_s.zhdMappingFactor + tropo_r_s.ZWD * tropo_r_s.zwdMappingFactor;
                 recvObs.terms.dpsr_T_r_s = dpsr_T_r_s;
                 // Estimated ionosphere propagation error [m]
-                double dpsr_I_r_s = calcIonosphericDelay(static_cast<double>(receiver.gnssObs->insTime.toGPSweekTow().tow),
-                                                         freq, observation.freqNum(), receiver.lla_pos, recvObs.satElevation(), recvObs.satAzimuth(),
+                double dpsr_I_r_s = calcIonosphericDelay(receiver.gnssObs->insTime, freq, observation.freqNum(), receiver.lla_pos, recvObs.e_satPos(),
+                                                         recvObs.satElevation(), recvObs.satAzimuth(),
                                                          _ionosphereModel, &ionosphericCorrections);
                 recvObs.terms.dpsr_I_r_s = dpsr_I_r_s;
                 // Sagnac correction [m]
                 double dpsr_ie_r_s = calcSagnacCorrection(receiver.e_pos, recvObs.e_satPos());
                 recvObs.terms.dpsr_ie_r_s = dpsr_ie_r_s;
+                // Receiver antenna phase center offset and variation correction [m]
+                double dpsr_ant_r = 0.0;
+                if (const auto* calibration = receiverAntenna ? receiverAntenna->calibration(freq) : nullptr)
+                {
+                    dpsr_ant_r = calcReceiverAntennaCorrection(*calibration, receiver.lla_pos, recvObs.e_pLOS(), recvObs.satElevation(), recvObs.satAzimuth());
+                }
+                recvObs.terms.dpsr_ant_r = dpsr_ant_r;
+                // Satellite antenna phase center offset and variation correction [m] (broadcast orbits already refer to the antenna phase center)
+                double dpsr_ant_s = 0.0;
+                if (observation.navData()->type == SatNavData::PreciseEphemeris)
+                {
+                    const auto* satelliteAntenna = _antex.satelliteAntenna(satSigId.toSatId(), receiver.gnssObs->insTime);
+                    if (const auto* calibration = satelliteAntenna ? satelliteAntenna->calibration(freq) : nullptr)
+                    {
+                        if (!e_sunPos) { e_sunPos = e_calcSunPosition(receiver.gnssObs->insTime); }
+                        dpsr_ant_s = calcSatelliteAntennaCorrection(*calibration, recvObs.e_satPos(), *e_sunPos, recvObs.e_pLOS());
+                    }
+                }
+                recvObs.terms.dpsr_ant_s = dpsr_ant_s;
 
                 // Earth's gravitational field causes relativistic signal delay due to space-time curvature (Shapiro effect) [s]
                 // double posNorm = recvObs.e_satPos().norm() + receiver.e_pos.norm();
@@ -104,6 +157,8 @@ class ObservationEstimator
                                            + dpsr_ie_r_s
                                            + dpsr_T_r_s
                                            + dpsr_I_r_s
+                                           + dpsr_ant_r
+                                           + dpsr_ant_s
                                            + InsConst<>::C
                                                  * (receiver.recvClk.bias.value * (obsDiff != DoubleDifference)
                                                     - recvObs.satClock().bias * (obsDiff == NoDifference)
@@ -115,6 +170,8 @@ class ObservationEstimator
                         LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Sagnac correction", nameId, satSigId, obsType, recv, dpsr_ie_r_s);
                         if (dpsr_T_r_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Tropospheric delay", nameId, satSigId, obsType, recv, dpsr_T_r_s); }
                         if (dpsr_I_r_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Ionospheric delay", nameId, satSigId, obsType, recv, dpsr_I_r_s); }
+                        if (dpsr_ant_r != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Receiver antenna phase center", nameId, satSigId, obsType, recv, dpsr_ant_r); }
+                        if (dpsr_ant_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Satellite antenna phase center", nameId, satSigId, obsType, recv, dpsr_ant_s); }
                         if (obsDiff != DoubleDifference) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Receiver clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * receiver.recvClk.bias.value); }
                         if (obsDiff == NoDifference) { LOG_DATA("{}:   [{}][{:11}][{:5}]   - {:.4f} [m] Satellite clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * recvObs.satClock().bias); }
                         if (receiver.recvClk.sysTimeDiffBias.at(satSys.toEnumeration()).value != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Inter-system clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * receiver.recvClk.sysTimeDiffBias.at(satSys.toEnumeration()).value); }
@@ -128,6 +185,8 @@ class ObservationEstimator
                                            + dpsr_ie_r_s
                                            + dpsr_T_r_s
                                            - dpsr_I_r_s
+                                           + dpsr_ant_r
+                                           + dpsr_ant_s
                                            + InsConst<>::C
                                                  * (receiver.recvClk.bias.value * (obsDiff != DoubleDifference)
                                                     - recvObs.satClock().bias * (obsDiff == NoDifference)
@@ -139,6 +198,8 @@ class ObservationEstimator
                         LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Sagnac correction", nameId, satSigId, obsType, recv, dpsr_ie_r_s);
                         if (dpsr_T_r_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Tropospheric delay", nameId, satSigId, obsType, recv, dpsr_T_r_s); }
                         if (dpsr_I_r_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   - {:.4f} [m] Ionospheric delay", nameId, satSigId, obsType, recv, dpsr_I_r_s); }
+                        if (dpsr_ant_r != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Receiver antenna phase center", nameId, satSigId, obsType, recv, dpsr_ant_r); }
+                        if (dpsr_ant_s != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Satellite antenna phase center", nameId, satSigId, obsType, recv, dpsr_ant_s); }
                         if (obsDiff != DoubleDifference) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Receiver clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * receiver.recvClk.bias.value); }
                         if (obsDiff == NoDifference) { LOG_DATA("{}:   [{}][{:11}][{:5}]   - {:.4f} [m] Satellite clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * recvObs.satClock().bias); }
                         if (receiver.recvClk.sysTimeDiffBias.at(satSys.toEnumeration()).value != 0.0) { LOG_DATA("{}:   [{}][{:11}][{:5}]   + {:.4f} [m] Inter-system clock bias", nameId, satSigId, obsType, recv, InsConst<>::C * receiver.recvClk.sysTimeDiffBias.at(satSys.toEnumeration()).value); }
@@ -239,6 +300,26 @@ class ObservationEstimator
             {
                 changed = true;
             }
+
+            ImGui::TextUnformatted("Antenna phase center corrections (ANTEX)");
+            ImGui::PushID(fmt::format("ANTEX##{}", id).c_str());
+            if (gui::widgets::FileDialogLoad(_antexPath, "Select ANTEX File", "ANTEX (.atx){.atx,.ATX},.*", { ".atx", ".ATX" },
+                                             flow::GetInputPath(), std::hash<std::string>{}(id), id))
+            {
+                LOG_DEBUG("{}: ANTEX file changed to {}", id, _antexPath);
+                changed = true;
+            }
+            ImGui::PopID();
+            ImGui::SetNextItemWidth(itemWidth - ImGui::GetStyle().IndentSpacing);
+            if (ImGui::InputTextL(fmt::format("Receiver antenna##{}", id).c_str(), &_receiverAntennaType, 20))
+            {
+                LOG_DEBUG("{}: Receiver antenna changed to {}", id, _receiverAntennaType);
+                changed = true;
+            }
+            ImGui::SameLine();
+            gui::widgets::HelpMarker("Antenna type and radome as in the RINEX header 'ANT # / TYPE', e.g. 'TRM59800.00     NONE'.\n"
+                                     "The satellite antenna corrections are only applied for precise orbits,\n"
+                                     "because the broadcast orbits refer to the antenna phase center.");
             ImGui::TreePop();
         }
 
@@ -260,6 +341,9 @@ class ObservationEstimator
     IonosphereModel _ionosphereModel = IonosphereModel::Klobuchar; ///< Ionosphere Model used for the calculation
     TroposphereModelSelection _troposphereModels;                  ///< Troposphere Models used for the calculation
     GnssMeasurementErrorModel _gnssMeasurementErrorModel;          ///< GNSS measurement error model to use
+    std::string _antexPath;                                        ///< Path to the ANTEX file with the antenna calibrations (optional)
+    std::string _receiverAntennaType;                              ///< Antenna type and radome of the receivers
+    Antex _antex;                                                  ///< Antenna calibrations read from the ANTEX file
 
     /// @brief Converts the provided object into json
     /// @param[out] j Json object which gets filled with the info
@@ -270,6 +354,8 @@ class ObservationEstimator
             { "ionosphereModel", Frequency_(obj._ionosphereModel) },
             { "troposphereModels", obj._troposphereModels },
             { "gnssMeasurementError", obj._gnssMeasurementErrorModel },
+            { "antexPath", obj._antexPath },
+            { "receiverAntennaType", obj._receiverAntennaType },
         };
     }
     /// @brief Converts the provided json object into a node object
@@ -280,6 +366,8 @@ class ObservationEstimator
         if (j.contains("ionosphereModel")) { j.at("ionosphereModel").get_to(obj._ionosphereModel); }
         if (j.contains("troposphereModels")) { j.at("troposphereModels").get_to(obj._troposphereModels); }
         if (j.contains("gnssMeasurementError")) { j.at("gnssMeasurementError").get_to(obj._gnssMeasurementErrorModel); }
+        if (j.contains("antexPath")) { j.at("antexPath").get_to(obj._antexPath); }
+        if (j.contains("receiverAntennaType")) { j.at("receiverAntennaType").get_to(obj._receiverAntennaType); }
     }
 };
 
@@ -16,6 +16,8 @@
 #include <unordered_set>
 #include <utility>
 #include <array>
+#include <memory_resource>
+#include <optional>
 #include <vector>
 
 #include <imgui.h>
@@ -26,6 +28,8 @@
 #include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
 #include "Navigation/GNSS/Positioning/Observation.hpp"
 #include "Navigation/GNSS/Positioning/Receiver.hpp"
+#include "Navigation/GNSS/Positioning/SatelliteEpochCache.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
 #include "Navigation/GNSS/SNRMask.hpp"
 #include "Navigation/Transformations/Units.hpp"
 
@@ -113,17 +117,22 @@ class ObservationFilter
     /// @param[in] gnssNavInfos Collection of navigation data providers
     /// @param[in] nameId Name and Id of the node used for log messages only
     /// @param[in] ignoreElevationMask Flag wether the elevation mask should be ignored
+    /// @param[in] resource Memory resource for the observations and all temporaries (e.g. an arena which is reset every epoch)
+    /// @param[in] satelliteCache Satellite states of the epoch shared with other receivers. Signals not in the cache are calculated directly.
     /// @return 0: List of satellite data; 1: List of observations
     template<typename ReceiverType>
     [[nodiscard]] Observations selectObservationsForCalculation(const std::array<Receiver<ReceiverType>, ReceiverType::ReceiverType_COUNT>& receivers,
                                                                 const std::vector<const GnssNavInfo*>& gnssNavInfos,
                                                                 [[maybe_unused]] const std::string& nameId,
-                                                                bool ignoreElevationMask = false)
+                                                                bool ignoreElevationMask = false,
+                                                                std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+                                                                const SatelliteEpochCache* satelliteCache = nullptr)
     {
-        Observations observations;
+        Observations::allocator_type alloc(resource);
+        Observations observations(alloc);
         observations.signals.reserve(receivers.front().gnssObs->data.size());
 
-        std::array<std::unordered_set<SatId>, GnssObs::ObservationType_COUNT> nMeasUniqueSat;
+        std::pmr::vector<std::pmr::unordered_set<SatId>> nMeasUniqueSat(GnssObs::ObservationType_COUNT, alloc);
 
         for (const auto& obsData : receivers.front().gnssObs->data)
         {
@@ -139,7 +148,7 @@ class ObservationFilter
             }
 
             LOG_DATA("{}:  [{}] Searching if observation in all receivers", nameId, obsData.satSigId);
-            unordered_map<GnssObs::ObservationType, size_t> availableObservations;
+            std::array<size_t, GnssObs::ObservationType_COUNT> availableObservations{};
             if (std::any_of(receivers.begin(), receivers.end(),
                             [&](const Receiver<ReceiverType>& recv) {
                                 auto obsDataOther = std::find_if(recv.gnssObs->data.begin(), recv.gnssObs->data.end(),
@@ -158,13 +167,13 @@ class ObservationFilter
                                     switch (obsType)
                                     {
                                     case GnssObs::Pseudorange:
-                                        if (obsDataOther->pseudorange) { availableObservations[obsType]++; }
+                                        if (obsDataOther->pseudorange) { availableObservations.at(obsType)++; }
                                         break;
                                     case GnssObs::Carrier:
-                                        if (obsDataOther->carrierPhase) { availableObservations[obsType]++; }
+                                        if (obsDataOther->carrierPhase) { availableObservations.at(obsType)++; }
                                         break;
                                     case GnssObs::Doppler:
-                                        if (obsDataOther->doppler) { availableObservations[obsType]++; }
+                                        if (obsDataOther->doppler) { availableObservations.at(obsType)++; }
                                         break;
                                     case GnssObs::ObservationType_COUNT:
                                         break;
@@ -180,9 +189,9 @@ class ObservationFilter
                 continue;
             }
             LOG_DATA("{}:  [{}]   Observed psr {}x, carrier {}x, doppler {}x", nameId, obsData.satSigId,
-                     availableObservations.contains(GnssObs::Pseudorange) ? availableObservations.at(GnssObs::Pseudorange) : 0,
-                     availableObservations.contains(GnssObs::Carrier) ? availableObservations.at(GnssObs::Carrier) : 0,
-                     availableObservations.contains(GnssObs::Doppler) ? availableObservations.at(GnssObs::Doppler) : 0);
+                     availableObservations.at(GnssObs::Pseudorange),
+                     availableObservations.at(GnssObs::Carrier),
+                     availableObservations.at(GnssObs::Doppler));
 
             std::shared_ptr<NAV::SatNavData> satNavData = nullptr;
             for (const auto& gnssNavInfo : gnssNavInfos)
@@ -205,7 +214,8 @@ class ObservationFilter
                 }
             }
 
-            Observations::SignalObservation sigObs(satNavData, freqNum);
+            Observations::SignalObservation sigObs(satNavData, freqNum, alloc);
+            sigObs.recvObs.reserve(receivers.size());
 
             bool skipObservation = false;
             for (const auto& recv : receivers)
@@ -214,10 +224,16 @@ class ObservationFilter
                                                 [&obsData](const GnssObs::ObservationData& recvObsData) {
                                                     return recvObsData.satSigId == obsData.satSigId;
                                                 });
-                auto satClk = satNavData->calcClockCorrections(recv.gnssObs->insTime,
-                                                               recvObsData->pseudorange->value,
-                                                               recvObsData->satSigId.freq());
-                auto satPosVel = satNavData->calcSatellitePosVel(satClk.transmitTime);
+                std::optional<SatelliteEpochCache::State> cached;
+                if (satelliteCache)
+                {
+                    cached = satelliteCache->get(satNavData.get(), recvObsData->satSigId, recv.gnssObs->insTime, recvObsData->pseudorange->value);
+                }
+                auto satClk = cached ? cached->satClk
+                                     : satNavData->calcClockCorrections(recv.gnssObs->insTime,
+                                                                        recvObsData->pseudorange->value,
+                                                                        recvObsData->satSigId.freq());
+                auto satPosVel = cached ? cached->satPosVel : satNavData->calcSatellitePosVel(satClk.transmitTime);
 
                 LOG_DATA("{}: Adding satellite [{}] for receiver {}", nameId, obsData.satSigId, recv.type);
                 sigObs.recvObs.emplace_back(recv.gnssObs, static_cast<size_t>(recvObsData - recv.gnssObs->data.begin()),
@@ -254,7 +270,7 @@ class ObservationFilter
 
                 for (const auto& obsType : _usedObsTypes)
                 {
-                    if (availableObservations.contains(obsType) && availableObservations.at(obsType) == receivers.size())
+                    if (availableObservations.at(obsType) == receivers.size())
                     {
                         observations.nObservables.at(obsType)++;
                         nMeasUniqueSat.at(obsType).insert(satId);
@@ -287,7 +303,7 @@ class ObservationFilter
 
             observations.systems.insert(satId.satSys);
             observations.satellites.insert(satId);
-            observations.signals.insert(std::make_pair(obsData.satSigId, sigObs));
+            observations.signals.emplace(obsData.satSigId, std::move(sigObs));
         }
 
         for (size_t obsType = 0; obsType < GnssObs::ObservationType_COUNT; obsType++)
@@ -415,6 +431,28 @@ class ObservationFilter
                && std::find(_excludedSatellites.begin(), _excludedSatellites.end(), satId) == _excludedSatellites.end();
     }
 
+    /// @brief Checks if the signal is allowed by the frequency, code and satellite selection. Does not check elevation or SNR mask
+    /// @param[in] satSigId Satellite signal identifier
+    [[nodiscard]] bool isSignalAllowed(const SatSigId& satSigId) const
+    {
+        return (satSigId.freq() & _filterFreq)
+               && (satSigId.code & _filterCode)
+               && isSatelliteAllowed(satSigId.toSatId());
+    }
+
+    /// @brief Checks the elevation and SNR mask of a signal
+    /// @param[in] satSigId Satellite signal identifier
+    /// @param[in] satElevation Elevation of the satellite [rad]
+    /// @param[in] CN0 Carrier-to-Noise density [dBHz]. If no CN0 is available, the SNR mask is not checked
+    /// @param[in] receiverIdx Index of the receiver (selects the SNR mask)
+    /// @return True if the signal passes both masks
+    [[nodiscard]] bool isAboveMasks(const SatSigId& satSigId, double satElevation, const std::optional<double>& CN0, size_t receiverIdx = 0) const
+    {
+        if (satElevation < _elevationMask) { return false; }
+        return !CN0
+               || _snrMask.at(_sameSnrMaskForAllReceivers ? 0 : receiverIdx).checkSNRMask(satSigId.freq(), satElevation, CN0.value());
+    }
+
     /// @brief Checks if the Observation type is used by the GUI settings
     /// @param[in] obsType Observation Type
     [[nodiscard]] bool isObsTypeUsed(GnssObs::ObservationType obsType) const
@@ -0,0 +1,213 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RAIM.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/math/distributions/chi_squared.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <fmt/format.h>
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+bool RAIM::ShowGuiWidgets(const char* id, float itemWidth)
+{
+    bool changed = false;
+
+    changed |= ImGui::Checkbox(fmt::format("Fault detection and exclusion (RAIM)##{}", id).c_str(), &_enabled);
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Checks the consistency of the observations with a chi-square test of the weighted residuals.\n"
+                             "If the test fails, the observations which restore the consistency are excluded.");
+
+    if (!_enabled) { ImGui::BeginDisabled(); }
+    ImGui::Indent();
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Probability of false alarm##{}", id).c_str(), &_probabilityFalseAlarm, 1e-12, 0.5, 0.0, 0.0, "%.1e");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Probability of missed detection##{}", id).c_str(), &_probabilityMissedDetection, 1e-12, 0.5, 0.0, 0.0, "%.1e");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Used for the horizontal and vertical protection levels");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputIntL(fmt::format("Max. excluded observations##{}", id).c_str(), &_maxExclusions, 0, 2);
+
+    ImGui::Unindent();
+    if (!_enabled) { ImGui::EndDisabled(); }
+
+    return changed;
+}
+
+double RAIM::chiSquareThreshold(double probabilityFalseAlarm, Eigen::Index dof)
+{
+    boost::math::chi_squared dist(static_cast<double>(dof));
+    return boost::math::quantile(boost::math::complement(dist, probabilityFalseAlarm));
+}
+
+RAIM::Result RAIM::checkAndExclude(const Eigen::MatrixXd& H, const Eigen::VectorXd& w, const Eigen::VectorXd& dz, const Eigen::Matrix3d& n_R_e) const
+{
+    constexpr double MIN_REDUNDANCY = 1e-6;
+
+    Result result;
+    Eigen::Index m = H.rows();
+    Eigen::Index n = H.cols();
+
+    result.cofactor = (H.transpose() * w.asDiagonal() * H).inverse();
+    result.solution = result.cofactor * H.transpose() * w.asDiagonal() * dz;
+    result.dof = m - n;
+    if (result.dof < 1)
+    {
+        LOG_DATA("RAIM: No redundancy ({} observations, {} unknowns)", m, n);
+        return result;
+    }
+
+    Eigen::VectorXd v = dz - H * result.solution;
+    result.testStatistic = v.transpose() * w.asDiagonal() * v;
+    result.threshold = chiSquareThreshold(_probabilityFalseAlarm, result.dof);
+    LOG_DATA("RAIM: test statistic {} (threshold {}, dof {})", result.testStatistic, result.threshold, result.dof);
+
+    if (result.testStatistic <= result.threshold)
+    {
+        result.consistent = true;
+        calcProtectionLevels(result, H, w, n_R_e);
+        return result;
+    }
+    result.faultDetected = true;
+
+    // Cofactor matrix of the adjusted observations. The subset solutions follow from rank-one downdates
+    //   x_(i) = x - Q h_i w_i v_i / (1 - l_i)   with the leverage l_i = w_i h_iᵀ Q h_i
+    // so the test statistics of all subsets can be calculated from the residuals of the full solution.
+    Eigen::MatrixXd C = H * result.cofactor * H.transpose();
+    Eigen::VectorXd redundancy = Eigen::VectorXd::Ones(m) - w.cwiseProduct(C.diagonal());
+    // Test statistic after excluding the observation i
+    Eigen::VectorXd SSE_i = Eigen::VectorXd::Constant(m, std::numeric_limits<double>::infinity());
+    for (Eigen::Index i = 0; i < m; i++)
+    {
+        if (redundancy(i) > MIN_REDUNDANCY) { SSE_i(i) = result.testStatistic - w(i) * v(i) * v(i) / redundancy(i); }
+    }
+
+    std::vector<Eigen::Index> excluded;
+    double testStatistic = result.testStatistic;
+    if (_maxExclusions >= 1 && result.dof - 1 >= 1)
+    {
+        Eigen::Index i = 0;
+        double minSSE = SSE_i.minCoeff(&i);
+        LOG_DATA("RAIM: Excluding observation {} reduces the test statistic to {}", i, minSSE);
+        if (minSSE <= chiSquareThreshold(_probabilityFalseAlarm, result.dof - 1))
+        {
+            excluded = { i };
+            testStatistic = minSSE;
+        }
+    }
+    if (excluded.empty() && _maxExclusions >= 2 && result.dof - 2 >= 1)
+    {
+        double minSSE = std::numeric_limits<double>::infinity();
+        std::pair<Eigen::Index, Eigen::Index> minPair;
+        for (Eigen::Index i = 0; i < m; i++)
+        {
+            if (redundancy(i) <= MIN_REDUNDANCY) { continue; }
+            double f = w(i) / redundancy(i);
+            for (Eigen::Index j = i + 1; j < m; j++)
+            {
+                // Residual and redundancy of observation j, after the observation i was excluded
+                double r_j = 1.0 - w(j) * (C(j, j) + f * C(i, j) * C(i, j));
+                if (r_j <= MIN_REDUNDANCY) { continue; }
+                double v_j = v(j) + C(j, i) * f * v(i);
+                double SSE_ij = SSE_i(i) - w(j) * v_j * v_j / r_j;
+                if (SSE_ij < minSSE)
+                {
+                    minSSE = SSE_ij;
+                    minPair = { i, j };
+                }
+            }
+        }
+        LOG_DATA("RAIM: Excluding observations {} and {} reduces the test statistic to {}", minPair.first, minPair.second, minSSE);
+        if (minSSE <= chiSquareThreshold(_probabilityFalseAlarm, result.dof - 2))
+        {
+            excluded = { minPair.first, minPair.second };
+            testStatistic = minSSE;
+        }
+    }
+
+    if (excluded.empty())
+    {
+        LOG_DATA("RAIM: Fault detected, but could not be excluded");
+        return result;
+    }
+
+    // Final solution with the excluded observations removed
+    Eigen::VectorXd w_excl = w;
+    for (const auto& i : excluded) { w_excl(i) = 0.0; }
+    result.excluded = excluded;
+    result.cofactor = (H.transpose() * w_excl.asDiagonal() * H).inverse();
+    result.solution = result.cofactor * H.transpose() * w_excl.asDiagonal() * dz;
+    result.dof -= static_cast<Eigen::Index>(excluded.size());
+    result.testStatistic = testStatistic;
+    result.threshold = chiSquareThreshold(_probabilityFalseAlarm, result.dof);
+    result.consistent = true;
+    calcProtectionLevels(result, H, w_excl, n_R_e);
+
+    return result;
+}
+
+void RAIM::calcProtectionLevels(Result& result, const Eigen::MatrixXd& H, const Eigen::VectorXd& w, const Eigen::Matrix3d& n_R_e) const
+{
+    // Position rows of the gain matrix K = Q Hᵀ W in the local navigation frame
+    Eigen::MatrixXd n_K = n_R_e * (result.cofactor.topRows<3>() * H.transpose() * w.asDiagonal());
+    Eigen::Matrix3d n_Q = n_R_e * result.cofactor.topLeftCorner<3, 3>() * n_R_e.transpose();
+
+    double maxHSlope = 0.0;
+    double maxVSlope = 0.0;
+    for (Eigen::Index i = 0; i < H.rows(); i++)
+    {
+        if (w(i) == 0.0) { continue; }
+        double redundancy = 1.0 - w(i) * H.row(i) * result.cofactor * H.row(i).transpose();
+        if (redundancy <= 1e-6) { continue; }
+        double scale = 1.0 / std::sqrt(w(i) * redundancy); // σ_i / sqrt(S_ii)
+        maxHSlope = std::max(maxHSlope, n_K.col(i).head<2>().norm() * scale);
+        maxVSlope = std::max(maxVSlope, std::abs(n_K(2, i)) * scale);
+    }
+
+    // Semi-major axis of the horizontal error ellipse
+    double sigmaH = std::sqrt(0.5 * (n_Q(0, 0) + n_Q(1, 1)) + std::sqrt(0.25 * std::pow(n_Q(0, 0) - n_Q(1, 1), 2) + n_Q(0, 1) * n_Q(0, 1)));
+    double sigmaV = std::sqrt(n_Q(2, 2));
+
+    double K_md = boost::math::quantile(boost::math::complement(boost::math::normal(), _probabilityMissedDetection));
+    result.HPL = maxHSlope * std::sqrt(result.threshold) + K_md * sigmaH;
+    result.VPL = maxVSlope * std::sqrt(result.threshold) + K_md * sigmaV;
+    LOG_DATA("RAIM: HPL = {}, VPL = {}", result.HPL, result.VPL);
+}
+
+void to_json(json& j, const RAIM& obj)
+{
+    j = json{
+        { "enabled", obj._enabled },
+        { "probabilityFalseAlarm", obj._probabilityFalseAlarm },
+        { "probabilityMissedDetection", obj._probabilityMissedDetection },
+        { "maxExclusions", obj._maxExclusions },
+    };
+}
+
+void from_json(const json& j, RAIM& obj)
+{
+    if (j.contains("enabled")) { j.at("enabled").get_to(obj._enabled); }
+    if (j.contains("probabilityFalseAlarm")) { j.at("probabilityFalseAlarm").get_to(obj._probabilityFalseAlarm); }
+    if (j.contains("probabilityMissedDetection")) { j.at("probabilityMissedDetection").get_to(obj._probabilityMissedDetection); }
+    if (j.contains("maxExclusions")) { j.at("maxExclusions").get_to(obj._maxExclusions); }
+}
+
+} // namespace NAV
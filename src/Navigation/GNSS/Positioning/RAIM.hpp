@@ -0,0 +1,102 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RAIM.hpp
+/// @brief Receiver Autonomous Integrity Monitoring (RAIM) with fault detection and exclusion (FDE)
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "util/Eigen.hpp"
+#include "util/Json.hpp"
+
+namespace NAV
+{
+
+/// @brief Receiver Autonomous Integrity Monitoring (RAIM) with fault detection and exclusion (FDE)
+///
+/// Checks the consistency of a linearized weighted least squares problem with a global chi-square test on the weighted sum
+/// of squared residuals. If the test fails, up to two faulty observations are excluded by testing all subsets. The subsets
+/// are not solved again, but derived from the full solution with rank-one downdates of the cofactor matrix, so the exclusion
+/// of two faults stays in O(m²) for m observations. Protection levels are calculated with the slope method of weighted RAIM.
+/// @note See Walter and Enge (1995): Weighted RAIM for Precision Approach
+class RAIM
+{
+  public:
+    /// @brief Result of the consistency check
+    struct Result
+    {
+        bool faultDetected = false;           ///< Whether the global test of all observations failed
+        bool consistent = false;              ///< Whether the observations (after exclusion) passed the global test
+        double testStatistic = 0.0;           ///< Weighted sum of squared residuals (after exclusion)
+        double threshold = 0.0;               ///< Chi-square threshold for the test statistic
+        Eigen::Index dof = 0;                 ///< Statistical degrees of freedom (after exclusion)
+        std::vector<Eigen::Index> excluded;   ///< Indices of the excluded observations
+        Eigen::VectorXd solution;             ///< Weighted least squares solution without the excluded observations
+        Eigen::MatrixXd cofactor;             ///< Cofactor matrix (a priori variance) of the solution
+        double HPL = std::nan("");            ///< Horizontal protection level [m]
+        double VPL = std::nan("");            ///< Vertical protection level [m]
+    };
+
+    /// @brief Shows the GUI input to select the options
+    /// @param[in] id Unique id for ImGui.
+    /// @param[in] itemWidth Width of the widgets
+    /// @return True when something was changed
+    bool ShowGuiWidgets(const char* id, float itemWidth);
+
+    /// @brief Whether fault detection and exclusion is enabled
+    [[nodiscard]] bool isEnabled() const { return _enabled; }
+
+    /// @brief Checks the consistency of the observations and excludes up to the configured amount of faults
+    /// @param[in] H Design Matrix (the first 3 columns have to be the ECEF position)
+    /// @param[in] w A priori weights of the observations (inverse variances)
+    /// @param[in] dz Residual vector
+    /// @param[in] n_R_e Rotation from ECEF into the local navigation frame at the receiver position (for the protection levels)
+    /// @return Result of the check. If the problem has no redundancy, the result is not consistent and no test statistic is available.
+    [[nodiscard]] Result checkAndExclude(const Eigen::MatrixXd& H, const Eigen::VectorXd& w, const Eigen::VectorXd& dz, const Eigen::Matrix3d& n_R_e) const;
+
+    /// @brief Calculates the threshold of the chi-square test
+    /// @param[in] probabilityFalseAlarm Probability of a false alarm
+    /// @param[in] dof Statistical degrees of freedom
+    [[nodiscard]] static double chiSquareThreshold(double probabilityFalseAlarm, Eigen::Index dof);
+
+  private:
+    /// @brief Calculates the protection levels of the solution
+    /// @param[in, out] result Result with the solution and cofactor matrix to calculate the protection levels for
+    /// @param[in] H Design Matrix
+    /// @param[in] w Weights of the observations (excluded observations have zero weight)
+    /// @param[in] n_R_e Rotation from ECEF into the local navigation frame
+    void calcProtectionLevels(Result& result, const Eigen::MatrixXd& H, const Eigen::VectorXd& w, const Eigen::Matrix3d& n_R_e) const;
+
+    /// Whether fault detection and exclusion is enabled
+    bool _enabled = false;
+    /// Probability of a false alarm of the global test
+    double _probabilityFalseAlarm = 1e-3;
+    /// Probability of a missed detection (for the protection levels)
+    double _probabilityMissedDetection = 1e-3;
+    /// Maximum amount of observations to exclude (0 = detection only)
+    int _maxExclusions = 2;
+
+    friend void to_json(json& j, const RAIM& obj);
+    friend void from_json(const json& j, RAIM& obj);
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] obj Object to convert into json
+void to_json(json& j, const RAIM& obj);
+/// @brief Converts the provided json object into a node object
+/// @param[in] j Json object with the needed values
+/// @param[out] obj Object to fill from the json
+void from_json(const json& j, RAIM& obj);
+
+} // namespace NAV
@@ -0,0 +1,647 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Algorithm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_set>
+
+#include <Eigen/Dense>
+#include <fmt/format.h>
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+namespace RTK
+{
+
+bool Algorithm::ShowGuiWidgets(const char* id, float itemWidth)
+{
+    bool changed = false;
+
+    changed |= _obsFilter.ShowGuiWidgets<ReceiverType>(id, itemWidth);
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Pseudorange StdDev##{}", id).c_str(), &_codeStdDev, 0.01, 100.0, 0.1, 1.0, "%.2f m");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Standard deviation of an undifferenced pseudorange observation in zenith direction.\n"
+                             "The single differences are weighted with σ² (1/sin²(elevᵣₒᵥₑᵣ) + 1/sin²(elevᵦₐₛₑ)).");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    double phaseStdDev = _phaseStdDev * 1e3;
+    if (ImGui::InputDoubleL(fmt::format("Carrier-phase StdDev##{}", id).c_str(), &phaseStdDev, 0.1, 100.0, 0.5, 1.0, "%.1f mm"))
+    {
+        _phaseStdDev = phaseStdDev * 1e-3;
+        changed = true;
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Standard deviation of an undifferenced carrier-phase observation in zenith direction.");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDouble2L(fmt::format("Acceleration StdDev (hor/ver)##{}", id).c_str(), _accelStdDev.data(), 0.0, 100.0, "%.2f m/√(s^3)");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Standard deviation of the acceleration due to user motion, which drives the constant velocity model");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Max. differential age##{}", id).c_str(), &_maxDifferentialAge, 0.0, 120.0, 1.0, 5.0, "%.1f s");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Rover epochs further apart from the last base epoch are not processed");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Max. ambiguity gap##{}", id).c_str(), &_maxAmbiguityGap, 0.0, 600.0, 1.0, 10.0, "%.1f s");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Ambiguities of signals, which were not observed for this time, are removed from the filter.\n"
+                             "When the signal is observed again, its ambiguity is initialized anew.");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Outlier threshold##{}", id).c_str(), &_outlierThreshold, 1.0, 100.0, 0.5, 1.0, "%.1f σ");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Observations with an innovation above this multiple of its standard deviation are excluded (pseudorange) "
+                             "or their ambiguity is initialized anew (carrier-phase), one after another");
+
+    changed |= CycleSlipDetectorGui(fmt::format("Cycle-slip detector##{}", id).c_str(), _cycleSlipDetector, itemWidth);
+
+    return changed;
+}
+
+void Algorithm::reset()
+{
+    _base = Epoch{};
+    _baseCycleSlips.clear();
+    _cycleSlipDetectors.fill(_cycleSlipDetector);
+    for (auto& cycleSlipDetector : _cycleSlipDetectors) { cycleSlipDetector.reset(); }
+    _kalmanFilter = KeyedKalmanFilterD<States::StateKeyTypes, Meas::MeasKeyTypes>{ States::PosVel, {} };
+    _initialized = false;
+    _lastEpochTime.reset();
+    _referenceSignals.clear();
+    _lastObserved.clear();
+}
+
+void Algorithm::setBasePosition(const Eigen::Vector3d& e_position)
+{
+    _e_basePosition = e_position;
+    if (!_base.insTime.empty()) { setReceiverPosition(_base, e_position); }
+}
+
+std::optional<double> Algorithm::ambiguityDD(const SatSigId& satSigId) const
+{
+    auto ref = _referenceSignals.find(satSigId.code);
+    if (ref == _referenceSignals.end() || ref->second == satSigId) { return std::nullopt; }
+
+    States::AmbiguitySD key{ satSigId };
+    States::AmbiguitySD refKey{ ref->second };
+    if (!_kalmanFilter.hasState(key) || !_kalmanFilter.hasState(refKey)) { return std::nullopt; }
+
+    return _kalmanFilter.x(key) - _kalmanFilter.x(refKey);
+}
+
+Algorithm::Epoch Algorithm::evaluateEpoch(const GnssObs& gnssObs,
+                                          const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                          const Eigen::Vector3d& e_recvPos,
+                                          ReceiverType receiverType,
+                                          [[maybe_unused]] const std::string& nameId) const
+{
+    Epoch epoch{ .insTime = gnssObs.insTime, .e_recvPos = e_recvPos, .satellites = {}, .signals = {} };
+
+    // The orbit and clock are evaluated once per satellite (with the first pseudorange of the satellite)
+    std::unordered_set<SatId> unavailableSatellites;
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.pseudorange || !obsData.carrierPhase || !_obsFilter.isSignalAllowed(obsData.satSigId)) { continue; }
+
+        SatId satId = obsData.satSigId.toSatId();
+        if (unavailableSatellites.contains(satId) || epoch.satellites.contains(satId)) { continue; }
+
+        std::shared_ptr<const SatNavData> satNavData = nullptr;
+        for (const auto& gnssNavInfo : gnssNavInfos)
+        {
+            auto satNav = gnssNavInfo->searchNavigationData(satId, gnssObs.insTime);
+            if (satNav && satNav->isHealthy())
+            {
+                satNavData = satNav;
+                break;
+            }
+        }
+        if (satNavData == nullptr)
+        {
+            LOG_DATA("{}: [{}] {} satellite [{}] skipped, because no navigation data is available", nameId, gnssObs.insTime.toYMDHMS(GPST), receiverType, satId);
+            unavailableSatellites.insert(satId);
+            continue;
+        }
+
+        auto satClk = satNavData->calcClockCorrections(gnssObs.insTime, obsData.pseudorange->value, Frequency::GetL1(obsData.satSigId.freq()));
+        epoch.satellites.emplace(satId, SatelliteState{ .satNavData = satNavData,
+                                                        .e_satPos = satNavData->calcSatellitePosVel(satClk.transmitTime).e_pos,
+                                                        .clkBias = satClk.bias,
+                                                        .range = 0.0,
+                                                        .e_lineOfSight = Eigen::Vector3d::Zero(),
+                                                        .elevation = 0.0 });
+    }
+    setReceiverPosition(epoch, e_recvPos);
+
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.pseudorange || !obsData.carrierPhase || !_obsFilter.isSignalAllowed(obsData.satSigId)) { continue; }
+
+        auto sat = epoch.satellites.find(obsData.satSigId.toSatId());
+        if (sat == epoch.satellites.end()) { continue; }
+
+        if (!_obsFilter.isAboveMasks(obsData.satSigId, sat->second.elevation, obsData.CN0, receiverType))
+        {
+            LOG_DATA("{}: [{}] {} signal [{}] skipped because of the elevation or SNR mask", nameId, gnssObs.insTime.toYMDHMS(GPST), receiverType, obsData.satSigId);
+            continue;
+        }
+
+        int8_t freqNum = -128;
+        if (obsData.satSigId.toSatId().satSys == GLO)
+        {
+            if (auto gloSatNavData = std::dynamic_pointer_cast<const GLONASSEphemeris>(sat->second.satNavData))
+            {
+                freqNum = gloSatNavData->frequencyNumber;
+            }
+        }
+        double lambda = InsConst<>::C / obsData.satSigId.freq().getFrequency(freqNum);
+
+        epoch.signals.emplace(obsData.satSigId, SignalState{ .pseudorange = obsData.pseudorange->value,
+                                                             .phase = lambda * obsData.carrierPhase->value,
+                                                             .lambda = lambda,
+                                                             .freqNum = freqNum });
+    }
+
+    return epoch;
+}
+
+void Algorithm::setReceiverPosition(Epoch& epoch, const Eigen::Vector3d& e_recvPos)
+{
+    epoch.e_recvPos = e_recvPos;
+
+    Eigen::Vector3d lla_recvPos = trafo::ecef2lla_WGS84(e_recvPos);
+    Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(lla_recvPos(0), lla_recvPos(1));
+    for (auto& [satId, sat] : epoch.satellites)
+    {
+        sat.range = (sat.e_satPos - e_recvPos).norm() + calcSagnacCorrection(e_recvPos, sat.e_satPos);
+        sat.e_lineOfSight = e_calcLineOfSightUnitVector(e_recvPos, sat.e_satPos);
+        sat.elevation = calcSatElevation(n_Quat_e * sat.e_lineOfSight);
+    }
+}
+
+std::vector<SatSigId> Algorithm::detectCycleSlips(const GnssObs& gnssObs, const Epoch& epoch, ReceiverType receiverType)
+{
+    std::vector<CycleSlipDetector::SatelliteObservation> satObs;
+    for (const auto& obsData : gnssObs.data)
+    {
+        auto signal = epoch.signals.find(obsData.satSigId);
+        if (signal == epoch.signals.end()) { continue; }
+
+        SatId satId = obsData.satSigId.toSatId();
+        auto sat = std::find_if(satObs.begin(), satObs.end(), [&](const auto& obs) { return obs.satId == satId; });
+        if (sat == satObs.end())
+        {
+            satObs.push_back(CycleSlipDetector::SatelliteObservation{ .satId = satId, .signals = {}, .freqNum = signal->second.freqNum });
+            sat = std::prev(satObs.end());
+        }
+        sat->signals.push_back(CycleSlipDetector::SatelliteObservation::Signal{ .code = obsData.satSigId.code, .measurement = *obsData.carrierPhase });
+    }
+
+    std::vector<SatSigId> cycleSlips;
+    for (const auto& cycleSlip : _cycleSlipDetectors.at(receiverType).checkForCycleSlip(gnssObs.insTime, satObs))
+    {
+        std::visit([&](auto&& slip) {
+            using T = std::decay_t<decltype(slip)>;
+            if constexpr (std::is_same_v<T, CycleSlipDetector::CycleSlipDualFrequency>)
+            {
+                cycleSlips.insert(cycleSlips.end(), slip.signals.begin(), slip.signals.end());
+            }
+            else { cycleSlips.push_back(slip.signal); }
+        },
+                   cycleSlip);
+    }
+    return cycleSlips;
+}
+
+void Algorithm::addBaseObservation(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos, const std::string& nameId)
+{
+    if (_e_basePosition.isZero())
+    {
+        LOG_DEBUG("{}: [{}] Base observation skipped, because the base position is not known yet", nameId, gnssObs.insTime.toYMDHMS(GPST));
+        return;
+    }
+
+    _base = evaluateEpoch(gnssObs, gnssNavInfos, _e_basePosition, Base, nameId);
+    auto cycleSlips = detectCycleSlips(gnssObs, _base, Base);
+    _baseCycleSlips.insert(_baseCycleSlips.end(), cycleSlips.begin(), cycleSlips.end());
+}
+
+std::vector<Algorithm::SingleDifference> Algorithm::calcSingleDifferences(const Epoch& rover) const
+{
+    std::vector<SingleDifference> singleDifferences;
+    singleDifferences.reserve(rover.signals.size());
+
+    for (const auto& [satSigId, roverSignal] : rover.signals)
+    {
+        auto baseSignal = _base.signals.find(satSigId);
+        if (baseSignal == _base.signals.end()) { continue; }
+
+        SatId satId = satSigId.toSatId();
+        const auto& roverSat = rover.satellites.at(satId);
+        const auto& baseSat = _base.satellites.at(satId);
+
+        // Observed minus computed range and satellite clock of each receiver, so that the epochs do not need to coincide
+        double roverComputed = roverSat.range - InsConst<>::C * roverSat.clkBias;
+        double baseComputed = baseSat.range - InsConst<>::C * baseSat.clkBias;
+        double weight = 1.0 / std::pow(std::sin(roverSat.elevation), 2) + 1.0 / std::pow(std::sin(baseSat.elevation), 2);
+
+        singleDifferences.push_back(SingleDifference{
+            .satSigId = satSigId,
+            .pseudorange = (roverSignal.pseudorange - roverComputed) - (baseSignal->second.pseudorange - baseComputed),
+            .phase = (roverSignal.phase - roverComputed) - (baseSignal->second.phase - baseComputed),
+            .lambda = roverSignal.lambda,
+            .varPsr = std::pow(_codeStdDev, 2) * weight,
+            .varPhase = std::pow(_phaseStdDev, 2) * weight,
+            .elevation = roverSat.elevation,
+            .e_lineOfSight = roverSat.e_lineOfSight,
+        });
+    }
+    // Deterministic order of the states and measurements
+    std::sort(singleDifferences.begin(), singleDifferences.end(), [](const auto& lhs, const auto& rhs) { return lhs.satSigId < rhs.satSigId; });
+
+    return singleDifferences;
+}
+
+std::vector<Algorithm::Measurement> Algorithm::formDoubleDifferences(const std::vector<SingleDifference>& singleDifferences,
+                                                                     const std::vector<SatSigId>& excludedReferences,
+                                                                     [[maybe_unused]] const std::string& nameId)
+{
+    // Only signals with the same code are differenced, so that the receiver code and phase biases cancel
+    std::map<Code, std::vector<const SingleDifference*>> groups;
+    for (const auto& sd : singleDifferences) { groups[sd.satSigId.code].push_back(&sd); }
+
+    auto isExcluded = [&](const SatSigId& satSigId) {
+        return std::find(excludedReferences.begin(), excludedReferences.end(), satSigId) != excludedReferences.end();
+    };
+
+    std::vector<Measurement> measurements;
+    measurements.reserve(2 * singleDifferences.size());
+    for (const auto& [code, group] : groups)
+    {
+        if (group.size() < 2) { continue; }
+
+        // The reference is kept as long as it is observed, otherwise the signal with the highest elevation becomes the new one
+        const SingleDifference* ref = nullptr;
+        auto prevRef = _referenceSignals.find(code);
+        if (prevRef != _referenceSignals.end() && !isExcluded(prevRef->second))
+        {
+            auto iter = std::find_if(group.begin(), group.end(), [&](const SingleDifference* sd) { return sd->satSigId == prevRef->second; });
+            if (iter != group.end()) { ref = *iter; }
+        }
+        if (ref == nullptr)
+        {
+            for (const auto* sd : group)
+            {
+                if (ref == nullptr || (isExcluded(ref->satSigId) && !isExcluded(sd->satSigId))
+                    || (isExcluded(ref->satSigId) == isExcluded(sd->satSigId) && sd->elevation > ref->elevation))
+                {
+                    ref = sd;
+                }
+            }
+            if (prevRef != _referenceSignals.end())
+            {
+                LOG_DEBUG("{}: Reference signal of [{}] changed from [{}] to [{}]", nameId, code, prevRef->second, ref->satSigId);
+            }
+            _referenceSignals[code] = ref->satSigId;
+        }
+
+        for (const auto* sd : group)
+        {
+            if (sd == ref) { continue; }
+            measurements.push_back(Measurement{ .key = Meas::PsrDD{ sd->satSigId }, .sd = sd, .ref = ref, .obs = sd->pseudorange - ref->pseudorange });
+            measurements.push_back(Measurement{ .key = Meas::CarrierDD{ sd->satSigId }, .sd = sd, .ref = ref, .obs = sd->phase - ref->phase });
+        }
+    }
+
+    return measurements;
+}
+
+bool Algorithm::initializePosition(Epoch& rover, [[maybe_unused]] const std::string& nameId)
+{
+    // Starting at the base position, the line-of-sight vectors are accurate enough after a few iterations for baselines up to hundreds of km
+    setReceiverPosition(rover, _e_basePosition);
+    for (size_t iter = 0; iter < 10; iter++)
+    {
+        auto singleDifferences = calcSingleDifferences(rover);
+        auto measurements = formDoubleDifferences(singleDifferences, {}, nameId);
+        std::erase_if(measurements, [](const Measurement& meas) { return !std::holds_alternative<Meas::PsrDD>(meas.key); });
+        if (measurements.size() < 4)
+        {
+            LOG_DEBUG("{}: [{}] Only {} double-differenced pseudoranges available, but at least 4 are needed for the initialization.",
+                      nameId, rover.insTime.toYMDHMS(GPST), measurements.size());
+            return false;
+        }
+
+        auto m = static_cast<Eigen::Index>(measurements.size());
+        Eigen::MatrixX3d H(m, 3);
+        Eigen::VectorXd y(m);
+        Eigen::MatrixXd R = Eigen::MatrixXd::Zero(m, m);
+        for (Eigen::Index k = 0; k < m; k++)
+        {
+            const auto& meas = measurements.at(static_cast<size_t>(k));
+            H.row(k) = -(meas.sd->e_lineOfSight - meas.ref->e_lineOfSight).transpose();
+            y(k) = meas.obs;
+            R(k, k) = meas.sd->varPsr + meas.ref->varPsr;
+            for (Eigen::Index l = 0; l < k; l++)
+            {
+                if (measurements.at(static_cast<size_t>(l)).ref == meas.ref) { R(k, l) = R(l, k) = meas.ref->varPsr; }
+            }
+        }
+        Eigen::MatrixXd W = R.inverse();
+        Eigen::Matrix3d N_inv = (H.transpose() * W * H).inverse();
+        Eigen::Vector3d dx = N_inv * H.transpose() * W * y;
+        setReceiverPosition(rover, rover.e_recvPos + dx);
+        LOG_DATA("{}: [{}] Initialization iteration {}: dx = {} [m]", nameId, rover.insTime.toYMDHMS(GPST), iter, dx.transpose());
+
+        if (dx.norm() < 1e-4)
+        {
+            _kalmanFilter = KeyedKalmanFilterD<States::StateKeyTypes, Meas::MeasKeyTypes>{ States::PosVel, {} };
+            _kalmanFilter.x(States::Pos) = rover.e_recvPos;
+            _kalmanFilter.P(States::Pos, States::Pos) = N_inv;
+            _kalmanFilter.P(States::Vel, States::Vel).diagonal().setConstant(std::pow(_initVelocityStdDev, 2));
+            _referenceSignals.clear();
+            _lastObserved.clear();
+            return true;
+        }
+    }
+
+    LOG_DEBUG("{}: [{}] The initialization of the rover position did not converge", nameId, rover.insTime.toYMDHMS(GPST));
+    return false;
+}
+
+void Algorithm::predict(double dt)
+{
+    Eigen::Vector3d e_position = _kalmanFilter.x(States::Pos);
+    Eigen::Vector3d lla_position = trafo::ecef2lla_WGS84(e_position);
+    Eigen::Matrix3d e_R_n = trafo::e_Quat_n(lla_position(0), lla_position(1)).toRotationMatrix();
+    Eigen::Vector3d n_covarianceAccel(std::pow(_accelStdDev[0], 2), std::pow(_accelStdDev[0], 2), std::pow(_accelStdDev[1], 2));
+    Eigen::Matrix3d e_covarianceAccel = e_R_n * n_covarianceAccel.asDiagonal() * e_R_n.transpose();
+
+    // The ambiguities are constant
+    _kalmanFilter.Phi(all, all).setIdentity();
+    _kalmanFilter.Phi(States::Pos, States::Vel).diagonal().setConstant(dt);
+
+    // Groves (2013), eq. 9.152 without the clock states
+    Eigen::Matrix3d Q_posVel = e_covarianceAccel * std::pow(dt, 2) / 2.0;
+    _kalmanFilter.Q(all, all).setZero();
+    _kalmanFilter.Q(States::Pos, States::Pos) = e_covarianceAccel * std::pow(dt, 3) / 3.0;
+    _kalmanFilter.Q(States::Pos, States::Vel) = Q_posVel;
+    _kalmanFilter.Q(States::Vel, States::Pos) = Q_posVel.transpose();
+    _kalmanFilter.Q(States::Vel, States::Vel) = e_covarianceAccel * dt;
+
+    _kalmanFilter.predict();
+}
+
+void Algorithm::initializeAmbiguity(const SingleDifference& sd)
+{
+    States::AmbiguitySD key{ sd.satSigId };
+    if (!_kalmanFilter.hasState(key)) { _kalmanFilter.addState(key); }
+
+    // Receiver clocks and geometry cancel in the difference of carrier-phase and pseudorange
+    _kalmanFilter.x(key) = (sd.phase - sd.pseudorange) / sd.lambda;
+    _kalmanFilter.P(key, all).setZero();
+    _kalmanFilter.P(all, key).setZero();
+    _kalmanFilter.P(key, key) = (sd.varPsr + sd.varPhase) / std::pow(sd.lambda, 2);
+}
+
+void Algorithm::setMeasurements(const std::vector<Measurement>& measurements)
+{
+    std::vector<Meas::MeasKeyTypes> measKeys;
+    measKeys.reserve(measurements.size());
+    for (const auto& meas : measurements) { measKeys.push_back(meas.key); }
+    _kalmanFilter.setMeasurements(measKeys);
+
+    auto m = static_cast<Eigen::Index>(measurements.size());
+    Eigen::VectorXd dz(m);
+    Eigen::MatrixXd R = Eigen::MatrixXd::Zero(m, m);
+    for (Eigen::Index k = 0; k < m; k++)
+    {
+        const auto& meas = measurements.at(static_cast<size_t>(k));
+        bool isPhase = std::holds_alternative<Meas::CarrierDD>(meas.key);
+
+        _kalmanFilter.H(meas.key, States::Pos) = -(meas.sd->e_lineOfSight - meas.ref->e_lineOfSight).transpose();
+        dz(k) = meas.obs;
+        if (isPhase)
+        {
+            States::AmbiguitySD ambiguity{ meas.sd->satSigId };
+            States::AmbiguitySD refAmbiguity{ meas.ref->satSigId };
+            _kalmanFilter.H(meas.key, ambiguity) = meas.sd->lambda;
+            _kalmanFilter.H(meas.key, refAmbiguity) = -meas.ref->lambda;
+            dz(k) -= meas.sd->lambda * _kalmanFilter.x(ambiguity) - meas.ref->lambda * _kalmanFilter.x(refAmbiguity);
+        }
+
+        // Double differences with the same reference signal are correlated
+        double refVariance = isPhase ? meas.ref->varPhase : meas.ref->varPsr;
+        R(k, k) = (isPhase ? meas.sd->varPhase : meas.sd->varPsr) + refVariance;
+        for (Eigen::Index l = 0; l < k; l++)
+        {
+            const auto& other = measurements.at(static_cast<size_t>(l));
+            if (other.ref == meas.ref && other.key.index() == meas.key.index()) { R(k, l) = R(l, k) = refVariance; }
+        }
+    }
+    _kalmanFilter.z(all) = dz;
+    _kalmanFilter.R(all, all) = R;
+}
+
+std::optional<Algorithm::Result> Algorithm::calcSolution(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos, const std::string& nameId)
+{
+    if (_base.insTime.empty())
+    {
+        LOG_DATA("{}: [{}] No base observation available yet", nameId, gnssObs.insTime.toYMDHMS(GPST));
+        return std::nullopt;
+    }
+    double differentialAge = static_cast<double>((gnssObs.insTime - _base.insTime).count());
+    if (std::abs(differentialAge) > _maxDifferentialAge)
+    {
+        LOG_DEBUG("{}: [{}] Differential age of {:.1f}s exceeds the limit", nameId, gnssObs.insTime.toYMDHMS(GPST), differentialAge);
+        return std::nullopt;
+    }
+
+    Result result;
+    result.insTime = gnssObs.insTime;
+    result.differentialAge = differentialAge;
+
+    if (_initialized)
+    {
+        double dt = static_cast<double>((gnssObs.insTime - _lastEpochTime).count());
+        if (dt <= 0.0)
+        {
+            LOG_DEBUG("{}: [{}] Epoch is not after the last epoch", nameId, gnssObs.insTime.toYMDHMS(GPST));
+            return std::nullopt;
+        }
+        predict(dt);
+    }
+
+    auto rover = evaluateEpoch(gnssObs, gnssNavInfos, _initialized ? Eigen::Vector3d(_kalmanFilter.x(States::Pos)) : _e_basePosition, Rover, nameId);
+    auto cycleSlips = detectCycleSlips(gnssObs, rover, Rover);
+    cycleSlips.insert(cycleSlips.end(), _baseCycleSlips.begin(), _baseCycleSlips.end());
+    _baseCycleSlips.clear();
+
+    if (!_initialized)
+    {
+        if (!initializePosition(rover, nameId)) { return std::nullopt; }
+        _initialized = true;
+        LOG_DEBUG("{}: [{}] Filter initialized at {} [m]", nameId, gnssObs.insTime.toYMDHMS(GPST), rover.e_recvPos.transpose());
+    }
+    _lastEpochTime = gnssObs.insTime;
+
+    auto singleDifferences = calcSingleDifferences(rover);
+
+    // Ambiguities of signals, which were lost, are removed. Slipped and new ones are initialized.
+    std::vector<States::StateKeyTypes> lostAmbiguities;
+    for (const auto& key : _kalmanFilter.x.rowKeys())
+    {
+        if (const auto* ambiguity = std::get_if<States::AmbiguitySD>(&key))
+        {
+            if (static_cast<double>((gnssObs.insTime - _lastObserved.at(ambiguity->satSigId)).count()) > _maxAmbiguityGap)
+            {
+                LOG_DATA("{}: [{}] Removing the ambiguity of [{}], which was not observed for too long", nameId, gnssObs.insTime.toYMDHMS(GPST), ambiguity->satSigId);
+                lostAmbiguities.push_back(key);
+                _lastObserved.erase(ambiguity->satSigId);
+            }
+        }
+    }
+    if (!lostAmbiguities.empty()) { _kalmanFilter.removeStates(lostAmbiguities); }
+
+    std::vector<SatSigId> resetAmbiguities;
+    for (const auto& sd : singleDifferences)
+    {
+        bool slip = std::find(cycleSlips.begin(), cycleSlips.end(), sd.satSigId) != cycleSlips.end();
+        if (!_kalmanFilter.hasState(States::AmbiguitySD{ sd.satSigId }) || slip)
+        {
+            if (slip)
+            {
+                LOG_DEBUG("{}: [{}] Cycle-slip detected for [{}]. Initializing its ambiguity anew.", nameId, gnssObs.insTime.toYMDHMS(GPST), sd.satSigId);
+                result.cycleSlips.push_back(sd.satSigId);
+            }
+            initializeAmbiguity(sd);
+            resetAmbiguities.push_back(sd.satSigId);
+        }
+        _lastObserved[sd.satSigId] = gnssObs.insTime;
+    }
+
+    auto measurements = formDoubleDifferences(singleDifferences, resetAmbiguities, nameId);
+
+    // Innovation test, which excludes one observation after another
+    while (true)
+    {
+        auto nPsr = std::count_if(measurements.begin(), measurements.end(), [](const Measurement& meas) { return std::holds_alternative<Meas::PsrDD>(meas.key); });
+        if (nPsr < 3)
+        {
+            LOG_DEBUG("{}: [{}] Only {} double-differenced pseudoranges available, but at least 3 are needed.",
+                      nameId, gnssObs.insTime.toYMDHMS(GPST), nPsr);
+            return std::nullopt;
+        }
+
+        setMeasurements(measurements);
+        Eigen::VectorXd S_diag = (_kalmanFilter.H(all, all) * _kalmanFilter.P(all, all) * _kalmanFilter.H(all, all).transpose()).diagonal()
+                                 + _kalmanFilter.R(all, all).diagonal();
+        Eigen::Index maxIdx = 0;
+        double normalizedInnovation = (_kalmanFilter.z(all).array().abs() / S_diag.array().sqrt()).maxCoeff(&maxIdx);
+        if (normalizedInnovation <= _outlierThreshold) { break; }
+
+        const auto& outlier = measurements.at(static_cast<size_t>(maxIdx));
+        LOG_DEBUG("{}: [{}] Innovation of [{}] is {:.3f} m ({:.1f} σ)", nameId, gnssObs.insTime.toYMDHMS(GPST),
+                  outlier.key, _kalmanFilter.z(all)(maxIdx), normalizedInnovation);
+        result.outliers.push_back(outlier.sd->satSigId);
+        if (std::holds_alternative<Meas::CarrierDD>(outlier.key))
+        {
+            // Most probably an undetected cycle-slip
+            initializeAmbiguity(*outlier.sd);
+        }
+        measurements.erase(measurements.begin() + maxIdx);
+    }
+
+    _kalmanFilter.correctWithMeasurementInnovation();
+
+    std::unordered_set<SatId> usedSatellites;
+    std::unordered_set<SatSigId> referenceSignals;
+    for (const auto& meas : measurements)
+    {
+        usedSatellites.insert(meas.sd->satSigId.toSatId());
+        usedSatellites.insert(meas.ref->satSigId.toSatId());
+        referenceSignals.insert(meas.ref->satSigId);
+        if (std::holds_alternative<Meas::CarrierDD>(meas.key)) { result.nSignals++; }
+    }
+
+    result.e_position = _kalmanFilter.x(States::Pos);
+    result.e_velocity = _kalmanFilter.x(States::Vel);
+    result.e_positionCovariance = _kalmanFilter.P(States::Pos, States::Pos);
+    result.e_velocityCovariance = _kalmanFilter.P(States::Vel, States::Vel);
+    result.e_baseline = result.e_position - _e_basePosition;
+    result.nSatellites = usedSatellites.size();
+    result.nAmbiguities = static_cast<size_t>(_kalmanFilter.x.rows()) - States::PosVel.size();
+    result.referenceSignals.assign(referenceSignals.begin(), referenceSignals.end());
+    std::sort(result.referenceSignals.begin(), result.referenceSignals.end());
+
+    LOG_DATA("{}: [{}] Baseline {} [m] with {} satellites and {} double-differenced carrier-phases", nameId, gnssObs.insTime.toYMDHMS(GPST),
+             result.e_baseline.transpose(), result.nSatellites, result.nSignals);
+
+    return result;
+}
+
+void to_json(json& j, const Algorithm& obj)
+{
+    j = json{
+        { "obsFilter", obj._obsFilter },
+        { "cycleSlipDetector", obj._cycleSlipDetector },
+        { "codeStdDev", obj._codeStdDev },
+        { "phaseStdDev", obj._phaseStdDev },
+        { "accelStdDev", obj._accelStdDev },
+        { "maxDifferentialAge", obj._maxDifferentialAge },
+        { "maxAmbiguityGap", obj._maxAmbiguityGap },
+        { "outlierThreshold", obj._outlierThreshold },
+    };
+}
+
+void from_json(const json& j, Algorithm& obj)
+{
+    if (j.contains("obsFilter")) { j.at("obsFilter").get_to(obj._obsFilter); }
+    if (j.contains("cycleSlipDetector")) { j.at("cycleSlipDetector").get_to(obj._cycleSlipDetector); }
+    if (j.contains("codeStdDev")) { j.at("codeStdDev").get_to(obj._codeStdDev); }
+    if (j.contains("phaseStdDev")) { j.at("phaseStdDev").get_to(obj._phaseStdDev); }
+    if (j.contains("accelStdDev")) { j.at("accelStdDev").get_to(obj._accelStdDev); }
+    if (j.contains("maxDifferentialAge")) { j.at("maxDifferentialAge").get_to(obj._maxDifferentialAge); }
+    if (j.contains("maxAmbiguityGap")) { j.at("maxAmbiguityGap").get_to(obj._maxAmbiguityGap); }
+    if (j.contains("outlierThreshold")) { j.at("outlierThreshold").get_to(obj._outlierThreshold); }
+}
+
+} // namespace RTK
+
+const char* to_string(RTK::Algorithm::ReceiverType receiver)
+{
+    switch (receiver)
+    {
+    case RTK::Algorithm::ReceiverType::Base:
+        return "Base";
+    case RTK::Algorithm::ReceiverType::Rover:
+        return "Rover";
+    case RTK::Algorithm::ReceiverType::ReceiverType_COUNT:
+        break;
+    }
+    return "";
+}
+
+} // namespace NAV
@@ -0,0 +1,325 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Algorithm.hpp
+/// @brief Real-Time Kinematic (RTK) float positioning with double-differenced code and carrier-phase observations
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Navigation/GNSS/Ambiguity/CycleSlipDetector.hpp"
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Positioning/ObservationFilter.hpp"
+#include "Navigation/GNSS/Positioning/RTK/Keys.hpp"
+#include "Navigation/GNSS/Satellite/internal/SatNavData.hpp"
+#include "Navigation/Math/KeyedKalmanFilter.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+
+#include "util/Json.hpp"
+
+namespace NAV
+{
+
+namespace RTK
+{
+
+/// @brief Real-Time Kinematic (RTK) float algorithm
+///
+/// Code and carrier-phase observations of a base station with known position and of the rover are differenced between the
+/// receivers and between the satellites (per signal code, to the signal with the highest elevation):
+///   ∇Δρ̃ = ∇Δρ + ε
+///   λ∇Δφ = ∇Δρ + λᵢΔNᵢ - λᵣΔNᵣ + ε
+/// so that the receiver and satellite clocks and biases cancel. Over short baselines the ionospheric and tropospheric
+/// delays cancel as well and are neglected.
+///
+/// The rover position and velocity and the between-receiver single-differenced ambiguities ΔN are estimated in a keyed
+/// Kalman filter. As the double differences are only formed in the measurement model, a change of the reference signal does
+/// not touch the states, and a cycle-slip only resets the ambiguity of the affected signal.
+///
+/// The observations of both receivers are reduced by the computed ranges and satellite clocks of their own epoch, so a base
+/// station with a lower rate can be used (the remaining base receiver clock change is common to all signals and cancels).
+/// The base epoch is only evaluated once, when it is received.
+/// @note See \cite RTKLIB (ch. E.7)
+class Algorithm
+{
+  public:
+    /// @brief Receiver Types
+    enum ReceiverType
+    {
+        Base,               ///< Base station with known position
+        Rover,              ///< Rover
+        ReceiverType_COUNT, ///< Amount of receiver types
+    };
+
+    /// @brief Solution of an epoch
+    struct Result
+    {
+        InsTime insTime;                        ///< Time of the rover epoch
+        Eigen::Vector3d e_position;             ///< Position of the rover in ECEF frame [m]
+        Eigen::Vector3d e_velocity;             ///< Velocity of the rover in ECEF frame [m/s]
+        Eigen::Matrix3d e_positionCovariance;   ///< Covariance of the position in ECEF frame [m²]
+        Eigen::Matrix3d e_velocityCovariance;   ///< Covariance of the velocity in ECEF frame [m²/s²]
+        Eigen::Vector3d e_baseline;             ///< Baseline from the base to the rover in ECEF frame [m]
+        double differentialAge = 0.0;           ///< Time difference between the rover and the base epoch [s]
+        size_t nSatellites = 0;                 ///< Amount of satellites used
+        size_t nSignals = 0;                    ///< Amount of double-differenced carrier-phase observations used
+        size_t nAmbiguities = 0;                ///< Amount of estimated single-differenced ambiguities
+        std::vector<SatSigId> referenceSignals; ///< Reference signals of the double differences
+        std::vector<SatSigId> cycleSlips;       ///< Signals whose ambiguity was reset because of a cycle-slip of the rover or the base
+        std::vector<SatSigId> outliers;         ///< Signals excluded (code) or reset (carrier-phase) because of a large innovation
+    };
+
+    /// @brief Shows the GUI input to select the options
+    /// @param[in] id Unique id for ImGui.
+    /// @param[in] itemWidth Width of the widgets
+    bool ShowGuiWidgets(const char* id, float itemWidth);
+
+    /// @brief Reset the algorithm (the filter is initialized again with the next epoch)
+    void reset();
+
+    /// @brief Sets the known position of the base station
+    /// @param[in] e_position Position of the base station antenna in ECEF frame [m]
+    void setBasePosition(const Eigen::Vector3d& e_position);
+
+    /// @brief Position of the base station antenna in ECEF frame [m]
+    [[nodiscard]] const Eigen::Vector3d& basePosition() const { return _e_basePosition; }
+
+    /// @brief Whether the filter was initialized
+    [[nodiscard]] bool isInitialized() const { return _initialized; }
+
+    /// @brief Evaluates the observations of the base station, which are used for the following rover epochs
+    /// @param[in] gnssObs GNSS observation of the base station
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    void addBaseObservation(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos, const std::string& nameId);
+
+    /// @brief Calculates the float solution for a rover epoch
+    /// @param[in] gnssObs GNSS observation of the rover
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @return The solution, or nothing if no recent base epoch or too few common signals are available
+    std::optional<Result> calcSolution(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos, const std::string& nameId);
+
+    /// @brief Double-differenced float ambiguity of the signal to the current reference signal [cycles]
+    /// @param[in] satSigId Satellite signal identifier
+    /// @return The ambiguity or nothing if it is not estimated or the signal is the reference itself
+    [[nodiscard]] std::optional<double> ambiguityDD(const SatSigId& satSigId) const;
+
+    /// Observation Filter (frequencies, codes, satellites, elevation and SNR mask)
+    ObservationFilter _obsFilter{ ReceiverType_COUNT,
+                                  /* available */ std::unordered_set{ GnssObs::Pseudorange, GnssObs::Carrier },
+                                  /*   needed  */ std::unordered_set{ GnssObs::Pseudorange, GnssObs::Carrier } };
+
+    /// Cycle-slip detector settings (applied to the base and the rover)
+    CycleSlipDetector _cycleSlipDetector;
+
+  private:
+    /// @brief Satellite orbit and clock of an epoch
+    struct SatelliteState
+    {
+        std::shared_ptr<const SatNavData> satNavData; ///< Navigation data the state was calculated with
+        Eigen::Vector3d e_satPos;                     ///< Satellite position at the transmit time [m]
+        double clkBias = 0.0;                         ///< Satellite clock bias (on the first frequency of the system) [s]
+        double range = 0.0;                           ///< Range incl. Sagnac correction to the receiver position of the epoch [m]
+        Eigen::Vector3d e_lineOfSight;                ///< Line-of-sight unit vector from the receiver to the satellite
+        double elevation = 0.0;                       ///< Satellite elevation [rad]
+    };
+
+    /// @brief Code and carrier-phase of a signal
+    struct SignalState
+    {
+        double pseudorange = 0.0; ///< Pseudorange [m]
+        double phase = 0.0;       ///< Carrier-phase [m]
+        double lambda = 0.0;      ///< Wavelength [m]
+        int8_t freqNum = -128;    ///< Frequency number. Only used for GLONASS G1 and G2
+    };
+
+    /// @brief States of an epoch of one receiver
+    struct Epoch
+    {
+        InsTime insTime;                                      ///< Receive time
+        Eigen::Vector3d e_recvPos;                            ///< Receiver position the ranges refer to [m]
+        std::unordered_map<SatId, SatelliteState> satellites; ///< Satellite states
+        std::unordered_map<SatSigId, SignalState> signals;    ///< Observations
+    };
+
+    /// @brief Between-receiver single difference of a signal, reduced by the computed ranges and satellite clocks
+    struct SingleDifference
+    {
+        SatSigId satSigId;             ///< Satellite signal identifier
+        double pseudorange = 0.0;      ///< Single-differenced pseudorange minus computed [m]
+        double phase = 0.0;            ///< Single-differenced carrier-phase minus computed [m]
+        double lambda = 0.0;           ///< Wavelength [m]
+        double varPsr = 0.0;           ///< Variance of the single-differenced pseudorange [m²]
+        double varPhase = 0.0;         ///< Variance of the single-differenced carrier-phase [m²]
+        double elevation = 0.0;        ///< Satellite elevation at the rover [rad]
+        Eigen::Vector3d e_lineOfSight; ///< Line-of-sight unit vector from the rover to the satellite
+    };
+
+    /// @brief Double-differenced observation
+    struct Measurement
+    {
+        Meas::MeasKeyTypes key;      ///< Measurement key
+        const SingleDifference* sd;  ///< Single difference of the signal
+        const SingleDifference* ref; ///< Single difference of the reference signal
+        double obs = 0.0;            ///< Double-differenced observation minus computed (without ambiguities) [m]
+    };
+
+    /// @brief Evaluates the satellite states and observations of the epoch
+    /// @param[in] gnssObs GNSS observation of the receiver
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information
+    /// @param[in] e_recvPos Approximate receiver position [m]
+    /// @param[in] receiverType Receiver the observation belongs to (selects the SNR mask)
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    [[nodiscard]] Epoch evaluateEpoch(const GnssObs& gnssObs,
+                                      const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                      const Eigen::Vector3d& e_recvPos,
+                                      ReceiverType receiverType,
+                                      const std::string& nameId) const;
+
+    /// @brief Recalculates the ranges and line-of-sight vectors of the epoch for a new receiver position
+    /// @param[in, out] epoch Epoch to update
+    /// @param[in] e_recvPos Receiver position [m]
+    static void setReceiverPosition(Epoch& epoch, const Eigen::Vector3d& e_recvPos);
+
+    /// @brief Signals of the observation with a detected cycle-slip
+    /// @param[in] gnssObs GNSS observation of the receiver
+    /// @param[in] epoch Evaluated states of the epoch
+    /// @param[in] receiverType Receiver the observation belongs to
+    [[nodiscard]] std::vector<SatSigId> detectCycleSlips(const GnssObs& gnssObs, const Epoch& epoch, ReceiverType receiverType);
+
+    /// @brief Forms the single differences of all signals observed by the rover and the base
+    /// @param[in] rover Evaluated rover epoch
+    [[nodiscard]] std::vector<SingleDifference> calcSingleDifferences(const Epoch& rover) const;
+
+    /// @brief Selects the reference signal for each signal code and forms the double differences
+    /// @param[in] singleDifferences Single differences of the epoch
+    /// @param[in] excludedReferences Signals which should not become a new reference (e.g. reset ambiguities)
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    [[nodiscard]] std::vector<Measurement> formDoubleDifferences(const std::vector<SingleDifference>& singleDifferences,
+                                                                 const std::vector<SatSigId>& excludedReferences,
+                                                                 const std::string& nameId);
+
+    /// @brief Initializes the rover position with an iterated weighted least squares of the double-differenced pseudoranges
+    /// @param[in, out] rover Rover epoch, whose ranges are updated to the estimated position
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @return True if enough observations were available
+    bool initializePosition(Epoch& rover, const std::string& nameId);
+
+    /// @brief Sets the design matrix, observation covariance and innovation of the double differences in the Kalman filter
+    /// @param[in] measurements Double-differenced observations
+    void setMeasurements(const std::vector<Measurement>& measurements);
+
+    /// @brief Predicts the states with a constant velocity model
+    /// @param[in] dt Time interval [s]
+    void predict(double dt);
+
+    /// @brief Initializes the single-differenced ambiguity of the signal from code and carrier-phase
+    /// @param[in] sd Single difference of the signal
+    void initializeAmbiguity(const SingleDifference& sd);
+
+    /// Base station position in ECEF frame [m]
+    Eigen::Vector3d _e_basePosition = Eigen::Vector3d::Zero();
+
+    /// Evaluated last base epoch
+    Epoch _base;
+
+    /// Cycle-slips of the base which were not applied to the filter yet
+    std::vector<SatSigId> _baseCycleSlips;
+
+    /// Cycle-slip detectors of the receivers
+    std::array<CycleSlipDetector, ReceiverType_COUNT> _cycleSlipDetectors;
+
+    /// Kalman filter with the rover position, velocity and the single-differenced ambiguities
+    KeyedKalmanFilterD<States::StateKeyTypes, Meas::MeasKeyTypes> _kalmanFilter{ States::PosVel, {} };
+
+    /// Whether the filter is initialized
+    bool _initialized = false;
+
+    /// Time of the last filter epoch
+    InsTime _lastEpochTime;
+
+    /// Reference signal for each signal code
+    std::unordered_map<Code, SatSigId> _referenceSignals;
+
+    /// Time the signals were last observed by both receivers
+    std::unordered_map<SatSigId, InsTime> _lastObserved;
+
+    /// Standard deviation of an undifferenced pseudorange observation in zenith direction [m]
+    double _codeStdDev = 0.3;
+
+    /// Standard deviation of an undifferenced carrier-phase observation in zenith direction [m]
+    double _phaseStdDev = 0.003;
+
+    /// Standard deviation of the acceleration due to user motion in horizontal and vertical component [m / √(s^3)]
+    std::array<double, 2> _accelStdDev = { 3.0, 1.5 };
+
+    /// Standard deviation of the velocity at initialization [m/s]
+    double _initVelocityStdDev = 10.0;
+
+    /// Maximum time difference between the rover and the base epoch [s]
+    double _maxDifferentialAge = 10.0;
+
+    /// Ambiguities of signals which were not observed for this time interval are removed [s]
+    double _maxAmbiguityGap = 2.0;
+
+    /// Observations with a normalized innovation above this threshold are excluded (code) or their ambiguity is reset (carrier-phase)
+    double _outlierThreshold = 5.0;
+
+    friend void to_json(json& j, const Algorithm& obj);
+    friend void from_json(const json& j, Algorithm& obj);
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] obj Object to convert into json
+void to_json(json& j, const Algorithm& obj);
+/// @brief Converts the provided json object into a node object
+/// @param[in] j Json object with the needed values
+/// @param[out] obj Object to fill from the json
+void from_json(const json& j, Algorithm& obj);
+
+} // namespace RTK
+
+/// @brief Converts the enum to a string
+/// @param[in] receiver Enum value to convert into text
+/// @return String representation of the enum
+[[nodiscard]] const char* to_string(RTK::Algorithm::ReceiverType receiver);
+
+} // namespace NAV
+
+#ifndef DOXYGEN_IGNORE
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::Algorithm::ReceiverType> : fmt::formatter<const char*>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] type Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::Algorithm::ReceiverType& type, FormatContext& ctx) const
+    {
+        return fmt::formatter<const char*>::format(NAV::to_string(type), ctx);
+    }
+};
+
+#endif
@@ -0,0 +1,36 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Keys.hpp"
+
+#include <iostream>
+
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::RtkStates& obj)
+{
+    return os << fmt::format("{}", obj);
+}
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::AmbiguitySD& obj)
+{
+    return os << fmt::format("{}", obj);
+}
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::PsrDD& obj)
+{
+    return os << fmt::format("{}", obj);
+}
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::CarrierDD& obj)
+{
+    return os << fmt::format("{}", obj);
+}
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::StateKeyTypes& obj)
+{
+    return os << fmt::format("{}", obj);
+}
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::MeasKeyTypes& obj)
+{
+    return os << fmt::format("{}", obj);
+}
@@ -0,0 +1,295 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Keys.hpp
+/// @brief Keys for the RTK algorithm for use inside the KeyedMatrices
+/// @date 2026-10-18
+
+#pragma once
+
+#include <vector>
+#include <variant>
+#include <fmt/format.h>
+
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+
+namespace NAV::RTK
+{
+
+namespace States
+{
+/// @brief State Keys of the RTK filter
+enum RtkStates
+{
+    PosX,            ///< Position ECEF_X [m]
+    PosY,            ///< Position ECEF_Y [m]
+    PosZ,            ///< Position ECEF_Z [m]
+    VelX,            ///< Velocity ECEF_X [m/s]
+    VelY,            ///< Velocity ECEF_Y [m/s]
+    VelZ,            ///< Velocity ECEF_Z [m/s]
+    RtkStates_COUNT, ///< Count
+};
+
+/// @brief Between-receiver single-differenced float ambiguity (rover - base) [cycles]
+///
+/// The double-differenced ambiguities are formed in the measurement model, so that a change of the reference satellite
+/// does not require a transformation of the states.
+struct AmbiguitySD
+{
+    /// @brief Equal comparison operator
+    /// @param rhs Right-hand side
+    bool operator==(const AmbiguitySD& rhs) const { return satSigId == rhs.satSigId; }
+    /// @brief Satellite Signal Id
+    SatSigId satSigId;
+};
+
+/// Alias for the state key type
+using StateKeyTypes = std::variant<RtkStates, AmbiguitySD>;
+/// @brief All position keys
+inline static const std::vector<StateKeyTypes> Pos = { RtkStates::PosX, RtkStates::PosY, RtkStates::PosZ };
+/// @brief All velocity keys
+inline static const std::vector<StateKeyTypes> Vel = { RtkStates::VelX, RtkStates::VelY, RtkStates::VelZ };
+/// @brief Vector with all position and velocity state keys
+inline static const std::vector<StateKeyTypes> PosVel = { RtkStates::PosX, RtkStates::PosY, RtkStates::PosZ,
+                                                          RtkStates::VelX, RtkStates::VelY, RtkStates::VelZ };
+
+} // namespace States
+
+namespace Meas
+{
+
+/// @brief Double-differenced pseudorange of the signal and the reference signal [m]
+struct PsrDD
+{
+    /// @brief Equal comparison operator
+    /// @param rhs Right-hand side
+    bool operator==(const PsrDD& rhs) const { return satSigId == rhs.satSigId; }
+    /// @brief Satellite Signal Id
+    SatSigId satSigId;
+};
+/// @brief Double-differenced carrier-phase of the signal and the reference signal [m]
+struct CarrierDD
+{
+    /// @brief Equal comparison operator
+    /// @param rhs Right-hand side
+    bool operator==(const CarrierDD& rhs) const { return satSigId == rhs.satSigId; }
+    /// @brief Satellite Signal Id
+    SatSigId satSigId;
+};
+
+/// Alias for the measurement key type
+using MeasKeyTypes = std::variant<PsrDD, CarrierDD>;
+
+} // namespace Meas
+
+} // namespace NAV::RTK
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::RtkStates& obj);
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::AmbiguitySD& obj);
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::PsrDD& obj);
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::CarrierDD& obj);
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::States::StateKeyTypes& obj);
+
+/// @brief Stream insertion operator overload
+/// @param[in, out] os Output stream object to stream the time into
+/// @param[in] obj Object to print
+/// @return Returns the output stream object in order to chain stream insertions
+std::ostream& operator<<(std::ostream& os, const NAV::RTK::Meas::MeasKeyTypes& obj);
+
+namespace std
+{
+/// @brief Hash function (needed for unordered_map)
+template<>
+struct hash<NAV::RTK::States::AmbiguitySD>
+{
+    /// @brief Hash function
+    /// @param[in] ambiguity Single-differenced ambiguity
+    size_t operator()(const NAV::RTK::States::AmbiguitySD& ambiguity) const
+    {
+        return NAV::RTK::States::RtkStates_COUNT + std::hash<NAV::SatSigId>()(ambiguity.satSigId);
+    }
+};
+/// @brief Hash function (needed for unordered_map)
+template<>
+struct hash<NAV::RTK::Meas::PsrDD>
+{
+    /// @brief Hash function
+    /// @param[in] psr Double-differenced pseudorange
+    size_t operator()(const NAV::RTK::Meas::PsrDD& psr) const
+    {
+        return std::hash<NAV::SatSigId>()(psr.satSigId);
+    }
+};
+/// @brief Hash function (needed for unordered_map)
+template<>
+struct hash<NAV::RTK::Meas::CarrierDD>
+{
+    /// @brief Hash function
+    /// @param[in] carrier Double-differenced carrier-phase
+    size_t operator()(const NAV::RTK::Meas::CarrierDD& carrier) const
+    {
+        return std::hash<NAV::SatSigId>()(carrier.satSigId) << 12;
+    }
+};
+} // namespace std
+
+#ifndef DOXYGEN_IGNORE
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::States::RtkStates> : fmt::formatter<const char*>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] state Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::States::RtkStates& state, FormatContext& ctx)
+    {
+        using namespace NAV::RTK::States; // NOLINT(google-build-using-namespace)
+
+        switch (state)
+        {
+        case PosX:
+            return fmt::formatter<const char*>::format("PosX", ctx);
+        case PosY:
+            return fmt::formatter<const char*>::format("PosY", ctx);
+        case PosZ:
+            return fmt::formatter<const char*>::format("PosZ", ctx);
+        case VelX:
+            return fmt::formatter<const char*>::format("VelX", ctx);
+        case VelY:
+            return fmt::formatter<const char*>::format("VelY", ctx);
+        case VelZ:
+            return fmt::formatter<const char*>::format("VelZ", ctx);
+        case RtkStates_COUNT:
+            return fmt::formatter<const char*>::format("RtkStates_COUNT", ctx);
+        }
+
+        return fmt::formatter<const char*>::format("ERROR", ctx);
+    }
+};
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::States::AmbiguitySD> : fmt::formatter<std::string>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] ambiguity Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::States::AmbiguitySD& ambiguity, FormatContext& ctx)
+    {
+        return fmt::formatter<std::string>::format(fmt::format("N_SD({})", ambiguity.satSigId), ctx);
+    }
+};
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::Meas::PsrDD> : fmt::formatter<std::string>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] psr Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::Meas::PsrDD& psr, FormatContext& ctx)
+    {
+        return fmt::formatter<std::string>::format(fmt::format("psrDD({})", psr.satSigId), ctx);
+    }
+};
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::Meas::CarrierDD> : fmt::formatter<std::string>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] carrier Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::Meas::CarrierDD& carrier, FormatContext& ctx)
+    {
+        return fmt::formatter<std::string>::format(fmt::format("phiDD({})", carrier.satSigId), ctx);
+    }
+};
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::States::StateKeyTypes> : fmt::formatter<std::string>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] state Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::States::StateKeyTypes& state, FormatContext& ctx)
+    {
+        if (const auto* s = std::get_if<NAV::RTK::States::RtkStates>(&state))
+        {
+            return fmt::formatter<std::string>::format(fmt::format("{}", *s), ctx);
+        }
+        if (const auto* ambiguity = std::get_if<NAV::RTK::States::AmbiguitySD>(&state))
+        {
+            return fmt::formatter<std::string>::format(fmt::format("N_SD({})", ambiguity->satSigId), ctx);
+        }
+
+        return fmt::formatter<std::string>::format("ERROR", ctx);
+    }
+};
+
+/// @brief Formatter
+template<>
+struct fmt::formatter<NAV::RTK::Meas::MeasKeyTypes> : fmt::formatter<std::string>
+{
+    /// @brief Defines how to format structs
+    /// @param[in] meas Struct to format
+    /// @param[in, out] ctx Format context
+    /// @return Output iterator
+    template<typename FormatContext>
+    auto format(const NAV::RTK::Meas::MeasKeyTypes& meas, FormatContext& ctx)
+    {
+        if (const auto* psr = std::get_if<NAV::RTK::Meas::PsrDD>(&meas))
+        {
+            return fmt::formatter<std::string>::format(fmt::format("psrDD({})", psr->satSigId), ctx);
+        }
+        if (const auto* carrier = std::get_if<NAV::RTK::Meas::CarrierDD>(&meas))
+        {
+            return fmt::formatter<std::string>::format(fmt::format("phiDD({})", carrier->satSigId), ctx);
+        }
+
+        return fmt::formatter<std::string>::format("ERROR", ctx);
+    }
+};
+
+#endif
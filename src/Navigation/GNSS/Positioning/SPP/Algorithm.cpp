@@ -17,6 +17,7 @@
 
 #include "internal/gui/widgets/EnumCombo.hpp"
 #include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
 
 #include "Navigation/Atmosphere/Ionosphere/IonosphericCorrections.hpp"
 #include "Navigation/Math/KeyedLeastSquares.hpp"
@@ -41,6 +42,34 @@ bool Algorithm::ShowGuiWidgets(const char* id, float itemWidth, float unitWidth)
     changed |= ImGui::Checkbox(fmt::format("Estimate inter-frequency biases##{}", id).c_str(), &_estimateInterFreqBiases);
     if (!canEstimateInterFrequencyBias()) { ImGui::EndDisabled(); }
 
+    if (_estimatorType == EstimatorType::LeastSquares) { ImGui::BeginDisabled(); }
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= gui::widgets::EnumCombo(fmt::format("Robust weighting##{}", id).c_str(), _robustWeightFunction);
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Down-weights measurements with large standardized residuals.\n"
+                             "For least squares the converged solution is reweighted iteratively,\n"
+                             "for the Kalman filter the noise of measurements with large innovations is inflated.");
+    if (_robustWeightFunction != RobustWeightFunction::None)
+    {
+        ImGui::Indent();
+        ImGui::SetNextItemWidth(itemWidth);
+        changed |= ImGui::InputDoubleL(fmt::format("k0##{}", id).c_str(), &_robustK0, 0.5, _robustWeightFunction == RobustWeightFunction::IGG3 ? _robustK1 : 100.0, 0.1, 0.5, "%.2f");
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Standardized residual up to which measurements are treated as nominal");
+        if (_robustWeightFunction == RobustWeightFunction::IGG3)
+        {
+            ImGui::SetNextItemWidth(itemWidth);
+            changed |= ImGui::InputDoubleL(fmt::format("k1##{}", id).c_str(), &_robustK1, _robustK0, 100.0, 0.1, 0.5, "%.2f");
+            ImGui::SameLine();
+            gui::widgets::HelpMarker("Standardized residual above which measurements are rejected");
+        }
+        ImGui::Unindent();
+    }
+    if (_estimatorType == EstimatorType::KalmanFilter) { ImGui::BeginDisabled(); }
+    changed |= _raim.ShowGuiWidgets(id, itemWidth);
+    if (_estimatorType == EstimatorType::KalmanFilter) { ImGui::EndDisabled(); }
+    if (_estimatorType == EstimatorType::LeastSquares) { ImGui::EndDisabled(); }
+
     changed |= _obsEstimator.ShowGuiWidgets(id, itemWidth);
 
     if (_estimatorType == EstimatorType::KalmanFilter)
@@ -62,7 +91,8 @@ void Algorithm::reset()
 
 std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<const GnssObs>& gnssObs,
                                                         const std::vector<const GnssNavInfo*>& gnssNavInfos,
-                                                        const std::string& nameId)
+                                                        const std::string& nameId,
+                                                        const SatelliteEpochCache* satelliteCache)
 {
     _receiver[Rover].gnssObs = gnssObs;
 
@@ -74,13 +104,21 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
     LOG_DATA("{}: [{}] Calculating SPP", nameId, _receiver[Rover].gnssObs->insTime.toYMDHMS(GPST));
 
     // Collection of all connected Ionospheric Corrections
-    IonosphericCorrections ionosphericCorrections(gnssNavInfos);
+    _ionosphericCorrections.assign(gnssNavInfos);
 
     double dt = _lastUpdate.empty() ? 0.0 : static_cast<double>((_receiver[Rover].gnssObs->insTime - _lastUpdate).count());
     LOG_DATA("{}: dt = {}s", nameId, dt);
     _lastUpdate = _receiver[Rover].gnssObs->insTime;
 
-    auto sppSol = std::make_shared<SppSolution>();
+    if (_sppSolution.use_count() == 1) // Nobody holds the solution of the last epoch anymore, so its memory can be reused
+    {
+        _sppSolution->reset();
+    }
+    else
+    {
+        _sppSolution = std::make_shared<SppSolution>();
+    }
+    auto sppSol = _sppSolution;
     sppSol->insTime = _receiver[Rover].gnssObs->insTime;
 
     if (_estimatorType == EstimatorType::KalmanFilter && _kalmanFilter.isInitialized())
@@ -92,6 +130,11 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
     constexpr size_t N_ITER_MAX_LSQ = 10;
     size_t nIter = _estimatorType == EstimatorType::KalmanFilter && _kalmanFilter.isInitialized() ? 1 : N_ITER_MAX_LSQ;
     Eigen::Vector3d e_oldPos = _receiver[Rover].e_pos;
+
+    // Robust estimation and fault exclusion are done once on the converged least squares problem and kept for the remaining iterations
+    bool robustStageDone = false;
+    std::vector<Meas::MeasKeyTypes> excludedMeas;
+    std::unordered_map<Meas::MeasKeyTypes, double> robustWeightFactors;
     for (size_t iteration = 0; iteration < nIter; iteration++)
     {
         LOG_DATA("{}: [{}] iteration {}/{}", nameId, _receiver[Rover].gnssObs->insTime.toYMDHMS(GPST), iteration + 1, nIter);
@@ -112,7 +155,8 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
                      SatelliteSystem::fromEnum(static_cast<SatelliteSystem::Enum>(i)), _receiver[Rover].recvClk.sysTimeDiffDrift.at(i).value);
         }
 
-        auto observations = _obsFilter.selectObservationsForCalculation(_receiver, gnssNavInfos, nameId, e_oldPos.isZero());
+        _epochArena.reset(); // Observations of the last iteration are out of scope
+        auto observations = _obsFilter.selectObservationsForCalculation(_receiver, gnssNavInfos, nameId, e_oldPos.isZero(), &_epochArena, satelliteCache);
         if (observations.signals.empty())
         {
             LOG_ERROR("{}: [{}] SPP cannot calculate position because no valid observations. Try changing filter settings or reposition your antenna.",
@@ -142,16 +186,30 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
 
         updateInterFrequencyBiases(observations, nameId);
 
-        _obsEstimator.calcObservationEstimates(observations, _receiver, ionosphericCorrections, nameId, ObservationEstimator::NoDifference);
+        _obsEstimator.calcObservationEstimates(observations, _receiver, _ionosphericCorrections, nameId, ObservationEstimator::NoDifference);
 
-        auto stateKeys = determineStateKeys(observations.systems, observations.nObservables[GnssObs::Doppler], nameId);
-        auto measKeys = determineMeasKeys(observations, sppSol->nMeasPsr, sppSol->nMeasDopp, nameId);
+        auto& stateKeys = _stateKeys;
+        auto& measKeys = _measKeys;
+        determineStateKeys(stateKeys, observations.systems, observations.nObservables[GnssObs::Doppler], nameId);
+        determineMeasKeys(measKeys, observations, sppSol->nMeasPsr, sppSol->nMeasDopp, nameId);
 
         sppSol->nParam = stateKeys.size();
 
-        auto H = calcMatrixH(stateKeys, measKeys, observations, nameId);
-        auto R = calcMatrixR(measKeys, observations, nameId);
-        auto dz = calcMeasInnovation(measKeys, observations, nameId);
+        auto& H = _H;
+        auto& R = _R;
+        auto& dz = _dz;
+        calcMatrixH(H, stateKeys, measKeys, observations, nameId);
+        calcMatrixR(R, measKeys, observations, nameId);
+        calcMeasInnovation(dz, measKeys, observations, nameId);
+
+        std::vector<Meas::MeasKeyTypes> excluded;
+        std::copy_if(excludedMeas.begin(), excludedMeas.end(), std::back_inserter(excluded), [&](const auto& key) { return dz.hasRow(key); });
+        if (!excluded.empty())
+        {
+            H.removeRows(excluded);
+            R.removeRowsCols(excluded, excluded);
+            dz.removeRows(excluded);
+        }
 
         if (_estimatorType == EstimatorType::KalmanFilter && _kalmanFilter.isInitialized())
         {
@@ -177,16 +235,32 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
 
         if (_estimatorType != EstimatorType::KalmanFilter || !_kalmanFilter.isInitialized())
         {
-            KeyedLeastSquaresResult<double, States::StateKeyTypes> lsq;
+            auto& lsq = _lsq;
             if (_estimatorType == EstimatorType::LeastSquares)
             {
-                lsq = solveLinearLeastSquaresUncertainties(H, dz);
+                solveLinearLeastSquaresUncertainties(lsq, _lsqWorkspace, H, dz);
             }
             else /* if (_estimatorType == EstimatorType::WeightedLeastSquares) */
             {
-                auto W = KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>(Eigen::MatrixXd(R(all, all).diagonal().cwiseInverse().asDiagonal()), R.colKeys(), R.rowKeys());
+                auto& W = _W;
+                W.setRowKeys(R.colKeys());
+                W.setColKeys(R.rowKeys());
+                W(all, all) = R(all, all).diagonal().cwiseInverse().asDiagonal();
+                for (const auto& [key, factor] : robustWeightFactors)
+                {
+                    if (W.hasRow(key)) { W(key, key) *= factor; }
+                }
                 LOG_DATA("{}: W =\n{}", nameId, W);
-                lsq = solveWeightedLinearLeastSquaresUncertainties(H, W, dz);
+                solveWeightedLinearLeastSquaresUncertainties(lsq, _lsqWorkspace, H, W, dz);
+
+                if (!robustStageDone && (_robustWeightFunction != RobustWeightFunction::None || _raim.isEnabled())
+                    && (lsq.solution(all).norm() < 1e-4 || iteration == nIter - 1))
+                {
+                    robustStageDone = true;
+                    lsq = solveRobustLeastSquares(H, R, dz, excludedMeas, robustWeightFactors, *sppSol, nameId);
+                    // Linearize again at the robust solution
+                    if (lsq.solution(all).norm() >= 1e-4) { nIter = std::max(nIter, iteration + 1 + N_ITER_MAX_LSQ); }
+                }
             }
             LOG_DATA("{}: LSQ sol (dx) =\n{}", nameId, lsq.solution.transposed());
             LOG_DATA("{}: LSQ var =\n{}", nameId, lsq.variance.transposed());
@@ -254,6 +328,10 @@ std::shared_ptr<SppSolution> Algorithm::calcSppSolution(const std::shared_ptr<co
         }
         else // if (_estimatorType == EstimatorType::KalmanFilter)
         {
+            if (_robustWeightFunction != RobustWeightFunction::None)
+            {
+                sppSol->nMeasDownWeighted = downWeightKalmanFilterMeasurements(R, H, dz, nameId);
+            }
             _kalmanFilter.update(measKeys, H, R, dz, nameId);
 
             if (double posDiff = (_kalmanFilter.getState()(States::Pos) - _receiver[Rover].e_pos).norm();
@@ -360,7 +438,7 @@ bool Algorithm::canEstimateInterFrequencyBias() const
     return false;
 }
 
-void Algorithm::updateInterSystemTimeDifferences(const std::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId)
+void Algorithm::updateInterSystemTimeDifferences(const std::pmr::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId)
 {
     SatelliteSystem oldRefSys = _receiver[Rover].recvClk.referenceTimeSatelliteSystem;
     if (_receiver[Rover].recvClk.referenceTimeSatelliteSystem == SatSys_None)
@@ -444,11 +522,12 @@ void Algorithm::updateInterFrequencyBiases(const Observations& observations, [[m
             return f == Freq_None || Frequency_(freq) < f;
         };
 
-        std::set<Frequency> observedFrequencies;
-        for (const auto& obs : observations.signals) { observedFrequencies.insert(obs.first.freq()); }
+        Frequency_ observedFrequencies = Freq_None;
+        for (const auto& obs : observations.signals) { observedFrequencies = observedFrequencies | Frequency_(obs.first.freq()); }
 
-        for (const auto& freq : observedFrequencies)
+        for (const auto& freq : Frequency::GetAll())
         {
+            if ((observedFrequencies & Frequency_(freq)) == Freq_None) { continue; }
             if (!isFirstFrequency(freq, _obsFilter.getFrequencyFilter()) && !_receiver[Rover].interFrequencyBias.contains(freq))
             {
                 LOG_TRACE("{}: Estimating Inter-Frequency bias for {}", nameId, freq);
@@ -459,16 +538,17 @@ void Algorithm::updateInterFrequencyBiases(const Observations& observations, [[m
     }
 }
 
-std::vector<States::StateKeyTypes> Algorithm::determineStateKeys(const std::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas,
-                                                                 [[maybe_unused]] const std::string& nameId) const
+void Algorithm::determineStateKeys(std::vector<States::StateKeyTypes>& stateKeys, const std::pmr::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas,
+                                   [[maybe_unused]] const std::string& nameId) const
 {
     if (_estimatorType == EstimatorType::KalmanFilter && _kalmanFilter.isInitialized())
     {
         LOG_DATA("{}: stateKeys = [{}]", nameId, joinToString(_kalmanFilter.getStateKeys()));
-        return _kalmanFilter.getStateKeys();
+        stateKeys = _kalmanFilter.getStateKeys();
+        return;
     }
 
-    std::vector<States::StateKeyTypes> stateKeys = States::Pos;
+    stateKeys = States::Pos;
     stateKeys.reserve(stateKeys.size() + 1
                       + canCalculateVelocity(nDoppMeas) * (States::Vel.size() + 1)
                       + (usedSatSystems.size() - 1) * (1 + canCalculateVelocity(nDoppMeas)));
@@ -496,12 +576,12 @@ std::vector<States::StateKeyTypes> Algorithm::determineStateKeys(const std::set<
     }
 
     LOG_DATA("{}: stateKeys = [{}]", nameId, joinToString(stateKeys));
-    return stateKeys;
 }
 
-std::vector<Meas::MeasKeyTypes> Algorithm::determineMeasKeys(const Observations& observations, size_t nPsrMeas, size_t nDoppMeas, [[maybe_unused]] const std::string& nameId) const
+void Algorithm::determineMeasKeys(std::vector<Meas::MeasKeyTypes>& measKeys, const Observations& observations, size_t nPsrMeas, size_t nDoppMeas,
+                                  [[maybe_unused]] const std::string& nameId) const
 {
-    std::vector<Meas::MeasKeyTypes> measKeys;
+    measKeys.clear();
     measKeys.reserve(nPsrMeas + nDoppMeas);
 
     if (_obsFilter.isObsTypeUsed(GnssObs::Pseudorange))
@@ -526,17 +606,17 @@ std::vector<Meas::MeasKeyTypes> Algorithm::determineMeasKeys(const Observations&
     }
 
     LOG_DATA("{}: measKeys = [{}]", nameId, joinToString(measKeys));
-    return measKeys;
 }
 
-KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes> Algorithm::calcMatrixH(const std::vector<States::StateKeyTypes>& stateKeys,
-                                                                                const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                                const Observations& observations,
-                                                                                const std::string& nameId) const
+void Algorithm::calcMatrixH(KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                            const std::vector<States::StateKeyTypes>& stateKeys,
+                            const std::vector<Meas::MeasKeyTypes>& measKeys,
+                            const Observations& observations,
+                            const std::string& nameId) const
 {
-    KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes> H(Eigen::MatrixXd::Zero(static_cast<int>(measKeys.size()),
-                                                                                     static_cast<int>(stateKeys.size())),
-                                                               measKeys, stateKeys);
+    H.setRowKeys(measKeys);
+    H.setColKeys(stateKeys);
+    H(all, all).setZero();
 
     for (const auto& [satSigId, signalObs] : observations.signals)
     {
@@ -577,17 +657,16 @@ KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes> Algorithm::calcMatrixH(
     }
 
     LOG_DATA("{}: H =\n{}", nameId, H);
-
-    return H;
 }
 
-KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> Algorithm::calcMatrixR(const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                             const Observations& observations,
-                                                                             const std::string& nameId)
+void Algorithm::calcMatrixR(KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                            const std::vector<Meas::MeasKeyTypes>& measKeys,
+                            const Observations& observations,
+                            const std::string& nameId)
 {
-    KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> R(Eigen::MatrixXd::Zero(static_cast<int>(measKeys.size()),
-                                                                                  static_cast<int>(measKeys.size())),
-                                                            measKeys);
+    R.setRowKeys(measKeys);
+    R.setColKeys(measKeys);
+    R(all, all).setZero();
 
     for (const auto& [satSigId, signalObs] : observations.signals)
     {
@@ -610,15 +689,15 @@ KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> Algorithm::calcMatrixR(con
     }
 
     LOG_DATA("{}: R =\n{}", nameId, R);
-
-    return R;
 }
 
-KeyedVectorXd<Meas::MeasKeyTypes> Algorithm::calcMeasInnovation(const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                const Observations& observations,
-                                                                const std::string& nameId)
+void Algorithm::calcMeasInnovation(KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                   const std::vector<Meas::MeasKeyTypes>& measKeys,
+                                   const Observations& observations,
+                                   const std::string& nameId)
 {
-    KeyedVectorXd<Meas::MeasKeyTypes> dz(Eigen::VectorXd::Zero(static_cast<int>(measKeys.size())), measKeys);
+    dz.setRowKeys(measKeys);
+    dz(all).setZero();
 
     for (const auto& [satSigId, signalObs] : observations.signals)
     {
@@ -641,8 +720,108 @@ KeyedVectorXd<Meas::MeasKeyTypes> Algorithm::calcMeasInnovation(const std::vecto
     }
 
     LOG_DATA("{}: dz =\n{}", nameId, dz.transposed());
+}
+
+KeyedLeastSquaresResult<double, States::StateKeyTypes> Algorithm::solveRobustLeastSquares(const KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                                                                                       const KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                                                                                       const KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                                                                       std::vector<Meas::MeasKeyTypes>& excludedMeas,
+                                                                                       std::unordered_map<Meas::MeasKeyTypes, double>& weightFactors,
+                                                                                       SppSolution& sppSol,
+                                                                                       [[maybe_unused]] const std::string& nameId) const
+{
+    auto nStates = static_cast<int>(H.cols());
+    KeyedLeastSquaresResult<double, States::StateKeyTypes> lsq{
+        .solution = KeyedVectorXd<States::StateKeyTypes>(Eigen::VectorXd::Zero(nStates), H.colKeys()),
+        .variance = KeyedMatrixXd<States::StateKeyTypes, States::StateKeyTypes>(Eigen::MatrixXd::Zero(nStates, nStates), H.colKeys(), H.colKeys()),
+    };
+
+    Eigen::VectorXd w = R(all, all).diagonal().cwiseInverse();
 
-    return dz;
+    if (_robustWeightFunction != RobustWeightFunction::None)
+    {
+        auto robust = solveRobustWeightedLinearLeastSquaresUncertainties(H(all, all), w, dz(all), _robustWeightFunction, _robustK0, _robustK1);
+        LOG_DATA("{}: [{}] Robust weight factors after {} iterations: {}", nameId, _receiver[Rover].gnssObs->insTime.toYMDHMS(GPST),
+                 robust.iterations, robust.weightFactors.transpose());
+        lsq.solution(all) = robust.solution;
+        lsq.variance(all, all) = robust.variance;
+        for (Eigen::Index i = 0; i < robust.weightFactors.rows(); i++)
+        {
+            const auto& key = H.rowKeys().at(static_cast<size_t>(i));
+            if (robust.weightFactors(i) == 0.0) { excludedMeas.push_back(key); }
+            else if (robust.weightFactors(i) < 1.0) { weightFactors[key] = robust.weightFactors(i); }
+        }
+        sppSol.nMeasDownWeighted = weightFactors.size();
+        w = w.cwiseProduct(robust.weightFactors);
+    }
+
+    if (_raim.isEnabled())
+    {
+        // Measurements rejected by the robust estimation are not part of the consistency check
+        std::vector<Eigen::Index> rows;
+        rows.reserve(static_cast<size_t>(w.rows()));
+        for (Eigen::Index i = 0; i < w.rows(); i++)
+        {
+            if (w(i) > 0.0) { rows.push_back(i); }
+        }
+
+        Eigen::Matrix3d n_R_e = trafo::n_Quat_e(_receiver[Rover].lla_pos(0), _receiver[Rover].lla_pos(1)).toRotationMatrix();
+        auto raim = _raim.checkAndExclude(H(all, all)(rows, Eigen::all), w(rows), dz(all)(rows), n_R_e);
+
+        if (raim.dof >= 1)
+        {
+            sppSol.raimTestStatistic = raim.testStatistic;
+            sppSol.raimThreshold = raim.threshold;
+            sppSol.HPL = raim.HPL;
+            sppSol.VPL = raim.VPL;
+        }
+        if (raim.faultDetected)
+        {
+            std::string msg;
+            if (raim.excluded.empty())
+            {
+                msg = fmt::format("RAIM detected a fault, which could not be excluded (test statistic {:.1f} > {:.1f})", raim.testStatistic, raim.threshold);
+            }
+            else
+            {
+                std::vector<Meas::MeasKeyTypes> excluded;
+                for (const auto& i : raim.excluded) { excluded.push_back(H.rowKeys().at(static_cast<size_t>(rows.at(static_cast<size_t>(i))))); }
+                msg = fmt::format("RAIM excluded [{}]", joinToString(excluded));
+                std::copy(excluded.begin(), excluded.end(), std::back_inserter(excludedMeas));
+            }
+            LOG_DEBUG("{}: [{}] {}", nameId, _receiver[Rover].gnssObs->insTime.toYMDHMS(GPST), msg);
+            sppSol.addEvent(msg);
+        }
+
+        lsq.solution(all) = raim.solution;
+        lsq.variance(all, all) = raim.dof >= 1 ? Eigen::MatrixXd(raim.cofactor * (raim.testStatistic / static_cast<double>(raim.dof))) : raim.cofactor;
+    }
+    sppSol.nMeasExcluded = excludedMeas.size();
+
+    LOG_DATA("{}: Robust LSQ sol (dx) =\n{}", nameId, lsq.solution.transposed());
+    return lsq;
+}
+
+size_t Algorithm::downWeightKalmanFilterMeasurements(KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                                                     const KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                                                     const KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                                     [[maybe_unused]] const std::string& nameId) const
+{
+    const auto& P = _kalmanFilter.getErrorCovarianceMatrix();
+    Eigen::MatrixXd S = H(all, all) * P(all, all) * H(all, all).transpose() + R(all, all);
+
+    size_t nDownWeighted = 0;
+    for (Eigen::Index i = 0; i < dz.rows(); i++)
+    {
+        double factor = robustWeightFactor(_robustWeightFunction, dz(all)(i) / std::sqrt(S(i, i)), _robustK0, _robustK1);
+        if (factor < 1.0)
+        {
+            LOG_DATA("{}: Down-weighting {} with factor {}", nameId, dz.rowKeys().at(static_cast<size_t>(i)), factor);
+            R(all, all)(i, i) /= std::max(factor, 1e-12);
+            nDownWeighted++;
+        }
+    }
+    return nDownWeighted;
 }
 
 void Algorithm::assignLeastSquaresResult(const KeyedVectorXd<States::StateKeyTypes>& state,
@@ -814,6 +993,10 @@ void to_json(json& j, const Algorithm& obj)
         { "estimatorType", obj._estimatorType },
         { "kalmanFilter", obj._kalmanFilter },
         { "estimateInterFrequencyBiases", obj._estimateInterFreqBiases },
+        { "robustWeightFunction", obj._robustWeightFunction },
+        { "robustK0", obj._robustK0 },
+        { "robustK1", obj._robustK1 },
+        { "raim", obj._raim },
     };
 }
 /// @brief Converts the provided json object into a node object
@@ -826,6 +1009,10 @@ void from_json(const json& j, Algorithm& obj)
     if (j.contains("estimatorType")) { j.at("estimatorType").get_to(obj._estimatorType); }
     if (j.contains("kalmanFilter")) { j.at("kalmanFilter").get_to(obj._kalmanFilter); }
     if (j.contains("estimateInterFrequencyBiases")) { j.at("estimateInterFrequencyBiases").get_to(obj._estimateInterFreqBiases); }
+    if (j.contains("robustWeightFunction")) { j.at("robustWeightFunction").get_to(obj._robustWeightFunction); }
+    if (j.contains("robustK0")) { j.at("robustK0").get_to(obj._robustK0); }
+    if (j.contains("robustK1")) { j.at("robustK1").get_to(obj._robustK1); }
+    if (j.contains("raim")) { j.at("raim").get_to(obj._raim); }
 }
 
 } // namespace SPP
@@ -14,18 +14,27 @@
 #pragma once
 
 #include <fmt/format.h>
+#include <memory_resource>
 #include <set>
+#include <unordered_map>
 
+#include "Navigation/Atmosphere/Ionosphere/IonosphericCorrections.hpp"
 #include "Navigation/GNSS/Positioning/Observation.hpp"
 #include "Navigation/GNSS/Positioning/ObservationEstimator.hpp"
 #include "Navigation/GNSS/Positioning/ObservationFilter.hpp"
+#include "Navigation/GNSS/Positioning/RAIM.hpp"
 #include "Navigation/GNSS/Positioning/Receiver.hpp"
+#include "Navigation/GNSS/Positioning/SatelliteEpochCache.hpp"
 #include "Navigation/GNSS/Positioning/SPP/Keys.hpp"
 #include "Navigation/GNSS/Positioning/SPP/KalmanFilter.hpp"
+#include "Navigation/Math/KeyedLeastSquares.hpp"
+#include "Navigation/Math/RobustEstimation.hpp"
 
 #include "NodeData/GNSS/GnssObs.hpp"
 #include "NodeData/GNSS/SppSolution.hpp"
 
+#include "util/Memory/EpochArena.hpp"
+
 namespace NAV
 {
 
@@ -65,10 +74,12 @@ class Algorithm
     /// @param[in] gnssObs GNSS observation
     /// @param[in] gnssNavInfos Collection of GNSS Nav information
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @param[in] satelliteCache Satellite states of the epoch shared with other receivers (optional)
     /// @return The SPP Solution if it could be calculated, otherwise nullptr
     std::shared_ptr<SppSolution> calcSppSolution(const std::shared_ptr<const GnssObs>& gnssObs,
                                                  const std::vector<const GnssNavInfo*>& gnssNavInfos,
-                                                 const std::string& nameId);
+                                                 const std::string& nameId,
+                                                 const SatelliteEpochCache* satelliteCache = nullptr);
 
     /// Observation Filter
     ObservationFilter _obsFilter{ ReceiverType_COUNT,
@@ -92,54 +103,87 @@ class Algorithm
     /// @param[in] usedSatSystems Used Satellite systems this epoch
     /// @param[in] nDoppMeas Amount of Doppler measurements
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    void updateInterSystemTimeDifferences(const std::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId);
+    void updateInterSystemTimeDifferences(const std::pmr::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId);
 
     /// @brief Updates the inter frequency biases
     /// @param[in] observations List of GNSS observation data used for the calculation
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
     void updateInterFrequencyBiases(const Observations& observations, const std::string& nameId);
 
-    /// @brief Returns a list of state keys
+    /// @brief Determines the list of state keys
+    /// @param[out] stateKeys State keys (filled in place to reuse the memory)
     /// @param[in] usedSatSystems Used Satellite systems this epoch
     /// @param[in] nDoppMeas Amount of Doppler measurements
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    std::vector<States::StateKeyTypes> determineStateKeys(const std::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId) const;
+    void determineStateKeys(std::vector<States::StateKeyTypes>& stateKeys, const std::pmr::set<SatelliteSystem>& usedSatSystems, size_t nDoppMeas, const std::string& nameId) const;
 
-    /// @brief Returns a list of measurement keys
+    /// @brief Determines the list of measurement keys
+    /// @param[out] measKeys Measurement keys (filled in place to reuse the memory)
     /// @param[in] observations List of GNSS observation data used for the calculation
     /// @param[in] nPsrMeas Amount of pseudo-range measurements
     /// @param[in] nDoppMeas Amount of doppler measurements
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    std::vector<Meas::MeasKeyTypes> determineMeasKeys(const Observations& observations, size_t nPsrMeas, size_t nDoppMeas, const std::string& nameId) const;
+    void determineMeasKeys(std::vector<Meas::MeasKeyTypes>& measKeys, const Observations& observations, size_t nPsrMeas, size_t nDoppMeas, const std::string& nameId) const;
 
     /// @brief Calculates the measurement sensitivity matrix 𝐇
+    /// @param[out] H The 𝐇 matrix (only reallocated if the keys changed)
     /// @param[in] stateKeys State Keys
     /// @param[in] measKeys Measurement Keys
     /// @param[in] observations List of GNSS observation data used for the calculation
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    /// @return The 𝐇 matrix
-    [[nodiscard]] KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes> calcMatrixH(const std::vector<States::StateKeyTypes>& stateKeys,
-                                                                                       const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                                       const Observations& observations,
-                                                                                       const std::string& nameId) const;
+    void calcMatrixH(KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                     const std::vector<States::StateKeyTypes>& stateKeys,
+                     const std::vector<Meas::MeasKeyTypes>& measKeys,
+                     const Observations& observations,
+                     const std::string& nameId) const;
 
     /// @brief Calculates the measurement noise covariance matrix 𝐑
+    /// @param[out] R The 𝐑 matrix (only reallocated if the keys changed)
     /// @param[in] measKeys Measurement Keys
     /// @param[in] observations List of GNSS observation data used for the calculation
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    /// @return The 𝐑 matrix
-    [[nodiscard]] static KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> calcMatrixR(const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                                           const Observations& observations,
-                                                                                           const std::string& nameId);
+    static void calcMatrixR(KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                            const std::vector<Meas::MeasKeyTypes>& measKeys,
+                            const Observations& observations,
+                            const std::string& nameId);
 
     /// @brief Calculates the measurement innovation vector 𝜹𝐳
+    /// @param[out] dz The measurement innovation 𝜹𝐳 vector (only reallocated if the keys changed)
     /// @param[in] measKeys Measurement Keys
     /// @param[in] observations List of GNSS observation data used for the calculation
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
-    /// @return The measurement innovation 𝜹𝐳 vector
-    [[nodiscard]] static KeyedVectorXd<Meas::MeasKeyTypes> calcMeasInnovation(const std::vector<Meas::MeasKeyTypes>& measKeys,
-                                                                              const Observations& observations,
-                                                                              const std::string& nameId);
+    static void calcMeasInnovation(KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                   const std::vector<Meas::MeasKeyTypes>& measKeys,
+                                   const Observations& observations,
+                                   const std::string& nameId);
+
+    /// @brief Down-weights and excludes inconsistent measurements of the converged weighted least squares problem
+    /// @param[in] H Measurement sensitivity matrix 𝐇
+    /// @param[in] R Measurement noise covariance matrix 𝐑
+    /// @param[in] dz Measurement innovation 𝜹𝐳
+    /// @param[in, out] excludedMeas Measurements excluded in this epoch
+    /// @param[in, out] weightFactors Factors the weights of the measurements are multiplied with in this epoch
+    /// @param[in, out] sppSol SPP solution to fill the integrity information into
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @return Least squares solution and variance without the excluded measurements
+    [[nodiscard]] KeyedLeastSquaresResult<double, States::StateKeyTypes> solveRobustLeastSquares(const KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                                                                                                const KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                                                                                                const KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                                                                                std::vector<Meas::MeasKeyTypes>& excludedMeas,
+                                                                                                std::unordered_map<Meas::MeasKeyTypes, double>& weightFactors,
+                                                                                                SppSolution& sppSol,
+                                                                                                const std::string& nameId) const;
+
+    /// @brief Down-weights measurements with large standardized innovations by inflating their noise in the Kalman filter update
+    /// @param[in, out] R Measurement noise covariance matrix 𝐑
+    /// @param[in] H Measurement sensitivity matrix 𝐇
+    /// @param[in] dz Measurement innovation 𝜹𝐳
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @return Amount of down-weighted measurements
+    size_t downWeightKalmanFilterMeasurements(KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes>& R,
+                                              const KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes>& H,
+                                              const KeyedVectorXd<Meas::MeasKeyTypes>& dz,
+                                              const std::string& nameId) const;
 
     /// @brief Assigns the result to the receiver variable
     /// @param[in] state Delta state
@@ -171,12 +215,40 @@ class Algorithm
     /// Estimate Inter-frequency biases
     bool _estimateInterFreqBiases = true;
 
+    /// Weight function of the robust estimation (applied to the converged least squares solution or the Kalman filter innovations)
+    RobustWeightFunction _robustWeightFunction = RobustWeightFunction::None;
+    /// Standardized residual up to which measurements are treated as nominal
+    double _robustK0 = 1.5;
+    /// Standardized residual above which measurements are rejected (IGG-III only)
+    double _robustK1 = 3.0;
+
+    /// Fault detection and exclusion of the least squares solution
+    RAIM _raim;
+
     /// SPP specific Kalman filter
     SPP::KalmanFilter _kalmanFilter;
 
     /// Time of last update
     InsTime _lastUpdate;
 
+    /// Memory for the observations of an iteration, which is reused in every iteration and epoch
+    EpochArena _epochArena;
+
+    // The least squares problem is kept between iterations and epochs, so that its memory is only reallocated if the observed signals change
+
+    IonosphericCorrections _ionosphericCorrections;              ///< Collection of all connected Ionospheric Corrections
+    std::vector<States::StateKeyTypes> _stateKeys;               ///< State keys of the current iteration
+    std::vector<Meas::MeasKeyTypes> _measKeys;                   ///< Measurement keys of the current iteration
+    KeyedMatrixXd<Meas::MeasKeyTypes, States::StateKeyTypes> _H; ///< Measurement sensitivity matrix 𝐇 of the current iteration
+    KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> _R;    ///< Measurement noise covariance matrix 𝐑 of the current iteration
+    KeyedVectorXd<Meas::MeasKeyTypes> _dz;                       ///< Measurement innovation 𝜹𝐳 of the current iteration
+    KeyedMatrixXd<Meas::MeasKeyTypes, Meas::MeasKeyTypes> _W;    ///< Weight matrix 𝐖 of the current iteration
+    KeyedLeastSquaresResult<double, States::StateKeyTypes> _lsq; ///< Least squares solution of the current iteration
+    LeastSquaresWorkspace<double> _lsqWorkspace;                 ///< Intermediate results of the least squares solution
+
+    /// Solution of the last epoch, which is reused when no one else holds it anymore
+    std::shared_ptr<SppSolution> _sppSolution;
+
     Eigen::Matrix3d _e_lastPositionCovarianceMatrix; ///< Last position covariance matrix
     Eigen::Matrix3d _e_lastVelocityCovarianceMatrix; ///< Last velocity covariance matrix
 
@@ -227,7 +227,7 @@ void KalmanFilter::update(const std::vector<Meas::MeasKeyTypes>& measKeys,
     _kalmanFilter.correctWithMeasurementInnovation();
 }
 
-SatelliteSystem KalmanFilter::updateInterSystemTimeDifferences(const std::set<SatelliteSystem>& usedSatSystems,
+SatelliteSystem KalmanFilter::updateInterSystemTimeDifferences(const std::pmr::set<SatelliteSystem>& usedSatSystems,
                                                                SatelliteSystem oldRefSys,
                                                                SatelliteSystem newRefSys,
                                                                [[maybe_unused]] const std::string& nameId)
@@ -70,7 +70,7 @@ class KalmanFilter // NOLINT(clang-analyzer-optin.performance.Padding)
     /// @param[in] newRefSys New Satellite time reference system
     /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
     /// @return The reference system which was selected
-    SatelliteSystem updateInterSystemTimeDifferences(const std::set<SatelliteSystem>& usedSatSystems,
+    SatelliteSystem updateInterSystemTimeDifferences(const std::pmr::set<SatelliteSystem>& usedSatSystems,
                                                      SatelliteSystem oldRefSys,
                                                      SatelliteSystem newRefSys,
                                                      const std::string& nameId);
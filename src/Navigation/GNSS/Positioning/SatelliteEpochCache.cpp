@@ -0,0 +1,99 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "SatelliteEpochCache.hpp"
+
+#include <chrono>
+#include <cmath>
+
+#include "Navigation/Constants.hpp"
+
+namespace NAV
+{
+
+void SatelliteEpochCache::reset()
+{
+    _satellites.clear();
+    _signals.clear();
+}
+
+void SatelliteEpochCache::add(const std::shared_ptr<const SatNavData>& satNavData, const SatSigId& satSigId, const InsTime& recvTime, double pseudorange)
+{
+    if (_signals.contains(satSigId)) { return; }
+
+    // Clock rates are differenced, because the clock models do not report them consistently (e.g. GLONASS drift sign)
+    constexpr double DT = 1e-2;
+    InsTime signalTime = recvTime - std::chrono::duration<double>(pseudorange / InsConst<>::C);
+    auto satClk = satNavData->calcClockCorrections(recvTime, pseudorange, satSigId.freq());
+    auto satClkDT = satNavData->calcClockCorrections(recvTime, pseudorange - DT * InsConst<>::C, satSigId.freq());
+
+    auto transmitOffset = static_cast<double>((satClk.transmitTime - signalTime).count());
+    auto transmitOffsetDT = static_cast<double>((satClkDT.transmitTime - (signalTime + std::chrono::duration<double>(DT))).count());
+    _signals.emplace(satSigId, SignalState{ .signalTime = signalTime,
+                                            .satClk = satClk,
+                                            .biasRate = (satClkDT.bias - satClk.bias) / DT,
+                                            .transmitOffset = transmitOffset,
+                                            .transmitOffsetRate = (transmitOffsetDT - transmitOffset) / DT });
+
+    auto satId = satSigId.toSatId();
+    if (auto sat = _satellites.find(satId);
+        sat != _satellites.end() && sat->second.satNavData == satNavData)
+    {
+        return;
+    }
+    _satellites.insert_or_assign(satId, SatelliteState{ .satNavData = satNavData,
+                                                        .transmitTime = satClk.transmitTime,
+                                                        .posVelAccel = satNavData->calcSatellitePosVelAccel(satClk.transmitTime) });
+}
+
+void SatelliteEpochCache::add(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos)
+{
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.pseudorange || _signals.contains(obsData.satSigId)) { continue; }
+
+        for (const auto& gnssNavInfo : gnssNavInfos)
+        {
+            auto satNavData = gnssNavInfo->searchNavigationData(obsData.satSigId.toSatId(), gnssObs.insTime);
+            if (satNavData && satNavData->isHealthy())
+            {
+                add(satNavData, obsData.satSigId, gnssObs.insTime, obsData.pseudorange->value);
+                break;
+            }
+        }
+    }
+}
+
+std::optional<SatelliteEpochCache::State> SatelliteEpochCache::get(const SatNavData* satNavData, const SatSigId& satSigId, const InsTime& recvTime, double pseudorange) const
+{
+    auto sig = _signals.find(satSigId);
+    if (sig == _signals.end()) { return std::nullopt; }
+    auto sat = _satellites.find(satSigId.toSatId());
+    if (sat == _satellites.end() || sat->second.satNavData.get() != satNavData) { return std::nullopt; }
+
+    InsTime signalTime = recvTime - std::chrono::duration<double>(pseudorange / InsConst<>::C);
+    auto dt_sig = static_cast<double>((signalTime - sig->second.signalTime).count());
+    if (std::abs(dt_sig) > _maxExtrapolation) { return std::nullopt; }
+
+    const auto& ref = sig->second;
+    State state;
+    state.satClk.bias = ref.satClk.bias + ref.biasRate * dt_sig;
+    state.satClk.drift = ref.satClk.drift;
+    state.satClk.transmitTime = signalTime + std::chrono::duration<double>(ref.transmitOffset + ref.transmitOffsetRate * dt_sig);
+
+    auto dt = static_cast<double>((state.satClk.transmitTime - sat->second.transmitTime).count());
+    if (std::abs(dt) > _maxExtrapolation) { return std::nullopt; }
+
+    const auto& orbit = sat->second.posVelAccel;
+    state.satPosVel.e_pos = orbit.e_pos + orbit.e_vel * dt + 0.5 * orbit.e_accel * dt * dt;
+    state.satPosVel.e_vel = orbit.e_vel + orbit.e_accel * dt;
+
+    return state;
+}
+
+} // namespace NAV
@@ -0,0 +1,107 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SatelliteEpochCache.hpp
+/// @brief Satellite clock and orbit states of an epoch, shared between several receivers
+/// @date 2026-10-18
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Satellite/internal/SatNavData.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+
+namespace NAV
+{
+
+/// @brief Satellite clock and orbit states of an epoch, which are evaluated once and then shared by all receivers observing the epoch
+///
+/// The broadcast orbit and clock models are evaluated once per satellite at the signal reception of the first receiver.
+/// The states for other receivers (or later iterations) differ only by the signal travel time difference, which is
+/// bridged with a Taylor expansion:
+///   - Clock:  dt(τ) = dt₀ + ḋt₀ (τ - τ₀)  (the rates are differenced from the clock model, so every system's sign convention is kept)
+///   - Orbit:  r(t) = r₀ + v₀ Δt + ½ a₀ Δt²,  v(t) = v₀ + a₀ Δt
+///
+/// For a typical network (baselines up to a few thousand km and receiver clock offsets up to a few ms) the extrapolation
+/// interval is below 0.02 s, where the error is below 1 mm, 1e-13 s and 1 mm/s (the broadcast accelerations are only approximations).
+/// @note Filling the cache is not thread-safe, but after filling, the cache can be read by several threads at the same time.
+class SatelliteEpochCache
+{
+  public:
+    /// @brief Satellite state of a signal
+    struct State
+    {
+        Clock::Corrections satClk; ///< Satellite clock corrections
+        Orbit::PosVel satPosVel;   ///< Satellite position and velocity at the transmit time [m, m/s]
+    };
+
+    /// @brief Constructor
+    /// @param[in] maxExtrapolation Maximum time interval the reference states are extrapolated [s]
+    explicit SatelliteEpochCache(double maxExtrapolation = 0.1) : _maxExtrapolation(maxExtrapolation) {}
+
+    /// @brief Removes all states (e.g. at the start of a new epoch)
+    void reset();
+
+    /// @brief Evaluates the reference states for a signal, if it is not in the cache already
+    /// @param[in] satNavData Navigation data of the satellite
+    /// @param[in] satSigId Satellite signal identifier
+    /// @param[in] recvTime Receive time of the signal
+    /// @param[in] pseudorange Pseudorange of the signal [m]
+    void add(const std::shared_ptr<const SatNavData>& satNavData, const SatSigId& satSigId, const InsTime& recvTime, double pseudorange);
+
+    /// @brief Evaluates the reference states for all pseudorange observations of the receiver
+    /// @param[in] gnssObs Observations of the receiver
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information. The first healthy navigation data is used (same as in the observation filter).
+    void add(const GnssObs& gnssObs, const std::vector<const GnssNavInfo*>& gnssNavInfos);
+
+    /// @brief Satellite state for a signal received by any receiver
+    /// @param[in] satNavData Navigation data the state should be calculated with
+    /// @param[in] satSigId Satellite signal identifier
+    /// @param[in] recvTime Receive time of the signal
+    /// @param[in] pseudorange Pseudorange of the signal [m]
+    /// @return The state or nothing if the signal is not cached, the navigation data differs or the extrapolation interval is too large
+    [[nodiscard]] std::optional<State> get(const SatNavData* satNavData, const SatSigId& satSigId, const InsTime& recvTime, double pseudorange) const;
+
+    /// @brief Amount of cached satellites
+    [[nodiscard]] size_t nSatellites() const { return _satellites.size(); }
+    /// @brief Amount of cached signals
+    [[nodiscard]] size_t nSignals() const { return _signals.size(); }
+
+  private:
+    /// @brief Reference orbit state of a satellite
+    struct SatelliteState
+    {
+        std::shared_ptr<const SatNavData> satNavData; ///< Navigation data the state was calculated with
+        InsTime transmitTime;                         ///< Transmit time of the reference state
+        Orbit::PosVelAccel posVelAccel;               ///< Position, velocity and acceleration at the transmit time
+    };
+
+    /// @brief Reference clock state of a signal
+    struct SignalState
+    {
+        InsTime signalTime;          ///< Receive time minus signal travel time (without satellite clock bias)
+        Clock::Corrections satClk;   ///< Satellite clock corrections at the signal time
+        double biasRate{};           ///< Change of the clock bias with the signal time [s/s]
+        double transmitOffset{};     ///< Transmit time minus signal time [s]
+        double transmitOffsetRate{}; ///< Change of the transmit time offset with the signal time [s/s]
+    };
+
+    double _maxExtrapolation; ///< Maximum time interval the reference states are extrapolated [s]
+
+    std::unordered_map<SatId, SatelliteState> _satellites; ///< Reference orbit states
+    std::unordered_map<SatSigId, SignalState> _signals;    ///< Reference clock states
+};
+
+} // namespace NAV
@@ -0,0 +1,361 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Algorithm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include <Eigen/Dense>
+#include <fmt/format.h>
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+namespace TDCP
+{
+
+bool Algorithm::ShowGuiWidgets(const char* id, float itemWidth)
+{
+    bool changed = false;
+
+    changed |= _obsFilter.ShowGuiWidgets<ReceiverType>(id, itemWidth);
+
+    ImGui::SetNextItemWidth(itemWidth);
+    double phaseStdDev = _phaseStdDev * 1e3;
+    if (ImGui::InputDoubleL(fmt::format("Carrier-phase StdDev##{}", id).c_str(), &phaseStdDev, 0.1, 100.0, 0.5, 1.0, "%.1f mm"))
+    {
+        _phaseStdDev = phaseStdDev * 1e-3;
+        changed = true;
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Standard deviation of an undifferenced carrier-phase observation in zenith direction.\n"
+                             "The time-differenced observations are weighted with σ² (1/sin²(elevₖ) + 1/sin²(elevₖ₋₁)).");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Max. time gap##{}", id).c_str(), &_maxTimeGap, 0.0, 60.0, 0.1, 1.0, "%.2f s");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Epochs further apart are not differenced, but the new epoch becomes the reference");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Outlier threshold##{}", id).c_str(), &_outlierThreshold, 1.0, 100.0, 0.5, 1.0, "%.1f σ");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Signals with a residual above this multiple of their standard deviation are excluded one after another, "
+                             "as long as enough redundancy is left");
+
+    changed |= CycleSlipDetectorGui(fmt::format("Cycle-slip detector##{}", id).c_str(), _cycleSlipDetector, itemWidth);
+
+    return changed;
+}
+
+void Algorithm::reset()
+{
+    _reference = Epoch{};
+    _cycleSlipDetector.reset();
+}
+
+void Algorithm::setReferencePosition(const Eigen::Vector3d& e_position)
+{
+    _reference.e_recvPos = e_position;
+    for (auto& [satId, sat] : _reference.satellites)
+    {
+        sat.range = (sat.e_satPos - e_position).norm() + calcSagnacCorrection(e_position, sat.e_satPos);
+    }
+}
+
+Algorithm::SatelliteState Algorithm::calcSatelliteState(const std::shared_ptr<const SatNavData>& satNavData, Frequency freq,
+                                                        const InsTime& recvTime, double pseudorange, const Eigen::Vector3d& e_recvPos)
+{
+    auto satClk = satNavData->calcClockCorrections(recvTime, pseudorange, Frequency::GetL1(freq));
+    Eigen::Vector3d e_satPos = satNavData->calcSatellitePosVel(satClk.transmitTime).e_pos;
+
+    return SatelliteState{ .satNavData = satNavData,
+                           .transmitTime = satClk.transmitTime,
+                           .e_satPos = e_satPos,
+                           .pseudorange = pseudorange,
+                           .clkBias = satClk.bias,
+                           .range = (e_satPos - e_recvPos).norm() + calcSagnacCorrection(e_recvPos, e_satPos) };
+}
+
+Algorithm::Epoch Algorithm::evaluateEpoch(const GnssObs& gnssObs,
+                                          const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                          const Eigen::Vector3d& e_recvPos,
+                                          [[maybe_unused]] const std::string& nameId) const
+{
+    Epoch epoch{ .insTime = gnssObs.insTime, .e_recvPos = e_recvPos, .satellites = {}, .signals = {} };
+
+    Eigen::Vector3d lla_recvPos = trafo::ecef2lla_WGS84(e_recvPos);
+    Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(lla_recvPos(0), lla_recvPos(1));
+
+    std::unordered_set<SatId> unavailableSatellites;
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.carrierPhase || !_obsFilter.isSignalAllowed(obsData.satSigId)) { continue; }
+
+        SatId satId = obsData.satSigId.toSatId();
+        if (unavailableSatellites.contains(satId)) { continue; }
+
+        auto sat = epoch.satellites.find(satId);
+        if (sat == epoch.satellites.end())
+        {
+            // The transmit time needs the signal travel time, so the first pseudorange of the satellite is used for all its signals
+            auto psrData = std::find_if(gnssObs.data.begin(), gnssObs.data.end(), [&](const GnssObs::ObservationData& other) {
+                return other.pseudorange && other.satSigId.toSatId() == satId;
+            });
+            std::shared_ptr<const SatNavData> satNavData = nullptr;
+            for (const auto& gnssNavInfo : gnssNavInfos)
+            {
+                auto satNav = gnssNavInfo->searchNavigationData(satId, gnssObs.insTime);
+                if (satNav && satNav->isHealthy())
+                {
+                    satNavData = satNav;
+                    break;
+                }
+            }
+            if (psrData == gnssObs.data.end() || satNavData == nullptr)
+            {
+                LOG_DATA("{}: [{}] Satellite [{}] skipped, because no pseudorange or navigation data is available", nameId, gnssObs.insTime.toYMDHMS(GPST), satId);
+                unavailableSatellites.insert(satId);
+                continue;
+            }
+            sat = epoch.satellites.emplace(satId, calcSatelliteState(satNavData, obsData.satSigId.freq(),
+                                                                     gnssObs.insTime, psrData->pseudorange->value, e_recvPos))
+                      .first;
+        }
+
+        double satElevation = calcSatElevation(n_Quat_e * e_calcLineOfSightUnitVector(e_recvPos, sat->second.e_satPos));
+        if (!_obsFilter.isAboveMasks(obsData.satSigId, satElevation, obsData.CN0))
+        {
+            LOG_DATA("{}: [{}] Signal [{}] skipped because of the elevation or SNR mask", nameId, gnssObs.insTime.toYMDHMS(GPST), obsData.satSigId);
+            continue;
+        }
+
+        int8_t freqNum = -128;
+        if (satId.satSys == GLO)
+        {
+            if (auto gloSatNavData = std::dynamic_pointer_cast<const GLONASSEphemeris>(sat->second.satNavData))
+            {
+                freqNum = gloSatNavData->frequencyNumber;
+            }
+        }
+        double lambda = InsConst<>::C / obsData.satSigId.freq().getFrequency(freqNum);
+
+        epoch.signals.emplace(obsData.satSigId, SignalState{ .phase = lambda * obsData.carrierPhase->value,
+                                                             .sinElev = std::sin(satElevation),
+                                                             .freqNum = freqNum });
+    }
+
+    return epoch;
+}
+
+std::vector<SatSigId> Algorithm::detectCycleSlips(const GnssObs& gnssObs, const Epoch& epoch)
+{
+    std::vector<CycleSlipDetector::SatelliteObservation> satObs;
+    for (const auto& obsData : gnssObs.data)
+    {
+        auto signal = epoch.signals.find(obsData.satSigId);
+        if (signal == epoch.signals.end()) { continue; }
+
+        SatId satId = obsData.satSigId.toSatId();
+        auto sat = std::find_if(satObs.begin(), satObs.end(), [&](const auto& obs) { return obs.satId == satId; });
+        if (sat == satObs.end())
+        {
+            satObs.push_back(CycleSlipDetector::SatelliteObservation{ .satId = satId, .signals = {}, .freqNum = signal->second.freqNum });
+            sat = std::prev(satObs.end());
+        }
+        sat->signals.push_back(CycleSlipDetector::SatelliteObservation::Signal{ .code = obsData.satSigId.code, .measurement = *obsData.carrierPhase });
+    }
+
+    std::vector<SatSigId> cycleSlips;
+    for (const auto& cycleSlip : _cycleSlipDetector.checkForCycleSlip(gnssObs.insTime, satObs))
+    {
+        std::visit([&](auto&& slip) {
+            using T = std::decay_t<decltype(slip)>;
+            if constexpr (std::is_same_v<T, CycleSlipDetector::CycleSlipDualFrequency>)
+            {
+                cycleSlips.insert(cycleSlips.end(), slip.signals.begin(), slip.signals.end());
+            }
+            else { cycleSlips.push_back(slip.signal); }
+        },
+                   cycleSlip);
+    }
+    return cycleSlips;
+}
+
+std::optional<Algorithm::Result> Algorithm::calcDisplacement(const GnssObs& gnssObs,
+                                                             const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                                             const Eigen::Vector3d& e_approxPosition,
+                                                             const std::string& nameId)
+{
+    auto epoch = evaluateEpoch(gnssObs, gnssNavInfos, e_approxPosition, nameId);
+    auto cycleSlips = detectCycleSlips(gnssObs, epoch);
+
+    double dt = hasReference() ? static_cast<double>((epoch.insTime - _reference.insTime).count()) : 0.0;
+    if (!hasReference() || dt <= 0.0 || dt > _maxTimeGap)
+    {
+        if (hasReference())
+        {
+            LOG_DEBUG("{}: [{}] Time difference of {:.3f}s to the last epoch can not be bridged. Starting with a new reference epoch.",
+                      nameId, gnssObs.insTime.toYMDHMS(GPST), dt);
+        }
+        _reference = std::move(epoch);
+        return std::nullopt;
+    }
+
+    Result result;
+    result.insTime = epoch.insTime;
+    result.dt = dt;
+
+    /// Time-differenced observation
+    struct Measurement
+    {
+        SatSigId satSigId;         ///< Signal identifier
+        const SatelliteState* sat; ///< Satellite state of the current epoch
+        double obs;                ///< λΔφ + cΔdtˢ + ρ̂ₖ₋₁ [m]
+        double variance;           ///< Variance of the observation [m²]
+    };
+    std::vector<Measurement> measurements;
+    measurements.reserve(epoch.signals.size());
+
+    // The reference geometry is only recalculated, if the navigation data changed between the epochs
+    std::unordered_map<SatId, SatelliteState> updatedReferenceSatellites;
+    for (const auto& [satSigId, signal] : epoch.signals)
+    {
+        if (std::find(cycleSlips.begin(), cycleSlips.end(), satSigId) != cycleSlips.end())
+        {
+            result.cycleSlips.push_back(satSigId);
+            continue;
+        }
+        auto refSignal = _reference.signals.find(satSigId);
+        if (refSignal == _reference.signals.end()) { continue; }
+        SatId satId = satSigId.toSatId();
+        auto refSat = _reference.satellites.find(satId);
+        if (refSat == _reference.satellites.end()) { continue; }
+
+        const auto& sat = epoch.satellites.at(satId);
+        const SatelliteState* ref = &refSat->second;
+        if (ref->satNavData != sat.satNavData)
+        {
+            auto updated = updatedReferenceSatellites.find(satId);
+            if (updated == updatedReferenceSatellites.end())
+            {
+                LOG_DATA("{}: [{}] Navigation data of [{}] changed, recalculating the reference geometry", nameId, gnssObs.insTime.toYMDHMS(GPST), satId);
+                updated = updatedReferenceSatellites.emplace(satId, calcSatelliteState(sat.satNavData, satSigId.freq(), _reference.insTime,
+                                                                                        ref->pseudorange, _reference.e_recvPos))
+                              .first;
+            }
+            ref = &updated->second;
+        }
+
+        measurements.push_back(Measurement{
+            .satSigId = satSigId,
+            .sat = &sat,
+            .obs = signal.phase - refSignal->second.phase + InsConst<>::C * (sat.clkBias - ref->clkBias) + ref->range,
+            .variance = std::pow(_phaseStdDev, 2) * (1.0 / std::pow(signal.sinElev, 2) + 1.0 / std::pow(refSignal->second.sinElev, 2)),
+        });
+    }
+
+    Eigen::Vector3d e_recvPos = epoch.e_recvPos;
+    Eigen::Matrix4d N_inv = Eigen::Matrix4d::Zero();
+    Eigen::Vector4d x = Eigen::Vector4d::Zero();
+    while (true)
+    {
+        if (measurements.size() < 4)
+        {
+            LOG_DEBUG("{}: [{}] Only {} time-differenced carrier-phase observations available, but at least 4 are needed.",
+                      nameId, gnssObs.insTime.toYMDHMS(GPST), measurements.size());
+            _reference = std::move(epoch);
+            return std::nullopt;
+        }
+
+        Eigen::MatrixX4d H(measurements.size(), 4);
+        Eigen::VectorXd y(measurements.size());
+        Eigen::VectorXd w(measurements.size());
+        for (size_t iter = 0; iter < _maxIterations; iter++)
+        {
+            for (size_t i = 0; i < measurements.size(); i++)
+            {
+                const auto& meas = measurements.at(i);
+                auto idx = static_cast<Eigen::Index>(i);
+                H.block<1, 3>(idx, 0) = -e_calcLineOfSightUnitVector(e_recvPos, meas.sat->e_satPos).transpose();
+                H(idx, 3) = 1.0;
+                y(idx) = meas.obs - ((meas.sat->e_satPos - e_recvPos).norm() + calcSagnacCorrection(e_recvPos, meas.sat->e_satPos));
+                w(idx) = 1.0 / meas.variance;
+            }
+            Eigen::Matrix4d N = H.transpose() * w.asDiagonal() * H;
+            N_inv = N.inverse();
+            x = N_inv * H.transpose() * w.asDiagonal() * y;
+            e_recvPos += x.head<3>();
+            LOG_DATA("{}: [{}] Iteration {}: dx = {} [m], cdt_r = {} [m]", nameId, gnssObs.insTime.toYMDHMS(GPST), iter, x.head<3>().transpose(), x(3));
+            if (x.head<3>().norm() < 1e-6) { break; }
+        }
+
+        // Residuals of the last iteration (the position correction is already applied)
+        Eigen::VectorXd v = y - H * x;
+        Eigen::Index maxIdx = 0;
+        (v.array().abs() * w.array().sqrt()).maxCoeff(&maxIdx);
+        double normalizedResidual = std::abs(v(maxIdx)) * std::sqrt(w(maxIdx));
+        if (normalizedResidual <= _outlierThreshold || measurements.size() <= 5) { break; }
+
+        const auto& outlier = measurements.at(static_cast<size_t>(maxIdx));
+        LOG_DEBUG("{}: [{}] Excluding [{}] with a residual of {:.4f} m ({:.1f} σ)", nameId, gnssObs.insTime.toYMDHMS(GPST),
+                  outlier.satSigId, v(maxIdx), normalizedResidual);
+        result.outliers.push_back(outlier.satSigId);
+        measurements.erase(measurements.begin() + maxIdx);
+    }
+
+    std::unordered_set<SatId> usedSatellites;
+    for (const auto& meas : measurements) { usedSatellites.insert(meas.satSigId.toSatId()); }
+
+    result.e_position = e_recvPos;
+    result.e_displacement = e_recvPos - _reference.e_recvPos;
+    result.e_displacementCovariance = N_inv.topLeftCorner<3, 3>();
+    result.recvClkChange = x(3);
+    result.recvClkChangeStdDev = std::sqrt(N_inv(3, 3));
+    result.nSatellites = usedSatellites.size();
+    result.nSignals = measurements.size();
+
+    // The current epoch becomes the reference for the next one with the ranges referring to the estimated position
+    _reference = std::move(epoch);
+    setReferencePosition(e_recvPos);
+
+    return result;
+}
+
+void to_json(json& j, const Algorithm& obj)
+{
+    j = json{
+        { "obsFilter", obj._obsFilter },
+        { "cycleSlipDetector", obj._cycleSlipDetector },
+        { "phaseStdDev", obj._phaseStdDev },
+        { "maxTimeGap", obj._maxTimeGap },
+        { "outlierThreshold", obj._outlierThreshold },
+    };
+}
+
+void from_json(const json& j, Algorithm& obj)
+{
+    if (j.contains("obsFilter")) { j.at("obsFilter").get_to(obj._obsFilter); }
+    if (j.contains("cycleSlipDetector")) { j.at("cycleSlipDetector").get_to(obj._cycleSlipDetector); }
+    if (j.contains("phaseStdDev")) { j.at("phaseStdDev").get_to(obj._phaseStdDev); }
+    if (j.contains("maxTimeGap")) { j.at("maxTimeGap").get_to(obj._maxTimeGap); }
+    if (j.contains("outlierThreshold")) { j.at("outlierThreshold").get_to(obj._outlierThreshold); }
+}
+
+} // namespace TDCP
+} // namespace NAV
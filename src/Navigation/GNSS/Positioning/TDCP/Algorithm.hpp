@@ -0,0 +1,197 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Algorithm.hpp
+/// @brief Time-Differenced Carrier-Phase (TDCP) displacement estimation
+/// @date 2026-10-18
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Navigation/GNSS/Ambiguity/CycleSlipDetector.hpp"
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Positioning/ObservationFilter.hpp"
+#include "Navigation/GNSS/Satellite/internal/SatNavData.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+
+#include "util/Json.hpp"
+
+namespace NAV
+{
+
+namespace TDCP
+{
+
+/// @brief Time-Differenced Carrier-Phase (TDCP) algorithm
+///
+/// Carrier-phase observations of consecutive epochs are differenced, so that the ambiguities cancel as long as no cycle-slip occurred:
+///   λΔφ + cΔdtˢ - (ρ̂ₖ - ρ̂ₖ₋₁) = -eₖ·δ + cΔdtᵣ
+/// where ρ̂ is the range (incl. Sagnac) to the approximate receiver positions, δ the correction of the current approximate position
+/// and cΔdtᵣ the receiver clock change. The displacement between the epochs is then d = r̂ₖ + δ - r̂ₖ₋₁.
+///
+/// The satellite orbit and clock are evaluated once per satellite and epoch and reused as reference for the next epoch.
+/// Ionospheric and tropospheric changes over the short interval are neglected. Signals with a detected cycle-slip are excluded and
+/// only provide the new reference phase for the next epoch.
+class Algorithm
+{
+  public:
+    /// @brief Receiver Types
+    enum ReceiverType
+    {
+        Rover,              ///< Rover
+        ReceiverType_COUNT, ///< Amount of receiver types
+    };
+
+    /// @brief Displacement between two epochs
+    struct Result
+    {
+        InsTime insTime;                          ///< Time of the current epoch
+        double dt = 0.0;                          ///< Time interval to the previous epoch [s]
+        Eigen::Vector3d e_position;               ///< Position of the receiver in the current epoch (previous position + displacement) [m]
+        Eigen::Vector3d e_displacement;           ///< Displacement between the epochs in ECEF frame [m]
+        Eigen::Matrix3d e_displacementCovariance; ///< Covariance of the displacement in ECEF frame [m²]
+        double recvClkChange = 0.0;               ///< Change of the receiver clock between the epochs [m]
+        double recvClkChangeStdDev = 0.0;         ///< Standard deviation of the receiver clock change [m]
+        size_t nSatellites = 0;                   ///< Amount of satellites used
+        size_t nSignals = 0;                      ///< Amount of time-differenced signals used
+        std::vector<SatSigId> cycleSlips;         ///< Signals excluded because of a detected cycle-slip
+        std::vector<SatSigId> outliers;           ///< Signals excluded because of large residuals
+
+        /// @brief Mean velocity over the interval in ECEF frame [m/s]
+        [[nodiscard]] Eigen::Vector3d e_velocity() const { return e_displacement / dt; }
+    };
+
+    /// @brief Shows the GUI input to select the options
+    /// @param[in] id Unique id for ImGui.
+    /// @param[in] itemWidth Width of the widgets
+    bool ShowGuiWidgets(const char* id, float itemWidth);
+
+    /// @brief Reset the algorithm (the next epoch only becomes the reference)
+    void reset();
+
+    /// @brief Whether a reference epoch is available, so that the next epoch can be differenced
+    [[nodiscard]] bool hasReference() const { return !_reference.insTime.empty(); }
+
+    /// @brief Moves the receiver position of the reference epoch, e.g. to a new absolute position from SPP.
+    /// The displacements are not affected, but the positions of the following epochs refer to the new position.
+    /// @param[in] e_position New receiver position of the reference epoch [m]
+    void setReferencePosition(const Eigen::Vector3d& e_position);
+
+    /// @brief Calculates the displacement since the previous epoch
+    /// @param[in] gnssObs GNSS observation of the current epoch
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information
+    /// @param[in] e_approxPosition Approximate position of the receiver in the current epoch (e.g. SPP or the previous position) [m]
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    /// @return The displacement, or nothing if this is the first epoch after a reset or too few signals are available
+    std::optional<Result> calcDisplacement(const GnssObs& gnssObs,
+                                           const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                           const Eigen::Vector3d& e_approxPosition,
+                                           const std::string& nameId);
+
+    /// Observation Filter (frequencies, codes, satellites, elevation and SNR mask)
+    ObservationFilter _obsFilter{ ReceiverType_COUNT,
+                                  /* available */ std::unordered_set{ GnssObs::Carrier },
+                                  /*   needed  */ std::unordered_set{ GnssObs::Carrier } };
+
+    /// Cycle-slip detector
+    CycleSlipDetector _cycleSlipDetector;
+
+  private:
+    /// @brief Satellite orbit and clock of an epoch
+    struct SatelliteState
+    {
+        std::shared_ptr<const SatNavData> satNavData; ///< Navigation data the state was calculated with
+        InsTime transmitTime;                         ///< Transmit time of the signal
+        Eigen::Vector3d e_satPos;                     ///< Satellite position at the transmit time [m]
+        double pseudorange = 0.0;                     ///< Pseudorange the transmit time was calculated with [m]
+        double clkBias = 0.0;                         ///< Satellite clock bias (on the first frequency of the system) [s]
+        double range = 0.0;                           ///< Range incl. Sagnac correction to the receiver position of the epoch [m]
+    };
+
+    /// @brief Carrier-phase of a signal
+    struct SignalState
+    {
+        double phase = 0.0;    ///< Carrier-phase [m]
+        double sinElev = 1.0;  ///< Sine of the satellite elevation
+        int8_t freqNum = -128; ///< Frequency number. Only used for GLONASS G1 and G2
+    };
+
+    /// @brief States of an epoch
+    struct Epoch
+    {
+        InsTime insTime;                                      ///< Receive time
+        Eigen::Vector3d e_recvPos;                            ///< Receiver position the ranges refer to [m]
+        std::unordered_map<SatId, SatelliteState> satellites; ///< Satellite states
+        std::unordered_map<SatSigId, SignalState> signals;    ///< Carrier-phases
+    };
+
+    /// @brief Evaluates the satellite states and carrier-phases of the epoch
+    /// @param[in] gnssObs GNSS observation of the current epoch
+    /// @param[in] gnssNavInfos Collection of GNSS Nav information
+    /// @param[in] e_recvPos Approximate receiver position [m]
+    /// @param[in] nameId Name and id of the node calling this (only used for logging purposes)
+    [[nodiscard]] Epoch evaluateEpoch(const GnssObs& gnssObs,
+                                      const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                                      const Eigen::Vector3d& e_recvPos,
+                                      const std::string& nameId) const;
+
+    /// @brief Evaluates the satellite orbit and clock for a signal received at the position
+    /// @param[in] satNavData Navigation data of the satellite
+    /// @param[in] freq Frequency of the signal. The clock bias is always evaluated on the first frequency of the system, so that group delays do not change between epochs.
+    /// @param[in] recvTime Receive time of the signal
+    /// @param[in] pseudorange Pseudorange of the signal [m]
+    /// @param[in] e_recvPos Receiver position [m]
+    [[nodiscard]] static SatelliteState calcSatelliteState(const std::shared_ptr<const SatNavData>& satNavData, Frequency freq,
+                                                           const InsTime& recvTime, double pseudorange, const Eigen::Vector3d& e_recvPos);
+
+    /// @brief Signals of the observation with a detected cycle-slip
+    /// @param[in] gnssObs GNSS observation of the current epoch
+    /// @param[in] epoch Evaluated states of the current epoch
+    [[nodiscard]] std::vector<SatSigId> detectCycleSlips(const GnssObs& gnssObs, const Epoch& epoch);
+
+    /// Previous epoch the current one is differenced to
+    Epoch _reference;
+
+    /// Standard deviation of an undifferenced carrier-phase observation in zenith direction [m]
+    double _phaseStdDev = 0.003;
+
+    /// Maximum time interval between two epochs, which can be differenced [s]
+    double _maxTimeGap = 1.1;
+
+    /// Signals with a normalized residual above this threshold are excluded as outliers
+    double _outlierThreshold = 4.0;
+
+    /// Maximum amount of iterations of the least squares adjustment
+    size_t _maxIterations = 3;
+
+    friend void to_json(json& j, const Algorithm& obj);
+    friend void from_json(const json& j, Algorithm& obj);
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] obj Object to convert into json
+void to_json(json& j, const Algorithm& obj);
+/// @brief Converts the provided json object into a node object
+/// @param[in] j Json object with the needed values
+/// @param[out] obj Object to fill from the json
+void from_json(const json& j, Algorithm& obj);
+
+} // namespace TDCP
+
+} // namespace NAV
@@ -0,0 +1,360 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ObservationQC.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Navigation/Constants.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// @brief Checks whether the frequency of the signal depends on the frequency number of the satellite (GLONASS G1/G2)
+/// @param[in] code Code of the signal
+bool isFrequencyDivision(const Code& code)
+{
+    auto freq = code.getFrequency();
+    return freq == R01 || freq == R02;
+}
+
+/// @brief Frequency of a signal [Hz], which does not depend on the frequency number of the satellite
+/// @param[in] code Code of the signal
+double frequency(const Code& code)
+{
+    return code.getFrequency().getFrequency(0);
+}
+
+} // namespace
+
+void ObservationQC::Statistics::add(double value)
+{
+    count++;
+    if (count == 1)
+    {
+        min = value;
+        max = value;
+    }
+    min = std::min(min, value);
+    max = std::max(max, value);
+    mean += (value - mean) / static_cast<double>(count);
+}
+
+ObservationQC::ObservationQC()
+    : ObservationQC(Settings{}) {}
+
+ObservationQC::ObservationQC(Settings settings)
+    : _settings(std::move(settings)), _cycleSlipDetector(_settings.cycleSlipDetector)
+{
+    _cycleSlipDetector.reset();
+}
+
+void ObservationQC::reset()
+{
+    _cycleSlipDetector = _settings.cycleSlipDetector;
+    _cycleSlipDetector.reset();
+    _signals.clear();
+    _satelliteEpochs.clear();
+    _epochs = 0;
+    _firstEpoch.reset();
+    _lastEpoch.reset();
+    _intervals.clear();
+    _lastReceiverClockOffset.reset();
+    _clockJumps.clear();
+}
+
+void ObservationQC::addEpoch(const GnssObs& gnssObs, std::optional<double> receiverClockOffset)
+{
+    const InsTime& insTime = gnssObs.insTime;
+    const InsTime previousEpoch = _lastEpoch;
+    if (_epochs == 0) { _firstEpoch = insTime; }
+    else { _intervals[std::llround(static_cast<double>((insTime - previousEpoch).count()) * 1e3)]++; }
+    _epochs++;
+    _lastEpoch = insTime;
+
+    // Completeness, signal strength and cycle-slips
+    std::vector<SatId> satellites;
+    std::vector<CycleSlipDetector::SatelliteObservation> satObs;
+    std::vector<SatSigId> cycleSlips;
+    for (const auto& obsData : gnssObs.data)
+    {
+        SatId satId = obsData.satSigId.toSatId();
+        if (std::find(satellites.begin(), satellites.end(), satId) == satellites.end())
+        {
+            satellites.push_back(satId);
+            _satelliteEpochs[satId]++;
+        }
+
+        auto& state = _signals[obsData.satSigId];
+        if (obsData.pseudorange) { state.epochs++; }
+        if (obsData.CN0) { state.CN0.add(*obsData.CN0); }
+        if (!obsData.carrierPhase) { continue; }
+        state.phaseEpochs++;
+
+        if (isFrequencyDivision(obsData.satSigId.code))
+        {
+            if (_cycleSlipDetector.isEnabled(CycleSlipDetector::Detector::LLI) && obsData.carrierPhase->LLI)
+            {
+                cycleSlips.push_back(obsData.satSigId);
+            }
+            continue;
+        }
+        auto sat = std::find_if(satObs.begin(), satObs.end(), [&](const auto& obs) { return obs.satId == satId; });
+        if (sat == satObs.end())
+        {
+            satObs.push_back(CycleSlipDetector::SatelliteObservation{ .satId = satId, .signals = {}, .freqNum = -128 });
+            sat = std::prev(satObs.end());
+        }
+        sat->signals.push_back(CycleSlipDetector::SatelliteObservation::Signal{ .code = obsData.satSigId.code, .measurement = *obsData.carrierPhase });
+    }
+    for (const auto& cycleSlip : _cycleSlipDetector.checkForCycleSlip(insTime, satObs))
+    {
+        std::visit([&](auto&& slip) {
+            using T = std::decay_t<decltype(slip)>;
+            if constexpr (std::is_same_v<T, CycleSlipDetector::CycleSlipDualFrequency>)
+            {
+                cycleSlips.insert(cycleSlips.end(), slip.signals.begin(), slip.signals.end());
+            }
+            else { cycleSlips.push_back(slip.signal); }
+        },
+                   cycleSlip);
+    }
+    std::sort(cycleSlips.begin(), cycleSlips.end());
+    cycleSlips.erase(std::unique(cycleSlips.begin(), cycleSlips.end()), cycleSlips.end());
+    for (const auto& satSigId : cycleSlips) { _signals[satSigId].cycleSlips++; }
+    auto slipped = [&](const SatSigId& satSigId) { return std::binary_search(cycleSlips.begin(), cycleSlips.end(), satSigId); };
+
+    // Receiver clock jumps. Millisecond jumps of the receiver clock are seen as a common jump in the code-minus-phase of all signals.
+    std::vector<double> codeMinusPhaseChanges;
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.pseudorange || !obsData.carrierPhase || isFrequencyDivision(obsData.satSigId.code)) { continue; }
+
+        double codeMinusPhase = obsData.pseudorange->value - InsConst<>::C / frequency(obsData.satSigId.code) * obsData.carrierPhase->value;
+        auto& state = _signals.at(obsData.satSigId);
+        if (!previousEpoch.empty() && state.lastCodeMinusPhaseEpoch == previousEpoch && !slipped(obsData.satSigId))
+        {
+            codeMinusPhaseChanges.push_back(codeMinusPhase - state.lastCodeMinusPhase);
+        }
+        state.lastCodeMinusPhaseEpoch = insTime;
+        state.lastCodeMinusPhase = codeMinusPhase;
+    }
+    std::optional<double> clockJump;
+    if (receiverClockOffset && _lastReceiverClockOffset
+        && std::abs(*receiverClockOffset - *_lastReceiverClockOffset) > _settings.clockJumpThreshold)
+    {
+        clockJump = *receiverClockOffset - *_lastReceiverClockOffset;
+    }
+    else if (codeMinusPhaseChanges.size() >= 2)
+    {
+        auto median = codeMinusPhaseChanges.begin() + static_cast<std::ptrdiff_t>(codeMinusPhaseChanges.size() / 2);
+        std::nth_element(codeMinusPhaseChanges.begin(), median, codeMinusPhaseChanges.end());
+        if (std::abs(*median) > _settings.clockJumpThreshold * InsConst<>::C) { clockJump = *median / InsConst<>::C; }
+    }
+    if (clockJump)
+    {
+        LOG_DATA("[{}] Receiver clock jump of {} s", insTime.toYMDHMS(GPST), *clockJump);
+        _clockJumps.push_back(ClockJump{ .insTime = insTime, .jump = *clockJump });
+    }
+    _lastReceiverClockOffset = receiverClockOffset;
+
+    // Multipath combinations
+    for (const auto& obsData : gnssObs.data)
+    {
+        if (!obsData.pseudorange || !obsData.carrierPhase || isFrequencyDivision(obsData.satSigId.code)) { continue; }
+
+        // Carrier-phase on the highest other frequency of the satellite (e.g. L2 for L1, L1 for L2 and L5)
+        double freq = frequency(obsData.satSigId.code);
+        const GnssObs::ObservationData* partner = nullptr;
+        for (const auto& other : gnssObs.data)
+        {
+            if (!other.carrierPhase || other.satSigId.toSatId() != obsData.satSigId.toSatId()
+                || isFrequencyDivision(other.satSigId.code)
+                || frequency(other.satSigId.code) == freq)
+            {
+                continue;
+            }
+            if (partner == nullptr || frequency(other.satSigId.code) > frequency(partner->satSigId.code)) { partner = &other; }
+        }
+        if (partner == nullptr) { continue; }
+
+        double partnerFreq = frequency(partner->satSigId.code);
+        double alpha = std::pow(freq / partnerFreq, 2);
+        double multipath = obsData.pseudorange->value
+                           - (1.0 + 2.0 / (alpha - 1.0)) * InsConst<>::C / freq * obsData.carrierPhase->value
+                           + 2.0 / (alpha - 1.0) * InsConst<>::C / partnerFreq * partner->carrierPhase->value;
+
+        auto& state = _signals.at(obsData.satSigId);
+        auto& arc = state.arc;
+        if (arc.length == 0 || arc.partner != partner->satSigId.code || arc.lastEpoch != previousEpoch
+            || clockJump || slipped(obsData.satSigId) || slipped(partner->satSigId))
+        {
+            finishArc(state);
+            arc.partner = partner->satSigId.code;
+            arc.offset = multipath;
+        }
+        double value = multipath - arc.offset;
+        arc.sum += value;
+        arc.sumSq += value * value;
+        arc.length++;
+        arc.lastEpoch = insTime;
+    }
+}
+
+void ObservationQC::finishArc(SignalState& state) const
+{
+    if (state.arc.length >= std::max(_settings.minArcLength, size_t(2)))
+    {
+        state.multipathSumSqDev += state.arc.sumSq - state.arc.sum * state.arc.sum / static_cast<double>(state.arc.length);
+        state.multipathEpochs += state.arc.length;
+    }
+    state.arc = MultipathArc{};
+}
+
+ObservationQC::Report ObservationQC::report() const
+{
+    Report report;
+    report.firstEpoch = _firstEpoch;
+    report.lastEpoch = _lastEpoch;
+    report.epochs = _epochs;
+    report.expectedEpochs = _epochs;
+    report.clockJumps = _clockJumps;
+
+    if (auto interval = std::max_element(_intervals.begin(), _intervals.end(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+        interval != _intervals.end() && interval->first > 0)
+    {
+        report.interval = static_cast<double>(interval->first) * 1e-3;
+        report.expectedEpochs = static_cast<size_t>(std::llround(static_cast<double>((_lastEpoch - _firstEpoch).count()) / report.interval)) + 1;
+        for (const auto& [ms, count] : _intervals)
+        {
+            if (static_cast<double>(ms) > 1.5 * static_cast<double>(interval->first)) { report.gaps += count; }
+        }
+    }
+    if (report.expectedEpochs != 0) { report.completeness = static_cast<double>(report.epochs) / static_cast<double>(report.expectedEpochs); }
+
+    std::map<Code, std::pair<double, size_t>> multipath; // Sum of the squared deviations and epochs
+    for (const auto& [satSigId, signalState] : _signals)
+    {
+        SatId satId = satSigId.toSatId();
+        auto sat = std::find_if(report.satellites.begin(), report.satellites.end(), [&](const auto& s) { return s.satId == satId; });
+        if (sat == report.satellites.end())
+        {
+            report.satellites.push_back(SatelliteReport{ .satId = satId, .epochs = _satelliteEpochs.at(satId), .cycleSlips = 0, .signals = {} });
+            sat = std::prev(report.satellites.end());
+        }
+
+        auto state = signalState;
+        finishArc(state);
+
+        SignalReport signal{ .code = satSigId.code,
+                             .epochs = state.epochs,
+                             .phaseEpochs = state.phaseEpochs,
+                             .completeness = sat->epochs != 0 ? static_cast<double>(state.epochs) / static_cast<double>(sat->epochs) : 0.0,
+                             .cycleSlips = state.cycleSlips,
+                             .CN0 = state.CN0,
+                             .multipathRMS = std::nullopt,
+                             .multipathEpochs = state.multipathEpochs };
+        if (state.multipathEpochs != 0)
+        {
+            signal.multipathRMS = std::sqrt(std::max(state.multipathSumSqDev, 0.0) / static_cast<double>(state.multipathEpochs));
+        }
+        auto& [sumSqDev, epochs] = multipath[satSigId.code];
+        sumSqDev += state.multipathSumSqDev;
+        epochs += state.multipathEpochs;
+
+        sat->cycleSlips += signal.cycleSlips;
+        report.cycleSlips += signal.cycleSlips;
+        sat->signals.push_back(signal);
+    }
+    std::sort(report.satellites.begin(), report.satellites.end(), [](const auto& lhs, const auto& rhs) { return lhs.satId < rhs.satId; });
+
+    for (const auto& [code, sum] : multipath)
+    {
+        const auto& [sumSqDev, epochs] = sum;
+        report.multipath[code] = epochs != 0 ? std::optional(std::sqrt(std::max(sumSqDev, 0.0) / static_cast<double>(epochs))) : std::nullopt;
+    }
+
+    return report;
+}
+
+void to_json(json& j, const ObservationQC::Statistics& data)
+{
+    j = json{
+        { "count", data.count },
+        { "min", data.min },
+        { "mean", data.mean },
+        { "max", data.max },
+    };
+}
+
+void to_json(json& j, const ObservationQC::SignalReport& data)
+{
+    j = json{
+        { "code", std::string(data.code) },
+        { "epochs", data.epochs },
+        { "phaseEpochs", data.phaseEpochs },
+        { "completeness", data.completeness },
+        { "cycleSlips", data.cycleSlips },
+        { "multipathEpochs", data.multipathEpochs },
+    };
+    j["CN0"] = data.CN0.count != 0 ? json(data.CN0) : json(nullptr);
+    j["multipathRMS"] = data.multipathRMS ? json(*data.multipathRMS) : json(nullptr);
+}
+
+void to_json(json& j, const ObservationQC::SatelliteReport& data)
+{
+    j = json{
+        { "satellite", fmt::format("{}", data.satId) },
+        { "epochs", data.epochs },
+        { "cycleSlips", data.cycleSlips },
+        { "signals", data.signals },
+    };
+}
+
+void to_json(json& j, const ObservationQC::ClockJump& data)
+{
+    j = json{
+        { "insTime", data.insTime },
+        { "jump", data.jump },
+    };
+}
+
+void to_json(json& j, const ObservationQC::Report& data)
+{
+    j = json{
+        { "file", data.file },
+        { "epochs", data.epochs },
+        { "expectedEpochs", data.expectedEpochs },
+        { "completeness", data.completeness },
+        { "interval", data.interval },
+        { "gaps", data.gaps },
+        { "cycleSlips", data.cycleSlips },
+        { "clockJumps", data.clockJumps },
+        { "satellites", data.satellites },
+    };
+    if (!data.error.empty()) { j["error"] = data.error; }
+    if (!data.firstEpoch.empty())
+    {
+        j["firstEpoch"] = data.firstEpoch;
+        j["lastEpoch"] = data.lastEpoch;
+    }
+    j["multipath"] = json::object();
+    for (const auto& [code, rms] : data.multipath)
+    {
+        j["multipath"][std::string(code)] = rms ? json(*rms) : json(nullptr);
+    }
+}
+
+} // namespace NAV
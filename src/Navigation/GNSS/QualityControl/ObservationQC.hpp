@@ -0,0 +1,207 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ObservationQC.hpp
+/// @brief Quality control of GNSS observations
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Navigation/GNSS/Ambiguity/CycleSlipDetector.hpp"
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "util/Json.hpp"
+
+namespace NAV
+{
+
+/// @brief Quality control of GNSS observations (completeness, multipath, cycle-slips, signal strength and receiver clock jumps)
+///
+/// The epochs are added one after another, so that the memory only depends on the amount of tracked signals and not on the
+/// length of the observation file. The multipath combinations MP1/MP2 are formed for every signal with the carrier-phase of
+/// a second frequency and are mean-free over arcs without cycle-slips or gaps.
+/// @note See \cite Estey1999 for the multipath combinations
+/// @note GLONASS G1/G2 signals need the frequency number of the satellite, which is not part of the observations.
+///       Their cycle-slips are therefore only counted from the Loss-of-Lock Indicator and no multipath is formed.
+class ObservationQC
+{
+  public:
+    /// @brief Settings of the quality control
+    struct Settings
+    {
+        /// Detector used to count the cycle-slips
+        CycleSlipDetector cycleSlipDetector;
+        /// Minimum amount of epochs of a continuous arc to contribute to the multipath statistics
+        size_t minArcLength = 10;
+        /// Receiver clock jumps above this value [s] are reported
+        double clockJumpThreshold = 1e-4;
+    };
+
+    /// @brief Minimum, mean and maximum of a value
+    struct Statistics
+    {
+        size_t count = 0;  ///< Amount of values
+        double min = 0.0;  ///< Minimum value
+        double mean = 0.0; ///< Mean value
+        double max = 0.0;  ///< Maximum value
+
+        /// @brief Adds a value to the statistics
+        /// @param[in] value Value to add
+        void add(double value);
+    };
+
+    /// @brief Quality of a signal
+    struct SignalReport
+    {
+        Code code;                          ///< Code of the signal
+        size_t epochs = 0;                  ///< Epochs with a pseudorange
+        size_t phaseEpochs = 0;             ///< Epochs with a carrier-phase
+        double completeness = 0.0;          ///< Epochs with a pseudorange divided by the epochs the satellite was tracked
+        size_t cycleSlips = 0;              ///< Amount of cycle-slips
+        Statistics CN0;                     ///< Carrier-to-Noise density [dBHz]
+        std::optional<double> multipathRMS; ///< RMS of the mean-free multipath combination [m]
+        size_t multipathEpochs = 0;         ///< Epochs contributing to the multipath RMS
+    };
+
+    /// @brief Quality of a satellite
+    struct SatelliteReport
+    {
+        SatId satId;                        ///< Satellite identifier
+        size_t epochs = 0;                  ///< Epochs with observations of the satellite
+        size_t cycleSlips = 0;              ///< Amount of cycle-slips in all signals
+        std::vector<SignalReport> signals;  ///< Quality of the signals
+    };
+
+    /// @brief Jump of the receiver clock
+    struct ClockJump
+    {
+        InsTime insTime;  ///< Epoch after the jump
+        double jump{};    ///< Size of the jump [s]
+    };
+
+    /// @brief Quality of all observations
+    struct Report
+    {
+        std::string file;                                ///< Observation file (empty if not read from a file)
+        std::string error;                               ///< Error while reading the file
+        InsTime firstEpoch;                              ///< Time of the first epoch
+        InsTime lastEpoch;                               ///< Time of the last epoch
+        double interval = 0.0;                           ///< Most common interval between the epochs [s]
+        size_t epochs = 0;                               ///< Amount of epochs
+        size_t expectedEpochs = 0;                       ///< Amount of epochs between the first and last epoch with the interval
+        double completeness = 0.0;                       ///< Epochs divided by the expected epochs
+        size_t gaps = 0;                                 ///< Amount of gaps longer than 1.5 intervals
+        size_t cycleSlips = 0;                           ///< Amount of cycle-slips in all signals
+        std::map<Code, std::optional<double>> multipath; ///< RMS of the multipath combination of all satellites per code [m]
+        std::vector<ClockJump> clockJumps;               ///< Receiver clock jumps
+        std::vector<SatelliteReport> satellites;         ///< Quality of the satellites
+    };
+
+    /// @brief Default constructor
+    ObservationQC();
+
+    /// @brief Constructor
+    /// @param[in] settings Settings of the quality control
+    explicit ObservationQC(Settings settings);
+
+    /// @brief Adds the observations of an epoch. Epochs have to be added in time order.
+    /// @param[in] gnssObs Observations of the epoch
+    /// @param[in] receiverClockOffset Receiver clock offset of the epoch [s], if available
+    void addEpoch(const GnssObs& gnssObs, std::optional<double> receiverClockOffset = std::nullopt);
+
+    /// @brief Creates the report of all epochs added since the last reset
+    [[nodiscard]] Report report() const;
+
+    /// @brief Forgets all epochs
+    void reset();
+
+  private:
+    /// @brief Continuous arc of the multipath combination
+    struct MultipathArc
+    {
+        Code partner;        ///< Code of the carrier-phase on the second frequency
+        InsTime lastEpoch;   ///< Last epoch of the arc
+        size_t length = 0;   ///< Amount of epochs in the arc
+        double offset = 0.0; ///< First value of the arc, subtracted from all values to keep the sums small [m]
+        double sum = 0.0;    ///< Sum of the values [m]
+        double sumSq = 0.0;  ///< Sum of the squared values [m^2]
+    };
+
+    /// @brief Accumulated data of a signal
+    struct SignalState
+    {
+        size_t epochs = 0;                    ///< Epochs with a pseudorange
+        size_t phaseEpochs = 0;               ///< Epochs with a carrier-phase
+        size_t cycleSlips = 0;                ///< Amount of cycle-slips
+        Statistics CN0;                       ///< Carrier-to-Noise density [dBHz]
+        MultipathArc arc;                     ///< Current arc of the multipath combination
+        double multipathSumSqDev = 0.0;       ///< Sum of the squared deviations from the arc means of finished arcs [m^2]
+        size_t multipathEpochs = 0;           ///< Epochs of finished arcs
+        InsTime lastCodeMinusPhaseEpoch;      ///< Epoch of the last code-minus-phase value
+        double lastCodeMinusPhase = 0.0;      ///< Last code-minus-phase value [m]
+    };
+
+    /// @brief Finishes the current multipath arc of a signal
+    /// @param[in, out] state Accumulated data of the signal
+    void finishArc(SignalState& state) const;
+
+    /// Settings of the quality control
+    Settings _settings;
+    /// Detector used to count the cycle-slips
+    CycleSlipDetector _cycleSlipDetector;
+    /// Accumulated data of the signals
+    std::map<SatSigId, SignalState> _signals;
+    /// Epochs with observations per satellite
+    std::map<SatId, size_t> _satelliteEpochs;
+    /// Amount of epochs
+    size_t _epochs = 0;
+    /// Time of the first epoch
+    InsTime _firstEpoch;
+    /// Time of the last epoch
+    InsTime _lastEpoch;
+    /// Occurrences of the intervals between the epochs [ms]
+    std::map<int64_t, size_t> _intervals;
+    /// Receiver clock offset of the last epoch [s]
+    std::optional<double> _lastReceiverClockOffset;
+    /// Receiver clock jumps
+    std::vector<ClockJump> _clockJumps;
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] data Data to convert into json
+void to_json(json& j, const ObservationQC::Statistics& data);
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] data Data to convert into json
+void to_json(json& j, const ObservationQC::SignalReport& data);
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] data Data to convert into json
+void to_json(json& j, const ObservationQC::SatelliteReport& data);
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] data Data to convert into json
+void to_json(json& j, const ObservationQC::ClockJump& data);
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] data Data to convert into json
+void to_json(json& j, const ObservationQC::Report& data);
+
+} // namespace NAV
@@ -113,17 +113,10 @@ Orbit::PosVelAccel GLONASSEphemeris::calcSatelliteData(const InsTime& transTime,
     double dt = static_cast<double>((transTime - toc).count());
     LOG_DATA("    dt {} [s] (Time to integrate)", dt);
 
-    while (std::abs(dt) > 1e-9)
-    {
-        double step = dt > 0 ? _h : -_h;
-        if (std::abs(dt) < _h)
-        {
-            step = dt;
-        }
-        LOG_DATA("    step {:0.2f}, pos {}, vel {}", step, y.topRows<3>().transpose(), y.bottomRows<3>().transpose());
-        y = RungeKutta4(calcPosVelDerivative, step, y, PZ90_accelLuniSolar);
-        dt -= step;
-    }
+    AdaptiveStepStatistics<double> statistics;
+    y = DormandPrince45Adaptive(calcPosVelDerivative, 0.0, dt, y, PZ90_accelLuniSolar,
+                                AdaptiveStepOptions<double>{ .absTol = 1e-5, .relTol = 3e-11, .initialStep = _h }, &statistics);
+    LOG_DATA("    {} steps, {} rejected, {} evaluations", statistics.acceptedSteps, statistics.rejectedSteps, statistics.functionEvaluations);
     LOG_DATA("    pos {}, vel {} (end state)", y.topRows<3>().transpose(), y.bottomRows<3>().transpose());
 
     Eigen::Vector3d e_pos = Eigen::Vector3d::Zero();
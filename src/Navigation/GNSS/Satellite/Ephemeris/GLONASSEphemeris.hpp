@@ -130,7 +130,7 @@ class GLONASSEphemeris final : public SatNavData
     [[nodiscard]] bool isHealthy() const final;
 
   private:
-    /// Integration step size in [s]
+    /// Initial integration step size in [s]
     static constexpr double _h = 60.0;
 
     /// @brief Calculates position, velocity and acceleration of the satellite at transmission time
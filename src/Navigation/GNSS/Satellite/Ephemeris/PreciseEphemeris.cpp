@@ -0,0 +1,201 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "PreciseEphemeris.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "Navigation/Constants.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// Time the orbit and clock are extrapolated beyond the first and last epoch of the product [s].
+/// Covers the signal travel time when the receive time is checked.
+constexpr double MAX_EXTRAPOLATION = 1.0;
+
+/// @brief Smallest interval between the epochs
+/// @param[in] times Sorted epochs [s]
+double nominalInterval(const std::vector<double>& times)
+{
+    double interval = std::numeric_limits<double>::infinity();
+    for (size_t i = 1; i < times.size(); i++)
+    {
+        interval = std::min(interval, times[i] - times[i - 1]);
+    }
+    return interval;
+}
+
+} // namespace
+
+PreciseEphemeris::PreciseEphemeris(const std::vector<OrbitRecord>& orbit, const std::vector<ClockRecord>& clock,
+                                   double positionAccuracy, size_t interpolationPoints)
+    : SatNavData(SatNavData::PreciseEphemeris, orbit.empty() ? InsTime{} : orbit.front().epoch),
+      _epoch0(refTime),
+      _windowSize(std::min(std::max(interpolationPoints, size_t(2)), orbit.size())),
+      _positionVariance(positionAccuracy * positionAccuracy)
+{
+    _orbitTimes.reserve(orbit.size());
+    for (const auto& record : orbit) { _orbitTimes.push_back(toSeconds(record.epoch)); }
+    _orbitInterval = nominalInterval(_orbitTimes);
+
+    // Divided differences of every window
+    if (_windowSize != 0)
+    {
+        size_t nWindows = orbit.size() - _windowSize + 1;
+        _coefficients.resize(nWindows * _windowSize);
+        for (size_t s = 0; s < nWindows; s++)
+        {
+            auto* c = &_coefficients.at(s * _windowSize);
+            for (size_t j = 0; j < _windowSize; j++) { c[j] = orbit.at(s + j).e_pos; }
+            for (size_t k = 1; k < _windowSize; k++)
+            {
+                for (size_t j = _windowSize - 1; j >= k; j--)
+                {
+                    c[j] = (c[j] - c[j - 1]) / (_orbitTimes.at(s + j) - _orbitTimes.at(s + j - k));
+                }
+            }
+        }
+    }
+
+    _clockTimes.reserve(clock.size());
+    _clockBiases.reserve(clock.size());
+    for (const auto& record : clock)
+    {
+        _clockTimes.push_back(toSeconds(record.epoch));
+        _clockBiases.push_back(record.bias);
+    }
+    _clockInterval = nominalInterval(_clockTimes);
+}
+
+bool PreciseEphemeris::isAvailable(const InsTime& time) const
+{
+    auto t = toSeconds(time);
+    auto available = [&](const std::vector<double>& times, double interval) {
+        if (times.size() < 2
+            || t < times.front() - MAX_EXTRAPOLATION
+            || t > times.back() + MAX_EXTRAPOLATION)
+        {
+            return false;
+        }
+        auto i = intervalIndex(times, t);
+        return times.at(i + 1) - times.at(i) < 1.5 * interval // Data gap
+               || t - times.at(i) <= MAX_EXTRAPOLATION
+               || times.at(i + 1) - t <= MAX_EXTRAPOLATION;
+    };
+
+    return _windowSize >= 2 && available(_orbitTimes, _orbitInterval) && available(_clockTimes, _clockInterval);
+}
+
+const InsTime& PreciseEphemeris::firstEpoch() const
+{
+    return _epoch0;
+}
+
+InsTime PreciseEphemeris::lastEpoch() const
+{
+    return _orbitTimes.empty() ? _epoch0 : _epoch0 + std::chrono::duration<double>(_orbitTimes.back());
+}
+
+Clock::Corrections PreciseEphemeris::calcClockCorrections(const InsTime& recvTime, double dist, const Frequency& /* freq */) const
+{
+    LOG_DATA("Calc Sat Clock corrections at receiver time {}", recvTime.toGPSweekTow());
+
+    // Time at transmission
+    InsTime transTime0 = recvTime - std::chrono::duration<double>(dist / InsConst<>::C);
+
+    InsTime transTime = transTime0;
+    double dt_sv = 0.0;
+    double clkDrift = 0.0;
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto [bias, drift] = interpolateClock(toSeconds(transTime));
+        auto posVel = calcSatelliteData(transTime, Calc_Position | Calc_Velocity);
+
+        // Relativistic correction term [s], which is not part of the clock products
+        double dt_r = -2.0 * posVel.e_pos.dot(posVel.e_vel) / std::pow(InsConst<>::C, 2);
+        LOG_DATA("      dt_r {} [s] (Relativistic correction term)", dt_r);
+
+        dt_sv = bias + dt_r;
+        clkDrift = drift;
+
+        // Correct transmit time for the satellite clock bias
+        transTime = transTime0 - std::chrono::duration<double>(dt_sv);
+    }
+
+    return { .transmitTime = transTime, .bias = dt_sv, .drift = clkDrift };
+}
+
+double PreciseEphemeris::calcSatellitePositionVariance() const
+{
+    return _positionVariance;
+}
+
+bool PreciseEphemeris::isHealthy() const
+{
+    return true;
+}
+
+Orbit::PosVelAccel PreciseEphemeris::calcSatelliteData(const InsTime& transTime, Orbit::Calc calc) const
+{
+    if (_windowSize == 0) { return { .e_pos = Eigen::Vector3d::Zero(), .e_vel = Eigen::Vector3d::Zero(), .e_accel = Eigen::Vector3d::Zero() }; }
+
+    auto t = toSeconds(transTime);
+
+    // Window centered around the interval of the time
+    auto i = static_cast<int64_t>(intervalIndex(_orbitTimes, t));
+    auto start = static_cast<size_t>(std::clamp(i - static_cast<int64_t>(_windowSize / 2) + 1,
+                                                int64_t(0), static_cast<int64_t>(_orbitTimes.size() - _windowSize)));
+    const auto* c = &_coefficients.at(start * _windowSize);
+    const auto* x = &_orbitTimes.at(start);
+
+    // Horner scheme of the Newton polynomial and its derivatives
+    Eigen::Vector3d e_pos = c[_windowSize - 1];
+    Eigen::Vector3d e_vel = Eigen::Vector3d::Zero();
+    Eigen::Vector3d e_accel = Eigen::Vector3d::Zero();
+    for (size_t j = _windowSize - 1; j-- > 0;)
+    {
+        double dt = t - x[j];
+        if (calc & Calc_Acceleration) { e_accel = e_accel * dt + 2.0 * e_vel; }
+        if (calc & (Calc_Velocity | Calc_Acceleration)) { e_vel = e_vel * dt + e_pos; }
+        e_pos = e_pos * dt + c[j];
+    }
+
+    return { .e_pos = e_pos, .e_vel = e_vel, .e_accel = e_accel };
+}
+
+std::pair<double, double> PreciseEphemeris::interpolateClock(double t) const
+{
+    if (_clockTimes.empty()) { return { std::nan(""), std::nan("") }; }
+    if (_clockTimes.size() == 1) { return { _clockBiases.front(), 0.0 }; }
+
+    auto i = intervalIndex(_clockTimes, t);
+    double drift = (_clockBiases.at(i + 1) - _clockBiases.at(i)) / (_clockTimes.at(i + 1) - _clockTimes.at(i));
+    return { _clockBiases.at(i) + drift * (t - _clockTimes.at(i)), drift };
+}
+
+double PreciseEphemeris::toSeconds(const InsTime& time) const
+{
+    return static_cast<double>((time - _epoch0).count());
+}
+
+size_t PreciseEphemeris::intervalIndex(const std::vector<double>& times, double t)
+{
+    if (times.size() < 2) { return 0; }
+    auto i = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+    return std::clamp(i, size_t(1), times.size() - 1) - 1;
+}
+
+} // namespace NAV
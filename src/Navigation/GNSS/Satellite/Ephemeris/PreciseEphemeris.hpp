@@ -0,0 +1,125 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file PreciseEphemeris.hpp
+/// @brief Precise orbit and clock products (SP3, RINEX clock)
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Navigation/GNSS/Satellite/internal/SatNavData.hpp"
+
+#include "Navigation/Time/InsTime.hpp"
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief Precise satellite orbit and clock of a product (e.g. SP3 orbits and RINEX clocks)
+///
+/// The positions are interpolated with a Lagrange polynomial over a sliding window of the product epochs. The polynomial of
+/// every window is stored in Newton form (divided differences) when the object is constructed, so that a lookup only needs a
+/// binary search and a Horner scheme, which also yields velocity and acceleration. The clocks are interpolated linearly.
+/// @note See \cite Schenewerk2003 for the interpolation of precise orbits
+/// @note The clock products refer to the ionosphere-free combination of the analysis center. No group delays are applied.
+class PreciseEphemeris final : public SatNavData
+{
+  public:
+    /// @brief Satellite position of the orbit product
+    struct OrbitRecord
+    {
+        InsTime epoch;         ///< Epoch of the position
+        Eigen::Vector3d e_pos; ///< Position of the satellite center of mass in ECEF frame [m]
+    };
+
+    /// @brief Satellite clock of the clock product
+    struct ClockRecord
+    {
+        InsTime epoch; ///< Epoch of the clock
+        double bias{}; ///< Satellite clock bias without the relativistic correction [s]
+    };
+
+    /// @brief Constructor
+    /// @param[in] orbit Positions of the satellite. Epochs have to be sorted and unique.
+    /// @param[in] clock Clock biases of the satellite. Epochs have to be sorted and unique.
+    /// @param[in] positionAccuracy Standard deviation of the positions [m]
+    /// @param[in] interpolationPoints Amount of epochs used for the orbit interpolation (order + 1)
+    PreciseEphemeris(const std::vector<OrbitRecord>& orbit, const std::vector<ClockRecord>& clock,
+                     double positionAccuracy, size_t interpolationPoints = 10);
+
+    /// @brief Checks whether orbit and clock can be interpolated at the time
+    /// @param[in] time Time to check
+    /// @return False if the time is outside of the product or inside a data gap
+    [[nodiscard]] bool isAvailable(const InsTime& time) const;
+
+    /// @brief First epoch of the orbit
+    [[nodiscard]] const InsTime& firstEpoch() const;
+
+    /// @brief Last epoch of the orbit
+    [[nodiscard]] InsTime lastEpoch() const;
+
+    /// @brief Calculates clock bias and drift of the satellite
+    /// @param[in] recvTime Receive time of the signal
+    /// @param[in] dist Distance between receiver and satellite (normally the pseudorange) [m]
+    /// @param[in] freq Signal Frequency
+    [[nodiscard]] Corrections calcClockCorrections(const InsTime& recvTime, double dist, const Frequency& freq) const final;
+
+    /// @brief Calculates the Variance of the satellite position in [m^2]
+    [[nodiscard]] double calcSatellitePositionVariance() const final;
+
+    /// @brief Checks whether the signal is healthy
+    /// @note Products do not contain unhealthy satellites, missing values are not part of the records
+    [[nodiscard]] bool isHealthy() const final;
+
+  private:
+    /// @brief Calculates position, velocity and acceleration of the satellite at transmission time
+    /// @param[in] transTime Transmit time of the signal
+    /// @param[in] calc Flags which determine what should be calculated and returned
+    [[nodiscard]] PosVelAccel calcSatelliteData(const InsTime& transTime, Orbit::Calc calc) const final;
+
+    /// @brief Interpolates the clock bias and drift
+    /// @param[in] t Time since the first orbit epoch [s]
+    /// @return Bias [s] and drift [s/s]
+    [[nodiscard]] std::pair<double, double> interpolateClock(double t) const;
+
+    /// @brief Seconds since the first orbit epoch
+    /// @param[in] time Time to convert
+    [[nodiscard]] double toSeconds(const InsTime& time) const;
+
+    /// @brief Index of the last epoch before the time, limited to the intervals between the epochs
+    /// @param[in] times Sorted epochs [s]
+    /// @param[in] t Time [s]
+    [[nodiscard]] static size_t intervalIndex(const std::vector<double>& times, double t);
+
+    /// Time of the first orbit epoch
+    InsTime _epoch0;
+    /// Orbit epochs [s] since the first orbit epoch
+    std::vector<double> _orbitTimes;
+    /// Amount of epochs per interpolation window
+    size_t _windowSize = 0;
+    /// Divided differences of all windows. The window starting at epoch i occupies the elements [i * _windowSize, (i + 1) * _windowSize).
+    std::vector<Eigen::Vector3d> _coefficients;
+    /// Nominal orbit interval [s]
+    double _orbitInterval = 0.0;
+
+    /// Clock epochs [s] since the first orbit epoch
+    std::vector<double> _clockTimes;
+    /// Clock biases [s]
+    std::vector<double> _clockBiases;
+    /// Nominal clock interval [s]
+    double _clockInterval = 0.0;
+
+    /// Variance of the positions [m^2]
+    double _positionVariance = 0.0;
+};
+
+} // namespace NAV
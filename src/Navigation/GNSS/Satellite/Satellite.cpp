@@ -10,6 +10,8 @@
 
 #include <limits>
 
+#include "Ephemeris/PreciseEphemeris.hpp"
+
 namespace NAV
 {
 
@@ -61,6 +63,11 @@ void Satellite::addSatNavData(const std::shared_ptr<SatNavData>& satNavData)
     }
 }
 
+bool Satellite::contains(const std::shared_ptr<SatNavData>& satNavData) const
+{
+    return std::find(m_navigationData.begin(), m_navigationData.end(), satNavData) != m_navigationData.end();
+}
+
 const std::vector<std::shared_ptr<SatNavData>>& Satellite::getNavigationData() const
 {
     return m_navigationData;
@@ -88,7 +95,8 @@ std::shared_ptr<SatNavData> Satellite::searchNavigationData(const InsTime& time)
         }
     }
 
-    switch (m_navigationData.front()->type)
+    const auto& navData = *(--riter);
+    switch (navData->type)
     {
     case NAV::SatNavData::Type::GPSEphemeris:
     case NAV::SatNavData::Type::GalileoEphemeris:
@@ -107,9 +115,15 @@ std::shared_ptr<SatNavData> Satellite::searchNavigationData(const InsTime& time)
             return nullptr;
         }
         break;
+    case NAV::SatNavData::Type::PreciseEphemeris:
+        if (!std::static_pointer_cast<const PreciseEphemeris>(navData)->isAvailable(time))
+        {
+            return nullptr;
+        }
+        break;
     }
 
-    return *(--riter);
+    return navData;
 }
 
 } // namespace NAV
@@ -57,6 +57,10 @@ class Satellite
     /// @param[in] satNavData Satellite Navigation Data to add
     void addSatNavData(const std::shared_ptr<SatNavData>& satNavData);
 
+    /// @brief Checks whether the navigation data object is already stored
+    /// @param[in] satNavData Satellite Navigation Data to search for
+    [[nodiscard]] bool contains(const std::shared_ptr<SatNavData>& satNavData) const;
+
     /// @brief Get the navigation data list
     [[nodiscard]] const std::vector<std::shared_ptr<SatNavData>>& getNavigationData() const;
 
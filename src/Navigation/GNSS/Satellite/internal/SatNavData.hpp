@@ -35,6 +35,7 @@ class SatNavData : public Clock, public Orbit
         QZSSEphemeris,    ///< QZSS Broadcast Ephemeris
         IRNSSEphemeris,   ///< IRNSS Broadcast Ephemeris
         SBASEphemeris,    ///< SBAS Broadcast Ephemeris
+        PreciseEphemeris, ///< Precise orbit and clock products
     };
 
     /// @brief Constructor
@@ -0,0 +1,529 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MultiPositionCalibration.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <thread>
+
+#include <Eigen/Geometry>
+#include <Eigen/QR>
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/INS/Preintegration.hpp"
+#include "Navigation/Math/Math.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+namespace
+{
+
+/// @brief Minimizes the sum of squared residuals with the Levenberg-Marquardt algorithm
+/// @param[in, out] x Parameters, initial guess on input
+/// @param[in] maxIterations Maximum amount of iterations
+/// @param[in] model Callable (x, r, J) filling the residuals and their Jacobian with respect to the parameters
+/// @return Amount of iterations
+template<typename Model>
+size_t levenbergMarquardt(Eigen::VectorXd& x, size_t maxIterations, const Model& model)
+{
+    Eigen::VectorXd r;
+    Eigen::MatrixXd J;
+    model(x, r, J);
+    double cost = r.squaredNorm();
+    double lambda = 1e-3;
+
+    size_t iteration = 0;
+    for (; iteration < maxIterations; iteration++)
+    {
+        Eigen::MatrixXd H = J.transpose() * J;
+        Eigen::VectorXd g = J.transpose() * r;
+
+        bool improved = false;
+        Eigen::VectorXd dx;
+        for (size_t attempt = 0; attempt < 10 && !improved; attempt++)
+        {
+            Eigen::MatrixXd A = H;
+            A.diagonal() += lambda * H.diagonal().cwiseMax(1e-12);
+            dx = A.ldlt().solve(-g);
+
+            Eigen::VectorXd xNew = x + dx;
+            Eigen::VectorXd rNew;
+            Eigen::MatrixXd JNew;
+            model(xNew, rNew, JNew);
+            double costNew = rNew.squaredNorm();
+            if (std::isfinite(costNew) && costNew <= cost)
+            {
+                x = xNew;
+                r = std::move(rNew);
+                J = std::move(JNew);
+                cost = costNew;
+                lambda = std::max(lambda / 10.0, 1e-12);
+                improved = true;
+            }
+            else
+            {
+                lambda *= 10.0;
+            }
+        }
+        if (!improved || dx.norm() < 1e-12 * (x.norm() + 1e-12))
+        {
+            break;
+        }
+    }
+    return iteration;
+}
+
+/// Indices of the upper triangular accelerometer matrix elements in the parameter vector
+constexpr std::array<std::pair<Eigen::Index, Eigen::Index>, 6> ACCEL_MATRIX_ELEMENTS = { {
+    { 0, 0 },
+    { 0, 1 },
+    { 0, 2 },
+    { 1, 1 },
+    { 1, 2 },
+    { 2, 2 },
+} };
+
+} // namespace
+
+void to_json(json& j, const ImuCalibrationParameters& obj)
+{
+    j = json{
+        { "accelScaleMisalignment", obj.accelScaleMisalignment },
+        { "accelBias", obj.accelBias },
+        { "gyroScaleMisalignment", obj.gyroScaleMisalignment },
+        { "gyroBias", obj.gyroBias },
+    };
+}
+
+void from_json(const json& j, ImuCalibrationParameters& obj)
+{
+    if (j.contains("accelScaleMisalignment")) { j.at("accelScaleMisalignment").get_to(obj.accelScaleMisalignment); }
+    if (j.contains("accelBias")) { j.at("accelBias").get_to(obj.accelBias); }
+    if (j.contains("gyroScaleMisalignment")) { j.at("gyroScaleMisalignment").get_to(obj.gyroScaleMisalignment); }
+    if (j.contains("gyroBias")) { j.at("gyroBias").get_to(obj.gyroBias); }
+}
+
+MultiPositionCalibration::MultiPositionCalibration(const Options& options)
+    : _options(options) {}
+
+void MultiPositionCalibration::addSample(double time, const Eigen::Vector3d& accel, const Eigen::Vector3d& gyro)
+{
+    _sampleCount++;
+
+    if (!_detectorInitialized)
+    {
+        _initialSamples.push_back(Sample{ .time = time, .accel = accel, .gyro = gyro });
+        if (_initialSamples.size() >= 3 && time - _initialSamples.front().time >= _options.initialStaticTime)
+        {
+            initializeDetector();
+        }
+        return;
+    }
+
+    detect(Sample{ .time = time, .accel = accel, .gyro = gyro });
+}
+
+void MultiPositionCalibration::initializeDetector()
+{
+    auto n = static_cast<double>(_initialSamples.size());
+    _sampleInterval = (_initialSamples.back().time - _initialSamples.front().time) / (n - 1.0);
+
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    for (const auto& sample : _initialSamples) { mean += sample.accel; }
+    mean /= n;
+    Eigen::Vector3d variance = Eigen::Vector3d::Zero();
+    for (const auto& sample : _initialSamples) { variance += (sample.accel - mean).cwiseAbs2(); }
+    variance /= n - 1.0;
+
+    _accelReference = mean;
+    // The floor lets noise-free (e.g. simulated) data pass the detector
+    _threshold = std::max(_options.thresholdFactor * variance.sum(), 1e-10);
+    _windowSize = std::max(static_cast<size_t>(std::round(_options.windowTime / _sampleInterval)), size_t(3));
+    _window.reserve(_windowSize);
+    _detectorInitialized = true;
+
+    LOG_DEBUG("Multi-position calibration: Sample interval {} s, accelerometer variance {} m^2/s^4, static window {} samples",
+              _sampleInterval, variance.transpose(), _windowSize);
+
+    auto samples = std::move(_initialSamples);
+    _initialSamples = {};
+    for (const auto& sample : samples) { detect(sample); }
+}
+
+void MultiPositionCalibration::detect(const Sample& sample)
+{
+    Eigen::Vector3d accel = sample.accel - _accelReference;
+    if (_window.size() < _windowSize)
+    {
+        _window.push_back(sample);
+    }
+    else
+    {
+        Eigen::Vector3d oldest = _window[_windowStart].accel - _accelReference;
+        _windowSum -= oldest;
+        _windowSumSq -= oldest.cwiseAbs2();
+        _window[_windowStart] = sample;
+        _windowStart = (_windowStart + 1) % _windowSize;
+    }
+    _windowSum += accel;
+    _windowSumSq += accel.cwiseAbs2();
+
+    if (_window.size() < _windowSize) { return; }
+
+    if (_windowStart == 0) // Recalculate the sums once per window to avoid accumulating rounding errors
+    {
+        _windowSum.setZero();
+        _windowSumSq.setZero();
+        for (const auto& s : _window)
+        {
+            Eigen::Vector3d a = s.accel - _accelReference;
+            _windowSum += a;
+            _windowSumSq += a.cwiseAbs2();
+        }
+    }
+
+    auto n = static_cast<double>(_windowSize);
+    double variance = (_windowSumSq - _windowSum.cwiseAbs2() / n).sum() / (n - 1.0);
+    _samplesSinceMotion = variance > _threshold ? 0 : _samplesSinceMotion + 1;
+
+    // The oldest sample is static, if all windows containing it were below the threshold
+    classify(_window[_windowStart], _samplesSinceMotion >= _windowSize);
+}
+
+void MultiPositionCalibration::classify(const Sample& sample, bool isStatic)
+{
+    std::optional<Increment> increment;
+    if (_lastSample)
+    {
+        double dt = sample.time - _lastSample->time;
+        if (dt <= 0.0 || dt > 10.0 * _sampleInterval)
+        {
+            LOG_DEBUG("Multi-position calibration: Data gap of {} s at {} s", dt, sample.time);
+            // The rotation over the gap is unknown, so the intervals before and after are not connected
+            _motion.reset();
+            _lastStatic = false;
+        }
+        else
+        {
+            increment = Increment{ .angle = 0.5 * (_lastSample->gyro + sample.gyro) * dt, .dt = dt };
+        }
+    }
+
+    if (_lastStatic && !isStatic) { closeStaticRun(); }
+
+    if (increment)
+    {
+        if (_lastStatic && isStatic)
+        {
+            if (!_staticRunConfirmed) { _staticRunIncrements.push_back(*increment); }
+        }
+        else if (_motion)
+        {
+            _motion->increments.push_back(*increment);
+        }
+    }
+
+    if (isStatic)
+    {
+        if (!_lastStatic)
+        {
+            _staticRun = StaticInterval{ .startTime = sample.time };
+            _staticRunIncrements.clear();
+            _staticRunConfirmed = false;
+        }
+        _staticRun.endTime = sample.time;
+        _staticRun.samples++;
+        auto n = static_cast<double>(_staticRun.samples);
+        _staticRun.accel += (sample.accel - _staticRun.accel) / n;
+        _staticRun.gyro += (sample.gyro - _staticRun.gyro) / n;
+
+        if (_staticRunConfirmed)
+        {
+            _staticIntervals.back() = _staticRun;
+        }
+        else if (_staticRun.endTime - _staticRun.startTime >= _options.minStaticTime)
+        {
+            if (_motion)
+            {
+                _motions.push_back(std::move(*_motion));
+                _motion.reset();
+            }
+            _staticIntervals.push_back(_staticRun);
+            _staticRunIncrements.clear();
+            _staticRunConfirmed = true;
+        }
+    }
+
+    _lastSample = sample;
+    _lastStatic = isStatic;
+}
+
+void MultiPositionCalibration::closeStaticRun()
+{
+    if (_staticRunConfirmed)
+    {
+        _motion = Motion{ .from = _staticIntervals.size() - 1, .increments = {} };
+    }
+    else if (_motion) // Too short, so the rotation during the run belongs to the motion
+    {
+        _motion->increments.insert(_motion->increments.end(), _staticRunIncrements.begin(), _staticRunIncrements.end());
+    }
+    _staticRunIncrements.clear();
+}
+
+std::pair<double, size_t> MultiPositionCalibration::calibrateAccel(const std::vector<StaticInterval>& intervals, double gravity, size_t maxIterations,
+                                                                   Eigen::Matrix3d& scaleMisalignment, Eigen::Vector3d& bias)
+{
+    auto toMatrix = [](const Eigen::VectorXd& x) {
+        Eigen::Matrix3d M = Eigen::Matrix3d::Zero();
+        for (size_t i = 0; i < ACCEL_MATRIX_ELEMENTS.size(); i++)
+        {
+            M(ACCEL_MATRIX_ELEMENTS.at(i).first, ACCEL_MATRIX_ELEMENTS.at(i).second) = x(static_cast<Eigen::Index>(i));
+        }
+        return M;
+    };
+
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(9);
+    x << 1.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0;
+
+    auto model = [&](const Eigen::VectorXd& x, Eigen::VectorXd& r, Eigen::MatrixXd& J) {
+        auto n = static_cast<Eigen::Index>(intervals.size());
+        r.resize(n);
+        J.resize(n, 9);
+        Eigen::Matrix3d M = toMatrix(x);
+        Eigen::Vector3d b = x.tail<3>();
+        for (Eigen::Index i = 0; i < n; i++)
+        {
+            Eigen::Vector3d d = intervals.at(static_cast<size_t>(i)).accel - b;
+            Eigen::Vector3d f = M * d;
+            double norm = f.norm();
+            Eigen::Vector3d u = f / norm;
+
+            r(i) = norm - gravity;
+            for (size_t e = 0; e < ACCEL_MATRIX_ELEMENTS.size(); e++)
+            {
+                const auto& [row, col] = ACCEL_MATRIX_ELEMENTS.at(e);
+                J(i, static_cast<Eigen::Index>(e)) = u(row) * d(col);
+            }
+            J.block<1, 3>(i, 6) = -u.transpose() * M;
+        }
+    };
+
+    size_t iterations = levenbergMarquardt(x, maxIterations, model);
+
+    scaleMisalignment = toMatrix(x);
+    bias = x.tail<3>();
+
+    Eigen::VectorXd r;
+    Eigen::MatrixXd J;
+    model(x, r, J);
+    return { std::sqrt(r.squaredNorm() / static_cast<double>(r.size())), iterations };
+}
+
+std::optional<Eigen::Vector3d> MultiPositionCalibration::estimateGyroBias(const std::vector<Eigen::Vector3d>& up, const ImuCalibrationParameters& params) const
+{
+    // Rotation from the body frame of each static interval into the one of the first interval of its chain of motions.
+    // In the first interval of a chain the Earth rotation is omega_ie * (cos(lat) * north + sin(lat) * up), where the
+    // north direction is unknown, so each chain adds the two horizontal components as parameters.
+    std::vector<Eigen::Matrix3d> chainDcm(_staticIntervals.size(), Eigen::Matrix3d::Identity());
+    std::vector<size_t> chain(_staticIntervals.size());
+    std::vector<size_t> chainStart;
+    for (size_t i = 0, m = 0; i < _staticIntervals.size(); i++)
+    {
+        while (m < _motions.size() && _motions.at(m).from + 1 < i) { m++; }
+        if (i > 0 && m < _motions.size() && _motions.at(m).from + 1 == i)
+        {
+            Eigen::Matrix3d R = Eigen::Matrix3d::Identity();
+            for (const auto& increment : _motions.at(m).increments)
+            {
+                R *= math::expMapQuat(params.gyroScaleMisalignment * (increment.angle - params.gyroBias * increment.dt)).toRotationMatrix();
+            }
+            chainDcm.at(i) = chainDcm.at(i - 1) * R;
+            chain.at(i) = chain.at(i - 1);
+        }
+        else
+        {
+            chain.at(i) = chainStart.size();
+            chainStart.push_back(i);
+        }
+    }
+
+    // Chains with a single interval can not separate the horizontal Earth rotation from the bias
+    std::vector<size_t> chainLength(chainStart.size(), 0);
+    for (size_t c : chain) { chainLength.at(c)++; }
+    std::vector<Eigen::Index> chainParam(chainStart.size(), -1);
+    Eigen::Index nParams = 3;
+    for (size_t c = 0; c < chainStart.size(); c++)
+    {
+        if (chainLength.at(c) >= 2)
+        {
+            chainParam.at(c) = nParams;
+            nParams += 2;
+        }
+    }
+    if (nParams == 3) { return std::nullopt; }
+
+    // Weighted linear least squares with the amount of samples as weight
+    double omegaUp = InsConst<>::omega_ie * std::sin(_options.latitude);
+    Eigen::MatrixXd N = Eigen::MatrixXd::Zero(nParams, nParams);
+    Eigen::VectorXd rhs = Eigen::VectorXd::Zero(nParams);
+    for (size_t i = 0; i < _staticIntervals.size(); i++)
+    {
+        Eigen::Index param = chainParam.at(chain.at(i));
+        if (param < 0) { continue; }
+
+        // Horizontal plane of the first interval of the chain
+        const Eigen::Vector3d& chainUp = up.at(chainStart.at(chain.at(i)));
+        Eigen::Matrix<double, 3, 2> horizontal;
+        horizontal.col(0) = chainUp.unitOrthogonal();
+        horizontal.col(1) = chainUp.cross(horizontal.col(0));
+
+        Eigen::MatrixXd A = Eigen::MatrixXd::Zero(3, nParams);
+        A.leftCols<3>().setIdentity();
+        A.middleCols<2>(param) = chainDcm.at(i).transpose() * horizontal;
+        auto n = static_cast<double>(_staticIntervals.at(i).samples);
+        N += n * A.transpose() * A;
+        rhs += n * A.transpose() * (_staticIntervals.at(i).gyro - omegaUp * up.at(i));
+    }
+
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(N);
+    if (qr.rank() < nParams)
+    {
+        LOG_WARN("Multi-position calibration: The orientations do not allow to separate the horizontal Earth rotation from the gyroscope bias");
+        return std::nullopt;
+    }
+    Eigen::VectorXd x = qr.solve(rhs);
+    for (size_t c = 0; c < chainStart.size(); c++)
+    {
+        if (chainParam.at(c) < 0) { continue; }
+        LOG_DEBUG("Multi-position calibration: Horizontal Earth rotation of {} rad/s estimated in chain {} (expected {} rad/s)",
+                  x.segment<2>(chainParam.at(c)).norm(), c, InsConst<>::omega_ie * std::cos(_options.latitude));
+    }
+    return x.head<3>();
+}
+
+std::optional<MultiPositionCalibration::Result> MultiPositionCalibration::solve() const
+{
+    // The accelerometer model has 9 parameters with one residual per static interval
+    if (_staticIntervals.size() < 9)
+    {
+        LOG_ERROR("Multi-position calibration: Only {} static intervals detected, but at least 9 are needed", _staticIntervals.size());
+        return std::nullopt;
+    }
+
+    Result result;
+    result.staticIntervals = _staticIntervals.size();
+    auto& params = result.parameters;
+    std::tie(result.accelResidualRms, result.accelIterations) = calibrateAccel(_staticIntervals, _options.gravity, _options.maxIterations,
+                                                                               params.accelScaleMisalignment, params.accelBias);
+
+    // Gravity direction in each static interval (the specific force points upwards while resting)
+    std::vector<Eigen::Vector3d> up;
+    up.reserve(_staticIntervals.size());
+    for (const auto& interval : _staticIntervals) { up.push_back(params.calibrateAccel(interval.accel).normalized()); }
+
+    // The static turn rate is the bias plus the Earth rotation. Only the vertical Earth rotation component is known
+    // without the heading, so the first guess of the bias leaves the horizontal one in it.
+    double omegaUp = InsConst<>::omega_ie * std::sin(_options.latitude);
+    double totalSamples = 0.0;
+    for (size_t i = 0; i < _staticIntervals.size(); i++)
+    {
+        auto n = static_cast<double>(_staticIntervals.at(i).samples);
+        params.gyroBias += n * (_staticIntervals.at(i).gyro - omegaUp * up.at(i));
+        totalSamples += n;
+    }
+    params.gyroBias /= totalSamples;
+
+    result.motions = _motions.size();
+    // Each motion gives two independent residuals for the 9 gyroscope parameters
+    if (_motions.size() < 5)
+    {
+        LOG_ERROR("Multi-position calibration: Only {} motions between static intervals detected, but at least 5 are needed", _motions.size());
+        return std::nullopt;
+    }
+
+    const Eigen::Vector3d& gyroBias = params.gyroBias;
+    auto model = [&](const Eigen::VectorXd& x, Eigen::VectorXd& r, Eigen::MatrixXd& J) {
+        r.resize(3 * static_cast<Eigen::Index>(_motions.size()));
+        J.resize(r.size(), 9);
+        Eigen::Matrix3d M = Eigen::Map<const Eigen::Matrix3d>(x.data());
+
+        auto evaluate = [&](size_t begin, size_t end) {
+            for (size_t m = begin; m < end; m++)
+            {
+                const auto& motion = _motions.at(m);
+                // Rotation from the body frame at the end to the one at the start of the motion and its Jacobian with
+                // respect to the column-major matrix elements (as right perturbation)
+                Eigen::Matrix3d R = Eigen::Matrix3d::Identity();
+                Eigen::Matrix<double, 3, 9> dR = Eigen::Matrix<double, 3, 9>::Zero();
+                for (const auto& increment : motion.increments)
+                {
+                    Eigen::Vector3d w = increment.angle - gyroBias * increment.dt;
+                    Eigen::Vector3d phi = M * w;
+                    Eigen::Matrix3d dC = math::expMapQuat(phi).toRotationMatrix();
+                    Eigen::Matrix3d Jr = math::rightJacobianSO3(phi);
+
+                    dR = dC.transpose() * dR;
+                    for (Eigen::Index c = 0; c < 3; c++) { dR.middleCols<3>(3 * c) += Jr * w(c); }
+                    R *= dC;
+                }
+
+                Eigen::Vector3d predicted = R.transpose() * up.at(motion.from);
+                auto row = 3 * static_cast<Eigen::Index>(m);
+                r.segment<3>(row) = up.at(motion.from + 1) - predicted;
+                J.middleRows<3>(row) = -math::skewSymmetricMatrix(predicted) * dR;
+            }
+        };
+
+        size_t threads = std::min(std::max<size_t>(std::thread::hardware_concurrency(), 1), (_motions.size() + 31) / 32);
+        if (threads <= 1)
+        {
+            evaluate(0, _motions.size());
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t t = 0; t < threads; t++)
+        {
+            workers.emplace_back(evaluate, t * _motions.size() / threads, (t + 1) * _motions.size() / threads);
+        }
+        for (auto& worker : workers) { worker.join(); }
+    };
+
+    auto calibrateGyro = [&]() {
+        Eigen::VectorXd x = Eigen::VectorXd::Zero(9);
+        x << 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0;
+        result.gyroIterations += levenbergMarquardt(x, _options.maxIterations, model);
+        params.gyroScaleMisalignment = Eigen::Map<const Eigen::Matrix3d>(x.data());
+    };
+    calibrateGyro();
+
+    // With the rotations between the static intervals known, the horizontal Earth rotation can be separated from the bias
+    if (auto gyroBias = estimateGyroBias(up, params))
+    {
+        params.gyroBias = *gyroBias;
+        calibrateGyro();
+    }
+
+    Eigen::VectorXd x = Eigen::Map<const Eigen::VectorXd>(params.gyroScaleMisalignment.data(), 9);
+    Eigen::VectorXd r;
+    Eigen::MatrixXd J;
+    model(x, r, J);
+    result.gyroResidualRms = std::sqrt(r.squaredNorm() / static_cast<double>(_motions.size()));
+
+    LOG_DEBUG("Multi-position calibration: {} static intervals, {} motions, residuals {} m/s^2 and {} rad",
+              result.staticIntervals, result.motions, result.accelResidualRms, result.gyroResidualRms);
+
+    return result;
+}
+
+} // namespace NAV
@@ -0,0 +1,238 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file MultiPositionCalibration.hpp
+/// @brief Calibration of IMU scale factors, misalignments and biases from multi-position static recordings
+/// @date 2026-10-18
+/// @note See \cite Tedaldi2014 Tedaldi et al. (2014)
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief Deterministic error model of an IMU
+///
+/// The calibrated measurements are \f$ \mathbf{a} = \mathbf{M}_a (\tilde{\mathbf{a}} - \mathbf{b}_a) \f$ and
+/// \f$ \boldsymbol{\omega} = \mathbf{M}_g (\tilde{\boldsymbol{\omega}} - \mathbf{b}_g) \f$. The accelerometer matrix is upper
+/// triangular, so that the accelerometer x-axis and the xy-plane define the calibrated body frame.
+struct ImuCalibrationParameters
+{
+    /// Accelerometer scale factor and misalignment matrix (upper triangular)
+    Eigen::Matrix3d accelScaleMisalignment = Eigen::Matrix3d::Identity();
+    /// Accelerometer bias [m/s^2]
+    Eigen::Vector3d accelBias = Eigen::Vector3d::Zero();
+    /// Gyroscope scale factor and misalignment matrix
+    Eigen::Matrix3d gyroScaleMisalignment = Eigen::Matrix3d::Identity();
+    /// Gyroscope bias [rad/s]
+    Eigen::Vector3d gyroBias = Eigen::Vector3d::Zero();
+
+    /// @brief Calibrates a raw accelerometer measurement
+    /// @param[in] accel Raw accelerometer measurement [m/s^2]
+    /// @return Calibrated accelerometer measurement [m/s^2]
+    [[nodiscard]] Eigen::Vector3d calibrateAccel(const Eigen::Vector3d& accel) const
+    {
+        return accelScaleMisalignment * (accel - accelBias);
+    }
+
+    /// @brief Calibrates a raw gyroscope measurement
+    /// @param[in] gyro Raw gyroscope measurement [rad/s]
+    /// @return Calibrated gyroscope measurement [rad/s]
+    [[nodiscard]] Eigen::Vector3d calibrateGyro(const Eigen::Vector3d& gyro) const
+    {
+        return gyroScaleMisalignment * (gyro - gyroBias);
+    }
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] obj Object to convert into json
+void to_json(json& j, const ImuCalibrationParameters& obj);
+/// @brief Converts the provided json object into the struct
+/// @param[in] j Json object with the needed values
+/// @param[out] obj Object to fill from the json
+void from_json(const json& j, ImuCalibrationParameters& obj);
+
+/// @brief Batch calibration of an IMU from a recording with the sensor resting in many different orientations
+///
+/// The samples are streamed into a static detector. The first seconds of the recording have to be static and define the
+/// noise level. Afterwards a sample is static, if the accelerometer variance of every window containing it stays below a
+/// multiple of this level. Only the means of the static intervals and the gyroscope increments of the motions in between
+/// are stored, so that long high-rate recordings fit into memory.
+///
+/// The accelerometer is calibrated by requiring the magnitude of the calibrated specific force in each static interval to
+/// match the local gravity. The gyroscope is calibrated by requiring the integrated rotation between two consecutive
+/// static intervals to rotate the gravity direction of the first one into the one of the second. Both are nonlinear
+/// least-squares problems solved with the Levenberg-Marquardt algorithm. The gyroscope bias is the static turn rate minus
+/// the Earth rotation, whose horizontal component is estimated with the rotations between the static intervals.
+class MultiPositionCalibration
+{
+  public:
+    /// @brief Options of the calibration
+    struct Options
+    {
+        double initialStaticTime = 30.0;  ///< Duration of the static period at the start of the recording [s]
+        double windowTime = 1.0;          ///< Length of the variance window of the static detector [s]
+        double thresholdFactor = 5.0;     ///< Static threshold as multiple of the variance of the initial static period
+        double minStaticTime = 2.0;       ///< Minimum duration of a static interval [s]
+        double gravity = 9.80665;         ///< Magnitude of the local gravity [m/s^2]
+        double latitude = 0.0;            ///< Latitude to compensate the Earth rotation in the gyroscope bias [rad]
+        size_t maxIterations = 50;        ///< Maximum amount of Levenberg-Marquardt iterations
+    };
+
+    /// @brief Interval in which the IMU was resting
+    struct StaticInterval
+    {
+        double startTime = 0.0;                         ///< Time of the first sample [s]
+        double endTime = 0.0;                           ///< Time of the last sample [s]
+        size_t samples = 0;                             ///< Amount of samples
+        Eigen::Vector3d accel = Eigen::Vector3d::Zero(); ///< Mean raw accelerometer measurement [m/s^2]
+        Eigen::Vector3d gyro = Eigen::Vector3d::Zero();  ///< Mean raw gyroscope measurement [rad/s]
+    };
+
+    /// @brief Result of the calibration
+    struct Result
+    {
+        ImuCalibrationParameters parameters; ///< Calibration parameters
+        size_t staticIntervals = 0;          ///< Amount of static intervals used for the accelerometer calibration
+        size_t motions = 0;                  ///< Amount of motions between static intervals used for the gyroscope calibration
+        double accelResidualRms = 0.0;       ///< RMS of the gravity magnitude residuals [m/s^2]
+        double gyroResidualRms = 0.0;        ///< RMS of the gravity direction residuals [rad]
+        size_t accelIterations = 0;          ///< Iterations of the accelerometer calibration
+        size_t gyroIterations = 0;           ///< Iterations of the gyroscope calibration
+    };
+
+    /// @brief Constructor
+    /// @param[in] options Options of the calibration
+    explicit MultiPositionCalibration(const Options& options);
+
+    /// @brief Adds a sample
+    /// @param[in] time Time of the sample, strictly increasing [s]
+    /// @param[in] accel Raw accelerometer measurement [m/s^2]
+    /// @param[in] gyro Raw gyroscope measurement [rad/s]
+    void addSample(double time, const Eigen::Vector3d& accel, const Eigen::Vector3d& gyro);
+
+    /// @brief Amount of added samples
+    [[nodiscard]] size_t sampleCount() const { return _sampleCount; }
+
+    /// @brief Detected static intervals with at least the minimum duration
+    [[nodiscard]] const std::vector<StaticInterval>& staticIntervals() const { return _staticIntervals; }
+
+    /// @brief Calculates the calibration parameters from the samples added so far
+    /// @return The result or nothing if the detected static intervals do not allow a calibration
+    [[nodiscard]] std::optional<Result> solve() const;
+
+    /// @brief Calibrates the accelerometer from the static intervals
+    /// @param[in] intervals Static intervals in at least 9 different orientations
+    /// @param[in] gravity Magnitude of the local gravity [m/s^2]
+    /// @param[in] maxIterations Maximum amount of iterations
+    /// @param[out] scaleMisalignment Accelerometer scale factor and misalignment matrix
+    /// @param[out] bias Accelerometer bias [m/s^2]
+    /// @return RMS of the residuals [m/s^2] and the amount of iterations
+    static std::pair<double, size_t> calibrateAccel(const std::vector<StaticInterval>& intervals, double gravity, size_t maxIterations,
+                                                    Eigen::Matrix3d& scaleMisalignment, Eigen::Vector3d& bias);
+
+  private:
+    /// @brief Sample of the recording
+    struct Sample
+    {
+        double time = 0.0;     ///< Time [s]
+        Eigen::Vector3d accel; ///< Raw accelerometer measurement [m/s^2]
+        Eigen::Vector3d gyro;  ///< Raw gyroscope measurement [rad/s]
+    };
+
+    /// @brief Gyroscope increment between two samples
+    struct Increment
+    {
+        Eigen::Vector3d angle; ///< Integrated raw turn rate (trapezoidal) [rad]
+        double dt = 0.0;       ///< Time difference [s]
+    };
+
+    /// @brief Motion between two consecutive static intervals
+    struct Motion
+    {
+        size_t from = 0;                   ///< Index of the static interval before the motion
+        std::vector<Increment> increments; ///< Gyroscope increments of the motion
+    };
+
+    /// @brief Initializes the static detector from the buffered initial static period
+    void initializeDetector();
+
+    /// @brief Adds a sample to the variance window of the static detector
+    /// @param[in] sample Sample to add
+    void detect(const Sample& sample);
+
+    /// @brief Assigns a classified sample to a static interval or a motion
+    /// @param[in] sample Sample to assign
+    /// @param[in] isStatic Whether the sample is static
+    void classify(const Sample& sample, bool isStatic);
+
+    /// @brief Ends the current static run and keeps it, if it is long enough
+    void closeStaticRun();
+
+    /// @brief Estimates the gyroscope bias together with the horizontal Earth rotation in the static intervals
+    /// @param[in] up Calibrated gravity direction in each static interval
+    /// @param[in] params Calibration parameters with the gyroscope matrix and a first guess of the bias
+    /// @return The gyroscope bias [rad/s] or nothing if the orientations do not allow to separate it
+    [[nodiscard]] std::optional<Eigen::Vector3d> estimateGyroBias(const std::vector<Eigen::Vector3d>& up, const ImuCalibrationParameters& params) const;
+
+    /// Options of the calibration
+    Options _options;
+    /// Amount of added samples
+    size_t _sampleCount = 0;
+    /// Samples of the initial static period, buffered until the noise level is known
+    std::vector<Sample> _initialSamples;
+    /// Whether the static detector is initialized
+    bool _detectorInitialized = false;
+    /// Nominal sample interval [s]
+    double _sampleInterval = 0.0;
+    /// Static threshold of the summed accelerometer variance [m^2/s^4]
+    double _threshold = 0.0;
+    /// Amount of samples in the variance window
+    size_t _windowSize = 0;
+    /// Reference value subtracted from the accelerometer before building the sums [m/s^2]
+    Eigen::Vector3d _accelReference = Eigen::Vector3d::Zero();
+
+    /// Samples of the variance window, which are classified after the window moved completely past them
+    std::vector<Sample> _window;
+    /// Position of the oldest sample in the ring buffer of the window
+    size_t _windowStart = 0;
+    /// Sum of the accelerometer samples in the window relative to the reference [m/s^2]
+    Eigen::Vector3d _windowSum = Eigen::Vector3d::Zero();
+    /// Sum of the squared accelerometer samples in the window relative to the reference [m^2/s^4]
+    Eigen::Vector3d _windowSumSq = Eigen::Vector3d::Zero();
+    /// Amount of samples since the last window with a variance above the threshold
+    size_t _samplesSinceMotion = 0;
+
+    /// Last classified sample
+    std::optional<Sample> _lastSample;
+    /// Whether the last classified sample was static
+    bool _lastStatic = false;
+    /// Static run which is currently accumulated
+    StaticInterval _staticRun;
+    /// Whether the current static run is long enough and already added to the static intervals
+    bool _staticRunConfirmed = false;
+    /// Increments inside the current static run, needed if the run turns out too short
+    std::vector<Increment> _staticRunIncrements;
+    /// Motion which is currently accumulated, if it follows a static interval
+    std::optional<Motion> _motion;
+
+    /// Detected static intervals
+    std::vector<StaticInterval> _staticIntervals;
+    /// Motions between consecutive static intervals
+    std::vector<Motion> _motions;
+};
+
+} // namespace NAV
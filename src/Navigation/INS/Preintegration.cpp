@@ -0,0 +1,228 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Preintegration.hpp"
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/INS/Functions.hpp"
+#include "Navigation/Math/Math.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+
+#include <cmath>
+
+namespace NAV
+{
+
+namespace math
+{
+
+Eigen::Quaterniond expMapQuat(const Eigen::Vector3d& phi)
+{
+    double angle = phi.norm();
+    if (angle < 1e-12)
+    {
+        return Eigen::Quaterniond(1.0, 0.5 * phi.x(), 0.5 * phi.y(), 0.5 * phi.z()).normalized();
+    }
+    return Eigen::Quaterniond(Eigen::AngleAxisd(angle, phi / angle));
+}
+
+Eigen::Vector3d logMapQuat(const Eigen::Quaterniond& q)
+{
+    // q and -q describe the same rotation. Use the one with the smaller angle.
+    double w = q.w() < 0.0 ? -q.w() : q.w();
+    Eigen::Vector3d vec = q.w() < 0.0 ? Eigen::Vector3d(-q.vec()) : Eigen::Vector3d(q.vec());
+    double vecNorm = vec.norm();
+    if (vecNorm < 1e-12)
+    {
+        return 2.0 / w * vec;
+    }
+    return 2.0 * std::atan2(vecNorm, w) / vecNorm * vec;
+}
+
+Eigen::Matrix3d rightJacobianSO3(const Eigen::Vector3d& phi)
+{
+    double angle = phi.norm();
+    Eigen::Matrix3d phiSkew = skewSymmetricMatrix(phi);
+    if (angle < 1e-6)
+    {
+        return Eigen::Matrix3d::Identity() - 0.5 * phiSkew;
+    }
+    double angle2 = angle * angle;
+    return Eigen::Matrix3d::Identity()
+           - (1.0 - std::cos(angle)) / angle2 * phiSkew
+           + (angle - std::sin(angle)) / (angle2 * angle) * phiSkew * phiSkew;
+}
+
+Eigen::Matrix3d rightJacobianInverseSO3(const Eigen::Vector3d& phi)
+{
+    double angle = phi.norm();
+    Eigen::Matrix3d phiSkew = skewSymmetricMatrix(phi);
+    if (angle < 1e-6)
+    {
+        return Eigen::Matrix3d::Identity() + 0.5 * phiSkew;
+    }
+    return Eigen::Matrix3d::Identity()
+           + 0.5 * phiSkew
+           + (1.0 / (angle * angle) - (1.0 + std::cos(angle)) / (2.0 * angle * std::sin(angle))) * phiSkew * phiSkew;
+}
+
+} // namespace math
+
+ImuPreintegrator::ImuPreintegrator(const Eigen::Vector3d& sigma2_ra, const Eigen::Vector3d& sigma2_rg)
+    : _sigma2_ra(sigma2_ra), _sigma2_rg(sigma2_rg) {}
+
+void ImuPreintegrator::reset(const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro)
+{
+    _deltaTime = 0.0;
+    _count = 0;
+    _deltaQuat.setIdentity();
+    _deltaVelocity.setZero();
+    _deltaPosition.setZero();
+    _b_biasAccel = b_biasAccel;
+    _b_biasGyro = b_biasGyro;
+    _dR_dbg.setZero();
+    _dv_dba.setZero();
+    _dv_dbg.setZero();
+    _dp_dba.setZero();
+    _dp_dbg.setZero();
+    _covariance.setZero();
+}
+
+void ImuPreintegrator::setNoise(const Eigen::Vector3d& sigma2_ra, const Eigen::Vector3d& sigma2_rg)
+{
+    _sigma2_ra = sigma2_ra;
+    _sigma2_rg = sigma2_rg;
+}
+
+void ImuPreintegrator::integrate(const Eigen::Vector3d& b_specForce_ib, const Eigen::Vector3d& b_omega_ib, double dt)
+{
+    if (dt <= 0.0) { return; }
+
+    const double dt2 = dt * dt;
+
+    Eigen::Vector3d f = b_specForce_ib - _b_biasAccel;
+    Eigen::Vector3d phi = (b_omega_ib - _b_biasGyro) * dt;
+
+    Eigen::Matrix3d deltaR = _deltaQuat.toRotationMatrix();          // ΔR_ik
+    Eigen::Quaterniond deltaQuat_k_kp1 = math::expMapQuat(phi);      // ΔR_k,k+1
+    Eigen::Matrix3d deltaR_k_kp1 = deltaQuat_k_kp1.toRotationMatrix(); // ΔR_k,k+1
+    Eigen::Matrix3d Jr = math::rightJacobianSO3(phi);
+    Eigen::Matrix3d deltaR_fSkew = deltaR * math::skewSymmetricMatrix(f); // ΔR_ik [f]×
+
+    // Covariance propagation (Forster et al. (2017), eq. (62))
+    Eigen::Matrix<double, 9, 9> A = Eigen::Matrix<double, 9, 9>::Identity();
+    A.block<3, 3>(0, 0) = deltaR_k_kp1.transpose();
+    A.block<3, 3>(3, 0) = -deltaR_fSkew * dt;
+    A.block<3, 3>(6, 0) = -0.5 * deltaR_fSkew * dt2;
+    A.block<3, 3>(6, 3) = Eigen::Matrix3d::Identity() * dt;
+
+    Eigen::Matrix<double, 9, 3> B_g = Eigen::Matrix<double, 9, 3>::Zero();
+    B_g.block<3, 3>(0, 0) = Jr * dt;
+    Eigen::Matrix<double, 9, 3> B_a = Eigen::Matrix<double, 9, 3>::Zero();
+    B_a.block<3, 3>(3, 0) = deltaR * dt;
+    B_a.block<3, 3>(6, 0) = 0.5 * deltaR * dt2;
+
+    // Discrete time noise from the continuous power spectral density
+    _covariance = A * _covariance * A.transpose()
+                  + B_g * (_sigma2_rg / dt).asDiagonal() * B_g.transpose()
+                  + B_a * (_sigma2_ra / dt).asDiagonal() * B_a.transpose();
+
+    // Bias Jacobians (Forster et al. (2017), appendix B). Position first, as it needs the velocity Jacobians at k
+    _dp_dba += _dv_dba * dt - 0.5 * deltaR * dt2;
+    _dp_dbg += _dv_dbg * dt - 0.5 * deltaR_fSkew * _dR_dbg * dt2;
+    _dv_dba -= deltaR * dt;
+    _dv_dbg -= deltaR_fSkew * _dR_dbg * dt;
+    _dR_dbg = deltaR_k_kp1.transpose() * _dR_dbg - Jr * dt;
+
+    // Preintegrated measurements (Forster et al. (2017), eq. (38))
+    _deltaPosition += _deltaVelocity * dt + 0.5 * deltaR * f * dt2;
+    _deltaVelocity += deltaR * f * dt;
+    _deltaQuat = (_deltaQuat * deltaQuat_k_kp1).normalized();
+
+    _deltaTime += dt;
+    _count++;
+}
+
+Eigen::Quaterniond ImuPreintegrator::deltaQuat(const Eigen::Vector3d& b_biasGyro) const
+{
+    return (_deltaQuat * math::expMapQuat(_dR_dbg * (b_biasGyro - _b_biasGyro))).normalized();
+}
+
+Eigen::Vector3d ImuPreintegrator::deltaVelocity(const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro) const
+{
+    return _deltaVelocity + _dv_dba * (b_biasAccel - _b_biasAccel) + _dv_dbg * (b_biasGyro - _b_biasGyro);
+}
+
+Eigen::Vector3d ImuPreintegrator::deltaPosition(const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro) const
+{
+    return _deltaPosition + _dp_dba * (b_biasAccel - _b_biasAccel) + _dp_dbg * (b_biasGyro - _b_biasGyro);
+}
+
+Eigen::Matrix<double, 15, 15> ImuPreintegrator::errorTransitionMatrix(const Eigen::Quaterniond& ien_Quat_b_i) const
+{
+    Eigen::Matrix3d ien_Dcm_b = ien_Quat_b_i.toRotationMatrix();
+
+    // The integrals of the IMU driven blocks of the system matrix over the interval are the bias Jacobians,
+    // e.g. ∫ C_b(t) dt = -C_b(i) ∂Δv/∂b_a and ∫ -[C_b(t) f(t)]× dt = -[C_b(i) Δv]×
+    Eigen::Matrix<double, 15, 15> Phi = Eigen::Matrix<double, 15, 15>::Identity();
+    Phi.block<3, 3>(0, 12) = -ien_Dcm_b * _deltaQuat.toRotationMatrix() * _dR_dbg;
+    Phi.block<3, 3>(3, 0) = -math::skewSymmetricMatrix(ien_Dcm_b * _deltaVelocity);
+    Phi.block<3, 3>(3, 9) = -ien_Dcm_b * _dv_dba;
+    Phi.block<3, 3>(3, 12) = -ien_Dcm_b * _dv_dbg;
+    Phi.block<3, 3>(6, 0) = -math::skewSymmetricMatrix(ien_Dcm_b * _deltaPosition);
+    Phi.block<3, 3>(6, 3) = Eigen::Matrix3d::Identity() * _deltaTime;
+    Phi.block<3, 3>(6, 9) = -ien_Dcm_b * _dp_dba;
+    Phi.block<3, 3>(6, 12) = -ien_Dcm_b * _dp_dbg;
+
+    return Phi;
+}
+
+Eigen::Matrix<double, 9, 9> ImuPreintegrator::errorCovariance(const Eigen::Quaterniond& ien_Quat_b_i) const
+{
+    Eigen::Matrix3d ien_Dcm_b = ien_Quat_b_i.toRotationMatrix();
+
+    // δφ is resolved in the body frame at epoch j, δv and δp in the body frame at epoch i
+    Eigen::Matrix<double, 9, 9> T = Eigen::Matrix<double, 9, 9>::Zero();
+    T.block<3, 3>(0, 0) = ien_Dcm_b * _deltaQuat.toRotationMatrix();
+    T.block<3, 3>(3, 3) = ien_Dcm_b;
+    T.block<3, 3>(6, 6) = ien_Dcm_b;
+
+    return T * _covariance * T.transpose();
+}
+
+Eigen::Vector3d ImuPreintegrator::meanSpecificForce() const
+{
+    if (_deltaTime <= 0.0) { return Eigen::Vector3d::Zero(); }
+    return _deltaVelocity / _deltaTime;
+}
+
+ImuPreintegrator::State ImuPreintegrator::predict(const Eigen::Vector3d& e_position_i,
+                                                  const Eigen::Vector3d& e_velocity_i,
+                                                  const Eigen::Quaterniond& e_Quat_b_i,
+                                                  GravitationModel gravitationModel) const
+{
+    const double dt = _deltaTime;
+    const Eigen::Vector3d& e_omega_ie = InsConst<>::e_omega_ie;
+
+    Eigen::Vector3d lla_position_i = trafo::ecef2lla_WGS84(e_position_i);
+    Eigen::Vector3d e_gravitation = trafo::e_Quat_n(lla_position_i(0), lla_position_i(1)) * n_calcGravitation(lla_position_i, gravitationModel);
+
+    // Acceleration in the rotating ECEF frame, which is not measured by the accelerometers
+    Eigen::Vector3d e_acceleration = e_gravitation
+                                     - e_calcCentrifugalAcceleration(e_position_i, e_omega_ie)
+                                     - e_calcCoriolisAcceleration(e_omega_ie, e_velocity_i);
+
+    State state;
+    state.e_Quat_b = (math::expMapQuat(-e_omega_ie * dt) * e_Quat_b_i * _deltaQuat).normalized();
+    state.e_velocity = e_velocity_i + e_acceleration * dt + e_Quat_b_i * _deltaVelocity;
+    state.e_position = e_position_i + e_velocity_i * dt + 0.5 * e_acceleration * dt * dt + e_Quat_b_i * _deltaPosition;
+
+    return state;
+}
+
+} // namespace NAV
@@ -0,0 +1,203 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Preintegration.hpp
+/// @brief On-manifold IMU preintegration between aiding epochs
+/// @date 2026-10-18
+/// @note See \cite Forster2017 Forster et al. (2017) - On-Manifold Preintegration for Real-Time Visual-Inertial Odometry
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Navigation/Gravity/Gravity.hpp"
+
+namespace NAV
+{
+
+/// @brief Accumulates the relative motion of the body between two epochs i and j from IMU measurements.
+///
+/// The preintegrated quantities ΔR_ij, Δv_ij and Δp_ij are expressed in the body frame at epoch i and are independent of the
+/// absolute state at i. Their first order Jacobians with respect to the IMU biases and their covariance are propagated alongside,
+/// so that a change of the bias estimate does not require a re-integration of the measurements.
+///
+/// The error state is ordered [δφ, δv, δp] (right perturbation on the rotation).
+class ImuPreintegrator
+{
+  public:
+    /// @brief Result of the prediction with the preintegrated measurements
+    struct State
+    {
+        Eigen::Vector3d e_position;  ///< Position in ECEF coordinates in [m]
+        Eigen::Vector3d e_velocity;  ///< Velocity in ECEF coordinates in [m/s]
+        Eigen::Quaterniond e_Quat_b; ///< Attitude quaternion from body to ECEF frame
+    };
+
+    /// @brief Default Constructor
+    ImuPreintegrator() = default;
+
+    /// @brief Constructor
+    /// @param[in] sigma2_ra Power spectral density of the accelerometer white noise in [m² / s³]
+    /// @param[in] sigma2_rg Power spectral density of the gyroscope white noise in [rad² / s]
+    ImuPreintegrator(const Eigen::Vector3d& sigma2_ra, const Eigen::Vector3d& sigma2_rg);
+
+    /// @brief Restarts the preintegration at a new epoch i
+    /// @param[in] b_biasAccel Accelerometer bias used for the preintegration in [m/s²], in body coordinates
+    /// @param[in] b_biasGyro Gyroscope bias used for the preintegration in [rad/s], in body coordinates
+    void reset(const Eigen::Vector3d& b_biasAccel = Eigen::Vector3d::Zero(), const Eigen::Vector3d& b_biasGyro = Eigen::Vector3d::Zero());
+
+    /// @brief Sets the noise parameters used to propagate the covariance
+    /// @param[in] sigma2_ra Power spectral density of the accelerometer white noise in [m² / s³]
+    /// @param[in] sigma2_rg Power spectral density of the gyroscope white noise in [rad² / s]
+    void setNoise(const Eigen::Vector3d& sigma2_ra, const Eigen::Vector3d& sigma2_rg);
+
+    /// @brief Adds a single IMU measurement to the preintegrated quantities
+    /// @param[in] b_specForce_ib Measured specific force in [m/s²], in body coordinates (bias not yet removed)
+    /// @param[in] b_omega_ib Measured angular rate in [rad/s], in body coordinates (bias not yet removed)
+    /// @param[in] dt Time the measurement is held constant in [s]
+    void integrate(const Eigen::Vector3d& b_specForce_ib, const Eigen::Vector3d& b_omega_ib, double dt);
+
+    /// @brief Applies the preintegrated measurements to the state at epoch i
+    /// @param[in] e_position_i Position at epoch i in ECEF coordinates in [m]
+    /// @param[in] e_velocity_i Velocity at epoch i in ECEF coordinates in [m/s]
+    /// @param[in] e_Quat_b_i Attitude at epoch i from body to ECEF frame
+    /// @param[in] gravitationModel Gravitation model to use
+    /// @return Position, velocity and attitude at epoch j
+    ///
+    /// @note Gravity, Coriolis and centrifugal terms are evaluated once at epoch i and held constant over the interval.
+    ///       The rotation of the Earth between i and j is applied to the attitude exactly.
+    [[nodiscard]] State predict(const Eigen::Vector3d& e_position_i,
+                                const Eigen::Vector3d& e_velocity_i,
+                                const Eigen::Quaterniond& e_Quat_b_i,
+                                GravitationModel gravitationModel = GravitationModel::EGM96) const;
+
+    /// @brief Transition matrix of the error state [ψ, δv, δr, δf, δω] from epoch i to epoch j
+    /// @param[in] ien_Quat_b_i Attitude at epoch i, from body to the frame the errors are resolved in
+    /// @return Unscaled transition matrix with cartesian position errors and the error equations sign convention of the Kalman filters
+    ///
+    /// @note The IMU driven blocks are taken from the preintegrated measurements and their bias Jacobians. Earth rotation,
+    ///       transport rate and the gravity gradient are neglected and the bias errors are held constant.
+    [[nodiscard]] Eigen::Matrix<double, 15, 15> errorTransitionMatrix(const Eigen::Quaterniond& ien_Quat_b_i) const;
+
+    /// @brief Covariance of the error state [ψ, δv, δr] at epoch j caused by the IMU white noise
+    /// @param[in] ien_Quat_b_i Attitude at epoch i, from body to the frame the errors are resolved in
+    [[nodiscard]] Eigen::Matrix<double, 9, 9> errorCovariance(const Eigen::Quaterniond& ien_Quat_b_i) const;
+
+    /// @brief Rotation ΔR_ij corrected to first order for a new bias estimate
+    /// @param[in] b_biasGyro New gyroscope bias estimate in [rad/s]
+    [[nodiscard]] Eigen::Quaterniond deltaQuat(const Eigen::Vector3d& b_biasGyro) const;
+
+    /// @brief Velocity Δv_ij corrected to first order for a new bias estimate
+    /// @param[in] b_biasAccel New accelerometer bias estimate in [m/s²]
+    /// @param[in] b_biasGyro New gyroscope bias estimate in [rad/s]
+    [[nodiscard]] Eigen::Vector3d deltaVelocity(const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro) const;
+
+    /// @brief Position Δp_ij corrected to first order for a new bias estimate
+    /// @param[in] b_biasAccel New accelerometer bias estimate in [m/s²]
+    /// @param[in] b_biasGyro New gyroscope bias estimate in [rad/s]
+    [[nodiscard]] Eigen::Vector3d deltaPosition(const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro) const;
+
+    /// @brief Mean specific force over the interval in [m/s²], resolved in the body frame at epoch i
+    [[nodiscard]] Eigen::Vector3d meanSpecificForce() const;
+
+    /// @brief Accumulated time Δt_ij in [s]
+    [[nodiscard]] double deltaTime() const { return _deltaTime; }
+    /// @brief Amount of integrated measurements
+    [[nodiscard]] size_t size() const { return _count; }
+    /// @brief Whether no measurement was integrated since the last reset
+    [[nodiscard]] bool empty() const { return _count == 0; }
+
+    /// @brief Rotation ΔR_ij from the body frame at epoch j to the body frame at epoch i
+    [[nodiscard]] const Eigen::Quaterniond& deltaQuat() const { return _deltaQuat; }
+    /// @brief Velocity change Δv_ij in [m/s], resolved in the body frame at epoch i
+    [[nodiscard]] const Eigen::Vector3d& deltaVelocity() const { return _deltaVelocity; }
+    /// @brief Position change Δp_ij in [m], resolved in the body frame at epoch i
+    [[nodiscard]] const Eigen::Vector3d& deltaPosition() const { return _deltaPosition; }
+    /// @brief Covariance of [δφ, δv, δp] caused by the IMU white noise
+    [[nodiscard]] const Eigen::Matrix<double, 9, 9>& covariance() const { return _covariance; }
+
+    /// @brief Accelerometer bias used for the preintegration
+    [[nodiscard]] const Eigen::Vector3d& biasAccel() const { return _b_biasAccel; }
+    /// @brief Gyroscope bias used for the preintegration
+    [[nodiscard]] const Eigen::Vector3d& biasGyro() const { return _b_biasGyro; }
+
+    /// @brief ∂ΔR / ∂b_g
+    [[nodiscard]] const Eigen::Matrix3d& dR_dbg() const { return _dR_dbg; }
+    /// @brief ∂Δv / ∂b_a
+    [[nodiscard]] const Eigen::Matrix3d& dv_dba() const { return _dv_dba; }
+    /// @brief ∂Δv / ∂b_g
+    [[nodiscard]] const Eigen::Matrix3d& dv_dbg() const { return _dv_dbg; }
+    /// @brief ∂Δp / ∂b_a
+    [[nodiscard]] const Eigen::Matrix3d& dp_dba() const { return _dp_dba; }
+    /// @brief ∂Δp / ∂b_g
+    [[nodiscard]] const Eigen::Matrix3d& dp_dbg() const { return _dp_dbg; }
+
+  private:
+    /// Accumulated time Δt_ij in [s]
+    double _deltaTime = 0.0;
+    /// Amount of integrated measurements
+    size_t _count = 0;
+
+    /// ΔR_ij Rotation from body frame at j to body frame at i
+    Eigen::Quaterniond _deltaQuat = Eigen::Quaterniond::Identity();
+    /// Δv_ij Velocity change in [m/s], in body frame at epoch i
+    Eigen::Vector3d _deltaVelocity = Eigen::Vector3d::Zero();
+    /// Δp_ij Position change in [m], in body frame at epoch i
+    Eigen::Vector3d _deltaPosition = Eigen::Vector3d::Zero();
+
+    /// Accelerometer bias used for the preintegration in [m/s²]
+    Eigen::Vector3d _b_biasAccel = Eigen::Vector3d::Zero();
+    /// Gyroscope bias used for the preintegration in [rad/s]
+    Eigen::Vector3d _b_biasGyro = Eigen::Vector3d::Zero();
+
+    /// ∂ΔR / ∂b_g
+    Eigen::Matrix3d _dR_dbg = Eigen::Matrix3d::Zero();
+    /// ∂Δv / ∂b_a
+    Eigen::Matrix3d _dv_dba = Eigen::Matrix3d::Zero();
+    /// ∂Δv / ∂b_g
+    Eigen::Matrix3d _dv_dbg = Eigen::Matrix3d::Zero();
+    /// ∂Δp / ∂b_a
+    Eigen::Matrix3d _dp_dba = Eigen::Matrix3d::Zero();
+    /// ∂Δp / ∂b_g
+    Eigen::Matrix3d _dp_dbg = Eigen::Matrix3d::Zero();
+
+    /// Covariance of [δφ, δv, δp]
+    Eigen::Matrix<double, 9, 9> _covariance = Eigen::Matrix<double, 9, 9>::Zero();
+
+    /// Power spectral density of the accelerometer white noise in [m² / s³]
+    Eigen::Vector3d _sigma2_ra = Eigen::Vector3d::Zero();
+    /// Power spectral density of the gyroscope white noise in [rad² / s]
+    Eigen::Vector3d _sigma2_rg = Eigen::Vector3d::Zero();
+};
+
+namespace math
+{
+
+/// @brief Exponential map from a rotation vector to a quaternion
+/// @param[in] phi Rotation vector in [rad]
+[[nodiscard]] Eigen::Quaterniond expMapQuat(const Eigen::Vector3d& phi);
+
+/// @brief Logarithm map from a quaternion to a rotation vector
+/// @param[in] q Unit quaternion
+/// @return Rotation vector in [rad] with an angle in [0, π]
+[[nodiscard]] Eigen::Vector3d logMapQuat(const Eigen::Quaterniond& q);
+
+/// @brief Right Jacobian of SO(3)
+/// @param[in] phi Rotation vector in [rad]
+/// @note See \cite Forster2017 Forster et al. (2017), eq. (8)
+[[nodiscard]] Eigen::Matrix3d rightJacobianSO3(const Eigen::Vector3d& phi);
+
+/// @brief Inverse of the right Jacobian of SO(3)
+/// @param[in] phi Rotation vector in [rad]
+/// @note See \cite Forster2017 Forster et al. (2017), eq. (9)
+[[nodiscard]] Eigen::Matrix3d rightJacobianInverseSO3(const Eigen::Vector3d& phi);
+
+} // namespace math
+
+} // namespace NAV
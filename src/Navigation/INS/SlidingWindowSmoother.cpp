@@ -0,0 +1,387 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "SlidingWindowSmoother.hpp"
+
+#include <Eigen/Cholesky>
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/INS/Functions.hpp"
+#include "Navigation/Math/Math.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+namespace
+{
+
+/// Variance added to the diagonal of the factor covariances to keep them invertible if the noise is configured to zero
+constexpr double COVARIANCE_FLOOR = 1e-12;
+
+} // namespace
+
+SlidingWindowSmoother::SlidingWindowSmoother(const Parameters& parameters)
+    : _parameters(parameters) {}
+
+void SlidingWindowSmoother::initialize(const NavState& state, const StateMatrix& covariance)
+{
+    _window.clear();
+    _window.emplace_back();
+    _window.back().state = state;
+
+    _priorInformation = covariance.ldlt().solve(StateMatrix::Identity());
+    _priorGradient.setZero();
+    _priorLinearizationPoint = state;
+
+    _factorized = false;
+}
+
+void SlidingWindowSmoother::addImuFactor(const ImuPreintegrator& preintegrator, const InsTime& insTime)
+{
+    const NavState& last = _window.back().state;
+
+    auto prediction = preintegrator.predict(last.e_position, last.e_velocity, last.e_Quat_b, _parameters.gravitationModel);
+
+    Entry entry;
+    entry.state.insTime = insTime;
+    entry.state.e_Quat_b = prediction.e_Quat_b;
+    entry.state.e_velocity = prediction.e_velocity;
+    entry.state.e_position = prediction.e_position;
+    entry.state.b_biasAccel = last.b_biasAccel;
+    entry.state.b_biasGyro = last.b_biasGyro;
+    entry.preintegrator = preintegrator;
+
+    _window.push_back(std::move(entry));
+}
+
+void SlidingWindowSmoother::addPositionMeasurement(const Eigen::Vector3d& e_position, const Eigen::Matrix3d& e_covariance, const Eigen::Vector3d& b_leverArm)
+{
+    _window.back().positions.push_back(Measurement{ .z = e_position,
+                                                    .information = e_covariance.inverse(),
+                                                    .b_leverArm = b_leverArm });
+}
+
+void SlidingWindowSmoother::addVelocityMeasurement(const Eigen::Vector3d& e_velocity, const Eigen::Matrix3d& e_covariance)
+{
+    _window.back().velocities.push_back(Measurement{ .z = e_velocity,
+                                                     .information = e_covariance.inverse() });
+}
+
+size_t SlidingWindowSmoother::optimize()
+{
+    if (_window.empty()) { return 0; }
+
+    const size_t N = _window.size();
+    _H_diag.resize(N);
+    _H_lower.resize(N);
+    _rhs.resize(N);
+
+    size_t iteration = 0;
+    while (iteration < _parameters.maxIterations)
+    {
+        for (auto& entry : _window) { updateGravitation(entry); }
+
+        // Build the block tridiagonal normal equations H dx = -g
+        for (size_t k = 0; k < N; k++)
+        {
+            _H_diag[k].setZero();
+            _H_lower[k].setZero();
+            _rhs[k].setZero();
+        }
+        addPrior(_H_diag.front(), _rhs.front());
+        for (size_t k = 0; k < N; k++)
+        {
+            const auto& entry = _window[k];
+            addMeasurements(entry, _H_diag[k], _rhs[k]);
+
+            if (k == 0 || entry.preintegrator.empty()) { continue; }
+
+            auto lin = linearizeImuFactor(_window[k - 1], entry);
+            _H_diag[k - 1] += lin.H_ii;
+            _H_diag[k] += lin.H_jj;
+            _H_lower[k] = lin.H_ij.transpose();
+            _rhs[k - 1] += lin.g_i;
+            _rhs[k] += lin.g_j;
+        }
+
+        // Block Cholesky decomposition H = L L^T and forward substitution L y = -g
+        _factorized = true;
+        for (size_t k = 0; k < N; k++)
+        {
+            _rhs[k] = -_rhs[k];
+            if (k > 0)
+            {
+                // L_k,k-1 = H_k,k-1 L_k-1,k-1^-T
+                _H_lower[k] = _H_diag[k - 1].triangularView<Eigen::Lower>().solve(_H_lower[k].transpose()).transpose();
+                _H_diag[k].noalias() -= _H_lower[k] * _H_lower[k].transpose();
+                _rhs[k].noalias() -= _H_lower[k] * _rhs[k - 1];
+            }
+            if (k == N - 1) { _latestInformation = _H_diag[k]; }
+
+            Eigen::LLT<StateMatrix> llt(_H_diag[k]);
+            if (llt.info() != Eigen::Success)
+            {
+                _factorized = false;
+                break;
+            }
+            _H_diag[k] = llt.matrixL();
+            _H_diag[k].triangularView<Eigen::Lower>().solveInPlace(_rhs[k]);
+        }
+        if (!_factorized)
+        {
+            LOG_WARN("Sliding window smoother: Normal equations are not positive definite. Skipping the optimization.");
+            break;
+        }
+
+        // Backward substitution L^T dx = y
+        double updateNormSquared = 0.0;
+        for (size_t k = N; k-- > 0;)
+        {
+            if (k + 1 < N)
+            {
+                _rhs[k].noalias() -= _H_lower[k + 1].transpose() * _rhs[k + 1];
+            }
+            _H_diag[k].triangularView<Eigen::Lower>().transpose().solveInPlace(_rhs[k]);
+            updateNormSquared += _rhs[k].squaredNorm();
+        }
+        for (size_t k = 0; k < N; k++)
+        {
+            retract(_window[k].state, _rhs[k]);
+        }
+        iteration++;
+
+        if (updateNormSquared < _parameters.convergenceThreshold * _parameters.convergenceThreshold) { break; }
+    }
+
+    return iteration;
+}
+
+std::vector<SlidingWindowSmoother::NavState> SlidingWindowSmoother::marginalize()
+{
+    std::vector<NavState> marginalized;
+
+    while (_window.size() > 1
+           && static_cast<double>((_window.back().state.insTime - _window.front().state.insTime).count()) > _parameters.windowLength)
+    {
+        auto& entry_0 = _window.at(0);
+        auto& entry_1 = _window.at(1);
+        updateGravitation(entry_0);
+
+        StateMatrix H_00 = StateMatrix::Zero();
+        StateVector g_0 = StateVector::Zero();
+        addPrior(H_00, g_0);
+        addMeasurements(entry_0, H_00, g_0);
+
+        if (entry_1.preintegrator.empty())
+        {
+            // No factor connects the states, so nothing is known about the new oldest state
+            _priorInformation.setZero();
+            _priorGradient.setZero();
+        }
+        else
+        {
+            auto lin = linearizeImuFactor(entry_0, entry_1);
+            H_00 += lin.H_ii;
+            g_0 += lin.g_i;
+
+            // Schur complement onto the remaining state
+            StateMatrix H_00_inv_H_01 = H_00.ldlt().solve(lin.H_ij);
+            _priorInformation = lin.H_jj - lin.H_ij.transpose() * H_00_inv_H_01;
+            _priorInformation = 0.5 * (_priorInformation + _priorInformation.transpose()).eval();
+            _priorGradient = lin.g_j - H_00_inv_H_01.transpose() * g_0;
+        }
+        _priorLinearizationPoint = entry_1.state;
+
+        marginalized.push_back(entry_0.state);
+        _window.pop_front();
+        _window.front().preintegrator.reset();
+    }
+
+    return marginalized;
+}
+
+SlidingWindowSmoother::StateMatrix SlidingWindowSmoother::latestCovariance() const
+{
+    if (!_factorized)
+    {
+        return StateMatrix::Constant(std::nan(""));
+    }
+
+    // After eliminating all older states, the remaining block is the marginal information of the latest state
+    return _latestInformation.llt().solve(StateMatrix::Identity());
+}
+
+std::vector<SlidingWindowSmoother::NavState> SlidingWindowSmoother::states() const
+{
+    std::vector<NavState> states;
+    states.reserve(_window.size());
+    for (const auto& entry : _window)
+    {
+        states.push_back(entry.state);
+    }
+    return states;
+}
+
+SlidingWindowSmoother::BinaryLinearization SlidingWindowSmoother::linearizeImuFactor(const Entry& entry_i, const Entry& entry_j) const
+{
+    const NavState& x_i = entry_i.state;
+    const NavState& x_j = entry_j.state;
+    const ImuPreintegrator& preintegrator = entry_j.preintegrator;
+
+    const double dt = preintegrator.deltaTime();
+    const Eigen::Vector3d& e_omega_ie = InsConst<>::e_omega_ie;
+    const Eigen::Matrix3d e_Omega_ie = math::skewSymmetricMatrix(e_omega_ie);
+    const Eigen::Matrix3d I3 = Eigen::Matrix3d::Identity();
+
+    Eigen::Matrix3d R_i = x_i.e_Quat_b.toRotationMatrix();
+    Eigen::Matrix3d R_i_T = R_i.transpose();
+    Eigen::Quaterniond earthRotation = math::expMapQuat(e_omega_ie * dt);
+
+    Eigen::Vector3d dbg = x_i.b_biasGyro - preintegrator.biasGyro();
+    Eigen::Quaterniond deltaQuat = preintegrator.deltaQuat(x_i.b_biasGyro);
+    Eigen::Vector3d deltaVelocity = preintegrator.deltaVelocity(x_i.b_biasAccel, x_i.b_biasGyro);
+    Eigen::Vector3d deltaPosition = preintegrator.deltaPosition(x_i.b_biasAccel, x_i.b_biasGyro);
+
+    // Same model as ImuPreintegrator::predict
+    Eigen::Vector3d e_acceleration = entry_i.e_gravitation
+                                     - e_calcCentrifugalAcceleration(x_i.e_position, e_omega_ie)
+                                     - e_calcCoriolisAcceleration(e_omega_ie, x_i.e_velocity);
+    Eigen::Vector3d e_dv = x_j.e_velocity - x_i.e_velocity - e_acceleration * dt;
+    Eigen::Vector3d e_dp = x_j.e_position - x_i.e_position - x_i.e_velocity * dt - 0.5 * e_acceleration * dt * dt;
+
+    // Residuals [r_φ, r_v, r_p, r_ba, r_bg]
+    StateVector r;
+    Eigen::Quaterniond quatError = deltaQuat.conjugate() * x_i.e_Quat_b.conjugate() * earthRotation * x_j.e_Quat_b;
+    Eigen::Vector3d r_phi = math::logMapQuat(quatError);
+    r.segment<3>(0) = r_phi;
+    r.segment<3>(3) = R_i_T * e_dv - deltaVelocity;
+    r.segment<3>(6) = R_i_T * e_dp - deltaPosition;
+    r.segment<3>(9) = x_j.b_biasAccel - x_i.b_biasAccel;
+    r.segment<3>(12) = x_j.b_biasGyro - x_i.b_biasGyro;
+
+    // Jacobians (Forster et al. (2017), appendix C, extended by the Earth rotation)
+    // The bias rows are ±I and handled separately. J_j is block diagonal in the navigation states.
+    Eigen::Matrix<double, 9, StateDim> A_i = Eigen::Matrix<double, 9, StateDim>::Zero(); // ∂[r_φ, r_v, r_p] / ∂x_i
+    Eigen::Matrix<double, 9, 9> B_j = Eigen::Matrix<double, 9, 9>::Zero();               // ∂[r_φ, r_v, r_p] / ∂[φ_j, v_j, p_j]
+
+    Eigen::Matrix3d Jr_inv = math::rightJacobianInverseSO3(r_phi);
+    A_i.block<3, 3>(0, 0) = -Jr_inv * x_j.e_Quat_b.toRotationMatrix().transpose() * earthRotation.toRotationMatrix().transpose() * R_i;
+    A_i.block<3, 3>(0, 12) = -Jr_inv * math::expMapQuat(r_phi).toRotationMatrix().transpose()
+                             * math::rightJacobianSO3(preintegrator.dR_dbg() * dbg) * preintegrator.dR_dbg();
+    B_j.block<3, 3>(0, 0) = Jr_inv;
+
+    A_i.block<3, 3>(3, 0) = math::skewSymmetricMatrix(R_i_T * e_dv);
+    A_i.block<3, 3>(3, 3) = -R_i_T * (I3 - 2.0 * e_Omega_ie * dt);
+    A_i.block<3, 3>(3, 6) = R_i_T * e_Omega_ie * e_Omega_ie * dt;
+    A_i.block<3, 3>(3, 9) = -preintegrator.dv_dba();
+    A_i.block<3, 3>(3, 12) = -preintegrator.dv_dbg();
+    B_j.block<3, 3>(3, 3) = R_i_T;
+
+    A_i.block<3, 3>(6, 0) = math::skewSymmetricMatrix(R_i_T * e_dp);
+    A_i.block<3, 3>(6, 3) = -R_i_T * (I3 * dt - e_Omega_ie * dt * dt);
+    A_i.block<3, 3>(6, 6) = -R_i_T * (I3 - 0.5 * e_Omega_ie * e_Omega_ie * dt * dt);
+    A_i.block<3, 3>(6, 9) = -preintegrator.dp_dba();
+    A_i.block<3, 3>(6, 12) = -preintegrator.dp_dbg();
+    B_j.block<3, 3>(6, 6) = R_i_T;
+
+    // Information of the preintegrated measurements and the bias random walk
+    Eigen::Matrix<double, 9, 9> preintegrationCovariance = preintegrator.covariance() + COVARIANCE_FLOOR * Eigen::Matrix<double, 9, 9>::Identity();
+    Eigen::Matrix<double, 9, 9> W = preintegrationCovariance.llt().solve(Eigen::Matrix<double, 9, 9>::Identity());
+    Eigen::Matrix<double, 6, 1> W_bias;
+    W_bias << (_parameters.sigma2_biasAccel * dt).array().max(COVARIANCE_FLOOR).inverse(),
+        (_parameters.sigma2_biasGyro * dt).array().max(COVARIANCE_FLOOR).inverse();
+
+    Eigen::Matrix<double, 9, StateDim> W_A_i = W * A_i;
+    Eigen::Matrix<double, 9, 9> W_B_j = W * B_j;
+    Eigen::Matrix<double, 9, 1> W_r = W * r.head<9>();
+    Eigen::Matrix<double, 6, 1> W_r_bias = W_bias.cwiseProduct(r.tail<6>());
+
+    BinaryLinearization lin;
+    lin.H_ii.noalias() = A_i.transpose() * W_A_i;
+    lin.H_ii.bottomRightCorner<6, 6>().diagonal() += W_bias;
+
+    lin.H_ij.setZero();
+    lin.H_ij.leftCols<9>().noalias() = A_i.transpose() * W_B_j;
+    lin.H_ij.bottomRightCorner<6, 6>().diagonal() -= W_bias;
+
+    lin.H_jj.setZero();
+    lin.H_jj.topLeftCorner<9, 9>().noalias() = B_j.transpose() * W_B_j;
+    lin.H_jj.bottomRightCorner<6, 6>().diagonal() = W_bias;
+
+    lin.g_i.noalias() = A_i.transpose() * W_r;
+    lin.g_i.tail<6>() -= W_r_bias;
+
+    lin.g_j.setZero();
+    lin.g_j.head<9>().noalias() = B_j.transpose() * W_r;
+    lin.g_j.tail<6>() = W_r_bias;
+
+    return lin;
+}
+
+void SlidingWindowSmoother::addMeasurements(const Entry& entry, StateMatrix& H, StateVector& g)
+{
+    Eigen::Matrix<double, 3, StateDim> J;
+
+    for (const auto& meas : entry.positions)
+    {
+        Eigen::Matrix3d e_Dcm_b = entry.state.e_Quat_b.toRotationMatrix();
+        Eigen::Vector3d r = entry.state.e_position + e_Dcm_b * meas.b_leverArm - meas.z;
+        J.setZero();
+        J.block<3, 3>(0, 0) = -e_Dcm_b * math::skewSymmetricMatrix(meas.b_leverArm);
+        J.block<3, 3>(0, 6).setIdentity();
+
+        H += J.transpose() * meas.information * J;
+        g += J.transpose() * meas.information * r;
+    }
+    for (const auto& meas : entry.velocities)
+    {
+        Eigen::Vector3d r = entry.state.e_velocity - meas.z;
+        H.block<3, 3>(3, 3) += meas.information;
+        g.segment<3>(3) += meas.information * r;
+    }
+}
+
+void SlidingWindowSmoother::addPrior(StateMatrix& H, StateVector& g) const
+{
+    H += _priorInformation;
+    g += _priorGradient + _priorInformation * difference(_window.front().state, _priorLinearizationPoint);
+}
+
+void SlidingWindowSmoother::updateGravitation(Entry& entry) const
+{
+    // The gravitation changes by ~3e-6 m/s² per meter, so it is only recalculated after significant position changes
+    if ((entry.state.e_position - entry.e_gravitationPosition).norm() < 1.0) { return; }
+
+    Eigen::Vector3d lla_position = trafo::ecef2lla_WGS84(entry.state.e_position);
+    entry.e_gravitation = trafo::e_Quat_n(lla_position(0), lla_position(1)) * n_calcGravitation(lla_position, _parameters.gravitationModel);
+    entry.e_gravitationPosition = entry.state.e_position;
+}
+
+void SlidingWindowSmoother::retract(NavState& state, const StateVector& dx)
+{
+    state.e_Quat_b = (state.e_Quat_b * math::expMapQuat(dx.segment<3>(0))).normalized();
+    state.e_velocity += dx.segment<3>(3);
+    state.e_position += dx.segment<3>(6);
+    state.b_biasAccel += dx.segment<3>(9);
+    state.b_biasGyro += dx.segment<3>(12);
+}
+
+SlidingWindowSmoother::StateVector SlidingWindowSmoother::difference(const NavState& state, const NavState& linearizationPoint)
+{
+    StateVector dx;
+    dx.segment<3>(0) = math::logMapQuat(linearizationPoint.e_Quat_b.conjugate() * state.e_Quat_b);
+    dx.segment<3>(3) = state.e_velocity - linearizationPoint.e_velocity;
+    dx.segment<3>(6) = state.e_position - linearizationPoint.e_position;
+    dx.segment<3>(9) = state.b_biasAccel - linearizationPoint.b_biasAccel;
+    dx.segment<3>(12) = state.b_biasGyro - linearizationPoint.b_biasGyro;
+    return dx;
+}
+
+} // namespace NAV
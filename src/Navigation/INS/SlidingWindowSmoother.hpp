@@ -0,0 +1,217 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SlidingWindowSmoother.hpp
+/// @brief Fixed-lag sliding window smoother for the GNSS/INS integration
+/// @date 2026-10-18
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Navigation/Gravity/Gravity.hpp"
+#include "Navigation/INS/Preintegration.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV
+{
+
+/// @brief Nonlinear least squares estimator over a sliding window of navigation states.
+///
+/// Consecutive states are connected by preintegrated IMU factors and bias random walk factors, GNSS position and velocity
+/// measurements are added as unary factors. The window is solved with Gauss-Newton iterations on the normal equations, which are
+/// block tridiagonal and therefore factorized with a block sparse Cholesky decomposition in O(n) without fill-in.
+/// States leaving the window are marginalized with the Schur complement into a prior on the oldest remaining state.
+///
+/// The error state of every navigation state is ordered [δφ, δv, δp, δb_a, δb_g] (right perturbation on the attitude).
+class SlidingWindowSmoother
+{
+  public:
+    /// Dimension of the error state of a single navigation state
+    static constexpr int StateDim = 15;
+    /// Covariance or information matrix of a single navigation state
+    using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+    /// Error state vector of a single navigation state
+    using StateVector = Eigen::Matrix<double, StateDim, 1>;
+
+    /// @brief Navigation state at a single epoch
+    struct NavState
+    {
+        InsTime insTime;                                           ///< Time of the state
+        Eigen::Quaterniond e_Quat_b = Eigen::Quaterniond::Identity(); ///< Attitude quaternion from body to ECEF frame
+        Eigen::Vector3d e_velocity = Eigen::Vector3d::Zero();      ///< Velocity in ECEF coordinates in [m/s]
+        Eigen::Vector3d e_position = Eigen::Vector3d::Zero();      ///< Position in ECEF coordinates in [m]
+        Eigen::Vector3d b_biasAccel = Eigen::Vector3d::Zero();     ///< Accelerometer bias in [m/s²], in body coordinates
+        Eigen::Vector3d b_biasGyro = Eigen::Vector3d::Zero();      ///< Gyroscope bias in [rad/s], in body coordinates
+    };
+
+    /// @brief Parameters of the smoother
+    struct Parameters
+    {
+        /// Length of the window in [s]. Older states are marginalized.
+        double windowLength = 3.0;
+        /// Maximum amount of Gauss-Newton iterations per call to optimize()
+        size_t maxIterations = 3;
+        /// Iterations stop when the norm of the state update falls below this value
+        double convergenceThreshold = 1e-6;
+        /// Power spectral density of the accelerometer bias random walk in [m² / s⁵]
+        Eigen::Vector3d sigma2_biasAccel = Eigen::Vector3d::Constant(1e-8);
+        /// Power spectral density of the gyroscope bias random walk in [rad² / s³]
+        Eigen::Vector3d sigma2_biasGyro = Eigen::Vector3d::Constant(1e-12);
+        /// Gravitation model used in the IMU factors
+        GravitationModel gravitationModel = GravitationModel::EGM96;
+    };
+
+    /// @brief Default Constructor
+    SlidingWindowSmoother() = default;
+
+    /// @brief Constructor
+    /// @param[in] parameters Parameters of the smoother
+    explicit SlidingWindowSmoother(const Parameters& parameters);
+
+    /// @brief Clears the window and starts it with a single state
+    /// @param[in] state Initial navigation state
+    /// @param[in] covariance Covariance of the initial state, ordered [δφ, δv, δp, δb_a, δb_g]
+    void initialize(const NavState& state, const StateMatrix& covariance);
+
+    /// @brief Adds a new state connected to the latest one by the preintegrated IMU measurements
+    /// @param[in] preintegrator IMU measurements preintegrated from the latest state to the new state
+    /// @param[in] insTime Time of the new state
+    /// @note The new state is initialized with the prediction of the preintegrated measurements
+    void addImuFactor(const ImuPreintegrator& preintegrator, const InsTime& insTime);
+
+    /// @brief Adds a GNSS position measurement to the latest state
+    /// @param[in] e_position Measured position of the antenna in ECEF coordinates in [m]
+    /// @param[in] e_covariance Covariance of the measurement in [m²]
+    /// @param[in] b_leverArm Lever arm from the IMU to the antenna in [m], in body coordinates
+    void addPositionMeasurement(const Eigen::Vector3d& e_position, const Eigen::Matrix3d& e_covariance,
+                                const Eigen::Vector3d& b_leverArm = Eigen::Vector3d::Zero());
+
+    /// @brief Adds a GNSS velocity measurement to the latest state
+    /// @param[in] e_velocity Measured velocity in ECEF coordinates in [m/s]
+    /// @param[in] e_covariance Covariance of the measurement in [m²/s²]
+    /// @note The rotation of the lever arm is neglected
+    void addVelocityMeasurement(const Eigen::Vector3d& e_velocity, const Eigen::Matrix3d& e_covariance);
+
+    /// @brief Runs Gauss-Newton iterations over the whole window
+    /// @return Amount of performed iterations
+    size_t optimize();
+
+    /// @brief Marginalizes all states which are older than the window length
+    /// @return The marginalized states in chronological order (fixed-lag smoothed solution)
+    std::vector<NavState> marginalize();
+
+    /// @brief Marginal covariance of the latest state from the last optimization
+    [[nodiscard]] StateMatrix latestCovariance() const;
+
+    /// @brief States in the window in chronological order
+    [[nodiscard]] std::vector<NavState> states() const;
+    /// @brief Latest state in the window
+    [[nodiscard]] const NavState& latest() const { return _window.back().state; }
+    /// @brief Oldest state in the window
+    [[nodiscard]] const NavState& oldest() const { return _window.front().state; }
+    /// @brief Amount of states in the window
+    [[nodiscard]] size_t size() const { return _window.size(); }
+    /// @brief Whether the window is empty
+    [[nodiscard]] bool empty() const { return _window.empty(); }
+
+    /// @brief Parameters of the smoother
+    [[nodiscard]] Parameters& parameters() { return _parameters; }
+
+  private:
+    /// @brief Unary measurement on a single state
+    struct Measurement
+    {
+        Eigen::Vector3d z;                                    ///< Measured value
+        Eigen::Matrix3d information;                          ///< Inverse of the measurement covariance
+        Eigen::Vector3d b_leverArm = Eigen::Vector3d::Zero(); ///< Lever arm from the IMU to the antenna in [m]
+    };
+
+    /// @brief Navigation state together with the factors connecting it to the previous state
+    struct Entry
+    {
+        NavState state;                         ///< Navigation state
+        ImuPreintegrator preintegrator;         ///< Preintegrated IMU measurements from the previous state (empty for the first state)
+        std::vector<Measurement> positions;     ///< GNSS position measurements
+        std::vector<Measurement> velocities;    ///< GNSS velocity measurements
+        Eigen::Vector3d e_gravitation = Eigen::Vector3d::Zero();                                                  ///< Gravitation at the cached position in [m/s²]
+        Eigen::Vector3d e_gravitationPosition = Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity()); ///< Position the gravitation was calculated at
+    };
+
+    /// @brief Linearized factor between two consecutive states
+    struct BinaryLinearization
+    {
+        StateMatrix H_ii; ///< Information block of state i
+        StateMatrix H_ij; ///< Information block between state i and j
+        StateMatrix H_jj; ///< Information block of state j
+        StateVector g_i;  ///< Gradient of state i
+        StateVector g_j;  ///< Gradient of state j
+    };
+
+    /// @brief Linearizes the IMU and bias random walk factor between two consecutive states
+    /// @param[in] entry_i Previous state
+    /// @param[in] entry_j Current state with the preintegrated measurements from entry_i
+    [[nodiscard]] BinaryLinearization linearizeImuFactor(const Entry& entry_i, const Entry& entry_j) const;
+
+    /// @brief Adds the GNSS measurements of an entry to the normal equations of its state
+    /// @param[in] entry State with measurements
+    /// @param[in, out] H Information block of the state
+    /// @param[in, out] g Gradient of the state
+    static void addMeasurements(const Entry& entry, StateMatrix& H, StateVector& g);
+
+    /// @brief Adds the marginalization prior to the normal equations of the oldest state
+    /// @param[in, out] H Information block of the state
+    /// @param[in, out] g Gradient of the state
+    void addPrior(StateMatrix& H, StateVector& g) const;
+
+    /// @brief Updates the cached gravitation, if the position changed significantly
+    /// @param[in, out] entry Entry to update
+    void updateGravitation(Entry& entry) const;
+
+    /// @brief Applies an error state to a navigation state
+    /// @param[in, out] state State to correct
+    /// @param[in] dx Error state [δφ, δv, δp, δb_a, δb_g]
+    static void retract(NavState& state, const StateVector& dx);
+
+    /// @brief Difference between two navigation states in the error state space (x ⊟ x_lin)
+    /// @param[in] state Navigation state x
+    /// @param[in] linearizationPoint Navigation state x_lin
+    [[nodiscard]] static StateVector difference(const NavState& state, const NavState& linearizationPoint);
+
+    /// Parameters of the smoother
+    Parameters _parameters;
+
+    /// States in the window
+    std::deque<Entry> _window;
+
+    /// Information matrix of the prior on the oldest state
+    StateMatrix _priorInformation = StateMatrix::Zero();
+    /// Gradient of the prior at the linearization point
+    StateVector _priorGradient = StateVector::Zero();
+    /// Linearization point of the prior
+    NavState _priorLinearizationPoint;
+
+    /// Diagonal blocks of the normal equations, overwritten by the Cholesky factors L_kk
+    std::vector<StateMatrix> _H_diag;
+    /// Blocks (k, k-1) below the diagonal of the normal equations, overwritten by the Cholesky factors L_k,k-1
+    std::vector<StateMatrix> _H_lower;
+    /// Right hand side of the normal equations per state
+    std::vector<StateVector> _rhs;
+
+    /// Information of the latest state after eliminating all older states in the last factorization
+    StateMatrix _latestInformation = StateMatrix::Zero();
+    /// Whether the last factorization succeeded
+    bool _factorized = false;
+};
+
+} // namespace NAV
@@ -0,0 +1,243 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AllanVariance.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include <Eigen/Dense>
+
+namespace NAV
+{
+
+namespace
+{
+
+/// Minimum amount of decimated samples a cluster spans
+constexpr size_t RESOLUTION = 32;
+
+/// Allan deviation of a first order Gauss-Markov process at its maximum, relative to the standard deviation of the process
+constexpr double GAUSS_MARKOV_PEAK_ADEV = 0.6174;
+/// Averaging time of the maximum Allan deviation of a first order Gauss-Markov process, relative to the correlation time
+constexpr double GAUSS_MARKOV_PEAK_TAU = 1.893;
+
+/// @brief Regressors of the noise terms [Q^2, N^2, B^2, K^2, R^2]
+/// @param[in] tau Averaging time [s]
+Eigen::Matrix<double, 5, 1> noiseRegressors(double tau)
+{
+    return { 3.0 / (tau * tau), 1.0 / tau, 2.0 * std::numbers::ln2 / std::numbers::pi, tau / 3.0, tau * tau / 2.0 };
+}
+
+} // namespace
+
+AllanVariance::AllanVariance(size_t channels, size_t maxClusterSize, size_t clustersPerDecade, bool hadamard)
+    : _channels(channels), _hadamard(hadamard), _reference(Eigen::VectorXd::Zero(static_cast<Eigen::Index>(channels))), _theta(_reference)
+{
+    clustersPerDecade = std::max(clustersPerDecade, size_t(1));
+
+    // Log-spaced cluster sizes, rounded to a multiple of the decimation of their level
+    std::vector<std::pair<size_t, size_t>> sizes; // (level, m)
+    for (size_t i = 0;; i++)
+    {
+        auto m = static_cast<size_t>(std::round(std::pow(10.0, static_cast<double>(i) / static_cast<double>(clustersPerDecade))));
+        if (m > maxClusterSize) { break; }
+        size_t level = m < 2 * RESOLUTION ? 0 : static_cast<size_t>(std::floor(std::log2(static_cast<double>(m) / RESOLUTION)));
+        size_t decimation = size_t(1) << level;
+        m = std::max(size_t(1), (m + decimation / 2) / decimation) * decimation;
+        if (sizes.empty() || sizes.back().second != m) { sizes.emplace_back(level, m); }
+    }
+
+    for (const auto& [level, m] : sizes)
+    {
+        while (_levels.size() <= level)
+        {
+            auto& newLevel = _levels.emplace_back();
+            newLevel.decimation = size_t(1) << (_levels.size() - 1);
+        }
+        auto& lvl = _levels.at(level);
+        lvl.clusters.push_back(ClusterState{ .m = m,
+                                             .q = m / lvl.decimation,
+                                             .sum = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(channels)),
+                                             .hadamardSum = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(channels)) });
+    }
+    for (auto& level : _levels)
+    {
+        size_t maxQ = level.clusters.empty() ? 0 : level.clusters.back().q;
+        level.buffer = Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(channels), static_cast<Eigen::Index>((_hadamard ? 3 : 2) * maxQ + 1));
+    }
+}
+
+void AllanVariance::addSample(const Eigen::Ref<const Eigen::VectorXd>& sample)
+{
+    if (_sampleCount == 0)
+    {
+        _reference = sample;
+        _theta.setZero();
+        for (auto& level : _levels) { addToLevel(level, _theta); }
+    }
+
+    _theta += sample - _reference;
+    _sampleCount++;
+
+    for (auto& level : _levels)
+    {
+        if (_sampleCount % level.decimation == 0) { addToLevel(level, _theta); }
+    }
+}
+
+void AllanVariance::addToLevel(Level& level, const Eigen::VectorXd& theta) const
+{
+    auto capacity = static_cast<size_t>(level.buffer.cols());
+    if (capacity == 0) { return; }
+
+    size_t j = level.count++;
+    level.buffer.col(static_cast<Eigen::Index>(j % capacity)) = theta;
+    auto col = [&](size_t idx) { return level.buffer.col(static_cast<Eigen::Index>(idx % capacity)); };
+
+    for (auto& cluster : level.clusters)
+    {
+        if (j < 2 * cluster.q) { break; } // Clusters are sorted ascending
+
+        auto theta_m = col(j - cluster.q);
+        auto theta_2m = col(j - 2 * cluster.q);
+        cluster.sum += (theta - 2.0 * theta_m + theta_2m).array().square().matrix();
+        cluster.terms++;
+
+        if (_hadamard && j >= 3 * cluster.q)
+        {
+            auto theta_3m = col(j - 3 * cluster.q);
+            cluster.hadamardSum += (theta - 3.0 * theta_m + 3.0 * theta_2m - theta_3m).array().square().matrix();
+            cluster.hadamardTerms++;
+        }
+    }
+}
+
+std::vector<AllanVariance::Cluster> AllanVariance::clusters() const
+{
+    std::vector<Cluster> clusters;
+    for (const auto& level : _levels)
+    {
+        for (const auto& state : level.clusters)
+        {
+            if (state.terms == 0) { continue; }
+            // The angles are in [unit * samples], which cancels the sample interval: σ² = Σ(Δ²θ)² / (2 τ² n) = Σ(Δ²θ)² / (2 m² n)
+            auto m2 = static_cast<double>(state.m) * static_cast<double>(state.m);
+            Cluster cluster{ .m = state.m,
+                             .terms = state.terms,
+                             .allanVariance = state.sum / (2.0 * m2 * static_cast<double>(state.terms)),
+                             .hadamardTerms = state.hadamardTerms,
+                             .hadamardVariance = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(_channels)) };
+            if (state.hadamardTerms > 0)
+            {
+                cluster.hadamardVariance = state.hadamardSum / (6.0 * m2 * static_cast<double>(state.hadamardTerms));
+            }
+            clusters.push_back(std::move(cluster));
+        }
+    }
+    std::sort(clusters.begin(), clusters.end(), [](const Cluster& lhs, const Cluster& rhs) { return lhs.m < rhs.m; });
+    return clusters;
+}
+
+double allanVarianceDegreesOfFreedom(size_t samples, size_t m)
+{
+    auto N = static_cast<double>(samples);
+    auto M = static_cast<double>(m);
+    if (samples < 2 * m + 1) { return 1.0; }
+    double edf = (3.0 * (N - 1.0) / (2.0 * M) - 2.0 * (N - 2.0) / N) * 4.0 * M * M / (4.0 * M * M + 5.0);
+    return std::max(edf, 1.0);
+}
+
+double AllanNoiseParameters::allanVariance(double tau) const
+{
+    Eigen::Matrix<double, 5, 1> c(std::pow(quantization, 2), std::pow(whiteNoise, 2), std::pow(biasInstability, 2),
+                                  std::pow(randomWalk, 2), std::pow(rateRamp, 2));
+    return noiseRegressors(tau).dot(c);
+}
+
+AllanNoiseParameters fitAllanNoiseParameters(const std::vector<double>& tau, const std::vector<double>& allanVariance,
+                                             const std::vector<double>& degreesOfFreedom)
+{
+    AllanNoiseParameters params;
+
+    // Relative residuals r = (φ^T c - σ²) / σ², weighted with the degrees of freedom
+    std::vector<size_t> rows;
+    for (size_t i = 0; i < std::min({ tau.size(), allanVariance.size(), degreesOfFreedom.size() }); i++)
+    {
+        if (tau.at(i) > 0.0 && allanVariance.at(i) > 0.0 && std::isfinite(allanVariance.at(i))) { rows.push_back(i); }
+    }
+    if (rows.empty()) { return params; }
+
+    Eigen::MatrixXd A(rows.size(), 5);
+    Eigen::VectorXd b(rows.size());
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        size_t i = rows.at(r);
+        double w = std::sqrt(std::max(degreesOfFreedom.at(i), 1.0));
+        A.row(static_cast<Eigen::Index>(r)) = w * noiseRegressors(tau.at(i)).transpose() / allanVariance.at(i);
+        b(static_cast<Eigen::Index>(r)) = w;
+    }
+    // The regressors differ by orders of magnitude, so the columns are normalized
+    Eigen::Matrix<double, 5, 1> scale = A.colwise().norm().transpose();
+
+    // Non-negative least squares by testing every subset of the noise terms (only 31 subsets)
+    Eigen::Matrix<double, 5, 1> best = Eigen::Matrix<double, 5, 1>::Zero();
+    double bestCost = std::numeric_limits<double>::infinity();
+    for (unsigned subset = 1; subset < (1U << 5U); subset++)
+    {
+        std::vector<Eigen::Index> cols;
+        for (Eigen::Index k = 0; k < 5; k++)
+        {
+            if (subset & (1U << static_cast<unsigned>(k))) { cols.push_back(k); }
+        }
+        if (cols.size() > rows.size()) { continue; }
+
+        Eigen::MatrixXd As(A.rows(), static_cast<Eigen::Index>(cols.size()));
+        for (size_t k = 0; k < cols.size(); k++) { As.col(static_cast<Eigen::Index>(k)) = A.col(cols.at(k)) / scale(cols.at(k)); }
+        Eigen::VectorXd x = As.colPivHouseholderQr().solve(b);
+        if ((x.array() < 0.0).any() || !x.allFinite()) { continue; }
+
+        double cost = (As * x - b).squaredNorm();
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            best.setZero();
+            for (size_t k = 0; k < cols.size(); k++) { best(cols.at(k)) = x(static_cast<Eigen::Index>(k)) / scale(cols.at(k)); }
+        }
+    }
+
+    params.quantization = std::sqrt(best(0));
+    params.whiteNoise = std::sqrt(best(1));
+    params.biasInstability = std::sqrt(best(2));
+    params.randomWalk = std::sqrt(best(3));
+    params.rateRamp = std::sqrt(best(4));
+
+    // Gauss-Markov process with its Allan deviation peak at the minimum of the fitted curve
+    double tauMin = tau.at(rows.front());
+    double tauMax = tau.at(rows.back());
+    double minTau = tauMin;
+    double minVariance = std::numeric_limits<double>::infinity();
+    constexpr size_t STEPS = 200;
+    for (size_t s = 0; s <= STEPS; s++)
+    {
+        double t = tauMin * std::pow(tauMax / tauMin, static_cast<double>(s) / STEPS);
+        if (double variance = params.allanVariance(t); variance < minVariance)
+        {
+            minVariance = variance;
+            minTau = t;
+        }
+    }
+    params.gaussMarkovStdDev = std::sqrt(minVariance) / GAUSS_MARKOV_PEAK_ADEV;
+    params.gaussMarkovCorrelationTime = minTau / GAUSS_MARKOV_PEAK_TAU;
+
+    return params;
+}
+
+} // namespace NAV
@@ -0,0 +1,137 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AllanVariance.hpp
+/// @brief Streaming overlapping Allan and Hadamard variance and the fit of the IEEE noise terms
+/// @date 2026-10-18
+/// @note See \cite IEEE-Std-952-1997 IEEE Std 952-1997 - Specification Format Guide and Test Procedure for Single-Axis Interferometric Fiber Optic Gyros, Annex C
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace NAV
+{
+
+/// @brief Streaming calculation of the overlapping Allan variance (and optionally the Hadamard variance)
+///
+/// The samples are integrated into the angle (or velocity) sequence \f$ \theta_k \f$. The cluster sizes are log-spaced up to
+/// a maximum. Small clusters use every sample, larger clusters use the sequence decimated by a power of two, so that every
+/// cluster spans at least 32 decimated samples. The overlapping estimate is then evaluated with a stride of the decimation,
+/// which keeps the memory bounded by the amount of cluster sizes, independent of the length of the recording.
+class AllanVariance
+{
+  public:
+    /// @brief Variances of one cluster size
+    struct Cluster
+    {
+        size_t m = 0;                     ///< Cluster size [samples]
+        size_t terms = 0;                 ///< Amount of summed Allan variance terms
+        Eigen::VectorXd allanVariance;    ///< Allan variance for each channel [unit^2]
+        size_t hadamardTerms = 0;         ///< Amount of summed Hadamard variance terms
+        Eigen::VectorXd hadamardVariance; ///< Hadamard variance for each channel [unit^2]
+    };
+
+    /// @brief Constructor
+    /// @param[in] channels Amount of channels (e.g. 6 for accelerometer and gyroscope axes)
+    /// @param[in] maxClusterSize Largest cluster size [samples]
+    /// @param[in] clustersPerDecade Amount of log-spaced cluster sizes per decade
+    /// @param[in] hadamard Whether to calculate the Hadamard variance as well
+    AllanVariance(size_t channels, size_t maxClusterSize, size_t clustersPerDecade = 10, bool hadamard = false);
+
+    /// @brief Adds a sample
+    /// @param[in] sample Value of each channel
+    void addSample(const Eigen::Ref<const Eigen::VectorXd>& sample);
+
+    /// @brief Amount of added samples
+    [[nodiscard]] size_t sampleCount() const { return _sampleCount; }
+
+    /// @brief Amount of channels
+    [[nodiscard]] size_t channels() const { return _channels; }
+
+    /// @brief Variances of all cluster sizes with at least one term
+    [[nodiscard]] std::vector<Cluster> clusters() const;
+
+  private:
+    /// @brief Cluster size state
+    struct ClusterState
+    {
+        size_t m = 0;                      ///< Cluster size [samples]
+        size_t q = 0;                      ///< Cluster size [decimated samples]
+        size_t terms = 0;                  ///< Amount of summed Allan variance terms
+        Eigen::VectorXd sum;               ///< Sum of the squared second differences
+        size_t hadamardTerms = 0;          ///< Amount of summed Hadamard variance terms
+        Eigen::VectorXd hadamardSum;       ///< Sum of the squared third differences
+    };
+
+    /// @brief Decimated angle sequence shared by the clusters of the same decimation
+    struct Level
+    {
+        size_t decimation = 1;              ///< Decimation [samples]
+        Eigen::MatrixXd buffer;             ///< Ring buffer of the latest decimated angles (one column per angle)
+        size_t count = 0;                   ///< Amount of decimated angles added
+        std::vector<ClusterState> clusters; ///< Clusters using this level
+    };
+
+    /// @brief Adds an angle to a level and accumulates the terms of its clusters
+    /// @param[in] level Level to add the angle to
+    /// @param[in] theta Angle of each channel
+    void addToLevel(Level& level, const Eigen::VectorXd& theta) const;
+
+    size_t _channels = 0;                ///< Amount of channels
+    bool _hadamard = false;              ///< Whether to calculate the Hadamard variance
+    size_t _sampleCount = 0;             ///< Amount of added samples
+    Eigen::VectorXd _reference;          ///< First sample, subtracted to keep the integrated angles small
+    Eigen::VectorXd _theta;              ///< Integrated angle sequence [unit * samples]
+    std::vector<Level> _levels;          ///< Decimation levels
+};
+
+/// @brief Equivalent degrees of freedom of the overlapping Allan variance for white noise
+/// @param[in] samples Amount of samples
+/// @param[in] m Cluster size [samples]
+/// @return Equivalent degrees of freedom (at least 1)
+/// @note See \cite Howe1981 Howe et al. (1981) - Properties of signal sources and measurement methods
+[[nodiscard]] double allanVarianceDegreesOfFreedom(size_t samples, size_t m);
+
+/// @brief Noise terms of the Allan variance
+///
+/// \f[ \sigma^2(\tau) = \frac{3 Q^2}{\tau^2} + \frac{N^2}{\tau} + \frac{2 \ln 2}{\pi} B^2 + \frac{K^2 \tau}{3} + \frac{R^2 \tau^2}{2} \f]
+struct AllanNoiseParameters
+{
+    double quantization = 0.0;    ///< Quantization noise Q [unit * s]
+    double whiteNoise = 0.0;      ///< White noise (angle/velocity random walk) N [unit / √(Hz)]
+    double biasInstability = 0.0; ///< Bias instability B [unit]
+    double randomWalk = 0.0;      ///< Rate random walk K [unit * √(Hz)]
+    double rateRamp = 0.0;        ///< Rate ramp R [unit / s]
+
+    /// Standard deviation of a first order Gauss-Markov process matching the minimum of the fitted Allan deviation [unit]
+    double gaussMarkovStdDev = 0.0;
+    /// Correlation time of a first order Gauss-Markov process matching the minimum of the fitted Allan deviation [s]
+    double gaussMarkovCorrelationTime = 0.0;
+
+    /// @brief Evaluates the Allan variance of the noise terms
+    /// @param[in] tau Averaging time [s]
+    /// @return Allan variance [unit^2]
+    [[nodiscard]] double allanVariance(double tau) const;
+};
+
+/// @brief Fits the noise terms to the Allan variance with non-negative weighted least squares
+///
+/// The relative residuals are weighted with the equivalent degrees of freedom of the estimates, so that the fit follows the
+/// well determined short averaging times closely without ignoring the long ones.
+/// @param[in] tau Averaging times [s]
+/// @param[in] allanVariance Allan variance of one channel [unit^2]
+/// @param[in] degreesOfFreedom Equivalent degrees of freedom of each estimate
+/// @return Fitted noise terms
+[[nodiscard]] AllanNoiseParameters fitAllanNoiseParameters(const std::vector<double>& tau, const std::vector<double>& allanVariance,
+                                                           const std::vector<double>& degreesOfFreedom);
+
+} // namespace NAV
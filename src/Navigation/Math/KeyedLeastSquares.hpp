@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <Eigen/Cholesky>
+
 #include "util/Container/KeyedMatrix.hpp"
 
 namespace NAV
@@ -26,6 +28,17 @@ struct KeyedLeastSquaresResult
     KeyedMatrixX<Scalar, StateKeyType, StateKeyType> variance; ///< Least squares variance
 };
 
+/// @brief Intermediate results of the least squares solution, which are kept to reuse their memory
+template<typename Scalar>
+struct LeastSquaresWorkspace
+{
+    Eigen::MatrixX<Scalar> HtW;             ///< Transposed design matrix times weight matrix
+    Eigen::MatrixX<Scalar> N;               ///< Normal equation matrix
+    Eigen::VectorX<Scalar> n;               ///< Right hand side of the normal equations
+    Eigen::VectorX<Scalar> Wdz;             ///< Weighted residual vector
+    Eigen::LLT<Eigen::MatrixX<Scalar>> llt; ///< Cholesky decomposition of the normal equation matrix
+};
+
 /// @brief Finds the "least squares" solution for the equation \f$ \mathbf{v} = \mathbf{dz} - \mathbf{H} \mathbf{x} \f$
 ///
 /// Minimizes the functional (see LeastSquares.hpp)
@@ -137,4 +150,86 @@ KeyedLeastSquaresResult<Scalar, StateKeyType>
     return { .solution = dx, .variance = Q };
 }
 
+/// @brief Finds the "least squares" solution into preallocated storage
+///
+/// Same as solveLinearLeastSquaresUncertainties(), but the normal equations are solved by a Cholesky decomposition
+/// and nothing is allocated when the problem has the same size and keys as in the last call.
+/// @param[in, out] result Least squares solution and variance
+/// @param[in, out] workspace Intermediate results
+/// @param[in] H Design Matrix
+/// @param[in] dz Residual vector
+template<typename Scalar, typename StateKeyType, typename MeasKeyType>
+void solveLinearLeastSquaresUncertainties(KeyedLeastSquaresResult<Scalar, StateKeyType>& result, LeastSquaresWorkspace<Scalar>& workspace,
+                                          const KeyedMatrixX<Scalar, MeasKeyType, StateKeyType>& H, const KeyedVectorX<Scalar, MeasKeyType>& dz)
+{
+    result.solution.setRowKeys(H.colKeys());
+    result.variance.setRowKeys(H.colKeys());
+    result.variance.setColKeys(H.colKeys());
+
+    // Cofactor matrix
+    workspace.N.noalias() = H(all, all).transpose() * H(all, all);
+    workspace.llt.compute(workspace.N);
+    result.variance(all, all).setIdentity();
+    workspace.llt.solveInPlace(result.variance(all, all));
+    LOG_DATA("Q = \n{}", result.variance(all, all));
+
+    // Least squares solution
+    workspace.n.noalias() = H(all, all).transpose() * dz(all);
+    result.solution(all).noalias() = result.variance(all, all) * workspace.n;
+    LOG_DATA("dx = {}", result.solution(all).transpose());
+
+    // Estimated error variance (reduced chi-squared statistic)
+    double sigma2 = dz(all).squaredNorm() / static_cast<double>(H.rows() - H.cols());
+    LOG_DATA("sigma2 = {}", sigma2);
+
+    // Covariance matrix
+    result.variance(all, all) *= sigma2;
+    LOG_DATA("variance = \n{}", result.variance(all, all));
+}
+
+/// @brief Finds the "weighted least squares" solution into preallocated storage
+///
+/// Same as solveWeightedLinearLeastSquaresUncertainties(), but the normal equations are solved by a Cholesky decomposition
+/// and nothing is allocated when the problem has the same size and keys as in the last call.
+/// @param[in, out] result Weighted least squares solution and variance
+/// @param[in, out] workspace Intermediate results
+/// @param[in] H Design Matrix
+/// @param[in] W Weight matrix
+/// @param[in] dz Residual vector
+template<typename Scalar, typename StateKeyType, typename MeasKeyType>
+void solveWeightedLinearLeastSquaresUncertainties(KeyedLeastSquaresResult<Scalar, StateKeyType>& result, LeastSquaresWorkspace<Scalar>& workspace,
+                                                  const KeyedMatrixX<Scalar, MeasKeyType, StateKeyType>& H, const KeyedMatrixX<Scalar, MeasKeyType, MeasKeyType>& W,
+                                                  const KeyedVectorX<Scalar, MeasKeyType>& dz)
+{
+    result.solution.setRowKeys(H.colKeys());
+    result.variance.setRowKeys(H.colKeys());
+    result.variance.setColKeys(H.colKeys());
+
+    // Cofactor matrix
+    workspace.HtW.noalias() = H(all, all).transpose() * W(all, all);
+    workspace.N.noalias() = workspace.HtW * H(all, all);
+    workspace.llt.compute(workspace.N);
+    result.variance(all, all).setIdentity();
+    workspace.llt.solveInPlace(result.variance(all, all));
+    LOG_DATA("Q = \n{}", result.variance(all, all));
+
+    // Least squares solution
+    workspace.n.noalias() = workspace.HtW * dz(all);
+    result.solution(all).noalias() = result.variance(all, all) * workspace.n;
+    LOG_DATA("dx = {}", result.solution(all).transpose());
+
+    // Residual sum of squares
+    workspace.Wdz.noalias() = W(all, all) * dz(all);
+    double RSS = dz(all).dot(workspace.Wdz);
+    LOG_DATA("RSS = {}", RSS);
+
+    // Estimated error variance (reduced chi-squared statistic)
+    double sigma2 = RSS / static_cast<double>(H.rows() - H.cols());
+    LOG_DATA("sigma2 = {}", sigma2);
+
+    // Covariance matrix
+    result.variance(all, all) *= sigma2;
+    LOG_DATA("Covariance matrix = \n{}", result.variance(all, all));
+}
+
 } // namespace NAV
\ No newline at end of file
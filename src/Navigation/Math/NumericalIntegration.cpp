@@ -29,6 +29,8 @@ const char* to_string(IntegrationAlgorithm algorithm)
         return "Runge Kutta 3rd Order";
     case IntegrationAlgorithm::RungeKutta4:
         return "Runge Kutta 4th Order";
+    case IntegrationAlgorithm::DormandPrince45:
+        return "Dormand Prince 5th Order";
     case IntegrationAlgorithm::COUNT:
         return "";
     }
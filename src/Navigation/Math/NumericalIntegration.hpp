@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <type_traits>
 
 namespace NAV
@@ -23,12 +27,13 @@ enum class IntegrationAlgorithm
 {
     // RectangularRule, ///< Rectangular rule
     // Simpson,         ///< Simpson
-    Heun,        ///< Heun's method
-    RungeKutta1, ///< Runge-Kutta 1st order
-    RungeKutta2, ///< Runge-Kutta 2nd order
-    RungeKutta3, ///< Runge-Kutta 3rd order
-    RungeKutta4, ///< Runge-Kutta 4th order
-    COUNT,       ///< Amount of available integration algorithms
+    Heun,            ///< Heun's method
+    RungeKutta1,     ///< Runge-Kutta 1st order
+    RungeKutta2,     ///< Runge-Kutta 2nd order
+    RungeKutta3,     ///< Runge-Kutta 3rd order
+    RungeKutta4,     ///< Runge-Kutta 4th order
+    DormandPrince45, ///< Dormand-Prince 5th order
+    COUNT,           ///< Amount of available integration algorithms
 };
 
 /// @brief Heun's method
@@ -188,6 +193,261 @@ Y RungeKutta4(const auto& f, const Scalar& h, const Y& n_y, const auto& c)
     return n_y + h / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
 }
 
+namespace internal
+{
+
+/// @brief Evaluates the model function with or without the time argument
+/// @param[in] f Model function f(y, t, c) or f(y, c)
+/// @param[in] y State vector
+/// @param[in] t Time to evaluate the model function at in [s]
+/// @param[in] c Constant information needed to calculate the model function
+/// @return The derivative of the state vector
+template<typename Y, typename Scalar, typename F, typename C>
+Y evaluate(const F& f, const Y& y, const Scalar& t, const C& c)
+{
+    if constexpr (std::is_invocable_v<const F&, const Y&, const Scalar&, const C&>) { return f(y, t, c); }
+    else { return f(y, c); }
+}
+
+/// @brief Root mean square of the error, scaled with the absolute and relative tolerance
+/// @param[in] error Error estimate of the step
+/// @param[in] y0 State vector at the start of the step
+/// @param[in] y1 State vector at the end of the step
+/// @param[in] absTol Absolute tolerance
+/// @param[in] relTol Relative tolerance
+/// @return Error norm, which is <= 1 if the step is accepted
+template<typename Y, typename Scalar>
+Scalar scaledErrorNorm(const Y& error, const Y& y0, const Y& y1, const Scalar& absTol, const Scalar& relTol)
+{
+    if constexpr (std::is_floating_point_v<Y>)
+    {
+        return std::abs(error) / (absTol + relTol * std::max(std::abs(y0), std::abs(y1)));
+    }
+    else // Evaluated as one expression, so that no temporaries are created
+    {
+        return std::sqrt((error.array() / (absTol + relTol * y0.array().abs().max(y1.array().abs()))).square().mean());
+    }
+}
+
+} // namespace internal
+
+/// @brief Result of a Dormand-Prince 5(4) step
+template<typename Y>
+struct DormandPrince45Result
+{
+    Y y;     ///< State vector at time t_(n+1) (5th order solution)
+    Y error; ///< Difference between the 5th and 4th order solution
+    Y dy;    ///< Derivative at time t_(n+1), which is reused as the first stage of the next step
+    Y r3;    ///< Coefficient of the dense output
+    Y r4;    ///< Coefficient of the dense output
+    Y r5;    ///< Coefficient of the dense output
+};
+
+/// @brief Dormand-Prince 5(4) step with given derivative at the start of the step (first same as last)
+/// @param[in] f Model function f(y, t, c) or f(y, c)
+/// @param[in] h Integration step in [s]
+/// @param[in] n_y State vector at time n_t
+/// @param[in] n_dy Derivative at time n_t
+/// @param[in] n_t Time to evaluate the model function at in [s]
+/// @param[in] c Constant information needed to calculate the model function
+/// @return Solution, error estimate and dense output coefficients
+/// @note All stages are stored in Y, so fixed-size Eigen states do not allocate any memory
+/// @note J. R. Dormand, P. J. Prince (1980): A family of embedded Runge-Kutta formulae. J. Comput. Appl. Math. 6(1)
+template<typename Y, typename Scalar,
+         typename = std::enable_if_t<std::is_floating_point_v<Scalar>>>
+DormandPrince45Result<Y> DormandPrince45Step(const auto& f, const Scalar& h, const Y& n_y, const Y& n_dy, const Scalar& n_t, const auto& c)
+{
+    const Y& k1 = n_dy;
+    Y k2 = internal::evaluate<Y>(f, Y(n_y + h * (1.0 / 5.0 * k1)), n_t + h / 5, c);
+    Y k3 = internal::evaluate<Y>(f, Y(n_y + h * (3.0 / 40.0 * k1 + 9.0 / 40.0 * k2)), n_t + h * 3 / 10, c);
+    Y k4 = internal::evaluate<Y>(f, Y(n_y + h * (44.0 / 45.0 * k1 - 56.0 / 15.0 * k2 + 32.0 / 9.0 * k3)), n_t + h * 4 / 5, c);
+    Y k5 = internal::evaluate<Y>(f, Y(n_y + h * (19372.0 / 6561.0 * k1 - 25360.0 / 2187.0 * k2 + 64448.0 / 6561.0 * k3 - 212.0 / 729.0 * k4)), n_t + h * 8 / 9, c);
+    Y k6 = internal::evaluate<Y>(f, Y(n_y + h * (9017.0 / 3168.0 * k1 - 355.0 / 33.0 * k2 + 46732.0 / 5247.0 * k3 + 49.0 / 176.0 * k4 - 5103.0 / 18656.0 * k5)), n_t + h, c);
+
+    DormandPrince45Result<Y> step;
+    step.y = n_y + h * (35.0 / 384.0 * k1 + 500.0 / 1113.0 * k3 + 125.0 / 192.0 * k4 - 2187.0 / 6784.0 * k5 + 11.0 / 84.0 * k6);
+    step.dy = internal::evaluate<Y>(f, step.y, n_t + h, c);
+    const Y& k7 = step.dy;
+
+    step.error = h * (71.0 / 57600.0 * k1 - 71.0 / 16695.0 * k3 + 71.0 / 1920.0 * k4 - 17253.0 / 339200.0 * k5 + 22.0 / 525.0 * k6 - 1.0 / 40.0 * k7);
+
+    // Dense output coefficients (E. Hairer, S. P. Nørsett, G. Wanner (1993): Solving Ordinary Differential Equations I, Section II.6)
+    step.r3 = h * k1 - (step.y - n_y);
+    step.r4 = (step.y - n_y) - h * k7 - step.r3;
+    step.r5 = h * (-12715105075.0 / 11282082432.0 * k1 + 87487479700.0 / 32700410799.0 * k3 - 10690763975.0 / 1880347072.0 * k4
+                   + 701980252875.0 / 199316789632.0 * k5 - 1453857185.0 / 822651844.0 * k6 + 69997945.0 / 29380423.0 * k7);
+    return step;
+}
+
+/// @brief Dormand-Prince 5th Order Algorithm
+/// @param[in] f Model function
+/// @param[in] h Integration step in [s]
+/// @param[in] n_y State vector at time n_t
+/// @param[in] n_t Time to evaluate the model function at in [s]
+/// @param[in] c Vector with constant information needed to calculate the model function
+/// @return State vector at time t_(n+1)
+template<typename Y, typename Scalar,
+         typename = std::enable_if_t<std::is_floating_point_v<Scalar>>>
+Y DormandPrince45(const auto& f, const Scalar& h, const Y& n_y, const Scalar& n_t, const auto& c)
+{
+    return DormandPrince45Step(f, h, n_y, Y(f(n_y, n_t, c)), n_t, c).y;
+}
+
+/// @brief Dormand-Prince 5th Order Algorithm
+/// @param[in] f Model function
+/// @param[in] h Integration step in [s]
+/// @param[in] n_y State vector at time n_t
+/// @param[in] c Vector with constant information needed to calculate the model function
+/// @return State vector at time t_(n+1)
+template<typename Y, typename Scalar,
+         typename = std::enable_if_t<std::is_floating_point_v<Scalar>>>
+Y DormandPrince45(const auto& f, const Scalar& h, const Y& n_y, const auto& c)
+{
+    return DormandPrince45Step(f, h, n_y, Y(f(n_y, c)), Scalar(0), c).y;
+}
+
+/// @brief Continuous solution between the start and end of an integration step
+template<typename Y, typename Scalar>
+class DenseOutput
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] t0 Time at the start of the step in [s]
+    /// @param[in] h Integration step in [s]
+    /// @param[in] y0 State vector at the start of the step
+    /// @param[in] step Result of the Dormand-Prince step
+    DenseOutput(const Scalar& t0, const Scalar& h, const Y& y0, const DormandPrince45Result<Y>& step)
+        : _t0(t0), _h(h), _y0(y0), _y1(step.y), _r3(step.r3), _r4(step.r4), _r5(step.r5) {}
+
+    /// @brief Time at the start of the step in [s]
+    [[nodiscard]] Scalar t0() const { return _t0; }
+    /// @brief Time at the end of the step in [s]
+    [[nodiscard]] Scalar t1() const { return _t0 + _h; }
+
+    /// @brief Interpolates the state with 4th order accuracy
+    /// @param[in] t Time in [s] between t0 and t1
+    /// @return State vector at time t
+    [[nodiscard]] Y operator()(const Scalar& t) const
+    {
+        Scalar theta = (t - _t0) / _h;
+        Scalar theta1 = 1 - theta;
+        return _y0 + theta * ((_y1 - _y0) + theta1 * (_r3 + theta * (_r4 + theta1 * _r5)));
+    }
+
+  private:
+    Scalar _t0; ///< Time at the start of the step in [s]
+    Scalar _h;  ///< Integration step in [s]
+    Y _y0;      ///< State vector at the start of the step
+    Y _y1;      ///< State vector at the end of the step
+    Y _r3;      ///< Coefficient of the dense output
+    Y _r4;      ///< Coefficient of the dense output
+    Y _r5;      ///< Coefficient of the dense output
+};
+
+/// @brief Settings of the adaptive step size control
+template<typename Scalar>
+struct AdaptiveStepOptions
+{
+    Scalar absTol = 1e-6;                                      ///< Absolute tolerance of the local error
+    Scalar relTol = 1e-6;                                      ///< Relative tolerance of the local error
+    Scalar initialStep = 0;                                    ///< Initial step in [s] (0 = estimated from the derivative)
+    Scalar minStep = 1e-12;                                    ///< Minimum step in [s]
+    Scalar maxStep = std::numeric_limits<Scalar>::infinity(); ///< Maximum step in [s]
+    size_t maxSteps = 100000;                                  ///< Maximum amount of steps (accepted and rejected)
+};
+
+/// @brief Statistics of an adaptive integration
+template<typename Scalar>
+struct AdaptiveStepStatistics
+{
+    size_t acceptedSteps = 0;       ///< Amount of accepted steps
+    size_t rejectedSteps = 0;       ///< Amount of rejected steps
+    size_t functionEvaluations = 0; ///< Amount of evaluations of the model function
+    Scalar lastStep = 0;            ///< Size of the last accepted step (without the shortening at the end) in [s]
+    bool success = false;           ///< Flag whether the end time was reached within the tolerance
+};
+
+/// @brief Integrates adaptively with the Dormand-Prince 5(4) method
+/// @param[in] f Model function f(y, t, c) or f(y, c)
+/// @param[in] t0 Start time in [s]
+/// @param[in] t1 End time in [s] (can be before the start time)
+/// @param[in] y0 State vector at time t0
+/// @param[in] c Constant information needed to calculate the model function
+/// @param[in] options Settings of the step size control
+/// @param[out] statistics Statistics of the integration (optional)
+/// @param[in] onStep Callback, which is called with the DenseOutput of each accepted step (optional)
+/// @return State vector at time t1 (or at the time the integration stopped, see AdaptiveStepStatistics::success)
+template<typename Y, typename Scalar, typename OnStep = std::nullptr_t,
+         typename = std::enable_if_t<std::is_floating_point_v<Scalar>>>
+Y DormandPrince45Adaptive(const auto& f, const Scalar& t0, const Scalar& t1, const Y& y0, const auto& c,
+                          const AdaptiveStepOptions<Scalar>& options = {}, AdaptiveStepStatistics<Scalar>* statistics = nullptr,
+                          const OnStep& onStep = nullptr)
+{
+    constexpr Scalar SAFETY = 0.9;
+    constexpr Scalar MIN_FACTOR = 0.2;
+    constexpr Scalar MAX_FACTOR = 10.0;
+
+    AdaptiveStepStatistics<Scalar> stats;
+    Scalar direction = t1 >= t0 ? 1 : -1;
+    Scalar t = t0;
+    Y y = y0;
+    Y dy = internal::evaluate<Y>(f, y, t, c);
+    stats.functionEvaluations++;
+
+    Scalar h = std::abs(options.initialStep);
+    if (h == 0) // E. Hairer, S. P. Nørsett, G. Wanner (1993): Solving Ordinary Differential Equations I, Section II.4
+    {
+        Scalar d0 = internal::scaledErrorNorm(y, y, y, options.absTol, options.relTol);
+        Scalar d1 = internal::scaledErrorNorm(dy, y, y, options.absTol, options.relTol);
+        Scalar h0 = d0 < 1e-5 || d1 < 1e-5 ? 1e-6 : 0.01 * d0 / d1;
+        h0 = std::min(h0, std::abs(t1 - t0));
+        Y dy1 = internal::evaluate<Y>(f, Y(y + direction * h0 * dy), t + direction * h0, c);
+        stats.functionEvaluations++;
+        Scalar d2 = internal::scaledErrorNorm(Y(dy1 - dy), y, y, options.absTol, options.relTol) / h0;
+        Scalar h1 = std::max(d1, d2) <= 1e-15 ? std::max(Scalar(1e-6), h0 * 1e-3)
+                                              : std::pow(0.01 / std::max(d1, d2), 1.0 / 5.0);
+        h = std::min(100 * h0, h1);
+    }
+    h = std::clamp(h, options.minStep, options.maxStep);
+
+    bool lastRejected = false;
+    while (direction * (t1 - t) > 0)
+    {
+        if (stats.acceptedSteps + stats.rejectedSteps >= options.maxSteps) { break; }
+
+        bool lastStep = std::abs(t1 - t) <= h;
+        Scalar step = lastStep ? t1 - t : direction * h;
+        auto result = DormandPrince45Step(f, step, y, dy, t, c);
+        stats.functionEvaluations += 6;
+
+        Scalar err = internal::scaledErrorNorm(result.error, y, result.y, options.absTol, options.relTol);
+        Scalar factor = err == 0 ? MAX_FACTOR : std::clamp(SAFETY * std::pow(err, -1.0 / 5.0), MIN_FACTOR, MAX_FACTOR);
+        if (err <= 1 || h <= options.minStep)
+        {
+            if constexpr (!std::is_null_pointer_v<OnStep>) { onStep(DenseOutput<Y, Scalar>(t, step, y, result)); }
+
+            if (!lastStep) { stats.lastStep = h; }
+            t = lastStep ? t1 : t + step;
+            y = result.y;
+            dy = result.dy;
+            stats.acceptedSteps++;
+            if (lastRejected) { factor = std::min(factor, Scalar(1)); } // Do not grow directly after a rejection
+            h = std::clamp(h * factor, options.minStep, options.maxStep);
+            lastRejected = false;
+        }
+        else
+        {
+            stats.rejectedSteps++;
+            h = std::max(h * factor, options.minStep);
+            lastRejected = true;
+        }
+    }
+
+    stats.success = direction * (t1 - t) <= 0;
+    if (statistics) { *statistics = stats; }
+    return y;
+}
+
 /// @brief Converts the enum to a string
 /// @param[in] algorithm Enum value to convert into text
 /// @return String representation of the enum
@@ -0,0 +1,53 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RobustEstimation.hpp"
+
+namespace NAV
+{
+
+const char* to_string(RobustWeightFunction weightFunction)
+{
+    switch (weightFunction)
+    {
+    case RobustWeightFunction::None:
+        return "None";
+    case RobustWeightFunction::Huber:
+        return "Huber";
+    case RobustWeightFunction::IGG3:
+        return "IGG-III";
+    case RobustWeightFunction::Danish:
+        return "Danish";
+    case RobustWeightFunction::COUNT:
+        return "";
+    }
+    return "";
+}
+
+double robustWeightFactor(RobustWeightFunction weightFunction, double standardizedResidual, double k0, double k1)
+{
+    double u = std::abs(standardizedResidual);
+    if (u <= k0) { return 1.0; }
+
+    switch (weightFunction)
+    {
+    case RobustWeightFunction::Huber:
+        return k0 / u;
+    case RobustWeightFunction::IGG3:
+        if (u > k1) { return 0.0; }
+        return k0 / u * std::pow((k1 - u) / (k1 - k0), 2);
+    case RobustWeightFunction::Danish:
+        return std::exp(1.0 - std::pow(u / k0, 2));
+    case RobustWeightFunction::None:
+    case RobustWeightFunction::COUNT:
+        break;
+    }
+    return 1.0;
+}
+
+} // namespace NAV
@@ -0,0 +1,129 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RobustEstimation.hpp
+/// @brief Robust M-estimation with iteratively reweighted least squares
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include <Eigen/Core>
+#include <Eigen/Dense>
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+/// Weight functions of robust M-estimators
+enum class RobustWeightFunction
+{
+    None,   ///< Every observation is treated as nominal (ordinary weighted least squares)
+    Huber,  ///< Huber (linear down-weighting outside of k0)
+    IGG3,   ///< IGG-III (Institute of Geodesy and Geophysics, three segments with rejection above k1)
+    Danish, ///< Danish method (exponential down-weighting outside of k0)
+    COUNT,  ///< Amount of items in the enum
+};
+
+/// @brief Converts the enum to a string
+/// @param[in] weightFunction Enum value to convert into text
+/// @return String representation of the enum
+[[nodiscard]] const char* to_string(RobustWeightFunction weightFunction);
+
+/// @brief Calculates the factor the weight of an observation is multiplied with
+///
+/// With the standardized residual \f$ u = |v| / \sigma_v \f$
+/// - Huber:  \f$ 1 \f$ for \f$ u \leq k_0 \f$, otherwise \f$ k_0 / u \f$
+/// - IGG-III: \f$ 1 \f$ for \f$ u \leq k_0 \f$, \f$ \frac{k_0}{u} \left( \frac{k_1 - u}{k_1 - k_0} \right)^2 \f$ for \f$ k_0 < u \leq k_1 \f$, otherwise \f$ 0 \f$
+/// - Danish: \f$ 1 \f$ for \f$ u \leq k_0 \f$, otherwise \f$ \exp\left(1 - u^2 / k_0^2\right) \f$
+/// @param[in] weightFunction Weight function to use
+/// @param[in] standardizedResidual Standardized residual u
+/// @param[in] k0 Threshold up to which the observation is treated as nominal
+/// @param[in] k1 Threshold above which the observation is rejected (IGG-III only)
+/// @return Weight factor in [0, 1]
+[[nodiscard]] double robustWeightFactor(RobustWeightFunction weightFunction, double standardizedResidual, double k0, double k1);
+
+/// @brief Robust least squares return value
+template<typename Scalar>
+struct RobustLeastSquaresResult
+{
+    Eigen::VectorX<Scalar> solution;      ///< Least squares solution
+    Eigen::MatrixX<Scalar> variance;      ///< Least squares variance
+    Eigen::VectorX<Scalar> weightFactors; ///< Factors the a priori weights were multiplied with
+    size_t iterations = 0;                ///< Amount of reweighting iterations
+};
+
+/// @brief Finds the robust weighted least squares solution with iteratively reweighted least squares (IRLS)
+///
+/// The standardized residuals are calculated with the a priori weights and the redundancy numbers, so a single
+/// outlier with high leverage is detected as well. The iteration stops if the weight factors converged, or if
+/// reweighting would leave less observations with non-zero weight than unknowns.
+/// @param[in] H Design Matrix
+/// @param[in] w A priori weights of the observations (inverse variances, diagonal of the weight matrix)
+/// @param[in] dz Residual vector
+/// @param[in] weightFunction Weight function to use
+/// @param[in] k0 Threshold up to which the observation is treated as nominal
+/// @param[in] k1 Threshold above which the observation is rejected (IGG-III only)
+/// @param[in] maxIterations Maximum amount of reweighting iterations
+/// @return Robust weighted least squares solution and variance
+template<typename DerivedA, typename DerivedW, typename DerivedB>
+RobustLeastSquaresResult<typename DerivedA::Scalar>
+    solveRobustWeightedLinearLeastSquaresUncertainties(const Eigen::MatrixBase<DerivedA>& H, const Eigen::MatrixBase<DerivedW>& w, const Eigen::MatrixBase<DerivedB>& dz,
+                                                       RobustWeightFunction weightFunction, double k0, double k1, size_t maxIterations = 10)
+{
+    using Scalar = typename DerivedA::Scalar;
+
+    RobustLeastSquaresResult<Scalar> result;
+    result.weightFactors = Eigen::VectorX<Scalar>::Ones(H.rows());
+
+    Eigen::VectorX<Scalar> wk = w;
+    Eigen::MatrixX<Scalar> Q;
+    for (size_t iteration = 0; iteration <= maxIterations; iteration++)
+    {
+        Q = (H.transpose() * wk.asDiagonal() * H).inverse();
+        result.solution = Q * H.transpose() * wk.asDiagonal() * dz;
+        result.iterations = iteration;
+        if (weightFunction == RobustWeightFunction::None || iteration == maxIterations) { break; }
+
+        Eigen::VectorX<Scalar> v = dz - H * result.solution;
+        Eigen::VectorX<Scalar> weightFactors(H.rows());
+        for (Eigen::Index i = 0; i < H.rows(); i++)
+        {
+            // Redundancy number of the observation, if it had its a priori weight
+            double redundancy = 1.0 - w(i) * H.row(i) * Q * H.row(i).transpose();
+            double u = std::abs(v(i)) * std::sqrt(w(i) / std::max(redundancy, 1e-6));
+            weightFactors(i) = robustWeightFactor(weightFunction, u, k0, k1);
+        }
+        LOG_DATA("Robust LSQ iteration {}: weight factors = {}", iteration, weightFactors.transpose());
+
+        if ((weightFactors.array() > 0.0).count() < H.cols())
+        {
+            LOG_DATA("Robust LSQ: Stopping reweighting, because too few observations would remain");
+            break;
+        }
+        bool converged = (weightFactors - result.weightFactors).cwiseAbs().maxCoeff() < 1e-3;
+        result.weightFactors = weightFactors;
+        wk = w.cwiseProduct(weightFactors);
+        if (converged) { break; }
+    }
+
+    // Statistical degrees of freedom (observations rejected completely do not count)
+    auto dof = (wk.array() > 0.0).count() - H.cols();
+    Eigen::VectorX<Scalar> v = dz - H * result.solution;
+    double RSS = v.transpose() * wk.asDiagonal() * v;
+    LOG_DATA("Robust LSQ: RSS = {}, dof = {}", RSS, dof);
+
+    // Covariance matrix (scaled with the estimated error variance like the other least squares solutions)
+    result.variance = dof > 0 ? Eigen::MatrixX<Scalar>(Q * (RSS / static_cast<double>(dof))) : Q;
+
+    return result;
+}
+
+} // namespace NAV
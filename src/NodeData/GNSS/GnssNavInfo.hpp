@@ -13,6 +13,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 
@@ -20,12 +28,20 @@
 #include "Navigation/GNSS/Core/SatelliteSystem.hpp"
 #include "Navigation/Atmosphere/Ionosphere/IonosphericCorrections.hpp"
 #include "Navigation/GNSS/Satellite/Satellite.hpp"
+#include "util/Assert.h"
 #include "util/Container/Pair.hpp"
 #include "util/Logger.hpp"
 
 namespace NAV
 {
-/// GNSS Navigation message information
+/// @brief GNSS Navigation message information
+///
+/// The provider of the navigation data fills the object and publishes immutable, time-stamped versions of it.
+/// Consumers query the version which was known at the time of their observation with knownAt() without taking a lock,
+/// so that decoding and positioning can run concurrently. Versions share the data of unchanged satellites and are
+/// discarded as soon as every registered consumer uses a newer version. Without consumers only the latest version is kept.
+/// In post-processing the provider additionally advances the time up to which its input was processed, so that
+/// consumers wait till the navigation data for their time is complete and the results are causally correct.
 class GnssNavInfo
 {
   public:
@@ -41,21 +57,21 @@ class GnssNavInfo
     /// @param[in] transTime Transmit time of the signal
     [[nodiscard]] Orbit::Pos calcSatellitePos(const SatId& satId, const InsTime& transTime) const
     {
-        return m_satellites.at(satId).calcSatellitePos(transTime);
+        return m_satellites.at(satId)->calcSatellitePos(transTime);
     }
     /// @brief Calculates position, velocity and acceleration of the satellite at transmission time
     /// @param[in] satId Satellite identifier
     /// @param[in] transTime Transmit time of the signal
     [[nodiscard]] Orbit::PosVel calcSatellitePosVel(const SatId& satId, const InsTime& transTime) const
     {
-        return m_satellites.at(satId).calcSatellitePosVel(transTime);
+        return m_satellites.at(satId)->calcSatellitePosVel(transTime);
     }
     /// @brief Calculates position, velocity and acceleration of the satellite at transmission time
     /// @param[in] satId Satellite identifier
     /// @param[in] transTime Transmit time of the signal
     [[nodiscard]] Orbit::PosVelAccel calcSatellitePosVelAccel(const SatId& satId, const InsTime& transTime) const
     {
-        return m_satellites.at(satId).calcSatellitePosVelAccel(transTime);
+        return m_satellites.at(satId)->calcSatellitePosVelAccel(transTime);
     }
 
     /// @brief Calculates clock bias and drift of the satellite
@@ -65,7 +81,7 @@ class GnssNavInfo
     /// @param[in] freq Signal Frequency
     [[nodiscard]] Clock::Corrections calcSatelliteClockCorrections(const SatId& satId, const InsTime& recvTime, double dist, const Frequency& freq) const
     {
-        return m_satellites.at(satId).calcClockCorrections(recvTime, dist, freq);
+        return m_satellites.at(satId)->calcClockCorrections(recvTime, dist, freq);
     }
 
     /// @brief Calculates the Variance of the satellite position in [m]
@@ -73,7 +89,7 @@ class GnssNavInfo
     /// @param[in] recvTime Receiver time to calculate the satellite position for
     [[nodiscard]] double calcSatellitePositionVariance(const SatId& satId, const InsTime& recvTime) const
     {
-        return m_satellites.at(satId).calcSatellitePositionVariance(recvTime);
+        return m_satellites.at(satId)->calcSatellitePositionVariance(recvTime);
     }
 
     /// @brief Checks whether the signal is healthy
@@ -81,15 +97,23 @@ class GnssNavInfo
     /// @param[in] recvTime Receive time for the data lookup
     [[nodiscard]] bool isHealthy(const SatId& satId, const InsTime& recvTime) const
     {
-        return m_satellites.at(satId).isHealthy(recvTime);
+        return m_satellites.at(satId)->isHealthy(recvTime);
     }
 
     /// @brief Adds the provided satellite navigation data to the satellite
     /// @param[in] satId Satellite identifier
     /// @param[in] satNavData Satellite Navigation Data to add
-    void addSatelliteNavData(const SatId& satId, const std::shared_ptr<SatNavData>& satNavData)
+    /// @return True if the data was not stored yet, false if the same data was added before
+    bool addSatelliteNavData(const SatId& satId, const std::shared_ptr<SatNavData>& satNavData)
     {
-        m_satellites[satId].addSatNavData(satNavData);
+        auto& satellite = m_satellites[satId];
+        if (satellite && satellite->contains(satNavData)) { return false; }
+
+        // Published versions share the satellite, so it is copied before it is modified
+        if (satellite == nullptr) { satellite = std::make_shared<Satellite>(); }
+        else if (satellite.use_count() > 1) { satellite = std::make_shared<Satellite>(*satellite); }
+        satellite->addSatNavData(satNavData);
+        return true;
     }
 
     /// @brief Checks whether the satellite is included in the internal data
@@ -99,12 +123,12 @@ class GnssNavInfo
     {
         if (!m_satellites.contains(satId)) { return nullptr; }
 
-        auto satNavData = m_satellites.at(satId).searchNavigationData(recvTime);
+        auto satNavData = m_satellites.at(satId)->searchNavigationData(recvTime);
         if (satNavData == nullptr)
         {
             [[maybe_unused]] auto printNavData = [&]() {
                 std::string ret;
-                for (const auto& navData : m_satellites.at(satId).getNavigationData())
+                for (const auto& navData : m_satellites.at(satId)->getNavigationData())
                 {
                     ret += fmt::format("[{} - diff {:.0f}s], ", navData->refTime.toYMDHMS(GPST), std::abs((navData->refTime - recvTime).count()));
                 }
@@ -130,13 +154,132 @@ class GnssNavInfo
         return m_satellites;
     }
 
-    /// @brief Resets the data by clearing the member variables
+    /// @brief Resets the data by clearing the member variables and discarding all published versions
+    /// @attention Must not be called while consumers access the versions. Registered consumers stay registered.
     void reset()
     {
         satelliteSystems = SatSys_None;
         ionosphericCorrections.clear();
         timeSysCorr.clear();
         m_satellites.clear();
+
+        {
+            std::scoped_lock lock(m_versions.mutex);
+            m_versions.newest.store(nullptr, std::memory_order_release);
+            m_versions.list.clear();
+            for (auto* consumer = m_versions.consumers.load(std::memory_order_acquire); consumer != nullptr; consumer = consumer->next)
+            {
+                consumer->version.store(0, std::memory_order_release);
+            }
+        }
+        m_versions.knownUntil.store(std::numeric_limits<int64_t>::max(), std::memory_order_release);
+    }
+
+    /// @brief Publishes the current navigation data as a new immutable version
+    /// @param[in] knownSince Time from which on the data was known. Empty if it was known from the start (e.g. files).
+    void publish(const InsTime& knownSince = InsTime{})
+    {
+        auto data = std::make_shared<const GnssNavInfo>(*this);
+
+        std::scoped_lock lock(m_versions.mutex);
+        const Version* previous = m_versions.list.empty() ? nullptr : m_versions.list.back().get();
+        uint64_t number = previous != nullptr ? previous->number + 1 : 1;
+        m_versions.list.push_back(std::make_unique<Version>(toNanoseconds(knownSince), number, std::move(data), previous));
+        m_versions.newest.store(m_versions.list.back().get(), std::memory_order_release);
+
+        // Consumers only ask for times at or after the one of their last query, so they never get older versions than their current one.
+        // While looking up a version, they only visit versions newer than the one they get.
+        uint64_t oldestInUse = number;
+        for (auto* consumer = m_versions.consumers.load(std::memory_order_acquire); consumer != nullptr; consumer = consumer->next)
+        {
+            if (consumer->key.load(std::memory_order_acquire) != nullptr)
+            {
+                oldestInUse = std::min(oldestInUse, consumer->version.load(std::memory_order_acquire));
+            }
+        }
+        if (oldestInUse == 0) { return; } // A consumer did not get a version yet
+        if (m_versions.list.front()->number < oldestInUse)
+        {
+            while (m_versions.list.front()->number < oldestInUse) { m_versions.list.pop_front(); }
+            m_versions.list.front()->previous.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    /// @brief Amount of versions which are currently kept
+    [[nodiscard]] size_t nVersions() const
+    {
+        std::scoped_lock lock(m_versions.mutex);
+        return m_versions.list.size();
+    }
+
+    /// @brief Registers a consumer, so that no version it can still ask for is discarded
+    /// @param[in] consumer Unique key of the consumer (e.g. the address of the node)
+    /// @note Consumers should register before the flow starts, otherwise only their first query registers them
+    void addConsumer(const void* consumer) const
+    {
+        std::scoped_lock lock(m_versions.mutex);
+        registerConsumer(consumer)->version.store(0, std::memory_order_release);
+    }
+
+    /// @brief Unregisters a consumer. Pointers it received from knownAt() become invalid.
+    /// @param[in] consumer Unique key of the consumer
+    void removeConsumer(const void* consumer) const
+    {
+        std::scoped_lock lock(m_versions.mutex);
+        if (auto* entry = findConsumer(consumer)) { entry->key.store(nullptr, std::memory_order_release); }
+    }
+
+    /// @brief Sets the time up to which all navigation data is published. Consumers with later times wait for the provider.
+    /// @param[in] insTime Time up to which the input of the provider was processed
+    void setKnownUntil(const InsTime& insTime)
+    {
+        m_versions.knownUntil.store(toNanoseconds(insTime), std::memory_order_release);
+        m_versions.knownUntil.notify_all();
+    }
+
+    /// @brief Marks the navigation data as complete, so that consumers do not wait for the provider anymore
+    void setComplete()
+    {
+        m_versions.knownUntil.store(std::numeric_limits<int64_t>::max(), std::memory_order_release);
+        m_versions.knownUntil.notify_all();
+    }
+
+    /// @brief Returns the navigation data version which was known at the given time
+    /// @param[in] insTime Time of the consumer (e.g. receive time of the observation). Has to increase with every call.
+    /// @param[in] consumer Unique key of the consumer (e.g. the address of the node)
+    /// @return Pointer to the version (valid till the next call of the consumer) or nullptr if no data was known at the time
+    /// @note Waits if the provider did not process its input up to the given time yet. Only the first query of an unregistered consumer locks.
+    [[nodiscard]] const GnssNavInfo* knownAt(const InsTime& insTime, const void* consumer) const
+    {
+        INS_ASSERT_USER_ERROR(consumer != nullptr, "The consumer of the navigation data needs a key.");
+
+        auto* entry = findConsumer(consumer);
+        if (entry == nullptr)
+        {
+            std::scoped_lock lock(m_versions.mutex);
+            entry = registerConsumer(consumer);
+        }
+
+        auto time = toNanoseconds(insTime);
+        for (auto knownUntil = m_versions.knownUntil.load(std::memory_order_acquire);
+             knownUntil < time;
+             knownUntil = m_versions.knownUntil.load(std::memory_order_acquire))
+        {
+            m_versions.knownUntil.wait(knownUntil, std::memory_order_acquire);
+        }
+
+        const auto* version = m_versions.newest.load(std::memory_order_acquire);
+        while (version != nullptr && version->knownSince > time) { version = version->previous.load(std::memory_order_acquire); }
+        entry->version.store(version != nullptr ? version->number : 0, std::memory_order_release);
+        return version != nullptr ? version->data.get() : nullptr;
+    }
+
+    /// @brief Returns the latest published navigation data version
+    /// @return The version or nullptr if nothing was published yet
+    [[nodiscard]] std::shared_ptr<const GnssNavInfo> latest() const
+    {
+        std::scoped_lock lock(m_versions.mutex);
+        return m_versions.list.empty() ? nullptr : m_versions.list.back()->data;
     }
 
     /// @brief Satellite Systems available
@@ -156,8 +299,113 @@ class GnssNavInfo
     std::unordered_map<std::pair<TimeSystem, TimeSystem>, TimeSystemCorrections> timeSysCorr;
 
   private:
-    /// Map of satellites containing the navigation message data
-    std::unordered_map<SatId, Satellite> m_satellites;
+    /// @brief Immutable version of the navigation data
+    struct Version
+    {
+        /// @brief Constructor
+        /// @param[in] knownSince Time from which on the data was known [ns] since the GPS epoch
+        /// @param[in] number Number of the version, counted from 1
+        /// @param[in] data Navigation data
+        /// @param[in] previous The version published before
+        Version(int64_t knownSince, uint64_t number, std::shared_ptr<const GnssNavInfo> data, const Version* previous)
+            : knownSince(knownSince), number(number), data(std::move(data)), previous(previous) {}
+
+        int64_t knownSince = 0;                  ///< Time from which on the data was known [ns] since the GPS epoch
+        uint64_t number = 0;                     ///< Number of the version, counted from 1
+        std::shared_ptr<const GnssNavInfo> data; ///< Navigation data
+        std::atomic<const Version*> previous;    ///< The version published before or nullptr if it was discarded
+    };
+
+    /// @brief Consumer of the versions
+    struct Consumer
+    {
+        std::atomic<const void*> key = nullptr; ///< Unique key of the consumer or nullptr if the entry is free
+        std::atomic<uint64_t> version = 0;      ///< Number of the version the consumer uses or 0 if it did not get one yet
+        Consumer* next = nullptr;               ///< Next entry of the list
+    };
+
+    /// @brief Converts the time into a comparable integer
+    /// @param[in] insTime Time to convert
+    /// @return Nanoseconds since the GPS epoch or the lowest value if the time is empty
+    static int64_t toNanoseconds(const InsTime& insTime)
+    {
+        if (insTime.empty()) { return std::numeric_limits<int64_t>::lowest(); }
+        auto gpsWeekTow = insTime.toGPSweekTow(GPST);
+        auto weeks = static_cast<int64_t>(gpsWeekTow.gpsCycle) * InsTimeUtil::WEEKS_PER_GPS_CYCLE + gpsWeekTow.gpsWeek;
+        return weeks * InsTimeUtil::SECONDS_PER_WEEK * 1'000'000'000LL + std::llround(gpsWeekTow.tow * 1e9L);
+    }
+
+    /// @brief Searches the entry of a registered consumer
+    /// @param[in] consumer Unique key of the consumer
+    /// @return The entry or nullptr if the consumer is not registered
+    Consumer* findConsumer(const void* consumer) const
+    {
+        for (auto* entry = m_versions.consumers.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+        {
+            if (entry->key.load(std::memory_order_acquire) == consumer) { return entry; }
+        }
+        return nullptr;
+    }
+
+    /// @brief Registers a consumer, which did not get a version yet
+    /// @param[in] consumer Unique key of the consumer
+    /// @return The entry of the consumer
+    /// @attention The mutex of the versions has to be locked
+    Consumer* registerConsumer(const void* consumer) const
+    {
+        if (auto* entry = findConsumer(consumer)) { return entry; }
+        if (auto* entry = findConsumer(nullptr)) // Reuse the entry of a removed consumer
+        {
+            entry->version.store(0, std::memory_order_release);
+            entry->key.store(consumer, std::memory_order_release);
+            return entry;
+        }
+        auto* entry = new Consumer; // NOLINT(cppcoreguidelines-owning-memory) Deleted by Versions
+        entry->key.store(consumer, std::memory_order_relaxed);
+        entry->next = m_versions.consumers.load(std::memory_order_relaxed);
+        m_versions.consumers.store(entry, std::memory_order_release);
+        return entry;
+    }
+
+    /// Map of satellites containing the navigation message data (shared with the published versions till modified)
+    std::unordered_map<SatId, std::shared_ptr<Satellite>> m_satellites;
+
+    /// @brief Published versions and their consumers. Copies of the navigation data start without versions.
+    struct Versions
+    {
+        /// @brief Default constructor
+        Versions() = default;
+        /// @brief Destructor
+        ~Versions()
+        {
+            for (auto* entry = consumers.load(std::memory_order_relaxed); entry != nullptr;)
+            {
+                delete std::exchange(entry, entry->next); // NOLINT(cppcoreguidelines-owning-memory)
+            }
+        }
+        /// @brief Copy constructor (does not copy the versions)
+        Versions(const Versions& /* other */) {}
+        /// @brief Move constructor
+        Versions(Versions&&) = delete;
+        /// @brief Copy assignment operator (does not copy the versions)
+        Versions& operator=(const Versions& /* other */) { return *this; }
+        /// @brief Move assignment operator
+        Versions& operator=(Versions&&) = delete;
+
+        /// Mutex of the provider and the registration of consumers. Queries of registered consumers do not lock.
+        mutable std::mutex mutex;
+        /// Published versions, sorted by their number
+        std::deque<std::unique_ptr<Version>> list;
+        /// Newest published version
+        std::atomic<const Version*> newest = nullptr;
+        /// Registered consumers. Entries are only added and reused, so that they can be read without locking.
+        mutable std::atomic<Consumer*> consumers = nullptr;
+        /// Time up to which all navigation data is published [ns] since the GPS epoch
+        std::atomic<int64_t> knownUntil = std::numeric_limits<int64_t>::max();
+    };
+
+    /// Published versions of the navigation data
+    Versions m_versions{};
 };
 
 } // namespace NAV
@@ -0,0 +1,210 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtkSolution.hpp
+/// @brief Real-Time Kinematic (RTK) float solution
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "NodeData/State/PosVel.hpp"
+
+#include "util/Assert.h"
+
+namespace NAV
+{
+/// @brief Real-Time Kinematic (RTK) float solution of the rover relative to a base station
+class RtkSolution : public PosVel
+{
+  public:
+    /// @brief Returns the type of the data class
+    /// @return The data type
+    [[nodiscard]] static std::string type()
+    {
+        return "RtkSolution";
+    }
+
+    /// @brief Returns the parent types of the data class
+    /// @return The parent data types
+    [[nodiscard]] static std::vector<std::string> parentTypes()
+    {
+        auto parent = PosVel::parentTypes();
+        parent.push_back(PosVel::type());
+        return parent;
+    }
+
+    /// @brief Returns a vector of data descriptors
+    [[nodiscard]] static std::vector<std::string> GetStaticDataDescriptors()
+    {
+        auto desc = PosVel::GetStaticDataDescriptors();
+        desc.reserve(GetStaticDescriptorCount());
+        desc.emplace_back("Number satellites");
+        desc.emplace_back("Number signals");
+        desc.emplace_back("Number ambiguities");
+        desc.emplace_back("Differential age [s]");
+        desc.emplace_back("X baseline ECEF [m]");
+        desc.emplace_back("Y baseline ECEF [m]");
+        desc.emplace_back("Z baseline ECEF [m]");
+        desc.emplace_back("North baseline [m]");
+        desc.emplace_back("East baseline [m]");
+        desc.emplace_back("Down baseline [m]");
+        desc.emplace_back("X-ECEF StDev [m]");
+        desc.emplace_back("Y-ECEF StDev [m]");
+        desc.emplace_back("Z-ECEF StDev [m]");
+        desc.emplace_back("North StDev [m]");
+        desc.emplace_back("East StDev [m]");
+        desc.emplace_back("Down StDev [m]");
+        desc.emplace_back("X velocity ECEF StDev [m/s]");
+        desc.emplace_back("Y velocity ECEF StDev [m/s]");
+        desc.emplace_back("Z velocity ECEF StDev [m/s]");
+        desc.emplace_back("North velocity StDev [m/s]");
+        desc.emplace_back("East velocity StDev [m/s]");
+        desc.emplace_back("Down velocity StDev [m/s]");
+
+        return desc;
+    }
+
+    /// @brief Get the amount of descriptors
+    [[nodiscard]] static constexpr size_t GetStaticDescriptorCount() { return 37; }
+
+    /// @brief Returns a vector of data descriptors
+    [[nodiscard]] std::vector<std::string> staticDataDescriptors() const override { return GetStaticDataDescriptors(); }
+
+    /// @brief Get the amount of descriptors
+    [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
+
+    /// @brief Get the value at the index
+    /// @param idx Index corresponding to data descriptor order
+    /// @return Value if in the observation
+    [[nodiscard]] std::optional<double> getValueAt(size_t idx) const override
+    {
+        INS_ASSERT(idx < GetStaticDescriptorCount());
+        switch (idx)
+        {
+        case 0:  // Latitude [deg]
+        case 1:  // Longitude [deg]
+        case 2:  // Altitude [m]
+        case 3:  // North/South [m]
+        case 4:  // East/West [m]
+        case 5:  // X-ECEF [m]
+        case 6:  // Y-ECEF [m]
+        case 7:  // Z-ECEF [m]
+        case 8:  // Velocity norm [m/s]
+        case 9:  // X velocity ECEF [m/s]
+        case 10: // Y velocity ECEF [m/s]
+        case 11: // Z velocity ECEF [m/s]
+        case 12: // North velocity [m/s]
+        case 13: // East velocity [m/s]
+        case 14: // Down velocity [m/s]
+            return PosVel::getValueAt(idx);
+        case 15: // Number satellites
+            return static_cast<double>(nSatellites);
+        case 16: // Number signals
+            return static_cast<double>(nSignals);
+        case 17: // Number ambiguities
+            return static_cast<double>(nAmbiguities);
+        case 18: // Differential age [s]
+            return differentialAge;
+        case 19: // X baseline ECEF [m]
+        case 20: // Y baseline ECEF [m]
+        case 21: // Z baseline ECEF [m]
+            return _e_baseline(static_cast<Eigen::Index>(idx - 19));
+        case 22: // North baseline [m]
+        case 23: // East baseline [m]
+        case 24: // Down baseline [m]
+            return n_baseline()(static_cast<Eigen::Index>(idx - 22));
+        case 25: // X-ECEF StDev [m]
+        case 26: // Y-ECEF StDev [m]
+        case 27: // Z-ECEF StDev [m]
+            return std::sqrt(_e_positionCovariance(static_cast<Eigen::Index>(idx - 25), static_cast<Eigen::Index>(idx - 25)));
+        case 28: // North StDev [m]
+        case 29: // East StDev [m]
+        case 30: // Down StDev [m]
+            return std::sqrt(n_positionCovariance()(static_cast<Eigen::Index>(idx - 28), static_cast<Eigen::Index>(idx - 28)));
+        case 31: // X velocity ECEF StDev [m/s]
+        case 32: // Y velocity ECEF StDev [m/s]
+        case 33: // Z velocity ECEF StDev [m/s]
+            return std::sqrt(_e_velocityCovariance(static_cast<Eigen::Index>(idx - 31), static_cast<Eigen::Index>(idx - 31)));
+        case 34: // North velocity StDev [m/s]
+        case 35: // East velocity StDev [m/s]
+        case 36: // Down velocity StDev [m/s]
+            return std::sqrt(n_velocityCovariance()(static_cast<Eigen::Index>(idx - 34), static_cast<Eigen::Index>(idx - 34)));
+        default:
+            return std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+    // --------------------------------------------------------- Public Members ------------------------------------------------------------
+
+    /// Amount of satellites used for the calculation
+    size_t nSatellites = 0;
+    /// Amount of double-differenced carrier-phase observations used for the calculation
+    size_t nSignals = 0;
+    /// Amount of estimated single-differenced float ambiguities
+    size_t nAmbiguities = 0;
+    /// Time difference between the rover and the base epoch [s]
+    double differentialAge = 0.0;
+
+    // ------------------------------------------------------------- Getter ----------------------------------------------------------------
+
+    /// Returns the baseline from the base station to the rover in ECEF frame coordinates in [m]
+    [[nodiscard]] const Eigen::Vector3d& e_baseline() const { return _e_baseline; }
+
+    /// Returns the baseline from the base station to the rover in local navigation frame coordinates in [m]
+    [[nodiscard]] Eigen::Vector3d n_baseline() const { return n_Quat_e() * _e_baseline; }
+
+    /// Returns the covariance matrix of the position in ECEF frame coordinates in [m²]
+    [[nodiscard]] const Eigen::Matrix3d& e_positionCovariance() const { return _e_positionCovariance; }
+
+    /// Returns the covariance matrix of the position in local navigation frame coordinates in [m²]
+    [[nodiscard]] Eigen::Matrix3d n_positionCovariance() const
+    {
+        return n_Quat_e().toRotationMatrix() * _e_positionCovariance * e_Quat_n().toRotationMatrix();
+    }
+
+    /// Returns the covariance matrix of the velocity in ECEF frame coordinates in [m²/s²]
+    [[nodiscard]] const Eigen::Matrix3d& e_velocityCovariance() const { return _e_velocityCovariance; }
+
+    /// Returns the covariance matrix of the velocity in local navigation frame coordinates in [m²/s²]
+    [[nodiscard]] Eigen::Matrix3d n_velocityCovariance() const
+    {
+        return n_Quat_e().toRotationMatrix() * _e_velocityCovariance * e_Quat_n().toRotationMatrix();
+    }
+
+    // ------------------------------------------------------------- Setter ----------------------------------------------------------------
+
+    /// @brief Set the baseline in ECEF coordinates
+    /// @param[in] e_baseline Baseline from the base station to the rover in ECEF coordinates [m]
+    /// @attention Position has to be set before calling this
+    void setBaseline_e(const Eigen::Vector3d& e_baseline) { _e_baseline = e_baseline; }
+
+    /// @brief Set the covariance matrices of the position and velocity in ECEF coordinates
+    /// @param[in] e_positionCovariance Covariance matrix of the position in ECEF coordinates [m²]
+    /// @param[in] e_velocityCovariance Covariance matrix of the velocity in ECEF coordinates [m²/s²]
+    void setPosVelCovariance_e(const Eigen::Matrix3d& e_positionCovariance, const Eigen::Matrix3d& e_velocityCovariance)
+    {
+        _e_positionCovariance = e_positionCovariance;
+        _e_velocityCovariance = e_velocityCovariance;
+    }
+
+  private:
+    /// Baseline from the base station to the rover in ECEF coordinates [m]
+    Eigen::Vector3d _e_baseline = Eigen::Vector3d::Zero() * std::nan("");
+    /// Covariance matrix of the position in ECEF coordinates [m²]
+    Eigen::Matrix3d _e_positionCovariance = Eigen::Matrix3d::Zero() * std::nan("");
+    /// Covariance matrix of the velocity in ECEF coordinates [m²/s²]
+    Eigen::Matrix3d _e_velocityCovariance = Eigen::Matrix3d::Zero() * std::nan("");
+};
+
+} // namespace NAV
@@ -16,6 +16,7 @@
 #include <vector>
 #include <optional>
 #include <algorithm>
+#include <cmath>
 
 #include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
 #include "Navigation/GNSS/Core/Code.hpp"
@@ -112,12 +113,18 @@ class SppSolution : public PosVel
         desc.emplace_back("QZSS system time drift difference StDev [s/s]");
         desc.emplace_back("IRNSS system time drift difference StDev [s/s]");
         desc.emplace_back("SBAS system time drift difference StDev [s/s]");
+        desc.emplace_back("RAIM test statistic");
+        desc.emplace_back("RAIM threshold");
+        desc.emplace_back("Horizontal protection level [m]");
+        desc.emplace_back("Vertical protection level [m]");
+        desc.emplace_back("Number excluded measurements");
+        desc.emplace_back("Number down-weighted measurements");
 
         return desc;
     }
 
     /// @brief Get the amount of descriptors
-    [[nodiscard]] static constexpr size_t GetStaticDescriptorCount() { return 73; }
+    [[nodiscard]] static constexpr size_t GetStaticDescriptorCount() { return 79; }
 
     /// @brief Returns a vector of data descriptors
     [[nodiscard]] std::vector<std::string> staticDataDescriptors() const override { return GetStaticDataDescriptors(); }
@@ -307,6 +314,22 @@ class SppSolution : public PosVel
         case 72: // SBAS system time drift difference StDev [s/s]
             if (recvClk.sysTimeDiffDrift.at(idx - 66).value != 0.0) { return recvClk.sysTimeDiffDrift.at(idx - 66).stdDev; }
             break;
+        case 73: // RAIM test statistic
+            if (!std::isnan(raimTestStatistic)) { return raimTestStatistic; }
+            break;
+        case 74: // RAIM threshold
+            if (!std::isnan(raimThreshold)) { return raimThreshold; }
+            break;
+        case 75: // Horizontal protection level [m]
+            if (!std::isnan(HPL)) { return HPL; }
+            break;
+        case 76: // Vertical protection level [m]
+            if (!std::isnan(VPL)) { return VPL; }
+            break;
+        case 77: // Number excluded measurements
+            return static_cast<double>(nMeasExcluded);
+        case 78: // Number down-weighted measurements
+            return static_cast<double>(nMeasDownWeighted);
         default:
             return std::nullopt;
         }
@@ -412,6 +435,19 @@ class SppSolution : public PosVel
     size_t nMeasDopp = 0;
     /// Amount of Parameters estimated in this epoch
     size_t nParam = 0;
+    /// Amount of measurements excluded by the fault detection and exclusion
+    size_t nMeasExcluded = 0;
+    /// Amount of measurements down-weighted by the robust estimation
+    size_t nMeasDownWeighted = 0;
+
+    /// Test statistic of the RAIM global test (weighted sum of squared residuals)
+    double raimTestStatistic = std::nan("");
+    /// Threshold of the RAIM global test
+    double raimThreshold = std::nan("");
+    /// Horizontal protection level [m]
+    double HPL = std::nan("");
+    /// Vertical protection level [m]
+    double VPL = std::nan("");
 
     /// Estimated receiver clock parameter
     ReceiverClock recvClk;
@@ -444,10 +480,18 @@ class SppSolution : public PosVel
     [[nodiscard]] const Eigen::Vector3d& n_velocityStdev() const { return _n_velocityStdev; }
 
     /// Returns the Covariance matrix in ECEF frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<SPP::States::StateKeyTypes, SPP::States::StateKeyTypes>>> e_CovarianceMatrix() const { return _e_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<SPP::States::StateKeyTypes, SPP::States::StateKeyTypes>>> e_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _e_covarianceMatrix;
+    }
 
     /// Returns the Covariance matrix in local navigation frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<SPP::States::StateKeyTypes, SPP::States::StateKeyTypes>>> n_CovarianceMatrix() const { return _n_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<SPP::States::StateKeyTypes, SPP::States::StateKeyTypes>>> n_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _n_covarianceMatrix;
+    }
 
     // ------------------------------------------------------------- Setter ----------------------------------------------------------------
 
@@ -478,29 +522,49 @@ class SppSolution : public PosVel
     {
         _e_covarianceMatrix = e_covarianceMatrix;
         _n_covarianceMatrix = _e_covarianceMatrix;
+        _hasCovarianceMatrix = true;
 
         Eigen::Vector3d lla_pos = lla_position();
         Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(lla_pos(0), lla_pos(1));
         Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(lla_pos(0), lla_pos(1));
 
+        // Contiguous blocks, as slicing with the key vectors copies the indices on every call
         if (e_covarianceMatrix.hasCols(SPP::States::Vel))
         {
-            (*_n_covarianceMatrix)(SPP::States::PosVel, all).setZero();
-            (*_n_covarianceMatrix)(all, SPP::States::PosVel).setZero();
-            (*_n_covarianceMatrix)(SPP::States::Vel, SPP::States::Vel) = n_Quat_e * (*_e_covarianceMatrix)(SPP::States::Vel, SPP::States::Vel) * e_Quat_n;
+            _n_covarianceMatrix->middleRows<6>(SPP::States::PosVel).setZero();
+            _n_covarianceMatrix->middleCols<6>(SPP::States::PosVel).setZero();
+            _n_covarianceMatrix->block<3>(SPP::States::Vel, SPP::States::Vel) = n_Quat_e * _e_covarianceMatrix->block<3>(SPP::States::Vel, SPP::States::Vel) * e_Quat_n;
         }
         else
         {
-            (*_n_covarianceMatrix)(SPP::States::Pos, all).setZero();
-            (*_n_covarianceMatrix)(all, SPP::States::Pos).setZero();
+            _n_covarianceMatrix->middleRows<3>(SPP::States::Pos).setZero();
+            _n_covarianceMatrix->middleCols<3>(SPP::States::Pos).setZero();
         }
-        (*_n_covarianceMatrix)(SPP::States::Pos, SPP::States::Pos) = n_Quat_e * (*_e_covarianceMatrix)(SPP::States::Pos, SPP::States::Pos) * e_Quat_n;
+        _n_covarianceMatrix->block<3>(SPP::States::Pos, SPP::States::Pos) = n_Quat_e * _e_covarianceMatrix->block<3>(SPP::States::Pos, SPP::States::Pos) * e_Quat_n;
     }
 
     /// @brief Adds an event to the event list
     /// @param event Event string
     void addEvent(const std::string& event) { _events.push_back(event); }
 
+    /// @brief Resets the solution to a default constructed one, but keeps the memory of the satellite data, events and covariance matrices for reuse
+    void reset()
+    {
+        auto satData = std::move(this->satData);
+        auto events = std::move(_events);
+        auto e_covarianceMatrix = std::move(_e_covarianceMatrix);
+        auto n_covarianceMatrix = std::move(_n_covarianceMatrix);
+
+        *this = SppSolution();
+
+        satData.clear();
+        this->satData = std::move(satData);
+        events.clear();
+        _events = std::move(events);
+        _e_covarianceMatrix = std::move(e_covarianceMatrix);
+        _n_covarianceMatrix = std::move(n_covarianceMatrix);
+    }
+
   private:
     /// Standard deviation of Position in ECEF coordinates [m]
     Eigen::Vector3d _e_positionStdev = Eigen::Vector3d::Zero() * std::nan("");
@@ -517,6 +581,9 @@ class SppSolution : public PosVel
 
     /// Covariance matrix in local navigation coordinates
     std::optional<KeyedMatrixXd<SPP::States::StateKeyTypes, SPP::States::StateKeyTypes>> _n_covarianceMatrix;
+
+    /// Whether the covariance matrices were set (their memory is kept when resetting the solution)
+    bool _hasCovarianceMatrix = false;
 };
 
 } // namespace NAV
@@ -0,0 +1,189 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file TdcpSolution.hpp
+/// @brief Time-Differenced Carrier-Phase (TDCP) output
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "NodeData/State/PosVel.hpp"
+
+#include "util/Assert.h"
+
+namespace NAV
+{
+/// @brief Time-Differenced Carrier-Phase (TDCP) output
+///
+/// The velocity is the mean velocity over the interval to the previous epoch (displacement / time interval) and
+/// the position is the previous position plus the displacement.
+class TdcpSolution : public PosVel
+{
+  public:
+    /// @brief Returns the type of the data class
+    /// @return The data type
+    [[nodiscard]] static std::string type()
+    {
+        return "TdcpSolution";
+    }
+
+    /// @brief Returns the parent types of the data class
+    /// @return The parent data types
+    [[nodiscard]] static std::vector<std::string> parentTypes()
+    {
+        auto parent = PosVel::parentTypes();
+        parent.push_back(PosVel::type());
+        return parent;
+    }
+
+    /// @brief Returns a vector of data descriptors
+    [[nodiscard]] static std::vector<std::string> GetStaticDataDescriptors()
+    {
+        auto desc = PosVel::GetStaticDataDescriptors();
+        desc.reserve(GetStaticDescriptorCount());
+        desc.emplace_back("Number satellites");
+        desc.emplace_back("Number signals");
+        desc.emplace_back("Time interval [s]");
+        desc.emplace_back("X displacement ECEF [m]");
+        desc.emplace_back("Y displacement ECEF [m]");
+        desc.emplace_back("Z displacement ECEF [m]");
+        desc.emplace_back("North displacement [m]");
+        desc.emplace_back("East displacement [m]");
+        desc.emplace_back("Down displacement [m]");
+        desc.emplace_back("X displacement ECEF StDev [m]");
+        desc.emplace_back("Y displacement ECEF StDev [m]");
+        desc.emplace_back("Z displacement ECEF StDev [m]");
+        desc.emplace_back("North displacement StDev [m]");
+        desc.emplace_back("East displacement StDev [m]");
+        desc.emplace_back("Down displacement StDev [m]");
+        desc.emplace_back("Receiver clock change [m]");
+        desc.emplace_back("Receiver clock change StDev [m]");
+
+        return desc;
+    }
+
+    /// @brief Get the amount of descriptors
+    [[nodiscard]] static constexpr size_t GetStaticDescriptorCount() { return 32; }
+
+    /// @brief Returns a vector of data descriptors
+    [[nodiscard]] std::vector<std::string> staticDataDescriptors() const override { return GetStaticDataDescriptors(); }
+
+    /// @brief Get the amount of descriptors
+    [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
+
+    /// @brief Get the value at the index
+    /// @param idx Index corresponding to data descriptor order
+    /// @return Value if in the observation
+    [[nodiscard]] std::optional<double> getValueAt(size_t idx) const override
+    {
+        INS_ASSERT(idx < GetStaticDescriptorCount());
+        switch (idx)
+        {
+        case 0:  // Latitude [deg]
+        case 1:  // Longitude [deg]
+        case 2:  // Altitude [m]
+        case 3:  // North/South [m]
+        case 4:  // East/West [m]
+        case 5:  // X-ECEF [m]
+        case 6:  // Y-ECEF [m]
+        case 7:  // Z-ECEF [m]
+        case 8:  // Velocity norm [m/s]
+        case 9:  // X velocity ECEF [m/s]
+        case 10: // Y velocity ECEF [m/s]
+        case 11: // Z velocity ECEF [m/s]
+        case 12: // North velocity [m/s]
+        case 13: // East velocity [m/s]
+        case 14: // Down velocity [m/s]
+            return PosVel::getValueAt(idx);
+        case 15: // Number satellites
+            return static_cast<double>(nSatellites);
+        case 16: // Number signals
+            return static_cast<double>(nSignals);
+        case 17: // Time interval [s]
+            return dt;
+        case 18: // X displacement ECEF [m]
+        case 19: // Y displacement ECEF [m]
+        case 20: // Z displacement ECEF [m]
+            return _e_displacement(static_cast<Eigen::Index>(idx - 18));
+        case 21: // North displacement [m]
+        case 22: // East displacement [m]
+        case 23: // Down displacement [m]
+            return n_displacement()(static_cast<Eigen::Index>(idx - 21));
+        case 24: // X displacement ECEF StDev [m]
+        case 25: // Y displacement ECEF StDev [m]
+        case 26: // Z displacement ECEF StDev [m]
+            return std::sqrt(_e_displacementCovariance(static_cast<Eigen::Index>(idx - 24), static_cast<Eigen::Index>(idx - 24)));
+        case 27: // North displacement StDev [m]
+        case 28: // East displacement StDev [m]
+        case 29: // Down displacement StDev [m]
+            return std::sqrt(n_displacementCovariance()(static_cast<Eigen::Index>(idx - 27), static_cast<Eigen::Index>(idx - 27)));
+        case 30: // Receiver clock change [m]
+            return recvClkChange;
+        case 31: // Receiver clock change StDev [m]
+            return recvClkChangeStdDev;
+        default:
+            return std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+    // --------------------------------------------------------- Public Members ------------------------------------------------------------
+
+    /// Amount of satellites used for the calculation
+    size_t nSatellites = 0;
+    /// Amount of time-differenced carrier-phase observations used for the calculation
+    size_t nSignals = 0;
+    /// Time interval to the previous epoch [s]
+    double dt = 0.0;
+    /// Change of the receiver clock between the epochs [m]
+    double recvClkChange = 0.0;
+    /// Standard deviation of the receiver clock change [m]
+    double recvClkChangeStdDev = 0.0;
+
+    // ------------------------------------------------------------- Getter ----------------------------------------------------------------
+
+    /// Returns the displacement to the previous epoch in ECEF frame coordinates in [m]
+    [[nodiscard]] const Eigen::Vector3d& e_displacement() const { return _e_displacement; }
+
+    /// Returns the displacement to the previous epoch in local navigation frame coordinates in [m]
+    [[nodiscard]] Eigen::Vector3d n_displacement() const { return n_Quat_e() * _e_displacement; }
+
+    /// Returns the covariance matrix of the displacement in ECEF frame coordinates in [m²]
+    [[nodiscard]] const Eigen::Matrix3d& e_displacementCovariance() const { return _e_displacementCovariance; }
+
+    /// Returns the covariance matrix of the displacement in local navigation frame coordinates in [m²]
+    [[nodiscard]] Eigen::Matrix3d n_displacementCovariance() const
+    {
+        return n_Quat_e().toRotationMatrix() * _e_displacementCovariance * e_Quat_n().toRotationMatrix();
+    }
+
+    // ------------------------------------------------------------- Setter ----------------------------------------------------------------
+
+    /// @brief Set the displacement in ECEF coordinates and its covariance matrix
+    /// @param[in] e_displacement Displacement to the previous epoch in ECEF coordinates [m]
+    /// @param[in] e_displacementCovariance Covariance matrix of the displacement in ECEF coordinates [m²]
+    /// @attention Position has to be set before calling this
+    void setDisplacementAndCovariance_e(const Eigen::Vector3d& e_displacement, const Eigen::Matrix3d& e_displacementCovariance)
+    {
+        _e_displacement = e_displacement;
+        _e_displacementCovariance = e_displacementCovariance;
+    }
+
+  private:
+    /// Displacement to the previous epoch in ECEF coordinates [m]
+    Eigen::Vector3d _e_displacement = Eigen::Vector3d::Zero() * std::nan("");
+    /// Covariance matrix of the displacement in ECEF coordinates [m²]
+    Eigen::Matrix3d _e_displacementCovariance = Eigen::Matrix3d::Zero() * std::nan("");
+};
+
+} // namespace NAV
@@ -16,13 +16,15 @@
 #include "Navigation/Transformations/CoordinateFrames.hpp"
 #include "Navigation/Transformations/Units.hpp"
 
+#include "util/Container/LazyValue.hpp"
 #include "util/Eigen.hpp"
-#include "util/Logger/CommonLog.hpp"
 #include "NodeData/NodeData.hpp"
 
 namespace NAV
 {
-/// Position, Velocity and Attitude Storage Class
+/// @brief Position, Velocity and Attitude Storage Class
+///
+/// The position is stored in the frame it was set in. The other frame is calculated on first access and cached.
 class Pos : public NodeData
 {
   public:
@@ -79,9 +81,8 @@ class Pos : public NodeData
         case 2: // Altitude [m]
             return altitude();
         case 3: // North/South [m]
-            return CommonLog::calcLocalPosition(lla_position()).northSouth;
         case 4: // East/West [m]
-            return CommonLog::calcLocalPosition(lla_position()).eastWest;
+            return std::nullopt; // Relative to the origin of the flow run, so the loggers calculate it with their run context
         case 5: // X-ECEF [m]
             return e_position().x();
         case 6: // Y-ECEF [m]
@@ -116,7 +117,10 @@ class Pos : public NodeData
     /* -------------------------------------------------------------------------------------------------------- */
 
     /// Returns the latitude 𝜙, longitude λ and altitude (height above ground) in [rad, rad, m]
-    [[nodiscard]] const Eigen::Vector3d& lla_position() const { return _lla_position; }
+    [[nodiscard]] const Eigen::Vector3d& lla_position() const
+    {
+        return _lla_position.get([&]() { return trafo::ecef2lla_WGS84(_e_position.value()); });
+    }
 
     /// Returns the latitude 𝜙 in [rad]
     [[nodiscard]] const double& latitude() const { return lla_position()(0); }
@@ -128,7 +132,10 @@ class Pos : public NodeData
     [[nodiscard]] const double& altitude() const { return lla_position()(2); }
 
     /// Returns the  coordinates in [m]
-    [[nodiscard]] const Eigen::Vector3d& e_position() const { return _e_position; }
+    [[nodiscard]] const Eigen::Vector3d& e_position() const
+    {
+        return _e_position.get([&]() { return trafo::lla2ecef_WGS84(_lla_position.value()); });
+    }
 
     // ###########################################################################################################
     //                                                  Setter
@@ -138,27 +145,33 @@ class Pos : public NodeData
     /// @param[in] e_position New Position in ECEF coordinates
     void setPosition_e(const Eigen::Vector3d& e_position)
     {
-        _e_position = e_position;
-        _lla_position = trafo::ecef2lla_WGS84(e_position);
+        resolvePositionDependencies();
+        _e_position.set(e_position);
+        _lla_position.invalidate();
     }
 
     /// @brief Set the Position lla object
     /// @param[in] lla_position New Position in LatLonAlt coordinates
     void setPosition_lla(const Eigen::Vector3d& lla_position)
     {
-        _e_position = trafo::lla2ecef_WGS84(lla_position);
-        _lla_position = lla_position;
+        resolvePositionDependencies();
+        _e_position.invalidate();
+        _lla_position.set(lla_position);
     }
 
+  protected:
+    /// @brief Calculates all stale values, which depend on the current position, before the position changes
+    virtual void resolvePositionDependencies() {}
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
 
   private:
     /// Position in ECEF coordinates [m]
-    Eigen::Vector3d _e_position{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _e_position{ Eigen::Vector3d(std::nan(""), std::nan(""), std::nan("")) };
     /// Position in LatLonAlt coordinates [rad, rad, m]
-    Eigen::Vector3d _lla_position{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _lla_position{ Eigen::Vector3d(std::nan(""), std::nan(""), std::nan("")) };
 };
 
 } // namespace NAV
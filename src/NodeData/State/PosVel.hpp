@@ -13,11 +13,15 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "NodeData/State/Pos.hpp"
 
 namespace NAV
 {
-/// Position, Velocity and Attitude Storage Class
+/// @brief Position, Velocity and Attitude Storage Class
+///
+/// The velocity is stored in the frame it was set in. The other frame is calculated on first access and cached.
 class PosVel : public Pos
 {
   public:
@@ -102,10 +106,16 @@ class PosVel : public Pos
     /* -------------------------------------------------------------------------------------------------------- */
 
     /// Returns the velocity in [m/s], in earth coordinates
-    [[nodiscard]] const Eigen::Vector3d& e_velocity() const { return _e_velocity; }
+    [[nodiscard]] const Eigen::Vector3d& e_velocity() const
+    {
+        return _e_velocity.get([&]() -> Eigen::Vector3d { return e_Quat_n() * _n_velocity.value(); });
+    }
 
     /// Returns the velocity in [m/s], in navigation coordinates
-    [[nodiscard]] const Eigen::Vector3d& n_velocity() const { return _n_velocity; }
+    [[nodiscard]] const Eigen::Vector3d& n_velocity() const
+    {
+        return _n_velocity.get([&]() -> Eigen::Vector3d { return n_Quat_e() * _e_velocity.value(); });
+    }
 
     // ###########################################################################################################
     //                                                  Setter
@@ -115,16 +125,25 @@ class PosVel : public Pos
     /// @param[in] e_velocity The new velocity in the earth frame
     void setVelocity_e(const Eigen::Vector3d& e_velocity)
     {
-        _e_velocity = e_velocity;
-        _n_velocity = n_Quat_e() * e_velocity;
+        _e_velocity.set(e_velocity);
+        _n_velocity.invalidate();
     }
 
     /// @brief Set the Velocity in the NED frame
     /// @param[in] n_velocity The new velocity in the NED frame
     void setVelocity_n(const Eigen::Vector3d& n_velocity)
     {
-        _e_velocity = e_Quat_n() * n_velocity;
-        _n_velocity = n_velocity;
+        _e_velocity.invalidate();
+        _n_velocity.set(n_velocity);
+    }
+
+  protected:
+    /// @brief Calculates all stale values, which depend on the current position, before the position changes
+    void resolvePositionDependencies() override
+    {
+        Pos::resolvePositionDependencies();
+        std::ignore = e_velocity();
+        std::ignore = n_velocity();
     }
 
     /* -------------------------------------------------------------------------------------------------------- */
@@ -133,9 +152,9 @@ class PosVel : public Pos
 
   private:
     /// Velocity in earth coordinates [m/s]
-    Eigen::Vector3d _e_velocity{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _e_velocity{ Eigen::Vector3d(std::nan(""), std::nan(""), std::nan("")) };
     /// Velocity in navigation coordinates [m/s]
-    Eigen::Vector3d _n_velocity{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _n_velocity{ Eigen::Vector3d(std::nan(""), std::nan(""), std::nan("")) };
 };
 
 } // namespace NAV
@@ -20,7 +20,9 @@
 
 namespace NAV
 {
-/// Position, Velocity and Attitude Storage Class
+/// @brief Position, Velocity and Attitude Storage Class
+///
+/// The attitude is stored in the frame it was set in. The other frame is calculated on first access and cached.
 class PosVelAtt : public PosVel
 {
   public:
@@ -115,7 +117,7 @@ class PosVelAtt : public PosVel
     /// @return The Quaternion for the rotation from body to navigation coordinates
     [[nodiscard]] const Eigen::Quaterniond& n_Quat_b() const
     {
-        return _n_Quat_b;
+        return _n_Quat_b.get([&]() -> Eigen::Quaterniond { return n_Quat_e() * _e_Quat_b.value(); });
     }
 
     /// @brief Returns the Quaternion from navigation to body frame (NED)
@@ -129,7 +131,7 @@ class PosVelAtt : public PosVel
     /// @return The Quaternion for the rotation from body to earth coordinates
     [[nodiscard]] const Eigen::Quaterniond& e_Quat_b() const
     {
-        return _e_Quat_b;
+        return _e_Quat_b.get([&]() -> Eigen::Quaterniond { return e_Quat_n() * _n_Quat_b.value(); });
     }
 
     /// @brief Returns the Quaternion from Earth-fixed to body frame
@@ -154,16 +156,16 @@ class PosVelAtt : public PosVel
     /// @param[in] e_Quat_b Quaternion from body to earth frame
     void setAttitude_e_Quat_b(const Eigen::Quaterniond& e_Quat_b)
     {
-        _e_Quat_b = e_Quat_b;
-        _n_Quat_b = n_Quat_e() * e_Quat_b;
+        _e_Quat_b.set(e_Quat_b);
+        _n_Quat_b.invalidate();
     }
 
     /// @brief Set the Quaternion from body to navigation frame
     /// @param[in] n_Quat_b Quaternion from body to navigation frame
     void setAttitude_n_Quat_b(const Eigen::Quaterniond& n_Quat_b)
     {
-        _e_Quat_b = e_Quat_n() * n_Quat_b;
-        _n_Quat_b = n_Quat_b;
+        _e_Quat_b.invalidate();
+        _n_Quat_b.set(n_Quat_b);
     }
 
     /// @brief Set the State
@@ -188,15 +190,24 @@ class PosVelAtt : public PosVel
         setAttitude_n_Quat_b(n_Quat_b);
     }
 
+  protected:
+    /// @brief Calculates all stale values, which depend on the current position, before the position changes
+    void resolvePositionDependencies() override
+    {
+        PosVel::resolvePositionDependencies();
+        std::ignore = e_Quat_b();
+        std::ignore = n_Quat_b();
+    }
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
 
   private:
     /// Quaternion body to earth frame
-    Eigen::Quaterniond _e_Quat_b{ 0, 0, 0, 0 };
+    LazyValue<Eigen::Quaterniond> _e_Quat_b{ Eigen::Quaterniond(0, 0, 0, 0) };
     /// Quaternion body to navigation frame (roll, pitch, yaw)
-    Eigen::Quaterniond _n_Quat_b{ 0, 0, 0, 0 };
+    LazyValue<Eigen::Quaterniond> _n_Quat_b{ Eigen::Quaterniond(0, 0, 0, 0) };
 };
 
 } // namespace NAV
@@ -194,23 +194,32 @@ std::vector<std::string> NAV::NodeRegistry::GetParentNodeDataTypes(const std::st
 #include "Nodes/DataLogger/State/LcKfInsGnssErrorLogger.hpp"
 #include "Nodes/DataLogger/State/PosVelAttLogger.hpp"
 // Data Processor
+#include "Nodes/DataProcessor/Analysis/AllanDeviation.hpp"
+#include "Nodes/DataProcessor/Analysis/ImuCalibration.hpp"
 #include "Nodes/DataProcessor/ErrorModel/ErrorModel.hpp"
 #include "Nodes/DataProcessor/GNSS/GnssAnalyzer.hpp"
+#include "Nodes/DataProcessor/GNSS/NetworkSinglePointPositioning.hpp"
+#include "Nodes/DataProcessor/GNSS/RealTimeKinematic.hpp"
 #include "Nodes/DataProcessor/GNSS/SinglePointPositioning.hpp"
+#include "Nodes/DataProcessor/GNSS/TimeDifferencedCarrierPhase.hpp"
 #include "Nodes/DataProcessor/Integrator/ImuIntegrator.hpp"
 #include "Nodes/DataProcessor/KalmanFilter/LooselyCoupledKF.hpp"
 #include "Nodes/DataProcessor/KalmanFilter/TightlyCoupledKF.hpp"
 #include "Nodes/DataProcessor/SensorCombiner/ImuFusion.hpp"
+#include "Nodes/DataProcessor/Smoother/FixedLagSmoother.hpp"
 // Data Provider
 #include "Nodes/DataProvider/CSV/CsvFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RinexNavFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RinexObsFile.hpp"
+#include "Nodes/DataProvider/GNSS/FileReader/Sp3File.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/EmlidFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RtklibPosFile.hpp"
+#include "Nodes/DataProvider/GNSS/FileReader/RtcmFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/NmeaFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/UbloxFile.hpp"
 #include "Nodes/DataProvider/GNSS/Sensors/EmlidSensor.hpp"
 #include "Nodes/DataProvider/GNSS/Sensors/UbloxSensor.hpp"
+#include "Nodes/DataProvider/GNSS/Sensors/RtcmStream.hpp"
 #include "Nodes/DataProvider/IMU/FileReader/ImuFile.hpp"
 #include "Nodes/DataProvider/IMU/FileReader/KvhFile.hpp"
 #include "Nodes/DataProvider/IMU/FileReader/VectorNavFile.hpp"
@@ -235,6 +244,9 @@ void NAV::NodeRegistry::RegisterNodeTypes()
 {
     LOG_TRACE("called");
 
+    // Registering again (e.g. when the program state is set up repeatedly) must not duplicate the entries
+    _registeredNodes.clear();
+
     Node::_autostartWorker = false;
 
     // Utility
@@ -264,23 +276,32 @@ void NAV::NodeRegistry::RegisterNodeTypes()
     registerNodeType<LcKfInsGnssErrorLogger>();
     registerNodeType<PosVelAttLogger>();
     // Data Processor
+    registerNodeType<AllanDeviation>();
+    registerNodeType<ImuCalibration>();
     registerNodeType<ErrorModel>();
     registerNodeType<GnssAnalyzer>();
     registerNodeType<SinglePointPositioning>();
+    registerNodeType<NetworkSinglePointPositioning>();
+    registerNodeType<TimeDifferencedCarrierPhase>();
+    registerNodeType<RealTimeKinematic>();
     registerNodeType<ImuIntegrator>();
     registerNodeType<LooselyCoupledKF>();
     registerNodeType<TightlyCoupledKF>();
     registerNodeType<ImuFusion>();
+    registerNodeType<FixedLagSmoother>();
     // Data Provider
     registerNodeType<CsvFile>();
     registerNodeType<RinexNavFile>();
     registerNodeType<RinexObsFile>();
+    registerNodeType<Sp3File>();
     registerNodeType<EmlidFile>();
     registerNodeType<RtklibPosFile>();
+    registerNodeType<RtcmFile>();
     registerNodeType<NmeaFile>();
     registerNodeType<UbloxFile>();
     registerNodeType<EmlidSensor>();
     registerNodeType<UbloxSensor>();
+    registerNodeType<RtcmStream>();
     registerNodeType<ImuFile>();
     registerNodeType<KvhFile>();
     registerNodeType<VectorNavFile>();
@@ -309,8 +330,10 @@ void NAV::NodeRegistry::RegisterNodeTypes()
 #include "NodeData/GNSS/EmlidObs.hpp"
 #include "NodeData/GNSS/GnssCombination.hpp"
 #include "NodeData/GNSS/GnssObs.hpp"
+#include "NodeData/GNSS/RtkSolution.hpp"
 #include "NodeData/GNSS/RtklibPosObs.hpp"
 #include "NodeData/GNSS/SppSolution.hpp"
+#include "NodeData/GNSS/TdcpSolution.hpp"
 #include "NodeData/GNSS/UbloxObs.hpp"
 #include "NodeData/IMU/ImuObs.hpp"
 #include "NodeData/IMU/ImuObsSimulated.hpp"
@@ -336,6 +359,8 @@ void NAV::NodeRegistry::RegisterNodeDataTypes()
     registerNodeDataType<GnssObs>();
     registerNodeDataType<RtklibPosObs>();
     registerNodeDataType<SppSolution>();
+    registerNodeDataType<TdcpSolution>();
+    registerNodeDataType<RtkSolution>();
     registerNodeDataType<UbloxObs>();
     // IMU
     registerNodeDataType<ImuObs>();
@@ -58,37 +58,36 @@ std::string NAV::UbloxGnssOrbitCollector::category()
 bool NAV::UbloxGnssOrbitCollector::initialize()
 {
     LOG_TRACE("{}: called", nameId());
-    if (!_postProcessingLock.has_value())
     {
         auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
         _gnssNavInfo.reset();
     }
-    else
-    {
-        _gnssNavInfo.reset();
-    }
     _ephemerisBuilder.clear();
     _lastAccessedBuilder.clear();
     _warningsNotImplemented.clear();
 
     if (inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).isPinLinked()
-        && !inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).link.connectedNode->isOnlyRealtime()
-        && !_postProcessingLock.has_value())
+        && !inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).link.connectedNode->isOnlyRealtime())
     {
-        _postProcessingLock.emplace(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex);
+        // Post-processing: Consumers wait till the messages up to their time were collected
+        _gnssNavInfo.setKnownUntil(InsTime{});
     }
 
     return true;
 }
 
+void NAV::UbloxGnssOrbitCollector::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _gnssNavInfo.setComplete();
+}
+
 void NAV::UbloxGnssOrbitCollector::onDeleteLink([[maybe_unused]] OutputPin& startPin, [[maybe_unused]] InputPin& endPin)
 {
     LOG_TRACE("{}: called for {} ==> {}", nameId(), size_t(startPin.id), size_t(endPin.id));
 
-    if (_postProcessingLock.has_value())
-    {
-        _postProcessingLock.reset();
-    }
+    _gnssNavInfo.setComplete();
 }
 
 NAV::UbloxGnssOrbitCollector::EphemerisBuilder& NAV::UbloxGnssOrbitCollector::getEphemerisBuilder(const SatId& satId, const InsTime& insTime, size_t IOD)
@@ -186,6 +185,14 @@ std::optional<std::reference_wrapper<NAV::UbloxGnssOrbitCollector::EphemerisBuil
     return std::nullopt;
 }
 
+bool NAV::UbloxGnssOrbitCollector::updateTimeSysCorr(TimeSystem timeSys, const GnssNavInfo::TimeSystemCorrections& corrections)
+{
+    auto& timeSysCorr = _gnssNavInfo.timeSysCorr[{ timeSys, UTC }];
+    if (timeSysCorr.a0 == corrections.a0 && timeSysCorr.a1 == corrections.a1) { return false; }
+    timeSysCorr = corrections;
+    return true;
+}
+
 void NAV::UbloxGnssOrbitCollector::receiveObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
 {
     [[maybe_unused]] auto ubloxObs = std::static_pointer_cast<const UbloxObs>(queue.extract_front());
@@ -230,11 +237,14 @@ void NAV::UbloxGnssOrbitCollector::receiveObs(NAV::InputPin::NodeDataQueue& queu
         }
     }
 
-    if (_postProcessingLock.has_value()
-        && inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).isPinLinked()
+    if (inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).isPinLinked()
         && inputPins.at(INPUT_PORT_INDEX_UBLOX_OBS).link.getConnectedPin()->noMoreDataAvailable)
     {
-        _postProcessingLock.reset();
+        _gnssNavInfo.setComplete();
+    }
+    else if (!ubloxObs->insTime.empty())
+    {
+        _gnssNavInfo.setKnownUntil(ubloxObs->insTime);
     }
 }
 
@@ -301,13 +311,8 @@ void NAV::UbloxGnssOrbitCollector::decryptGPS(const SatId& satId, const ubx::Ubx
             if (subframesFound.count() == 3)
             {
                 LOG_DATA("{}: [{}] [{}] All subframes found. Updating gnnsNavInfo", nameId(), satId, ephemeris->refTime.toYMDHMS(GPST));
-                std::unique_lock guard(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex, std::defer_lock);
-                if (!_postProcessingLock.has_value())
-                {
-                    guard.lock();
-                }
                 _gnssNavInfo.satelliteSystems |= satId.satSys;
-                _gnssNavInfo.addSatelliteNavData(satId, ephemeris);
+                if (_gnssNavInfo.addSatelliteNavData(satId, ephemeris)) { _gnssNavInfo.publish(insTime); } // Repeated subframes are already known
             }
         }
     };
@@ -611,30 +616,25 @@ void NAV::UbloxGnssOrbitCollector::decryptGPS(const SatId& satId, const ubx::Ubx
             w++;
             LOG_DATA("{}: [{}]     word {:2}: {} {}", nameId(), satId, w + 1 /* 10 */, std::bitset<2>(sfrbx.dwrd.at(w) >> 30), std::bitset<30>(sfrbx.dwrd.at(w)));
 
-            std::unique_lock guard(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex, std::defer_lock);
-            if (!_postProcessingLock.has_value())
-            {
-                guard.lock();
-            }
-
-            _gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Alpha,
+            bool changed = _gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Alpha,
                                                        {
                                                            alpha0 * std::pow(2, -30) /* [s] */,
                                                            alpha1 * std::pow(2, -27) /* [s/semi-circle] */,
                                                            alpha2 * std::pow(2, -24) /* [s/semi-circle^2] */,
                                                            alpha3 * std::pow(2, -24) /* [s/semi-circle^3] */,
                                                        });
-            _gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Beta,
+            changed |= _gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Beta,
                                                        {
                                                            beta0 * std::pow(2, 11) /* [s] */,
                                                            beta1 * std::pow(2, 14) /* [s/semi-circle] */,
                                                            beta2 * std::pow(2, 16) /* [s/semi-circle^2] */,
                                                            beta3 * std::pow(2, 16) /* [s/semi-circle^3] */,
                                                        });
-            _gnssNavInfo.timeSysCorr[{ satId.satSys.getTimeSystem(), UTC }] = GnssNavInfo::TimeSystemCorrections{
-                .a0 = A0 * std::pow(2, -30),
-                .a1 = A1 * std::pow(2, -50),
-            };
+            changed |= updateTimeSysCorr(satId.satSys.getTimeSystem(), GnssNavInfo::TimeSystemCorrections{
+                                                                            .a0 = A0 * std::pow(2, -30),
+                                                                            .a1 = A1 * std::pow(2, -50),
+                                                                        });
+            if (changed) { _gnssNavInfo.publish(insTime); }
         }
         else
         {
@@ -744,13 +744,8 @@ void NAV::UbloxGnssOrbitCollector::decryptGalileo(const SatId& satId, const ubx:
             if (subframesFound.count() == 5)
             {
                 LOG_DATA("{}: [{}] [{}] All words found. Updating gnnsNavInfo", nameId(), satId, ephemeris->refTime.toYMDHMS(GPST));
-                std::unique_lock guard(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex, std::defer_lock);
-                if (!_postProcessingLock.has_value())
-                {
-                    guard.lock();
-                }
                 _gnssNavInfo.satelliteSystems |= satId.satSys;
-                _gnssNavInfo.addSatelliteNavData(satId, ephemeris);
+                if (_gnssNavInfo.addSatelliteNavData(satId, ephemeris)) { _gnssNavInfo.publish(insTime); } // Repeated subframes are already known
             }
         }
     };
@@ -1073,20 +1068,16 @@ void NAV::UbloxGnssOrbitCollector::decryptGalileo(const SatId& satId, const ubx:
         ephemeris->dataSource[0] = true; // I/NAV E1-B
         ephemeris->dataSource[9] = true; // af0-af2, Toc, SISA are for E5b,E1
 
-        {
-            std::unique_lock guard(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex, std::defer_lock);
-            if (!_postProcessingLock.has_value())
-            {
-                guard.lock();
-            }
-            // ‘sfu’ (solar flux unit) is not a SI unit but can be converted as: 1 sfu = 10e-22 W/(m2*Hz)
-            _gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Alpha,
+        // ‘sfu’ (solar flux unit) is not a SI unit but can be converted as: 1 sfu = 10e-22 W/(m2*Hz)
+        if (_gnssNavInfo.ionosphericCorrections.insert(satId.satSys, IonosphericCorrections::Alpha,
                                                        {
                                                            ai0 * std::pow(2.0, -2) /* [sfu] */,
                                                            ai1 * std::pow(2.0, -8) /* [sfu/degree] */,
                                                            ai2 * std::pow(2.0, -15) /* [sfu/degree^2] */,
                                                            0.0,
-                                                       });
+                                                       }))
+        {
+            _gnssNavInfo.publish(insTime);
         }
 
         LOG_DEBUG("{}: [{}]     BGD_E1_E5a [{:.3e} s], BGD_E1_E5b [{:.3e} rad]", nameId(), satId, ephemeris->BGD_E1_E5a, ephemeris->BGD_E1_E5b);
@@ -1124,16 +1115,13 @@ void NAV::UbloxGnssOrbitCollector::decryptGalileo(const SatId& satId, const ubx:
         w++;
         LOG_DEBUG("{}: [{}]     word {:2}: {}", nameId(), satId, w + 1 /* 5 */, std::bitset<32>(sfrbx.dwrd.at(w)));
 
-        std::unique_lock guard(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).dataAccessMutex, std::defer_lock);
-        if (!_postProcessingLock.has_value())
+        if (updateTimeSysCorr(satId.satSys.getTimeSystem(), GnssNavInfo::TimeSystemCorrections{
+                                                                .a0 = A0 * std::pow(2, -30),
+                                                                .a1 = A1 * std::pow(2, -50),
+                                                            }))
         {
-            guard.lock();
+            _gnssNavInfo.publish(insTime);
         }
-
-        _gnssNavInfo.timeSysCorr[{ satId.satSys.getTimeSystem(), UTC }] = GnssNavInfo::TimeSystemCorrections{
-            .a0 = A0 * std::pow(2, -30),
-            .a1 = A1 * std::pow(2, -50),
-        };
     }
 }
 
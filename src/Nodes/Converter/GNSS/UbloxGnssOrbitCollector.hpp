@@ -13,7 +13,6 @@
 
 #pragma once
 
-#include <mutex>
 #include <bitset>
 #include <memory>
 #include <unordered_map>
@@ -62,17 +61,17 @@ class UbloxGnssOrbitCollector : public Node
     /// @brief Initialize the node
     bool initialize() override;
 
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
     /// @brief Called when a link is to be deleted
     /// @param[in] startPin Pin where the link starts
     /// @param[in] endPin Pin where the link ends
     void onDeleteLink(OutputPin& startPin, InputPin& endPin) override;
 
-    /// @brief Data object to share over the output pin
+    /// @brief Data object to share over the output pin. Consumers access the published versions.
     GnssNavInfo _gnssNavInfo;
 
-    /// Mutex to lock if the connected ublox obs provider is a file reader
-    std::optional<std::unique_lock<std::mutex>> _postProcessingLock;
-
     /// @brief Ephemeris builder to store unfinished ephemeris data till all subframes are collected
     struct EphemerisBuilder
     {
@@ -117,6 +116,12 @@ class UbloxGnssOrbitCollector : public Node
     /// @return Reference to the ephemeris builder if it was found
     std::optional<std::reference_wrapper<EphemerisBuilder>> getLastEphemerisBuilder(const SatId& satId);
 
+    /// @brief Stores the time system corrections to UTC
+    /// @param[in] timeSys Time system of the satellite system
+    /// @param[in] corrections Received correction parameters
+    /// @return True if the stored parameters changed
+    bool updateTimeSysCorr(TimeSystem timeSys, const GnssNavInfo::TimeSystemCorrections& corrections);
+
     /// @brief Data receive function
     /// @param[in] queue Queue with all the received data messages
     /// @param[in] pinIdx Index of the pin the data is received on
@@ -97,8 +97,6 @@ bool NAV::SppSolutionLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _filestream << "Time [s],GpsCycle,GpsWeek,GpsTow [s],"
                 << "Pos ECEF X [m],Pos ECEF Y [m],Pos ECEF Z [m],Latitude [deg],Longitude [deg],Altitude [m],"
                 << "North/South [m],East/West [m],"
@@ -96,8 +96,6 @@ bool NAV::MatrixLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _headerWritten = false;
 
     return true;
@@ -103,8 +103,6 @@ bool NAV::ImuDataLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _filestream << "Time [s],GpsCycle,GpsWeek,GpsToW [s],TimeStartup [ns],"
                 << "MagX [Gauss],MagY [Gauss],MagZ [Gauss],"
                 << "AccX [m/s^2],AccY [m/s^2],AccZ [m/s^2],"
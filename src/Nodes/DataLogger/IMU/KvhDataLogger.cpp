@@ -95,8 +95,6 @@ bool NAV::KvhDataLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _filestream << "Time [s],GpsCycle,GpsWeek,GpsToW [s],TimeStartup [ns],"
                 << "UnCompMagX [Gauss],UnCompMagY [Gauss],UnCompMagZ [Gauss],"
                 << "UnCompAccX [m/s^2],UnCompAccY [m/s^2],UnCompAccZ [m/s^2],"
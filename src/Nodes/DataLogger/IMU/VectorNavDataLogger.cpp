@@ -142,8 +142,6 @@ bool NAV::VectorNavDataLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _headerWritten = false;
 
     return true;
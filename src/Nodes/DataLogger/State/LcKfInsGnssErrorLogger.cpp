@@ -97,8 +97,6 @@ bool NAV::LcKfInsGnssErrorLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _filestream << "Time [s],GpsCycle,GpsWeek,GpsTow [s],"
                 // PVAError
                 << "Roll error [deg],Pitch error [deg],Yaw error [deg],"
@@ -99,8 +99,6 @@ bool NAV::PosVelAttLogger::initialize()
         return false;
     }
 
-    CommonLog::initialize();
-
     _filestream << "Time [s],GpsCycle,GpsWeek,GpsToW [s],"
                 << "Pos ECEF X [m],Pos ECEF Y [m],Pos ECEF Z [m],Latitude [deg],Longitude [deg],Altitude [m],"
                 << "North/South [m],East/West [m],"
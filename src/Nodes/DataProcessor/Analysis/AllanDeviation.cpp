@@ -0,0 +1,381 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AllanDeviation.hpp"
+
+#include <cmath>
+#include <iomanip>
+
+#include "NodeData/IMU/ImuObs.hpp"
+#include "NodeData/IMU/ImuObsSimulated.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/LiveReconfiguration.hpp"
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/Eigen.hpp"
+#include "util/Logger.hpp"
+
+NAV::AllanDeviation::AllanDeviation()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _fileType = FileType::ASCII;
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 630, 410 };
+
+    nm::CreateInputPin(this, "ImuObs", Pin::Type::Flow, { NAV::ImuObs::type(), NAV::ImuObsSimulated::type() }, &AllanDeviation::receiveImuObs);
+}
+
+NAV::AllanDeviation::~AllanDeviation()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::AllanDeviation::typeStatic()
+{
+    return "AllanDeviation";
+}
+
+std::string NAV::AllanDeviation::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::AllanDeviation::category()
+{
+    return "Data Processor";
+}
+
+void NAV::AllanDeviation::guiConfig()
+{
+    if (FileWriter::guiConfig(".csv", { ".csv" }, size_t(id), nameId()))
+    {
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+
+    ImGui::SetNextItemWidth(200.0F);
+    if (ImGui::InputDoubleL(fmt::format("Max averaging time [s]##{}", size_t(id)).c_str(), &_maxAveragingTime, 1e-3, std::numeric_limits<double>::max(), 0.0, 0.0, "%.1f"))
+    {
+        LOG_DEBUG("{}: Max averaging time changed to {}", nameId(), _maxAveragingTime);
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SetNextItemWidth(200.0F);
+    if (ImGui::InputIntL(fmt::format("Averaging times per decade##{}", size_t(id)).c_str(), &_clustersPerDecade, 1, 100))
+    {
+        LOG_DEBUG("{}: Averaging times per decade changed to {}", nameId(), _clustersPerDecade);
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    if (ImGui::Checkbox(fmt::format("Hadamard deviation##{}", size_t(id)).c_str(), &_hadamard))
+    {
+        LOG_DEBUG("{}: Hadamard deviation changed to {}", nameId(), _hadamard);
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("The Hadamard deviation is insensitive to a linear drift of the rate (e.g. a warm-up drift)");
+
+    std::scoped_lock lock(_resultMutex);
+    if (!_result) { return; }
+
+    ImGui::Separator();
+    ImGui::Text("Fitted noise parameters (mean sample interval %.6f s)", _result->sampleInterval);
+    if (ImGui::BeginTable(fmt::format("Noise parameters##{}", size_t(id)).c_str(), 7, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Axis");
+        ImGui::TableSetupColumn("White noise N");
+        ImGui::TableSetupColumn("Bias instab. B");
+        ImGui::TableSetupColumn("Random walk K");
+        ImGui::TableSetupColumn("Rate ramp R");
+        ImGui::TableSetupColumn("GM σ");
+        ImGui::TableSetupColumn("GM τ [s]");
+        ImGui::TableHeadersRow();
+        for (size_t i = 0; i < 6; i++)
+        {
+            const auto& p = i < 3 ? _result->accel.at(i) : _result->gyro.at(i - 3);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(fmt::format("{} {}", i < 3 ? "Accel" : "Gyro", static_cast<char>('X' + i % 3)).c_str());
+            for (double value : { p.whiteNoise, p.biasInstability, p.randomWalk, p.rateRamp, p.gaussMarkovStdDev, p.gaussMarkovCorrelationTime })
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(fmt::format("{:.3e}", value).c_str());
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::TextUnformatted("Units: accelerometer m/s², gyroscope rad/s (N per √(Hz), K times √(Hz), R per s)");
+
+    // Apply the parameters to another node
+    std::vector<Node*> targets;
+    for (auto* node : nm::m_Nodes())
+    {
+        if (node->type() == "ErrorModel" || node->type() == "LooselyCoupledKF" || node->type() == "TightlyCoupledKF") { targets.push_back(node); }
+    }
+    if (targets.empty()) { return; }
+    _gui_applyNodeIdx = std::min(_gui_applyNodeIdx, targets.size() - 1);
+    ImGui::SetNextItemWidth(200.0F);
+    if (ImGui::BeginCombo(fmt::format("##Apply to node {}", size_t(id)).c_str(), targets.at(_gui_applyNodeIdx)->nameId().c_str()))
+    {
+        for (size_t i = 0; i < targets.size(); i++)
+        {
+            if (ImGui::Selectable(targets.at(i)->nameId().c_str(), _gui_applyNodeIdx == i)) { _gui_applyNodeIdx = i; }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(fmt::format("Apply noise parameters##{}", size_t(id)).c_str()))
+    {
+        auto* target = targets.at(_gui_applyNodeIdx);
+        auto parameters = noiseParameters(*_result);
+        if (LiveReconfiguration::apply(json{ { fmt::format("node-{}", size_t(target->id)), parameters.at(target->type()) } }))
+        {
+            flow::ApplyChanges();
+        }
+    }
+}
+
+[[nodiscard]] json NAV::AllanDeviation::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileWriter"] = FileWriter::save();
+    j["maxAveragingTime"] = _maxAveragingTime;
+    j["clustersPerDecade"] = _clustersPerDecade;
+    j["hadamard"] = _hadamard;
+
+    return j;
+}
+
+void NAV::AllanDeviation::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileWriter")) { FileWriter::restore(j.at("FileWriter")); }
+    if (j.contains("maxAveragingTime")) { j.at("maxAveragingTime").get_to(_maxAveragingTime); }
+    if (j.contains("clustersPerDecade")) { j.at("clustersPerDecade").get_to(_clustersPerDecade); }
+    if (j.contains("hadamard")) { j.at("hadamard").get_to(_hadamard); }
+}
+
+bool NAV::AllanDeviation::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!FileWriter::initialize())
+    {
+        return false;
+    }
+
+    _allanVariance.reset();
+    _firstTime.reset();
+    _firstTimeSinceStartup.reset();
+    _lastTime = 0.0;
+    _firstSample.reset();
+
+    return true;
+}
+
+void NAV::AllanDeviation::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    FileWriter::deinitialize();
+}
+
+void NAV::AllanDeviation::receiveImuObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto obs = std::static_pointer_cast<const ImuObs>(queue.extract_front());
+
+    // Raw measurements are preferred, as the noise is characterized before any compensation
+    const auto& accel = obs->accelUncompXYZ ? obs->accelUncompXYZ : obs->accelCompXYZ;
+    const auto& gyro = obs->gyroUncompXYZ ? obs->gyroUncompXYZ : obs->gyroCompXYZ;
+    if (!accel || !gyro)
+    {
+        LOG_DATA("{}: Skipping observation without accelerometer or gyroscope measurements", nameId());
+        return;
+    }
+
+    double time = 0.0;
+    if (!obs->insTime.empty())
+    {
+        if (_firstTime.empty()) { _firstTime = obs->insTime; }
+        time = static_cast<double>((obs->insTime - _firstTime).count());
+    }
+    else if (obs->timeSinceStartup)
+    {
+        if (!_firstTimeSinceStartup) { _firstTimeSinceStartup = obs->timeSinceStartup; }
+        time = static_cast<double>(*obs->timeSinceStartup - *_firstTimeSinceStartup) * 1e-9;
+    }
+    else
+    {
+        LOG_DATA("{}: Skipping observation without time", nameId());
+        return;
+    }
+
+    Eigen::Matrix<double, 6, 1> sample;
+    sample << *accel, *gyro;
+
+    if (!_firstSample)
+    {
+        _firstSample = sample;
+        return;
+    }
+    if (!_allanVariance)
+    {
+        if (time <= 0.0)
+        {
+            LOG_WARN("{}: Skipping observation with the same time as the first one", nameId());
+            return;
+        }
+        auto maxClusterSize = static_cast<size_t>(std::max(_maxAveragingTime / time, 1.0));
+        LOG_DEBUG("{}: Sample interval {} s, largest cluster size {} samples", nameId(), time, maxClusterSize);
+        _allanVariance.emplace(6, maxClusterSize, static_cast<size_t>(_clustersPerDecade), _hadamard);
+        _allanVariance->addSample(*_firstSample);
+    }
+
+    _allanVariance->addSample(sample);
+    _lastTime = time;
+}
+
+void NAV::AllanDeviation::flush()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!_allanVariance || _allanVariance->sampleCount() < 3)
+    {
+        LOG_WARN("{}: Not enough IMU observations received to calculate the Allan deviation", nameId());
+        return;
+    }
+
+    size_t samples = _allanVariance->sampleCount();
+    double dt = _lastTime / static_cast<double>(samples - 1);
+    auto clusters = _allanVariance->clusters();
+
+    // Allan deviation table
+    _filestream << "tau [s],"
+                << "AccX ADEV [m/s^2],AccY ADEV [m/s^2],AccZ ADEV [m/s^2],"
+                << "GyroX ADEV [rad/s],GyroY ADEV [rad/s],GyroZ ADEV [rad/s]";
+    if (_hadamard)
+    {
+        _filestream << ",AccX HDEV [m/s^2],AccY HDEV [m/s^2],AccZ HDEV [m/s^2],"
+                    << "GyroX HDEV [rad/s],GyroY HDEV [rad/s],GyroZ HDEV [rad/s]";
+    }
+    _filestream << '\n';
+
+    constexpr int valuePrecision = 9;
+    std::vector<double> tau;
+    std::vector<double> edf;
+    for (const auto& cluster : clusters)
+    {
+        tau.push_back(static_cast<double>(cluster.m) * dt);
+        edf.push_back(allanVarianceDegreesOfFreedom(samples, cluster.m));
+
+        _filestream << std::setprecision(valuePrecision) << tau.back();
+        for (const auto& variance : cluster.allanVariance) { _filestream << ',' << std::sqrt(variance); }
+        if (_hadamard)
+        {
+            for (const auto& variance : cluster.hadamardVariance)
+            {
+                _filestream << ',';
+                if (cluster.hadamardTerms > 0) { _filestream << std::sqrt(variance); }
+            }
+        }
+        _filestream << '\n';
+    }
+    _filestream.flush();
+
+    // Fit of the noise terms
+    Result result;
+    result.sampleInterval = dt;
+    for (Eigen::Index c = 0; c < 6; c++)
+    {
+        std::vector<double> allanVariance;
+        allanVariance.reserve(clusters.size());
+        for (const auto& cluster : clusters) { allanVariance.push_back(cluster.allanVariance(c)); }
+
+        auto params = fitAllanNoiseParameters(tau, allanVariance, edf);
+        if (c < 3) { result.accel.at(static_cast<size_t>(c)) = params; }
+        else { result.gyro.at(static_cast<size_t>(c - 3)) = params; }
+
+        LOG_INFO("{}: {} {}: N = {:.3e}, B = {:.3e}, K = {:.3e}, R = {:.3e}, Gauss-Markov σ = {:.3e}, τ = {:.1f} s", nameId(),
+                 c < 3 ? "Accel" : "Gyro", static_cast<char>('X' + c % 3),
+                 params.whiteNoise, params.biasInstability, params.randomWalk, params.rateRamp, params.gaussMarkovStdDev, params.gaussMarkovCorrelationTime);
+    }
+
+    auto jsonPath = getFilepath().replace_extension(".json");
+    if (std::ofstream jsonFile(jsonPath); jsonFile.good())
+    {
+        jsonFile << std::setw(4) << noiseParameters(result) << '\n';
+        LOG_INFO("{}: Noise parameters written to '{}'", nameId(), jsonPath.string());
+    }
+    else
+    {
+        LOG_ERROR("{}: Could not write the noise parameters to '{}'", nameId(), jsonPath.string());
+    }
+
+    std::scoped_lock lock(_resultMutex);
+    _result = result;
+}
+
+json NAV::AllanDeviation::noiseParameters(const Result& result)
+{
+    Eigen::Vector3d accelWhiteNoise;
+    Eigen::Vector3d gyroWhiteNoise;
+    Eigen::Vector3d accelBias;
+    Eigen::Vector3d gyroBias;
+    Eigen::Vector3d accelTau;
+    Eigen::Vector3d gyroTau;
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto idx = static_cast<Eigen::Index>(i);
+        accelWhiteNoise(idx) = result.accel.at(i).whiteNoise;
+        gyroWhiteNoise(idx) = result.gyro.at(i).whiteNoise;
+        accelBias(idx) = result.accel.at(i).gaussMarkovStdDev;
+        gyroBias(idx) = result.gyro.at(i).gaussMarkovStdDev;
+        accelTau(idx) = result.accel.at(i).gaussMarkovCorrelationTime;
+        gyroTau(idx) = result.gyro.at(i).gaussMarkovCorrelationTime;
+    }
+
+    // The ErrorModel adds white noise per sample, so the noise density is scaled with the sample rate
+    double sqrtRate = result.sampleInterval > 0.0 ? 1.0 / std::sqrt(result.sampleInterval) : 0.0;
+
+    json kalmanFilter{
+        { "stdev_ra", accelWhiteNoise },
+        { "stdevAccelNoiseUnits", 1 }, // [m / s^2 / √(Hz)]
+        { "stdev_rg", gyroWhiteNoise },
+        { "stdevGyroNoiseUnits", 1 }, // [rad / s /√(Hz)]
+        { "stdev_bad", accelBias },
+        { "tau_bad", accelTau },
+        { "stdevAccelBiasUnits", 1 }, // [m / s^2]
+        { "stdev_bgd", gyroBias },
+        { "tau_bgd", gyroTau },
+        { "stdevGyroBiasUnits", 1 }, // [rad / s]
+    };
+
+    return {
+        { "ErrorModel", {
+                            { "imuAccelerometerNoiseUnit", 0 }, // [m/s^2] (Standard deviation)
+                            { "imuAccelerometerNoise", Eigen::Vector3d(accelWhiteNoise * sqrtRate) },
+                            { "imuGyroscopeNoiseUnit", 0 }, // [rad/s] (Standard deviation)
+                            { "imuGyroscopeNoise", Eigen::Vector3d(gyroWhiteNoise * sqrtRate) },
+                        } },
+        { "LooselyCoupledKF", kalmanFilter },
+        { "TightlyCoupledKF", kalmanFilter },
+    };
+}
@@ -0,0 +1,123 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AllanDeviation.hpp
+/// @brief Computes the Allan deviation of IMU observations and fits the IMU noise parameters
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataLogger/Protocol/FileWriter.hpp"
+#include "Navigation/Math/AllanVariance.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV
+{
+/// @brief Computes the overlapping Allan deviation of static IMU recordings and fits the noise parameters
+///
+/// The Allan deviation is calculated while the data streams through the node, with memory independent of the recording
+/// length. After the flow finished, the deviations are written into the selected csv file and the fitted noise parameters
+/// into a json file next to it. The fitted parameters are given in the format of the ErrorModel and Kalman filter nodes.
+class AllanDeviation : public Node, public FileWriter
+{
+  public:
+    /// @brief Default constructor
+    AllanDeviation();
+    /// @brief Destructor
+    ~AllanDeviation() override;
+    /// @brief Copy constructor
+    AllanDeviation(const AllanDeviation&) = delete;
+    /// @brief Move constructor
+    AllanDeviation(AllanDeviation&&) = delete;
+    /// @brief Copy assignment operator
+    AllanDeviation& operator=(const AllanDeviation&) = delete;
+    /// @brief Move assignment operator
+    AllanDeviation& operator=(AllanDeviation&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Function called by the flow executer after finishing to flush out remaining data
+    void flush() override;
+
+    /// @brief Fitted noise parameters of the accelerometer and gyroscope axes
+    struct Result
+    {
+        double sampleInterval = 0.0;                    ///< Mean sample interval [s]
+        std::array<AllanNoiseParameters, 3> accel;      ///< Accelerometer axes [m/s^2]
+        std::array<AllanNoiseParameters, 3> gyro;       ///< Gyroscope axes [rad/s]
+    };
+
+    /// @brief Converts the fitted noise parameters into the parameters of the ErrorModel and Kalman filter nodes
+    /// @param[in] result Fitted noise parameters
+    /// @return Json object with the node types as keys and the parameters in the format of their save() as values
+    [[nodiscard]] static json noiseParameters(const Result& result);
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_IMU_OBS = 0; ///< @brief ImuObs
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Receive Function for the IMU observations
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void receiveImuObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// Largest averaging time [s]
+    double _maxAveragingTime = 10000.0;
+    /// Amount of log-spaced averaging times per decade
+    int _clustersPerDecade = 10;
+    /// Whether to calculate the Hadamard deviation as well
+    bool _hadamard = false;
+
+    /// Allan variance estimator, created with the second observation when the sample rate is known
+    std::optional<AllanVariance> _allanVariance;
+    /// Time of the first observation
+    InsTime _firstTime;
+    /// Time since startup of the first observation, used if the observations have no time [ns]
+    std::optional<uint64_t> _firstTimeSinceStartup;
+    /// Time of the last observation since the first one [s]
+    double _lastTime = 0.0;
+    /// First observation, which is buffered until the sample rate is known
+    std::optional<Eigen::Matrix<double, 6, 1>> _firstSample;
+
+    /// Mutex for the result, which is calculated in the flow thread and shown in the GUI
+    mutable std::mutex _resultMutex;
+    /// Fitted noise parameters of the last run
+    std::optional<Result> _result;
+    /// Node selected in the GUI to apply the parameters to
+    size_t _gui_applyNodeIdx = 0;
+};
+
+} // namespace NAV
@@ -0,0 +1,344 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ImuCalibration.hpp"
+
+#include "NodeData/IMU/ImuObs.hpp"
+#include "NodeData/IMU/ImuObsSimulated.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/LiveReconfiguration.hpp"
+
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "Navigation/Gravity/Gravity.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+#include "util/Eigen.hpp"
+#include "util/Logger.hpp"
+
+NAV::ImuCalibration::ImuCalibration()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 560, 480 };
+
+    nm::CreateInputPin(this, "ImuObs", Pin::Type::Flow, { NAV::ImuObs::type(), NAV::ImuObsSimulated::type() }, &ImuCalibration::receiveImuObs);
+
+    nm::CreateOutputPin(this, "ImuObs", Pin::Type::Flow, { NAV::ImuObs::type() });
+}
+
+NAV::ImuCalibration::~ImuCalibration()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::ImuCalibration::typeStatic()
+{
+    return "ImuCalibration";
+}
+
+std::string NAV::ImuCalibration::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::ImuCalibration::category()
+{
+    return "Data Processor";
+}
+
+void NAV::ImuCalibration::guiConfig()
+{
+    ImGui::SetNextItemWidth(200.0F);
+    if (gui::widgets::EnumCombo(fmt::format("Mode##{}", size_t(id)).c_str(), _mode))
+    {
+        LOG_DEBUG("{}: Mode changed to {}", nameId(), to_string(_mode));
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Calibrate: Estimates the parameters from a tumble test, which starts with a static period and rests "
+                             "in many different orientations. The parameters are stored in the node.\n"
+                             "Apply: Calibrates the raw measurements with the stored parameters and outputs them as compensated measurements.");
+
+    if (_mode == Mode::Calibrate)
+    {
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDoubleL(fmt::format("Initial static time [s]##{}", size_t(id)).c_str(), &_options.initialStaticTime, 1.0, std::numeric_limits<double>::max(), 0.0, 0.0, "%.1f"))
+        {
+            LOG_DEBUG("{}: Initial static time changed to {}", nameId(), _options.initialStaticTime);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("The sensor has to rest during this time at the start of the recording. It defines the noise level of the static detector.");
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDoubleL(fmt::format("Detector window [s]##{}", size_t(id)).c_str(), &_options.windowTime, 0.01, std::numeric_limits<double>::max(), 0.0, 0.0, "%.2f"))
+        {
+            LOG_DEBUG("{}: Detector window changed to {}", nameId(), _options.windowTime);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDoubleL(fmt::format("Threshold factor##{}", size_t(id)).c_str(), &_options.thresholdFactor, 1.0, std::numeric_limits<double>::max(), 0.0, 0.0, "%.1f"))
+        {
+            LOG_DEBUG("{}: Threshold factor changed to {}", nameId(), _options.thresholdFactor);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("A window is static, if its accelerometer variance is below this multiple of the variance in the initial static period");
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDoubleL(fmt::format("Min static time [s]##{}", size_t(id)).c_str(), &_options.minStaticTime, 0.0, std::numeric_limits<double>::max(), 0.0, 0.0, "%.1f"))
+        {
+            LOG_DEBUG("{}: Min static time changed to {}", nameId(), _options.minStaticTime);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDoubleL(fmt::format("Latitude [deg]##{}", size_t(id)).c_str(), &_latitude, -90.0, 90.0, 0.0, 0.0, "%.4f"))
+        {
+            LOG_DEBUG("{}: Latitude changed to {}", nameId(), _latitude);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputDouble(fmt::format("Altitude [m]##{}", size_t(id)).c_str(), &_altitude, 0.0, 0.0, "%.1f"))
+        {
+            LOG_DEBUG("{}: Altitude changed to {}", nameId(), _altitude);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("The position determines the local gravity and the Earth rotation which are the references of the calibration");
+        auto maxIterations = static_cast<int>(_options.maxIterations);
+        ImGui::SetNextItemWidth(200.0F);
+        if (ImGui::InputIntL(fmt::format("Max iterations##{}", size_t(id)).c_str(), &maxIterations, 1, 1000))
+        {
+            _options.maxIterations = static_cast<size_t>(maxIterations);
+            LOG_DEBUG("{}: Max iterations changed to {}", nameId(), _options.maxIterations);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+
+    std::scoped_lock lock(_parametersMutex);
+
+    ImGui::Separator();
+    if (_result)
+    {
+        ImGui::Text("Last calibration: %zu static intervals, %zu motions", _result->staticIntervals, _result->motions);
+        ImGui::Text("Residuals: %.2e m/s² (gravity magnitude), %.2e rad (gravity direction)", _result->accelResidualRms, _result->gyroResidualRms);
+    }
+    if (ImGui::BeginTable(fmt::format("Calibration parameters##{}", size_t(id)).c_str(), 5, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Axis");
+        ImGui::TableSetupColumn("Matrix X");
+        ImGui::TableSetupColumn("Matrix Y");
+        ImGui::TableSetupColumn("Matrix Z");
+        ImGui::TableSetupColumn("Bias");
+        ImGui::TableHeadersRow();
+        for (Eigen::Index i = 0; i < 6; i++)
+        {
+            const auto& matrix = i < 3 ? _parameters.accelScaleMisalignment : _parameters.gyroScaleMisalignment;
+            const auto& bias = i < 3 ? _parameters.accelBias : _parameters.gyroBias;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(fmt::format("{} {}", i < 3 ? "Accel" : "Gyro", static_cast<char>('X' + i % 3)).c_str());
+            for (Eigen::Index c = 0; c < 3; c++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(fmt::format("{:.6f}", matrix(i % 3, c)).c_str());
+            }
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(fmt::format("{:.3e}", bias(i % 3)).c_str());
+        }
+        ImGui::EndTable();
+    }
+    ImGui::TextUnformatted("Calibrated = Matrix * (raw - Bias), units: accelerometer m/s², gyroscope rad/s");
+    if (ImGui::Button(fmt::format("Reset parameters##{}", size_t(id)).c_str()))
+    {
+        _parameters = ImuCalibrationParameters{};
+        _result.reset();
+        flow::ApplyChanges();
+    }
+
+    // Copy the parameters to another calibration node, e.g. one applying them to the mission data
+    std::vector<Node*> targets;
+    for (auto* node : nm::m_Nodes())
+    {
+        if (node->type() == typeStatic() && node != this) { targets.push_back(node); }
+    }
+    if (targets.empty()) { return; }
+    _gui_applyNodeIdx = std::min(_gui_applyNodeIdx, targets.size() - 1);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(200.0F);
+    if (ImGui::BeginCombo(fmt::format("##Copy to node {}", size_t(id)).c_str(), targets.at(_gui_applyNodeIdx)->nameId().c_str()))
+    {
+        for (size_t i = 0; i < targets.size(); i++)
+        {
+            if (ImGui::Selectable(targets.at(i)->nameId().c_str(), _gui_applyNodeIdx == i)) { _gui_applyNodeIdx = i; }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(fmt::format("Copy parameters##{}", size_t(id)).c_str()))
+    {
+        auto* target = targets.at(_gui_applyNodeIdx);
+        if (LiveReconfiguration::apply(json{ { fmt::format("node-{}", size_t(target->id)), { { "parameters", _parameters } } } }))
+        {
+            flow::ApplyChanges();
+        }
+    }
+}
+
+[[nodiscard]] json NAV::ImuCalibration::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["mode"] = _mode;
+    j["initialStaticTime"] = _options.initialStaticTime;
+    j["windowTime"] = _options.windowTime;
+    j["thresholdFactor"] = _options.thresholdFactor;
+    j["minStaticTime"] = _options.minStaticTime;
+    j["maxIterations"] = _options.maxIterations;
+    j["latitude"] = _latitude;
+    j["altitude"] = _altitude;
+    {
+        std::scoped_lock lock(_parametersMutex);
+        j["parameters"] = _parameters;
+    }
+
+    return j;
+}
+
+void NAV::ImuCalibration::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("mode")) { j.at("mode").get_to(_mode); }
+    if (j.contains("initialStaticTime")) { j.at("initialStaticTime").get_to(_options.initialStaticTime); }
+    if (j.contains("windowTime")) { j.at("windowTime").get_to(_options.windowTime); }
+    if (j.contains("thresholdFactor")) { j.at("thresholdFactor").get_to(_options.thresholdFactor); }
+    if (j.contains("minStaticTime")) { j.at("minStaticTime").get_to(_options.minStaticTime); }
+    if (j.contains("maxIterations")) { j.at("maxIterations").get_to(_options.maxIterations); }
+    if (j.contains("latitude")) { j.at("latitude").get_to(_latitude); }
+    if (j.contains("altitude")) { j.at("altitude").get_to(_altitude); }
+    if (j.contains("parameters"))
+    {
+        std::scoped_lock lock(_parametersMutex);
+        j.at("parameters").get_to(_parameters);
+    }
+}
+
+bool NAV::ImuCalibration::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _calibration.reset();
+    _firstTime.reset();
+    _firstTimeSinceStartup.reset();
+
+    if (_mode == Mode::Calibrate)
+    {
+        auto options = _options;
+        options.latitude = deg2rad(_latitude);
+        options.gravity = n_calcGravitation_SomiglianaAltitude(options.latitude, _altitude).norm();
+        LOG_DEBUG("{}: Local gravity {} m/s^2", nameId(), options.gravity);
+        _calibration.emplace(options);
+    }
+
+    return true;
+}
+
+void NAV::ImuCalibration::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _calibration.reset();
+}
+
+void NAV::ImuCalibration::receiveImuObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto obs = std::static_pointer_cast<const ImuObs>(queue.extract_front());
+
+    // The calibration refers to the raw measurements
+    const auto& accel = obs->accelUncompXYZ ? obs->accelUncompXYZ : obs->accelCompXYZ;
+    const auto& gyro = obs->gyroUncompXYZ ? obs->gyroUncompXYZ : obs->gyroCompXYZ;
+
+    if (_mode == Mode::Apply)
+    {
+        auto imuObs = std::make_shared<ImuObs>(*obs);
+        {
+            std::scoped_lock lock(_parametersMutex);
+            if (accel) { imuObs->accelCompXYZ = _parameters.calibrateAccel(*accel); }
+            if (gyro) { imuObs->gyroCompXYZ = _parameters.calibrateGyro(*gyro); }
+        }
+        invokeCallbacks(OUTPUT_PORT_INDEX_IMU_OBS, imuObs);
+        return;
+    }
+
+    if (!accel || !gyro)
+    {
+        LOG_DATA("{}: Skipping observation without accelerometer or gyroscope measurements", nameId());
+        return;
+    }
+
+    double time = 0.0;
+    if (!obs->insTime.empty())
+    {
+        if (_firstTime.empty()) { _firstTime = obs->insTime; }
+        time = static_cast<double>((obs->insTime - _firstTime).count());
+    }
+    else if (obs->timeSinceStartup)
+    {
+        if (!_firstTimeSinceStartup) { _firstTimeSinceStartup = obs->timeSinceStartup; }
+        time = static_cast<double>(*obs->timeSinceStartup - *_firstTimeSinceStartup) * 1e-9;
+    }
+    else
+    {
+        LOG_DATA("{}: Skipping observation without time", nameId());
+        return;
+    }
+
+    _calibration->addSample(time, *accel, *gyro);
+}
+
+void NAV::ImuCalibration::flush()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (_mode != Mode::Calibrate || !_calibration) { return; }
+
+    LOG_INFO("{}: Calibrating from {} observations with {} static intervals", nameId(),
+             _calibration->sampleCount(), _calibration->staticIntervals().size());
+    auto result = _calibration->solve();
+    if (!result)
+    {
+        LOG_ERROR("{}: The calibration failed. Check that the recording starts static and rests in enough different orientations.", nameId());
+        return;
+    }
+
+    const auto& params = result->parameters;
+    LOG_INFO("{}: Accelerometer bias {} m/s^2, scale factor and misalignment\n{}", nameId(), params.accelBias.transpose(), params.accelScaleMisalignment);
+    LOG_INFO("{}: Gyroscope bias {} rad/s, scale factor and misalignment\n{}", nameId(), params.gyroBias.transpose(), params.gyroScaleMisalignment);
+    LOG_INFO("{}: Residuals {:.2e} m/s^2 (gravity magnitude) and {:.2e} rad (gravity direction)", nameId(), result->accelResidualRms, result->gyroResidualRms);
+
+    std::scoped_lock lock(_parametersMutex);
+    _parameters = params;
+    _result = result;
+}
@@ -0,0 +1,134 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ImuCalibration.hpp
+/// @brief Calibrates IMU scale factors, misalignments and biases from multi-position static recordings and applies them
+/// @date 2026-10-18
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "internal/Node/Node.hpp"
+#include "Navigation/INS/MultiPositionCalibration.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV
+{
+/// @brief Batch calibration of the deterministic IMU errors from a tumble test
+///
+/// In calibration mode, the static intervals of the recording are detected while the data streams through the node. After
+/// the flow finished, the scale factors, misalignments and biases are estimated and stored in the node. In apply mode, the
+/// stored parameters are applied to the raw measurements and the calibrated observations are sent to the output.
+class ImuCalibration : public Node
+{
+  public:
+    /// @brief Default constructor
+    ImuCalibration();
+    /// @brief Destructor
+    ~ImuCalibration() override;
+    /// @brief Copy constructor
+    ImuCalibration(const ImuCalibration&) = delete;
+    /// @brief Move constructor
+    ImuCalibration(ImuCalibration&&) = delete;
+    /// @brief Copy assignment operator
+    ImuCalibration& operator=(const ImuCalibration&) = delete;
+    /// @brief Move assignment operator
+    ImuCalibration& operator=(ImuCalibration&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Function called by the flow executer after finishing to flush out remaining data
+    void flush() override;
+
+    /// @brief Operating mode of the node
+    enum class Mode
+    {
+        Calibrate, ///< Estimate the calibration parameters from a tumble test
+        Apply,     ///< Apply the calibration parameters to the observations
+        COUNT,     ///< Amount of items in the enum
+    };
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_IMU_OBS = 0;  ///< @brief ImuObs
+    constexpr static size_t OUTPUT_PORT_INDEX_IMU_OBS = 0; ///< @brief Flow (ImuObs)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Receive Function for the IMU observations
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void receiveImuObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// Operating mode
+    Mode _mode = Mode::Calibrate;
+    /// Options of the calibration
+    MultiPositionCalibration::Options _options;
+    /// Latitude of the tumble test [deg]
+    double _latitude = 48.78;
+    /// Altitude of the tumble test above the ellipsoid [m]
+    double _altitude = 300.0;
+
+    /// Calibration, created when the flow starts in calibration mode
+    std::optional<MultiPositionCalibration> _calibration;
+    /// Time of the first observation
+    InsTime _firstTime;
+    /// Time since startup of the first observation, used if the observations have no time [ns]
+    std::optional<uint64_t> _firstTimeSinceStartup;
+
+    /// Mutex for the parameters, which are estimated in the flow thread and shown in the GUI
+    mutable std::mutex _parametersMutex;
+    /// Calibration parameters, applied in apply mode
+    ImuCalibrationParameters _parameters;
+    /// Statistics of the last calibration
+    std::optional<MultiPositionCalibration::Result> _result;
+    /// Node selected in the GUI to copy the parameters to
+    size_t _gui_applyNodeIdx = 0;
+};
+
+/// @brief Converts the enum to a string
+/// @param[in] mode Enum value to convert into text
+/// @return String representation of the enum
+constexpr const char* to_string(ImuCalibration::Mode mode)
+{
+    switch (mode)
+    {
+    case ImuCalibration::Mode::Calibrate:
+        return "Calibrate";
+    case ImuCalibration::Mode::Apply:
+        return "Apply";
+    case ImuCalibration::Mode::COUNT:
+        return "";
+    }
+    return "";
+}
+
+} // namespace NAV
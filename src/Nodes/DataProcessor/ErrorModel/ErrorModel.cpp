@@ -667,14 +667,8 @@ void NAV::ErrorModel::receiveImuObs(const std::shared_ptr<ImuObs>& imuObs)
 
     // #########################################################################################################################################
 
-    imuObs->accelUncompXYZ.value() += accelerometerBias_p
-                                      + Eigen::Vector3d{ _imuAccelerometerRng.getRand_normalDist(0.0, accelerometerNoiseStd(0)),
-                                                         _imuAccelerometerRng.getRand_normalDist(0.0, accelerometerNoiseStd(1)),
-                                                         _imuAccelerometerRng.getRand_normalDist(0.0, accelerometerNoiseStd(2)) };
-    imuObs->gyroUncompXYZ.value() += gyroscopeBias_p
-                                     + Eigen::Vector3d{ _imuGyroscopeRng.getRand_normalDist(0.0, gyroscopeNoiseStd(0)),
-                                                        _imuGyroscopeRng.getRand_normalDist(0.0, gyroscopeNoiseStd(1)),
-                                                        _imuGyroscopeRng.getRand_normalDist(0.0, gyroscopeNoiseStd(2)) };
+    imuObs->accelUncompXYZ.value() += accelerometerBias_p + _imuAccelerometerRng.getRand_normalDistVector(accelerometerNoiseStd);
+    imuObs->gyroUncompXYZ.value() += gyroscopeBias_p + _imuGyroscopeRng.getRand_normalDistVector(gyroscopeNoiseStd);
 
     invokeCallbacks(OUTPUT_PORT_INDEX_FLOW, imuObs);
 }
@@ -801,19 +795,13 @@ void NAV::ErrorModel::receivePosVelAtt(const std::shared_ptr<PosVelAtt>& posVelA
 
     posVelAtt->setState_n(posVelAtt->lla_position()
                               + lla_positionBias
-                              + Eigen::Vector3d{ _positionRng.getRand_normalDist(0.0, lla_positionNoiseStd(0)),
-                                                 _positionRng.getRand_normalDist(0.0, lla_positionNoiseStd(1)),
-                                                 _positionRng.getRand_normalDist(0.0, lla_positionNoiseStd(2)) },
+                              + _positionRng.getRand_normalDistVector(lla_positionNoiseStd),
                           posVelAtt->n_velocity()
                               + n_velocityBias
-                              + Eigen::Vector3d{ _velocityRng.getRand_normalDist(0.0, n_velocityNoiseStd(0)),
-                                                 _velocityRng.getRand_normalDist(0.0, n_velocityNoiseStd(1)),
-                                                 _velocityRng.getRand_normalDist(0.0, n_velocityNoiseStd(2)) },
+                              + _velocityRng.getRand_normalDistVector(n_velocityNoiseStd),
                           trafo::n_Quat_b(posVelAtt->rollPitchYaw()
                                           + attitudeBias
-                                          + Eigen::Vector3d{ _attitudeRng.getRand_normalDist(0.0, attitudeNoiseStd(0)),
-                                                             _attitudeRng.getRand_normalDist(0.0, attitudeNoiseStd(1)),
-                                                             _attitudeRng.getRand_normalDist(0.0, attitudeNoiseStd(2)) }));
+                                          + _attitudeRng.getRand_normalDistVector(attitudeNoiseStd)));
 
     invokeCallbacks(OUTPUT_PORT_INDEX_FLOW, posVelAtt);
 }
@@ -0,0 +1,246 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "NetworkSinglePointPositioning.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/SppSolution.hpp"
+
+#include "util/Logger.hpp"
+
+NAV::NetworkSinglePointPositioning::NetworkSinglePointPositioning()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 538, 586 };
+
+    nm::CreateInputPin(this, NAV::GnssNavInfo::type().c_str(), Pin::Type::Object, { NAV::GnssNavInfo::type() });
+    // GnssObs and SppSolution pins are created by the dynamic input pins
+}
+
+NAV::NetworkSinglePointPositioning::~NetworkSinglePointPositioning()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::NetworkSinglePointPositioning::typeStatic()
+{
+    return "NetworkSinglePointPositioning - SPP";
+}
+
+std::string NAV::NetworkSinglePointPositioning::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::NetworkSinglePointPositioning::category()
+{
+    return "Data Processor";
+}
+
+void NAV::NetworkSinglePointPositioning::guiConfig()
+{
+    if (_dynamicInputPins.ShowGuiWidgets(size_t(id), inputPins, this))
+    {
+        flow::ApplyChanges();
+    }
+
+    ImGui::Separator();
+
+    // ###########################################################################################################
+
+    const float itemWidth = 280.0F * gui::NodeEditorApplication::windowFontRatio();
+    const float unitWidth = 100.0F * gui::NodeEditorApplication::windowFontRatio();
+
+    ImGui::SetNextItemWidth(itemWidth);
+    if (ImGui::InputDoubleL(fmt::format("Epoch tolerance##{}", size_t(id)).c_str(), &_epochTolerance, 0.0, 1.0, 0.0, 0.0, "%.3f s"))
+    {
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Observations of different receivers within this time interval belong to the same epoch");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    if (ImGui::InputIntL(fmt::format("Threads##{}", size_t(id)).c_str(), &_nThreads, 1, 256))
+    {
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Amount of threads the receivers of an epoch are distributed to. The satellite states are calculated only once per epoch.");
+
+    ImGui::Separator();
+
+    if (_algorithm.ShowGuiWidgets(nameId().c_str(), itemWidth, unitWidth))
+    {
+        flow::ApplyChanges();
+    }
+}
+
+[[nodiscard]] json NAV::NetworkSinglePointPositioning::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    return {
+        { "dynamicInputPins", _dynamicInputPins },
+        { "epochTolerance", _epochTolerance },
+        { "nThreads", _nThreads },
+        { "algorithm", _algorithm }
+    };
+}
+
+void NAV::NetworkSinglePointPositioning::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("dynamicInputPins")) { NAV::gui::widgets::from_json(j.at("dynamicInputPins"), _dynamicInputPins, this); }
+    if (j.contains("epochTolerance")) { j.at("epochTolerance").get_to(_epochTolerance); }
+    if (j.contains("nThreads")) { j.at("nThreads").get_to(_nThreads); }
+    if (j.contains("algorithm")) { j.at("algorithm").get_to(_algorithm); }
+}
+
+bool NAV::NetworkSinglePointPositioning::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!inputPins.at(INPUT_PORT_INDEX_GNSS_NAV_INFO).isPinLinked())
+    {
+        LOG_ERROR("{}: You need to connect a GNSS NavigationInfo provider", nameId());
+        return false;
+    }
+
+    if (!_algorithm._obsEstimator.initialize(nameId())) { return false; }
+    _algorithm.reset();
+    _receiverAlgorithms.assign(_dynamicInputPins.getNumberOfDynamicPins(), _algorithm);
+    _satelliteCache.reset();
+    _epochObs.assign(_dynamicInputPins.getNumberOfDynamicPins(), nullptr);
+    _epochTime.reset();
+
+    // Versions of the navigation data are kept till this node asked for a later time
+    if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO)) { gnssNavInfo->v->addConsumer(this); }
+
+    LOG_DEBUG("{}: initialized", nameId());
+
+    return true;
+}
+
+void NAV::NetworkSinglePointPositioning::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO)) { gnssNavInfo->v->removeConsumer(this); }
+}
+
+void NAV::NetworkSinglePointPositioning::flush()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    processEpoch();
+}
+
+void NAV::NetworkSinglePointPositioning::pinAddCallback(Node* node)
+{
+    nm::CreateInputPin(node, NAV::GnssObs::type().c_str(), Pin::Type::Flow, { NAV::GnssObs::type() }, &NetworkSinglePointPositioning::recvGnssObs);
+    nm::CreateOutputPin(node, NAV::SppSolution::type().c_str(), Pin::Type::Flow, { NAV::SppSolution::type() });
+}
+
+void NAV::NetworkSinglePointPositioning::pinDeleteCallback(Node* node, size_t pinIdx)
+{
+    nm::DeleteOutputPin(node->outputPins.at(pinIdx - INPUT_PORT_INDEX_GNSS_OBS));
+    nm::DeleteInputPin(node->inputPins.at(pinIdx));
+}
+
+void NAV::NetworkSinglePointPositioning::recvGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t pinIdx)
+{
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+    size_t recvIdx = pinIdx - INPUT_PORT_INDEX_GNSS_OBS;
+
+    if (!_epochTime.empty()
+        && (std::abs(static_cast<double>((gnssObs->insTime - _epochTime).count())) > _epochTolerance
+            || _epochObs.at(recvIdx) != nullptr))
+    {
+        processEpoch();
+    }
+
+    if (_epochTime.empty()) { _epochTime = gnssObs->insTime; }
+    _epochObs.at(recvIdx) = gnssObs;
+
+    if (isEpochComplete()) { processEpoch(); }
+}
+
+bool NAV::NetworkSinglePointPositioning::isEpochComplete() const
+{
+    for (size_t i = 0; i < _epochObs.size(); i++)
+    {
+        const auto& inputPin = inputPins.at(INPUT_PORT_INDEX_GNSS_OBS + i);
+        if (_epochObs.at(i) != nullptr || !inputPin.isPinLinked()) { continue; }
+        if (!inputPin.queue.empty() || !inputPin.link.getConnectedPin()->noMoreDataAvailable) { return false; }
+    }
+    return true;
+}
+
+void NAV::NetworkSinglePointPositioning::processEpoch()
+{
+    if (_epochTime.empty()) { return; }
+
+    std::vector<std::shared_ptr<const GnssObs>> epochObs(_epochObs.size(), nullptr);
+    std::swap(epochObs, _epochObs);
+    InsTime epochTime = _epochTime;
+    _epochTime.reset();
+
+    auto gnssNavInfoWrapper = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO);
+    if (!gnssNavInfoWrapper) { return; }
+    const auto* gnssNavInfo = gnssNavInfoWrapper->v->knownAt(epochTime, this);
+    if (gnssNavInfo == nullptr) { return; }
+    std::vector<const GnssNavInfo*> gnssNavInfos{ gnssNavInfo };
+
+    LOG_DATA("{}: Calculating SPP for [{}]", nameId(), epochTime);
+
+    // Satellite states are evaluated once for the signals of all receivers
+    _satelliteCache.reset();
+    for (const auto& gnssObs : epochObs)
+    {
+        if (gnssObs) { _satelliteCache.add(*gnssObs, gnssNavInfos); }
+    }
+
+    std::vector<std::shared_ptr<SppSolution>> sppSolutions(epochObs.size(), nullptr);
+    std::atomic<size_t> nextReceiver = 0;
+    auto solveReceivers = [&]() {
+        for (size_t r = nextReceiver++; r < epochObs.size(); r = nextReceiver++)
+        {
+            if (epochObs.at(r) == nullptr) { continue; }
+            sppSolutions.at(r) = _receiverAlgorithms.at(r).calcSppSolution(epochObs.at(r), gnssNavInfos,
+                                                                           fmt::format("{} [{}]", nameId(), r + 1), &_satelliteCache);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    auto nWorkers = std::min(static_cast<size_t>(std::max(_nThreads, 1)), epochObs.size()) - 1;
+    workers.reserve(nWorkers);
+    for (size_t i = 0; i < nWorkers; i++) { workers.emplace_back(solveReceivers); }
+    solveReceivers();
+    for (auto& worker : workers) { worker.join(); }
+
+    for (size_t r = 0; r < sppSolutions.size(); r++)
+    {
+        if (sppSolutions.at(r)) { invokeCallbacks(r, sppSolutions.at(r)); }
+    }
+}
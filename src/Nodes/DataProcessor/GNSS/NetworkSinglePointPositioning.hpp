@@ -0,0 +1,128 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NetworkSinglePointPositioning.hpp
+/// @brief Single Point Positioning (SPP) for a network of receivers sharing the satellite computations
+/// @date 2026-10-18
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "internal/gui/widgets/DynamicInputPins.hpp"
+
+#include "Navigation/GNSS/Positioning/SatelliteEpochCache.hpp"
+#include "Navigation/GNSS/Positioning/SPP/Algorithm.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+#include "NodeData/GNSS/GnssObs.hpp"
+
+namespace NAV
+{
+/// @brief Calculates SPP solutions for several receivers
+///
+/// The observations of all receivers belonging to the same epoch are collected first. The satellite clock and orbit
+/// states are then evaluated once per epoch and shared by all receivers, which are solved independently (optionally in parallel).
+/// The solution of the n-th observation pin is output on the n-th output pin.
+class NetworkSinglePointPositioning : public Node
+{
+  public:
+    /// @brief Default constructor
+    NetworkSinglePointPositioning();
+    /// @brief Destructor
+    ~NetworkSinglePointPositioning() override;
+    /// @brief Copy constructor
+    NetworkSinglePointPositioning(const NetworkSinglePointPositioning&) = delete;
+    /// @brief Move constructor
+    NetworkSinglePointPositioning(NetworkSinglePointPositioning&&) = delete;
+    /// @brief Copy assignment operator
+    NetworkSinglePointPositioning& operator=(const NetworkSinglePointPositioning&) = delete;
+    /// @brief Move assignment operator
+    NetworkSinglePointPositioning& operator=(NetworkSinglePointPositioning&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_GNSS_NAV_INFO = 0; ///< @brief GnssNavInfo
+    constexpr static size_t INPUT_PORT_INDEX_GNSS_OBS = 1;      ///< @brief First GnssObs pin
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Processes the last epoch, if it was not processed yet
+    void flush() override;
+
+    /// @brief Function to call to add a new pin
+    /// @param[in, out] node Pointer to this node
+    static void pinAddCallback(Node* node);
+    /// @brief Function to call to delete a pin
+    /// @param[in, out] node Pointer to this node
+    /// @param[in] pinIdx Input pin index to delete
+    static void pinDeleteCallback(Node* node, size_t pinIdx);
+
+    /// @brief Receive Function for the Gnss Observations
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvGnssObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Checks whether all receivers delivered their observations for the current epoch (or will not deliver any more data)
+    [[nodiscard]] bool isEpochComplete() const;
+
+    /// @brief Calculates the solutions of all receivers for the current epoch and outputs them
+    void processEpoch();
+
+    /// @brief SPP algorithm settings (copied for every receiver on initialization)
+    SPP::Algorithm _algorithm;
+
+    /// @brief SPP algorithm of every receiver
+    std::vector<SPP::Algorithm> _receiverAlgorithms;
+
+    /// @brief Satellite states of the current epoch
+    SatelliteEpochCache _satelliteCache;
+
+    /// @brief Observations of the current epoch (nullptr if the receiver did not deliver data yet)
+    std::vector<std::shared_ptr<const GnssObs>> _epochObs;
+
+    /// @brief Time of the current epoch
+    InsTime _epochTime;
+
+    /// @brief Observations of different receivers within this time interval belong to the same epoch [s]
+    double _epochTolerance = 0.05;
+
+    /// @brief Amount of threads to solve the receivers with
+    int _nThreads = 1;
+
+    /// @brief Dynamic input pins
+    /// @attention This should always be the last variable in the header, because it accesses others through the function callbacks
+    gui::widgets::DynamicInputPins _dynamicInputPins{ INPUT_PORT_INDEX_GNSS_OBS, this, pinAddCallback, pinDeleteCallback, 2 };
+};
+
+} // namespace NAV
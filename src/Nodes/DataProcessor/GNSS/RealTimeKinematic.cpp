@@ -0,0 +1,260 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RealTimeKinematic.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/RtkSolution.hpp"
+
+#include "util/Logger.hpp"
+
+NAV::RealTimeKinematic::RealTimeKinematic()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 538, 620 };
+
+    nm::CreateInputPin(this, "Base GnssObs", Pin::Type::Flow, { NAV::GnssObs::type() }, &RealTimeKinematic::recvBaseGnssObs);
+    nm::CreateInputPin(this, "Rover GnssObs", Pin::Type::Flow, { NAV::GnssObs::type() }, &RealTimeKinematic::recvRoverGnssObs);
+    _dynamicInputPins.addPin(this); // GnssNavInfo
+
+    nm::CreateOutputPin(this, NAV::RtkSolution::type().c_str(), Pin::Type::Flow, { NAV::RtkSolution::type() });
+}
+
+NAV::RealTimeKinematic::~RealTimeKinematic()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::RealTimeKinematic::typeStatic()
+{
+    return "RealTimeKinematic - RTK";
+}
+
+std::string NAV::RealTimeKinematic::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::RealTimeKinematic::category()
+{
+    return "Data Processor";
+}
+
+void NAV::RealTimeKinematic::guiConfig()
+{
+    if (_dynamicInputPins.ShowGuiWidgets(size_t(id), inputPins, this))
+    {
+        flow::ApplyChanges();
+    }
+
+    ImGui::Separator();
+
+    // ###########################################################################################################
+
+    const float itemWidth = 280.0F * gui::NodeEditorApplication::windowFontRatio();
+    const float unitWidth = 100.0F * gui::NodeEditorApplication::windowFontRatio();
+
+    ImGui::SetNextItemWidth(itemWidth);
+    // gui::widgets::EnumCombo is included by the algorithm headers before the to_string of this node is declared
+    if (ImGui::BeginCombo(fmt::format("Base position##{}", size_t(id)).c_str(), to_string(_basePositionSource)))
+    {
+        for (size_t i = 0; i < static_cast<size_t>(BasePositionSource::COUNT); i++)
+        {
+            auto source = static_cast<BasePositionSource>(i);
+            const bool isSelected = source == _basePositionSource;
+            if (ImGui::Selectable(to_string(source), isSelected) && !isSelected)
+            {
+                _basePositionSource = source;
+                LOG_DEBUG("{}: Base position source changed to {}", nameId(), to_string(_basePositionSource));
+                flow::ApplyChanges();
+            }
+            if (isSelected) { ImGui::SetItemDefaultFocus(); }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("The base position errors directly affect the rover position.\n"
+                             "A SPP solution is only sufficient for a relative solution (e.g. a moving baseline).");
+    if (_basePositionSource == BasePositionSource::Fixed)
+    {
+        if (gui::widgets::PositionInput(fmt::format("Base antenna##PosInput {}", size_t(id)).c_str(), _basePosition,
+                                        gui::widgets::PositionInputLayout::TWO_ROWS, itemWidth / 2.0F))
+        {
+            flow::ApplyChanges();
+        }
+    }
+    else if (ImGui::TreeNode(fmt::format("Base position (SPP)##{}", size_t(id)).c_str()))
+    {
+        if (_sppAlgorithm.ShowGuiWidgets(fmt::format("{} SPP", nameId()).c_str(), itemWidth, unitWidth))
+        {
+            flow::ApplyChanges();
+        }
+        ImGui::TreePop();
+    }
+
+    ImGui::Separator();
+
+    if (_algorithm.ShowGuiWidgets(nameId().c_str(), itemWidth))
+    {
+        flow::ApplyChanges();
+    }
+}
+
+[[nodiscard]] json NAV::RealTimeKinematic::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    return {
+        { "dynamicInputPins", _dynamicInputPins },
+        { "algorithm", _algorithm },
+        { "basePositionSource", _basePositionSource },
+        { "basePosition", _basePosition },
+        { "sppAlgorithm", _sppAlgorithm },
+    };
+}
+
+void NAV::RealTimeKinematic::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("dynamicInputPins")) { NAV::gui::widgets::from_json(j.at("dynamicInputPins"), _dynamicInputPins, this); }
+    if (j.contains("algorithm")) { j.at("algorithm").get_to(_algorithm); }
+    if (j.contains("basePositionSource")) { j.at("basePositionSource").get_to(_basePositionSource); }
+    if (j.contains("basePosition")) { j.at("basePosition").get_to(_basePosition); }
+    if (j.contains("sppAlgorithm")) { j.at("sppAlgorithm").get_to(_sppAlgorithm); }
+}
+
+bool NAV::RealTimeKinematic::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (std::all_of(inputPins.begin() + INPUT_PORT_INDEX_GNSS_NAV_INFO, inputPins.end(), [](const InputPin& inputPin) { return !inputPin.isPinLinked(); }))
+    {
+        LOG_ERROR("{}: You need to connect a GNSS NavigationInfo provider", nameId());
+        return false;
+    }
+
+    _algorithm.reset();
+    _sppAlgorithm.reset();
+    if (!_sppAlgorithm._obsEstimator.initialize(nameId())) { return false; }
+    _algorithm.setBasePosition(_basePositionSource == BasePositionSource::Fixed ? _basePosition.e_position : Eigen::Vector3d::Zero());
+
+    // Versions of the navigation data are kept till the base and rover observations asked for a later time
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+        {
+            gnssNavInfo->v->addConsumer(&_sppAlgorithm);
+            gnssNavInfo->v->addConsumer(&_algorithm);
+        }
+    }
+
+    LOG_DEBUG("{}: initialized", nameId());
+
+    return true;
+}
+
+void NAV::RealTimeKinematic::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+        {
+            gnssNavInfo->v->removeConsumer(&_sppAlgorithm);
+            gnssNavInfo->v->removeConsumer(&_algorithm);
+        }
+    }
+}
+
+void NAV::RealTimeKinematic::pinAddCallback(Node* node)
+{
+    nm::CreateInputPin(node, NAV::GnssNavInfo::type().c_str(), Pin::Type::Object, { NAV::GnssNavInfo::type() });
+}
+
+void NAV::RealTimeKinematic::pinDeleteCallback(Node* node, size_t pinIdx)
+{
+    nm::DeleteInputPin(node->inputPins.at(pinIdx));
+}
+
+std::vector<const NAV::GnssNavInfo*> NAV::RealTimeKinematic::getGnssNavInfos(const InsTime& insTime, const void* consumer,
+                                                                             std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>>& gnssNavInfoWrappers)
+{
+    std::vector<const GnssNavInfo*> gnssNavInfos;
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+        {
+            if (const auto* knownNavInfo = gnssNavInfo->v->knownAt(insTime, consumer))
+            {
+                gnssNavInfoWrappers.push_back(*gnssNavInfo);
+                gnssNavInfos.push_back(knownNavInfo);
+            }
+        }
+    }
+    return gnssNavInfos;
+}
+
+void NAV::RealTimeKinematic::recvBaseGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+
+    std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
+    auto gnssNavInfos = getGnssNavInfos(gnssObs->insTime, &_sppAlgorithm, gnssNavInfoWrappers);
+    if (gnssNavInfos.empty()) { return; }
+
+    if (_basePositionSource == BasePositionSource::SPP && _algorithm.basePosition().isZero())
+    {
+        if (auto sppSol = _sppAlgorithm.calcSppSolution(gnssObs, gnssNavInfos, nameId()))
+        {
+            LOG_INFO("{}: Base position set to the SPP solution {} [m]", nameId(), sppSol->e_position().transpose());
+            _algorithm.setBasePosition(sppSol->e_position());
+        }
+    }
+
+    _algorithm.addBaseObservation(*gnssObs, gnssNavInfos, nameId());
+}
+
+void NAV::RealTimeKinematic::recvRoverGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+
+    std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
+    auto gnssNavInfos = getGnssNavInfos(gnssObs->insTime, &_algorithm, gnssNavInfoWrappers);
+    if (gnssNavInfos.empty()) { return; }
+
+    LOG_DATA("{}: Calculating RTK for [{}]", nameId(), gnssObs->insTime);
+
+    auto result = _algorithm.calcSolution(*gnssObs, gnssNavInfos, nameId());
+    if (!result) { return; }
+
+    auto rtkSol = std::make_shared<RtkSolution>();
+    rtkSol->insTime = result->insTime;
+    rtkSol->setPosition_e(result->e_position);
+    rtkSol->setVelocity_e(result->e_velocity);
+    rtkSol->setBaseline_e(result->e_baseline);
+    rtkSol->setPosVelCovariance_e(result->e_positionCovariance, result->e_velocityCovariance);
+    rtkSol->nSatellites = result->nSatellites;
+    rtkSol->nSignals = result->nSignals;
+    rtkSol->nAmbiguities = result->nAmbiguities;
+    rtkSol->differentialAge = result->differentialAge;
+
+    invokeCallbacks(OUTPUT_PORT_INDEX_RTK_SOL, rtkSol);
+}
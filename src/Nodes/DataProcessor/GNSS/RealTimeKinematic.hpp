@@ -0,0 +1,144 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RealTimeKinematic.hpp
+/// @brief Real-Time Kinematic (RTK) float positioning of a rover relative to a base station
+/// @date 2026-10-18
+
+#pragma once
+
+#include "internal/Node/Node.hpp"
+#include "internal/gui/widgets/DynamicInputPins.hpp"
+#include "internal/gui/widgets/PositionInput.hpp"
+
+#include "Navigation/GNSS/Positioning/RTK/Algorithm.hpp"
+#include "Navigation/GNSS/Positioning/SPP/Algorithm.hpp"
+
+namespace NAV
+{
+/// @brief Estimates the rover position and velocity with double-differenced code and carrier-phase observations of a base station
+///
+/// The base observations can have a lower rate than the rover ones (e.g. an RTCM stream). Each rover epoch is processed with
+/// the last base epoch received, as long as it is not older than the maximum differential age.
+class RealTimeKinematic : public Node
+{
+  public:
+    /// @brief Default constructor
+    RealTimeKinematic();
+    /// @brief Destructor
+    ~RealTimeKinematic() override;
+    /// @brief Copy constructor
+    RealTimeKinematic(const RealTimeKinematic&) = delete;
+    /// @brief Move constructor
+    RealTimeKinematic(RealTimeKinematic&&) = delete;
+    /// @brief Copy assignment operator
+    RealTimeKinematic& operator=(const RealTimeKinematic&) = delete;
+    /// @brief Move assignment operator
+    RealTimeKinematic& operator=(RealTimeKinematic&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Source of the base station position
+    enum class BasePositionSource
+    {
+        Fixed, ///< Position entered by the user
+        SPP,   ///< Single point positioning solution of the first base epoch
+        COUNT, ///< Amount of items in the enum
+    };
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_BASE_GNSS_OBS = 0;  ///< @brief GnssObs of the base station
+    constexpr static size_t INPUT_PORT_INDEX_ROVER_GNSS_OBS = 1; ///< @brief GnssObs of the rover
+    constexpr static size_t INPUT_PORT_INDEX_GNSS_NAV_INFO = 2;  ///< @brief GnssNavInfo
+    constexpr static size_t OUTPUT_PORT_INDEX_RTK_SOL = 0;       ///< @brief Flow (RtkSolution)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Function to call to add a new pin
+    /// @param[in, out] node Pointer to this node
+    static void pinAddCallback(Node* node);
+    /// @brief Function to call to delete a pin
+    /// @param[in, out] node Pointer to this node
+    /// @param[in] pinIdx Input pin index to delete
+    static void pinDeleteCallback(Node* node, size_t pinIdx);
+
+    /// @brief Collects the navigation data of all connected providers known at the time
+    /// @param[in] insTime Time of the observation
+    /// @param[in] consumer Key of the observation stream (base and rover observations are not received in time order)
+    /// @param[out] gnssNavInfoWrappers Wrappers which keep the navigation data locked while they are used
+    /// @return Navigation data known at the time
+    std::vector<const GnssNavInfo*> getGnssNavInfos(const InsTime& insTime, const void* consumer,
+                                                    std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>>& gnssNavInfoWrappers);
+
+    /// @brief Receive Function for the Gnss Observations of the base station
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvBaseGnssObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Receive Function for the Gnss Observations of the rover
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvRoverGnssObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief RTK algorithm
+    RTK::Algorithm _algorithm;
+
+    /// @brief Source of the base station position
+    BasePositionSource _basePositionSource = BasePositionSource::Fixed;
+
+    /// @brief Position of the base station antenna entered by the user
+    gui::widgets::PositionWithFrame _basePosition;
+
+    /// @brief SPP algorithm for the base station position
+    SPP::Algorithm _sppAlgorithm;
+
+    /// @brief Dynamic input pins
+    /// @attention This should always be the last variable in the header, because it accesses others through the function callbacks
+    gui::widgets::DynamicInputPins _dynamicInputPins{ INPUT_PORT_INDEX_GNSS_NAV_INFO, this, pinAddCallback, pinDeleteCallback };
+};
+
+/// @brief Converts the enum to a string
+/// @param[in] source Enum value to convert into text
+/// @return String representation of the enum
+constexpr const char* to_string(RealTimeKinematic::BasePositionSource source)
+{
+    switch (source)
+    {
+    case RealTimeKinematic::BasePositionSource::Fixed:
+        return "Fixed";
+    case RealTimeKinematic::BasePositionSource::SPP:
+        return "SPP (first epoch)";
+    case RealTimeKinematic::BasePositionSource::COUNT:
+        return "";
+    }
+    return "";
+}
+
+} // namespace NAV
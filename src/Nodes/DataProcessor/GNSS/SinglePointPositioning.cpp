@@ -11,6 +11,7 @@
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "internal/FlowManager.hpp"
+#include "internal/LiveReconfiguration.hpp"
 #include "internal/gui/NodeEditorApplication.hpp"
 #include "internal/gui/widgets/imgui_ex.hpp"
 
@@ -60,14 +61,15 @@ std::string NAV::SinglePointPositioning::category()
 void NAV::SinglePointPositioning::guiConfig()
 {
     auto nSatColumnContent = [&](size_t pinIndex) -> bool {
-        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(pinIndex))
+        auto gnssNavInfo = getInputValue<GnssNavInfo>(pinIndex);
+        if (auto latestNavInfo = gnssNavInfo ? gnssNavInfo->v->latest() : nullptr)
         {
             size_t usedSatNum = 0;
             std::string usedSats;
             std::string allSats;
 
             std::string filler = ", ";
-            for (const auto& satellite : gnssNavInfo->v->satellites())
+            for (const auto& satellite : latestNavInfo->satellites())
             {
                 if (_algorithm._obsFilter.isSatelliteAllowed(satellite.first))
                 {
@@ -76,7 +78,7 @@ void NAV::SinglePointPositioning::guiConfig()
                 }
                 allSats += (allSats.empty() ? "" : filler) + fmt::format("{}", satellite.first);
             }
-            ImGui::TextUnformatted(fmt::format("{} / {}", usedSatNum, gnssNavInfo->v->nSatellites()).c_str());
+            ImGui::TextUnformatted(fmt::format("{} / {}", usedSatNum, latestNavInfo->nSatellites()).c_str());
             if (ImGui::IsItemHovered())
             {
                 ImGui::SetTooltip("Used  satellites: %s\n"
@@ -123,6 +125,26 @@ void NAV::SinglePointPositioning::restore(json const& j)
     if (j.contains("algorithm")) { j.at("algorithm").get_to(_algorithm); }
 }
 
+std::vector<std::string> NAV::SinglePointPositioning::liveParameters() const
+{
+    return {
+        "/algorithm/robustWeightFunction",
+        "/algorithm/robustK0",
+        "/algorithm/robustK1",
+        "/algorithm/raim",
+    };
+}
+
+bool NAV::SinglePointPositioning::checkParameters(const json& j) const
+{
+    if (!LiveReconfiguration::isValidEnumValue(j, "/algorithm/robustWeightFunction", static_cast<size_t>(RobustWeightFunction::COUNT)))
+    {
+        LOG_ERROR("{}: The value of '/algorithm/robustWeightFunction' is not a valid weight function", nameId());
+        return false;
+    }
+    return true;
+}
+
 bool NAV::SinglePointPositioning::initialize()
 {
     LOG_TRACE("{}: called", nameId());
@@ -133,8 +155,15 @@ bool NAV::SinglePointPositioning::initialize()
         return false;
     }
 
+    if (!_algorithm._obsEstimator.initialize(nameId())) { return false; }
     _algorithm.reset();
 
+    // Versions of the navigation data are kept till this node asked for a later time
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->addConsumer(this); }
+    }
+
     LOG_DEBUG("{}: initialized", nameId());
 
     return true;
@@ -143,6 +172,11 @@ bool NAV::SinglePointPositioning::initialize()
 void NAV::SinglePointPositioning::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
+
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->removeConsumer(this); }
+    }
 }
 
 void NAV::SinglePointPositioning::pinAddCallback(Node* node)
@@ -157,20 +191,24 @@ void NAV::SinglePointPositioning::pinDeleteCallback(Node* node, size_t pinIdx)
 
 void NAV::SinglePointPositioning::recvGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
 {
-    // Collection of all connected navigation data providers
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+
+    // Collection of all connected navigation data providers (with the data known at the time of the observation)
     std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
     std::vector<const GnssNavInfo*> gnssNavInfos;
     for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
     {
         if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
         {
-            gnssNavInfoWrappers.push_back(*gnssNavInfo);
-            gnssNavInfos.push_back(gnssNavInfo->v);
+            if (const auto* knownNavInfo = gnssNavInfo->v->knownAt(gnssObs->insTime, this))
+            {
+                gnssNavInfoWrappers.push_back(*gnssNavInfo);
+                gnssNavInfos.push_back(knownNavInfo);
+            }
         }
     }
     if (gnssNavInfos.empty()) { return; }
 
-    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
     LOG_DATA("{}: Calculating SPP for [{}]", nameId(), gnssObs->insTime);
 
     if (auto sppSol = _algorithm.calcSppSolution(gnssObs, gnssNavInfos, nameId()))
@@ -64,6 +64,13 @@ class SinglePointPositioning : public Node
     /// @param[in] j Json object with the node state
     void restore(const json& j) override;
 
+    /// @brief Parameters which can be changed while the node is running (robust weighting and RAIM)
+    [[nodiscard]] std::vector<std::string> liveParameters() const override;
+
+    /// @brief Checks that the robust weight function is a valid option
+    /// @param[in] j Json object with the changed parameters
+    [[nodiscard]] bool checkParameters(const json& j) const override;
+
   private:
     constexpr static size_t INPUT_PORT_INDEX_GNSS_OBS = 0;      ///< @brief GnssObs
     constexpr static size_t INPUT_PORT_INDEX_GNSS_NAV_INFO = 1; ///< @brief GnssNavInfo
@@ -0,0 +1,235 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "TimeDifferencedCarrierPhase.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/TdcpSolution.hpp"
+
+#include "util/Logger.hpp"
+
+NAV::TimeDifferencedCarrierPhase::TimeDifferencedCarrierPhase()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 538, 586 };
+
+    nm::CreateInputPin(this, NAV::GnssObs::type().c_str(), Pin::Type::Flow, { NAV::GnssObs::type() }, &TimeDifferencedCarrierPhase::recvGnssObs);
+    _dynamicInputPins.addPin(this); // GnssNavInfo
+
+    nm::CreateOutputPin(this, NAV::TdcpSolution::type().c_str(), Pin::Type::Flow, { NAV::TdcpSolution::type() });
+}
+
+NAV::TimeDifferencedCarrierPhase::~TimeDifferencedCarrierPhase()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::TimeDifferencedCarrierPhase::typeStatic()
+{
+    return "TimeDifferencedCarrierPhase - TDCP";
+}
+
+std::string NAV::TimeDifferencedCarrierPhase::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::TimeDifferencedCarrierPhase::category()
+{
+    return "Data Processor";
+}
+
+void NAV::TimeDifferencedCarrierPhase::guiConfig()
+{
+    if (_dynamicInputPins.ShowGuiWidgets(size_t(id), inputPins, this))
+    {
+        flow::ApplyChanges();
+    }
+
+    ImGui::Separator();
+
+    // ###########################################################################################################
+
+    const float itemWidth = 280.0F * gui::NodeEditorApplication::windowFontRatio();
+    const float unitWidth = 100.0F * gui::NodeEditorApplication::windowFontRatio();
+
+    if (_algorithm.ShowGuiWidgets(nameId().c_str(), itemWidth))
+    {
+        flow::ApplyChanges();
+    }
+
+    ImGui::Separator();
+
+    ImGui::SetNextItemWidth(itemWidth);
+    if (ImGui::InputDoubleL(fmt::format("SPP interval##{}", size_t(id)).c_str(), &_sppInterval, 0.0, 3600.0, 1.0, 10.0, "%.1f s"))
+    {
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Interval in which the approximate absolute position is updated with SPP.\n"
+                             "The geometry is linearized at this position, so errors of a few meters only slightly affect the displacement.");
+
+    if (ImGui::TreeNode(fmt::format("Approximate position (SPP)##{}", size_t(id)).c_str()))
+    {
+        if (_sppAlgorithm.ShowGuiWidgets(fmt::format("{} SPP", nameId()).c_str(), itemWidth, unitWidth))
+        {
+            flow::ApplyChanges();
+        }
+        ImGui::TreePop();
+    }
+}
+
+[[nodiscard]] json NAV::TimeDifferencedCarrierPhase::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    return {
+        { "dynamicInputPins", _dynamicInputPins },
+        { "algorithm", _algorithm },
+        { "sppAlgorithm", _sppAlgorithm },
+        { "sppInterval", _sppInterval },
+    };
+}
+
+void NAV::TimeDifferencedCarrierPhase::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("dynamicInputPins")) { NAV::gui::widgets::from_json(j.at("dynamicInputPins"), _dynamicInputPins, this); }
+    if (j.contains("algorithm")) { j.at("algorithm").get_to(_algorithm); }
+    if (j.contains("sppAlgorithm")) { j.at("sppAlgorithm").get_to(_sppAlgorithm); }
+    if (j.contains("sppInterval")) { j.at("sppInterval").get_to(_sppInterval); }
+}
+
+bool NAV::TimeDifferencedCarrierPhase::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (std::all_of(inputPins.begin() + INPUT_PORT_INDEX_GNSS_NAV_INFO, inputPins.end(), [](const InputPin& inputPin) { return !inputPin.isPinLinked(); }))
+    {
+        LOG_ERROR("{}: You need to connect a GNSS NavigationInfo provider", nameId());
+        return false;
+    }
+
+    _algorithm.reset();
+    _sppAlgorithm.reset();
+    if (!_sppAlgorithm._obsEstimator.initialize(nameId())) { return false; }
+    _lastSppTime.reset();
+    _lastEpochTime.reset();
+    _e_position.setZero();
+    _e_velocity.setZero();
+
+    // Versions of the navigation data are kept till this node asked for a later time
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->addConsumer(this); }
+    }
+
+    LOG_DEBUG("{}: initialized", nameId());
+
+    return true;
+}
+
+void NAV::TimeDifferencedCarrierPhase::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->removeConsumer(this); }
+    }
+}
+
+void NAV::TimeDifferencedCarrierPhase::pinAddCallback(Node* node)
+{
+    nm::CreateInputPin(node, NAV::GnssNavInfo::type().c_str(), Pin::Type::Object, { NAV::GnssNavInfo::type() });
+}
+
+void NAV::TimeDifferencedCarrierPhase::pinDeleteCallback(Node* node, size_t pinIdx)
+{
+    nm::DeleteInputPin(node->inputPins.at(pinIdx));
+}
+
+void NAV::TimeDifferencedCarrierPhase::recvGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+
+    // Collection of all connected navigation data providers (with the data known at the time of the observation)
+    std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
+    std::vector<const GnssNavInfo*> gnssNavInfos;
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+        {
+            if (const auto* knownNavInfo = gnssNavInfo->v->knownAt(gnssObs->insTime, this))
+            {
+                gnssNavInfoWrappers.push_back(*gnssNavInfo);
+                gnssNavInfos.push_back(knownNavInfo);
+            }
+        }
+    }
+    if (gnssNavInfos.empty()) { return; }
+
+    // Approximate absolute position from SPP (initially and periodically) or propagated with the last mean velocity
+    std::shared_ptr<SppSolution> sppSol;
+    if (!_algorithm.hasReference() || _lastSppTime.empty()
+        || static_cast<double>((gnssObs->insTime - _lastSppTime).count()) >= _sppInterval)
+    {
+        sppSol = _sppAlgorithm.calcSppSolution(gnssObs, gnssNavInfos, nameId());
+        if (sppSol) { _lastSppTime = gnssObs->insTime; }
+    }
+    if (!sppSol && _lastEpochTime.empty()) { return; }
+
+    Eigen::Vector3d e_approxPosition = sppSol ? sppSol->e_position()
+                                              : Eigen::Vector3d(_e_position + _e_velocity * static_cast<double>((gnssObs->insTime - _lastEpochTime).count()));
+
+    LOG_DATA("{}: Calculating TDCP for [{}]", nameId(), gnssObs->insTime);
+
+    auto result = _algorithm.calcDisplacement(*gnssObs, gnssNavInfos, e_approxPosition, nameId());
+
+    _lastEpochTime = gnssObs->insTime;
+    if (!result)
+    {
+        _e_position = e_approxPosition;
+        _e_velocity.setZero();
+        return;
+    }
+    _e_position = result->e_position;
+    _e_velocity = result->e_velocity();
+
+    auto tdcpSol = std::make_shared<TdcpSolution>();
+    tdcpSol->insTime = result->insTime;
+    tdcpSol->setPosition_e(result->e_position);
+    tdcpSol->setVelocity_e(result->e_velocity());
+    tdcpSol->setDisplacementAndCovariance_e(result->e_displacement, result->e_displacementCovariance);
+    tdcpSol->nSatellites = result->nSatellites;
+    tdcpSol->nSignals = result->nSignals;
+    tdcpSol->dt = result->dt;
+    tdcpSol->recvClkChange = result->recvClkChange;
+    tdcpSol->recvClkChangeStdDev = result->recvClkChangeStdDev;
+
+    if (sppSol)
+    {
+        // Re-anchor the positions of the following epochs at the new absolute position
+        _algorithm.setReferencePosition(sppSol->e_position());
+        _e_position = sppSol->e_position();
+    }
+
+    invokeCallbacks(OUTPUT_PORT_INDEX_TDCP_SOL, tdcpSol);
+}
@@ -0,0 +1,117 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file TimeDifferencedCarrierPhase.hpp
+/// @brief Time-Differenced Carrier-Phase (TDCP) velocity and displacement estimation
+/// @date 2026-10-18
+
+#pragma once
+
+#include "internal/Node/Node.hpp"
+#include "internal/gui/widgets/DynamicInputPins.hpp"
+
+#include "Navigation/GNSS/Positioning/SPP/Algorithm.hpp"
+#include "Navigation/GNSS/Positioning/TDCP/Algorithm.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+/// @brief Estimates the displacement and mean velocity between consecutive epochs from time-differenced carrier-phases
+///
+/// The approximate absolute position, which the satellite geometry is linearized at, is calculated with SPP in the first
+/// epoch and then every few seconds. In between the position is propagated with the estimated displacements.
+/// The output derives from PosVel, so it can be used as standalone solution or as aiding for the integration filters.
+class TimeDifferencedCarrierPhase : public Node
+{
+  public:
+    /// @brief Default constructor
+    TimeDifferencedCarrierPhase();
+    /// @brief Destructor
+    ~TimeDifferencedCarrierPhase() override;
+    /// @brief Copy constructor
+    TimeDifferencedCarrierPhase(const TimeDifferencedCarrierPhase&) = delete;
+    /// @brief Move constructor
+    TimeDifferencedCarrierPhase(TimeDifferencedCarrierPhase&&) = delete;
+    /// @brief Copy assignment operator
+    TimeDifferencedCarrierPhase& operator=(const TimeDifferencedCarrierPhase&) = delete;
+    /// @brief Move assignment operator
+    TimeDifferencedCarrierPhase& operator=(TimeDifferencedCarrierPhase&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_GNSS_OBS = 0;      ///< @brief GnssObs
+    constexpr static size_t INPUT_PORT_INDEX_GNSS_NAV_INFO = 1; ///< @brief GnssNavInfo
+    constexpr static size_t OUTPUT_PORT_INDEX_TDCP_SOL = 0;     ///< @brief Flow (TdcpSolution)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Function to call to add a new pin
+    /// @param[in, out] node Pointer to this node
+    static void pinAddCallback(Node* node);
+    /// @brief Function to call to delete a pin
+    /// @param[in, out] node Pointer to this node
+    /// @param[in] pinIdx Input pin index to delete
+    static void pinDeleteCallback(Node* node, size_t pinIdx);
+
+    /// @brief Receive Function for the Gnss Observations
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvGnssObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief TDCP algorithm
+    TDCP::Algorithm _algorithm;
+
+    /// @brief SPP algorithm for the approximate absolute position
+    SPP::Algorithm _sppAlgorithm;
+
+    /// @brief Interval in which the approximate position is updated with SPP [s]
+    double _sppInterval = 10.0;
+
+    /// @brief Time of the last SPP solution
+    InsTime _lastSppTime;
+
+    /// @brief Time of the last epoch
+    InsTime _lastEpochTime;
+
+    /// @brief Position of the last epoch in ECEF frame [m]
+    Eigen::Vector3d _e_position = Eigen::Vector3d::Zero();
+
+    /// @brief Mean velocity of the last interval in ECEF frame [m/s]
+    Eigen::Vector3d _e_velocity = Eigen::Vector3d::Zero();
+
+    /// @brief Dynamic input pins
+    /// @attention This should always be the last variable in the header, because it accesses others through the function callbacks
+    gui::widgets::DynamicInputPins _dynamicInputPins{ INPUT_PORT_INDEX_GNSS_NAV_INFO, this, pinAddCallback, pinDeleteCallback };
+};
+
+} // namespace NAV
@@ -262,6 +262,7 @@ bool NAV::ImuIntegrator::initialize()
     case IntegrationAlgorithm::RungeKutta2:
     case IntegrationAlgorithm::RungeKutta3:
     case IntegrationAlgorithm::RungeKutta4:
+    case IntegrationAlgorithm::DormandPrince45:
         _maxSizeImuObservations = 2; // Has to be >= 2
         _maxSizeStates = 1;
         break;
@@ -669,6 +670,10 @@ std::shared_ptr<const NAV::PosVelAtt> NAV::ImuIntegrator::integrateObservationEC
     {
         y = RungeKutta4(e_calcPosVelAttDerivative, timeDifferenceSec, y, c);
     }
+    else if (_integrationAlgorithm == IntegrationAlgorithm::DormandPrince45)
+    {
+        y = DormandPrince45(e_calcPosVelAttDerivative, timeDifferenceSec, y, c);
+    }
 
     posVelAtt__t0->setState_e(y.segment<3>(7), y.segment<3>(4), Eigen::Quaterniond{ y(0), y(1), y(2), y(3) }.normalized());
 
@@ -843,6 +848,10 @@ std::shared_ptr<const NAV::PosVelAtt> NAV::ImuIntegrator::integrateObservationNE
     {
         y = RungeKutta4(n_calcPosVelAttDerivative, timeDifferenceSec, y, c);
     }
+    else if (_integrationAlgorithm == IntegrationAlgorithm::DormandPrince45)
+    {
+        y = DormandPrince45(n_calcPosVelAttDerivative, timeDifferenceSec, y, c);
+    }
 
     posVelAtt__t0->setState_n(y.segment<3>(7), y.segment<3>(4), Eigen::Quaterniond{ y(0), y(1), y(2), y(3) }.normalized());
 
@@ -9,7 +9,9 @@
 #include "LooselyCoupledKF.hpp"
 
 #include "util/Eigen.hpp"
+#include <array>
 #include <cmath>
+#include <utility>
 
 #include <imgui_internal.h>
 #include "internal/gui/widgets/HelpMarker.hpp"
@@ -18,6 +20,7 @@
 #include "internal/gui/NodeEditorApplication.hpp"
 
 #include "internal/FlowManager.hpp"
+#include "internal/LiveReconfiguration.hpp"
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "Navigation/Constants.hpp"
@@ -133,6 +136,20 @@ void NAV::LooselyCoupledKF::guiConfig()
         LOG_DEBUG("{}: checkKalmanMatricesRanks {}", nameId(), _checkKalmanMatricesRanks);
         flow::ApplyChanges();
     }
+    if (ImGui::Checkbox(fmt::format("Preintegrate IMU measurements between updates##{}", size_t(id)).c_str(), &_preintegrateBetweenUpdates))
+    {
+        LOG_DEBUG("{}: preintegrateBetweenUpdates {}", nameId(), _preintegrateBetweenUpdates);
+        flow::ApplyChanges();
+    }
+    if (_preintegrateBetweenUpdates)
+    {
+        ImGui::SetNextItemWidth(configWidth);
+        if (ImGui::InputDoubleL(fmt::format("Max. preintegration interval##{}", size_t(id)).c_str(), &_preintegrationMaxInterval, 1e-3, std::numeric_limits<double>::max(), 0.1, 1.0, "%.3f s"))
+        {
+            LOG_DEBUG("{}: preintegrationMaxInterval changed to {}", nameId(), _preintegrationMaxInterval);
+            flow::ApplyChanges();
+        }
+    }
 
     ImGui::Separator();
 
@@ -442,6 +459,8 @@ void NAV::LooselyCoupledKF::guiConfig()
 
     j["showKalmanFilterOutputPins"] = _showKalmanFilterOutputPins;
     j["checkKalmanMatricesRanks"] = _checkKalmanMatricesRanks;
+    j["preintegrateBetweenUpdates"] = _preintegrateBetweenUpdates;
+    j["preintegrationMaxInterval"] = _preintegrationMaxInterval;
 
     j["frame"] = _frame;
     j["phiCalculationAlgorithm"] = _phiCalculationAlgorithm;
@@ -496,6 +515,14 @@ void NAV::LooselyCoupledKF::restore(json const& j)
     {
         j.at("checkKalmanMatricesRanks").get_to(_checkKalmanMatricesRanks);
     }
+    if (j.contains("preintegrateBetweenUpdates"))
+    {
+        j.at("preintegrateBetweenUpdates").get_to(_preintegrateBetweenUpdates);
+    }
+    if (j.contains("preintegrationMaxInterval"))
+    {
+        j.at("preintegrationMaxInterval").get_to(_preintegrationMaxInterval);
+    }
 
     if (j.contains("frame"))
     {
@@ -622,6 +649,48 @@ void NAV::LooselyCoupledKF::restore(json const& j)
     }
 }
 
+std::vector<std::string> NAV::LooselyCoupledKF::liveParameters() const
+{
+    return {
+        "/stdev_ra",
+        "/stdevAccelNoiseUnits",
+        "/stdev_rg",
+        "/stdevGyroNoiseUnits",
+        "/stdev_bad",
+        "/tau_bad",
+        "/stdevAccelBiasUnits",
+        "/stdev_bgd",
+        "/tau_bgd",
+        "/stdevGyroBiasUnits",
+        "/gnssMeasurementUncertaintyPositionUnit",
+        "/gnssMeasurementUncertaintyPosition",
+        "/gnssMeasurementUncertaintyVelocityUnit",
+        "/gnssMeasurementUncertaintyVelocity",
+        "/checkKalmanMatricesRanks",
+    };
+}
+
+bool NAV::LooselyCoupledKF::checkParameters(const json& j) const
+{
+    const std::array<std::pair<const char*, size_t>, 6> units = { {
+        { "/stdevAccelNoiseUnits", static_cast<size_t>(StdevAccelNoiseUnits::m_s2_sqrtHz) + 1 },
+        { "/stdevGyroNoiseUnits", static_cast<size_t>(StdevGyroNoiseUnits::rad_s_sqrtHz) + 1 },
+        { "/stdevAccelBiasUnits", static_cast<size_t>(StdevAccelBiasUnits::m_s2) + 1 },
+        { "/stdevGyroBiasUnits", static_cast<size_t>(StdevGyroBiasUnits::rad_s) + 1 },
+        { "/gnssMeasurementUncertaintyPositionUnit", static_cast<size_t>(GnssMeasurementUncertaintyPositionUnit::meter) + 1 },
+        { "/gnssMeasurementUncertaintyVelocityUnit", static_cast<size_t>(GnssMeasurementUncertaintyVelocityUnit::m_s) + 1 },
+    } };
+    for (const auto& [pointer, count] : units)
+    {
+        if (!LiveReconfiguration::isValidEnumValue(j, pointer, count))
+        {
+            LOG_ERROR("{}: The value of '{}' is not a valid unit", nameId(), pointer);
+            return false;
+        }
+    }
+    return true;
+}
+
 bool NAV::LooselyCoupledKF::initialize()
 {
     LOG_TRACE("{}: called", nameId());
@@ -633,6 +702,8 @@ bool NAV::LooselyCoupledKF::initialize()
     _lastPredictRequestedTime.reset();
     _accumulatedAccelBiases.setZero();
     _accumulatedGyroBiases.setZero();
+    _preintegrator.reset();
+    _preintegrationStartSol = nullptr;
 
     // Initial Covariance of the attitude angles in [rad²]
     Eigen::Vector3d variance_angles = Eigen::Vector3d::Zero();
@@ -749,7 +820,14 @@ void NAV::LooselyCoupledKF::recvInertialNavigationSolution(NAV::InputPin::NodeDa
     if (tau_i > 0)
     {
         _lastPredictTime = _latestInertialNavSol->insTime + std::chrono::duration<double>(tau_i);
-        looselyCoupledPrediction(_latestInertialNavSol, tau_i);
+        if (_preintegrateBetweenUpdates)
+        {
+            preintegrate(_latestInertialNavSol, tau_i);
+        }
+        else
+        {
+            looselyCoupledPrediction(_latestInertialNavSol, tau_i);
+        }
     }
     else
     {
@@ -757,7 +835,14 @@ void NAV::LooselyCoupledKF::recvInertialNavigationSolution(NAV::InputPin::NodeDa
     }
     _latestInertialNavSol = inertialNavSol;
 
-    if (!inputPins[INPUT_PORT_INDEX_GNSS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS].queue.front()->insTime == _lastPredictTime)
+    bool updateAvailable = !inputPins[INPUT_PORT_INDEX_GNSS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS].queue.front()->insTime == _lastPredictTime;
+
+    if (!_preintegrator.empty() && (updateAvailable || !_preintegrateBetweenUpdates || _preintegrator.deltaTime() >= _preintegrationMaxInterval))
+    {
+        predictPreintegrated();
+    }
+
+    if (updateAvailable)
     {
         looselyCoupledUpdate(std::static_pointer_cast<const PosVel>(inputPins[INPUT_PORT_INDEX_GNSS].queue.extract_front()));
         if (inputPins[INPUT_PORT_INDEX_GNSS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS].link.getConnectedPin()->noMoreDataAvailable)
@@ -787,7 +872,37 @@ void NAV::LooselyCoupledKF::recvGNSSNavigationSolution(InputPin::NodeDataQueue&
 //                                               Kalman Filter
 // ###########################################################################################################
 
-void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i)
+void NAV::LooselyCoupledKF::preintegrate(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i)
+{
+    if (_preintegrator.empty())
+    {
+        _preintegrationStartSol = inertialNavSol;
+        _preintegrator.setNoise(accelNoisePsd(), gyroNoisePsd());
+    }
+    if (inertialNavSol->imuObs == nullptr)
+    {
+        _preintegrator.integrate(Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), tau_i);
+        return;
+    }
+
+    // The accumulated biases only change in the update, which always ends the preintegration interval
+    Eigen::Vector3d b_acceleration = inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value() - _accumulatedAccelBiases;
+    Eigen::Vector3d b_omega_ib = inertialNavSol->imuObs->imuPos.b_quatGyro_p() * inertialNavSol->imuObs->gyroUncompXYZ.value() - _accumulatedGyroBiases;
+
+    _preintegrator.integrate(b_acceleration, b_omega_ib, tau_i);
+}
+
+void NAV::LooselyCoupledKF::predictPreintegrated()
+{
+    LOG_DATA("{}: Predicting with {} preintegrated IMU measurements over {}s", nameId(), _preintegrator.size(), _preintegrator.deltaTime());
+
+    looselyCoupledPrediction(_preintegrationStartSol, _preintegrator.deltaTime(), true);
+
+    _preintegrator.reset();
+    _preintegrationStartSol = nullptr;
+}
+
+void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i, bool preintegrated)
 {
     auto dt = fmt::format("{:0.5f}", tau_i);
     dt.erase(std::find_if(dt.rbegin(), dt.rend(), [](char ch) { return ch != '0'; }).base(), dt.end());
@@ -798,36 +913,11 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
     // ------------------------------------------- GUI Parameters ----------------------------------------------
 
     // 𝜎_ra Standard deviation of the noise on the accelerometer specific-force state [m / (s^2 · √(s))]
-    Eigen::Vector3d sigma_ra = Eigen::Vector3d::Zero();
-    switch (_stdevAccelNoiseUnits)
-    {
-    case StdevAccelNoiseUnits::mg_sqrtHz: // [mg / √(Hz)]
-        sigma_ra = _stdev_ra * 1e-3;      // [g / √(Hz)]
-        sigma_ra *= InsConst<>::G_NORM;   // [m / (s^2 · √(Hz))] = [m / (s · √(s))]
-        // sigma_ra /= 1.;                // [m / (s^2 · √(s))]
-        break;
-    case StdevAccelNoiseUnits::m_s2_sqrtHz: // [m / (s^2 · √(Hz))] = [m / (s · √(s))]
-        sigma_ra = _stdev_ra;
-        // sigma_ra /= 1.;                  // [m / (s^2 · √(s))]
-        break;
-    }
+    Eigen::Vector3d sigma_ra = accelNoisePsd().cwiseSqrt();
     LOG_DATA("{}:     sigma_ra = {} [m / (s^2 · √(s))]", nameId(), sigma_ra.transpose());
 
     // 𝜎_rg Standard deviation of the noise on the gyro angular-rate state [rad / (s · √(s))]
-    Eigen::Vector3d sigma_rg = Eigen::Vector3d::Zero();
-    switch (_stdevGyroNoiseUnits)
-    {
-    case StdevGyroNoiseUnits::deg_hr_sqrtHz: // [deg / hr / √(Hz)] (see Woodman (2007) Chp. 3.2.2 - eq. 7 with seconds instead of hours)
-        sigma_rg = deg2rad(_stdev_rg);       // [rad / hr / √(Hz)]
-        sigma_rg /= 60.;                     // [rad / √(hr)]
-        sigma_rg /= 60.;                     // [rad / √(s)]
-        // sigma_rg /= 1.;                    // [rad / (s · √(s))]
-        break;
-    case StdevGyroNoiseUnits::rad_s_sqrtHz: // [rad / (s · √(Hz))] = [rad / √(s)]
-        sigma_rg = _stdev_rg;
-        // sigma_rg /= 1.;                  // [rad / (s · √(s))]
-        break;
-    }
+    Eigen::Vector3d sigma_rg = gyroNoisePsd().cwiseSqrt();
     LOG_DATA("{}:     sigma_rg = {} [rad / (s · √(s))]", nameId(), sigma_rg.transpose());
 
     // 𝜎_bad Standard deviation of the accelerometer dynamic bias [m / s^2]
@@ -871,10 +961,15 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
     LOG_DATA("{}:     r_eS_e = {} [m]", nameId(), r_eS_e);
 
     // a_p Acceleration in [m/s^2], in body coordinates
-    auto b_acceleration = _latestInertialNavSol->imuObs == nullptr
-                              ? Eigen::Vector3d::Zero()
-                              : Eigen::Vector3d(inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value()
-                                                - _accumulatedAccelBiases);
+    Eigen::Vector3d b_acceleration = Eigen::Vector3d::Zero();
+    if (preintegrated)
+    {
+        b_acceleration = _preintegrator.meanSpecificForce();
+    }
+    else if (_latestInertialNavSol->imuObs != nullptr)
+    {
+        b_acceleration = inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value() - _accumulatedAccelBiases;
+    }
     LOG_DATA("{}:     b_acceleration = {} [m/s^2]", nameId(), b_acceleration.transpose());
 
     if (_frame == Frame::NED)
@@ -1028,6 +1123,22 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
             calcPhi();
         }
     }
+    if (preintegrated)
+    {
+        const Eigen::Quaterniond& ien_Quat_b = _frame == Frame::NED ? inertialNavSol->n_Quat_b() : inertialNavSol->e_Quat_b();
+        if (_showKalmanFilterOutputPins)
+        {
+            auto guard1 = requestOutputValueLock(OUTPUT_PORT_INDEX_Phi);
+            auto guard2 = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
+            applyPreintegration(ien_Quat_b, _kalmanFilter.F.block<3>(Pos, Vel));
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, predictTime, guard1);
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, predictTime, guard2);
+        }
+        else
+        {
+            applyPreintegration(ien_Quat_b, _kalmanFilter.F.block<3>(Pos, Vel));
+        }
+    }
     LOG_DATA("{}:     KF.Phi =\n{}", nameId(), _kalmanFilter.Phi);
     LOG_DATA("{}:     KF.Q =\n{}", nameId(), _kalmanFilter.Q);
 
@@ -1077,6 +1188,65 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
     }
 }
 
+void NAV::LooselyCoupledKF::applyPreintegration(const Eigen::Quaterniond& ien_Quat_b, const Eigen::Matrix3d& F_dr_dv)
+{
+    // Conversion of the unscaled preintegrated errors with cartesian position into the states of the filter
+    Eigen::Matrix<double, 15, 15> T = Eigen::Matrix<double, 15, 15>::Identity();
+    T.block<3, 3>(0, 0) *= SCALE_FACTOR_ATTITUDE;
+    T.block<3, 3>(6, 6) = F_dr_dv;
+    T.block<3, 3>(9, 9) *= SCALE_FACTOR_ACCELERATION;
+    T.block<3, 3>(12, 12) *= SCALE_FACTOR_ANGULAR_RATE;
+
+    Eigen::Matrix<double, 15, 15> Phi = T * _preintegrator.errorTransitionMatrix(ien_Quat_b) * T.inverse();
+    LOG_DATA("{}:     Phi (preintegrated) =\n{}", nameId(), Phi);
+
+    // Earth rotation, transport rate and gravity terms are kept from the transition matrix of the system matrix
+    _kalmanFilter.Phi.block<3>(Att, GyrBias) = Phi.block<3, 3>(0, 12);
+    _kalmanFilter.Phi.block<3>(Vel, Att) = Phi.block<3, 3>(3, 0);
+    _kalmanFilter.Phi.block<3>(Vel, AccBias) = Phi.block<3, 3>(3, 9);
+    _kalmanFilter.Phi.block<3>(Vel, GyrBias) = Phi.block<3, 3>(3, 12);
+    _kalmanFilter.Phi.block<3>(Pos, Att) = Phi.block<3, 3>(6, 0);
+    _kalmanFilter.Phi.block<3>(Pos, AccBias) = Phi.block<3, 3>(6, 9);
+    _kalmanFilter.Phi.block<3>(Pos, GyrBias) = Phi.block<3, 3>(6, 12);
+
+    // The bias noise is kept from the system noise covariance matrix
+    Eigen::Matrix<double, 9, 9> Q = T.topLeftCorner<9, 9>() * _preintegrator.errorCovariance(ien_Quat_b) * T.topLeftCorner<9, 9>().transpose();
+    LOG_DATA("{}:     Q (preintegrated) =\n{}", nameId(), Q);
+
+    const std::array<const std::vector<KFStates>*, 3> keys{ &Att, &Vel, &Pos };
+    for (size_t r = 0; r < keys.size(); r++)
+    {
+        for (size_t c = 0; c < keys.size(); c++)
+        {
+            _kalmanFilter.Q.block<3>(*keys.at(r), *keys.at(c)) = Q.block<3, 3>(3 * static_cast<Eigen::Index>(r), 3 * static_cast<Eigen::Index>(c));
+        }
+    }
+}
+
+Eigen::Vector3d NAV::LooselyCoupledKF::accelNoisePsd() const
+{
+    switch (_stdevAccelNoiseUnits)
+    {
+    case StdevAccelNoiseUnits::mg_sqrtHz: // [mg / √(Hz)]
+        return (_stdev_ra * 1e-3 * InsConst<>::G_NORM).array().square();
+    case StdevAccelNoiseUnits::m_s2_sqrtHz: // [m / (s^2 · √(Hz))] = [m / (s · √(s))]
+        return _stdev_ra.array().square();
+    }
+    return Eigen::Vector3d::Zero();
+}
+
+Eigen::Vector3d NAV::LooselyCoupledKF::gyroNoisePsd() const
+{
+    switch (_stdevGyroNoiseUnits)
+    {
+    case StdevGyroNoiseUnits::deg_hr_sqrtHz: // [deg / hr / √(Hz)] (see Woodman (2007) Chp. 3.2.2 - eq. 7 with seconds instead of hours)
+        return (deg2rad(_stdev_rg) / 3600.).array().square();
+    case StdevGyroNoiseUnits::rad_s_sqrtHz: // [rad / (s · √(Hz))] = [rad / √(s)]
+        return _stdev_rg.array().square();
+    }
+    return Eigen::Vector3d::Zero();
+}
+
 void NAV::LooselyCoupledKF::looselyCoupledUpdate(const std::shared_ptr<const PosVel>& gnssMeasurement)
 {
     LOG_DATA("{}: Updating to [{}] (lastInertial at [{}])", nameId(), gnssMeasurement->insTime, _latestInertialNavSol->insTime);
@@ -16,6 +16,7 @@
 
 #include "internal/Node/Node.hpp"
 #include "Navigation/Time/InsTime.hpp"
+#include "Navigation/INS/Preintegration.hpp"
 #include "NodeData/State/InertialNavSol.hpp"
 #include "NodeData/State/LcKfInsGnssErrors.hpp"
 
@@ -59,6 +60,13 @@ class LooselyCoupledKF : public Node
     /// @param[in] j Json object with the node state
     void restore(const json& j) override;
 
+    /// @brief Parameters which can be changed while the node is running (process noise and measurement uncertainties)
+    [[nodiscard]] std::vector<std::string> liveParameters() const override;
+
+    /// @brief Checks that the units of the live parameters are valid options
+    /// @param[in] j Json object with the changed parameters
+    [[nodiscard]] bool checkParameters(const json& j) const override;
+
     /// @brief State Keys of the Kalman filter
     enum KFStates
     {
@@ -139,7 +147,29 @@ class LooselyCoupledKF : public Node
     /// @brief Predicts the state from the InertialNavSol
     /// @param[in] inertialNavSol Inertial navigation solution triggering the prediction
     /// @param[in] tau_i Time since the last prediction in [s]
-    void looselyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i);
+    /// @param[in] preintegrated Whether the IMU measurements over tau_i were preintegrated. The IMU driven parts of the transition
+    ///                          and system noise matrices are then taken from the preintegrated measurements instead of the IMU observation of the solution.
+    void looselyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i, bool preintegrated = false);
+
+    /// @brief Adds the IMU measurement of the InertialNavSol to the preintegrated measurements
+    /// @param[in] inertialNavSol Inertial navigation solution with the IMU observation
+    /// @param[in] tau_i Time the IMU observation is valid for in [s]
+    void preintegrate(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i);
+
+    /// @brief Performs a single prediction over the whole preintegration interval and restarts the preintegration
+    void predictPreintegrated();
+
+    /// @brief Replaces the IMU driven blocks of the transition matrix and the navigation part of the system noise covariance matrix
+    ///        with the ones from the preintegrated measurements
+    /// @param[in] ien_Quat_b Attitude at the start of the preintegration interval, from body to navigation (NED / ECEF) frame
+    /// @param[in] F_dr_dv Block of the (scaled) system matrix mapping velocity errors onto the rate of the position states
+    void applyPreintegration(const Eigen::Quaterniond& ien_Quat_b, const Eigen::Matrix3d& F_dr_dv);
+
+    /// @brief Power spectral density of the accelerometer white noise from the GUI parameters in [m^2 / s^3]
+    [[nodiscard]] Eigen::Vector3d accelNoisePsd() const;
+
+    /// @brief Power spectral density of the gyroscope white noise from the GUI parameters in [rad^2 / s]
+    [[nodiscard]] Eigen::Vector3d gyroNoisePsd() const;
 
     /// @brief Updates the predicted state from the InertialNavSol with the GNSS measurement
     /// @param[in] gnssMeasurement Gnss measurement triggering the update
@@ -165,6 +195,11 @@ class LooselyCoupledKF : public Node
     /// Accumulated Gyroscope biases
     Eigen::Vector3d _accumulatedGyroBiases;
 
+    /// Preintegrated IMU measurements since the last prediction
+    ImuPreintegrator _preintegrator;
+    /// Inertial navigation solution at the start of the preintegration interval
+    std::shared_ptr<const InertialNavSol> _preintegrationStartSol = nullptr;
+
     /// @brief Vector with all state keys
     inline static const std::vector<KFStates> States = { KFStates::Roll, KFStates::Pitch, KFStates::Yaw,
                                                          KFStates::VelN, KFStates::VelE, KFStates::VelD,
@@ -211,6 +246,12 @@ class LooselyCoupledKF : public Node
     /// @brief Check the rank of the Kalman matrices every iteration (computational expensive)
     bool _checkKalmanMatricesRanks = true;
 
+    /// @brief Preintegrate the IMU measurements and only predict at the aiding epochs
+    bool _preintegrateBetweenUpdates = false;
+
+    /// @brief Maximum preintegration interval in [s] after which a prediction is forced
+    double _preintegrationMaxInterval = 1.0;
+
     // ###########################################################################################################
     //                                                Parameters
     // ###########################################################################################################
@@ -206,14 +206,15 @@ void NAV::TightlyCoupledKF::guiConfig()
                     }
 
                     ImGui::TableNextColumn(); // # Sat
-                    if (auto gnssNavInfo = getInputValue<GnssNavInfo>(pinIndex))
+                    auto gnssNavInfo = getInputValue<GnssNavInfo>(pinIndex);
+                    if (auto latestNavInfo = gnssNavInfo ? gnssNavInfo->v->latest() : nullptr)
                     {
                         size_t usedSatNum = 0;
                         std::string usedSats;
                         std::string allSats;
 
                         std::string filler = ", ";
-                        for (const auto& satellite : gnssNavInfo->v->satellites())
+                        for (const auto& satellite : latestNavInfo->satellites())
                         {
                             if ((satellite.first.satSys & _filterFreq)
                                 && std::find(_excludedSatellites.begin(), _excludedSatellites.end(), satellite.first) == _excludedSatellites.end())
@@ -223,7 +224,7 @@ void NAV::TightlyCoupledKF::guiConfig()
                             }
                             allSats += (allSats.empty() ? "" : filler) + fmt::format("{}", satellite.first);
                         }
-                        ImGui::TextUnformatted(fmt::format("{} / {}", usedSatNum, gnssNavInfo->v->nSatellites()).c_str());
+                        ImGui::TextUnformatted(fmt::format("{} / {}", usedSatNum, latestNavInfo->nSatellites()).c_str());
                         if (ImGui::IsItemHovered())
                         {
                             ImGui::SetTooltip("Used satellites: %s\n"
@@ -731,6 +732,21 @@ void NAV::TightlyCoupledKF::guiConfig()
             flow::ApplyChanges();
         }
 
+        if (ImGui::Checkbox(fmt::format("Preintegrate IMU measurements between updates##{}", size_t(id)).c_str(), &_preintegrateBetweenUpdates))
+        {
+            LOG_DEBUG("{}: preintegrateBetweenUpdates {}", nameId(), _preintegrateBetweenUpdates);
+            flow::ApplyChanges();
+        }
+        if (_preintegrateBetweenUpdates)
+        {
+            ImGui::SetNextItemWidth(configWidth);
+            if (ImGui::InputDoubleL(fmt::format("Max. preintegration interval##{}", size_t(id)).c_str(), &_preintegrationMaxInterval, 1e-3, std::numeric_limits<double>::max(), 0.1, 1.0, "%.3f s"))
+            {
+                LOG_DEBUG("{}: preintegrationMaxInterval changed to {}", nameId(), _preintegrationMaxInterval);
+                flow::ApplyChanges();
+            }
+        }
+
         if (ImGui::Checkbox(fmt::format("Show Kalman Filter matrices as output pins##{}", size_t(id)).c_str(), &_showKalmanFilterOutputPins))
         {
             LOG_DEBUG("{}: showKalmanFilterOutputPins {}", nameId(), _showKalmanFilterOutputPins);
@@ -763,6 +779,8 @@ void NAV::TightlyCoupledKF::guiConfig()
     j["troposphereModels"] = _troposphereModels;
 
     j["checkKalmanMatricesRanks"] = _checkKalmanMatricesRanks;
+    j["preintegrateBetweenUpdates"] = _preintegrateBetweenUpdates;
+    j["preintegrationMaxInterval"] = _preintegrationMaxInterval;
     j["frame"] = _frame;
     j["phiCalculationAlgorithm"] = _phiCalculationAlgorithm;
     j["phiCalculationTaylorOrder"] = _phiCalculationTaylorOrder;
@@ -859,6 +877,14 @@ void NAV::TightlyCoupledKF::restore(json const& j)
     {
         j.at("checkKalmanMatricesRanks").get_to(_checkKalmanMatricesRanks);
     }
+    if (j.contains("preintegrateBetweenUpdates"))
+    {
+        j.at("preintegrateBetweenUpdates").get_to(_preintegrateBetweenUpdates);
+    }
+    if (j.contains("preintegrationMaxInterval"))
+    {
+        j.at("preintegrationMaxInterval").get_to(_preintegrationMaxInterval);
+    }
     if (j.contains("frame"))
     {
         j.at("frame").get_to(_frame);
@@ -1039,6 +1065,11 @@ bool NAV::TightlyCoupledKF::initialize()
         LOG_ERROR("{}: You need to connect a GNSS NavigationInfo provider", nameId());
         return false;
     }
+    if (!isIonosphereModelAvailable(_ionosphereModel))
+    {
+        LOG_ERROR("{}: The data files of the ionosphere model '{}' are missing", nameId(), NAV::to_string(_ionosphereModel));
+        return false;
+    }
 
     _recvClk = {};
 
@@ -1052,6 +1083,9 @@ bool NAV::TightlyCoupledKF::initialize()
     _accumulatedAccelBiases = _initBiasAccel;
     _accumulatedGyroBiases = _initBiasGyro;
 
+    _preintegrator.reset();
+    _preintegrationStartSol = nullptr;
+
     // Initial Covariance of the attitude angles in [rad²]
     Eigen::Vector3d variance_angles = Eigen::Vector3d::Zero();
     if (_initCovarianceAttitudeAnglesUnit == InitCovarianceAttitudeAnglesUnit::rad2)
@@ -1176,6 +1210,12 @@ bool NAV::TightlyCoupledKF::initialize()
                                                       variance_clkPhase,                                // Receiver clock phase drift covariance
                                                       variance_clkFreq);                                // Receiver clock frequency drift covariance
 
+    // Versions of the navigation data are kept till this node asked for a later time
+    for (size_t i = 0; i < _nNavInfoPins; i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->addConsumer(this); }
+    }
+
     LOG_DEBUG("{}: initialized", nameId());
     LOG_DATA("{}: P_0 =\n{}", nameId(), _kalmanFilter.P);
 
@@ -1185,6 +1225,11 @@ bool NAV::TightlyCoupledKF::initialize()
 void NAV::TightlyCoupledKF::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
+
+    for (size_t i = 0; i < _nNavInfoPins; i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i)) { gnssNavInfo->v->removeConsumer(this); }
+    }
 }
 
 void NAV::TightlyCoupledKF::updateNumberOfInputPins()
@@ -1211,7 +1256,14 @@ void NAV::TightlyCoupledKF::recvInertialNavigationSolution(NAV::InputPin::NodeDa
     if (tau_i > 0)
     {
         _lastPredictTime = _latestInertialNavSol->insTime + std::chrono::duration<double>(tau_i);
-        tightlyCoupledPrediction(_latestInertialNavSol, tau_i);
+        if (_preintegrateBetweenUpdates)
+        {
+            preintegrate(_latestInertialNavSol, tau_i);
+        }
+        else
+        {
+            tightlyCoupledPrediction(_latestInertialNavSol, tau_i);
+        }
     }
     else
     {
@@ -1219,7 +1271,14 @@ void NAV::TightlyCoupledKF::recvInertialNavigationSolution(NAV::InputPin::NodeDa
     }
     _latestInertialNavSol = inertialNavSol;
 
-    if (!inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.front()->insTime == _lastPredictTime)
+    bool updateAvailable = !inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.front()->insTime == _lastPredictTime;
+
+    if (!_preintegrator.empty() && (updateAvailable || !_preintegrateBetweenUpdates || _preintegrator.deltaTime() >= _preintegrationMaxInterval))
+    {
+        predictPreintegrated();
+    }
+
+    if (updateAvailable)
     {
         tightlyCoupledUpdate(std::static_pointer_cast<const GnssObs>(inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.extract_front()));
         if (inputPins[INPUT_PORT_INDEX_GNSS_OBS].queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS_OBS].link.getConnectedPin()->noMoreDataAvailable)
@@ -1249,7 +1308,37 @@ void NAV::TightlyCoupledKF::recvGnssObs(InputPin::NodeDataQueue& queue, size_t /
 //                                               Kalman Filter
 // ###########################################################################################################
 
-void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i)
+void NAV::TightlyCoupledKF::preintegrate(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i)
+{
+    if (_preintegrator.empty())
+    {
+        _preintegrationStartSol = inertialNavSol;
+        _preintegrator.setNoise(accelNoisePsd(), gyroNoisePsd());
+    }
+    if (inertialNavSol->imuObs == nullptr)
+    {
+        _preintegrator.integrate(Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(), tau_i);
+        return;
+    }
+
+    // The accumulated biases only change in the update, which always ends the preintegration interval
+    Eigen::Vector3d b_acceleration = inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value() - _accumulatedAccelBiases;
+    Eigen::Vector3d b_omega_ib = inertialNavSol->imuObs->imuPos.b_quatGyro_p() * inertialNavSol->imuObs->gyroUncompXYZ.value() - _accumulatedGyroBiases;
+
+    _preintegrator.integrate(b_acceleration, b_omega_ib, tau_i);
+}
+
+void NAV::TightlyCoupledKF::predictPreintegrated()
+{
+    LOG_DATA("{}: Predicting with {} preintegrated IMU measurements over {}s", nameId(), _preintegrator.size(), _preintegrator.deltaTime());
+
+    tightlyCoupledPrediction(_preintegrationStartSol, _preintegrator.deltaTime(), true);
+
+    _preintegrator.reset();
+    _preintegrationStartSol = nullptr;
+}
+
+void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const InertialNavSol>& inertialNavSol, double tau_i, bool preintegrated)
 {
     auto dt = fmt::format("{:0.5f}", tau_i);
     dt.erase(std::find_if(dt.rbegin(), dt.rend(), [](char ch) { return ch != '0'; }).base(), dt.end());
@@ -1261,29 +1350,11 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
     // ------------------------------------------- GUI Parameters ----------------------------------------------
 
     // 𝜎²_ra Variance of the noise on the accelerometer specific-force state [m^2 / s^5]
-    Eigen::Vector3d sigma2_ra = Eigen::Vector3d::Zero();
-    switch (_stdevAccelNoiseUnits)
-    {
-    case StdevAccelNoiseUnits::mg_sqrtHz: // [mg / √(Hz)]
-        sigma2_ra = (_stdev_ra * 1e-3 * InsConst<>::G_NORM).array().square();
-        break;
-    case StdevAccelNoiseUnits::m_s2_sqrtHz: // [m / (s^2 · √(Hz))] = [m / (s · √(s))]
-        sigma2_ra = _stdev_ra.array().square();
-        break;
-    }
+    Eigen::Vector3d sigma2_ra = accelNoisePsd();
     LOG_DATA("{}:     sigma2_ra = {} [m^2 / s^5]", nameId(), sigma2_ra.transpose());
 
     // 𝜎²_rg Variance of the noise on the gyro angular-rate state [rad^2 / s^3]
-    Eigen::Vector3d sigma2_rg = Eigen::Vector3d::Zero();
-    switch (_stdevGyroNoiseUnits)
-    {
-    case StdevGyroNoiseUnits::deg_hr_sqrtHz: // [deg / hr / √(Hz)] (see Woodman (2007) Chp. 3.2.2 - eq. 7 with seconds instead of hours)
-        sigma2_rg = (deg2rad(_stdev_rg) / 3600.).array().square();
-        break;
-    case StdevGyroNoiseUnits::rad_s_sqrtHz: // [rad / (s · √(Hz))] = [rad / √(s)]
-        sigma2_rg = _stdev_rg.array().square();
-        break;
-    }
+    Eigen::Vector3d sigma2_rg = gyroNoisePsd();
     LOG_DATA("{}:     sigma2_rg = {} [rad^2 / s^3]", nameId(), sigma2_rg.transpose());
 
     // 𝜎²_bad Variance of the accelerometer dynamic bias [m^2 / s^4]
@@ -1345,10 +1416,15 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
     LOG_DATA("{}:     r_eS_e = {} [m]", nameId(), r_eS_e);
 
     // a_p Acceleration in [m/s^2], in body coordinates
-    auto b_acceleration = _latestInertialNavSol->imuObs == nullptr
-                              ? Eigen::Vector3d::Zero()
-                              : Eigen::Vector3d(inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value()
-                                                - _accumulatedAccelBiases);
+    Eigen::Vector3d b_acceleration = Eigen::Vector3d::Zero();
+    if (preintegrated)
+    {
+        b_acceleration = _preintegrator.meanSpecificForce();
+    }
+    else if (_latestInertialNavSol->imuObs != nullptr)
+    {
+        b_acceleration = inertialNavSol->imuObs->imuPos.b_quatAccel_p() * inertialNavSol->imuObs->accelUncompXYZ.value() - _accumulatedAccelBiases;
+    }
     LOG_DATA("{}:     b_acceleration = {} [m/s^2]", nameId(), b_acceleration.transpose());
 
     // System Matrix
@@ -1522,6 +1598,23 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         }
     }
 
+    if (preintegrated)
+    {
+        const Eigen::Quaterniond& ien_Quat_b = _frame == Frame::NED ? inertialNavSol->n_Quat_b() : inertialNavSol->e_Quat_b();
+        if (_showKalmanFilterOutputPins)
+        {
+            auto guard1 = requestOutputValueLock(OUTPUT_PORT_INDEX_Phi);
+            auto guard2 = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
+            applyPreintegration(ien_Quat_b, F.block<3, 3>(6, 3));
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, predictTime, guard1);
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, predictTime, guard2);
+        }
+        else
+        {
+            applyPreintegration(ien_Quat_b, F.block<3, 3>(6, 3));
+        }
+    }
+
     LOG_DATA("{}:     KF.Phi =\n{}", nameId(), _kalmanFilter.Phi);
     LOG_DATA("{}:     KF.Q =\n{}", nameId(), _kalmanFilter.Q);
 
@@ -1571,6 +1664,54 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
     }
 }
 
+void NAV::TightlyCoupledKF::applyPreintegration(const Eigen::Quaterniond& ien_Quat_b, const Eigen::Matrix3d& F_dr_dv)
+{
+    // Conversion of the unscaled preintegrated errors with cartesian position into the states of the filter
+    Eigen::Matrix<double, 15, 15> T = Eigen::Matrix<double, 15, 15>::Identity();
+    T.block<3, 3>(0, 0) *= SCALE_FACTOR_ATTITUDE;
+    T.block<3, 3>(6, 6) = F_dr_dv;
+    T.block<3, 3>(9, 9) *= SCALE_FACTOR_ACCELERATION;
+    T.block<3, 3>(12, 12) *= SCALE_FACTOR_ANGULAR_RATE;
+
+    Eigen::Matrix<double, 15, 15> Phi = T * _preintegrator.errorTransitionMatrix(ien_Quat_b) * T.inverse();
+    LOG_DATA("{}:     Phi (preintegrated) =\n{}", nameId(), Phi);
+
+    // Earth rotation, transport rate and gravity terms are kept from the transition matrix of the system matrix
+    _kalmanFilter.Phi.block<3, 3>(0, 12) = Phi.block<3, 3>(0, 12);
+    _kalmanFilter.Phi.block<3, 3>(3, 0) = Phi.block<3, 3>(3, 0);
+    _kalmanFilter.Phi.block<3, 6>(3, 9) = Phi.block<3, 6>(3, 9);
+    _kalmanFilter.Phi.block<3, 3>(6, 0) = Phi.block<3, 3>(6, 0);
+    _kalmanFilter.Phi.block<3, 6>(6, 9) = Phi.block<3, 6>(6, 9);
+
+    // The bias and clock noise is kept from the system noise covariance matrix
+    _kalmanFilter.Q.topLeftCorner<9, 9>() = T.topLeftCorner<9, 9>() * _preintegrator.errorCovariance(ien_Quat_b) * T.topLeftCorner<9, 9>().transpose();
+    LOG_DATA("{}:     Q (preintegrated) =\n{}", nameId(), _kalmanFilter.Q.topLeftCorner<9, 9>());
+}
+
+Eigen::Vector3d NAV::TightlyCoupledKF::accelNoisePsd() const
+{
+    switch (_stdevAccelNoiseUnits)
+    {
+    case StdevAccelNoiseUnits::mg_sqrtHz: // [mg / √(Hz)]
+        return (_stdev_ra * 1e-3 * InsConst<>::G_NORM).array().square();
+    case StdevAccelNoiseUnits::m_s2_sqrtHz: // [m / (s^2 · √(Hz))] = [m / (s · √(s))]
+        return _stdev_ra.array().square();
+    }
+    return Eigen::Vector3d::Zero();
+}
+
+Eigen::Vector3d NAV::TightlyCoupledKF::gyroNoisePsd() const
+{
+    switch (_stdevGyroNoiseUnits)
+    {
+    case StdevGyroNoiseUnits::deg_hr_sqrtHz: // [deg / hr / √(Hz)] (see Woodman (2007) Chp. 3.2.2 - eq. 7 with seconds instead of hours)
+        return (deg2rad(_stdev_rg) / 3600.).array().square();
+    case StdevGyroNoiseUnits::rad_s_sqrtHz: // [rad / (s · √(Hz))] = [rad / √(s)]
+        return _stdev_rg.array().square();
+    }
+    return Eigen::Vector3d::Zero();
+}
+
 void NAV::TightlyCoupledKF::tightlyCoupledUpdate(const std::shared_ptr<const GnssObs>& gnssObs)
 {
     LOG_DATA("{}: Updating to time {} - {} (lastInertial at {} - {})", nameId(), gnssObs->insTime.toYMDHMS(), gnssObs->insTime.toGPSweekTow(),
@@ -1618,15 +1759,18 @@ void NAV::TightlyCoupledKF::tightlyCoupledUpdate(const std::shared_ptr<const Gns
 
     // ----------------------------------------- Read observation data -------------------------------------------
 
-    // Collection of all connected navigation data providers
+    // Collection of all connected navigation data providers (with the data known at the time of the observation)
     std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
     std::vector<const GnssNavInfo*> gnssNavInfos;
     for (size_t i = 0; i < _nNavInfoPins; i++)
     {
         if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
         {
-            gnssNavInfoWrappers.push_back(*gnssNavInfo);
-            gnssNavInfos.push_back(gnssNavInfo->v);
+            if (const auto* knownNavInfo = gnssNavInfo->v->knownAt(gnssObs->insTime, this))
+            {
+                gnssNavInfoWrappers.push_back(*gnssNavInfo);
+                gnssNavInfos.push_back(knownNavInfo);
+            }
         }
     }
     if (gnssNavInfos.empty()) { return; }
@@ -1857,7 +2001,7 @@ void NAV::TightlyCoupledKF::tightlyCoupledUpdate(const std::shared_ptr<const Gns
         psrMeas(static_cast<int>(ix)) = obsData.pseudorange.value().value /* + (multipath and/or NLOS errors) + (tracking errors) */;
         LOG_DATA("{}:     psrMeas({}) {}", nameId(), ix, psrMeas(static_cast<int>(ix)));
         // Estimated modulation ionosphere propagation error [m]
-        double dpsr_I = calcIonosphericDelay(static_cast<double>(gnssObs->insTime.toGPSweekTow().tow), obsData.satSigId.freq(), -128, lla_position,
+        double dpsr_I = calcIonosphericDelay(gnssObs->insTime, obsData.satSigId.freq(), -128, lla_position, calc.e_satPos,
                                              calc.satElevation, calc.satAzimuth, _ionosphereModel, &ionosphericCorrections);
         LOG_DATA("{}:     dpsr_I {} [m] (Estimated modulation ionosphere propagation error)", nameId(), dpsr_I);
 
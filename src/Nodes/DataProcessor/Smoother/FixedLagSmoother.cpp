@@ -0,0 +1,388 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "FixedLagSmoother.hpp"
+
+#include "util/Eigen.hpp"
+
+#include "util/Logger.hpp"
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+
+#include "internal/FlowManager.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "NodeData/State/InertialNavSol.hpp"
+
+NAV::FixedLagSmoother::FixedLagSmoother()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 630, 500 };
+
+    // Higher priority than the GNSS, so that the IMU observation at the same time is integrated first
+    nm::CreateInputPin(this, "ImuObs", Pin::Type::Flow, { NAV::ImuObs::type() }, &FixedLagSmoother::recvImuObs, nullptr, 2);
+    nm::CreateInputPin(this, "GNSSNavigationSolution", Pin::Type::Flow, { NAV::PosVel::type() }, &FixedLagSmoother::recvGnssNavigationSolution, nullptr, 1);
+    nm::CreateInputPin(this, "PosVelAttInit", Pin::Type::Flow, { NAV::PosVelAtt::type() }, &FixedLagSmoother::recvPosVelAttInit, nullptr, 3);
+
+    nm::CreateOutputPin(this, "PosVelAtt", Pin::Type::Flow, { NAV::InertialNavSol::type() });
+}
+
+NAV::FixedLagSmoother::~FixedLagSmoother()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::FixedLagSmoother::typeStatic()
+{
+    return "FixedLagSmoother";
+}
+
+std::string NAV::FixedLagSmoother::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::FixedLagSmoother::category()
+{
+    return "Data Processor";
+}
+
+void NAV::FixedLagSmoother::guiConfig()
+{
+    float configWidth = 380.0F * gui::NodeEditorApplication::windowFontRatio();
+
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::Combo(fmt::format("Output##{}", size_t(id)).c_str(), reinterpret_cast<int*>(&_outputMode), "Real-time (latest state)\0Fixed-lag (smoothed states)\0\0"))
+    {
+        LOG_DEBUG("{}: outputMode changed to {}", nameId(), fmt::underlying(_outputMode));
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Real-time: Outputs the latest state of the window after every GNSS epoch.\n"
+                             "Fixed-lag: Outputs every state when it leaves the window. The latency equals the window length.");
+
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDoubleL(fmt::format("Window length##{}", size_t(id)).c_str(), &_parameters.windowLength, 0.0, std::numeric_limits<double>::max(), 0.5, 1.0, "%.2f s"))
+    {
+        LOG_DEBUG("{}: windowLength changed to {}", nameId(), _parameters.windowLength);
+        flow::ApplyChanges();
+    }
+    int maxIterations = static_cast<int>(_parameters.maxIterations);
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputIntL(fmt::format("Max. iterations per epoch##{}", size_t(id)).c_str(), &maxIterations, 1, std::numeric_limits<int>::max()))
+    {
+        _parameters.maxIterations = static_cast<size_t>(maxIterations);
+        LOG_DEBUG("{}: maxIterations changed to {}", nameId(), _parameters.maxIterations);
+        flow::ApplyChanges();
+    }
+    if (ImGui::Checkbox(fmt::format("Use GNSS velocity##{}", size_t(id)).c_str(), &_useGnssVelocity))
+    {
+        LOG_DEBUG("{}: useGnssVelocity {}", nameId(), _useGnssVelocity);
+        flow::ApplyChanges();
+    }
+
+    ImGui::Separator();
+
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3(fmt::format("Lever arm INS-GNSS [m]##{}", size_t(id)).c_str(), _b_leverArm_InsGnss.data(), "%.3f"))
+    {
+        LOG_DEBUG("{}: b_leverArm_InsGnss changed to {}", nameId(), _b_leverArm_InsGnss.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("Accelerometer noise [m/s^2/√(Hz)]##{}", size_t(id)).c_str(), _stdev_ra.data(), 0.0, std::numeric_limits<double>::max(), "%.2e", ImGuiInputTextFlags_CharsScientific))
+    {
+        LOG_DEBUG("{}: stdev_ra changed to {}", nameId(), _stdev_ra.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("Gyroscope noise [rad/s/√(Hz)]##{}", size_t(id)).c_str(), _stdev_rg.data(), 0.0, std::numeric_limits<double>::max(), "%.2e", ImGuiInputTextFlags_CharsScientific))
+    {
+        LOG_DEBUG("{}: stdev_rg changed to {}", nameId(), _stdev_rg.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("Accel bias random walk [m/s^2/√(s)]##{}", size_t(id)).c_str(), _stdev_bad.data(), 0.0, std::numeric_limits<double>::max(), "%.2e", ImGuiInputTextFlags_CharsScientific))
+    {
+        LOG_DEBUG("{}: stdev_bad changed to {}", nameId(), _stdev_bad.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("Gyro bias random walk [rad/s/√(s)]##{}", size_t(id)).c_str(), _stdev_bgd.data(), 0.0, std::numeric_limits<double>::max(), "%.2e", ImGuiInputTextFlags_CharsScientific))
+    {
+        LOG_DEBUG("{}: stdev_bgd changed to {}", nameId(), _stdev_bgd.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("GNSS position stdev NED [m]##{}", size_t(id)).c_str(), _gnssStdevPosition.data(), 0.0, std::numeric_limits<double>::max(), "%.3f"))
+    {
+        LOG_DEBUG("{}: gnssStdevPosition changed to {}", nameId(), _gnssStdevPosition.transpose());
+        flow::ApplyChanges();
+    }
+    ImGui::SetNextItemWidth(configWidth);
+    if (ImGui::InputDouble3L(fmt::format("GNSS velocity stdev NED [m/s]##{}", size_t(id)).c_str(), _gnssStdevVelocity.data(), 0.0, std::numeric_limits<double>::max(), "%.3f"))
+    {
+        LOG_DEBUG("{}: gnssStdevVelocity changed to {}", nameId(), _gnssStdevVelocity.transpose());
+        flow::ApplyChanges();
+    }
+
+    if (ImGui::TreeNode(fmt::format("Initial standard deviations##{}", size_t(id)).c_str()))
+    {
+        constexpr std::array<const char*, 5> labels = { "Attitude [rad]", "Velocity [m/s]", "Position [m]", "Accel bias [m/s^2]", "Gyro bias [rad/s]" };
+        for (size_t i = 0; i < labels.size(); i++)
+        {
+            ImGui::SetNextItemWidth(configWidth);
+            if (ImGui::InputDoubleL(fmt::format("{}##{}", labels.at(i), size_t(id)).c_str(), &_initialStdev.at(i), 0.0, std::numeric_limits<double>::max(), 0.0, 0.0, "%.2e", ImGuiInputTextFlags_CharsScientific))
+            {
+                LOG_DEBUG("{}: initialStdev {} changed to {}", nameId(), labels.at(i), _initialStdev.at(i));
+                flow::ApplyChanges();
+            }
+        }
+        ImGui::TreePop();
+    }
+}
+
+[[nodiscard]] json NAV::FixedLagSmoother::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["outputMode"] = _outputMode;
+    j["windowLength"] = _parameters.windowLength;
+    j["maxIterations"] = _parameters.maxIterations;
+    j["useGnssVelocity"] = _useGnssVelocity;
+    j["b_leverArm_InsGnss"] = _b_leverArm_InsGnss;
+    j["stdev_ra"] = _stdev_ra;
+    j["stdev_rg"] = _stdev_rg;
+    j["stdev_bad"] = _stdev_bad;
+    j["stdev_bgd"] = _stdev_bgd;
+    j["gnssStdevPosition"] = _gnssStdevPosition;
+    j["gnssStdevVelocity"] = _gnssStdevVelocity;
+    j["initialStdev"] = _initialStdev;
+
+    return j;
+}
+
+void NAV::FixedLagSmoother::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("outputMode"))
+    {
+        j.at("outputMode").get_to(_outputMode);
+    }
+    if (j.contains("windowLength"))
+    {
+        j.at("windowLength").get_to(_parameters.windowLength);
+    }
+    if (j.contains("maxIterations"))
+    {
+        j.at("maxIterations").get_to(_parameters.maxIterations);
+    }
+    if (j.contains("useGnssVelocity"))
+    {
+        j.at("useGnssVelocity").get_to(_useGnssVelocity);
+    }
+    if (j.contains("b_leverArm_InsGnss"))
+    {
+        _b_leverArm_InsGnss = j.at("b_leverArm_InsGnss");
+    }
+    if (j.contains("stdev_ra"))
+    {
+        _stdev_ra = j.at("stdev_ra");
+    }
+    if (j.contains("stdev_rg"))
+    {
+        _stdev_rg = j.at("stdev_rg");
+    }
+    if (j.contains("stdev_bad"))
+    {
+        _stdev_bad = j.at("stdev_bad");
+    }
+    if (j.contains("stdev_bgd"))
+    {
+        _stdev_bgd = j.at("stdev_bgd");
+    }
+    if (j.contains("gnssStdevPosition"))
+    {
+        _gnssStdevPosition = j.at("gnssStdevPosition");
+    }
+    if (j.contains("gnssStdevVelocity"))
+    {
+        _gnssStdevVelocity = j.at("gnssStdevVelocity");
+    }
+    if (j.contains("initialStdev"))
+    {
+        j.at("initialStdev").get_to(_initialStdev);
+    }
+}
+
+bool NAV::FixedLagSmoother::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    // Power spectral densities from the standard deviations
+    _parameters.sigma2_biasAccel = _stdev_bad.array().square().matrix();
+    _parameters.sigma2_biasGyro = _stdev_bgd.array().square().matrix();
+    _smoother = SlidingWindowSmoother(_parameters);
+
+    _preintegrator = ImuPreintegrator(_stdev_ra.array().square().matrix(), _stdev_rg.array().square().matrix());
+    _latestImuObs = nullptr;
+    _posVelAttInit = nullptr;
+    _lastIntegrationTime.reset();
+
+    inputPins[INPUT_PORT_INDEX_POS_VEL_ATT_INIT].queueBlocked = false;
+
+    return true;
+}
+
+void NAV::FixedLagSmoother::recvPosVelAttInit(InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto posVelAtt = std::static_pointer_cast<const PosVelAtt>(queue.extract_front());
+    if (!_smoother.empty() || _posVelAttInit != nullptr) { return; }
+    LOG_DATA("{}: recvPosVelAttInit at time [{}]", nameId(), posVelAtt->insTime.toYMDHMS());
+
+    inputPins[INPUT_PORT_INDEX_POS_VEL_ATT_INIT].queueBlocked = true;
+
+    if (!posVelAtt->insTime.empty())
+    {
+        initializeSmoother(*posVelAtt, posVelAtt->insTime);
+    }
+    else if (_latestImuObs != nullptr)
+    {
+        initializeSmoother(*posVelAtt, _latestImuObs->insTime);
+    }
+    else // PosVelAttInitializer sends its solution with an empty time if all values are overridden
+    {
+        LOG_DEBUG("{}: Initial state has no time. Deferring the initialization to the first IMU observation.", nameId());
+        _posVelAttInit = posVelAtt;
+    }
+}
+
+void NAV::FixedLagSmoother::initializeSmoother(const PosVelAtt& posVelAtt, const InsTime& insTime)
+{
+    LOG_DEBUG("{}: Initializing the smoother at time [{}]", nameId(), insTime.toYMDHMS());
+
+    SlidingWindowSmoother::NavState state;
+    state.insTime = insTime;
+    state.e_Quat_b = posVelAtt.e_Quat_b();
+    state.e_velocity = posVelAtt.e_velocity();
+    state.e_position = posVelAtt.e_position();
+
+    SlidingWindowSmoother::StateVector variances;
+    for (size_t i = 0; i < _initialStdev.size(); i++)
+    {
+        variances.segment<3>(3 * static_cast<Eigen::Index>(i)).setConstant(std::pow(_initialStdev.at(i), 2));
+    }
+    _smoother.initialize(state, variances.asDiagonal());
+    _preintegrator.reset();
+    _lastIntegrationTime = insTime;
+}
+
+void NAV::FixedLagSmoother::recvImuObs(InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto imuObs = std::static_pointer_cast<const ImuObs>(queue.extract_front());
+    LOG_DATA("{}: recvImuObs at time [{}]", nameId(), imuObs->insTime.toYMDHMS());
+
+    if (_posVelAttInit != nullptr)
+    {
+        initializeSmoother(*_posVelAttInit, imuObs->insTime);
+        _posVelAttInit = nullptr;
+    }
+    else if (!_smoother.empty())
+    {
+        integrateLatestImuObs(imuObs->insTime);
+    }
+    _latestImuObs = imuObs;
+}
+
+void NAV::FixedLagSmoother::recvGnssNavigationSolution(InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto gnssMeasurement = std::static_pointer_cast<const PosVel>(queue.extract_front());
+    LOG_DATA("{}: recvGnssNavigationSolution at time [{}]", nameId(), gnssMeasurement->insTime.toYMDHMS());
+
+    if (_smoother.empty() || _latestImuObs == nullptr) { return; }
+
+    integrateLatestImuObs(gnssMeasurement->insTime);
+    if (_preintegrator.empty()) { return; }
+
+    _smoother.addImuFactor(_preintegrator, gnssMeasurement->insTime);
+
+    Eigen::Matrix3d e_Dcm_n = trafo::e_Quat_n(gnssMeasurement->lla_position()(0), gnssMeasurement->lla_position()(1)).toRotationMatrix();
+    _smoother.addPositionMeasurement(gnssMeasurement->e_position(),
+                                     e_Dcm_n * _gnssStdevPosition.array().square().matrix().asDiagonal() * e_Dcm_n.transpose(),
+                                     _b_leverArm_InsGnss);
+    if (_useGnssVelocity)
+    {
+        _smoother.addVelocityMeasurement(gnssMeasurement->e_velocity(),
+                                         e_Dcm_n * _gnssStdevVelocity.array().square().matrix().asDiagonal() * e_Dcm_n.transpose());
+    }
+
+    [[maybe_unused]] size_t iterations = _smoother.optimize();
+    LOG_DATA("{}: Optimized {} states in {} iterations", nameId(), _smoother.size(), iterations);
+
+    // The next interval is preintegrated with the newest bias estimate
+    _preintegrator.reset(_smoother.latest().b_biasAccel, _smoother.latest().b_biasGyro);
+
+    auto marginalized = _smoother.marginalize();
+    if (_outputMode == OutputMode::RealTime)
+    {
+        sendState(_smoother.latest());
+        return;
+    }
+
+    for (const auto& state : marginalized)
+    {
+        sendState(state);
+    }
+    if (queue.empty() && inputPins[INPUT_PORT_INDEX_GNSS].link.getConnectedPin()->noMoreDataAvailable)
+    {
+        // No more GNSS data, so the remaining window is already the final solution
+        for (const auto& state : _smoother.states())
+        {
+            sendState(state);
+        }
+    }
+}
+
+void NAV::FixedLagSmoother::integrateLatestImuObs(const InsTime& insTime)
+{
+    if (_latestImuObs == nullptr || _lastIntegrationTime.empty()) { return; }
+
+    auto dt = static_cast<double>((insTime - _lastIntegrationTime).count());
+    if (dt <= 0.0) { return; }
+
+    if (!_latestImuObs->accelUncompXYZ.has_value() || !_latestImuObs->gyroUncompXYZ.has_value())
+    {
+        LOG_WARN("{}: IMU observation at [{}] has no uncompensated measurements and is skipped.", nameId(), _latestImuObs->insTime.toYMDHMS());
+        _lastIntegrationTime = insTime;
+        return;
+    }
+    Eigen::Vector3d b_acceleration = _latestImuObs->imuPos.b_quatAccel_p() * _latestImuObs->accelUncompXYZ.value();
+    Eigen::Vector3d b_omega_ib = _latestImuObs->imuPos.b_quatGyro_p() * _latestImuObs->gyroUncompXYZ.value();
+
+    _preintegrator.integrate(b_acceleration, b_omega_ib, dt);
+    _lastIntegrationTime = insTime;
+}
+
+void NAV::FixedLagSmoother::sendState(const SlidingWindowSmoother::NavState& state)
+{
+    auto inertialNavSol = std::make_shared<InertialNavSol>();
+    inertialNavSol->insTime = state.insTime;
+    inertialNavSol->setState_e(state.e_position, state.e_velocity, state.e_Quat_b);
+
+    invokeCallbacks(OUTPUT_PORT_INDEX_SOLUTION, inertialNavSol);
+}
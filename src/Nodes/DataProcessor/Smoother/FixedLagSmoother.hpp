@@ -0,0 +1,156 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FixedLagSmoother.hpp
+/// @brief Fixed-lag sliding window smoother for the loosely coupled INS/GNSS integration
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+
+#include "internal/Node/Node.hpp"
+#include "Navigation/INS/Preintegration.hpp"
+#include "Navigation/INS/SlidingWindowSmoother.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "NodeData/IMU/ImuObs.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+
+namespace NAV
+{
+/// @brief Sliding window smoother over preintegrated IMU measurements and GNSS position/velocity solutions
+class FixedLagSmoother : public Node
+{
+  public:
+    /// @brief Default constructor
+    FixedLagSmoother();
+    /// @brief Destructor
+    ~FixedLagSmoother() override;
+    /// @brief Copy constructor
+    FixedLagSmoother(const FixedLagSmoother&) = delete;
+    /// @brief Move constructor
+    FixedLagSmoother(FixedLagSmoother&&) = delete;
+    /// @brief Copy assignment operator
+    FixedLagSmoother& operator=(const FixedLagSmoother&) = delete;
+    /// @brief Move assignment operator
+    FixedLagSmoother& operator=(FixedLagSmoother&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_IMU_OBS = 0;          ///< @brief Flow (ImuObs)
+    constexpr static size_t INPUT_PORT_INDEX_GNSS = 1;             ///< @brief Flow (PosVel)
+    constexpr static size_t INPUT_PORT_INDEX_POS_VEL_ATT_INIT = 2; ///< @brief Flow (PosVelAtt)
+    constexpr static size_t OUTPUT_PORT_INDEX_SOLUTION = 0;        ///< @brief Flow (PosVelAtt)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Receive Function for the IMU observations
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvImuObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Receive Function for the GNSS navigation solution
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvGnssNavigationSolution(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Receive Function for the initial position, velocity and attitude
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void recvPosVelAttInit(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Starts the window with the initial state
+    /// @param[in] posVelAtt Initial position, velocity and attitude
+    /// @param[in] insTime Time of the initial state
+    void initializeSmoother(const PosVelAtt& posVelAtt, const InsTime& insTime);
+
+    /// @brief Integrates the latest IMU observation up to the given time
+    /// @param[in] insTime Time to integrate to
+    void integrateLatestImuObs(const InsTime& insTime);
+
+    /// @brief Sends the state to the output pin
+    /// @param[in] state State to send
+    void sendState(const SlidingWindowSmoother::NavState& state);
+
+    /// Smoother over the sliding window
+    SlidingWindowSmoother _smoother;
+
+    /// IMU measurements preintegrated since the latest state in the window
+    ImuPreintegrator _preintegrator;
+
+    /// Latest IMU observation, which is held constant until the next one arrives
+    std::shared_ptr<const ImuObs> _latestImuObs = nullptr;
+
+    /// Initial state without a time, which is used as soon as the first IMU observation arrives
+    std::shared_ptr<const PosVelAtt> _posVelAttInit = nullptr;
+
+    /// Time up to which the IMU observations are integrated
+    InsTime _lastIntegrationTime;
+
+    // #########################################################################################################################################
+    //                                                              GUI settings
+    // #########################################################################################################################################
+
+    /// @brief Output modes of the node
+    enum class OutputMode : int
+    {
+        RealTime, ///< Output the latest state after every GNSS epoch (bounded latency)
+        FixedLag, ///< Output every state when it leaves the window (smoothed with the window length as latency)
+    };
+    /// Output mode of the node
+    OutputMode _outputMode = OutputMode::FixedLag;
+
+    /// Parameters of the smoother
+    SlidingWindowSmoother::Parameters _parameters;
+
+    /// Also add the GNSS velocity as measurement
+    bool _useGnssVelocity = true;
+
+    /// Lever arm between INS and GNSS in [m, m, m], in body coordinates
+    Eigen::Vector3d _b_leverArm_InsGnss{ 0.0, 0.0, 0.0 };
+
+    /// Standard deviation of the accelerometer white noise in [m / (s^2 · √(Hz))]
+    Eigen::Vector3d _stdev_ra = 0.04 * Eigen::Vector3d::Ones();
+    /// Standard deviation of the gyroscope white noise in [rad / (s · √(Hz))]
+    Eigen::Vector3d _stdev_rg = 5e-4 * Eigen::Vector3d::Ones();
+
+    /// Standard deviation of the accelerometer bias random walk in [m / (s^2 · √(s))]
+    Eigen::Vector3d _stdev_bad = 1e-4 * Eigen::Vector3d::Ones();
+    /// Standard deviation of the gyroscope bias random walk in [rad / (s · √(s))]
+    Eigen::Vector3d _stdev_bgd = 1e-6 * Eigen::Vector3d::Ones();
+
+    /// Standard deviation of the GNSS position in [m]
+    Eigen::Vector3d _gnssStdevPosition{ 0.3, 0.3, 0.3 };
+    /// Standard deviation of the GNSS velocity in [m/s]
+    Eigen::Vector3d _gnssStdevVelocity{ 0.5, 0.5, 0.5 };
+
+    /// Standard deviation of the initial state [attitude in rad, velocity in m/s, position in m, accel bias in m/s², gyro bias in rad/s]
+    std::array<double, 5> _initialStdev{ 0.1, 1.0, 5.0, 0.1, 1e-3 };
+};
+
+} // namespace NAV
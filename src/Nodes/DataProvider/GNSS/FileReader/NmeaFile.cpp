@@ -12,7 +12,6 @@
 #include "Navigation/Transformations/CoordinateFrames.hpp"
 #include "Navigation/Transformations/Units.hpp"
 #include "util/Time/TimeBase.hpp"
-#include "util/StringUtil.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
@@ -112,93 +111,60 @@ bool NAV::NmeaFile::resetNode()
     return true;
 }
 
-bool NAV::NmeaFile::setDateFromZDA(const std::string& line)
+bool NAV::NmeaFile::setDateFromZDA(const ascii::Fields<>& fields)
 {
     // decode ZDA string according to http://www.nmea.de/nmea0183datensaetze.html#zda
 
     //   0    1         2  3  4    5  6
     //   |    |         |  |  |    |  |
     // $--ZDA,hhmmss.ss,xx,xx,xxxx,xx,xx*hh<CR><LF>
-    std::vector<std::string> splittedString = str::split(line, ",");
-    if (splittedString.size() == 7)
-    {
-        std::size_t pos_star = splittedString.back().find('*');
-        if (pos_star != std::string::npos)
-        {
-            int64_t crc = std::strtol(splittedString[6].substr(pos_star + 1).c_str(), nullptr, 16);
-            // checksum calculation similar to https://gist.github.com/devendranaga/fce8e166f4335fa777650493cb9246db
-            int64_t mycrc = 0;
-            pos_star = line.find('*');
-            for (unsigned int i = 1; i < pos_star; i++)
-            {
-                mycrc ^= line.at(i);
-            }
-            if (mycrc == crc)
-            {
-                _currentDate.day = std::stoi(splittedString[2]);
-                _currentDate.month = std::stoi(splittedString[3]);
-                _currentDate.year = std::stoi(splittedString[4]);
+    if (fields.size() != 7) { return false; }
 
-                _hasValidDate = true;
-                return true;
-            }
-        }
-    }
-    return false;
+    auto day = ascii::parse<int>(fields[2]);
+    auto month = ascii::parse<int>(fields[3]);
+    auto year = ascii::parse<int>(fields[4]);
+    if (!day || !month || !year) { return false; }
+
+    _currentDate.day = *day;
+    _currentDate.month = *month;
+    _currentDate.year = *year;
+
+    _hasValidDate = true;
+    return true;
 }
 
-bool NAV::NmeaFile::setDateFromRMC(const std::string& line)
+bool NAV::NmeaFile::setDateFromRMC(const ascii::Fields<>& fields)
 {
     // decode RMC string according to http://www.nmea.de/nmea0183datensaetze.html#rmc
 
     //   0    1         2 3       4 5        6 7   8   9    10  11
     //   |    |         | |       | |        | |   |   |    |   |
     // $--RMC,hhmmss.ss,A,llll.ll,a,yyyyy.yy,a,x.x,x.x,xxxx,x.x,a*hh<CR><LF>
-    std::vector<std::string> splittedString = str::split(line, ",");
-    if (splittedString.size() == 12)
+    if (fields.size() != 12 || fields[9].size() != 6) { return false; }
+
+    auto day = ascii::parse<int>(fields[9].substr(0, 2));
+    auto month = ascii::parse<int>(fields[9].substr(2, 2));
+    auto year = ascii::parse<int>(fields[9].substr(4, 2));
+    if (!day || !month || !year) { return false; }
+
+    _currentDate.day = *day;
+    _currentDate.month = *month;
+    _currentDate.year = *year;
+    if (_currentDate.year > 60)
     {
-        std::size_t pos_star = splittedString[11].find('*');
-        if (pos_star != std::string::npos)
-        {
-            int64_t crc = std::strtol(splittedString[11].substr(pos_star + 1).c_str(), nullptr, 16);
-            // checksum calculation similar to https://gist.github.com/devendranaga/fce8e166f4335fa777650493cb9246db
-            int64_t mycrc = 0;
-            pos_star = line.find('*');
-            for (unsigned int i = 1; i < pos_star; i++)
-            {
-                mycrc ^= line.at(i);
-            }
-            if (mycrc == crc)
-            {
-                _currentDate.day = std::stoi(splittedString[9].substr(0, 2));
-                _currentDate.month = std::stoi(splittedString[9].substr(2, 2));
-                _currentDate.year = std::stoi(splittedString[9].substr(4, 2));
-                if (_currentDate.year > 60)
-                {
-                    _currentDate.year += 1900;
-                }
-                else
-                {
-                    _currentDate.year += 2000;
-                }
-
-                _hasValidDate = true;
-                return true;
-            }
-        }
+        _currentDate.year += 1900;
+    }
+    else
+    {
+        _currentDate.year += 2000;
     }
-    return false;
+
+    _hasValidDate = true;
+    return true;
 }
 
 std::shared_ptr<const NAV::NodeData> NAV::NmeaFile::pollData()
 {
-    auto obs = std::make_shared<PosVel>();
-
-    // Read line
-    std::string line;
-
-    std::vector<std::string> splittedData;
-
     int hour = 0;
     int minute = 0;
     double second = 0.0;
@@ -209,7 +175,7 @@ std::shared_ptr<const NAV::NodeData> NAV::NmeaFile::pollData()
 
     while (true)
     {
-        getline(line);
+        getline(_line);
 
         if (eof())
         {
@@ -217,89 +183,81 @@ std::shared_ptr<const NAV::NodeData> NAV::NmeaFile::pollData()
         }
 
         // Remove any starting non text characters
-        line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](int ch) { return std::isgraph(ch); }));
+        auto payload = ascii::nmea::validate(ascii::trimLeadingNonPrintable(_line));
+        if (!payload) { continue; }
 
-        splittedData = str::split(line, ",");
+        ascii::Fields<> fields(*payload, ',');
+        auto sentenceFormatter = ascii::nmea::sentenceFormatter(fields[0]);
 
-        if (splittedData[0].substr(0, 1) == "$")
+        if (_hasValidDate && sentenceFormatter == "GGA")
         {
-            if (_hasValidDate && splittedData[0].substr(3, 3) == "GGA")
+            // decode GGA stream according to http://www.nmea.de/nmea0183datensaetze.html#gga
+
+            //   0    1         2       3 4        5 6 7  8   9  10 11 12 13  14
+            //   |    |         |       | |        | | |  |   |   |  |  | |   |
+            // $--GGA,hhmmss.ss,llll.ll,a,yyyyy.yy,a,x,xx,x.x,x.x,M,x.x,M,x.x,xxxx*hh<CR><LF>
+            if (fields.size() != 15 || fields[1].size() < 6 || fields[2].size() < 3 || fields[4].size() < 4) { continue; }
+
+            auto hh = ascii::parse<int>(fields[1].substr(0, 2));
+            auto mm = ascii::parse<int>(fields[1].substr(2, 2));
+            auto ss = ascii::parse<double>(fields[1].substr(4));
+            auto lat1 = ascii::parse<double>(fields[2].substr(0, 2));
+            auto lat2 = ascii::parse<double>(fields[2].substr(2));
+            auto lon1 = ascii::parse<int>(fields[4].substr(0, 3));
+            auto lon2 = ascii::parse<double>(fields[4].substr(3));
+            auto orthometricHeight = ascii::parse<double>(fields[9]);
+            auto geoidHeight = ascii::parse<double>(fields[11]);
+            if (!hh || !mm || !ss || !lat1 || !lat2 || !lon1 || !lon2 || !orthometricHeight || !geoidHeight) { continue; }
+
+            hour = *hh;
+            minute = *mm;
+            second = *ss;
+            double newSOD = hour * 60.0 * 60.0 + minute * 60.0 + second;
+
+            // only continue if second of day > than previous one
+            if (newSOD < _oldSoD)
             {
-                // decode GGA stream according to http://www.nmea.de/nmea0183datensaetze.html#gga
-
-                //   0    1         2       3 4        5 6 7  8   9  10 11 12 13  14
-                //   |    |         |       | |        | | |  |   |   |  |  | |   |
-                // $--GGA,hhmmss.ss,llll.ll,a,yyyyy.yy,a,x,xx,x.x,x.x,M,x.x,M,x.x,xxxx*hh<CR><LF>
-                if (splittedData.size() != 15) { continue; }
-
-                std::size_t pos_star = splittedData[14].find('*');
-                int64_t crc = std::strtol(splittedData[14].substr(pos_star + 1).c_str(), nullptr, 16);
-                // checksum calculation similar to https://gist.github.com/devendranaga/fce8e166f4335fa777650493cb9246db
-                int64_t mycrc = 0;
-                pos_star = line.find('*');
-                for (unsigned int i = 1; i < pos_star; i++)
-                {
-                    mycrc ^= line.at(i);
-                }
-                if (mycrc == crc)
-                {
-                    hour = std::stoi(splittedData[1].substr(0, 2));
-                    minute = std::stoi(splittedData[1].substr(2, 2));
-                    second = std::stod(splittedData[1].substr(4));
-                    double newSOD = hour * 24 * 60.0 + minute * 60.0 + second;
-
-                    // only continue if second of day > than previous one
-                    if (newSOD < _oldSoD)
-                    {
-                        _oldSoD = newSOD;      // store current second of day for next call of this routine
-                        _hasValidDate = false; // force wait until next ZDA stream
-                        continue;
-                    }
-
-                    double lat1 = std::stod(splittedData[2].substr(0, 2));
-                    double lat2 = std::stod(splittedData[2].substr(2));
-
-                    lat_rad = (lat1 + lat2 / 60.0) / 180.0 * M_PI; // convert to radian
-
-                    if (splittedData[3] == "S") // flip sign if south latitude
-                    {
-                        lat_rad *= -1.0;
-                    }
-
-                    double lon1 = std::stoi(splittedData[4].substr(0, 3));
-                    double lon2 = std::stod(splittedData[4].substr(3));
-
-                    lon_rad = (lon1 + lon2 / 60.0) / 180.0 * M_PI; // convert to radian
-
-                    if (splittedData[5] == "W") // flip sign if west longitude
-                    {
-                        lon_rad *= -1.0;
-                    }
-
-                    hgt = std::stod(splittedData[9]) + std::stod(splittedData[11]); // ellipsoidal height = height above geoid + geoid height
-
-                    break;
-                }
+                _oldSoD = newSOD;      // store current second of day for next call of this routine
+                _hasValidDate = false; // force wait until next ZDA stream
+                continue;
             }
-            else if (splittedData[0].substr(3, 3) == "ZDA")
+
+            lat_rad = (*lat1 + *lat2 / 60.0) / 180.0 * M_PI; // convert to radian
+
+            if (fields[3] == "S") // flip sign if south latitude
             {
-                if (setDateFromZDA(line))
-                {
-                    _oldSoD = -1;
-                }
-                continue;
+                lat_rad *= -1.0;
             }
-            else if (splittedData[0].substr(3, 3) == "RMC")
+
+            lon_rad = (*lon1 + *lon2 / 60.0) / 180.0 * M_PI; // convert to radian
+
+            if (fields[5] == "W") // flip sign if west longitude
             {
-                if (setDateFromRMC(line))
-                {
-                    _oldSoD = -1;
-                }
-                continue;
+                lon_rad *= -1.0;
+            }
+
+            hgt = *orthometricHeight + *geoidHeight; // ellipsoidal height = height above geoid + geoid height
+
+            break;
+        }
+        if (sentenceFormatter == "ZDA")
+        {
+            if (setDateFromZDA(fields))
+            {
+                _oldSoD = -1;
+            }
+        }
+        else if (sentenceFormatter == "RMC")
+        {
+            if (setDateFromRMC(fields))
+            {
+                _oldSoD = -1;
             }
         }
     }
 
+    auto obs = std::make_shared<PosVel>();
+
     Eigen::Vector3d lla_pos{ lat_rad, lon_rad, hgt };
     Eigen::Vector3d n_vel{ std::nan(""), std::nan(""), std::nan("") }; // GGA streams don't contain velocity, thus set this one invalid
     obs->insTime = InsTime(_currentDate.year, _currentDate.month, _currentDate.day,
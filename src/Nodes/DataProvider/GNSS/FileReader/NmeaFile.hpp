@@ -13,8 +13,11 @@
 
 #pragma once
 
+#include <string>
+
 #include "internal/Node/Node.hpp"
 #include "Nodes/DataProvider/Protocol/FileReader.hpp"
+#include "util/Parsing/AsciiSentence.hpp"
 
 namespace NAV
 {
@@ -92,15 +95,18 @@ class NmeaFile : public Node, public FileReader
         int day = 0;   ///< Day 01 to 31
     } _currentDate;
 
+    /// @brief Buffer for the read lines (reused to avoid allocations)
+    std::string _line;
+
     /// @brief Set date info from ZDA steam
-    /// @param[in] line Line that contains a potential $--ZDA stream
+    /// @param[in] fields Fields of a checksum validated $--ZDA stream
     /// @return True if the $--ZDA stream was read successfully
-    bool setDateFromZDA(const std::string& line);
+    bool setDateFromZDA(const ascii::Fields<>& fields);
 
     /// @brief Set date info from RMC steam
-    /// @param[in] line Line that contains a potential $--RMC stream
+    /// @param[in] fields Fields of a checksum validated $--RMC stream
     /// @return True if the $--RMC stream was read successfully
-    bool setDateFromRMC(const std::string& line);
+    bool setDateFromRMC(const ascii::Fields<>& fields);
 };
 
 } // namespace NAV
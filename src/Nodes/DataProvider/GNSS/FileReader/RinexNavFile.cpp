@@ -117,6 +117,7 @@ bool RinexNavFile::initialize()
     }
 
     readOrbits();
+    _gnssNavInfo.publish(); // Data from the file is known from the start
 
     return true;
 }
@@ -668,7 +669,7 @@ void RinexNavFile::readOrbits()
                     if (_gnssNavInfo.satellites().contains({ satSys, satNum }) // We have this satellite already
                         && !std::bitset<10>(codesOnL2Channel_dataSources)[0])  // This message is not 'I/NAV E1-B'
                     {
-                        const auto& navData = _gnssNavInfo.satellites().at({ satSys, satNum }).getNavigationData();
+                        const auto& navData = _gnssNavInfo.satellites().at({ satSys, satNum })->getNavigationData();
                         auto existingEph = std::find_if(navData.begin(), navData.end(),
                                                         [&](const std::shared_ptr<SatNavData>& satNavData) {
                                                             return satNavData->type == SatNavData::GalileoEphemeris && satNavData->refTime == epoch
@@ -127,6 +127,7 @@ void RinexObsFile::deinitialize()
     _timeSystem = TimeSys_None;
     _obsDescription.clear();
     _rcvClockOffsAppl = false;
+    _receiverClockOffset.reset();
 }
 
 bool RinexObsFile::resetNode()
@@ -134,10 +135,22 @@ bool RinexObsFile::resetNode()
     LOG_TRACE("{}: called", nameId());
 
     FileReader::resetReader();
+    _receiverClockOffset.reset();
 
     return true;
 }
 
+bool RinexObsFile::openFile(const std::filesystem::path& path)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    // FileReader::initialize only resets the stream, so the header of a previously opened file has to be forgotten here
+    deinitialize();
+
+    _path = path.string();
+    return initialize();
+}
+
 FileReader::FileType RinexObsFile::determineFileType()
 {
     auto extHeaderLabel = [](std::string line) {
@@ -511,6 +524,16 @@ void RinexObsFile::readHeader()
 }
 
 std::shared_ptr<const NodeData> RinexObsFile::pollData()
+{
+    auto gnssObs = readEpoch();
+    if (gnssObs)
+    {
+        invokeCallbacks(OUTPUT_PORT_INDEX_GNSS_OBS, gnssObs);
+    }
+    return gnssObs;
+}
+
+std::shared_ptr<GnssObs> RinexObsFile::readEpoch()
 {
     std::string line;
 
@@ -535,10 +558,15 @@ std::shared_ptr<const NodeData> RinexObsFile::pollData()
             auto min = std::stoi(line.substr(16, 2));   // Format: 1X,I2.2,
             auto sec = std::stold(line.substr(18, 11)); // Format: F11.7,
 
-            [[maybe_unused]] double recClkOffset = 0.0;
+            double recClkOffset = 0.0;
+            _receiverClockOffset.reset();
             try
             {
-                recClkOffset = line.size() >= 41 + 3 ? std::stod(line.substr(41, 15)) : 0.0; // Format: F15.12
+                if (line.size() >= 41 + 3)
+                {
+                    recClkOffset = std::stod(line.substr(41, 15)); // Format: F15.12
+                    _receiverClockOffset = recClkOffset;
+                }
             }
             catch (const std::exception& /* exception */)
             {
@@ -715,7 +743,6 @@ std::shared_ptr<const NodeData> RinexObsFile::pollData()
         }
     }
 
-    invokeCallbacks(OUTPUT_PORT_INDEX_GNSS_OBS, gnssObs);
     return gnssObs;
 }
 
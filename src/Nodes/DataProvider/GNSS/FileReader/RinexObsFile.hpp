@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <filesystem>
+#include <optional>
 #include <set>
 #include <unordered_map>
 
@@ -69,6 +71,18 @@ class RinexObsFile : public Node, public FileReader
     /// @brief Resets the node. Moves the read cursor to the start
     bool resetNode() override;
 
+    /// @brief Opens a file outside of a flow, so that it can be read with readEpoch()
+    /// @param[in] path Path of the file. Relative paths are searched inside the input path of the flow.
+    /// @return True if the file could be opened and its header was read
+    bool openFile(const std::filesystem::path& path);
+
+    /// @brief Reads the next epoch of the file without passing it on to connected nodes
+    /// @return The read observation or nullptr at the end of the file
+    [[nodiscard]] std::shared_ptr<GnssObs> readEpoch();
+
+    /// @brief Receiver clock offset of the last read epoch [s], if given in the file
+    [[nodiscard]] std::optional<double> receiverClockOffset() const { return _receiverClockOffset; }
+
   private:
     constexpr static size_t OUTPUT_PORT_INDEX_GNSS_OBS = 0; ///< @brief Flow (GnssObs)
 
@@ -104,6 +118,9 @@ class RinexObsFile : public Node, public FileReader
     /// @brief Receiver clock offset app
     bool _rcvClockOffsAppl = false;
 
+    /// @brief Receiver clock offset of the last read epoch [s]
+    std::optional<double> _receiverClockOffset;
+
     /// @brief Whether to remove less precise codes (e.g. if G1X (L1C combined) is present, don't use G1L (L1C pilot) and G1S (L1C data))
     bool _eraseLessPreciseCodes = true;
 
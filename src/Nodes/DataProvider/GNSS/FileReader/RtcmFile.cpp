@@ -0,0 +1,290 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RtcmFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <span>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+RtcmFile::RtcmFile()
+    : Node(typeStatic()), _decoder(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 380, 120 };
+
+    nm::CreateOutputPin(this, "GnssObs", Pin::Type::Flow, { NAV::GnssObs::type() }, &RtcmFile::pollData);
+    nm::CreateOutputPin(this, GnssNavInfo::type().c_str(), Pin::Type::Object, { GnssNavInfo::type() }, &_gnssNavInfo);
+}
+
+RtcmFile::~RtcmFile()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string RtcmFile::typeStatic()
+{
+    return "RtcmFile";
+}
+
+std::string RtcmFile::type() const
+{
+    return typeStatic();
+}
+
+std::string RtcmFile::category()
+{
+    return "Data Provider";
+}
+
+void RtcmFile::guiConfig()
+{
+    if (auto res = FileReader::guiConfig("RTCM 3 (.rtcm3 .rtcm .rtc){.rtcm3,.rtcm,.rtc},.*", { ".rtcm3", ".rtcm", ".rtc" }, size_t(id), nameId()))
+    {
+        LOG_DEBUG("{}: Path changed to {}", nameId(), _path);
+        flow::ApplyChanges();
+        if (res == FileReader::PATH_CHANGED)
+        {
+            doReinitialize();
+        }
+        else
+        {
+            doDeinitialize();
+        }
+    }
+
+    if (ImGui::Checkbox(fmt::format("Select station##{}", size_t(id)).c_str(), &_selectStation))
+    {
+        LOG_DEBUG("{}: Select station changed to {}", nameId(), _selectStation);
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Recordings can contain the observations of several reference stations.\n"
+                             "Without selection, the observations of the first station in the file are read.");
+    if (_selectStation)
+    {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100.0F);
+        if (ImGui::InputIntL(fmt::format("Station ID##{}", size_t(id)).c_str(), &_stationId, 0, 4095))
+        {
+            LOG_DEBUG("{}: Station ID changed to {}", nameId(), _stationId);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+}
+
+[[nodiscard]] json RtcmFile::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileReader"] = FileReader::save();
+    j["selectStation"] = _selectStation;
+    j["stationId"] = _stationId;
+
+    return j;
+}
+
+void RtcmFile::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileReader"))
+    {
+        FileReader::restore(j.at("FileReader"));
+    }
+    if (j.contains("selectStation"))
+    {
+        j.at("selectStation").get_to(_selectStation);
+    }
+    if (j.contains("stationId"))
+    {
+        j.at("stationId").get_to(_stationId);
+    }
+}
+
+bool RtcmFile::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _referenceTime.reset();
+
+    if (!FileReader::initialize())
+    {
+        return false;
+    }
+
+    return determineReferenceTime();
+}
+
+void RtcmFile::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    FileReader::deinitialize();
+    _epochs.clear();
+    _navData.clear();
+    _gnssNavInfo.setComplete();
+}
+
+bool RtcmFile::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    FileReader::resetReader();
+
+    _decoder.setStationId(_selectStation ? std::make_optional(static_cast<uint16_t>(_stationId)) : std::nullopt);
+    _decoder.reset();
+    _decoder.setReferenceTime(_referenceTime);
+    _decoder.setObsHandler([this](const std::shared_ptr<GnssObs>& gnssObs) { _epochs.push_back(gnssObs); });
+    _decoder.setNavHandler([this](const SatId& satId, const std::shared_ptr<SatNavData>& satNavData) {
+        _navData.push_back(ReceivedNavData{ .receiveTime = _decoder.referenceTime(), .satId = satId, .satNavData = satNavData });
+    });
+    _chunk.resize(CHUNK_SIZE);
+    _epochs.clear();
+    _navData.clear();
+
+    {
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        _gnssNavInfo.reset();
+        // Consumers wait till the file was read up to their time
+        _gnssNavInfo.setKnownUntil(InsTime{});
+    }
+
+    return true;
+}
+
+FileReader::FileType RtcmFile::determineFileType()
+{
+    LOG_TRACE("called for {}", nameId());
+
+    auto filestream = std::ifstream(getFilepath(), std::ios_base::binary);
+    if (!filestream.good())
+    {
+        LOG_ERROR("{}: Could not open file {}", nameId(), getFilepath());
+        return FileType::NONE;
+    }
+
+    // Recordings can start within a frame, so the first bytes are searched for the preamble
+    std::array<char, 4096> buffer{};
+    filestream.read(buffer.data(), buffer.size());
+    if (std::find(buffer.begin(), buffer.begin() + filestream.gcount(), static_cast<char>(vendor::rtcm::PREAMBLE)) == buffer.begin() + filestream.gcount())
+    {
+        LOG_ERROR("{}: Not a valid RTCM 3 file {}", nameId(), getFilepath());
+        return FileType::NONE;
+    }
+    return FileType::BINARY;
+}
+
+bool RtcmFile::determineReferenceTime()
+{
+    // The Galileo and BeiDou ephemerides contain the week number
+    vendor::rtcm::RtcmDecoder decoder(nameId());
+    decoder.setNavHandler([](const SatId& /* satId */, const std::shared_ptr<SatNavData>& /* satNavData */) {});
+
+    std::vector<uint8_t> chunk(CHUNK_SIZE);
+    while (decoder.referenceTime().empty() && !eof())
+    {
+        auto nBytes = read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size())).gcount();
+        decoder.feed(std::span(chunk).first(static_cast<size_t>(nBytes)));
+    }
+    FileReader::resetReader();
+
+    if (!decoder.referenceTime().empty())
+    {
+        _referenceTime = decoder.referenceTime();
+        LOG_DEBUG("{}: Taking the week from the ephemerides [{}]", nameId(), _referenceTime.toYMDHMS(GPST));
+        return true;
+    }
+
+    // Recordings of GPS and GLONASS only are resolved with the modification time of the file
+    try
+    {
+        auto fileTime = std::chrono::file_clock::to_sys(std::filesystem::last_write_time(getFilepath()));
+        std::time_t time = std::chrono::system_clock::to_time_t(std::chrono::time_point_cast<std::chrono::system_clock::duration>(fileTime));
+        std::tm* t = std::gmtime(&time); // NOLINT(concurrency-mt-unsafe)
+        _referenceTime = InsTime(t->tm_year + 1900, t->tm_mon + 1, t->tm_mday, t->tm_hour, t->tm_min, t->tm_sec, UTC);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: The file contains no Galileo or BeiDou ephemerides and its modification time could not be read: {}", nameId(), e.what());
+        return false;
+    }
+    LOG_WARN("{}: The file contains no Galileo or BeiDou ephemerides, which provide the week number. "
+             "Assuming that the data was recorded within half a week before the modification time of the file [{}].",
+             nameId(), _referenceTime.toYMDHMS(GPST));
+    return true;
+}
+
+std::shared_ptr<const NodeData> RtcmFile::pollData()
+{
+    while (_epochs.empty() && !eof())
+    {
+        auto nBytes = read(reinterpret_cast<char*>(_chunk.data()), static_cast<std::streamsize>(_chunk.size())).gcount();
+        _decoder.feed(std::span(_chunk).first(static_cast<size_t>(nBytes)));
+    }
+    if (_epochs.empty()) { _decoder.flush(); }
+
+    std::shared_ptr<GnssObs> gnssObs;
+    {
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        if (!_epochs.empty())
+        {
+            gnssObs = _epochs.front();
+            _epochs.pop_front();
+        }
+
+        // Navigation data received before the epoch is known at the epoch
+        bool published = false;
+        while (!_navData.empty() && (!gnssObs || _navData.front().receiveTime < gnssObs->insTime))
+        {
+            const auto& navData = _navData.front();
+            published |= _gnssNavInfo.addSatelliteNavData(navData.satId, navData.satNavData);
+            _gnssNavInfo.satelliteSystems |= navData.satId.satSys;
+            _navData.pop_front();
+        }
+        if (published) { _gnssNavInfo.publish(gnssObs ? gnssObs->insTime : _decoder.referenceTime()); }
+
+        if (!gnssObs)
+        {
+            [[maybe_unused]] const auto& statistics = _decoder.statistics();
+            LOG_DEBUG("{}: End of file reached. Decoded {} epochs and {} navigation data sets from {} frames ({} with checksum errors, {} discarded).",
+                      nameId(), statistics.epochs, statistics.navData, statistics.frames, statistics.crcErrors, statistics.discarded);
+            _gnssNavInfo.setComplete();
+            return nullptr;
+        }
+        _gnssNavInfo.setKnownUntil(gnssObs->insTime);
+    }
+
+    LOG_DATA("{}: [{}] Epoch with {} observations", nameId(), gnssObs->insTime.toYMDHMS(GPST), gnssObs->data.size());
+
+    invokeCallbacks(OUTPUT_PORT_INDEX_GNSS_OBS, gnssObs);
+    return gnssObs;
+}
+
+} // namespace NAV
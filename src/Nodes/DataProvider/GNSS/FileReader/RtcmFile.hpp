@@ -0,0 +1,123 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtcmFile.hpp
+/// @brief File reader for recorded RTCM 3 streams
+/// @date 2026-10-18
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/FileReader.hpp"
+
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "util/Vendor/RTCM/RtcmDecoder.hpp"
+
+namespace NAV
+{
+/// File reader Node for recorded RTCM 3 streams
+///
+/// Provides the MSM observations of one reference station as GnssObs and the broadcast ephemerides as GnssNavInfo.
+/// Ephemerides are published at the time of the next observation epoch, so consumers only use data which was received.
+class RtcmFile : public Node, public FileReader
+{
+  public:
+    /// @brief Default constructor
+    RtcmFile();
+    /// @brief Destructor
+    ~RtcmFile() override;
+    /// @brief Copy constructor
+    RtcmFile(const RtcmFile&) = delete;
+    /// @brief Move constructor
+    RtcmFile(RtcmFile&&) = delete;
+    /// @brief Copy assignment operator
+    RtcmFile& operator=(const RtcmFile&) = delete;
+    /// @brief Move assignment operator
+    RtcmFile& operator=(RtcmFile&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node. Moves the read cursor to the start
+    bool resetNode() override;
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_GNSS_OBS = 0;       ///< @brief Flow (GnssObs)
+    constexpr static size_t OUTPUT_PORT_INDEX_GNSS_NAV_INFO = 1; ///< @brief Object (GnssNavInfo)
+
+    /// Size of the chunks read from the file [bytes]
+    constexpr static size_t CHUNK_SIZE = 65536;
+
+    /// @brief Navigation data which was decoded but not published yet
+    struct ReceivedNavData
+    {
+        InsTime receiveTime;                    ///< Time of the last observation epoch before the data
+        SatId satId;                            ///< Satellite identifier
+        std::shared_ptr<SatNavData> satNavData; ///< Navigation data
+    };
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Determines the type of the file
+    /// @return The File Type
+    [[nodiscard]] FileType determineFileType() override;
+
+    /// @brief Determines the approximate time of the recording to resolve the time of week of the messages
+    /// @return False if no time could be determined
+    bool determineReferenceTime();
+
+    /// @brief Polls the next observation epoch from the file
+    /// @return The observation epoch or nullptr at the end of the file
+    [[nodiscard]] std::shared_ptr<const NodeData> pollData();
+
+    /// @brief Whether only the observations of the station with the ID _stationId are read
+    bool _selectStation = false;
+    /// @brief Station ID of the observations to read
+    int _stationId = 0;
+
+    /// @brief Decoder of the byte stream
+    vendor::rtcm::RtcmDecoder _decoder;
+    /// @brief Approximate time of the recording
+    InsTime _referenceTime;
+    /// @brief Chunk of the file which is decoded
+    std::vector<uint8_t> _chunk;
+    /// @brief Decoded observation epochs which were not polled yet
+    std::deque<std::shared_ptr<GnssObs>> _epochs;
+    /// @brief Decoded navigation data which was not published yet
+    std::deque<ReceivedNavData> _navData;
+
+    /// @brief Data object to share over the output pin
+    GnssNavInfo _gnssNavInfo;
+};
+
+} // namespace NAV
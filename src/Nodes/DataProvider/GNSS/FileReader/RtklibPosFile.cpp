@@ -12,7 +12,7 @@
 #include "Navigation/Transformations/CoordinateFrames.hpp"
 #include "Navigation/Transformations/Units.hpp"
 #include "util/Time/TimeBase.hpp"
-#include "util/StringUtil.hpp"
+#include "util/Parsing/AsciiSentence.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
@@ -183,18 +183,16 @@ std::shared_ptr<const NAV::NodeData> NAV::RtklibPosFile::pollData()
     auto obs = std::make_shared<RtklibPosObs>();
 
     // Read line
-    std::string line;
-    getline(line);
+    getline(_line);
     // Remove any starting non text characters
-    line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](int ch) { return std::isgraph(ch); }));
+    auto line = ascii::trimLeadingNonPrintable(_line);
 
     if (line.empty())
     {
         return nullptr;
     }
 
-    std::istringstream lineStream(line);
-    std::string cell;
+    auto cells = ascii::Fields<64>::splitWhitespace(line);
 
     TimeSystem timeSystem = GPST;
     std::optional<uint16_t> year;
@@ -219,12 +217,14 @@ std::shared_ptr<const NAV::NodeData> NAV::RtklibPosFile::pollData()
 
     try
     {
-        for (const auto& column : _headerColumns)
+        for (size_t c = 0; c < _headerColumns.size(); c++)
         {
-            if (lineStream >> cell)
+            const auto& column = _headerColumns[c];
+            if (c < cells.size())
             {
+                auto cell = cells[c];
                 // Remove any trailing non text characters
-                cell.erase(std::find_if(cell.begin(), cell.end(), [](int ch) { return std::iscntrl(ch); }), cell.end());
+                cell = cell.substr(0, static_cast<size_t>(std::find_if(cell.begin(), cell.end(), [](char ch) { return std::iscntrl(static_cast<unsigned char>(ch)); }) - cell.begin()));
                 if (cell.empty())
                 {
                     continue;
@@ -234,11 +234,11 @@ std::shared_ptr<const NAV::NodeData> NAV::RtklibPosFile::pollData()
                 // 2120 216180.000   XX.XXXXXXXXX    ...
                 if (column == "GpsWeek")
                 {
-                    gpsWeek = static_cast<uint16_t>(std::stoul(cell));
+                    gpsWeek = ascii::to<uint16_t>(cell);
                 }
                 else if (column == "GpsToW")
                 {
-                    gpsToW = std::stold(cell);
+                    gpsToW = ascii::to<long double>(cell);
                 }
                 // %  GPST                  latitude(deg) longitude(deg)  ...
                 // 2020/08/25 12:03:00.000   XX.XXXXXXXXX    ...
@@ -248,184 +248,184 @@ std::shared_ptr<const NAV::NodeData> NAV::RtklibPosFile::pollData()
                 {
                     timeSystem = column.ends_with("-GPST") ? GPST : UTC;
 
-                    auto ymd = str::split(cell, "/");
-                    if (ymd.size() == 3)
+                    ascii::Fields<3> ymd(cell, '/');
+                    if (ymd.size() == 3 && !ymd.truncated())
                     {
-                        year = static_cast<uint16_t>(std::stoi(ymd.at(0)));
-                        month = static_cast<uint16_t>(std::stoi(ymd.at(1)));
-                        day = static_cast<uint16_t>(std::stoi(ymd.at(2)));
+                        year = ascii::to<uint16_t>(ymd[0]);
+                        month = ascii::to<uint16_t>(ymd[1]);
+                        day = ascii::to<uint16_t>(ymd[2]);
                     }
                 }
                 else if (column.starts_with("Time"))
                 {
-                    auto hms = str::split(cell, ":");
-                    if (hms.size() == 3)
+                    ascii::Fields<3> hms(cell, ':');
+                    if (hms.size() == 3 && !hms.truncated())
                     {
-                        hour = static_cast<uint16_t>(std::stoi(hms.at(0)));
+                        hour = ascii::to<uint16_t>(hms[0]);
                         if (column.ends_with("-JST")) { *hour -= 9; }
-                        minute = static_cast<uint16_t>(std::stoi(hms.at(1)));
-                        second = std::stold(hms.at(2));
+                        minute = ascii::to<uint16_t>(hms[1]);
+                        second = ascii::to<long double>(hms[2]);
                     }
                 }
                 else if (column == "x-ecef(m)")
                 {
-                    e_pos.x() = std::stod(cell);
+                    e_pos.x() = ascii::to<double>(cell);
                 }
                 else if (column == "y-ecef(m)")
                 {
-                    e_pos.y() = std::stod(cell);
+                    e_pos.y() = ascii::to<double>(cell);
                 }
                 else if (column == "z-ecef(m)")
                 {
-                    e_pos.z() = std::stod(cell);
+                    e_pos.z() = ascii::to<double>(cell);
                 }
                 else if (column == "latitude(deg)")
                 {
-                    lla_pos(0) = deg2rad(std::stod(cell));
+                    lla_pos(0) = deg2rad(ascii::to<double>(cell));
                 }
                 else if (column == "longitude(deg)")
                 {
-                    lla_pos(1) = deg2rad(std::stod(cell));
+                    lla_pos(1) = deg2rad(ascii::to<double>(cell));
                 }
                 else if (column == "height(m)")
                 {
-                    lla_pos(2) = std::stod(cell);
+                    lla_pos(2) = ascii::to<double>(cell);
                 }
                 else if (column == "Q")
                 {
-                    obs->Q = static_cast<uint8_t>(std::stoul(cell));
+                    obs->Q = static_cast<uint8_t>(ascii::to<unsigned int>(cell));
                 }
                 else if (column == "ns")
                 {
-                    obs->ns = static_cast<uint8_t>(std::stoul(cell));
+                    obs->ns = static_cast<uint8_t>(ascii::to<unsigned int>(cell));
                 }
                 else if (column == "sdx(m)")
                 {
-                    obs->sdXYZ.x() = std::stod(cell);
+                    obs->sdXYZ.x() = ascii::to<double>(cell);
                 }
                 else if (column == "sdy(m)")
                 {
-                    obs->sdXYZ.y() = std::stod(cell);
+                    obs->sdXYZ.y() = ascii::to<double>(cell);
                 }
                 else if (column == "sdz(m)")
                 {
-                    obs->sdXYZ.z() = std::stod(cell);
+                    obs->sdXYZ.z() = ascii::to<double>(cell);
                 }
                 else if (column == "sdn(m)")
                 {
-                    obs->sdNED(0) = std::stod(cell);
+                    obs->sdNED(0) = ascii::to<double>(cell);
                 }
                 else if (column == "sde(m)")
                 {
-                    obs->sdNED(1) = std::stod(cell);
+                    obs->sdNED(1) = ascii::to<double>(cell);
                 }
                 else if (column == "sdu(m)")
                 {
-                    obs->sdNED(2) = std::stod(cell);
+                    obs->sdNED(2) = ascii::to<double>(cell);
                 }
                 else if (column == "sdxy(m)")
                 {
-                    obs->sdxy = std::stod(cell);
+                    obs->sdxy = ascii::to<double>(cell);
                 }
                 else if (column == "sdyz(m)")
                 {
-                    obs->sdyz = std::stod(cell);
+                    obs->sdyz = ascii::to<double>(cell);
                 }
                 else if (column == "sdzx(m)")
                 {
-                    obs->sdzx = std::stod(cell);
+                    obs->sdzx = ascii::to<double>(cell);
                 }
                 else if (column == "sdne(m)")
                 {
-                    obs->sdne = std::stod(cell);
+                    obs->sdne = ascii::to<double>(cell);
                 }
                 else if (column == "sdeu(m)")
                 {
-                    obs->sded = std::stod(cell);
+                    obs->sded = ascii::to<double>(cell);
                 }
                 else if (column == "sdun(m)")
                 {
-                    obs->sddn = std::stod(cell);
+                    obs->sddn = ascii::to<double>(cell);
                 }
                 else if (column == "age(s)")
                 {
-                    obs->age = std::stod(cell);
+                    obs->age = ascii::to<double>(cell);
                 }
                 else if (column == "ratio")
                 {
-                    obs->ratio = std::stod(cell);
+                    obs->ratio = ascii::to<double>(cell);
                 }
                 else if (column == "vn(m/s)")
                 {
-                    n_vel(0) = std::stod(cell);
+                    n_vel(0) = ascii::to<double>(cell);
                 }
                 else if (column == "ve(m/s)")
                 {
-                    n_vel(1) = std::stod(cell);
+                    n_vel(1) = ascii::to<double>(cell);
                 }
                 else if (column == "vu(m/s)")
                 {
-                    n_vel(2) = -std::stod(cell);
+                    n_vel(2) = -ascii::to<double>(cell);
                 }
                 else if (column == "vx(m/s)")
                 {
-                    e_vel(0) = std::stod(cell);
+                    e_vel(0) = ascii::to<double>(cell);
                 }
                 else if (column == "vy(m/s)")
                 {
-                    e_vel(1) = std::stod(cell);
+                    e_vel(1) = ascii::to<double>(cell);
                 }
                 else if (column == "vz(m/s)")
                 {
-                    e_vel(2) = std::stod(cell);
+                    e_vel(2) = ascii::to<double>(cell);
                 }
                 else if (column == "sdvn")
                 {
-                    sdvN = std::stod(cell);
+                    sdvN = ascii::to<double>(cell);
                 }
                 else if (column == "sdve")
                 {
-                    sdvE = std::stod(cell);
+                    sdvE = ascii::to<double>(cell);
                 }
                 else if (column == "sdvu")
                 {
-                    sdvD = std::stod(cell);
+                    sdvD = ascii::to<double>(cell);
                 }
                 else if (column == "sdvne")
                 {
-                    obs->sdvne = std::stod(cell);
+                    obs->sdvne = ascii::to<double>(cell);
                 }
                 else if (column == "sdveu")
                 {
-                    obs->sdved = std::stod(cell);
+                    obs->sdved = ascii::to<double>(cell);
                 }
                 else if (column == "sdvun")
                 {
-                    obs->sdvdn = std::stod(cell);
+                    obs->sdvdn = ascii::to<double>(cell);
                 }
                 else if (column == "sdvx")
                 {
-                    sdvX = std::stod(cell);
+                    sdvX = ascii::to<double>(cell);
                 }
                 else if (column == "sdvy")
                 {
-                    sdvY = std::stod(cell);
+                    sdvY = ascii::to<double>(cell);
                 }
                 else if (column == "sdvz")
                 {
-                    sdvZ = std::stod(cell);
+                    sdvZ = ascii::to<double>(cell);
                 }
                 else if (column == "sdvxy")
                 {
-                    obs->sdvxy = std::stod(cell);
+                    obs->sdvxy = ascii::to<double>(cell);
                 }
                 else if (column == "sdvyz")
                 {
-                    obs->sdvyz = std::stod(cell);
+                    obs->sdvyz = ascii::to<double>(cell);
                 }
                 else if (column == "sdvzx")
                 {
-                    obs->sdvzx = std::stod(cell);
+                    obs->sdvzx = ascii::to<double>(cell);
                 }
             }
         }
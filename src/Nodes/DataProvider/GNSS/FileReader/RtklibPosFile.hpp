@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "internal/Node/Node.hpp"
 #include "Nodes/DataProvider/Protocol/FileReader.hpp"
 
@@ -77,6 +79,9 @@ class RtklibPosFile : public Node, public FileReader
 
     /// @brief Read the Header of the file
     void readHeader() override;
+
+    /// @brief Buffer for the read lines (reused to avoid allocations)
+    std::string _line;
 };
 
 } // namespace NAV
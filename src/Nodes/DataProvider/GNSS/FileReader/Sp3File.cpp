@@ -0,0 +1,387 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Sp3File.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/FileDialog.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/StringUtil.hpp"
+
+#include "Navigation/GNSS/Core/SatelliteSystem.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// Position accuracy used if the SP3 header does not provide one [m]
+constexpr double DEFAULT_POSITION_ACCURACY = 0.05;
+
+/// Absolute values of SP3 clocks above this value mark missing clocks [µs]
+constexpr double SP3_BAD_CLOCK = 999999.0;
+
+} // namespace
+
+Sp3File::Sp3File()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 517, 150 };
+
+    nm::CreateOutputPin(this, GnssNavInfo::type().c_str(), Pin::Type::Object, { GnssNavInfo::type() }, &_gnssNavInfo);
+}
+
+Sp3File::~Sp3File()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string Sp3File::typeStatic()
+{
+    return "Sp3File";
+}
+
+std::string Sp3File::type() const
+{
+    return typeStatic();
+}
+
+std::string Sp3File::category()
+{
+    return "Data Provider";
+}
+
+void Sp3File::guiConfig()
+{
+    if (auto res = FileReader::guiConfig("SP3 (.sp3 .eph){.sp3,.SP3,.eph,.EPH},.*", { ".sp3", ".SP3", ".eph", ".EPH" }, size_t(id), nameId()))
+    {
+        LOG_DEBUG("{}: Path changed to {}", nameId(), _path);
+        flow::ApplyChanges();
+        if (res == FileReader::PATH_CHANGED)
+        {
+            doReinitialize();
+        }
+        else
+        {
+            doDeinitialize();
+        }
+    }
+
+    ImGui::TextUnformatted("RINEX clock file (optional)");
+    ImGui::PushID("ClockFile");
+    if (gui::widgets::FileDialogLoad(_clockPath, "Select Clock File", "RINEX Clock (.clk){.clk,.CLK,(.+[.]\\d\\d?C)},.*",
+                                     { ".clk", ".CLK", "(.+[.]\\d\\d?C)" }, flow::GetInputPath(), size_t(outputPins.at(OUTPUT_PORT_INDEX_GNSS_NAV_INFO).id), nameId()))
+    {
+        LOG_DEBUG("{}: Clock path changed to {}", nameId(), _clockPath);
+        flow::ApplyChanges();
+        doReinitialize();
+    }
+    ImGui::PopID();
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Replaces the SP3 clocks of the satellites contained in the clock file.");
+
+    ImGui::SetNextItemWidth(150.0F);
+    if (ImGui::InputIntL(fmt::format("Interpolation points##{}", size_t(id)).c_str(), &_interpolationPoints, 2, 20))
+    {
+        LOG_DEBUG("{}: Interpolation points changed to {}", nameId(), _interpolationPoints);
+        flow::ApplyChanges();
+        doReinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Amount of epochs used for the Lagrange interpolation of the orbit (polynomial order + 1)");
+}
+
+[[nodiscard]] json Sp3File::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileReader"] = FileReader::save();
+    j["clockPath"] = _clockPath;
+    j["interpolationPoints"] = _interpolationPoints;
+
+    return j;
+}
+
+void Sp3File::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileReader"))
+    {
+        FileReader::restore(j.at("FileReader"));
+    }
+    if (j.contains("clockPath"))
+    {
+        j.at("clockPath").get_to(_clockPath);
+    }
+    if (j.contains("interpolationPoints"))
+    {
+        j.at("interpolationPoints").get_to(_interpolationPoints);
+    }
+}
+
+bool Sp3File::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    {
+        // The guards needs to be released before FileReader::initialize()
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        _gnssNavInfo.reset();
+    }
+    _timeSystem = GPST;
+    _accuracies.clear();
+
+    if (!FileReader::initialize())
+    {
+        return false;
+    }
+
+    std::map<SatId, Records> records;
+    readOrbits(records);
+    if (!_clockPath.empty() && !readClocks(records))
+    {
+        return false;
+    }
+
+    {
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        for (const auto& [satId, satRecords] : records)
+        {
+            if (satRecords.orbit.empty()) { continue; }
+
+            double accuracy = _accuracies.contains(satId) ? _accuracies.at(satId) : DEFAULT_POSITION_ACCURACY;
+            _gnssNavInfo.addSatelliteNavData(satId, std::make_shared<PreciseEphemeris>(satRecords.orbit, satRecords.clock, accuracy,
+                                                                                       static_cast<size_t>(_interpolationPoints)));
+            _gnssNavInfo.satelliteSystems |= satId.satSys;
+        }
+        LOG_DEBUG("{}: Read precise orbits of {} satellites", nameId(), _gnssNavInfo.nSatellites());
+    }
+    _gnssNavInfo.publish(); // Data from the file is known from the start
+
+    return true;
+}
+
+void Sp3File::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    FileReader::deinitialize();
+}
+
+bool Sp3File::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    FileReader::resetReader();
+
+    return true;
+}
+
+FileReader::FileType Sp3File::determineFileType()
+{
+    auto filestreamHeader = std::ifstream(getFilepath());
+    if (filestreamHeader.good())
+    {
+        std::string line;
+        std::getline(filestreamHeader, line);
+        // #dP2023  1  8  0  0  0.00000000     289 d+D   IGS20 FIT AIUB
+        if (line.size() < 3 || line.at(0) != '#' || (line.at(1) != 'c' && line.at(1) != 'd'))
+        {
+            LOG_ERROR("{}: Not a valid SP3 file. Only SP3-c and SP3-d are supported.", nameId());
+            return FileReader::FileType::NONE;
+        }
+        return FileReader::FileType::ASCII;
+    }
+
+    LOG_ERROR("{}: Could not open file {}", nameId(), getFilepath());
+    return FileReader::FileType::NONE;
+}
+
+void Sp3File::readHeader()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    std::vector<SatId> satellites;
+    size_t accuracyIdx = 0;
+    bool timeSystemRead = false;
+
+    std::string line;
+    while (!eof() && peek() != '*' && getline(line))
+    {
+        str::rtrim(line);
+        if (line.starts_with("+ ")) // +   77   G01G02G03G04G05G06G07G08G09G10G11G12G13G14G15G16G17
+        {
+            for (size_t i = 9; i + 3 <= line.size(); i += 3)
+            {
+                auto satNum = str::stoi(line.substr(i + 1, 2), 0);
+                if (satNum == 0) { continue; }
+                satellites.emplace_back(SatelliteSystem::fromChar(line.at(i)), static_cast<uint16_t>(satNum));
+            }
+        }
+        else if (line.starts_with("++")) // ++         4  4  5  4  6  4  4  5  4  5  4  4  4  4  4  4  6
+        {
+            for (size_t i = 9; i + 3 <= line.size() && accuracyIdx < satellites.size(); i += 3, accuracyIdx++)
+            {
+                // Accuracy exponent: 2^exp [mm], 0 means unknown
+                auto exponent = str::stoi(line.substr(i, 3), 0);
+                if (exponent != 0) { _accuracies[satellites.at(accuracyIdx)] = std::pow(2.0, exponent) * 1e-3; }
+            }
+        }
+        else if (line.starts_with("%c") && !timeSystemRead) // %c M  cc GPS ccc cccc cccc cccc cccc ccccc ccccc ccccc ccccc
+        {
+            timeSystemRead = true;
+            auto timeSys = line.size() >= 12 ? TimeSystem::fromString(line.substr(9, 3)) : TimeSystem(TimeSys_None);
+            if (timeSys == TimeSys_None)
+            {
+                LOG_WARN("{}: Time system '{}' not supported. Assuming GPS time.", nameId(), line.size() >= 12 ? line.substr(9, 3) : "");
+                timeSys = GPST;
+            }
+            _timeSystem = timeSys;
+        }
+    }
+    LOG_DEBUG("{}: Header lists {} satellites in time system {}", nameId(), satellites.size(), _timeSystem);
+}
+
+void Sp3File::readOrbits(std::map<SatId, Records>& records)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    InsTime epoch;
+    std::string line;
+    try
+    {
+        while (getline(line) && !eof())
+        {
+            str::rtrim(line);
+            if (line.starts_with("EOF")) { break; }
+
+            if (line.starts_with("* ")) // *  2023  1  8  0  0  0.00000000
+            {
+                epoch = InsTime{ std::stoi(line.substr(3, 4)), std::stoi(line.substr(8, 2)), std::stoi(line.substr(11, 2)),
+                                 std::stoi(line.substr(14, 2)), std::stoi(line.substr(17, 2)), std::stold(line.substr(20)), _timeSystem };
+            }
+            else if (line.starts_with('P') && !epoch.empty()) // PG01  13091.734710 -13015.438997  18644.390380    227.257365
+            {
+                SatId satId(SatelliteSystem::fromChar(line.at(1)), static_cast<uint16_t>(std::stoi(line.substr(2, 2))));
+                if (satId.satSys == SatSys_None) { continue; }
+
+                Eigen::Vector3d e_pos(std::stod(line.substr(4, 14)), std::stod(line.substr(18, 14)), std::stod(line.substr(32, 14)));
+                auto& satRecords = records[satId];
+                if (!e_pos.isZero()) // Missing positions are set to zero
+                {
+                    satRecords.orbit.push_back({ .epoch = epoch, .e_pos = e_pos * 1e3 });
+                }
+                if (auto clock = line.size() > 46 ? str::stod(line.substr(46, 14), 0.0) : 0.0;
+                    clock != 0.0 && std::abs(clock) < SP3_BAD_CLOCK)
+                {
+                    satRecords.clock.push_back({ .epoch = epoch, .bias = clock * 1e-6 });
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: The file '{}' is corrupt in line {}: {}", nameId(), _path, getCurrentLineNumber(), e.what());
+        records.clear();
+    }
+}
+
+bool Sp3File::readClocks(std::map<SatId, Records>& records)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    std::filesystem::path filepath{ _clockPath };
+    if (filepath.is_relative()) { filepath = flow::GetInputPath() / filepath; }
+
+    std::ifstream filestream(filepath, std::ios_base::in | std::ios_base::binary);
+    if (!filestream.good())
+    {
+        LOG_ERROR("{}: Could not open the clock file {}", nameId(), filepath);
+        return false;
+    }
+
+    std::string line;
+    // ------------------------------------------------ Header ---------------------------------------------------
+    std::getline(filestream, line);
+    if (line.find("RINEX VERSION / TYPE") == std::string::npos || line.size() < 21 || line.at(20) != 'C')
+    {
+        LOG_ERROR("{}: Not a valid RINEX clock file {}", nameId(), filepath);
+        return false;
+    }
+    TimeSystem timeSys = GPST;
+    while (std::getline(filestream, line) && line.find("END OF HEADER") == std::string::npos)
+    {
+        if (line.find("TIME SYSTEM ID") != std::string::npos)
+        {
+            if (auto sys = TimeSystem::fromString(str::trim_copy(line.substr(0, 60))); sys != TimeSys_None) { timeSys = sys; }
+        }
+    }
+
+    // ------------------------------------------------- Data ----------------------------------------------------
+    size_t nClocks = 0;
+    size_t lineNumber = 0;
+    try
+    {
+        while (std::getline(filestream, line))
+        {
+            lineNumber++;
+            // AS G01  2023 01 08 00 00  0.000000  2    2.272573650000E-04  1.000000000000E-11
+            if (!line.starts_with("AS ")) { continue; } // Receiver clocks and other records
+
+            auto v = str::split_wo_empty(str::trim_copy(line), " ");
+            if (v.size() < 10) { continue; }
+
+            SatId satId(SatelliteSystem::fromChar(v.at(1).at(0)), static_cast<uint16_t>(std::stoi(v.at(1).substr(1))));
+            if (satId.satSys == SatSys_None) { continue; }
+
+            auto& satRecords = records[satId];
+            if (!satRecords.clockFromClockFile)
+            {
+                satRecords.clock.clear();
+                satRecords.clockFromClockFile = true;
+            }
+            satRecords.clock.push_back({ .epoch = InsTime{ std::stoi(v.at(2)), std::stoi(v.at(3)), std::stoi(v.at(4)),
+                                                           std::stoi(v.at(5)), std::stoi(v.at(6)), std::stold(v.at(7)), timeSys },
+                                         .bias = std::stod(v.at(9)) });
+            nClocks++;
+
+            if (std::stoi(v.at(8)) > 2) { std::getline(filestream, line); } // Continuation line with rates
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: The clock file '{}' is corrupt in data line {}: {}", nameId(), filepath, lineNumber, e.what());
+        return false;
+    }
+    for (auto& [satId, satRecords] : records)
+    {
+        if (!satRecords.clockFromClockFile) { continue; }
+        auto& clock = satRecords.clock;
+        std::stable_sort(clock.begin(), clock.end(), [](const auto& lhs, const auto& rhs) { return lhs.epoch < rhs.epoch; });
+        clock.erase(std::unique(clock.begin(), clock.end(), [](const auto& lhs, const auto& rhs) { return lhs.epoch == rhs.epoch; }), clock.end());
+    }
+    LOG_DEBUG("{}: Read {} satellite clocks from {}", nameId(), nClocks, filepath);
+
+    return true;
+}
+
+} // namespace NAV
@@ -0,0 +1,121 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Sp3File.hpp
+/// @brief File reader for SP3 precise orbits and RINEX clock products
+/// @date 2026-10-18
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/FileReader.hpp"
+
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/PreciseEphemeris.hpp"
+#include "Navigation/Time/TimeSystem.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+
+namespace NAV
+{
+/// File reader Node for SP3 precise orbits (SP3-c, SP3-d) and optionally RINEX clock products
+///
+/// The products are provided as GnssNavInfo, so that they can be used instead of the broadcast ephemerides.
+/// The clocks of the RINEX clock file replace the SP3 clocks of the satellites contained in it.
+class Sp3File : public Node, public FileReader
+{
+  public:
+    /// @brief Default constructor
+    Sp3File();
+    /// @brief Destructor
+    ~Sp3File() override;
+    /// @brief Copy constructor
+    Sp3File(const Sp3File&) = delete;
+    /// @brief Move constructor
+    Sp3File(Sp3File&&) = delete;
+    /// @brief Copy assignment operator
+    Sp3File& operator=(const Sp3File&) = delete;
+    /// @brief Move assignment operator
+    Sp3File& operator=(Sp3File&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node. Moves the read cursor to the start
+    bool resetNode() override;
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_GNSS_NAV_INFO = 0; ///< @brief Object (GnssNavInfo)
+
+    /// @brief Records of a satellite
+    struct Records
+    {
+        std::vector<PreciseEphemeris::OrbitRecord> orbit; ///< Positions
+        std::vector<PreciseEphemeris::ClockRecord> clock; ///< Clock biases
+        bool clockFromClockFile = false;                  ///< Whether the clocks were replaced by the RINEX clock file
+    };
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Determines the type of the file
+    /// @return The File Type
+    [[nodiscard]] FileType determineFileType() override;
+
+    /// @brief Read the Header of the file
+    void readHeader() override;
+
+    /// @brief Read the positions and clocks of the SP3 file
+    /// @param[in, out] records Records of the satellites
+    void readOrbits(std::map<SatId, Records>& records);
+
+    /// @brief Read the satellite clocks of the RINEX clock file
+    /// @param[in, out] records Records of the satellites
+    /// @return False if the file could not be read
+    bool readClocks(std::map<SatId, Records>& records);
+
+    /// @brief Path to the RINEX clock file (optional)
+    std::string _clockPath;
+
+    /// @brief Amount of epochs used for the orbit interpolation
+    int _interpolationPoints = 10;
+
+    /// @brief Data object to share over the output pin
+    GnssNavInfo _gnssNavInfo;
+
+    /// @brief Time system of the SP3 epochs
+    TimeSystem _timeSystem = GPST;
+
+    /// @brief Accuracy of the satellites from the SP3 header [m]
+    std::map<SatId, double> _accuracies;
+};
+
+} // namespace NAV
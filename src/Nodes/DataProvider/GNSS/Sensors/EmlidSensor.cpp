@@ -27,7 +27,7 @@ NAV::EmlidSensor::EmlidSensor()
 
     _onlyRealTime = true;
     _hasConfig = true;
-    _guiConfigDefaultWindowSize = { 360, 70 };
+    _guiConfigDefaultWindowSize = { 360, 210 };
 
     // TODO: Update the library to handle different baudrates
     _selectedBaudrate = baudrate2Selection(Baudrate::BAUDRATE_9600);
@@ -70,6 +70,11 @@ void NAV::EmlidSensor::guiConfig()
                              "- \"/dev/ttyUSB0\" (Linux format for virtual (USB) serial port)\n"
                              "- \"/dev/tty.usbserial-FTXXXXXX\" (Mac OS X format for virtual (USB) serial port)\n"
                              "- \"/dev/ttyS0\" (CYGWIN format. Usually the Windows COM port number minus 1. This would connect to COM1)");
+
+    if (_watchdog.ShowGuiWidgets(nameId().c_str(), 100.0F))
+    {
+        flow::ApplyChanges();
+    }
 }
 
 [[nodiscard]] json NAV::EmlidSensor::save() const
@@ -79,6 +84,7 @@ void NAV::EmlidSensor::guiConfig()
     json j;
 
     j["UartSensor"] = UartSensor::save();
+    j["watchdog"] = _watchdog;
 
     return j;
 }
@@ -91,6 +97,10 @@ void NAV::EmlidSensor::restore(json const& j)
     {
         UartSensor::restore(j.at("UartSensor"));
     }
+    if (j.contains("watchdog"))
+    {
+        j.at("watchdog").get_to(_watchdog);
+    }
 }
 
 bool NAV::EmlidSensor::resetNode()
@@ -102,6 +112,8 @@ bool NAV::EmlidSensor::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _sensor.setInvalidPacketHandler([this]() { _watchdog.notifyChecksumError(); });
+
     // connect to the sensor
     try
     {
@@ -117,6 +129,8 @@ bool NAV::EmlidSensor::initialize()
 
     _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
 
+    _watchdog.start(nameId(), [this]() { return reconnect(); });
+
     return true;
 }
 
@@ -124,6 +138,8 @@ void NAV::EmlidSensor::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _watchdog.stop();
+
     if (!isInitialized())
     {
         return;
@@ -142,9 +158,33 @@ void NAV::EmlidSensor::deinitialize()
     }
 }
 
+bool NAV::EmlidSensor::reconnect()
+{
+    LOG_DEBUG("{}: Reconnecting on port {}", nameId(), _sensorPort);
+
+    try
+    {
+        _sensor->unregisterAsyncPacketReceivedHandler();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+    try
+    {
+        _sensor->disconnect();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+
+    _sensor->connect(_sensorPort, sensorBaudrate());
+    _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
+
+    return true;
+}
+
 void NAV::EmlidSensor::asciiOrBinaryAsyncMessageReceived(void* userData, uart::protocol::Packet& p, [[maybe_unused]] size_t index)
 {
     auto* erSensor = static_cast<EmlidSensor*>(userData);
+    erSensor->_watchdog.notifyPacket();
 
     erSensor->invokeCallbacks(OUTPUT_PORT_INDEX_EMLID_OBS, std::make_shared<UartPacket>(p));
 }
\ No newline at end of file
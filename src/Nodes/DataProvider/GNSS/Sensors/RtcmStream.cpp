@@ -0,0 +1,297 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RtcmStream.hpp"
+
+#include <span>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/Logger.hpp"
+#include "util/Time/TimeBase.hpp"
+
+namespace NAV
+{
+
+RtcmStream::RtcmStream()
+    : Node(typeStatic()), _serialPort(_io_context), _socket(_io_context), _retryTimer(_io_context), _decoder(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _onlyRealTime = true;
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 360, 160 };
+
+    _selectedBaudrate = baudrate2Selection(Baudrate::BAUDRATE_115200);
+    _sensorPort = "/dev/ttyUSB0";
+
+    nm::CreateOutputPin(this, "GnssObs", Pin::Type::Flow, { NAV::GnssObs::type() });
+    nm::CreateOutputPin(this, GnssNavInfo::type().c_str(), Pin::Type::Object, { GnssNavInfo::type() }, &_gnssNavInfo);
+}
+
+RtcmStream::~RtcmStream()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string RtcmStream::typeStatic()
+{
+    return "RtcmStream";
+}
+
+std::string RtcmStream::type() const
+{
+    return typeStatic();
+}
+
+std::string RtcmStream::category()
+{
+    return "Data Provider";
+}
+
+void RtcmStream::guiConfig()
+{
+    ImGui::SetNextItemWidth(150.0F);
+    if (gui::widgets::EnumCombo(fmt::format("Source##{}", size_t(id)).c_str(), _source))
+    {
+        LOG_DEBUG("{}: Source changed to {}", nameId(), to_string(_source));
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+
+    if (_source == Source::Serial)
+    {
+        if (ImGui::InputTextWithHint(fmt::format("SensorPort##{}", size_t(id)).c_str(), "/dev/ttyUSB0", &_sensorPort))
+        {
+            LOG_DEBUG("{}: SensorPort changed to {}", nameId(), _sensorPort);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("COM port where the receiver or radio is attached to\n"
+                                 "- \"COM1\" (Windows format for physical and virtual (USB) serial port)\n"
+                                 "- \"/dev/ttyS1\" (Linux format for physical serial port)\n"
+                                 "- \"/dev/ttyUSB0\" (Linux format for virtual (USB) serial port)\n"
+                                 "- \"/dev/tty.usbserial-FTXXXXXX\" (Mac OS X format for virtual (USB) serial port)");
+
+        // The fastest baudrate can not be determined for a plain serial port
+        std::array<const char*, 9> items = { "9600", "19200", "38400", "57600", "115200", "128000", "230400", "460800", "921600" };
+        int selection = std::max(_selectedBaudrate - 1, 0);
+        ImGui::SetNextItemWidth(150.0F);
+        if (ImGui::Combo(fmt::format("Baudrate##{}", size_t(id)).c_str(), &selection, items.data(), items.size()))
+        {
+            _selectedBaudrate = selection + 1;
+            LOG_DEBUG("{}: Baudrate changed to {}", nameId(), sensorBaudrate());
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+    else
+    {
+        ImGui::SetNextItemWidth(150.0F);
+        if (ImGui::InputIntL(fmt::format("Port##{}", size_t(id)).c_str(), &_port, PORT_LIMITS[0], PORT_LIMITS[1]))
+        {
+            LOG_DEBUG("{}: Port changed to {}", nameId(), _port);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+
+    if (ImGui::Checkbox(fmt::format("Select station##{}", size_t(id)).c_str(), &_selectStation))
+    {
+        LOG_DEBUG("{}: Select station changed to {}", nameId(), _selectStation);
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Streams can contain the observations of several reference stations.\n"
+                             "Without selection, the observations of the first station received are provided.");
+    if (_selectStation)
+    {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100.0F);
+        if (ImGui::InputIntL(fmt::format("Station ID##{}", size_t(id)).c_str(), &_stationId, 0, 4095))
+        {
+            LOG_DEBUG("{}: Station ID changed to {}", nameId(), _stationId);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+}
+
+[[nodiscard]] json RtcmStream::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["UartSensor"] = UartSensor::save();
+    j["source"] = _source;
+    j["port"] = _port;
+    j["selectStation"] = _selectStation;
+    j["stationId"] = _stationId;
+
+    return j;
+}
+
+void RtcmStream::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("UartSensor"))
+    {
+        UartSensor::restore(j.at("UartSensor"));
+    }
+    if (j.contains("source"))
+    {
+        j.at("source").get_to(_source);
+    }
+    if (j.contains("port"))
+    {
+        j.at("port").get_to(_port);
+    }
+    if (j.contains("selectStation"))
+    {
+        j.at("selectStation").get_to(_selectStation);
+    }
+    if (j.contains("stationId"))
+    {
+        j.at("stationId").get_to(_stationId);
+    }
+}
+
+bool RtcmStream::resetNode()
+{
+    return true;
+}
+
+bool RtcmStream::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    {
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        _gnssNavInfo.reset();
+    }
+    _decoder.setStationId(_selectStation ? std::make_optional(static_cast<uint16_t>(_stationId)) : std::nullopt);
+    _decoder.reset();
+    _decoder.setReferenceTime(util::time::GetCurrentInsTime());
+    _decoder.setObsHandler([this](const std::shared_ptr<GnssObs>& gnssObs) { invokeCallbacks(OUTPUT_PORT_INDEX_GNSS_OBS, gnssObs); });
+    _decoder.setNavHandler([this](const SatId& satId, const std::shared_ptr<SatNavData>& satNavData) {
+        auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_GNSS_NAV_INFO);
+        _gnssNavInfo.satelliteSystems |= satId.satSys;
+        if (_gnssNavInfo.addSatelliteNavData(satId, satNavData)) { _gnssNavInfo.publish(_decoder.referenceTime()); }
+    });
+
+    try
+    {
+        if (_source == Source::Serial)
+        {
+            _serialPort.open(_sensorPort);
+            _serialPort.set_option(boost::asio::serial_port_base::baud_rate(static_cast<unsigned int>(sensorBaudrate())));
+            LOG_DEBUG("{} connected on port {} with baudrate {}", nameId(), _sensorPort, sensorBaudrate());
+        }
+        else
+        {
+            _socket = boost::asio::ip::udp::socket(_io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), static_cast<uint16_t>(_port)));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        if (_source == Source::Serial) { LOG_ERROR("{}: Could not open the serial port {}: {}", nameId(), _sensorPort, e.what()); }
+        else { LOG_ERROR("{}: Port {} is already in use. Choose a different port for this instance.", nameId(), _port); }
+        return false;
+    }
+
+    _running = true;
+    _receiveErrors = 0;
+
+    asyncReceive();
+
+    if (_isStartup)
+    {
+        _recvThread = std::thread([this]() {
+            _io_context.run();
+        });
+    }
+    else
+    {
+        _recvThread = std::thread([this]() {
+            _io_context.restart();
+            _io_context.run();
+        });
+    }
+
+    _isStartup = false;
+
+    return true;
+}
+
+void RtcmStream::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!isInitialized())
+    {
+        return;
+    }
+
+    _running = false;
+    _retryTimer.cancel();
+    _io_context.stop();
+    _recvThread.join();
+    if (_serialPort.is_open()) { _serialPort.close(); }
+    if (_socket.is_open()) { _socket.close(); }
+}
+
+void RtcmStream::asyncReceive()
+{
+    auto handler = [this](boost::system::error_code errorRcvd, std::size_t bytesRcvd) {
+        if (!_running || errorRcvd == boost::asio::error::operation_aborted) { return; }
+
+        if (!errorRcvd)
+        {
+            if (_receiveErrors != 0)
+            {
+                LOG_INFO("{}: Receiving the RTCM stream again after {} errors", nameId(), _receiveErrors);
+                _receiveErrors = 0;
+            }
+            if (bytesRcvd > 0) { decode(bytesRcvd); }
+            asyncReceive();
+            return;
+        }
+
+        // Errors of the serial line or the network can be temporary, so the reception continues after a short pause
+        if (_receiveErrors++ == 0) { LOG_ERROR("{}: Error receiving the RTCM stream: {}. Retrying.", nameId(), errorRcvd.message()); }
+        else { LOG_DEBUG("{}: Error receiving the RTCM stream: {}", nameId(), errorRcvd.message()); }
+        _retryTimer.expires_after(RETRY_DELAY);
+        _retryTimer.async_wait([this](boost::system::error_code errorWait) {
+            if (_running && !errorWait) { asyncReceive(); }
+        });
+    };
+
+    if (_source == Source::Serial) { _serialPort.async_read_some(boost::asio::buffer(_data), handler); }
+    else { _socket.async_receive_from(boost::asio::buffer(_data), _sender_endpoint, handler); }
+}
+
+void RtcmStream::decode(size_t nBytes)
+{
+    auto crcErrors = _decoder.statistics().crcErrors;
+    _decoder.feed(std::span(_data).first(nBytes));
+    if (_decoder.statistics().crcErrors != crcErrors)
+    {
+        LOG_DEBUG("{}: Received {} frames with checksum errors", nameId(), _decoder.statistics().crcErrors - crcErrors);
+    }
+}
+
+} // namespace NAV
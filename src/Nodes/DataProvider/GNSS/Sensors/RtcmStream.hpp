@@ -0,0 +1,162 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtcmStream.hpp
+/// @brief Receives RTCM 3 corrections over a serial port or UDP
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <thread>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/UartSensor.hpp"
+
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "util/Vendor/RTCM/RtcmDecoder.hpp"
+#include <boost/asio.hpp>
+
+namespace NAV
+{
+/// Receives an RTCM 3 stream (e.g. of a reference station or an NTRIP client) over a serial port or UDP
+///
+/// Provides the MSM observations of one reference station as GnssObs and the broadcast ephemerides as GnssNavInfo.
+/// The week of the messages is resolved with the computer time.
+class RtcmStream : public Node, public UartSensor
+{
+  public:
+    /// @brief Default constructor
+    RtcmStream();
+    /// @brief Destructor
+    ~RtcmStream() override;
+    /// @brief Copy constructor
+    RtcmStream(const RtcmStream&) = delete;
+    /// @brief Move constructor
+    RtcmStream(RtcmStream&&) = delete;
+    /// @brief Copy assignment operator
+    RtcmStream& operator=(const RtcmStream&) = delete;
+    /// @brief Move assignment operator
+    RtcmStream& operator=(RtcmStream&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node. It is guaranteed that the node is initialized when this is called.
+    bool resetNode() override;
+
+    /// @brief Source of the byte stream
+    enum class Source
+    {
+        Serial, ///< Serial port
+        UDP,    ///< UDP port
+        COUNT,  ///< Amount of items in the enum
+    };
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_GNSS_OBS = 0;       ///< @brief Flow (GnssObs)
+    constexpr static size_t OUTPUT_PORT_INDEX_GNSS_NAV_INFO = 1; ///< @brief Object (GnssNavInfo)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Receives the next chunk of the stream
+    void asyncReceive();
+
+    /// @brief Decodes a received chunk of the stream
+    /// @param[in] nBytes Amount of bytes received into _data
+    void decode(size_t nBytes);
+
+    /// Source of the byte stream
+    Source _source = Source::Serial;
+
+    /// UDP port number
+    int _port = 2101;
+
+    /// Range a port can be in [0, 2^16-1]
+    static constexpr std::array<int, 2> PORT_LIMITS = { 0, 65535 };
+
+    /// @brief Whether only the observations of the station with the ID _stationId are provided
+    bool _selectStation = false;
+    /// @brief Station ID of the observations to provide
+    int _stationId = 0;
+
+    /// Asynchronous receive fct
+    boost::asio::io_context _io_context;
+    /// Boost serial port
+    boost::asio::serial_port _serialPort;
+    /// Boost udp socket
+    boost::asio::ip::udp::socket _socket;
+    /// Boost udp endpoint
+    boost::asio::ip::udp::endpoint _sender_endpoint;
+    /// Timer to receive again after an error
+    boost::asio::steady_timer _retryTimer;
+
+    /// Pause after an error before receiving again
+    static constexpr std::chrono::milliseconds RETRY_DELAY{ 100 };
+    /// Amount of receive errors since the last successful reception
+    size_t _receiveErrors = 0;
+
+    /// Receiver thread
+    std::thread _recvThread;
+
+    /// Flag that indicates the running data link
+    bool _running = false;
+    /// Startup handler: used in 'initialize()' to differentiate between startup and re-initialization
+    bool _isStartup = true;
+
+    /// Received chunk of the stream. Large enough for a UDP datagram.
+    std::array<uint8_t, 65536> _data{};
+
+    /// @brief Decoder of the byte stream
+    vendor::rtcm::RtcmDecoder _decoder;
+
+    /// @brief Data object to share over the output pin
+    GnssNavInfo _gnssNavInfo;
+};
+
+/// @brief Converts the enum to a string
+/// @param[in] source Enum value to convert into text
+/// @return String representation of the enum
+constexpr const char* to_string(RtcmStream::Source source)
+{
+    switch (source)
+    {
+    case RtcmStream::Source::Serial:
+        return "Serial port";
+    case RtcmStream::Source::UDP:
+        return "UDP";
+    case RtcmStream::Source::COUNT:
+        return "";
+    }
+    return "";
+}
+
+} // namespace NAV
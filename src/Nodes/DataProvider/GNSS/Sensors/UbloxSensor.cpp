@@ -27,7 +27,7 @@ NAV::UbloxSensor::UbloxSensor()
 
     _onlyRealTime = true;
     _hasConfig = true;
-    _guiConfigDefaultWindowSize = { 360, 70 };
+    _guiConfigDefaultWindowSize = { 360, 210 };
 
     // TODO: Update the library to handle different baudrates
     _selectedBaudrate = baudrate2Selection(Baudrate::BAUDRATE_9600);
@@ -71,6 +71,11 @@ void NAV::UbloxSensor::guiConfig()
                              "- \"/dev/ttyUSB0\" (Linux format for virtual (USB) serial port)\n"
                              "- \"/dev/tty.usbserial-FTXXXXXX\" (Mac OS X format for virtual (USB) serial port)\n"
                              "- \"/dev/ttyS0\" (CYGWIN format. Usually the Windows COM port number minus 1. This would connect to COM1)");
+
+    if (_watchdog.ShowGuiWidgets(nameId().c_str(), 100.0F))
+    {
+        flow::ApplyChanges();
+    }
 }
 
 [[nodiscard]] json NAV::UbloxSensor::save() const
@@ -80,6 +85,7 @@ void NAV::UbloxSensor::guiConfig()
     json j;
 
     j["UartSensor"] = UartSensor::save();
+    j["watchdog"] = _watchdog;
 
     return j;
 }
@@ -92,6 +98,10 @@ void NAV::UbloxSensor::restore(json const& j)
     {
         UartSensor::restore(j.at("UartSensor"));
     }
+    if (j.contains("watchdog"))
+    {
+        j.at("watchdog").get_to(_watchdog);
+    }
 }
 
 bool NAV::UbloxSensor::resetNode()
@@ -103,6 +113,8 @@ bool NAV::UbloxSensor::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _sensor.setInvalidPacketHandler([this]() { _watchdog.notifyChecksumError(); });
+
     // connect to the sensor
     try
     {
@@ -118,6 +130,8 @@ bool NAV::UbloxSensor::initialize()
 
     _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
 
+    _watchdog.start(nameId(), [this]() { return reconnect(); });
+
     return true;
 }
 
@@ -125,6 +139,8 @@ void NAV::UbloxSensor::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _watchdog.stop();
+
     if (!isInitialized())
     {
         return;
@@ -143,9 +159,33 @@ void NAV::UbloxSensor::deinitialize()
     }
 }
 
+bool NAV::UbloxSensor::reconnect()
+{
+    LOG_DEBUG("{}: Reconnecting on port {}", nameId(), _sensorPort);
+
+    try
+    {
+        _sensor->unregisterAsyncPacketReceivedHandler();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+    try
+    {
+        _sensor->disconnect();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+
+    _sensor->connect(_sensorPort, sensorBaudrate());
+    _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
+
+    return true;
+}
+
 void NAV::UbloxSensor::asciiOrBinaryAsyncMessageReceived(void* userData, uart::protocol::Packet& p, [[maybe_unused]] size_t index)
 {
     auto* ubSensor = static_cast<UbloxSensor*>(userData);
+    ubSensor->_watchdog.notifyPacket();
 
     ubSensor->invokeCallbacks(OUTPUT_PORT_INDEX_UBLOX_OBS, std::make_shared<UartPacket>(p));
 }
\ No newline at end of file
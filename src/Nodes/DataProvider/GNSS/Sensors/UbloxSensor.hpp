@@ -14,6 +14,7 @@
 #pragma once
 
 #include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/SensorWatchdog.hpp"
 #include "Nodes/DataProvider/Protocol/UartSensor.hpp"
 #include "util/Vendor/Ublox/UbloxUartSensor.hpp"
 
@@ -74,8 +75,15 @@ class UbloxSensor : public Node, public UartSensor
     /// @param[in] index Advanced usage item and can be safely ignored for now
     static void asciiOrBinaryAsyncMessageReceived(void* userData, uart::protocol::Packet& p, size_t index);
 
+    /// @brief Disconnects the sensor and connects it again without reinitializing the flow (called by the watchdog)
+    /// @return True if the sensor is connected again
+    bool reconnect();
+
     /// Sensor Object
     vendor::ublox::UbloxUartSensor _sensor;
+
+    /// Watchdog which reconnects the sensor if no data is received
+    SensorWatchdog _watchdog;
 };
 
 } // namespace NAV
\ No newline at end of file
@@ -28,7 +28,7 @@ NAV::KvhSensor::KvhSensor()
 
     _onlyRealTime = true;
     _hasConfig = true;
-    _guiConfigDefaultWindowSize = { 360, 70 };
+    _guiConfigDefaultWindowSize = { 360, 210 };
 
     // TODO: Update the library to handle different baudrates
     _selectedBaudrate = baudrate2Selection(Baudrate::BAUDRATE_921600);
@@ -72,6 +72,11 @@ void NAV::KvhSensor::guiConfig()
                              "- \"/dev/tty.usbserial-FTXXXXXX\" (Mac OS X format for virtual (USB) serial port)\n"
                              "- \"/dev/ttyS0\" (CYGWIN format. Usually the Windows COM port number minus 1. This would connect to COM1)");
 
+    if (_watchdog.ShowGuiWidgets(nameId().c_str(), 100.0F))
+    {
+        flow::ApplyChanges();
+    }
+
     Imu::guiConfig();
 }
 
@@ -82,6 +87,7 @@ void NAV::KvhSensor::guiConfig()
     json j;
 
     j["UartSensor"] = UartSensor::save();
+    j["watchdog"] = _watchdog;
     j["Imu"] = Imu::save();
 
     return j;
@@ -95,6 +101,10 @@ void NAV::KvhSensor::restore(json const& j)
     {
         UartSensor::restore(j.at("UartSensor"));
     }
+    if (j.contains("watchdog"))
+    {
+        j.at("watchdog").get_to(_watchdog);
+    }
     if (j.contains("Imu"))
     {
         Imu::restore(j.at("Imu"));
@@ -110,6 +120,8 @@ bool NAV::KvhSensor::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _sensor.setInvalidPacketHandler([this]() { _watchdog.notifyChecksumError(); });
+
     // connect to the sensor
     try
     {
@@ -125,6 +137,8 @@ bool NAV::KvhSensor::initialize()
 
     _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
 
+    _watchdog.start(nameId(), [this]() { return reconnect(); });
+
     return true;
 }
 
@@ -132,6 +146,8 @@ void NAV::KvhSensor::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _watchdog.stop();
+
     if (!isInitialized())
     {
         return;
@@ -149,9 +165,33 @@ void NAV::KvhSensor::deinitialize()
     }
 }
 
+bool NAV::KvhSensor::reconnect()
+{
+    LOG_DEBUG("{}: Reconnecting on port {}", nameId(), _sensorPort);
+
+    try
+    {
+        _sensor->unregisterAsyncPacketReceivedHandler();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+    try
+    {
+        _sensor->disconnect();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {}
+
+    _sensor->connect(_sensorPort, sensorBaudrate());
+    _sensor->registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
+
+    return true;
+}
+
 void NAV::KvhSensor::asciiOrBinaryAsyncMessageReceived(void* userData, uart::protocol::Packet& p, [[maybe_unused]] size_t index)
 {
     auto* kvhSensor = static_cast<KvhSensor*>(userData);
+    kvhSensor->_watchdog.notifyPacket();
 
     if (p.type() == uart::protocol::Packet::Type::TYPE_BINARY)
     {
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "Nodes/DataProvider/IMU/Imu.hpp"
+#include "Nodes/DataProvider/Protocol/SensorWatchdog.hpp"
 #include "Nodes/DataProvider/Protocol/UartSensor.hpp"
 #include "util/Vendor/KVH/KvhUartSensor.hpp"
 
@@ -74,9 +75,16 @@ class KvhSensor : public Imu, public UartSensor
     /// @param[in] index Advanced usage item and can be safely ignored for now
     static void asciiOrBinaryAsyncMessageReceived(void* userData, uart::protocol::Packet& p, size_t index);
 
+    /// @brief Disconnects the sensor and connects it again without reinitializing the flow (called by the watchdog)
+    /// @return True if the sensor is connected again
+    bool reconnect();
+
     /// Sensor Object
     vendor::kvh::KvhUartSensor _sensor;
 
+    /// Watchdog which reconnects the sensor if no data is received
+    SensorWatchdog _watchdog;
+
     /// Previous Sequence number to check for order errors
     uint8_t _prevSequenceNumber = UINT8_MAX;
 };
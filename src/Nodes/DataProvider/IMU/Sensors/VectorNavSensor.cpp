@@ -1860,6 +1860,14 @@ void NAV::VectorNavSensor::guiConfig()
                           "few seconds to completely converge on the correct attitude and correct for gyro bias.");
     }
 
+    if (ImGui::CollapsingHeader(fmt::format("Watchdog##{}", size_t(id)).c_str()))
+    {
+        if (_watchdog.ShowGuiWidgets(nameId().c_str(), 100.0F))
+        {
+            flow::ApplyChanges();
+        }
+    }
+
     // ###########################################################################################################
     //                                               SYSTEM MODULE
     // ###########################################################################################################
@@ -5487,6 +5495,7 @@ void NAV::VectorNavSensor::guiConfig()
 
     j["UartSensor"] = UartSensor::save();
     j["sensorModel"] = _sensorModel;
+    j["watchdog"] = _watchdog;
 
     // ###########################################################################################################
     //                                               SYSTEM MODULE
@@ -5573,6 +5582,10 @@ void NAV::VectorNavSensor::restore(json const& j)
     {
         j.at("sensorModel").get_to(_sensorModel);
     }
+    if (j.contains("watchdog"))
+    {
+        j.at("watchdog").get_to(_watchdog);
+    }
 
     // ###########################################################################################################
     //                                               SYSTEM MODULE
@@ -6410,6 +6423,8 @@ bool NAV::VectorNavSensor::initialize()
 
     _vs.registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
 
+    _watchdog.start(nameId(), [this]() { return reconnect(); });
+
     LOG_DEBUG("{}: successfully initialized", nameId());
 
     return true;
@@ -6419,6 +6434,8 @@ void NAV::VectorNavSensor::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
+    _watchdog.stop();
+
     try
     {
         if (_vs.isConnected())
@@ -6476,6 +6493,45 @@ void NAV::VectorNavSensor::deinitialize()
     }
 }
 
+bool NAV::VectorNavSensor::reconnect()
+{
+    LOG_DEBUG("{}: Reconnecting on port '{}'", nameId(), _connectedSensorPort);
+
+    try
+    {
+        _vs.unregisterAsyncPacketReceivedHandler();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_DEBUG("{}: Could not unregisterAsyncPacketReceivedHandler ({})", nameId(), e.what());
+    }
+    try
+    {
+        _vs.disconnect();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_DEBUG("{}: Could not disconnect ({})", nameId(), e.what());
+    }
+
+    // The configuration was written to the non-volatile memory during the initialization,
+    // so the sensor comes back from a reset with the target baudrate and the binary outputs
+    Baudrate targetBaudrate = sensorBaudrate() == BAUDRATE_FASTEST
+                                  ? static_cast<Baudrate>(vn::sensors::VnSensor::supportedBaudrates()[vn::sensors::VnSensor::supportedBaudrates().size() - 1])
+                                  : sensorBaudrate();
+    _vs.connect(_connectedSensorPort, targetBaudrate);
+    if (!_vs.verifySensorConnectivity())
+    {
+        LOG_DEBUG("{}: Connected to port '{}', but sensor does not answer", nameId(), _connectedSensorPort);
+        _vs.disconnect();
+        return false;
+    }
+
+    _vs.registerAsyncPacketReceivedHandler(this, asciiOrBinaryAsyncMessageReceived);
+
+    return true;
+}
+
 void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_ptr<VectorNavBinaryOutput>& target, const std::shared_ptr<VectorNavBinaryOutput>& source)
 {
     target->insTime = !target->insTime.empty() ? target->insTime : source->insTime;
@@ -6618,6 +6674,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
 void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn::protocol::uart::Packet& p, [[maybe_unused]] size_t index)
 {
     auto* vnSensor = static_cast<VectorNavSensor*>(userData);
+    vnSensor->_watchdog.notifyPacket();
 
     LOG_DATA("{}: Received message", vnSensor->nameId());
 
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "Nodes/DataProvider/IMU/Imu.hpp"
+#include "Nodes/DataProvider/Protocol/SensorWatchdog.hpp"
 #include "Nodes/DataProvider/Protocol/UartSensor.hpp"
 #include "vn/sensors.h"
 
@@ -97,6 +98,10 @@ class VectorNavSensor : public Imu, public UartSensor
     /// @param[in] index Advanced usage item and can be safely ignored for now
     static void asciiOrBinaryAsyncMessageReceived(void* userData, vn::protocol::uart::Packet& p, size_t index);
 
+    /// @brief Disconnects the sensor and connects it again without reinitializing the flow (called by the watchdog)
+    /// @return True if the sensor is connected and answers again
+    bool reconnect();
+
     /// @brief VectorNav Model enumeration
     enum class VectorNavModel : int
     {
@@ -116,6 +121,9 @@ class VectorNavSensor : public Imu, public UartSensor
     /// Connected sensor port
     std::string _connectedSensorPort;
 
+    /// Watchdog which reconnects the sensor if no data is received
+    SensorWatchdog _watchdog;
+
     /// Internal Frequency of the Sensor
     static constexpr double IMU_DEFAULT_FREQUENCY = 800;
 
@@ -0,0 +1,232 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "SensorWatchdog.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+#include <imgui.h>
+#include <fmt/format.h>
+
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "util/Logger.hpp"
+
+namespace NAV
+{
+
+namespace
+{
+
+/// @brief Current time of the steady clock in [ns]
+int64_t steadyNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// @brief Converts seconds into the clock duration
+/// @param[in] seconds Duration in [s]
+std::chrono::nanoseconds toDuration(double seconds)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(std::max(seconds, 0.0)));
+}
+
+} // namespace
+
+SensorWatchdog::~SensorWatchdog()
+{
+    stop();
+}
+
+void SensorWatchdog::start(std::string name, ReconnectFunction reconnect)
+{
+    stop();
+
+    _name = std::move(name);
+    _reconnect = std::move(reconnect);
+    _lastPacketTime.store(steadyNow(), std::memory_order_relaxed);
+    _connected.store(true, std::memory_order_relaxed);
+
+    if (!enabled) { return; }
+
+    {
+        std::scoped_lock lk(_mutex);
+        _stopRequested = false;
+    }
+    _thread = std::thread(&SensorWatchdog::run, this, toDuration(timeout), toDuration(initialBackoff), toDuration(std::max(maxBackoff, initialBackoff)));
+}
+
+void SensorWatchdog::stop()
+{
+    {
+        std::scoped_lock lk(_mutex);
+        _stopRequested = true;
+    }
+    _cv.notify_all();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+    _connected.store(false, std::memory_order_relaxed);
+}
+
+bool SensorWatchdog::isRunning() const noexcept
+{
+    return _thread.joinable();
+}
+
+void SensorWatchdog::notifyPacket()
+{
+    _lastPacketTime.store(steadyNow(), std::memory_order_relaxed);
+    _packets.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SensorWatchdog::notifyChecksumError()
+{
+    _checksumErrors.fetch_add(1, std::memory_order_relaxed);
+}
+
+SensorWatchdog::Health SensorWatchdog::health() const
+{
+    return Health{
+        .packets = _packets.load(std::memory_order_relaxed),
+        .checksumErrors = _checksumErrors.load(std::memory_order_relaxed),
+        .gaps = _gaps.load(std::memory_order_relaxed),
+        .reconnects = _reconnects.load(std::memory_order_relaxed),
+        .failedReconnects = _failedReconnects.load(std::memory_order_relaxed),
+        .connected = _connected.load(std::memory_order_relaxed),
+        .timeSinceLastPacket = std::chrono::nanoseconds(steadyNow() - _lastPacketTime.load(std::memory_order_relaxed)),
+    };
+}
+
+void SensorWatchdog::resetCounters()
+{
+    _packets.store(0, std::memory_order_relaxed);
+    _checksumErrors.store(0, std::memory_order_relaxed);
+    _gaps.store(0, std::memory_order_relaxed);
+    _reconnects.store(0, std::memory_order_relaxed);
+    _failedReconnects.store(0, std::memory_order_relaxed);
+}
+
+void SensorWatchdog::run(std::chrono::nanoseconds timeout, std::chrono::nanoseconds initialBackoff, std::chrono::nanoseconds maxBackoff)
+{
+    // Check often enough to detect the timeout with less than 25 % delay, but do not spin
+    auto checkInterval = std::clamp(timeout / 4, std::chrono::nanoseconds(std::chrono::milliseconds(1)), std::chrono::nanoseconds(std::chrono::milliseconds(100)));
+
+    std::unique_lock lk(_mutex);
+    while (!_cv.wait_for(lk, checkInterval, [&]() { return _stopRequested; }))
+    {
+        auto silence = std::chrono::nanoseconds(steadyNow() - _lastPacketTime.load(std::memory_order_relaxed));
+        if (silence < timeout) { continue; }
+
+        _gaps.fetch_add(1, std::memory_order_relaxed);
+        _connected.store(false, std::memory_order_relaxed);
+        LOG_WARN("{}: No data received for {:.1f}s. Trying to reconnect the sensor.", _name, std::chrono::duration<double>(silence).count());
+
+        auto backoff = initialBackoff;
+        while (true)
+        {
+            lk.unlock();
+            bool success = tryReconnect();
+            lk.lock();
+            if (success)
+            {
+                _reconnects.fetch_add(1, std::memory_order_relaxed);
+                _connected.store(true, std::memory_order_relaxed);
+                _lastPacketTime.store(steadyNow(), std::memory_order_relaxed); // Give the sensor a full timeout to send data
+                LOG_INFO("{}: Sensor reconnected", _name);
+                break;
+            }
+            _failedReconnects.fetch_add(1, std::memory_order_relaxed);
+            LOG_DEBUG("{}: Reconnect failed, next attempt in {:.2f}s", _name, std::chrono::duration<double>(backoff).count());
+            if (_cv.wait_for(lk, backoff, [&]() { return _stopRequested; })) { return; }
+            backoff = std::min(2 * backoff, maxBackoff);
+        }
+    }
+}
+
+bool SensorWatchdog::tryReconnect()
+{
+    try
+    {
+        return _reconnect && _reconnect();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_DEBUG("{}: Reconnect threw an exception: {}", _name, e.what());
+    }
+    catch (...)
+    {
+        LOG_DEBUG("{}: Reconnect threw an exception", _name);
+    }
+    return false;
+}
+
+bool SensorWatchdog::ShowGuiWidgets(const char* id, float itemWidth)
+{
+    bool changed = false;
+
+    changed |= ImGui::Checkbox(fmt::format("Watchdog##{}", id).c_str(), &enabled);
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Reconnects the sensor if no data is received for the specified time.\n"
+                             "Changes to the settings are applied when the node is initialized again.");
+
+    if (!enabled) { ImGui::BeginDisabled(); }
+    ImGui::Indent();
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Timeout##{}", id).c_str(), &timeout, 1e-2, std::numeric_limits<double>::max(), 0.0, 0.0, "%.2f s");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Initial backoff##{}", id).c_str(), &initialBackoff, 1e-3, std::numeric_limits<double>::max(), 0.0, 0.0, "%.3f s");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Delay after the first failed reconnect attempt. The delay doubles with every further failed attempt.");
+
+    ImGui::SetNextItemWidth(itemWidth);
+    changed |= ImGui::InputDoubleL(fmt::format("Max. backoff##{}", id).c_str(), &maxBackoff, initialBackoff, std::numeric_limits<double>::max(), 0.0, 0.0, "%.3f s");
+
+    ImGui::Unindent();
+    if (!enabled) { ImGui::EndDisabled(); }
+
+    auto h = health();
+    ImGui::Text("Packets: %zu, Checksum errors: %zu", h.packets, h.checksumErrors);
+    ImGui::Text("Gaps: %zu, Reconnects: %zu (%zu failed attempts)", h.gaps, h.reconnects, h.failedReconnects);
+    if (isRunning())
+    {
+        ImGui::Text("%s, last packet %.1f s ago", h.connected ? "Connected" : "Disconnected", h.timeSinceLastPacket.count());
+    }
+    if (ImGui::Button(fmt::format("Reset counters##{}", id).c_str()))
+    {
+        resetCounters();
+    }
+
+    return changed;
+}
+
+void to_json(json& j, const SensorWatchdog& obj)
+{
+    j = json{
+        { "enabled", obj.enabled },
+        { "timeout", obj.timeout },
+        { "initialBackoff", obj.initialBackoff },
+        { "maxBackoff", obj.maxBackoff },
+    };
+}
+
+void from_json(const json& j, SensorWatchdog& obj)
+{
+    if (j.contains("enabled")) { j.at("enabled").get_to(obj.enabled); }
+    if (j.contains("timeout")) { j.at("timeout").get_to(obj.timeout); }
+    if (j.contains("initialBackoff")) { j.at("initialBackoff").get_to(obj.initialBackoff); }
+    if (j.contains("maxBackoff")) { j.at("maxBackoff").get_to(obj.maxBackoff); }
+}
+
+} // namespace NAV
@@ -0,0 +1,152 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SensorWatchdog.hpp
+/// @brief Watchdog which detects data starvation of a sensor and reconnects it
+/// @date 2026-10-18
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "util/Json.hpp"
+
+namespace NAV
+{
+/// @brief Watchdog which detects data starvation of a sensor and reconnects it with an exponential backoff
+///
+/// The sensor reports every received packet with notifyPacket(). If no packet arrives within the timeout, the watchdog
+/// thread calls the reconnect function until it succeeds. The delay between failed attempts starts with the initial
+/// backoff and doubles up to the maximum backoff. Only the sensor itself is reconnected, the flow keeps running.
+class SensorWatchdog
+{
+  public:
+    /// @brief Health counters of the sensor connection
+    struct Health
+    {
+        size_t packets = 0;                                        ///< Amount of received packets
+        size_t checksumErrors = 0;                                 ///< Amount of packets discarded because of checksum errors
+        size_t gaps = 0;                                           ///< Amount of detected data gaps (timeouts)
+        size_t reconnects = 0;                                     ///< Amount of successful reconnects
+        size_t failedReconnects = 0;                               ///< Amount of failed reconnect attempts
+        bool connected = false;                                    ///< Whether the sensor is currently connected
+        std::chrono::duration<double> timeSinceLastPacket{ 0.0 }; ///< Time since the last packet was received
+    };
+
+    /// @brief Function which disconnects the sensor and connects it again. Returns true on success, can throw on failure.
+    using ReconnectFunction = std::function<bool()>;
+
+    /// @brief Default constructor
+    SensorWatchdog() = default;
+    /// @brief Destructor
+    ~SensorWatchdog();
+    /// @brief Copy constructor
+    SensorWatchdog(const SensorWatchdog&) = delete;
+    /// @brief Move constructor
+    SensorWatchdog(SensorWatchdog&&) = delete;
+    /// @brief Copy assignment operator
+    SensorWatchdog& operator=(const SensorWatchdog&) = delete;
+    /// @brief Move assignment operator
+    SensorWatchdog& operator=(SensorWatchdog&&) = delete;
+
+    /// @brief Starts monitoring the sensor. Call this after the sensor was connected successfully.
+    /// @param[in] name Name of the sensor for log messages
+    /// @param[in] reconnect Function which reconnects the sensor (called from the watchdog thread)
+    void start(std::string name, ReconnectFunction reconnect);
+
+    /// @brief Stops monitoring. Has to be called before the sensor is disconnected.
+    void stop();
+
+    /// @brief Checks if the watchdog thread is currently running
+    [[nodiscard]] bool isRunning() const noexcept;
+
+    /// @brief Reports that a packet was received. Thread safe and cheap enough to be called for every packet.
+    void notifyPacket();
+
+    /// @brief Reports that a packet was discarded because of a wrong checksum
+    void notifyChecksumError();
+
+    /// @brief Returns a snapshot of the health counters
+    [[nodiscard]] Health health() const;
+
+    /// @brief Resets the health counters
+    void resetCounters();
+
+    /// @brief Shows the GUI input for the settings and the health counters
+    /// @param[in] id Unique id for ImGui.
+    /// @param[in] itemWidth Width of the widgets
+    /// @return True when something was changed
+    bool ShowGuiWidgets(const char* id, float itemWidth);
+
+    /// Whether the watchdog is enabled
+    bool enabled = true;
+    /// Time without packets after which the sensor is reconnected [s]
+    double timeout = 5.0;
+    /// Delay after the first failed reconnect attempt [s]
+    double initialBackoff = 0.5;
+    /// Maximum delay between reconnect attempts [s]
+    double maxBackoff = 30.0;
+
+  private:
+    /// @brief Monitoring loop of the watchdog thread
+    /// @param[in] timeout Time without packets after which the sensor is reconnected
+    /// @param[in] initialBackoff Delay after the first failed reconnect attempt
+    /// @param[in] maxBackoff Maximum delay between reconnect attempts
+    void run(std::chrono::nanoseconds timeout, std::chrono::nanoseconds initialBackoff, std::chrono::nanoseconds maxBackoff);
+
+    /// @brief Calls the reconnect function and catches all exceptions
+    /// @return True if the sensor is connected again
+    bool tryReconnect();
+
+    /// Name of the sensor for log messages
+    std::string _name;
+    /// Function which reconnects the sensor
+    ReconnectFunction _reconnect;
+
+    /// Time of the last received packet (steady clock) [ns]
+    std::atomic<int64_t> _lastPacketTime{ 0 };
+    /// Amount of received packets
+    std::atomic<size_t> _packets{ 0 };
+    /// Amount of checksum errors
+    std::atomic<size_t> _checksumErrors{ 0 };
+    /// Amount of detected data gaps
+    std::atomic<size_t> _gaps{ 0 };
+    /// Amount of successful reconnects
+    std::atomic<size_t> _reconnects{ 0 };
+    /// Amount of failed reconnect attempts
+    std::atomic<size_t> _failedReconnects{ 0 };
+    /// Whether the sensor is connected
+    std::atomic<bool> _connected{ false };
+
+    /// Mutex for the stop request
+    std::mutex _mutex;
+    /// Wakes the watchdog thread when a stop is requested
+    std::condition_variable _cv;
+    /// Flag whether the watchdog thread should stop
+    bool _stopRequested = false;
+    /// Watchdog thread
+    std::thread _thread;
+};
+
+/// @brief Converts the provided object into json
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] obj Object to convert into json
+void to_json(json& j, const SensorWatchdog& obj);
+/// @brief Converts the provided json object into a node object
+/// @param[in] j Json object with the needed values
+/// @param[out] obj Object to fill from the json
+void from_json(const json& j, SensorWatchdog& obj);
+
+} // namespace NAV
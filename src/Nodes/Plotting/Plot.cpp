@@ -1623,9 +1623,6 @@ bool NAV::Plot::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    CommonLog::initialize();
-
-    _startTime.reset();
     if (!_overridePositionStartValues) { _originPosition.reset(); }
 
     for (auto& pinData : _pinData)
@@ -1747,6 +1744,14 @@ void NAV::Plot::afterCreateLink(OutputPin& startPin, InputPin& endPin)
             for (const auto& desc : SppSolution::GetStaticDataDescriptors()) { _pinData.at(pinIndex).addPlotDataItem(i++, desc); }
             _pinData.at(pinIndex).dynamicDataStartIndex = static_cast<int>(i);
         }
+        else if (startPin.dataIdentifier.front() == TdcpSolution::type())
+        {
+            for (const auto& desc : TdcpSolution::GetStaticDataDescriptors()) { _pinData.at(pinIndex).addPlotDataItem(i++, desc); }
+        }
+        else if (startPin.dataIdentifier.front() == RtkSolution::type())
+        {
+            for (const auto& desc : RtkSolution::GetStaticDataDescriptors()) { _pinData.at(pinIndex).addPlotDataItem(i++, desc); }
+        }
         else if (startPin.dataIdentifier.front() == RtklibPosObs::type())
         {
             for (const auto& desc : RtklibPosObs::GetStaticDataDescriptors()) { _pinData.at(pinIndex).addPlotDataItem(i++, desc); }
@@ -1911,9 +1916,10 @@ void NAV::Plot::pinDeleteCallback(Node* node, size_t pinIdx)
 
 void NAV::Plot::addEvent(size_t pinIndex, InsTime insTime, const std::string& text, int32_t dataIndex)
 {
-    if (!insTime.empty() && !_startTime.empty())
+    if (auto startTime = CommonLog::startTime();
+        !insTime.empty() && !startTime.empty())
     {
-        double relTime = static_cast<double>((insTime - _startTime).count());
+        double relTime = static_cast<double>((insTime - startTime).count());
         _pinData.at(pinIndex).events.emplace_back(relTime, insTime, text, dataIndex);
     }
 }
@@ -1996,13 +2002,12 @@ void NAV::Plot::plotBoolean(const InsTime& insTime, size_t pinIdx)
     if (auto value = getInputValue<bool>(pinIdx);
         value && !insTime.empty())
     {
-        if (_startTime.empty()) { _startTime = insTime; }
         size_t i = 0;
 
         std::scoped_lock<std::mutex> guard(_pinData.at(pinIdx).mutex);
 
         // NodeData
-        addData(pinIdx, i++, static_cast<double>((insTime - _startTime).count()));
+        addData(pinIdx, i++, CommonLog::calcTimeIntoRun(insTime));
         addData(pinIdx, i++, static_cast<double>(insTime.toGPSweekTow().tow));
         // Boolean
         addData(pinIdx, i++, static_cast<double>(*value->v));
@@ -2021,13 +2026,12 @@ void NAV::Plot::plotInteger(const InsTime& insTime, size_t pinIdx)
     if (auto value = getInputValue<int>(pinIdx);
         value && !insTime.empty())
     {
-        if (_startTime.empty()) { _startTime = insTime; }
         size_t i = 0;
 
         std::scoped_lock<std::mutex> guard(_pinData.at(pinIdx).mutex);
 
         // NodeData
-        addData(pinIdx, i++, static_cast<double>((insTime - _startTime).count()));
+        addData(pinIdx, i++, CommonLog::calcTimeIntoRun(insTime));
         addData(pinIdx, i++, static_cast<double>(insTime.toGPSweekTow().tow));
         // Integer
         addData(pinIdx, i++, static_cast<double>(*value->v));
@@ -2046,13 +2050,12 @@ void NAV::Plot::plotFloat(const InsTime& insTime, size_t pinIdx)
     if (auto value = getInputValue<double>(pinIdx);
         value && !insTime.empty())
     {
-        if (_startTime.empty()) { _startTime = insTime; }
         size_t i = 0;
 
         std::scoped_lock<std::mutex> guard(_pinData.at(pinIdx).mutex);
 
         // NodeData
-        addData(pinIdx, i++, static_cast<double>((insTime - _startTime).count()));
+        addData(pinIdx, i++, CommonLog::calcTimeIntoRun(insTime));
         addData(pinIdx, i++, static_cast<double>(insTime.toGPSweekTow().tow));
         // Double
         addData(pinIdx, i++, *value->v);
@@ -2075,13 +2078,12 @@ void NAV::Plot::plotMatrix(const InsTime& insTime, size_t pinIdx)
             if (auto value = getInputValue<Eigen::MatrixXd>(pinIdx);
                 value && !insTime.empty())
             {
-                if (_startTime.empty()) { _startTime = insTime; }
                 size_t i = 0;
 
                 std::scoped_lock<std::mutex> guard(_pinData.at(pinIdx).mutex);
 
                 // NodeData
-                addData(pinIdx, i++, static_cast<double>((insTime - _startTime).count()));
+                addData(pinIdx, i++, CommonLog::calcTimeIntoRun(insTime));
                 addData(pinIdx, i++, static_cast<double>(insTime.toGPSweekTow().tow));
                 // Matrix
                 for (int row = 0; row < value->v->rows(); row++)
@@ -2098,13 +2100,12 @@ void NAV::Plot::plotMatrix(const InsTime& insTime, size_t pinIdx)
             if (auto value = getInputValue<Eigen::VectorXd>(pinIdx);
                 value && !insTime.empty())
             {
-                if (_startTime.empty()) { _startTime = insTime; }
                 size_t i = 0;
 
                 std::scoped_lock<std::mutex> guard(_pinData.at(pinIdx).mutex);
 
                 // NodeData
-                addData(pinIdx, i++, static_cast<double>((insTime - _startTime).count()));
+                addData(pinIdx, i++, CommonLog::calcTimeIntoRun(insTime));
                 addData(pinIdx, i++, static_cast<double>(insTime.toGPSweekTow().tow));
                 // Vector
                 for (int row = 0; row < value->v->rows(); row++)
@@ -2200,6 +2201,14 @@ void NAV::Plot::plotFlowData(NAV::InputPin::NodeDataQueue& queue, size_t pinIdx)
                 plotData(std::static_pointer_cast<const SppSolution>(nodeData), pinIdx, i, Pos::GetStaticDescriptorCount());
                 plotSppSolutionDynamicData(std::static_pointer_cast<const SppSolution>(nodeData), pinIdx);
             }
+            else if (sourcePin->dataIdentifier.front() == TdcpSolution::type())
+            {
+                plotData(std::static_pointer_cast<const TdcpSolution>(nodeData), pinIdx, i, Pos::GetStaticDescriptorCount());
+            }
+            else if (sourcePin->dataIdentifier.front() == RtkSolution::type())
+            {
+                plotData(std::static_pointer_cast<const RtkSolution>(nodeData), pinIdx, i, Pos::GetStaticDescriptorCount());
+            }
             else if (sourcePin->dataIdentifier.front() == RtklibPosObs::type())
             {
                 plotData(std::static_pointer_cast<const RtklibPosObs>(nodeData), pinIdx, i, Pos::GetStaticDescriptorCount());
@@ -2254,7 +2263,7 @@ void NAV::Plot::plotGnssCombination(const std::shared_ptr<const GnssCombination>
     {
         for (const auto& [insTime, poly, value] : comb.cycleSlipPolynomials)
         {
-            auto t = static_cast<double>((insTime - _startTime).count());
+            auto t = CommonLog::calcTimeIntoRun(insTime);
             addData(pinIndex, fmt::format("{} [{:.1f}] ({})", comb.description, t, poly.toString()), value);
         }
     }
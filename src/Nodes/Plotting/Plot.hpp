@@ -32,6 +32,8 @@
 #include "NodeData/GNSS/GnssObs.hpp"
 #include "NodeData/GNSS/RtklibPosObs.hpp"
 #include "NodeData/GNSS/SppSolution.hpp"
+#include "NodeData/GNSS/TdcpSolution.hpp"
+#include "NodeData/GNSS/RtkSolution.hpp"
 #include "NodeData/IMU/ImuObs.hpp"
 #include "NodeData/IMU/ImuObsSimulated.hpp"
 #include "NodeData/IMU/ImuObsWDelta.hpp"
@@ -385,6 +387,8 @@ class Plot : public Node, public CommonLog
         GnssObs::type(),
         RtklibPosObs::type(),
         SppSolution::type(),
+        TdcpSolution::type(),
+        RtkSolution::type(),
         // IMU
         ImuObs::type(),
         ImuObsSimulated::type(),
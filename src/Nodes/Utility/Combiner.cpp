@@ -374,8 +374,6 @@ bool Combiner::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    CommonLog::initialize();
-
     for (auto& comb : _combinations)
     {
         for (auto& term : comb.terms)
@@ -470,6 +468,14 @@ void Combiner::receiveData(InputPin::NodeDataQueue& queue, size_t pinIdx)
 
             auto value = std::holds_alternative<size_t>(term.dataSelection) ? nodeData->getValueAt(std::get<size_t>(term.dataSelection))
                                                                             : nodeData->getDynamicDataAt(std::get<std::string>(term.dataSelection));
+            if (const auto* idx = std::get_if<size_t>(&term.dataSelection); idx && (*idx == 3 || *idx == 4))
+            {
+                if (auto pos = std::dynamic_pointer_cast<const Pos>(nodeData)) // North/South and East/West are relative to the origin of the run
+                {
+                    auto localPosition = calcLocalPosition(pos->lla_position());
+                    value = *idx == 3 ? localPosition.northSouth : localPosition.eastWest;
+                }
+            }
             if (!value) { continue; }
 
             LOG_DATA("{}:     Term '{}': {:.3g}", nameId(), term.description(this, getDataDescriptors(term.pinIndex)), *value);
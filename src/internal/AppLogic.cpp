@@ -16,6 +16,9 @@
 #include "internal/ConfigManager.hpp"
 #include "internal/FlowManager.hpp"
 #include "internal/FlowExecutor.hpp"
+#include "internal/LiveReconfiguration.hpp"
+#include "internal/NumericSentinel.hpp"
+#include "internal/ObservationQCBatch.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
@@ -54,6 +57,8 @@ int NAV::AppLogic::processCommandLineArguments(int argc, const char* argv[]) //
         LOG_ERROR("Could not open the config file: {}", configFile);
     }
 
+    NAV::NumericSentinel::applyConfig();
+
     // Register all Node Types which are available to the program
     NAV::NodeRegistry::RegisterNodeTypes();
 
@@ -67,6 +72,12 @@ int NAV::AppLogic::processCommandLineArguments(int argc, const char* argv[]) //
         LOG_WARN("You are running INSTINCT on a platform without quadruple-precision floating-point support. Functionality concerning time measurements and ranging could be affected by the precision loss.");
     }
 
+    if (NAV::ConfigManager::HasKey("obs-qc"))
+    {
+        LOG_INFO("Running the quality control of observation files");
+        return NAV::ObservationQCBatch::runFromConfig() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     if (NAV::ConfigManager::Get<bool>("nogui"))
     {
         LOG_INFO("Starting in No-GUI Mode");
@@ -94,6 +105,16 @@ int NAV::AppLogic::processCommandLineArguments(int argc, const char* argv[]) //
 
                 NAV::FlowExecutor::start();
 
+                if (NAV::ConfigManager::Get<bool>("nogui") && NAV::ConfigManager::HasKey("reconfig"))
+                {
+                    std::filesystem::path reconfigPath = NAV::ConfigManager::Get<std::string>("reconfig");
+                    if (reconfigPath.is_relative())
+                    {
+                        reconfigPath = NAV::flow::GetProgramRootPath() / reconfigPath;
+                    }
+                    NAV::LiveReconfiguration::startFileWatcher(reconfigPath);
+                }
+
                 if (NAV::ConfigManager::Get<bool>("nogui")
                     && (NAV::ConfigManager::Get<bool>("sigterm") || NAV::ConfigManager::Get<size_t>("duration")))
                 {
@@ -123,6 +144,7 @@ int NAV::AppLogic::processCommandLineArguments(int argc, const char* argv[]) //
                 nm::CallCleanupCallback();
 #endif
 
+                NAV::LiveReconfiguration::stopFileWatcher();
                 nm::DisableAllCallbacks();
                 nm::DeleteAllNodes();
             }
@@ -49,6 +49,13 @@ void NAV::ConfigManager::initialize()
             ("nogui",             bpo::bool_switch()->default_value(false),                         "Launch without the gui"                                                                  )
             ("noinit",            bpo::bool_switch()->default_value(false),                         "Do not initialize flows after loading them"                                              )
             ("load,l",            bpo::value<std::string>(),                                        "Flow file to load"                                                                       )
+            ("reconfig",          bpo::value<std::string>(),                                        "Control file with parameter changes, applied to the running flow on change or -SIGHUP"   )
+            ("check-numerics",    bpo::bool_switch()->default_value(false),                         "Check the data on output pins for NaN, Inf and implausible magnitudes"                   )
+            ("check-numerics-halt", bpo::bool_switch()->default_value(false),                       "Check the data on output pins and stop the flow at the first violation"                  )
+            ("check-numerics-limit", bpo::value<double>()->default_value(1e12),                     "Largest plausible absolute value of fields without a specific limit"                     )
+            ("obs-qc",            bpo::value<std::vector<std::string>>()->multitoken(),             "RINEX observation files or directories to run the quality control on (headless)"         )
+            ("obs-qc-output",     bpo::value<std::string>()->default_value("obs-qc.jsonl"),         "JSON Lines file for the quality control reports (relative to the output path)"           )
+            ("obs-qc-threads",    bpo::value<size_t>()->default_value(0),                           "Amount of threads for the quality control (0: hardware concurrency)"                     )
             ("rotate-output",     bpo::bool_switch()->default_value(false),                         "Create new folders for output files"                                                     )
             ("output-path,o",     bpo::value<std::string>()->default_value("logs"),                 "Directory path for logs and output files"                                                )
             ("input-path,i",      bpo::value<std::string>()->default_value("data"),                 "Directory path for searching input files"                                                )
@@ -0,0 +1,426 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Engine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "internal/ConfigManager.hpp"
+#include "internal/FlowExecutor.hpp"
+#include "internal/FlowManager.hpp"
+#include "internal/LiveReconfiguration.hpp"
+#include "internal/NumericSentinel.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "NodeRegistry.hpp"
+#include "util/Logger.hpp"
+#include "util/Time/TimeBase.hpp"
+
+namespace NAV
+{
+namespace
+{
+
+/// Flag whether an engine exists, because the engine owns the global state of the program
+std::atomic<bool> engineExists = false;
+
+/// @brief Orders the nodes, so that every node comes after the nodes sending data to it (nodes in loops come last)
+std::vector<Node*> flowOrder()
+{
+    std::vector<Node*> nodes;
+    std::vector<Node*> remaining;
+    for (Node* node : nm::m_Nodes())
+    {
+        if (node != nullptr && node->kind != Node::Kind::GroupBox) { remaining.push_back(node); }
+    }
+
+    while (!remaining.empty())
+    {
+        auto iter = std::find_if(remaining.begin(), remaining.end(), [&remaining](const Node* node) {
+            return std::none_of(node->inputPins.begin(), node->inputPins.end(), [&remaining](const InputPin& inputPin) {
+                return std::find(remaining.begin(), remaining.end(), inputPin.link.connectedNode) != remaining.end();
+            });
+        });
+        if (iter == remaining.end()) { iter = remaining.begin(); } // Loop in the flow
+        nodes.push_back(*iter);
+        remaining.erase(iter);
+    }
+    return nodes;
+}
+
+} // namespace
+} // namespace NAV
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                  Input                                                   */
+/* -------------------------------------------------------------------------------------------------------- */
+
+NAV::Engine::Input::Input(std::string name, const std::vector<std::string>& dataIdentifier)
+    : Node(std::move(name))
+{
+    LOG_TRACE("{}: called", this->name);
+    _hasConfig = false;
+    kind = Kind::Simple;
+
+    nm::CreateOutputPin(this, "Output", Pin::Type::Flow, dataIdentifier, &Input::peekPollData);
+}
+
+std::string NAV::Engine::Input::typeStatic()
+{
+    return "EngineInput";
+}
+
+std::string NAV::Engine::Input::type() const
+{
+    return typeStatic();
+}
+
+void NAV::Engine::Input::push(const std::shared_ptr<const NodeData>& data)
+{
+    if (data == nullptr || data->insTime.empty())
+    {
+        LOG_ERROR("{}: Data needs a time to be sent into the flow", nameId());
+        return;
+    }
+
+    std::scoped_lock lk(_mutex);
+    // Data older than the data already sent is sent next
+    auto iter = std::upper_bound(std::next(_data.begin(), static_cast<std::ptrdiff_t>(_next)), _data.end(), data->insTime,
+                                 [](const InsTime& insTime, const std::shared_ptr<const NodeData>& other) { return insTime < other->insTime; });
+    _data.insert(iter, data);
+}
+
+void NAV::Engine::Input::clear()
+{
+    std::scoped_lock lk(_mutex);
+    _data.clear();
+    _next = 0;
+}
+
+size_t NAV::Engine::Input::size() const
+{
+    std::scoped_lock lk(_mutex);
+    return _data.size();
+}
+
+bool NAV::Engine::Input::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    std::scoped_lock lk(_mutex);
+    _next = 0;
+    return true;
+}
+
+std::shared_ptr<const NAV::NodeData> NAV::Engine::Input::peekPollData(size_t /* pinIdx */, bool peek)
+{
+    std::scoped_lock lk(_mutex);
+    if (_next >= _data.size()) { return nullptr; }
+    if (peek) { return _data.at(_next); }
+
+    auto data = _data.at(_next++);
+    invokeCallbacks(OUTPUT_PORT_INDEX_DATA, data);
+    return data;
+}
+
+NAV::InsTime NAV::Engine::Input::nextTime() const
+{
+    std::scoped_lock lk(_mutex);
+    return _next < _data.size() ? _data.at(_next)->insTime : InsTime{};
+}
+
+void NAV::Engine::Input::sendNext()
+{
+    std::scoped_lock lk(_mutex);
+    if (_next < _data.size()) { invokeCallbacks(OUTPUT_PORT_INDEX_DATA, _data.at(_next++)); }
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                  Output                                                  */
+/* -------------------------------------------------------------------------------------------------------- */
+
+NAV::Engine::Output::Output(std::string name, const std::vector<std::string>& dataIdentifier)
+    : Node(std::move(name))
+{
+    LOG_TRACE("{}: called", this->name);
+    _hasConfig = false;
+    kind = Kind::Simple;
+
+    nm::CreateInputPin(this, "Input", Pin::Type::Flow, dataIdentifier, &Output::receiveData);
+}
+
+std::string NAV::Engine::Output::typeStatic()
+{
+    return "EngineOutput";
+}
+
+std::string NAV::Engine::Output::type() const
+{
+    return typeStatic();
+}
+
+void NAV::Engine::Output::setCallback(Callback callback)
+{
+    std::scoped_lock lk(_mutex);
+    _callback = std::move(callback);
+}
+
+std::vector<std::shared_ptr<const NAV::NodeData>> NAV::Engine::Output::received() const
+{
+    std::scoped_lock lk(_mutex);
+    return _received;
+}
+
+void NAV::Engine::Output::clear()
+{
+    std::scoped_lock lk(_mutex);
+    _received.clear();
+}
+
+void NAV::Engine::Output::receiveData(InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto data = queue.extract_front();
+
+    std::scoped_lock lk(_mutex);
+    if (_callback) { _callback(data); }
+    else { _received.push_back(data); }
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                  Engine                                                  */
+/* -------------------------------------------------------------------------------------------------------- */
+
+NAV::Engine::Engine() : Engine(Options{}) {}
+
+NAV::Engine::Engine(const Options& options)
+{
+    if (engineExists.exchange(true))
+    {
+        LOG_CRITICAL("Only one engine can exist at a time, because it owns the global state of the program");
+    }
+
+    ConfigManager::initialize();
+
+    std::vector<std::string> arguments = { "", "--nogui",
+                                           "--input-path=" + options.inputPath,
+                                           "--output-path=" + options.outputPath };
+    arguments.insert(arguments.end(), options.arguments.begin(), options.arguments.end());
+    std::vector<const char*> argv;
+    argv.reserve(arguments.size());
+    for (const auto& argument : arguments) { argv.push_back(argument.c_str()); }
+
+    flow::SetProgramRootPath(options.rootPath);
+    auto failedConfigFiles = ConfigManager::FetchConfigs(static_cast<int>(argv.size()), argv.data());
+    flow::SetOutputPath();
+
+    if (!options.logFile.empty())
+    {
+        _logger = std::make_unique<::Logger>((flow::GetOutputPath() / options.logFile).string());
+    }
+    for ([[maybe_unused]] const auto& configFile : failedConfigFiles)
+    {
+        LOG_ERROR("Could not open the config file: {}", configFile);
+    }
+
+    NumericSentinel::applyConfig();
+
+    NodeRegistry::RegisterNodeTypes();
+    NodeRegistry::RegisterNodeDataTypes();
+
+    util::time::SetCurrentTimeToComputerTime();
+
+    nm::showFlowWhenInvokingCallbacks = false;
+    nm::showFlowWhenNotifyingValueChange = false;
+}
+
+NAV::Engine::~Engine()
+{
+    FlowExecutor::stop();
+    LiveReconfiguration::stopFileWatcher();
+    nm::DisableAllCallbacks();
+    nm::DeleteAllNodes();
+#ifdef TESTING
+    nm::ClearRegisteredCallbacks();
+#endif
+    flow::SetCurrentFilename("");
+    ConfigManager::deinitialize();
+
+    _logger.reset();
+    engineExists = false;
+}
+
+bool NAV::Engine::loadFlow(const std::filesystem::path& path)
+{
+    FlowExecutor::stop();
+
+    std::filesystem::path filepath = path.is_relative() ? flow::GetProgramRootPath() / path : path;
+    bool loadSuccessful = false;
+    try
+    {
+        loadSuccessful = flow::LoadFlow(filepath.string());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Loading flow file '{}' failed: {}", filepath, e.what());
+    }
+    if (!loadSuccessful) { clear(); }
+    return loadSuccessful;
+}
+
+NAV::Engine::Input* NAV::Engine::addInput(const std::string& name, const std::vector<std::string>& dataIdentifier)
+{
+    auto* node = new Input(name, dataIdentifier); // NOLINT(cppcoreguidelines-owning-memory)
+    addToFlow(node);
+    return node;
+}
+
+NAV::Engine::Output* NAV::Engine::addOutput(const std::string& name, const std::vector<std::string>& dataIdentifier)
+{
+    auto* node = new Output(name, dataIdentifier); // NOLINT(cppcoreguidelines-owning-memory)
+    addToFlow(node);
+    return node;
+}
+
+bool NAV::Engine::link(Node* startNode, size_t outputPinIdx, Node* endNode, size_t inputPinIdx)
+{
+    if (startNode == nullptr || endNode == nullptr
+        || outputPinIdx >= startNode->outputPins.size() || inputPinIdx >= endNode->inputPins.size())
+    {
+        LOG_ERROR("Can not link output pin {} of node {} to input pin {} of node {}, because a node or pin does not exist",
+                  outputPinIdx, startNode ? startNode->nameId() : "nullptr", inputPinIdx, endNode ? endNode->nameId() : "nullptr");
+        return false;
+    }
+    return startNode->outputPins.at(outputPinIdx).createLink(endNode->inputPins.at(inputPinIdx));
+}
+
+NAV::Node* NAV::Engine::findNode(const std::string& idOrName)
+{
+    return LiveReconfiguration::findNode(idOrName);
+}
+
+void NAV::Engine::clear()
+{
+    FlowExecutor::stop();
+    nm::DeleteAllNodes();
+    flow::SetCurrentFilename("");
+}
+
+bool NAV::Engine::run()
+{
+    FlowExecutor::stop();
+    setRealTime(false);
+
+    FlowExecutor::start();
+    FlowExecutor::waitForFinish();
+
+    return std::all_of(nm::m_Nodes().begin(), nm::m_Nodes().end(), [](const Node* node) {
+        return node->kind == Node::Kind::GroupBox || node->isDisabled() || node->isInitialized();
+    });
+}
+
+bool NAV::Engine::start()
+{
+    FlowExecutor::stop();
+    setRealTime(true);
+
+    FlowExecutor::start();
+    // The executor enables the callbacks after initializing and resetting all nodes
+    while (FlowExecutor::isRunning())
+    {
+        if (std::all_of(nm::m_Nodes().begin(), nm::m_Nodes().end(), [](const Node* node) {
+                return node->kind == Node::Kind::GroupBox || node->isDisabled() || (node->isInitialized() && node->callbacksEnabled);
+            }))
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+bool NAV::Engine::stepUntil(const InsTime& time, std::chrono::milliseconds timeout)
+{
+    if (!FlowExecutor::isRunning())
+    {
+        LOG_ERROR("The flow has to be started before stepping it");
+        return false;
+    }
+
+    std::vector<Input*> inputs;
+    for (Node* node : nm::m_Nodes())
+    {
+        if (auto* input = dynamic_cast<Input*>(node)) { inputs.push_back(input); }
+    }
+
+    // Sending in time order over all inputs lets every node receive its data in time order
+    while (true)
+    {
+        Input* earliestInput = nullptr;
+        InsTime earliestTime;
+        for (auto* input : inputs)
+        {
+            if (InsTime nextTime = input->nextTime();
+                !nextTime.empty() && nextTime <= time && (earliestTime.empty() || nextTime < earliestTime))
+            {
+                earliestInput = input;
+                earliestTime = nextTime;
+            }
+        }
+        if (earliestInput == nullptr) { break; }
+        earliestInput->sendNext();
+    }
+
+    return waitUntilIdle(timeout);
+}
+
+bool NAV::Engine::waitUntilIdle(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto nodes = flowOrder();
+
+    // Checking the nodes in flow order catches data moving on to the next node while checking. The second pass catches the
+    // short moment, in which a worker took a message from a queue but did not start processing it yet.
+    size_t idlePasses = 0;
+    while (idlePasses < 2)
+    {
+        if (std::all_of(nodes.begin(), nodes.end(), [](Node* node) { return node->isIdle(); })) { idlePasses++; }
+        else { idlePasses = 0; }
+
+        if (idlePasses < 2)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                LOG_WARN("The flow did not finish processing its data within {} ms", timeout.count());
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    return true;
+}
+
+void NAV::Engine::stop()
+{
+    FlowExecutor::stop();
+}
+
+void NAV::Engine::addToFlow(Node* node)
+{
+    FlowExecutor::stop();
+    nm::AddNode(node);
+}
+
+void NAV::Engine::setRealTime(bool realTime)
+{
+    for (Node* node : nm::m_Nodes())
+    {
+        if (auto* input = dynamic_cast<Input*>(node)) { input->setRealTime(realTime); }
+    }
+}
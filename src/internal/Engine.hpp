@@ -0,0 +1,273 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Engine.hpp
+/// @brief Headless API to embed the flow engine into other programs
+/// @date 2026-10-18
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "NodeData/NodeData.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+class Logger;
+
+namespace NAV
+{
+
+/// @brief Headless flow engine
+///
+/// Owns the global state of the program (configuration, registered node types and the nodes of the flow) for its lifetime,
+/// so that a program can construct, run and destroy flows repeatedly. Only one engine can exist at a time.
+///
+/// Data is fed with Input nodes and received with Output nodes, which can be linked to the nodes of a loaded or constructed
+/// flow. The flow can either run to completion (post-processing), or be stepped in time (real-time):
+/// @code
+/// Engine engine;
+/// engine.loadFlow("flow/ImuIntegration.flow");
+/// auto* input = engine.addInput("IMU", { ImuObs::type() });
+/// auto* output = engine.addOutput("Solution", { PosVelAtt::type() });
+/// Engine::link(input, 0, engine.findNode("ImuIntegrator"), 0);
+/// Engine::link(engine.findNode("ImuIntegrator"), 0, output, 0);
+/// input->push(obs);
+/// engine.run();
+/// auto solutions = output->received();
+/// @endcode
+class Engine
+{
+  public:
+    /// @brief Options of the engine
+    struct Options
+    {
+        std::filesystem::path rootPath = std::filesystem::current_path(); ///< Root path for relative paths
+        std::string inputPath = "data";                                     ///< Input path relative to the root path
+        std::string outputPath = "logs";                                    ///< Output path relative to the root path
+        std::filesystem::path logFile;                                      ///< Log file relative to the output path (empty: no logger is created)
+        std::vector<std::string> arguments;                                 ///< Further program options in command line format
+    };
+
+    /// @brief Node which feeds data into the flow
+    class Input : public Node
+    {
+      public:
+        /// @brief Constructor
+        /// @param[in] name Name of the node
+        /// @param[in] dataIdentifier Data types provided on the output pin
+        Input(std::string name, const std::vector<std::string>& dataIdentifier);
+        /// @brief Destructor
+        ~Input() override = default;
+        /// @brief Copy constructor
+        Input(const Input&) = delete;
+        /// @brief Move constructor
+        Input(Input&&) = delete;
+        /// @brief Copy assignment operator
+        Input& operator=(const Input&) = delete;
+        /// @brief Move assignment operator
+        Input& operator=(Input&&) = delete;
+
+        /// @brief String representation of the Class Type
+        [[nodiscard]] static std::string typeStatic();
+
+        /// @brief String representation of the Class Type
+        [[nodiscard]] std::string type() const override;
+
+        /// @brief Adds data to the buffer, sorted by time. The buffer is replayed from the start whenever the flow starts.
+        /// @param[in] data Data with a time
+        void push(const std::shared_ptr<const NodeData>& data);
+
+        /// @brief Removes all buffered data
+        void clear();
+
+        /// @brief Amount of buffered data
+        [[nodiscard]] size_t size() const;
+
+      private:
+        constexpr static size_t OUTPUT_PORT_INDEX_DATA = 0; ///< @brief Flow
+
+        friend class Engine;
+
+        /// @brief Resets the node. It is guaranteed that the node is initialized when this is called.
+        bool resetNode() override;
+
+        /// @brief Polls the next buffered data in post-processing
+        /// @param[in] pinIdx Index of the pin the data is requested on
+        /// @param[in] peek Whether to only peek the data and not invoke the callbacks
+        std::shared_ptr<const NodeData> peekPollData(size_t pinIdx, bool peek);
+
+        /// @brief Time of the next buffered data, which was not sent yet (empty if there is none)
+        [[nodiscard]] InsTime nextTime() const;
+
+        /// @brief Sends the next buffered data to the connected nodes
+        void sendNext();
+
+        /// @brief Switches between stepping in real-time and running to completion in post-processing
+        /// @param[in] realTime Whether the flow is stepped
+        void setRealTime(bool realTime) { _onlyRealTime = realTime; }
+
+        mutable std::mutex _mutex;                         ///< Mutex for the buffer
+        std::deque<std::shared_ptr<const NodeData>> _data; ///< Buffered data, sorted by time
+        size_t _next = 0;                                  ///< Index of the next data to send
+    };
+
+    /// @brief Node which receives data from the flow
+    class Output : public Node
+    {
+      public:
+        /// Function called with every received message (on the worker thread of the node)
+        using Callback = std::function<void(const std::shared_ptr<const NodeData>&)>;
+
+        /// @brief Constructor
+        /// @param[in] name Name of the node
+        /// @param[in] dataIdentifier Data types accepted on the input pin
+        Output(std::string name, const std::vector<std::string>& dataIdentifier);
+        /// @brief Destructor
+        ~Output() override = default;
+        /// @brief Copy constructor
+        Output(const Output&) = delete;
+        /// @brief Move constructor
+        Output(Output&&) = delete;
+        /// @brief Copy assignment operator
+        Output& operator=(const Output&) = delete;
+        /// @brief Move assignment operator
+        Output& operator=(Output&&) = delete;
+
+        /// @brief String representation of the Class Type
+        [[nodiscard]] static std::string typeStatic();
+
+        /// @brief String representation of the Class Type
+        [[nodiscard]] std::string type() const override;
+
+        /// @brief Sets a function which is called with every received message instead of storing it
+        /// @param[in] callback Function to call (nullptr to store the messages again)
+        void setCallback(Callback callback);
+
+        /// @brief Returns the messages stored since the creation of the node or the last clear()
+        [[nodiscard]] std::vector<std::shared_ptr<const NodeData>> received() const;
+
+        /// @brief Removes the stored messages
+        void clear();
+
+      private:
+        constexpr static size_t INPUT_PORT_INDEX_DATA = 0; ///< @brief Flow
+
+        /// @brief Callback when receiving data on a port
+        /// @param[in] queue Queue with all the received data messages
+        /// @param[in] pinIdx Index of the pin the data is received on
+        void receiveData(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+        mutable std::mutex _mutex;                             ///< Mutex for the received data and the callback
+        Callback _callback;                                    ///< Function called with every received message
+        std::vector<std::shared_ptr<const NodeData>> _received; ///< Received messages
+    };
+
+    /// @brief Constructor. Initializes the global state of the program.
+    /// @param[in] options Options of the engine
+    explicit Engine(const Options& options);
+    /// @brief Default constructor
+    Engine();
+    /// @brief Destructor. Stops the flow, deletes all nodes and resets the global state.
+    ~Engine();
+    /// @brief Copy constructor
+    Engine(const Engine&) = delete;
+    /// @brief Move constructor
+    Engine(Engine&&) = delete;
+    /// @brief Copy assignment operator
+    Engine& operator=(const Engine&) = delete;
+    /// @brief Move assignment operator
+    Engine& operator=(Engine&&) = delete;
+
+    /// @brief Replaces the current flow with the flow from a file
+    /// @param[in] path Path to the flow file (relative paths are relative to the root path)
+    /// @return True if the flow could be loaded
+    bool loadFlow(const std::filesystem::path& path);
+
+    /// @brief Adds a node of the given type to the flow
+    /// @tparam T Node type
+    /// @return Pointer to the node, which is owned by the flow
+    template<typename T, typename = std::enable_if_t<std::is_base_of_v<Node, T>>>
+    T* addNode()
+    {
+        auto* node = new T(); // NOLINT(cppcoreguidelines-owning-memory)
+        addToFlow(node);
+        return node;
+    }
+
+    /// @brief Adds an Input node to the flow
+    /// @param[in] name Name of the node
+    /// @param[in] dataIdentifier Data types provided on the output pin
+    /// @return Pointer to the node, which is owned by the flow
+    Input* addInput(const std::string& name, const std::vector<std::string>& dataIdentifier = { NodeData::type() });
+
+    /// @brief Adds an Output node to the flow
+    /// @param[in] name Name of the node
+    /// @param[in] dataIdentifier Data types accepted on the input pin
+    /// @return Pointer to the node, which is owned by the flow
+    Output* addOutput(const std::string& name, const std::vector<std::string>& dataIdentifier = { NodeData::type() });
+
+    /// @brief Links an output pin to an input pin
+    /// @param[in] startNode Node of the output pin
+    /// @param[in] outputPinIdx Index of the output pin
+    /// @param[in] endNode Node of the input pin
+    /// @param[in] inputPinIdx Index of the input pin
+    /// @return True if the pins exist and are compatible
+    static bool link(Node* startNode, size_t outputPinIdx, Node* endNode, size_t inputPinIdx);
+
+    /// @brief Finds the node with the given id or name
+    /// @param[in] idOrName Node id or unique node name
+    /// @return Pointer to the node or nullptr if not found or the name is ambiguous
+    [[nodiscard]] static Node* findNode(const std::string& idOrName);
+
+    /// @brief Deletes all nodes of the flow
+    void clear();
+
+    /// @brief Runs the flow in post-processing until all data is processed
+    /// @return True if all enabled nodes could be initialized
+    bool run();
+
+    /// @brief Starts the flow in real-time, so that it can be stepped with stepUntil()
+    /// @return True if all enabled nodes could be initialized
+    bool start();
+
+    /// @brief Sends the data of all Input nodes up to the given time (in time order) and waits until the flow processed it
+    /// @param[in] time Time up to which the data is sent (inclusive)
+    /// @param[in] timeout Maximum time to wait for the flow
+    /// @return True if the flow processed all data within the timeout
+    bool stepUntil(const InsTime& time, std::chrono::milliseconds timeout = std::chrono::minutes(1));
+
+    /// @brief Waits until no node has data left to process
+    /// @param[in] timeout Maximum time to wait
+    /// @return True if the flow became idle within the timeout
+    bool waitUntilIdle(std::chrono::milliseconds timeout = std::chrono::minutes(1));
+
+    /// @brief Stops the flow. The nodes stay initialized, so that the flow can be started again.
+    void stop();
+
+  private:
+    /// @brief Adds a node to the flow
+    /// @param[in] node Node to add. The flow takes the ownership.
+    static void addToFlow(Node* node);
+
+    /// @brief Switches all Input nodes between real-time and post-processing
+    /// @param[in] realTime Whether the flow is stepped
+    static void setRealTime(bool realTime);
+
+    /// Logger, if requested in the options
+    std::unique_ptr<::Logger> _logger;
+};
+
+} // namespace NAV
@@ -16,7 +16,9 @@
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "internal/ConfigManager.hpp"
+#include "internal/NumericSentinel.hpp"
 #include "util/Time/TimeBase.hpp"
+#include "util/Logger/CommonLog.hpp"
 
 #include <chrono>
 #include <map>
@@ -51,6 +53,7 @@ State _state = State::Idle;
 std::thread _thd;
 std::atomic<size_t> _activeNodes{ 0 };
 std::chrono::time_point<std::chrono::steady_clock> _startTime;
+std::shared_ptr<NAV::CommonLog::RunContext> _runContext;
 
 /* -------------------------------------------------------------------------------------------------------- */
 /*                                       Private Function Declarations                                      */
@@ -109,6 +112,18 @@ void NAV::FlowExecutor::stop()
     if (_thd.joinable()) { _thd.join(); }
 }
 
+void NAV::FlowExecutor::requestStop()
+{
+    LOG_TRACE("called");
+
+    std::scoped_lock<std::mutex> lk(_mutex);
+    if (_state == State::Running || _state == State::Starting)
+    {
+        _state = State::Stopping;
+        _cv.notify_all();
+    }
+}
+
 void NAV::FlowExecutor::waitForFinish()
 {
     LOG_TRACE("Waiting for finish of FlowExecutor...");
@@ -151,6 +166,14 @@ void NAV::FlowExecutor::execute()
         node->pollEvents.clear();
     }
 
+    NumericSentinel::reset();
+
+    _runContext = std::make_shared<CommonLog::RunContext>();
+    for (Node* node : nm::m_Nodes())
+    {
+        if (auto* commonLog = dynamic_cast<CommonLog*>(node)) { commonLog->setRunContext(_runContext); }
+    }
+
     if (!nm::InitializeAllNodes()) // This wakes the threads
     {
         std::scoped_lock<std::mutex> lk(_mutex);
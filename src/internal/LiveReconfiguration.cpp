@@ -0,0 +1,428 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "LiveReconfiguration.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include <imgui.h>
+#include <fmt/format.h>
+
+#include "internal/FlowManager.hpp"
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "util/Container/STL.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV::LiveReconfiguration
+{
+
+namespace
+{
+
+/// @brief Collects the json pointers to all leaf values of the json object
+/// @param[in] j Json object
+/// @param[in] pointer Json pointer to j
+/// @param[out] leafs Json pointers to the leaf values
+void collectLeafs(const json& j, const std::string& pointer, std::vector<std::string>& leafs)
+{
+    if (j.is_object())
+    {
+        for (const auto& [key, value] : j.items())
+        {
+            collectLeafs(value, pointer + "/" + key, leafs);
+        }
+    }
+    else
+    {
+        leafs.push_back(pointer);
+    }
+}
+
+/// @brief Checks whether the value is a number. NaN values are stored as string or null.
+/// @param[in] j Json value
+bool isNumeric(const json& j)
+{
+    return j.is_number() || (j.is_string() && j.get<std::string>() == "NaN");
+}
+
+/// @brief Collects the json pointers to the values which do not have the type of the reference
+/// @param[in] j Json value to check
+/// @param[in] reference Json value with the expected type
+/// @param[in] pointer Json pointer to j
+/// @param[out] mismatches Json pointers to the values with a different type
+void collectTypeMismatches(const json& j, const json& reference, const std::string& pointer, std::vector<std::string>& mismatches)
+{
+    if (reference.is_null()) { return; } // Unknown type, e.g. NaN or empty values
+    if (isNumeric(reference))
+    {
+        if (!isNumeric(j)) { mismatches.push_back(pointer); }
+        return;
+    }
+    if (j.type() != reference.type())
+    {
+        mismatches.push_back(pointer);
+        return;
+    }
+    if (j.is_object())
+    {
+        for (const auto& [key, value] : j.items())
+        {
+            if (reference.contains(key)) { collectTypeMismatches(value, reference.at(key), pointer + "/" + key, mismatches); }
+        }
+    }
+    else if (j.is_array())
+    {
+        for (size_t i = 0; i < std::min(j.size(), reference.size()); i++)
+        {
+            collectTypeMismatches(j.at(i), reference.at(i), pointer + "/" + std::to_string(i), mismatches);
+        }
+    }
+}
+
+/// @brief Shows an input widget for the json value
+/// @param[in] label Label of the widget
+/// @param[in, out] value Json value to edit
+/// @return True if the value was changed
+bool ShowJsonValueWidget(const std::string& label, json& value)
+{
+    bool changed = false;
+    switch (value.type())
+    {
+    case json::value_t::boolean:
+    {
+        auto v = value.get<bool>();
+        if (ImGui::Checkbox(label.c_str(), &v))
+        {
+            value = v;
+            changed = true;
+        }
+        break;
+    }
+    case json::value_t::number_integer:
+    case json::value_t::number_unsigned:
+    {
+        auto v = value.get<int>();
+        if (ImGui::InputInt(label.c_str(), &v))
+        {
+            value = v;
+            changed = true;
+        }
+        break;
+    }
+    case json::value_t::number_float:
+    {
+        auto v = value.get<double>();
+        if (ImGui::InputDouble(label.c_str(), &v, 0.0, 0.0, "%.6g"))
+        {
+            value = v;
+            changed = true;
+        }
+        break;
+    }
+    case json::value_t::array:
+        if (ImGui::TreeNode(label.c_str()))
+        {
+            for (size_t i = 0; i < value.size(); i++)
+            {
+                changed |= ShowJsonValueWidget(fmt::format("[{}]##{}", i, label), value.at(i));
+            }
+            ImGui::TreePop();
+        }
+        break;
+    case json::value_t::object:
+        if (ImGui::TreeNode(label.c_str()))
+        {
+            for (auto& [key, v] : value.items())
+            {
+                changed |= ShowJsonValueWidget(fmt::format("{}##{}", key, label), v);
+            }
+            ImGui::TreePop();
+        }
+        break;
+    default:
+        ImGui::TextDisabled("%s: %s", label.substr(0, label.find("##")).c_str(), value.dump().c_str());
+        break;
+    }
+    return changed;
+}
+
+/// Set by the signal handler when the process receives -SIGHUP
+volatile std::sig_atomic_t reloadRequested = 0;
+
+/// @brief Signal handler for -SIGHUP
+/// @param[in] signal Received signal
+void requestReload(int /* signal */)
+{
+    reloadRequested = 1;
+}
+
+/// Thread which watches the control file
+std::thread fileWatcherThread;
+/// Mutex for the stop flag of the file watcher
+std::mutex fileWatcherMutex;
+/// Wakes the file watcher when it should stop
+std::condition_variable fileWatcherConditionVariable;
+/// Flag whether the file watcher should stop
+bool fileWatcherStopRequested = false;
+
+/// @brief Modification time of the file
+/// @param[in] path Path to the file
+/// @return The time or nothing if the file does not exist
+std::optional<std::filesystem::file_time_type> lastWriteTime(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) { return std::nullopt; }
+    return time;
+}
+
+} // namespace
+
+std::vector<std::string> restartParameters(const json& j, const std::vector<std::string>& liveParameters)
+{
+    std::vector<std::string> leafs;
+    if (j.is_object())
+    {
+        for (const auto& [key, value] : j.items())
+        {
+            collectLeafs(value, "/" + key, leafs);
+        }
+    }
+
+    std::erase_if(leafs, [&](const std::string& leaf) {
+        return std::any_of(liveParameters.begin(), liveParameters.end(), [&](const std::string& live) {
+            return leaf == live || leaf.starts_with(live + "/");
+        });
+    });
+    return leafs;
+}
+
+std::vector<std::string> typeMismatches(const json& j, const json& reference)
+{
+    std::vector<std::string> mismatches;
+    collectTypeMismatches(j, reference, "", mismatches);
+    return mismatches;
+}
+
+json currentValues(const json& j, const json& reference)
+{
+    if (!j.is_object() || !reference.is_object()) { return reference; }
+
+    json values = json::object();
+    for (const auto& [key, value] : j.items())
+    {
+        if (reference.contains(key)) { values[key] = currentValues(value, reference.at(key)); }
+    }
+    return values;
+}
+
+bool isValidEnumValue(const json& j, const std::string& pointer, size_t count)
+{
+    json::json_pointer ptr(pointer);
+    if (!j.contains(ptr)) { return true; }
+
+    const auto& value = j.at(ptr);
+    return value.is_number_integer() && value.get<int64_t>() >= 0 && value.get<uint64_t>() < count;
+}
+
+Node* findNode(const std::string& idOrName)
+{
+    std::string id = idOrName.starts_with("node-") ? idOrName.substr(5) : idOrName;
+    for (auto* node : nm::m_Nodes())
+    {
+        if (std::to_string(size_t(node->id)) == id) { return node; }
+    }
+
+    Node* found = nullptr;
+    for (auto* node : nm::m_Nodes())
+    {
+        if (node->name == idOrName)
+        {
+            if (found != nullptr)
+            {
+                LOG_ERROR("The node name '{}' is ambiguous. Please use the node id instead.", idOrName);
+                return nullptr;
+            }
+            found = node;
+        }
+    }
+    return found;
+}
+
+bool apply(const json& j)
+{
+    if (!j.is_object())
+    {
+        LOG_ERROR("The reconfiguration has to be a json object with the node id or name as key");
+        return false;
+    }
+
+    // Validate everything first, so that the reconfiguration is either applied completely or not at all
+    std::vector<std::pair<Node*, const json*>> changes;
+    for (const auto& [idOrName, parameters] : j.items())
+    {
+        Node* node = findNode(idOrName);
+        if (node == nullptr)
+        {
+            LOG_ERROR("Reconfiguration: Could not find the node '{}'", idOrName);
+            return false;
+        }
+        if (!parameters.is_object())
+        {
+            LOG_ERROR("Reconfiguration: The parameters of node '{}' have to be a json object", node->nameId());
+            return false;
+        }
+        if (!node->canReconfigure(parameters)) { return false; }
+        changes.emplace_back(node, &parameters);
+    }
+
+    // A node can still reject its change, e.g. when it started to deinitialize meanwhile. The other nodes are reverted then.
+    std::vector<std::pair<Node*, json>> applied;
+    for (const auto& [node, parameters] : changes)
+    {
+        json previous = currentValues(*parameters, node->save());
+        if (!node->doReconfigure(*parameters))
+        {
+            LOG_ERROR("Reconfiguration: Reverting the changes of the other nodes");
+            for (auto it = applied.rbegin(); it != applied.rend(); ++it) { it->first->doReconfigure(it->second); }
+            return false;
+        }
+        applied.emplace_back(node, std::move(previous));
+    }
+    return true;
+}
+
+bool applyFile(const std::filesystem::path& path)
+{
+    std::ifstream filestream(path);
+    if (!filestream.good())
+    {
+        LOG_ERROR("Reconfiguration: Could not open the file '{}'", path.string());
+        return false;
+    }
+
+    json j;
+    try
+    {
+        j = json::parse(filestream);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Reconfiguration: Could not parse the file '{}': {}", path.string(), e.what());
+        return false;
+    }
+
+    LOG_INFO("Applying the reconfiguration file '{}'", path.string());
+    try
+    {
+        return apply(j);
+    }
+    catch (const std::exception& e) // The file watcher thread must not terminate the program
+    {
+        LOG_ERROR("Reconfiguration: Could not apply the file '{}': {}", path.string(), e.what());
+        return false;
+    }
+}
+
+void startFileWatcher(const std::filesystem::path& path, std::chrono::milliseconds interval)
+{
+    stopFileWatcher();
+
+    {
+        std::scoped_lock lk(fileWatcherMutex);
+        fileWatcherStopRequested = false;
+    }
+    reloadRequested = 0;
+#if !_WIN32
+    static_cast<void>(std::signal(SIGHUP, requestReload));
+#endif
+
+    fileWatcherThread = std::thread([path, interval]() {
+        // Only changes after the start are applied, the flow was loaded with its own parameters
+        auto lastTime = lastWriteTime(path);
+
+        std::unique_lock lk(fileWatcherMutex);
+        while (!fileWatcherConditionVariable.wait_for(lk, interval, []() { return fileWatcherStopRequested; }))
+        {
+            auto time = lastWriteTime(path);
+            bool changed = time && time != lastTime;
+            bool signaled = reloadRequested != 0;
+            reloadRequested = 0;
+            lastTime = time;
+
+            if (changed || signaled)
+            {
+                lk.unlock();
+                applyFile(path);
+                lk.lock();
+            }
+        }
+    });
+    LOG_INFO("Watching the reconfiguration file '{}'", path.string());
+}
+
+void stopFileWatcher()
+{
+    {
+        std::scoped_lock lk(fileWatcherMutex);
+        fileWatcherStopRequested = true;
+    }
+    fileWatcherConditionVariable.notify_all();
+    if (fileWatcherThread.joinable())
+    {
+        fileWatcherThread.join();
+#if !_WIN32
+        static_cast<void>(std::signal(SIGHUP, SIG_DFL));
+#endif
+    }
+}
+
+void ShowGuiWidgets(Node* node)
+{
+    auto liveParameters = node->liveParameters();
+    if (liveParameters.empty() || !node->isInitialized()) { return; }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Live parameters");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("These parameters can be changed while the flow is running.\n"
+                             "They are applied between two messages without reinitializing the node.");
+
+    json j = node->save();
+    for (const auto& pointer : liveParameters)
+    {
+        json::json_pointer ptr(pointer);
+        if (!j.contains(ptr)) { continue; }
+
+        json value = j.at(ptr);
+        if (ShowJsonValueWidget(fmt::format("{}##live {}", pointer.substr(1), size_t(node->id)), value))
+        {
+            json patch;
+            patch[ptr] = value;
+            if (node->doReconfigure(patch))
+            {
+                flow::ApplyChanges();
+            }
+        }
+    }
+}
+
+} // namespace NAV::LiveReconfiguration
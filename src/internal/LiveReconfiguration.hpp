@@ -0,0 +1,95 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LiveReconfiguration.hpp
+/// @brief Changes parameters of running nodes without reinitializing the flow
+/// @date 2026-10-18
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
+namespace NAV
+{
+class Node;
+
+/// @brief Changes parameters of running nodes without reinitializing the flow
+///
+/// Nodes declare the parameters which can be changed while they are running with Node::liveParameters() as json pointers into
+/// their save() object. A reconfiguration is a json object with the node id or name as key and the changed parameters in the
+/// format of save() as value, e.g.
+/// @code
+/// { "LooselyCoupledKF": { "stdev_ra": [0.1, 0.1, 0.1] }, "12": { "algorithm": { "robustK0": 2.0 } } }
+/// @endcode
+/// The changes are only applied if every parameter of every addressed node can be changed live, has the type of the current
+/// value and passes the checks of the node. Each node applies its parameters at once between two messages.
+namespace LiveReconfiguration
+{
+
+/// @brief Finds the parameters which can not be changed while the node is running
+/// @param[in] j Changed parameters in the format of save()
+/// @param[in] liveParameters Json pointers to the parameters which can be changed live (a pointer includes all its children)
+/// @return Json pointers to the parameters in j, which are not covered by the live parameters
+[[nodiscard]] std::vector<std::string> restartParameters(const json& j, const std::vector<std::string>& liveParameters);
+
+/// @brief Finds the parameters whose values do not have the type of the current value
+/// @param[in] j Changed parameters in the format of save()
+/// @param[in] reference Current parameters as returned by save()
+/// @return Json pointers to the parameters in j with a different type. Parameters not contained in the reference are not checked.
+[[nodiscard]] std::vector<std::string> typeMismatches(const json& j, const json& reference);
+
+/// @brief Extracts the current values of the changed parameters, e.g. to revert a change
+/// @param[in] j Changed parameters in the format of save()
+/// @param[in] reference Current parameters as returned by save()
+/// @return Values of the reference with the keys present in j
+[[nodiscard]] json currentValues(const json& j, const json& reference);
+
+/// @brief Checks whether the value at the json pointer is a valid value of an enum without gaps, starting at 0
+/// @param[in] j Changed parameters in the format of save()
+/// @param[in] pointer Json pointer to the enum value
+/// @param[in] count Amount of items in the enum
+/// @return True if j does not contain the pointer or the value is an integer in [0, count)
+[[nodiscard]] bool isValidEnumValue(const json& j, const std::string& pointer, size_t count);
+
+/// @brief Finds the node with the given id or name
+/// @param[in] idOrName Node id or unique node name
+/// @return Pointer to the node or nullptr if not found or the name is ambiguous
+[[nodiscard]] Node* findNode(const std::string& idOrName);
+
+/// @brief Applies the reconfiguration to the nodes
+/// @param[in] j Json object with the node id or name as key and the changed parameters as value
+/// @return True if the reconfiguration was valid and applied to all nodes
+bool apply(const json& j);
+
+/// @brief Reads the reconfiguration from a json file and applies it
+/// @param[in] path Path to the file
+/// @return True if the file could be read and the reconfiguration was applied
+bool applyFile(const std::filesystem::path& path);
+
+/// @brief Starts a thread which applies the control file every time it changes or the process receives -SIGHUP
+/// @param[in] path Path to the control file. It does not have to exist yet.
+/// @param[in] interval Interval to check the modification time of the file
+void startFileWatcher(const std::filesystem::path& path, std::chrono::milliseconds interval = std::chrono::milliseconds(500));
+
+/// @brief Stops the control file thread
+void stopFileWatcher();
+
+/// @brief Shows widgets for the live parameters of a running node, whose config window is locked
+/// @param[in] node Node to show the widgets for
+void ShowGuiWidgets(Node* node);
+
+} // namespace LiveReconfiguration
+
+} // namespace NAV
@@ -12,8 +12,11 @@
 
 #include "util/StringUtil.hpp"
 #include "util/Assert.h"
+#include "util/Container/STL.hpp"
 
 #include "internal/FlowExecutor.hpp"
+#include "internal/LiveReconfiguration.hpp"
+#include "internal/NumericSentinel.hpp"
 #include "internal/gui/FlowAnimation.hpp"
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
@@ -70,6 +73,18 @@ void NAV::Node::deinitialize() {}
 
 void NAV::Node::flush() {}
 
+std::vector<std::string> NAV::Node::liveParameters() const
+{
+    return {};
+}
+
+void NAV::Node::afterReconfiguration(const json& /*j*/) {}
+
+bool NAV::Node::checkParameters(const json& /*j*/) const
+{
+    return true;
+}
+
 bool NAV::Node::resetNode()
 {
     LOG_TRACE("{}: called", nameId());
@@ -182,6 +197,10 @@ void NAV::Node::invokeCallbacks(size_t portIndex, const std::shared_ptr<const NA
             LOG_DATA("{}: Tried to invokeCallbacks on pin {} without a InsTime. The time is mandatory though!!! ", nameId(), portIndex);
             return;
         }
+        if (NumericSentinel::isEnabled() && !NumericSentinel::check(*this, portIndex, *data))
+        {
+            return;
+        }
 
         for (const auto& link : outputPins.at(portIndex).links)
         {
@@ -478,6 +497,61 @@ bool NAV::Node::doEnable()
     return true;
 }
 
+bool NAV::Node::canReconfigure(const json& j) const
+{
+    if (isTransient())
+    {
+        LOG_ERROR("{}: Can not change parameters while the node is in a transient state.", nameId());
+        return false;
+    }
+
+    if (isInitialized())
+    {
+        if (auto restartParameters = LiveReconfiguration::restartParameters(j, liveParameters());
+            !restartParameters.empty())
+        {
+            LOG_ERROR("{}: Can not change the parameters [{}] while the node is running. They require a reinitialization.",
+                      nameId(), joinToString(restartParameters));
+            return false;
+        }
+    }
+
+    if (auto mismatches = LiveReconfiguration::typeMismatches(j, save());
+        !mismatches.empty())
+    {
+        LOG_ERROR("{}: The parameters [{}] do not have the type of the current values.", nameId(), joinToString(mismatches));
+        return false;
+    }
+
+    return checkParameters(j);
+}
+
+bool NAV::Node::doReconfigure(const json& j)
+{
+    // Waits until the worker finished processing the current message
+    std::scoped_lock lk(_parameterMutex);
+
+    if (!canReconfigure(j)) { return false; }
+
+    bool initialized = isInitialized();
+    json previous = LiveReconfiguration::currentValues(j, save());
+
+    LOG_INFO("{}: Changing parameters {}", nameId(), j.dump());
+    try
+    {
+        restore(j);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: Could not change the parameters, restoring the previous values: {}", nameId(), e.what());
+        restore(previous);
+        return false;
+    }
+    if (initialized) { afterReconfiguration(j); }
+
+    return true;
+}
+
 void NAV::Node::wakeWorker()
 {
     {
@@ -522,6 +596,18 @@ bool NAV::Node::isOnlyRealtime() const
     return _onlyRealTime;
 }
 
+bool NAV::Node::isIdle()
+{
+    auto queuesEmpty = [this]() {
+        return std::all_of(inputPins.begin(), inputPins.end(), [](const InputPin& inputPin) { return inputPin.queue.empty(); });
+    };
+    if (!queuesEmpty()) { return false; }
+
+    // The worker holds the mutex while processing a message, after it took the message from the queue
+    std::unique_lock lk(_parameterMutex, std::try_to_lock);
+    return lk.owns_lock() && queuesEmpty();
+}
+
 void NAV::Node::workerThread(Node* node)
 {
     LOG_TRACE("{}: Worker thread started.", node->nameId());
@@ -611,6 +697,7 @@ void NAV::Node::workerThread(Node* node)
                                         }
                                     }
 #endif
+                                    std::scoped_lock parameterLock(node->_parameterMutex);
                                     std::invoke(callback, node, insTime, i);
                                     notifyTriggered = true;
                                 }
@@ -681,6 +768,7 @@ void NAV::Node::workerThread(Node* node)
                                         }
                                     }
 #endif
+                                    std::scoped_lock parameterLock(node->_parameterMutex);
                                     std::invoke(callback, node, inputPin.queue, earliestInputPinIdx);
                                 }
                             }
@@ -711,6 +799,7 @@ void NAV::Node::workerThread(Node* node)
                         OutputPin* outputPin = it->second.first;
                         size_t outputPinIdx = it->second.second;
                         Node* node = outputPin->parentNode;
+                        std::scoped_lock parameterLock(node->_parameterMutex);
 
                         if (std::holds_alternative<OutputPin::PollDataFunc>(outputPin->data))
                         {
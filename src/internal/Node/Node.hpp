@@ -255,6 +255,19 @@ class Node
     /// @brief Function called by the flow executer after finishing to flush out remaining data
     virtual void flush();
 
+    /// @brief Parameters which can be changed while the node is initialized, without reinitializing it
+    /// @return Json pointers into the object returned by save() (a pointer includes all its children)
+    [[nodiscard]] virtual std::vector<std::string> liveParameters() const;
+
+    /// @brief Called after live parameters were restored into the initialized node, e.g. to update derived values
+    /// @param[in] j Json object with the changed parameters
+    virtual void afterReconfiguration(const json& j);
+
+    /// @brief Checks changed parameters before they are restored, e.g. whether enum values are in range
+    /// @param[in] j Json object with the changed parameters in the format of save()
+    /// @return True if the parameters can be restored
+    [[nodiscard]] virtual bool checkParameters(const json& j) const;
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member functions                                             */
     /* -------------------------------------------------------------------------------------------------------- */
@@ -351,6 +364,18 @@ class Node
     /// @return True if enabling was successful
     bool doEnable();
 
+    /// @brief Checks whether the parameters can be changed, without changing them. If the node is initialized, only live
+    ///        parameters are accepted. The values need the same types as in save() and have to pass checkParameters().
+    /// @param[in] j Json object in the format of save(), which only contains the parameters to change
+    /// @return True if doReconfigure() would accept the parameters
+    [[nodiscard]] bool canReconfigure(const json& j) const;
+
+    /// @brief Changes parameters of the node. If the node is initialized, only live parameters are accepted and they
+    ///        are applied at once between two messages. If restoring fails, the previous values are restored.
+    /// @param[in] j Json object in the format of save(), which only contains the parameters to change
+    /// @return True if the parameters were applied
+    bool doReconfigure(const json& j);
+
     /// Wakes the worker thread
     void wakeWorker();
 
@@ -366,6 +391,9 @@ class Node
     /// @brief Checks if the node is only working in real time (sensors, network interfaces, ...)
     [[nodiscard]] bool isOnlyRealtime() const;
 
+    /// @brief Checks if the node has no data queued on its input pins and is not processing a message
+    [[nodiscard]] bool isIdle();
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
@@ -414,6 +442,9 @@ class Node
     /// Flag if the node should be disabled after deinitializing
     bool _disable = false;
 
+    /// Mutex which is held by the worker while processing a message and when parameters are changed live
+    std::mutex _parameterMutex;
+
     /// Flag if the config window is shown
     bool _showConfig = false;
 
@@ -0,0 +1,204 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "NumericSentinel.hpp"
+
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "internal/ConfigManager.hpp"
+#include "internal/FlowExecutor.hpp"
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "NodeData/NodeData.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV::NumericSentinel
+{
+namespace
+{
+
+/// Mutex for the settings and the violations
+std::mutex _mutex;
+/// Settings of the checks
+Settings _settings;
+/// Incremented when the settings change, to invalidate the field limits cached by the worker threads
+std::atomic<size_t> _settingsGeneration = 0;
+/// First violation since the last reset
+std::optional<Violation> _firstViolation;
+/// Amount of messages with violations since the last reset
+std::atomic<size_t> _violationCount = 0;
+
+/// @brief Limit of a field
+/// @param[in] settings Settings of the checks
+/// @param[in] descriptor Descriptor of the field
+/// @return Largest plausible absolute value or NaN if the field is ignored
+double fieldLimit(const Settings& settings, const std::string& descriptor)
+{
+    for (const auto& ignored : settings.ignored)
+    {
+        if (descriptor.find(ignored) != std::string::npos) { return std::nan(""); }
+    }
+    for (const auto& limit : settings.limits)
+    {
+        if (descriptor.find(limit.descriptor) != std::string::npos) { return limit.maxMagnitude; }
+    }
+    return settings.maxMagnitude;
+}
+
+/// @brief Checks a value against a limit
+/// @param[in] value Value to check
+/// @param[in] limit Largest plausible absolute value (NaN if the field is ignored)
+/// @return Reason of the violation or an empty string
+std::string violationReason(double value, double limit)
+{
+    if (std::isnan(limit)) { return {}; }
+    if (std::isnan(value)) { return "NaN"; }
+    if (std::isinf(value)) { return "Inf"; }
+    if (std::abs(value) > limit) { return fmt::format("magnitude above {}", limit); }
+    return {};
+}
+
+} // namespace
+} // namespace NAV::NumericSentinel
+
+void NAV::NumericSentinel::setEnabled(bool enable)
+{
+    internal::enabled = enable;
+}
+
+NAV::NumericSentinel::Settings NAV::NumericSentinel::settings()
+{
+    std::scoped_lock lk(_mutex);
+    return _settings;
+}
+
+void NAV::NumericSentinel::setSettings(const Settings& settings)
+{
+    std::scoped_lock lk(_mutex);
+    _settings = settings;
+    _settingsGeneration++;
+}
+
+void NAV::NumericSentinel::applyConfig()
+{
+    auto settings = NumericSentinel::settings();
+    settings.halt = ConfigManager::Get<bool>("check-numerics-halt", false);
+    settings.maxMagnitude = ConfigManager::Get<double>("check-numerics-limit", settings.maxMagnitude);
+    setSettings(settings);
+
+    setEnabled(ConfigManager::Get<bool>("check-numerics", false) || settings.halt);
+}
+
+void NAV::NumericSentinel::reset()
+{
+    std::scoped_lock lk(_mutex);
+    _firstViolation.reset();
+    _violationCount = 0;
+}
+
+bool NAV::NumericSentinel::check(const Node& node, size_t portIndex, const NodeData& data)
+{
+    /// Limits of the static fields of each data type, cached per thread
+    thread_local std::unordered_map<std::type_index, std::vector<double>> staticLimits;
+    /// Settings generation the cached limits belong to
+    thread_local size_t cachedGeneration = std::numeric_limits<size_t>::max();
+    /// Settings copy of this thread
+    thread_local Settings settings;
+
+    if (size_t generation = _settingsGeneration.load(); generation != cachedGeneration)
+    {
+        staticLimits.clear();
+        settings = NumericSentinel::settings();
+        cachedGeneration = generation;
+    }
+
+    auto& limits = staticLimits[std::type_index(typeid(data))];
+    if (limits.size() != data.staticDescriptorCount())
+    {
+        limits.clear();
+        for (const auto& descriptor : data.staticDataDescriptors()) { limits.push_back(fieldLimit(settings, descriptor)); }
+        limits.resize(data.staticDescriptorCount(), settings.maxMagnitude);
+    }
+
+    std::string field;
+    std::string reason;
+    double value = 0.0;
+    for (size_t i = 0; i < limits.size() && reason.empty(); i++)
+    {
+        if (auto val = data.getValueAt(i))
+        {
+            if (reason = violationReason(*val, limits[i]); !reason.empty())
+            {
+                auto descriptors = data.staticDataDescriptors();
+                field = i < descriptors.size() ? descriptors[i] : std::to_string(i);
+                value = *val;
+            }
+        }
+    }
+    if (reason.empty())
+    {
+        for (const auto& [descriptor, val] : data.getDynamicData())
+        {
+            if (reason = violationReason(val, fieldLimit(settings, descriptor)); !reason.empty())
+            {
+                field = descriptor;
+                value = val;
+                break;
+            }
+        }
+    }
+    if (reason.empty()) { return true; }
+
+    std::string pin = portIndex < node.outputPins.size() ? node.outputPins[portIndex].name : std::string();
+    _violationCount++;
+    {
+        std::scoped_lock lk(_mutex);
+        if (!_firstViolation)
+        {
+            _firstViolation = Violation{ .node = node.nameId(),
+                                         .pin = pin,
+                                         .insTime = data.insTime,
+                                         .field = field,
+                                         .value = value,
+                                         .reason = reason };
+            LOG_ERROR("{}: First numeric violation on output pin '{}' at {}: '{}' = {} ({})",
+                      node.nameId(), pin, data.insTime, field, value, reason);
+        }
+        else
+        {
+            LOG_DEBUG("{}: Numeric violation on output pin '{}' at {}: '{}' = {} ({})",
+                      node.nameId(), pin, data.insTime, field, value, reason);
+        }
+    }
+
+    if (settings.halt)
+    {
+        nm::DisableAllCallbacks();
+        FlowExecutor::requestStop();
+        return false;
+    }
+    return true;
+}
+
+std::optional<NAV::NumericSentinel::Violation> NAV::NumericSentinel::firstViolation()
+{
+    std::scoped_lock lk(_mutex);
+    return _firstViolation;
+}
+
+size_t NAV::NumericSentinel::violationCount()
+{
+    return _violationCount;
+}
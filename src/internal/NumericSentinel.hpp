@@ -0,0 +1,123 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NumericSentinel.hpp
+/// @brief Checks the data published on output pins for NaN, Inf and implausible magnitudes
+/// @date 2026-10-18
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV
+{
+class Node;
+class NodeData;
+
+/// @brief Checks the data published on output pins for NaN, Inf and implausible magnitudes
+///
+/// When enabled, every message passed to Node::invokeCallbacks is checked with the values of its data descriptors. The first
+/// offending node, time and field is recorded, so that the origin of a divergence can be found without searching the logs of
+/// every node. When disabled, the check costs a single relaxed atomic load per message.
+namespace NumericSentinel
+{
+
+/// @brief Magnitude limit of the fields whose descriptor contains a text
+struct Limit
+{
+    std::string descriptor; ///< Text contained in the descriptor (e.g. "Latitude [deg]")
+    double maxMagnitude;    ///< Largest plausible absolute value
+};
+
+/// @brief Settings of the checks
+struct Settings
+{
+    /// Stop the flow at the first violation. The callbacks of all nodes are disabled, so that neither the offending message nor
+    /// any later message is passed on.
+    bool halt = false;
+    /// Largest plausible absolute value of fields without a specific limit
+    double maxMagnitude = 1e12;
+    /// Limits of specific fields. The first matching limit is used.
+    std::vector<Limit> limits = {
+        { "Latitude [deg]", 90.0 },
+        { "Longitude [deg]", 180.0 },
+        { "Roll [deg]", 180.0 },
+        { "Pitch [deg]", 90.0 },
+        { "Yaw [deg]", 180.0 },
+        { "Quaternion::", 1.0 + 1e-6 },
+        { "Velocity norm [m/s]", 1e5 },
+        // Time stamps and counters in nanoseconds (e.g. the time since startup) exceed the default limit within minutes
+        { "[ns]", std::numeric_limits<double>::max() },
+    };
+    /// Fields whose descriptor contains one of these texts are not checked (e.g. fields which are NaN when not available)
+    std::vector<std::string> ignored;
+};
+
+/// @brief Description of a violation
+struct Violation
+{
+    std::string node;   ///< Name and id of the publishing node
+    std::string pin;    ///< Name of the output pin
+    InsTime insTime;    ///< Time of the message
+    std::string field;  ///< Descriptor of the offending field
+    double value = 0.0; ///< Offending value
+    std::string reason; ///< Reason of the violation (NaN, Inf or the exceeded limit)
+};
+
+namespace internal
+{
+/// Flag whether the checks are enabled
+inline std::atomic<bool> enabled = false;
+} // namespace internal
+
+/// @brief Checks whether the data on the output pins is checked
+[[nodiscard]] inline bool isEnabled() noexcept
+{
+    return internal::enabled.load(std::memory_order_relaxed);
+}
+
+/// @brief Enables or disables the checks
+/// @param[in] enable Whether to check the data
+void setEnabled(bool enable);
+
+/// @brief Returns the settings of the checks
+[[nodiscard]] Settings settings();
+
+/// @brief Changes the settings of the checks. Must not be called while a flow is running.
+/// @param[in] settings New settings
+void setSettings(const Settings& settings);
+
+/// @brief Applies the program options 'check-numerics', 'check-numerics-halt' and 'check-numerics-limit'
+void applyConfig();
+
+/// @brief Forgets the recorded violations
+void reset();
+
+/// @brief Checks the message published on an output pin
+/// @param[in] node Node publishing the data
+/// @param[in] portIndex Index of the output pin
+/// @param[in] data Published data
+/// @return False if the data violates a check and the flow should be halted
+bool check(const Node& node, size_t portIndex, const NodeData& data);
+
+/// @brief Returns the first violation since the last reset
+[[nodiscard]] std::optional<Violation> firstViolation();
+
+/// @brief Amount of messages with violations since the last reset
+[[nodiscard]] size_t violationCount();
+
+} // namespace NumericSentinel
+
+} // namespace NAV
@@ -0,0 +1,168 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ObservationQCBatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+
+#include "internal/ConfigManager.hpp"
+#include "internal/FlowManager.hpp"
+#include "Nodes/DataProvider/GNSS/FileReader/RinexObsFile.hpp"
+#include "util/Logger.hpp"
+
+namespace NAV::ObservationQCBatch
+{
+namespace
+{
+
+/// @brief Analyzes a single observation file
+/// @param[in, out] reader Parser used to read the file
+/// @param[in] path Path of the RINEX observation file
+/// @param[in] settings Settings of the quality control
+ObservationQC::Report analyze(RinexObsFile& reader, const std::filesystem::path& path, const ObservationQC::Settings& settings)
+{
+    ObservationQC qc(settings);
+    ObservationQC::Report report;
+    try
+    {
+        if (reader.openFile(std::filesystem::absolute(path)))
+        {
+            while (auto gnssObs = reader.readEpoch())
+            {
+                qc.addEpoch(*gnssObs, reader.receiverClockOffset());
+            }
+            report = qc.report();
+        }
+        else
+        {
+            report.error = "Could not open the file";
+        }
+    }
+    catch (const std::exception& e)
+    {
+        report = qc.report();
+        report.error = e.what();
+    }
+    report.file = path.string();
+
+    if (!report.error.empty()) { LOG_WARN("Quality control of '{}' failed: {}", report.file, report.error); }
+    return report;
+}
+
+} // namespace
+} // namespace NAV::ObservationQCBatch
+
+NAV::ObservationQC::Report NAV::ObservationQCBatch::analyzeFile(const std::filesystem::path& path, const ObservationQC::Settings& settings)
+{
+    RinexObsFile reader;
+    return analyze(reader, path, settings);
+}
+
+void NAV::ObservationQCBatch::analyzeFiles(const std::vector<std::filesystem::path>& paths, const Settings& settings, const Callback& callback)
+{
+    size_t threads = settings.threads != 0 ? settings.threads : std::max(std::thread::hardware_concurrency(), 1U);
+    threads = std::min(threads, paths.size());
+    LOG_DEBUG("Quality control of {} observation files with {} threads", paths.size(), threads);
+
+    // The parsers are nodes, which get their ids and pins from the NodeManager, so they have to be created in this thread
+    std::vector<std::unique_ptr<RinexObsFile>> readers;
+    readers.reserve(threads);
+    for (size_t t = 0; t < threads; t++) { readers.push_back(std::make_unique<RinexObsFile>()); }
+
+    std::atomic<size_t> next = 0;
+    std::mutex callbackMutex;
+    auto worker = [&](RinexObsFile& reader) {
+        for (size_t i = next++; i < paths.size(); i = next++)
+        {
+            auto report = analyze(reader, paths.at(i), settings.qc);
+
+            std::scoped_lock lk(callbackMutex);
+            callback(i, report);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (auto& reader : readers) { workers.emplace_back(worker, std::ref(*reader)); }
+    for (auto& thread : workers) { thread.join(); }
+}
+
+std::vector<std::filesystem::path> NAV::ObservationQCBatch::collectFiles(const std::vector<std::filesystem::path>& paths)
+{
+    // Same file names as accepted by the RinexObsFile node
+    static const std::regex observationFile(R"((.+[.]obs)|(.+[.]rnx)|(.+[.]\d\d?[oO]))", std::regex::icase);
+
+    std::vector<std::filesystem::path> files;
+    for (const auto& path : paths)
+    {
+        if (!std::filesystem::is_directory(path))
+        {
+            files.push_back(path);
+            continue;
+        }
+        std::vector<std::filesystem::path> directoryFiles;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+        {
+            if (entry.is_regular_file() && std::regex_match(entry.path().filename().string(), observationFile))
+            {
+                directoryFiles.push_back(entry.path());
+            }
+        }
+        std::sort(directoryFiles.begin(), directoryFiles.end());
+        files.insert(files.end(), directoryFiles.begin(), directoryFiles.end());
+    }
+    return files;
+}
+
+bool NAV::ObservationQCBatch::writeReports(const std::vector<std::filesystem::path>& paths, const Settings& settings, const std::filesystem::path& outputFile)
+{
+    if (outputFile.has_parent_path()) { std::filesystem::create_directories(outputFile.parent_path()); }
+    std::ofstream output(outputFile);
+    if (!output.good())
+    {
+        LOG_ERROR("Could not open the output file {}", outputFile);
+        return false;
+    }
+
+    size_t failed = 0;
+    analyzeFiles(paths, settings, [&](size_t /* index */, const ObservationQC::Report& report) {
+        if (!report.error.empty()) { failed++; }
+        output << json(report).dump() << '\n';
+    });
+    LOG_INFO("Quality control of {} observation files written to {} ({} failed)", paths.size(), outputFile, failed);
+
+    return output.good();
+}
+
+bool NAV::ObservationQCBatch::runFromConfig()
+{
+    std::vector<std::filesystem::path> paths;
+    for (const auto& file : ConfigManager::Get<std::vector<std::string>>("obs-qc", {}))
+    {
+        std::filesystem::path path = file;
+        if (path.is_relative()) { path = flow::GetProgramRootPath() / path; }
+        paths.push_back(path);
+    }
+
+    std::filesystem::path outputFile = ConfigManager::Get<std::string>("obs-qc-output", "obs-qc.jsonl");
+    if (outputFile.is_relative()) { outputFile = flow::GetOutputPath() / outputFile; }
+
+    Settings settings;
+    settings.threads = ConfigManager::Get<size_t>("obs-qc-threads", 0);
+
+    return writeReports(collectFiles(paths), settings, outputFile);
+}
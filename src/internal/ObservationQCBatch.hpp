@@ -0,0 +1,77 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ObservationQCBatch.hpp
+/// @brief Headless quality control of many RINEX observation files in parallel
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+#include "Navigation/GNSS/QualityControl/ObservationQC.hpp"
+
+namespace NAV
+{
+
+/// @brief Headless quality control of many RINEX observation files in parallel
+///
+/// Every worker thread owns one RinexObsFile parser and streams the epochs of one file at a time into an ObservationQC.
+/// The parsers are created by the calling thread before the workers start, as creating nodes is not thread safe.
+/// The reports are passed on as soon as a file is finished, so that the memory only depends on the amount of threads.
+namespace ObservationQCBatch
+{
+
+/// @brief Settings of the batch processing
+struct Settings
+{
+    ObservationQC::Settings qc; ///< Settings of the quality control of each file
+    size_t threads = 0;         ///< Amount of worker threads (0: hardware concurrency)
+};
+
+/// @brief Callback receiving the report of a file
+/// @param[in] index Index of the file in the list of files
+/// @param[in] report Quality control report of the file
+using Callback = std::function<void(size_t index, const ObservationQC::Report& report)>;
+
+/// @brief Analyzes a single observation file
+/// @attention Not thread safe, as a parser node is created
+/// @param[in] path Path of the RINEX observation file
+/// @param[in] settings Settings of the quality control
+/// @return The report. Errors while reading are stored in the report.
+[[nodiscard]] ObservationQC::Report analyzeFile(const std::filesystem::path& path, const ObservationQC::Settings& settings = {});
+
+/// @brief Analyzes observation files in parallel
+/// @attention Not thread safe, as the parser nodes are created by the calling thread
+/// @param[in] paths Paths of the RINEX observation files
+/// @param[in] settings Settings of the batch processing
+/// @param[in] callback Called for every file in the order of completion. Calls are not concurrent.
+void analyzeFiles(const std::vector<std::filesystem::path>& paths, const Settings& settings, const Callback& callback);
+
+/// @brief Collects the observation files. Directories are searched recursively for RINEX observation files.
+/// @param[in] paths Paths of files or directories
+/// @return Paths of the files
+[[nodiscard]] std::vector<std::filesystem::path> collectFiles(const std::vector<std::filesystem::path>& paths);
+
+/// @brief Analyzes observation files in parallel and writes one json report per line into the output file
+/// @param[in] paths Paths of the RINEX observation files
+/// @param[in] settings Settings of the batch processing
+/// @param[in] outputFile Path of the JSON Lines output file
+/// @return False if the output file could not be written
+bool writeReports(const std::vector<std::filesystem::path>& paths, const Settings& settings, const std::filesystem::path& outputFile);
+
+/// @brief Runs the quality control with the program options 'obs-qc', 'obs-qc-output' and 'obs-qc-threads'
+/// @return False if the output file could not be written
+bool runFromConfig();
+
+} // namespace ObservationQCBatch
+
+} // namespace NAV
@@ -50,6 +50,7 @@ namespace nm = NAV::NodeManager;
 #include "internal/ConfigManager.hpp"
 #include "internal/FlowManager.hpp"
 #include "internal/FlowExecutor.hpp"
+#include "internal/LiveReconfiguration.hpp"
 
 #include "util/Json.hpp"
 #include "util/StringUtil.hpp"
@@ -1707,6 +1708,10 @@ void NAV::gui::NodeEditorApplication::OnFrame(float deltaTime)
                     node->guiConfig();
                 }
                 if (locked) { ImGui::EndDisabled(); }
+                if (locked && !node->_configWindowForceCollapse)
+                {
+                    LiveReconfiguration::ShowGuiWidgets(node);
+                }
                 ImGui::PopFont();
             }
             else // Window is collapsed
@@ -201,6 +201,22 @@ class KeyedMatrixRows<Scalar, RowKeyType, Eigen::Dynamic, Cols> : public KeyedMa
             }
         }
     }
+
+    /// @brief Replaces all row keys and resizes the matrix accordingly
+    /// @param rowKeys Row keys
+    /// @note If the keys did not change, neither the lookup nor the matrix is touched, so the values are kept and nothing is allocated.
+    ///       Otherwise the values are undefined and need to be set again.
+    void setRowKeys(const std::vector<RowKeyType>& rowKeys)
+    {
+        if (rowKeys == this->rowKeysVector) { return; }
+        INS_ASSERT_USER_ERROR(std::unordered_set<RowKeyType>(rowKeys.begin(), rowKeys.end()).size() == rowKeys.size(), "Each row key must be unique");
+
+        this->rowIndices.clear();
+        for (size_t i = 0; i < rowKeys.size(); i++) { this->rowIndices.insert({ rowKeys.at(i), static_cast<Eigen::Index>(i) }); }
+        this->rowKeysVector = rowKeys;
+        this->matrix.resize(static_cast<Eigen::Index>(rowKeys.size()), this->matrix.cols());
+        this->rowSlice.reserve(this->rowKeysVector.size());
+    }
 };
 
 // ###########################################################################################################
@@ -345,6 +361,22 @@ class KeyedMatrixCols<Scalar, ColKeyType, Rows, Eigen::Dynamic> : public KeyedMa
             }
         }
     }
+
+    /// @brief Replaces all col keys and resizes the matrix accordingly
+    /// @param colKeys Col keys
+    /// @note If the keys did not change, neither the lookup nor the matrix is touched, so the values are kept and nothing is allocated.
+    ///       Otherwise the values are undefined and need to be set again.
+    void setColKeys(const std::vector<ColKeyType>& colKeys)
+    {
+        if (colKeys == this->colKeysVector) { return; }
+        INS_ASSERT_USER_ERROR(std::unordered_set<ColKeyType>(colKeys.begin(), colKeys.end()).size() == colKeys.size(), "Each col key must be unique");
+
+        this->colIndices.clear();
+        for (size_t i = 0; i < colKeys.size(); i++) { this->colIndices.insert({ colKeys.at(i), static_cast<Eigen::Index>(i) }); }
+        this->colKeysVector = colKeys;
+        this->matrix.resize(this->matrix.rows(), static_cast<Eigen::Index>(colKeys.size()));
+        this->colSlice.reserve(this->colKeysVector.size());
+    }
 };
 
 // ###########################################################################################################
@@ -408,8 +440,11 @@ class KeyedVectorBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, 1>
         if (this == &other) { return *this; } // Guard self assignment
 
         this->matrix = other.matrix;
-        this->rowIndices = other.rowIndices;
-        this->rowKeysVector = other.rowKeysVector;
+        if (this->rowKeysVector != other.rowKeysVector) // Same keys result in the same lookup, which would otherwise be reallocated
+        {
+            this->rowIndices = other.rowIndices;
+            this->rowKeysVector = other.rowKeysVector;
+        }
         this->rowSlice.reserve(this->rowKeysVector.size());
 
         return *this;
@@ -421,7 +456,7 @@ class KeyedVectorBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, 1>
         this->matrix = std::move(other.matrix);
         this->rowIndices = std::move(other.rowIndices);
         this->rowKeysVector = std::move(other.rowKeysVector);
-        this->rowSlice.reserve(this->rowKeysVector.size());
+        this->rowSlice = std::move(other.rowSlice);
     }
     /// @brief Move assignment operator
     /// @param other The other object
@@ -432,7 +467,7 @@ class KeyedVectorBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, 1>
         this->matrix = std::move(other.matrix);
         this->rowIndices = std::move(other.rowIndices);
         this->rowKeysVector = std::move(other.rowKeysVector);
-        this->rowSlice.reserve(this->rowKeysVector.size());
+        this->rowSlice = std::move(other.rowSlice);
 
         return *this;
     }
@@ -673,8 +708,11 @@ class KeyedRowVectorBase : public KeyedMatrixCols<Scalar, ColKeyType, 1, Cols>
         if (this == &other) { return *this; } // Guard self assignment
 
         this->matrix = other.matrix;
-        this->colIndices = other.colIndices;
-        this->colKeysVector = other.colKeysVector;
+        if (this->colKeysVector != other.colKeysVector) // Same keys result in the same lookup, which would otherwise be reallocated
+        {
+            this->colIndices = other.colIndices;
+            this->colKeysVector = other.colKeysVector;
+        }
         this->colSlice.reserve(this->colKeysVector.size());
 
         return *this;
@@ -686,7 +724,7 @@ class KeyedRowVectorBase : public KeyedMatrixCols<Scalar, ColKeyType, 1, Cols>
         this->matrix = std::move(other.matrix);
         this->colIndices = std::move(other.colIndices);
         this->colKeysVector = std::move(other.colKeysVector);
-        this->colSlice.reserve(this->colKeysVector.size());
+        this->colSlice = std::move(other.colSlice);
     }
     /// @brief Move assignment operator
     /// @param other The other object
@@ -697,7 +735,7 @@ class KeyedRowVectorBase : public KeyedMatrixCols<Scalar, ColKeyType, 1, Cols>
         this->matrix = std::move(other.matrix);
         this->colIndices = std::move(other.colIndices);
         this->colKeysVector = std::move(other.colKeysVector);
-        this->colSlice.reserve(this->colKeysVector.size());
+        this->colSlice = std::move(other.colSlice);
 
         return *this;
     }
@@ -950,10 +988,16 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
         if (this == &other) { return *this; } // Guard self assignment
 
         this->matrix = other.matrix;
-        this->rowIndices = other.rowIndices;
-        this->rowKeysVector = other.rowKeysVector;
-        this->colIndices = other.colIndices;
-        this->colKeysVector = other.colKeysVector;
+        if (this->rowKeysVector != other.rowKeysVector) // Same keys result in the same lookup, which would otherwise be reallocated
+        {
+            this->rowIndices = other.rowIndices;
+            this->rowKeysVector = other.rowKeysVector;
+        }
+        if (this->colKeysVector != other.colKeysVector)
+        {
+            this->colIndices = other.colIndices;
+            this->colKeysVector = other.colKeysVector;
+        }
         this->colSlice.reserve(this->colKeysVector.size());
         this->rowSlice.reserve(this->rowKeysVector.size());
 
@@ -968,8 +1012,8 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
         this->rowKeysVector = std::move(other.rowKeysVector);
         this->colIndices = std::move(other.colIndices);
         this->colKeysVector = std::move(other.colKeysVector);
-        this->colSlice.reserve(this->colKeysVector.size());
-        this->rowSlice.reserve(this->rowKeysVector.size());
+        this->colSlice = std::move(other.colSlice);
+        this->rowSlice = std::move(other.rowSlice);
     }
     /// @brief Move assignment operator
     /// @param other The other object
@@ -982,8 +1026,8 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
         this->rowKeysVector = std::move(other.rowKeysVector);
         this->colIndices = std::move(other.colIndices);
         this->colKeysVector = std::move(other.colKeysVector);
-        this->colSlice.reserve(this->colKeysVector.size());
-        this->rowSlice.reserve(this->rowKeysVector.size());
+        this->colSlice = std::move(other.colSlice);
+        this->rowSlice = std::move(other.rowSlice);
 
         return *this;
     }
@@ -1208,7 +1252,11 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
     template<size_t P>
     decltype(auto) block(const std::vector<RowKeyType>& rowKeys, const ColKeyType& colKey) const // NOLINT(readability-const-return-type)
     {
-        return this->block<P, 1>(rowKeys, std::vector{ colKey });
+#ifndef NDEBUG
+        checkContinuousBlock(rowKeys, std::vector{ colKey }, P, 1);
+#endif
+        // Not delegating to the key vector overload, as the temporary vector would be allocated on every access
+        return this->matrix.template block<P, 1>(this->rowIndices.at(rowKeys.at(0)), this->colIndices.at(colKey));
     }
     /// @brief Gets the values for the row and col keys
     /// @param rowKeys Row Keys
@@ -1217,7 +1265,11 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
     template<size_t P>
     decltype(auto) block(const std::vector<RowKeyType>& rowKeys, const ColKeyType& colKey)
     {
-        return this->block<P, 1>(rowKeys, std::vector{ colKey });
+#ifndef NDEBUG
+        checkContinuousBlock(rowKeys, std::vector{ colKey }, P, 1);
+#endif
+        // Not delegating to the key vector overload, as the temporary vector would be allocated on every access
+        return this->matrix.template block<P, 1>(this->rowIndices.at(rowKeys.at(0)), this->colIndices.at(colKey));
     }
     /// @brief Gets the values for the row and col keys
     /// @param rowKey Row Key
@@ -1226,7 +1278,11 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
     template<size_t Q>
     decltype(auto) block(const RowKeyType& rowKey, const std::vector<ColKeyType>& colKeys) const // NOLINT(readability-const-return-type)
     {
-        return this->block<1, Q>(std::vector{ rowKey }, colKeys);
+#ifndef NDEBUG
+        checkContinuousBlock(std::vector{ rowKey }, colKeys, 1, Q);
+#endif
+        // Not delegating to the key vector overload, as the temporary vector would be allocated on every access
+        return this->matrix.template block<1, Q>(this->rowIndices.at(rowKey), this->colIndices.at(colKeys.at(0)));
     }
     /// @brief Gets the values for the row and col keys
     /// @param rowKey Row Key
@@ -1235,7 +1291,11 @@ class KeyedMatrixBase : public KeyedMatrixRows<Scalar, RowKeyType, Rows, Cols>,
     template<size_t Q>
     decltype(auto) block(const RowKeyType& rowKey, const std::vector<ColKeyType>& colKeys)
     {
-        return this->block<1, Q>(std::vector{ rowKey }, colKeys);
+#ifndef NDEBUG
+        checkContinuousBlock(std::vector{ rowKey }, colKeys, 1, Q);
+#endif
+        // Not delegating to the key vector overload, as the temporary vector would be allocated on every access
+        return this->matrix.template block<1, Q>(this->rowIndices.at(rowKey), this->colIndices.at(colKeys.at(0)));
     }
 
     /// @brief Gets the values for the row keys
@@ -0,0 +1,134 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LazyValue.hpp
+/// @brief Value which is calculated on first access and cached afterwards
+/// @date 2026-10-18
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace NAV
+{
+
+/// @brief Cached value which is calculated on first access
+///
+/// Reading is thread-safe, so that const objects shared between threads can fill the cache. If several threads
+/// access a stale value at the same time, only one calculates it while the others wait for the result.
+/// Setting and invalidating the value must not happen concurrently to other accesses.
+/// @tparam T Type of the value
+template<typename T>
+class LazyValue
+{
+  public:
+    /// @brief Default constructor (the value is stale)
+    LazyValue() = default;
+
+    /// @brief Constructor
+    /// @param[in] value Valid value
+    explicit LazyValue(const T& value) : _value(value), _state(State::Valid) {}
+
+    /// @brief Destructor
+    ~LazyValue() = default;
+
+    /// @brief Copy constructor
+    /// @param[in] other Object to copy
+    LazyValue(const LazyValue& other) : LazyValue() { *this = other; }
+
+    /// @brief Move constructor
+    /// @param[in] other Object to move
+    LazyValue(LazyValue&& other) noexcept : LazyValue() { *this = other; }
+
+    /// @brief Copy assignment operator
+    /// @param[in] other Object to copy
+    LazyValue& operator=(const LazyValue& other)
+    {
+        if (this != &other)
+        {
+            if (other.waitForCalculation() == State::Valid) { set(other._value); }
+            else { invalidate(); }
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator
+    /// @param[in] other Object to move
+    LazyValue& operator=(LazyValue&& other) noexcept { return *this = static_cast<const LazyValue&>(other); }
+
+    /// @brief Sets the value
+    /// @param[in] value New valid value
+    void set(const T& value)
+    {
+        _value = value;
+        _state.store(State::Valid, std::memory_order_release);
+    }
+
+    /// @brief Marks the value as stale, so that it is calculated again on the next access
+    void invalidate() { _state.store(State::Stale, std::memory_order_release); }
+
+    /// @brief Checks whether the value is calculated
+    [[nodiscard]] bool valid() const { return _state.load(std::memory_order_acquire) == State::Valid; }
+
+    /// @brief Returns the value and calculates it first if it is stale
+    /// @param[in] calculate Function returning the value
+    /// @return Reference to the cached value
+    template<typename Func>
+    [[nodiscard]] const T& get(Func&& calculate) const
+    {
+        if (valid()) { return _value; }
+
+        auto expected = State::Stale;
+        if (_state.compare_exchange_strong(expected, State::Calculating, std::memory_order_acquire))
+        {
+            _value = std::forward<Func>(calculate)();
+            _state.store(State::Valid, std::memory_order_release);
+            _state.notify_all();
+        }
+        else
+        {
+            waitForCalculation();
+        }
+        return _value;
+    }
+
+    /// @brief Returns the value without calculating it
+    /// @attention Only meaningful if the value is valid
+    [[nodiscard]] const T& value() const { return _value; }
+
+  private:
+    /// @brief States of the value
+    enum class State : uint8_t
+    {
+        Stale,       ///< Value needs to be calculated
+        Calculating, ///< Value is calculated by another thread
+        Valid,       ///< Value can be used
+    };
+
+    /// @brief Waits while another thread calculates the value
+    /// @return The state after the calculation
+    State waitForCalculation() const
+    {
+        State state = _state.load(std::memory_order_acquire);
+        while (state == State::Calculating)
+        {
+            _state.wait(State::Calculating, std::memory_order_acquire);
+            state = _state.load(std::memory_order_acquire);
+        }
+        return state;
+    }
+
+    /// Cached value
+    mutable T _value{};
+    /// State of the cached value
+    mutable std::atomic<State> _state = State::Stale;
+};
+
+} // namespace NAV
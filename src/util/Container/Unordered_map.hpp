@@ -32,3 +32,16 @@ template<
     class Key,
     class T>
 using unordered_map = ankerl::unordered_dense::map<Key, T>;
+
+namespace pmr
+{
+
+/// @brief Unordered map type using a polymorphic memory resource
+/// @tparam Key Key
+/// @tparam T Value
+template<
+    class Key,
+    class T>
+using unordered_map = ankerl::unordered_dense::pmr::map<Key, T>;
+
+} // namespace pmr
@@ -16,73 +16,63 @@
 namespace NAV
 {
 
-CommonLog::CommonLog()
+double CommonLog::RunContext::calcTimeIntoRun(const InsTime& insTime)
 {
-    std::scoped_lock lk(_mutex);
-    _index = _wantsInit.size(); // NOLINT(cppcoreguidelines-prefer-member-initializer)
-    _wantsInit.push_back(false);
+    const auto& startTime = _startTime.get([&]() {
+        LOG_DEBUG("Common log setting start time to {} ({}) GPST.", insTime.toYMDHMS(GPST), insTime.toGPSweekTow(GPST));
+        return insTime;
+    });
+    return static_cast<double>((insTime - startTime).count());
 }
 
-CommonLog::~CommonLog()
+InsTime CommonLog::RunContext::startTime() const
 {
-    std::scoped_lock lk(_mutex);
-    _wantsInit.erase(_wantsInit.begin() + static_cast<int64_t>(_index));
+    return _startTime.valid() ? _startTime.value() : InsTime{};
 }
 
-void CommonLog::initialize() const
+CommonLog::LocalPosition CommonLog::RunContext::calcLocalPosition(const Eigen::Vector3d& lla_position)
 {
-    std::scoped_lock lk(_mutex);
-    _wantsInit.at(_index) = true;
-
-    if (std::all_of(_wantsInit.begin(), _wantsInit.end(), [](bool val) { return val; }))
-    {
-        LOG_DEBUG("Resetting common log variables.");
-        _startTime.reset();
-        _originLatitude = std::nan("");
-        _originLongitude = std::nan("");
-
-        std::fill(_wantsInit.begin(), _wantsInit.end(), false);
-    }
-}
-
-double CommonLog::calcTimeIntoRun(const InsTime& insTime)
-{
-    if (std::scoped_lock lk(_mutex);
-        _startTime.empty())
+    if (!_origin.valid() && (std::isnan(lla_position.x()) || std::isnan(lla_position.y())))
     {
-        _startTime = insTime;
-        LOG_DEBUG("Common log setting start time to {} ({}) GPST.", _startTime.toYMDHMS(GPST), _startTime.toGPSweekTow(GPST));
+        return { .northSouth = std::nan(""), .eastWest = std::nan("") };
     }
-    return static_cast<double>((insTime - _startTime).count());
-}
 
-CommonLog::LocalPosition CommonLog::calcLocalPosition(const Eigen::Vector3d& lla_position)
-{
-    {
-        std::scoped_lock lk(_mutex);
-        if (std::isnan(_originLatitude))
-        {
-            _originLatitude = lla_position.x();
-            LOG_DEBUG("Common log setting latitude of origin to {} [deg].", rad2deg(_originLatitude));
-        }
-        if (std::isnan(_originLongitude))
-        {
-            _originLongitude = lla_position.y();
-            LOG_DEBUG("Common log setting longitude of origin to {} [deg].", rad2deg(_originLongitude));
-        }
-    }
+    const auto& [originLatitude, originLongitude] = _origin.get([&]() {
+        LOG_DEBUG("Common log setting origin to latitude {} [deg], longitude {} [deg].", rad2deg(lla_position.x()), rad2deg(lla_position.y()));
+        return std::array<double, 2>{ lla_position.x(), lla_position.y() };
+    });
 
     // North/South deviation [m]
     double northSouth = calcGeographicalDistance(lla_position.x(), lla_position.y(),
-                                                 _originLatitude, lla_position.y())
-                        * (lla_position.x() > _originLatitude ? 1 : -1);
+                                                 originLatitude, lla_position.y())
+                        * (lla_position.x() > originLatitude ? 1 : -1);
 
     // East/West deviation [m]
     double eastWest = calcGeographicalDistance(lla_position.x(), lla_position.y(),
-                                               lla_position.x(), _originLongitude)
-                      * (lla_position.y() > _originLongitude ? 1 : -1);
+                                               lla_position.x(), originLongitude)
+                      * (lla_position.y() > originLongitude ? 1 : -1);
 
     return { .northSouth = northSouth, .eastWest = eastWest };
 }
 
-} // namespace NAV
\ No newline at end of file
+void CommonLog::setRunContext(std::shared_ptr<RunContext> runContext)
+{
+    _runContext = std::move(runContext);
+}
+
+double CommonLog::calcTimeIntoRun(const InsTime& insTime) const
+{
+    return _runContext->calcTimeIntoRun(insTime);
+}
+
+CommonLog::LocalPosition CommonLog::calcLocalPosition(const Eigen::Vector3d& lla_position) const
+{
+    return _runContext->calcLocalPosition(lla_position);
+}
+
+InsTime CommonLog::startTime() const
+{
+    return _runContext->startTime();
+}
+
+} // namespace NAV
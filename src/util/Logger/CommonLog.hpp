@@ -13,10 +13,11 @@
 
 #pragma once
 
-#include <mutex>
-#include <vector>
+#include <array>
+#include <memory>
 
 #include "util/Eigen.hpp"
+#include "util/Container/LazyValue.hpp"
 #include "Navigation/Time/InsTime.hpp"
 
 namespace NAV
@@ -25,8 +26,45 @@ namespace NAV
 class CommonLog
 {
   public:
+    /// Local position offset from a reference point
+    struct LocalPosition
+    {
+        double northSouth = 0.0; ///< North/South deviation from the reference point [m]
+        double eastWest = 0.0;   ///< East/West deviation from the reference point [m]
+    };
+
+    /// @brief Values shared by all loggers of a flow run
+    ///
+    /// The values are set once by the first sample and then only read.
+    /// If several threads provide the first sample at the same time, one of them defines the value and the others wait for it.
+    class RunContext
+    {
+      public:
+        /// @brief Calculates the relative time into the run
+        /// @param[in] insTime Absolute Time
+        /// @return Relative time [s]
+        /// @note The first time defines the start time. Afterwards the function does not lock.
+        double calcTimeIntoRun(const InsTime& insTime);
+
+        /// @brief Calculate the local position offset from the origin
+        /// @param[in] lla_position [𝜙, λ, h] Latitude, Longitude, Altitude in [rad, rad, m]
+        /// @return Local positions in north/south and east/west directions in [m]
+        /// @note The first valid position defines the origin. Afterwards the function does not lock.
+        LocalPosition calcLocalPosition(const Eigen::Vector3d& lla_position);
+
+        /// @brief Start time of the run
+        /// @return The start time or an empty time if no sample arrived yet
+        [[nodiscard]] InsTime startTime() const;
+
+      private:
+        /// Start Time for calculation of relative time
+        LazyValue<InsTime> _startTime;
+        /// Origin Latitude, Longitude [rad, rad] for calculation of relative North-South and East-West
+        LazyValue<std::array<double, 2>> _origin;
+    };
+
     /// @brief Destructor
-    virtual ~CommonLog();
+    virtual ~CommonLog() = default;
     /// @brief Copy constructor
     CommonLog(const CommonLog&) = delete;
     /// @brief Move constructor
@@ -36,44 +74,32 @@ class CommonLog
     /// @brief Move assignment operator
     CommonLog& operator=(CommonLog&&) = delete;
 
-    /// @brief Initialize the common log variables
-    void initialize() const;
+    /// @brief Sets the context shared with the other loggers of the flow
+    /// @param[in] runContext Context of the flow run
+    /// @attention Must not be called while the logger receives data
+    void setRunContext(std::shared_ptr<RunContext> runContext);
 
-    /// @brief Calculates the relative time into he run
+    /// @brief Calculates the relative time into the run
     /// @param[in] insTime Absolute Time
-    /// @return Relative
-    static double calcTimeIntoRun(const InsTime& insTime);
-
-    /// Local position offset from a reference point
-    struct LocalPosition
-    {
-        double northSouth = 0.0; ///< North/South deviation from the reference point [m]
-        double eastWest = 0.0;   ///< East/West deviation from the reference point [m]
-    };
+    /// @return Relative time [s]
+    [[nodiscard]] double calcTimeIntoRun(const InsTime& insTime) const;
 
-    /// @brief Calculate the local position offset from a reference point
+    /// @brief Calculate the local position offset from the origin of the run
     /// @param[in] lla_position [𝜙, λ, h] Latitude, Longitude, Altitude in [rad, rad, m]
     /// @return Local positions in north/south and east/west directions in [m]
-    static LocalPosition calcLocalPosition(const Eigen::Vector3d& lla_position);
+    [[nodiscard]] LocalPosition calcLocalPosition(const Eigen::Vector3d& lla_position) const;
 
   protected:
-    /// @brief Default constructor
-    CommonLog();
+    /// @brief Default constructor (the logger has its own context until the flow sets a shared one)
+    CommonLog() = default;
 
-    /// Start Time for calculation of relative time
-    static inline InsTime _startTime;
-    /// Start Latitude [rad] for calculation of relative North-South
-    static inline double _originLatitude = std::nan("");
-    /// Start Longitude [rad] for calculation of relative East-West
-    static inline double _originLongitude = std::nan("");
+    /// @brief Start time of the run
+    /// @return The start time or an empty time if no sample arrived yet
+    [[nodiscard]] InsTime startTime() const;
 
   private:
-    /// Mutex to lock before writing
-    static inline std::mutex _mutex;
-    /// Vector on which nodes want to initialize
-    static inline std::vector<bool> _wantsInit;
-    /// Index which common log node this is
-    size_t _index = 0;
+    /// Context of the flow run
+    std::shared_ptr<RunContext> _runContext = std::make_shared<RunContext>();
 };
 
 } // namespace NAV
@@ -0,0 +1,110 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "EpochArena.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+
+namespace NAV
+{
+
+namespace
+{
+
+/// @brief Alignment of the retained buffer
+constexpr size_t BUFFER_ALIGNMENT = alignof(std::max_align_t);
+
+/// @brief Rounds the value up to a multiple of the alignment
+/// @param[in] value Value to round
+/// @param[in] alignment Alignment (power of 2)
+constexpr size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+EpochArena::EpochArena(size_t initialCapacity, std::pmr::memory_resource* upstream)
+    : _upstream(upstream)
+{
+    if (initialCapacity != 0)
+    {
+        _capacity = alignUp(initialCapacity, BUFFER_ALIGNMENT);
+        _buffer = static_cast<std::byte*>(_upstream->allocate(_capacity, BUFFER_ALIGNMENT));
+    }
+}
+
+EpochArena::EpochArena(const EpochArena& other)
+    : std::pmr::memory_resource(other), _upstream(other._upstream) {}
+
+EpochArena::~EpochArena()
+{
+    releaseOverflowBlocks();
+    if (_buffer) { _upstream->deallocate(_buffer, _capacity, BUFFER_ALIGNMENT); }
+}
+
+void EpochArena::reset()
+{
+    size_t requested = _used + _overflowBytes;
+    _highWaterMark = std::max(_highWaterMark, requested);
+
+    if (_overflowBlocks)
+    {
+        releaseOverflowBlocks();
+
+        if (_buffer) { _upstream->deallocate(_buffer, _capacity, BUFFER_ALIGNMENT); }
+        _capacity = alignUp(std::bit_ceil(requested), BUFFER_ALIGNMENT);
+        _buffer = static_cast<std::byte*>(_upstream->allocate(_capacity, BUFFER_ALIGNMENT));
+    }
+
+    _used = 0;
+    _overflowBytes = 0;
+    _overflowCount = 0;
+}
+
+void* EpochArena::do_allocate(size_t bytes, size_t alignment)
+{
+    bytes = std::max<size_t>(bytes, 1);
+
+    if (_buffer)
+    {
+        void* p = _buffer + _used;
+        size_t space = _capacity - _used;
+        if (std::align(alignment, bytes, p, space))
+        {
+            _used = _capacity - space + bytes;
+            return p;
+        }
+    }
+
+    // Buffer exhausted, the block gets merged into the buffer on the next reset
+    size_t blockAlignment = std::max(alignment, alignof(OverflowBlock));
+    size_t headerSize = alignUp(sizeof(OverflowBlock), blockAlignment);
+    size_t blockSize = headerSize + bytes;
+
+    auto* block = static_cast<std::byte*>(_upstream->allocate(blockSize, blockAlignment));
+    _overflowBlocks = ::new (block) OverflowBlock{ .next = _overflowBlocks, .size = blockSize, .alignment = blockAlignment };
+    _overflowBytes += bytes + alignment;
+    _overflowCount++;
+
+    return block + headerSize;
+}
+
+void EpochArena::releaseOverflowBlocks()
+{
+    while (_overflowBlocks)
+    {
+        OverflowBlock block = *_overflowBlocks;
+        _upstream->deallocate(_overflowBlocks, block.size, block.alignment);
+        _overflowBlocks = block.next;
+    }
+}
+
+} // namespace NAV
@@ -0,0 +1,96 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file EpochArena.hpp
+/// @brief Memory resource for data which only lives during the processing of one epoch
+/// @date 2026-10-18
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace NAV
+{
+
+/// @brief Monotonic memory resource, which is released as a whole after every epoch
+///
+/// Allocations are served by bumping an offset in a retained buffer and deallocations are no-ops.
+/// When the buffer is exhausted, the memory is requested from the upstream resource instead.
+/// On reset() all memory is released at once and the buffer grows to the high-water mark, so that
+/// after a few warm-up epochs the processing of an epoch does not allocate on the heap anymore.
+///
+/// @note Copying an arena does not copy its memory. The copy starts empty with the same upstream resource.
+class EpochArena : public std::pmr::memory_resource
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] initialCapacity Initial size of the buffer in [bytes]
+    /// @param[in] upstream Resource used for the buffer and for the overflow allocations
+    explicit EpochArena(size_t initialCapacity = 0, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    /// @brief Destructor
+    ~EpochArena() override;
+    /// @brief Copy constructor
+    EpochArena(const EpochArena& other);
+    /// @brief Move constructor
+    EpochArena(EpochArena&&) = delete;
+    /// @brief Copy assignment operator (keeps the own memory)
+    EpochArena& operator=(const EpochArena& /* other */) { return *this; }
+    /// @brief Move assignment operator
+    EpochArena& operator=(EpochArena&&) = delete;
+
+    /// @brief Releases all memory allocated during the epoch and grows the buffer to the high-water mark if it overflowed
+    /// @attention All objects allocated from the arena must be destroyed before
+    void reset();
+
+    /// @brief Size of the retained buffer in [bytes]
+    [[nodiscard]] size_t capacity() const { return _capacity; }
+    /// @brief Bytes used in the buffer since the last reset
+    [[nodiscard]] size_t used() const { return _used; }
+    /// @brief Maximum amount of bytes requested during one epoch
+    [[nodiscard]] size_t highWaterMark() const { return _highWaterMark; }
+    /// @brief Amount of allocations since the last reset, which did not fit into the buffer
+    [[nodiscard]] size_t overflowCount() const { return _overflowCount; }
+
+  private:
+    /// @brief Header in front of every allocation from the upstream resource
+    struct OverflowBlock
+    {
+        OverflowBlock* next = nullptr; ///< Next block in the list
+        size_t size = 0;               ///< Size of the whole block in [bytes]
+        size_t alignment = 0;          ///< Alignment of the whole block in [bytes]
+    };
+
+    /// @brief Allocates memory
+    /// @param[in] bytes Size of the memory in [bytes]
+    /// @param[in] alignment Alignment of the memory in [bytes]
+    /// @return Pointer to the memory
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    /// @brief Does nothing, as the memory is released on reset()
+    void do_deallocate(void* /* p */, size_t /* bytes */, size_t /* alignment */) override {}
+
+    /// @brief Compares for equality with another memory resource
+    /// @param[in] other Other memory resource
+    /// @return True if memory allocated by one can be deallocated by the other
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    /// @brief Returns the overflow blocks to the upstream resource
+    void releaseOverflowBlocks();
+
+    std::pmr::memory_resource* _upstream = nullptr; ///< Resource used for the buffer and for the overflow allocations
+    std::byte* _buffer = nullptr;                    ///< Retained buffer
+    size_t _capacity = 0;                            ///< Size of the buffer in [bytes]
+    size_t _used = 0;                                ///< Bytes used in the buffer since the last reset
+    size_t _overflowBytes = 0;                       ///< Bytes which did not fit into the buffer since the last reset (incl. alignment)
+    size_t _overflowCount = 0;                       ///< Amount of allocations which did not fit into the buffer since the last reset
+    size_t _highWaterMark = 0;                       ///< Maximum amount of bytes requested during one epoch
+    OverflowBlock* _overflowBlocks = nullptr;        ///< List of allocations from the upstream resource
+};
+
+} // namespace NAV
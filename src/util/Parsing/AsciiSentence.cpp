@@ -0,0 +1,64 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AsciiSentence.hpp"
+
+#include <cctype>
+
+namespace NAV::ascii
+{
+
+std::string_view trimLeadingNonPrintable(std::string_view line)
+{
+    size_t start = 0;
+    while (start < line.size() && !std::isgraph(static_cast<unsigned char>(line[start]))) { start++; }
+    return line.substr(start);
+}
+
+std::string_view trimTrailingWhitespace(std::string_view line)
+{
+    while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) { line.remove_suffix(1); }
+    return line;
+}
+
+namespace nmea
+{
+
+uint8_t checksum(std::string_view payload)
+{
+    uint8_t checksum = 0;
+    for (char c : payload) { checksum ^= static_cast<uint8_t>(c); }
+    return checksum;
+}
+
+std::optional<std::string_view> validate(std::string_view sentence)
+{
+    //  |->                          <-|            Checksum without first $ sign and till the *
+    // $--ZDA,hhmmss.ss,xx,xx,xxxx,xx,xx*hh<CR><LF>
+    sentence = trimTrailingWhitespace(sentence);
+    if (sentence.size() < 4 || (sentence.front() != '$' && sentence.front() != '!')) { return std::nullopt; }
+
+    size_t posStar = sentence.size() - 3;
+    if (sentence[posStar] != '*') { return std::nullopt; }
+
+    auto expected = parse<uint8_t>(sentence.substr(posStar + 1), 16);
+    auto payload = sentence.substr(1, posStar - 1);
+    if (!expected || *expected != checksum(payload)) { return std::nullopt; }
+
+    return payload;
+}
+
+std::string_view sentenceFormatter(std::string_view address)
+{
+    if (address.starts_with('P') || address.size() != 5) { return address; }
+    return address.substr(2);
+}
+
+} // namespace nmea
+
+} // namespace NAV::ascii
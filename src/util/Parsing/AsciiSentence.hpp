@@ -0,0 +1,205 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AsciiSentence.hpp
+/// @brief Allocation free decoding of ASCII sentences like NMEA or text position formats
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace NAV::ascii
+{
+
+/// @brief Fields of a sentence, which reference the memory of the sentence
+/// @tparam N Maximum amount of fields. Further fields are dropped and the fields are marked as truncated.
+/// @attention The fields are only valid as long as the split sentence is alive and unchanged
+template<size_t N = 32>
+class Fields
+{
+  public:
+    /// @brief Default constructor (no fields)
+    Fields() = default;
+
+    /// @brief Splits the sentence at every occurrence of the delimiter. Empty fields are kept.
+    /// @param[in] sentence Sentence to split
+    /// @param[in] delimiter Character separating the fields
+    Fields(std::string_view sentence, char delimiter)
+    {
+        size_t start = 0;
+        for (size_t end = sentence.find(delimiter); end != std::string_view::npos; end = sentence.find(delimiter, start))
+        {
+            add(sentence.substr(start, end - start));
+            start = end + 1;
+        }
+        add(sentence.substr(start));
+    }
+
+    /// @brief Splits the sentence at whitespace. Consecutive whitespace counts as one separator.
+    /// @param[in] sentence Sentence to split
+    /// @return The non-empty fields
+    static Fields splitWhitespace(std::string_view sentence)
+    {
+        constexpr std::string_view WHITESPACE = " \t\r\n\v\f";
+
+        Fields fields;
+        for (size_t start = sentence.find_first_not_of(WHITESPACE); start != std::string_view::npos;)
+        {
+            size_t end = sentence.find_first_of(WHITESPACE, start);
+            fields.add(sentence.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start));
+            if (end == std::string_view::npos) { break; }
+            start = sentence.find_first_not_of(WHITESPACE, end);
+        }
+        return fields;
+    }
+
+    /// @brief Amount of fields
+    [[nodiscard]] size_t size() const { return _size; }
+    /// @brief Checks whether there are no fields
+    [[nodiscard]] bool empty() const { return _size == 0; }
+    /// @brief Checks whether the sentence had more than N fields
+    [[nodiscard]] bool truncated() const { return _truncated; }
+
+    /// @brief Access the field
+    /// @param[in] i Index of the field
+    /// @return The field or an empty field if the index is out of range
+    [[nodiscard]] std::string_view operator[](size_t i) const { return i < _size ? _fields[i] : std::string_view{}; }
+
+    /// @brief Iterator to the first field
+    [[nodiscard]] auto begin() const { return _fields.begin(); }
+    /// @brief Iterator behind the last field
+    [[nodiscard]] auto end() const { return _fields.begin() + static_cast<std::ptrdiff_t>(_size); }
+
+  private:
+    /// @brief Appends a field
+    /// @param[in] field Field to add
+    void add(std::string_view field)
+    {
+        if (_size < N) { _fields[_size++] = field; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        else { _truncated = true; }
+    }
+
+    std::array<std::string_view, N> _fields{}; ///< Fields
+    size_t _size = 0;                          ///< Amount of fields
+    bool _truncated = false;                   ///< Flag whether fields were dropped
+};
+
+/// @brief Parses the whole field as a number
+/// @tparam T Arithmetic type to parse
+/// @param[in] field Field to parse (a leading '+' sign is accepted)
+/// @param[in] base Base for integral types
+/// @return The number or nothing if the field is empty, malformed or out of range
+template<typename T>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] std::optional<T> parse(std::string_view field, int base = 10)
+{
+    if (field.starts_with('+')) { field.remove_prefix(1); }
+    if (field.empty()) { return std::nullopt; }
+
+    T value{};
+    std::from_chars_result result{};
+    if constexpr (std::is_floating_point_v<T>) { result = std::from_chars(field.data(), field.data() + field.size(), value); }
+    else { result = std::from_chars(field.data(), field.data() + field.size(), value, base); }
+
+    if (result.ec != std::errc{} || result.ptr != field.data() + field.size()) { return std::nullopt; }
+    return value;
+}
+
+/// @brief Parses the whole field as a number
+/// @tparam T Arithmetic type to parse
+/// @param[in] field Field to parse (a leading '+' sign is accepted)
+/// @return The number
+/// @throws std::invalid_argument if the field can not be parsed
+template<typename T>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] T to(std::string_view field)
+{
+    if (auto value = parse<T>(field)) { return *value; }
+    throw std::invalid_argument("Field '" + std::string(field) + "' is not a valid number");
+}
+
+/// @brief Removes leading non printable characters (e.g. byte order marks or stray control characters)
+/// @param[in] line Line to trim
+/// @return The line starting at the first printable character
+[[nodiscard]] std::string_view trimLeadingNonPrintable(std::string_view line);
+
+/// @brief Removes trailing line endings and whitespace
+/// @param[in] line Line to trim
+/// @return The line without trailing whitespace
+[[nodiscard]] std::string_view trimTrailingWhitespace(std::string_view line);
+
+namespace nmea
+{
+
+/// @brief Calculates the NMEA checksum (XOR of all characters)
+/// @param[in] payload Characters between '$' and '*'
+/// @return The checksum
+[[nodiscard]] uint8_t checksum(std::string_view payload);
+
+/// @brief Validates the checksum of an NMEA sentence
+/// @param[in] sentence Sentence in the form '$<payload>*hh', optionally followed by <CR><LF>
+/// @return The payload between '$' and '*' or nothing if the sentence is malformed or the checksum does not match
+[[nodiscard]] std::optional<std::string_view> validate(std::string_view sentence);
+
+/// @brief Sentence formatter of the address field, e.g. 'GGA' for 'GPGGA' (proprietary sentences return the whole address)
+/// @param[in] address First field of the payload
+[[nodiscard]] std::string_view sentenceFormatter(std::string_view address);
+
+} // namespace nmea
+
+/// @brief Assembles lines out of a byte stream without allocating memory
+/// @tparam N Maximum length of a line. Longer lines are dropped.
+template<size_t N = 256>
+class LineAssembler
+{
+  public:
+    /// @brief Adds a byte of the stream
+    /// @param[in] c Received character
+    /// @return A complete line (without line ending), when the character finishes it.
+    ///         The line is only valid till the next call.
+    [[nodiscard]] std::optional<std::string_view> push(char c)
+    {
+        if (c == '\n' || c == '\r')
+        {
+            bool complete = _size != 0 && !_overflow;
+            size_t size = _size;
+            _size = 0;
+            _overflow = false;
+            if (complete) { return std::string_view(_buffer.data(), size); }
+            return std::nullopt;
+        }
+        if (_size < N) { _buffer[_size++] = c; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        else if (!_overflow)
+        {
+            _overflow = true;
+            _droppedLines++;
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Amount of lines which were dropped because they were too long
+    [[nodiscard]] size_t droppedLines() const { return _droppedLines; }
+
+  private:
+    std::array<char, N> _buffer{}; ///< Characters of the current line
+    size_t _size = 0;              ///< Amount of characters in the current line
+    bool _overflow = false;        ///< Flag whether the current line is too long
+    size_t _droppedLines = 0;      ///< Amount of dropped lines
+};
+
+} // namespace NAV::ascii
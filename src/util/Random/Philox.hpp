@@ -0,0 +1,108 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Philox.hpp
+/// @brief Counter-based random number generator Philox4x32-10
+/// @date 2026-10-18
+/// @note See \cite Salmon2011 Salmon et al. (2011) - Parallel Random Numbers: As Easy as 1, 2, 3
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+namespace NAV
+{
+
+/// @brief Counter-based random number generator Philox4x32-10
+///
+/// The output is a bijective function of a 128 bit counter, scrambled with a 64 bit key. Every random number can therefore be
+/// computed directly from its index, without generating the numbers before it. This makes the sequence independent of the
+/// order of the draws, the amount of threads and the batch size.
+class Philox4x32
+{
+  public:
+    /// 128 bit counter
+    using Counter = std::array<uint32_t, 4>;
+    /// 64 bit key
+    using Key = std::array<uint32_t, 2>;
+
+    /// @brief Generates the random block for the counter
+    /// @param[in] counter Counter (e.g. index of the sample)
+    /// @param[in] key Key (e.g. derived from the seed)
+    /// @return 128 random bits
+    [[nodiscard]] static constexpr Counter generate(Counter counter, Key key) noexcept
+    {
+        for (size_t r = 0; r < ROUNDS; r++)
+        {
+            if (r != 0)
+            {
+                key[0] += W0;
+                key[1] += W1;
+            }
+            uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+            uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+            counter = { static_cast<uint32_t>(p1 >> 32U) ^ counter[1] ^ key[0],
+                        static_cast<uint32_t>(p1),
+                        static_cast<uint32_t>(p0 >> 32U) ^ counter[3] ^ key[1],
+                        static_cast<uint32_t>(p0) };
+        }
+        return counter;
+    }
+
+    /// @brief Splits a 64 bit number into the two words of a key
+    /// @param[in] seed 64 bit number
+    [[nodiscard]] static constexpr Key makeKey(uint64_t seed) noexcept
+    {
+        return { static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32U) };
+    }
+
+    /// @brief Builds a counter from a sample index and a stream index
+    /// @param[in] index Index of the sample
+    /// @param[in] stream Index of a sub-stream (e.g. the component of a vector)
+    [[nodiscard]] static constexpr Counter makeCounter(uint64_t index, uint64_t stream = 0) noexcept
+    {
+        return { static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32U),
+                 static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32U) };
+    }
+
+    /// @brief Converts two random words into a uniformly distributed number in the open interval (0, 1)
+    /// @param[in] lo Lower random word
+    /// @param[in] hi Upper random word
+    /// @return Random number with 53 bit resolution, which is never exactly 0 or 1
+    [[nodiscard]] static constexpr double toUniform(uint32_t lo, uint32_t hi) noexcept
+    {
+        uint64_t bits = ((static_cast<uint64_t>(hi) << 32U) | lo) >> 11U;
+        return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+    }
+
+    /// @brief Converts a random block into a standard normal distributed number (Box-Muller transform)
+    /// @param[in] block Random block
+    [[nodiscard]] static double toNormal(const Counter& block) noexcept
+    {
+        double u1 = toUniform(block[0], block[1]);
+        double u2 = toUniform(block[2], block[3]);
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2);
+    }
+
+  private:
+    /// Number of rounds
+    static constexpr size_t ROUNDS = 10;
+    /// Multiplier of the first word pair
+    static constexpr uint32_t M0 = 0xD2511F53;
+    /// Multiplier of the second word pair
+    static constexpr uint32_t M1 = 0xCD9E8D57;
+    /// Weyl sequence increment of the first key word (golden ratio)
+    static constexpr uint32_t W0 = 0x9E3779B9;
+    /// Weyl sequence increment of the second key word (sqrt(3) - 1)
+    static constexpr uint32_t W1 = 0xBB67AE85;
+};
+
+} // namespace NAV
@@ -13,18 +13,31 @@
 
 #pragma once
 
-#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
 #include <string>
 
+#include <Eigen/Core>
+
 #include <nlohmann/json.hpp>
 using json = nlohmann::json; ///< json namespace
 
+#include "Philox.hpp"
 #include "SHA256.hpp"
 
 namespace NAV
 {
 
-/// @brief Manages a thread which calls a specified function at a specified interval
+/// @brief Random number generator based on the counter-based generator Philox4x32-10
+///
+/// Every draw is a function of the seed and the index of the draw (sample index) only. The sequential functions draw at the
+/// current sample index and advance it by one. The functions ending with 'At' draw at the given sample index without changing
+/// the state and can be called from several threads at once. Noise for a sample is therefore identical, regardless of the
+/// threading, the batch size or draws which were skipped with jumpAhead().
 class RandomNumberGenerator
 {
   public:
@@ -41,25 +54,34 @@ class RandomNumberGenerator
     /// @brief Destructor
     ~RandomNumberGenerator() = default;
 
-    /// @brief Reset the seed to the internal seed or the system time
+    /// @brief Reset the seed to the internal seed or the system time and start again at the first sample
     /// @param id Some id used to make a unique hash when using the system time to set the seed
     void resetSeed(size_t id = 0)
     {
         uint64_t seed = useSeed ? this->seed : static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
-        auto hash = hashSeed(std::to_string(seed) + (useSeed || id == 0 ? "" : " " + std::to_string(id)));
-        std::seed_seq seed_seq(hash.begin(), hash.end());
-        _generator.seed(seed_seq);
+        _key = hashSeed(std::to_string(seed) + (useSeed || id == 0 ? "" : " " + std::to_string(id)));
+        _sampleIndex = 0;
     }
 
     /// @brief Reset the seed to the specified seed, but do not update the internal seed
     /// @param[in] userSeed Seed to use once
     void resetSeedOnce(uint64_t userSeed)
     {
-        auto hash = hashSeed(std::to_string(userSeed));
-        std::seed_seq seed_seq(hash.begin(), hash.end());
-        _generator.seed(seed_seq);
+        _key = hashSeed(std::to_string(userSeed));
+        _sampleIndex = 0;
     }
 
+    /// @brief Index of the sample which is drawn next
+    [[nodiscard]] uint64_t sampleIndex() const { return _sampleIndex; }
+
+    /// @brief Sets the index of the sample which is drawn next
+    /// @param[in] sampleIndex Sample index
+    void setSampleIndex(uint64_t sampleIndex) { _sampleIndex = sampleIndex; }
+
+    /// @brief Skips samples without generating them
+    /// @param[in] samples Amount of samples to skip
+    void jumpAhead(uint64_t samples) { _sampleIndex += samples; }
+
     /// @brief Gets a random integer number from an uniform distribution
     /// @tparam IntType The result type generated by the generator. The effect is undefined if this is not one of short, int, long, long long, unsigned short, unsigned int, unsigned long, or unsigned long long.
     /// @param min Minimum value
@@ -68,7 +90,7 @@ class RandomNumberGenerator
     template<typename IntType = int>
     double getRand_uniformIntDist(IntType min = 0, IntType max = std::numeric_limits<IntType>::max())
     {
-        return std::uniform_int_distribution<IntType>(min, max)(_generator);
+        return static_cast<double>(getRand_uniformIntDistAt(_sampleIndex++, min, max));
     }
 
     /// @brief Gets a random real number from an uniform distribution
@@ -79,7 +101,7 @@ class RandomNumberGenerator
     template<typename RealType = double>
     double getRand_uniformRealDist(RealType min = 0.0, RealType max = 1.0)
     {
-        return std::uniform_real_distribution<RealType>(min, max)(_generator);
+        return getRand_uniformRealDistAt(_sampleIndex++, min, max);
     }
 
     /// @brief Gets a random number from a normal distribution
@@ -90,29 +112,103 @@ class RandomNumberGenerator
     template<typename RealType = double>
     double getRand_normalDist(RealType mean = 0.0, RealType stddev = 1.0)
     {
-        return std::normal_distribution<RealType>(mean, stddev)(_generator);
+        return getRand_normalDistAt(_sampleIndex++, mean, stddev);
+    }
+
+    /// @brief Gets a vector of normal distributed random numbers with zero mean. Draws one sample per component.
+    /// @param[in] stddev Standard deviation of each component
+    /// @return Random vector
+    template<typename Derived>
+    typename Derived::PlainObject getRand_normalDistVector(const Eigen::MatrixBase<Derived>& stddev)
+    {
+        typename Derived::PlainObject result(stddev.rows(), stddev.cols());
+        for (Eigen::Index i = 0; i < stddev.size(); i++)
+        {
+            result(i) = getRand_normalDistAt(_sampleIndex + static_cast<uint64_t>(i), 0.0, static_cast<double>(stddev(i)));
+        }
+        _sampleIndex += static_cast<uint64_t>(stddev.size());
+        return result;
+    }
+
+    /// @brief Fills the range with normal distributed random numbers. Draws one sample per element.
+    /// @param[out] out Range to fill
+    /// @param mean The μ distribution parameter (mean)
+    /// @param stddev The σ distribution parameter (standard deviation)
+    void fillRand_normalDist(std::span<double> out, double mean = 0.0, double stddev = 1.0)
+    {
+        // The iterations are independent of each other, so the compiler can vectorize the loop
+        for (size_t i = 0; i < out.size(); i++)
+        {
+            out[i] = mean + stddev * Philox4x32::toNormal(Philox4x32::generate(Philox4x32::makeCounter(_sampleIndex + i), _key));
+        }
+        _sampleIndex += out.size();
+    }
+
+    /// @brief Gets the random integer number of the sample from an uniform distribution. Does not change the state.
+    /// @tparam IntType The result type generated by the generator
+    /// @param sampleIndex Index of the sample
+    /// @param min Minimum value
+    /// @param max Maximum value
+    /// @return Random number
+    template<typename IntType = int>
+    [[nodiscard]] IntType getRand_uniformIntDistAt(uint64_t sampleIndex, IntType min = 0, IntType max = std::numeric_limits<IntType>::max()) const
+    {
+        auto block = Philox4x32::generate(Philox4x32::makeCounter(sampleIndex), _key);
+        auto range = static_cast<long double>(max) - static_cast<long double>(min) + 1.0L;
+        auto value = static_cast<long double>(min) + std::floor(static_cast<long double>(Philox4x32::toUniform(block[0], block[1])) * range);
+        return std::min(static_cast<IntType>(value), max);
+    }
+
+    /// @brief Gets the random real number of the sample from an uniform distribution. Does not change the state.
+    /// @tparam RealType The result type generated by the generator
+    /// @param sampleIndex Index of the sample
+    /// @param min Minimum value
+    /// @param max Maximum value
+    /// @return Random number
+    template<typename RealType = double>
+    [[nodiscard]] double getRand_uniformRealDistAt(uint64_t sampleIndex, RealType min = 0.0, RealType max = 1.0) const
+    {
+        auto block = Philox4x32::generate(Philox4x32::makeCounter(sampleIndex), _key);
+        return static_cast<double>(min) + static_cast<double>(max - min) * Philox4x32::toUniform(block[0], block[1]);
+    }
+
+    /// @brief Gets the random number of the sample from a normal distribution. Does not change the state.
+    /// @tparam RealType The result type generated by the generator
+    /// @param sampleIndex Index of the sample
+    /// @param mean The μ distribution parameter (mean)
+    /// @param stddev The σ distribution parameter (standard deviation)
+    /// @return Random number
+    template<typename RealType = double>
+    [[nodiscard]] double getRand_normalDistAt(uint64_t sampleIndex, RealType mean = 0.0, RealType stddev = 1.0) const
+    {
+        return static_cast<double>(mean) + static_cast<double>(stddev) * Philox4x32::toNormal(Philox4x32::generate(Philox4x32::makeCounter(sampleIndex), _key));
     }
 
     bool useSeed = true; ///< Flag whether to use the seed instead of the system time
     uint64_t seed = 0;   ///< Seed for the random number generator
 
   private:
-    /// @brief Hash the given seed
+    /// @brief Hash the given seed into the key of the generator
     /// @param seed Seed
-    /// @return Hashed seed
-    static std::string hashSeed(const std::string& seed)
+    /// @return Key from the first 8 bytes of the SHA256 hash
+    static Philox4x32::Key hashSeed(const std::string& seed)
     {
         SHA256 sha;
         sha.update(seed);
         uint8_t* digest = sha.digest();
 
-        std::string hashed(digest, digest + 32); // NOLINT //SHA256::ToString method is shady... (manipulates data?). Keep Pointer Arithmetic
-        delete[] digest;                         // NOLINT
+        Philox4x32::Key key{};
+        for (size_t i = 0; i < 8; i++)
+        {
+            key.at(i / 4) |= static_cast<uint32_t>(digest[i]) << (8 * (i % 4)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        delete[] digest; // NOLINT
 
-        return hashed;
+        return key;
     }
 
-    std::mt19937_64 _generator; ///< Random number generator
+    Philox4x32::Key _key = Philox4x32::makeKey(0); ///< Key of the generator derived from the seed
+    uint64_t _sampleIndex = 0;                     ///< Index of the sample which is drawn next
 };
 
 /// @brief Write info to a json object
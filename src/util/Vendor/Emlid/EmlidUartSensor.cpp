@@ -112,6 +112,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::emlid::EmlidUartSensor::fin
                     return p;
                 }
                 // Invalid packet!
+                if (_invalidPacketHandler) { _invalidPacketHandler(); }
                 LOG_DEBUG("{}: Invalid binary packet: Id={:0x}, payload length={}", _name, _binaryMsgId, _binaryPayloadLength);
                 resetTracking();
             }
@@ -144,6 +145,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::emlid::EmlidUartSensor::fin
                     return p;
                 }
                 // Invalid packet!
+                if (_invalidPacketHandler) { _invalidPacketHandler(); }
                 LOG_ERROR("Invalid ascii packet: {}", p->datastr());
             }
 
@@ -179,6 +179,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::kvh::KvhUartSensor::findPac
                 return p;
             }
             // Invalid packet!
+            if (_invalidPacketHandler) { _invalidPacketHandler(); }
             LOG_DEBUG("{}: Invalid binary packet: Type={}, Length={}", _name, fmt::underlying(_packetType), _buffer.size());
             resetTracking();
         }
@@ -214,6 +215,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::kvh::KvhUartSensor::findPac
                     return p;
                 }
                 // Invalid packet!
+                if (_invalidPacketHandler) { _invalidPacketHandler(); }
                 LOG_ERROR("{}: Invalid ascii packet: {}", _name, p->datastr());
             }
 
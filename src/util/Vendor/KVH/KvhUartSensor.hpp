@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "uart/sensors/sensors.hpp"
@@ -47,6 +48,10 @@ class KvhUartSensor
     /// @return nullptr if no packet found yet, otherwise a pointer to the packet
     std::unique_ptr<uart::protocol::Packet> findPacket(uint8_t dataByte);
 
+    /// @brief Sets the function which is called for every packet discarded because of a wrong checksum
+    /// @param[in] handler Function to call (called from the read thread of the sensor)
+    void setInvalidPacketHandler(std::function<void()> handler) { _invalidPacketHandler = std::move(handler); }
+
     static constexpr uint32_t HEADER_FMT_A = 0xFE81FF55;     ///< Header Format A
     static constexpr uint32_t HEADER_FMT_B = 0xFE81FF56;     ///< Header Format B
     static constexpr uint32_t HEADER_FMT_C = 0xFE81FF57;     ///< Header Format C
@@ -59,6 +64,9 @@ class KvhUartSensor
     /// Name of the Parent Node
     const std::string _name;
 
+    /// Function which is called for every packet discarded because of a wrong checksum
+    std::function<void()> _invalidPacketHandler;
+
     /// UartSensor object which handles the UART interface
     uart::sensors::UartSensor _sensor{ ENDIANNESS,
                                        packetFinderFunction,
@@ -0,0 +1,811 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RtcmDecoder.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <bitset>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/BDSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GalileoEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "util/Logger.hpp"
+#include "util/Vendor/RINEX/RINEXUtilities.hpp"
+
+namespace NAV::vendor::rtcm
+{
+namespace
+{
+
+/// Size of the frame without message (preamble, length and checksum) [bytes]
+constexpr size_t FRAME_OVERHEAD = 6;
+/// Distance light travels in one millisecond [m]
+constexpr double RANGE_MS = InsConst<>::C * 1e-3;
+/// Offset of the GLONASS time (Moscow time) to UTC [s]
+constexpr double GLONASS_TIME_OFFSET = 10800.0;
+/// Offset of the BeiDou time to GPST [s]
+constexpr double BDT_OFFSET = 14.0;
+
+/// CRC-24Q lookup table with the polynomial 0x1864CFB
+constexpr std::array<uint32_t, 256> CRC24Q_TABLE = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i << 16;
+        for (size_t k = 0; k < 8; k++)
+        {
+            crc <<= 1;
+            if (crc & 0x1000000) { crc ^= 0x1864CFB; }
+        }
+        table.at(i) = crc & 0xFFFFFF;
+    }
+    return table;
+}();
+
+/// @brief Reads the big-endian bit fields of a message
+class BitReader
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] data Message
+    explicit BitReader(std::span<const uint8_t> data) : _data(data) {}
+
+    /// @brief Reads an unsigned value
+    /// @param[in] nBits Amount of bits (up to 64)
+    uint64_t u(size_t nBits)
+    {
+        if (_pos + nBits > _data.size() * 8)
+        {
+            _overflow = true;
+            _pos = _data.size() * 8;
+            return 0;
+        }
+        uint64_t value = 0;
+        while (nBits > 0)
+        {
+            size_t bitInByte = _pos % 8;
+            size_t take = std::min(nBits, 8 - bitInByte);
+            auto byte = static_cast<uint64_t>(_data[_pos / 8]);
+            value = (value << take) | ((byte >> (8 - bitInByte - take)) & ((1U << take) - 1));
+            _pos += take;
+            nBits -= take;
+        }
+        return value;
+    }
+
+    /// @brief Reads a signed value in two's complement
+    /// @param[in] nBits Amount of bits (up to 64)
+    int64_t s(size_t nBits)
+    {
+        uint64_t value = u(nBits);
+        if (nBits < 64 && (value >> (nBits - 1)) & 1) { value |= ~uint64_t(0) << nBits; }
+        return static_cast<int64_t>(value);
+    }
+
+    /// @brief Reads a signed value in sign-magnitude representation (GLONASS)
+    /// @param[in] nBits Amount of bits (up to 64)
+    int64_t sm(size_t nBits)
+    {
+        uint64_t value = u(nBits);
+        auto magnitude = static_cast<int64_t>(value & ((uint64_t(1) << (nBits - 1)) - 1));
+        return (value >> (nBits - 1)) ? -magnitude : magnitude;
+    }
+
+    /// @brief Skips bits
+    /// @param[in] nBits Amount of bits
+    void skip(size_t nBits)
+    {
+        if (_pos + nBits > _data.size() * 8) { _overflow = true; }
+        _pos = std::min(_pos + nBits, _data.size() * 8);
+    }
+
+    /// @brief Whether all fields were inside the message
+    [[nodiscard]] bool ok() const { return !_overflow; }
+
+  private:
+    std::span<const uint8_t> _data; ///< Message
+    size_t _pos = 0;                ///< Position of the next bit
+    bool _overflow = false;         ///< Whether a field was read beyond the end of the message
+};
+
+/// @brief Scales an integer value by a power of two
+/// @param[in] value Integer value
+/// @param[in] exponent Exponent of the scale factor
+constexpr double scale(auto value, int exponent)
+{
+    return std::ldexp(static_cast<double>(value), exponent);
+}
+
+/// Signals of the MSM signal mask as RINEX band and attribute (index = signal ID - 1)
+using MsmSignals = std::array<std::string_view, 32>;
+
+/// GPS MSM signals
+constexpr MsmSignals MSM_SIGNALS_GPS = { "", "1C", "1P", "1W", "", "", "", "2C", "2P", "2W", "", "", "", "", "2S", "2L",
+                                         "2X", "", "", "", "", "5I", "5Q", "5X", "", "", "", "", "", "1S", "1L", "1X" };
+/// GLONASS MSM signals
+constexpr MsmSignals MSM_SIGNALS_GLO = { "", "1C", "1P", "", "", "", "", "2C", "2P", "", "", "", "", "", "", "",
+                                         "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "" };
+/// Galileo MSM signals
+constexpr MsmSignals MSM_SIGNALS_GAL = { "", "1C", "1A", "1B", "1X", "1Z", "", "6C", "6A", "6B", "6X", "6Z", "", "7I", "7Q", "7X",
+                                         "", "8I", "8Q", "8X", "", "5I", "5Q", "5X", "", "", "", "", "", "", "", "" };
+/// SBAS MSM signals
+constexpr MsmSignals MSM_SIGNALS_SBS = { "", "1C", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
+                                         "", "", "", "", "", "5I", "5Q", "5X", "", "", "", "", "", "", "", "" };
+/// QZSS MSM signals
+constexpr MsmSignals MSM_SIGNALS_QZS = { "", "1C", "", "", "", "", "", "", "6S", "6L", "6X", "", "", "", "2S", "2L",
+                                         "2X", "", "", "", "", "5I", "5Q", "5X", "", "", "", "", "", "1S", "1L", "1X" };
+/// BeiDou MSM signals
+constexpr MsmSignals MSM_SIGNALS_BDS = { "", "2I", "2Q", "2X", "", "", "", "6I", "6Q", "6X", "", "", "", "7I", "7Q", "7X",
+                                         "", "", "", "", "", "5D", "5P", "5X", "7D", "", "", "", "", "1D", "1P", "1X" };
+/// IRNSS MSM signals
+constexpr MsmSignals MSM_SIGNALS_IRN = { "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
+                                         "", "", "", "", "", "5A", "", "", "", "", "", "", "", "", "", "" };
+
+/// @brief Satellite systems of the MSM message numbers 1071 - 1137
+constexpr std::array<SatelliteSystem_, 7> MSM_SATELLITE_SYSTEMS = { GPS, GLO, GAL, SBAS, QZSS, BDS, IRNSS };
+
+/// @brief Returns the code of an MSM signal
+/// @param[in] msmSystem Index of the satellite system in MSM_SATELLITE_SYSTEMS
+/// @param[in] signalId Signal ID (1 - 32)
+/// @return The code or Code::None if the signal is reserved
+Code msmCode(size_t msmSystem, size_t signalId)
+{
+    static const auto CODES = [] {
+        constexpr std::array<const MsmSignals*, 7> SIGNALS = { &MSM_SIGNALS_GPS, &MSM_SIGNALS_GLO, &MSM_SIGNALS_GAL, &MSM_SIGNALS_SBS,
+                                                               &MSM_SIGNALS_QZS, &MSM_SIGNALS_BDS, &MSM_SIGNALS_IRN };
+        std::array<std::array<Code, 32>, 7> codes{};
+        for (size_t s = 0; s < SIGNALS.size(); s++)
+        {
+            for (size_t i = 0; i < 32; i++)
+            {
+                const auto& signal = SIGNALS.at(s)->at(i);
+                if (signal.empty()) { continue; }
+                auto freq = RINEX::getFrequencyFromBand(MSM_SATELLITE_SYSTEMS.at(s), signal[0] - '0');
+                codes.at(s).at(i) = Code::fromFreqAttr(freq, signal[1]);
+            }
+        }
+        return codes;
+    }();
+    return CODES.at(msmSystem).at(signalId - 1);
+}
+
+/// @brief Converts the lock time indicator of MSM4 and MSM5 into the minimum lock time
+/// @param[in] indicator Lock time indicator (DF402)
+/// @return Minimum lock time [ms]
+constexpr uint32_t msmLockTime(uint64_t indicator)
+{
+    return indicator == 0 ? 0 : uint32_t(1) << (indicator + 4);
+}
+
+/// @brief Converts the extended lock time indicator of MSM6 and MSM7 into the minimum lock time
+/// @param[in] indicator Extended lock time indicator (DF407)
+/// @return Minimum lock time [ms]
+constexpr uint32_t msmExtendedLockTime(uint64_t indicator)
+{
+    if (indicator < 64) { return static_cast<uint32_t>(indicator); }
+    if (indicator > 704) { return 0; } // Reserved
+    auto k = static_cast<uint32_t>(indicator / 32);
+    return (uint32_t(1) << (k - 1)) * (static_cast<uint32_t>(indicator) - 32 * (k - 1));
+}
+
+} // namespace
+
+uint32_t crc24q(std::span<const uint8_t> data)
+{
+    uint32_t crc = 0;
+    for (const auto& byte : data)
+    {
+        crc = ((crc << 8) & 0xFFFFFF) ^ CRC24Q_TABLE.at(((crc >> 16) ^ byte) & 0xFF);
+    }
+    return crc;
+}
+
+RtcmDecoder::RtcmDecoder(std::string nameId)
+    : _nameId(std::move(nameId)) {}
+
+void RtcmDecoder::setObsHandler(ObsHandler handler)
+{
+    _obsHandler = std::move(handler);
+}
+
+void RtcmDecoder::setNavHandler(NavHandler handler)
+{
+    _navHandler = std::move(handler);
+}
+
+void RtcmDecoder::setReferenceTime(const InsTime& insTime)
+{
+    _referenceTime = insTime;
+}
+
+const InsTime& RtcmDecoder::referenceTime() const
+{
+    return _referenceTime;
+}
+
+void RtcmDecoder::setStationId(std::optional<uint16_t> stationId)
+{
+    _requestedStationId = stationId;
+    _stationId = stationId;
+}
+
+std::optional<uint16_t> RtcmDecoder::stationId() const
+{
+    return _stationId;
+}
+
+const RtcmDecoder::Statistics& RtcmDecoder::statistics() const
+{
+    return _statistics;
+}
+
+void RtcmDecoder::reset()
+{
+    _buffer.clear();
+    _referenceTime.reset();
+    _stationId = _requestedStationId;
+    _epoch.reset();
+    _lockTimes.clear();
+    _glonassFrequencyNumbers.fill(std::nullopt);
+    _lastNavData.clear();
+    _statistics = Statistics{};
+}
+
+size_t RtcmDecoder::feed(std::span<const uint8_t> data)
+{
+    size_t nFrames = 0;
+
+    // Complete the frame which was split over the last and this chunk
+    while (!_buffer.empty())
+    {
+        size_t frameSize = 3;
+        if (_buffer.size() >= 3) { frameSize = ((static_cast<size_t>(_buffer[1] & 0x03) << 8) | _buffer[2]) + FRAME_OVERHEAD; }
+        if (_buffer.size() < frameSize && (_buffer.size() < 2 || !(_buffer[1] & 0xFC)))
+        {
+            if (data.empty()) { break; }
+            size_t n = std::min(frameSize - _buffer.size(), data.size());
+            _buffer.insert(_buffer.end(), data.begin(), data.begin() + static_cast<std::ptrdiff_t>(n));
+            data = data.subspan(n);
+            continue;
+        }
+
+        if (!(_buffer[1] & 0xFC) && decodeFrame(_buffer))
+        {
+            nFrames++;
+            _buffer.clear();
+        }
+        else
+        {
+            // Resynchronize on the bytes after the preamble
+            std::vector<uint8_t> remaining(_buffer.begin() + 1, _buffer.end());
+            _buffer.clear();
+            nFrames += feed(remaining);
+        }
+    }
+
+    // Decode the frames in place
+    size_t pos = 0;
+    while (pos < data.size())
+    {
+        if (data[pos] != PREAMBLE)
+        {
+            pos = static_cast<size_t>(std::find(data.begin() + static_cast<std::ptrdiff_t>(pos), data.end(), PREAMBLE) - data.begin());
+            continue;
+        }
+        if (data.size() - pos < 3) { break; }
+        if (data[pos + 1] & 0xFC) // Reserved bits have to be zero
+        {
+            pos++;
+            continue;
+        }
+        size_t frameSize = ((static_cast<size_t>(data[pos + 1] & 0x03) << 8) | data[pos + 2]) + FRAME_OVERHEAD;
+        if (data.size() - pos < frameSize) { break; }
+
+        if (decodeFrame(data.subspan(pos, frameSize)))
+        {
+            nFrames++;
+            pos += frameSize;
+        }
+        else { pos++; }
+    }
+    if (pos < data.size()) { _buffer.assign(data.begin() + static_cast<std::ptrdiff_t>(pos), data.end()); }
+
+    return nFrames;
+}
+
+void RtcmDecoder::flush()
+{
+    // A corrupt length field can make the buffered frame seem longer than the remaining data
+    while (!_buffer.empty())
+    {
+        std::vector<uint8_t> remaining(_buffer.begin() + 1, _buffer.end());
+        _buffer.clear();
+        feed(remaining);
+    }
+
+    emitEpoch();
+}
+
+void RtcmDecoder::emitEpoch()
+{
+    if (_epoch && !_epoch->data.empty() && _obsHandler)
+    {
+        _statistics.epochs++;
+        _obsHandler(_epoch);
+    }
+    _epoch.reset();
+}
+
+bool RtcmDecoder::decodeFrame(std::span<const uint8_t> frame)
+{
+    size_t length = frame.size() - FRAME_OVERHEAD;
+    uint32_t checksum = (static_cast<uint32_t>(frame[length + 3]) << 16) | (static_cast<uint32_t>(frame[length + 4]) << 8) | frame[length + 5];
+    if (crc24q(frame.first(length + 3)) != checksum)
+    {
+        _statistics.crcErrors++;
+        return false;
+    }
+    _statistics.frames++;
+    if (length < 2) { return true; } // Frames without message are used as filler
+
+    auto message = frame.subspan(3, length);
+    auto messageNumber = static_cast<uint16_t>((static_cast<uint16_t>(message[0]) << 4) | (message[1] >> 4));
+    LOG_DATA("{}: Message {} with {} bytes", _nameId, messageNumber, length);
+
+    bool valid = true;
+    if (1071 <= messageNumber && messageNumber <= 1137 && _obsHandler)
+    {
+        auto msm = static_cast<uint8_t>(messageNumber % 10);
+        if (4 <= msm && msm <= 7) { valid = decodeMsm(message, MSM_SATELLITE_SYSTEMS.at(static_cast<size_t>((messageNumber - 1071) / 10)), msm); }
+        else { _statistics.unsupported++; }
+    }
+    else if (messageNumber == 1019 && _navHandler) { valid = decodeGpsEphemeris(message); }
+    else if (messageNumber == 1020 && _navHandler) { valid = decodeGlonassEphemeris(message); }
+    else if (messageNumber == 1042 && _navHandler) { valid = decodeBeidouEphemeris(message); }
+    else if ((messageNumber == 1045 || messageNumber == 1046) && _navHandler) { valid = decodeGalileoEphemeris(message, messageNumber == 1046); }
+    else { _statistics.unsupported++; }
+
+    if (!valid)
+    {
+        LOG_DEBUG("{}: Discarding the corrupt message {}", _nameId, messageNumber);
+        _statistics.discarded++;
+    }
+    return true;
+}
+
+bool RtcmDecoder::decodeMsm(std::span<const uint8_t> message, SatelliteSystem satSys, uint8_t msm)
+{
+    BitReader bits(message);
+    [[maybe_unused]] auto messageNumber = bits.u(12);
+    auto stationId = static_cast<uint16_t>(bits.u(12));
+    auto epochTime = bits.u(30);
+    bool multipleMessage = bits.u(1);
+    bits.skip(3 + 7 + 2 + 2 + 1 + 3); // IODS, reserved, clock steering, external clock, smoothing indicator and interval
+    uint64_t satMask = bits.u(64);
+    uint64_t sigMask = bits.u(32);
+    auto nSat = static_cast<size_t>(std::popcount(satMask));
+    auto nSig = static_cast<size_t>(std::popcount(sigMask));
+    if (nSat * nSig > 64) { return false; }
+    uint64_t cellMask = bits.u(nSat * nSig);
+    auto nCell = static_cast<size_t>(std::popcount(cellMask));
+    if (!bits.ok()) { return false; }
+
+    if (_stationId && stationId != *_stationId)
+    {
+        _statistics.discarded++;
+        return true;
+    }
+    if (_referenceTime.empty())
+    {
+        LOG_DATA("{}: Discarding message {}, because the week is not known yet", _nameId, messageNumber);
+        _statistics.discarded++;
+        return true;
+    }
+
+    // Satellite data
+    bool extended = msm == 5 || msm == 7;
+    std::array<double, 64> roughRange{};  // [ms]
+    std::array<uint8_t, 64> extendedInfo{};
+    std::array<double, 64> roughRate{}; // [m/s]
+    for (size_t i = 0; i < nSat; i++)
+    {
+        auto value = bits.u(8);
+        roughRange.at(i) = value == 255 ? std::nan("") : static_cast<double>(value);
+    }
+    if (extended)
+    {
+        for (size_t i = 0; i < nSat; i++) { extendedInfo.at(i) = static_cast<uint8_t>(bits.u(4)); }
+    }
+    for (size_t i = 0; i < nSat; i++) { roughRange.at(i) += scale(bits.u(10), -10); }
+    if (extended)
+    {
+        for (size_t i = 0; i < nSat; i++)
+        {
+            auto value = bits.s(14);
+            roughRate.at(i) = value == -8192 ? std::nan("") : static_cast<double>(value);
+        }
+    }
+
+    // Signal data
+    bool highResolution = msm == 6 || msm == 7;
+    std::array<double, 64> finePseudorange{}; // [ms]
+    std::array<double, 64> finePhaserange{};  // [ms]
+    std::array<uint32_t, 64> lockTime{};      // [ms]
+    std::array<bool, 64> halfCycle{};
+    std::array<double, 64> cn0{};              // [dBHz]
+    std::array<double, 64> finePhaserangeRate{}; // [m/s]
+    for (size_t i = 0; i < nCell; i++)
+    {
+        auto value = highResolution ? bits.s(20) : bits.s(15);
+        finePseudorange.at(i) = value == (highResolution ? -524288 : -16384) ? std::nan("") : scale(value, highResolution ? -29 : -24);
+    }
+    for (size_t i = 0; i < nCell; i++)
+    {
+        auto value = highResolution ? bits.s(24) : bits.s(22);
+        finePhaserange.at(i) = value == (highResolution ? -8388608 : -2097152) ? std::nan("") : scale(value, highResolution ? -31 : -29);
+    }
+    for (size_t i = 0; i < nCell; i++) { lockTime.at(i) = highResolution ? msmExtendedLockTime(bits.u(10)) : msmLockTime(bits.u(4)); }
+    for (size_t i = 0; i < nCell; i++) { halfCycle.at(i) = bits.u(1); }
+    for (size_t i = 0; i < nCell; i++) { cn0.at(i) = highResolution ? scale(bits.u(10), -4) : static_cast<double>(bits.u(6)); }
+    if (extended)
+    {
+        for (size_t i = 0; i < nCell; i++)
+        {
+            auto value = bits.s(15);
+            finePhaserangeRate.at(i) = value == -16384 ? std::nan("") : static_cast<double>(value) * 1e-4;
+        }
+    }
+    if (!bits.ok()) { return false; }
+
+    // Epoch time
+    InsTime insTime;
+    if (satSys == GLO)
+    {
+        auto dayOfWeek = epochTime >> 27;
+        double timeOfDay = static_cast<double>(epochTime & 0x7FFFFFF) * 1e-3 - GLONASS_TIME_OFFSET + _referenceTime.leapGps2UTC();
+        insTime = dayOfWeek == 7 ? resolveTime(timeOfDay, InsTimeUtil::SECONDS_PER_DAY)
+                                 : resolveTime(static_cast<double>(dayOfWeek) * InsTimeUtil::SECONDS_PER_DAY + timeOfDay, InsTimeUtil::SECONDS_PER_WEEK);
+    }
+    else
+    {
+        double timeOfWeek = static_cast<double>(epochTime) * 1e-3 + (satSys == BDS ? BDT_OFFSET : 0.0);
+        insTime = resolveTime(timeOfWeek, InsTimeUtil::SECONDS_PER_WEEK);
+    }
+    LOG_DATA("{}: [{}] MSM{} of {} from station {} with {} satellites and {} signals", _nameId, insTime.toYMDHMS(GPST), msm, satSys, stationId, nSat, nCell);
+
+    if (!_stationId)
+    {
+        LOG_DEBUG("{}: Decoding the observations of station {}", _nameId, stationId);
+        _stationId = stationId;
+    }
+    if (_epoch && std::abs((_epoch->insTime - insTime).count()) > 1e-4) { emitEpoch(); }
+    if (!_epoch)
+    {
+        _epoch = std::make_shared<GnssObs>();
+        _epoch->insTime = insTime;
+    }
+    _referenceTime = insTime;
+
+    size_t msmSystem = static_cast<size_t>(std::find(MSM_SATELLITE_SYSTEMS.begin(), MSM_SATELLITE_SYSTEMS.end(), SatelliteSystem_(satSys)) - MSM_SATELLITE_SYSTEMS.begin());
+    std::array<size_t, 32> signalIds{};
+    for (size_t i = 0, s = 0; i < 32; i++)
+    {
+        if ((sigMask >> (31 - i)) & 1) { signalIds.at(s++) = i + 1; }
+    }
+
+    for (size_t i = 0, sat = 0, cell = 0, cellBit = 0; i < 64; i++)
+    {
+        if (!((satMask >> (63 - i)) & 1)) { continue; }
+
+        auto satNum = static_cast<uint16_t>(satSys == SBAS ? i + 20 : i + 1); // SBAS satellite ID 1 is PRN 120
+        std::optional<int8_t> frequencyNumber = 0;
+        if (satSys == GLO)
+        {
+            if (extended && extendedInfo.at(sat) <= 13) { _glonassFrequencyNumbers.at(i) = static_cast<int8_t>(extendedInfo.at(sat) - 7); }
+            frequencyNumber = _glonassFrequencyNumbers.at(i);
+        }
+
+        for (size_t sig = 0; sig < nSig; sig++, cellBit++)
+        {
+            if (!((cellMask >> (nSat * nSig - 1 - cellBit)) & 1)) { continue; }
+            size_t c = cell++;
+
+            Code code = msmCode(msmSystem, signalIds.at(sig));
+            if (code == Code::None) { continue; }
+            SatSigId satSigId(code, satNum);
+            Frequency freq = satSigId.freq();
+            GnssObs::ObservationData obsData(satSigId);
+            double lambda = frequencyNumber ? InsConst<>::C / freq.getFrequency(*frequencyNumber) : std::nan("");
+
+            if (!std::isnan(roughRange.at(sat)) && !std::isnan(finePseudorange.at(c)))
+            {
+                obsData.pseudorange = GnssObs::ObservationData::Pseudorange{
+                    .value = (roughRange.at(sat) + finePseudorange.at(c)) * RANGE_MS,
+                    .SSI = 0,
+                };
+            }
+            if (!std::isnan(roughRange.at(sat)) && !std::isnan(finePhaserange.at(c)) && !std::isnan(lambda))
+            {
+                // A cycle slip occurred if the lock time decreased or the signal was not tracked before
+                auto lock = _lockTimes.find(satSigId);
+                std::bitset<4> LLI;
+                LLI[0] = lock == _lockTimes.end() || lockTime.at(c) == 0 || lockTime.at(c) < lock->second;
+                LLI[1] = halfCycle.at(c);
+                _lockTimes.insert_or_assign(satSigId, lockTime.at(c));
+
+                obsData.carrierPhase = GnssObs::ObservationData::CarrierPhase{
+                    .value = (roughRange.at(sat) + finePhaserange.at(c)) * RANGE_MS / lambda,
+                    .SSI = 0,
+                    .LLI = static_cast<uint8_t>(LLI.to_ulong()),
+                };
+            }
+            if (extended && !std::isnan(roughRate.at(sat)) && !std::isnan(finePhaserangeRate.at(c)) && !std::isnan(lambda))
+            {
+                obsData.doppler = -(roughRate.at(sat) + finePhaserangeRate.at(c)) / lambda;
+            }
+            if (cn0.at(c) > 0.0) { obsData.CN0 = cn0.at(c); }
+            if (!obsData.pseudorange && !obsData.carrierPhase) { continue; }
+
+            _epoch->data.push_back(obsData);
+            _epoch->satData(satSigId.toSatId()).frequencies |= freq;
+        }
+        sat++;
+    }
+
+    if (!multipleMessage) { emitEpoch(); }
+    return true;
+}
+
+bool RtcmDecoder::decodeGpsEphemeris(std::span<const uint8_t> message)
+{
+    BitReader bits(message);
+    bits.skip(12); // Message number
+    auto prn = static_cast<uint16_t>(bits.u(6));
+    auto week = static_cast<int32_t>(bits.u(10));
+    auto uraIndex = static_cast<uint8_t>(bits.u(4));
+    auto L2ChannelCodes = static_cast<uint8_t>(bits.u(2));
+    double i_dot = semicircles2rad(scale(bits.s(14), -43));
+    auto IODE = bits.u(8);
+    double toc = static_cast<double>(bits.u(16)) * 16.0;
+    std::array<double, 3> a{};
+    a[2] = scale(bits.s(8), -55);
+    a[1] = scale(bits.s(16), -43);
+    a[0] = scale(bits.s(22), -31);
+    auto IODC = bits.u(10);
+    double Crs = scale(bits.s(16), -5);
+    double delta_n = semicircles2rad(scale(bits.s(16), -43));
+    double M_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cuc = scale(bits.s(16), -29);
+    double e = scale(bits.u(32), -33);
+    double Cus = scale(bits.s(16), -29);
+    double sqrt_A = scale(bits.u(32), -19);
+    double toe = static_cast<double>(bits.u(16)) * 16.0;
+    double Cic = scale(bits.s(16), -29);
+    double Omega_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cis = scale(bits.s(16), -29);
+    double i_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Crc = scale(bits.s(16), -5);
+    double omega = semicircles2rad(scale(bits.s(32), -31));
+    double Omega_dot = semicircles2rad(scale(bits.s(24), -43));
+    double T_GD = scale(bits.s(8), -31);
+    auto svHealth = static_cast<uint8_t>(bits.u(6));
+    bool L2DataFlagPCode = bits.u(1);
+    bool fitIntervalFlag = bits.u(1);
+    if (!bits.ok() || prn == 0) { return false; }
+
+    if (_referenceTime.empty())
+    {
+        LOG_DATA("{}: Discarding the GPS ephemeris, because the week is not known yet", _nameId);
+        _statistics.discarded++;
+        return true;
+    }
+    // The week is transmitted modulo 1024
+    auto referenceWeek = _referenceTime.toGPSweekTow(GPST);
+    int32_t fullReferenceWeek = referenceWeek.gpsCycle * InsTimeUtil::WEEKS_PER_GPS_CYCLE + referenceWeek.gpsWeek;
+    week += InsTimeUtil::WEEKS_PER_GPS_CYCLE * static_cast<int32_t>(std::lround(static_cast<double>(fullReferenceWeek - week) / InsTimeUtil::WEEKS_PER_GPS_CYCLE));
+
+    emitNavData(SatId(GPS, prn), std::make_shared<GPSEphemeris>(InsTime(0, week, toc, GPST), InsTime(0, week, toe, GPST), IODE, IODC, a,
+                                                                sqrt_A, e, i_0, Omega_0, omega, M_0, delta_n, Omega_dot, i_dot, Cus, Cuc,
+                                                                Cis, Cic, Crs, Crc, gpsUraIdx2Val(uraIndex), svHealth,
+                                                                L2ChannelCodes, L2DataFlagPCode, T_GD, fitIntervalFlag ? 8.0 : 4.0),
+                IODE);
+    return true;
+}
+
+bool RtcmDecoder::decodeGlonassEphemeris(std::span<const uint8_t> message)
+{
+    BitReader bits(message);
+    bits.skip(12); // Message number
+    auto slot = static_cast<uint16_t>(bits.u(6));
+    auto frequencyNumber = static_cast<int>(bits.u(5)) - 7;
+    bits.skip(1 + 1 + 2 + 5 + 6 + 1); // Almanac health, health availability, P1 and the frame time t_k
+    bool health = bits.u(1);          // MSB of B_n
+    bits.skip(1);                     // P2
+    auto tb = bits.u(7);
+    Eigen::Vector3d pos;
+    Eigen::Vector3d vel;
+    Eigen::Vector3d accelLuniSolar;
+    for (int i = 0; i < 3; i++)
+    {
+        vel(i) = scale(bits.sm(24), -20) * 1e3;
+        pos(i) = scale(bits.sm(27), -11) * 1e3;
+        accelLuniSolar(i) = scale(bits.sm(5), -30) * 1e3;
+    }
+    bits.skip(1); // P3
+    double gamma_n = scale(bits.sm(11), -40);
+    bits.skip(2 + 1); // P and l_n
+    double tau_n = scale(bits.sm(22), -30);
+    if (!bits.ok() || slot == 0 || frequencyNumber > 13) { return false; }
+
+    _glonassFrequencyNumbers.at(slot - 1) = static_cast<int8_t>(frequencyNumber);
+    if (_referenceTime.empty())
+    {
+        LOG_DATA("{}: Discarding the GLONASS ephemeris, because the day is not known yet", _nameId);
+        _statistics.discarded++;
+        return true;
+    }
+    // t_b is the index of the 15 minute interval within the day in Moscow time
+    InsTime toc = resolveTime(static_cast<double>(tb) * 900.0 - GLONASS_TIME_OFFSET + _referenceTime.leapGps2UTC(), InsTimeUtil::SECONDS_PER_DAY);
+
+    emitNavData(SatId(GLO, slot), std::make_shared<GLONASSEphemeris>(toc, 0.0, tau_n, gamma_n, health, pos, vel, accelLuniSolar, static_cast<int8_t>(frequencyNumber)),
+                tb);
+    return true;
+}
+
+bool RtcmDecoder::decodeBeidouEphemeris(std::span<const uint8_t> message)
+{
+    BitReader bits(message);
+    bits.skip(12); // Message number
+    auto prn = static_cast<uint16_t>(bits.u(6));
+    auto week = static_cast<int32_t>(bits.u(13));
+    auto uraIndex = static_cast<uint8_t>(bits.u(4));
+    double i_dot = semicircles2rad(scale(bits.s(14), -43));
+    auto AODE = bits.u(5);
+    double toc = static_cast<double>(bits.u(17)) * 8.0;
+    std::array<double, 3> a{};
+    a[2] = scale(bits.s(11), -66);
+    a[1] = scale(bits.s(22), -50);
+    a[0] = scale(bits.s(24), -33);
+    auto AODC = bits.u(5);
+    double Crs = scale(bits.s(18), -6);
+    double delta_n = semicircles2rad(scale(bits.s(16), -43));
+    double M_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cuc = scale(bits.s(18), -31);
+    double e = scale(bits.u(32), -33);
+    double Cus = scale(bits.s(18), -31);
+    double sqrt_A = scale(bits.u(32), -19);
+    double toe = static_cast<double>(bits.u(17)) * 8.0;
+    double Cic = scale(bits.s(18), -31);
+    double Omega_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cis = scale(bits.s(18), -31);
+    double i_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Crc = scale(bits.s(18), -6);
+    double omega = semicircles2rad(scale(bits.s(32), -31));
+    double Omega_dot = semicircles2rad(scale(bits.s(24), -43));
+    double T_GD1 = static_cast<double>(bits.s(10)) * 1e-10;
+    double T_GD2 = static_cast<double>(bits.s(10)) * 1e-10;
+    auto satH1 = static_cast<uint8_t>(bits.u(1));
+    if (!bits.ok() || prn == 0) { return false; }
+
+    week += InsTimeUtil::DIFF_BDT_WEEK_TO_GPST_WEEK;
+    InsTime insTimeToe(0, week, toe, BDT);
+    if (_referenceTime.empty())
+    {
+        LOG_DEBUG("{}: Taking the week from the BeiDou ephemeris [{}]", _nameId, insTimeToe.toYMDHMS(GPST));
+        _referenceTime = insTimeToe;
+    }
+
+    emitNavData(SatId(BDS, prn), std::make_shared<BDSEphemeris>(InsTime(0, week, toc, BDT), insTimeToe, AODE, AODC, a,
+                                                                sqrt_A, e, i_0, Omega_0, omega, M_0, delta_n, Omega_dot, i_dot, Cus, Cuc,
+                                                                Cis, Cic, Crs, Crc, gpsUraIdx2Val(uraIndex), satH1, T_GD1, T_GD2),
+                AODE);
+    return true;
+}
+
+bool RtcmDecoder::decodeGalileoEphemeris(std::span<const uint8_t> message, bool inav)
+{
+    BitReader bits(message);
+    bits.skip(12); // Message number
+    auto prn = static_cast<uint16_t>(bits.u(6));
+    auto week = static_cast<int32_t>(bits.u(12));
+    auto IODnav = bits.u(10);
+    auto sisaIndex = static_cast<uint8_t>(bits.u(8));
+    double i_dot = semicircles2rad(scale(bits.s(14), -43));
+    double toc = static_cast<double>(bits.u(14)) * 60.0;
+    std::array<double, 3> a{};
+    a[2] = scale(bits.s(6), -59);
+    a[1] = scale(bits.s(21), -46);
+    a[0] = scale(bits.s(31), -34);
+    double Crs = scale(bits.s(16), -5);
+    double delta_n = semicircles2rad(scale(bits.s(16), -43));
+    double M_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cuc = scale(bits.s(16), -29);
+    double e = scale(bits.u(32), -33);
+    double Cus = scale(bits.s(16), -29);
+    double sqrt_A = scale(bits.u(32), -19);
+    double toe = static_cast<double>(bits.u(14)) * 60.0;
+    double Cic = scale(bits.s(16), -29);
+    double Omega_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Cis = scale(bits.s(16), -29);
+    double i_0 = semicircles2rad(scale(bits.s(32), -31));
+    double Crc = scale(bits.s(16), -5);
+    double omega = semicircles2rad(scale(bits.s(32), -31));
+    double Omega_dot = semicircles2rad(scale(bits.s(24), -43));
+    double BGD_E1_E5a = scale(bits.s(10), -32);
+    double BGD_E1_E5b = 0.0;
+    GalileoEphemeris::SvHealth health{};
+    std::bitset<10> dataSource;
+    if (inav)
+    {
+        BGD_E1_E5b = scale(bits.s(10), -32);
+        health.E5b_SignalHealthStatus = static_cast<GalileoEphemeris::SvHealth::SignalHealthStatus>(bits.u(2));
+        health.E5b_DataValidityStatus = static_cast<GalileoEphemeris::SvHealth::DataValidityStatus>(bits.u(1));
+        health.E1B_SignalHealthStatus = static_cast<GalileoEphemeris::SvHealth::SignalHealthStatus>(bits.u(2));
+        health.E1B_DataValidityStatus = static_cast<GalileoEphemeris::SvHealth::DataValidityStatus>(bits.u(1));
+        dataSource.set(0).set(2).set(9); // I/NAV E1-B and E5b-I, clock for E5b,E1
+    }
+    else
+    {
+        health.E5a_SignalHealthStatus = static_cast<GalileoEphemeris::SvHealth::SignalHealthStatus>(bits.u(2));
+        health.E5a_DataValidityStatus = static_cast<GalileoEphemeris::SvHealth::DataValidityStatus>(bits.u(1));
+        dataSource.set(1).set(8); // F/NAV E5a-I, clock for E5a,E1
+    }
+    if (!bits.ok() || prn == 0) { return false; }
+
+    week += 1024; // Galileo week 0 is the GPS week 1024
+    InsTime insTimeToe(0, week, toe, GST);
+    if (_referenceTime.empty())
+    {
+        LOG_DEBUG("{}: Taking the week from the Galileo ephemeris [{}]", _nameId, insTimeToe.toYMDHMS(GPST));
+        _referenceTime = insTimeToe;
+    }
+
+    emitNavData(SatId(GAL, prn), std::make_shared<GalileoEphemeris>(InsTime(0, week, toc, GST), insTimeToe, IODnav, a,
+                                                                    sqrt_A, e, i_0, Omega_0, omega, M_0, delta_n, Omega_dot, i_dot, Cus, Cuc,
+                                                                    Cis, Cic, Crs, Crc, dataSource, galSisaIdx2Val(sisaIndex), health,
+                                                                    BGD_E1_E5a, BGD_E1_E5b),
+                IODnav, inav);
+    return true;
+}
+
+void RtcmDecoder::emitNavData(const SatId& satId, const std::shared_ptr<SatNavData>& satNavData, size_t issueOfData, bool galileoInav)
+{
+    // Ephemerides are broadcast repeatedly. The F/NAV data of Galileo is replaced by the I/NAV data of the same time.
+    if (auto iter = _lastNavData.find(satId);
+        iter != _lastNavData.end() && iter->second.refTime == satNavData->refTime && iter->second.issueOfData == issueOfData
+        && (iter->second.galileoInav || !galileoInav))
+    {
+        return;
+    }
+    _lastNavData.insert_or_assign(satId, NavDataKey{ .refTime = satNavData->refTime, .issueOfData = issueOfData, .galileoInav = galileoInav });
+
+    LOG_DATA("{}: [{}] Navigation data for [{}]", _nameId, satNavData->refTime.toYMDHMS(GPST), satId);
+    _statistics.navData++;
+    _navHandler(satId, satNavData);
+}
+
+InsTime RtcmDecoder::resolveTime(double seconds, double period) const
+{
+    // The period divides the week, so the time of week of the reference time can be used for the days as well
+    auto referenceTow = static_cast<double>(_referenceTime.toGPSweekTow(GPST).tow);
+    double diff = std::fmod(seconds - referenceTow, period);
+    if (diff > period / 2.0) { diff -= period; }
+    else if (diff < -period / 2.0) { diff += period; }
+    return _referenceTime + std::chrono::duration<long double>(diff);
+}
+
+} // namespace NAV::vendor::rtcm
@@ -0,0 +1,198 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtcmDecoder.hpp
+/// @brief Decoder for RTCM 3 observation and ephemeris messages
+/// @date 2026-10-18
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Satellite/internal/SatNavData.hpp"
+#include "Navigation/Time/InsTime.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+
+namespace NAV::vendor::rtcm
+{
+
+/// Preamble of an RTCM 3 frame
+constexpr uint8_t PREAMBLE = 0xD3;
+
+/// @brief Calculates the CRC-24Q checksum of RTCM 3 frames
+/// @param[in] data Data to calculate the checksum for (preamble, length and message)
+/// @return The 24 bit checksum
+[[nodiscard]] uint32_t crc24q(std::span<const uint8_t> data);
+
+/// @brief Incremental decoder for RTCM 3 byte streams
+///
+/// Decodes Multiple Signal Messages (MSM4 - MSM7) of all satellite systems into observation epochs and the
+/// GPS (1019), GLONASS (1020), BeiDou (1042) and Galileo (1045, 1046) ephemeris messages into navigation data.
+/// Frames are decoded in place from the provided buffers. Only frames split over two buffers are copied.
+/// @note See \cite RTCM10403 RTCM Standard 10403.3
+class RtcmDecoder
+{
+  public:
+    /// @brief Handler for completed observation epochs
+    using ObsHandler = std::function<void(const std::shared_ptr<GnssObs>& gnssObs)>;
+    /// @brief Handler for decoded navigation data
+    using NavHandler = std::function<void(const SatId& satId, const std::shared_ptr<SatNavData>& satNavData)>;
+
+    /// @brief Statistics of the decoded frames
+    struct Statistics
+    {
+        size_t frames = 0;      ///< Frames with a valid checksum
+        size_t crcErrors = 0;   ///< Frames with an invalid checksum
+        size_t epochs = 0;      ///< Observation epochs
+        size_t navData = 0;     ///< Navigation data sets
+        size_t unsupported = 0; ///< Messages which are not decoded
+        size_t discarded = 0;   ///< Messages which were discarded (corrupt, unknown time or other station)
+    };
+
+    /// @brief Constructor
+    /// @param[in] nameId Name and Id of the node used for log messages only
+    explicit RtcmDecoder(std::string nameId);
+
+    /// @brief Sets the handler for completed observation epochs. Observations are not decoded without handler.
+    /// @param[in] handler Handler which is called from within feed()
+    void setObsHandler(ObsHandler handler);
+
+    /// @brief Sets the handler for decoded navigation data. Ephemerides are not decoded without handler.
+    /// @param[in] handler Handler which is called from within feed()
+    void setNavHandler(NavHandler handler);
+
+    /// @brief Sets the approximate time of the data
+    ///
+    /// RTCM messages only contain the time of week or day. The time has to be known within half a week to resolve them.
+    /// Without reference time, the time is taken from the first Galileo or BeiDou ephemeris.
+    /// @param[in] insTime Approximate time of the data
+    void setReferenceTime(const InsTime& insTime);
+
+    /// @brief Latest time of the data. Empty if the time is not known yet.
+    [[nodiscard]] const InsTime& referenceTime() const;
+
+    /// @brief Restricts the observations to a reference station. Without restriction the first station is used.
+    /// @param[in] stationId Station ID or std::nullopt to use the first station decoded
+    void setStationId(std::optional<uint16_t> stationId);
+
+    /// @brief Returns the station ID of the decoded observations
+    [[nodiscard]] std::optional<uint16_t> stationId() const;
+
+    /// @brief Decodes all complete frames of the data and keeps an incomplete frame at the end for the next call
+    /// @param[in] data Next chunk of the byte stream
+    /// @return Amount of frames with a valid checksum
+    size_t feed(std::span<const uint8_t> data);
+
+    /// @brief Decodes the frames behind an incomplete frame and emits the observation epoch which is currently collected
+    /// @note Only for the end of the stream (e.g. the end of a file), as the buffered bytes are discarded
+    void flush();
+
+    /// @brief Resets the decoder to the state after construction, but keeps the handlers and the station restriction
+    void reset();
+
+    /// @brief Statistics of the decoded frames
+    [[nodiscard]] const Statistics& statistics() const;
+
+  private:
+    /// @brief Decodes a frame, if the checksum is valid
+    /// @param[in] frame Frame including preamble, length and checksum
+    /// @return True if the checksum is valid
+    bool decodeFrame(std::span<const uint8_t> frame);
+
+    /// @brief Passes the observation epoch which is currently collected to the handler
+    void emitEpoch();
+
+    /// @brief Decodes a Multiple Signal Message
+    /// @param[in] message Message without frame
+    /// @param[in] satSys Satellite system of the message
+    /// @param[in] msm Number of the MSM (4 - 7)
+    /// @return False if the message is corrupt
+    bool decodeMsm(std::span<const uint8_t> message, SatelliteSystem satSys, uint8_t msm);
+
+    /// @brief Decodes the GPS ephemeris message 1019
+    /// @param[in] message Message without frame
+    /// @return False if the message is corrupt
+    bool decodeGpsEphemeris(std::span<const uint8_t> message);
+
+    /// @brief Decodes the GLONASS ephemeris message 1020
+    /// @param[in] message Message without frame
+    /// @return False if the message is corrupt
+    bool decodeGlonassEphemeris(std::span<const uint8_t> message);
+
+    /// @brief Decodes the BeiDou ephemeris message 1042
+    /// @param[in] message Message without frame
+    /// @return False if the message is corrupt
+    bool decodeBeidouEphemeris(std::span<const uint8_t> message);
+
+    /// @brief Decodes the Galileo ephemeris messages 1045 (F/NAV) and 1046 (I/NAV)
+    /// @param[in] message Message without frame
+    /// @param[in] inav Whether the message is the I/NAV message 1046
+    /// @return False if the message is corrupt
+    bool decodeGalileoEphemeris(std::span<const uint8_t> message, bool inav);
+
+    /// @brief Passes the navigation data to the handler if it was not decoded before
+    /// @param[in] satId Satellite identifier
+    /// @param[in] satNavData Navigation data
+    /// @param[in] issueOfData Issue of data, which identifies the data set together with the reference time
+    /// @param[in] galileoInav Whether Galileo data are from the I/NAV message, which is preferred over F/NAV
+    void emitNavData(const SatId& satId, const std::shared_ptr<SatNavData>& satNavData, size_t issueOfData, bool galileoInav = true);
+
+    /// @brief Resolves a time of week or day with the reference time
+    /// @param[in] seconds Seconds since the start of the week or day in GPST
+    /// @param[in] period Length of the period [s]
+    /// @return The time closest to the reference time
+    [[nodiscard]] InsTime resolveTime(double seconds, double period) const;
+
+    /// Name and Id of the node used for log messages only
+    std::string _nameId;
+    /// Handler for completed observation epochs
+    ObsHandler _obsHandler;
+    /// Handler for decoded navigation data
+    NavHandler _navHandler;
+
+    /// Incomplete frame at the end of the last chunk
+    std::vector<uint8_t> _buffer;
+
+    /// Latest time of the data
+    InsTime _referenceTime;
+    /// Station ID requested by the user
+    std::optional<uint16_t> _requestedStationId;
+    /// Station ID of the decoded observations
+    std::optional<uint16_t> _stationId;
+
+    /// Observation epoch which is currently collected
+    std::shared_ptr<GnssObs> _epoch;
+    /// Lock time indicator of the signals in the last epoch [ms]
+    std::unordered_map<SatSigId, uint32_t> _lockTimes;
+    /// GLONASS frequency numbers by slot number (from the ephemerides or MSM5/7 messages)
+    std::array<std::optional<int8_t>, 64> _glonassFrequencyNumbers;
+
+    /// @brief Identifies a navigation data set
+    struct NavDataKey
+    {
+        InsTime refTime;         ///< Reference time of the data
+        size_t issueOfData = 0;  ///< Issue of data
+        bool galileoInav = true; ///< Whether Galileo data are from the I/NAV message
+    };
+    /// Last navigation data set decoded for each satellite
+    std::unordered_map<SatId, NavDataKey> _lastNavData;
+
+    /// Statistics of the decoded frames
+    Statistics _statistics;
+};
+
+} // namespace NAV::vendor::rtcm
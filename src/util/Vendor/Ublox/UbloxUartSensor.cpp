@@ -151,6 +151,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::ublox::UbloxUartSensor::fin
                     return p;
                 }
                 // Invalid packet!
+                if (_invalidPacketHandler) { _invalidPacketHandler(); }
                 LOG_DEBUG("{}: Invalid binary packet: Class={:0x}, Id={:0x}, payload length={}", _name, _binaryMsgClass, _binaryMsgId, _binaryPayloadLength);
                 resetTracking();
             }
@@ -183,6 +184,7 @@ std::unique_ptr<uart::protocol::Packet> NAV::vendor::ublox::UbloxUartSensor::fin
                     return p;
                 }
                 // Invalid packet!
+                if (_invalidPacketHandler) { _invalidPacketHandler(); }
                 LOG_ERROR("{}: Invalid ascii packet: {}", _name, p->datastr());
             }
             else
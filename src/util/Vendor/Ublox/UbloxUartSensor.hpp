@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -49,6 +50,10 @@ class UbloxUartSensor
     /// @return nullptr if no packet found yet, otherwise a pointer to the packet
     std::unique_ptr<uart::protocol::Packet> findPacket(uint8_t dataByte);
 
+    /// @brief Sets the function which is called for every packet discarded because of a wrong checksum
+    /// @param[in] handler Function to call (called from the read thread of the sensor)
+    void setInvalidPacketHandler(std::function<void()> handler) { _invalidPacketHandler = std::move(handler); }
+
     static constexpr uint8_t BINARY_SYNC_CHAR_1 = 0xB5; ///< µ - First sync character which begins a new binary message
     static constexpr uint8_t BINARY_SYNC_CHAR_2 = 0x62; ///< b - Second sync character which begins a new binary message
     static constexpr uint8_t ASCII_START_CHAR = '$';    ///< Ascii character which begins a new ascii message
@@ -57,6 +62,9 @@ class UbloxUartSensor
     /// Name of the Parent Node
     const std::string _name;
 
+    /// Function which is called for every packet discarded because of a wrong checksum
+    std::function<void()> _invalidPacketHandler;
+
     /// UartSensor object which handles the UART interface
     uart::sensors::UartSensor _sensor{ ENDIANNESS,
                                        packetFinderFunction,
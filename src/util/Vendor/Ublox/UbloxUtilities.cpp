@@ -12,6 +12,7 @@
 #include "util/Eigen.hpp"
 #include "Navigation/Transformations/CoordinateFrames.hpp"
 #include "util/Logger.hpp"
+#include "util/Parsing/AsciiSentence.hpp"
 
 #include "util/Time/TimeBase.hpp"
 
@@ -391,12 +392,8 @@ std::pair<uint8_t, uint8_t> NAV::vendor::ublox::checksumUBX(const std::vector<ui
 
 uint8_t NAV::vendor::ublox::checksumNMEA(const std::vector<uint8_t>& data)
 {
-    uint8_t calcChecksum = 0;
     //  |->                          <-|            Checksum without first $ sign and till the *
     // $--ZDA,hhmmss.ss,xx,xx,xxxx,xx,xx*hh<CR><LF>
-    for (size_t i = 1; i < data.size() - 5; i++)
-    {
-        calcChecksum ^= data.at(i);
-    }
-    return calcChecksum;
+    if (data.size() < 6) { return 0; }
+    return ascii::nmea::checksum(std::string_view(reinterpret_cast<const char*>(data.data()) + 1, data.size() - 6)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
 }
\ No newline at end of file
@@ -0,0 +1,362 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file IonosphereModelsTests.cpp
+/// @brief Tests for the NeQuick-G and BeiDou ionosphere models
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Atmosphere/Ionosphere/Ionosphere.hpp"
+#include "Navigation/Atmosphere/Ionosphere/Models/BeiDouKlobuchar.hpp"
+#include "Navigation/Atmosphere/Ionosphere/Models/NeQuickG.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::IonosphereModelsTests
+{
+
+namespace
+{
+
+/// @brief Synthetic MODIP as cubic polynomial [deg]
+double modipPolynomial(double latDeg, double lonDeg)
+{
+    return 0.8 * latDeg + 1e-5 * latDeg * latDeg * latDeg - 2e-4 * lonDeg * lonDeg + 3.0;
+}
+
+/// @brief Synthetic model data with a constant foF2 of 8 MHz and M(3000)F2 of 3
+std::shared_ptr<NeQuickG::Data> syntheticData()
+{
+    auto data = std::make_shared<NeQuickG::Data>();
+    for (size_t i = 0; i < 39; i++)
+    {
+        for (size_t j = 0; j < 39; j++)
+        {
+            data->modip.at(i).at(j) = modipPolynomial(-95.0 + 5.0 * static_cast<double>(i), -190.0 + 10.0 * static_cast<double>(j));
+        }
+    }
+    for (auto& month : data->ccir)
+    {
+        for (size_t s = 0; s < 2; s++)
+        {
+            month.F2.at(s)[0][0] = 8.0;
+            month.Fm3.at(s)[0][0] = 3.0;
+        }
+    }
+    return data;
+}
+
+/// @brief Writes the model data in the layout of the official files 'modipNeQG_wrapped.asc' and 'ccir11.asc' to 'ccir22.asc'
+/// @param[in] data Model data
+/// @param[in] directory Directory to write the files to
+void writeOfficialFiles(const NeQuickG::Data& data, const std::filesystem::path& directory)
+{
+    std::filesystem::create_directories(directory);
+
+    std::ofstream modipFile(directory / "modipNeQG_wrapped.asc");
+    modipFile << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& row : data.modip)
+    {
+        for (const auto& value : row) { modipFile << value << ' '; }
+        modipFile << '\n';
+    }
+
+    for (size_t m = 0; m < 12; m++)
+    {
+        std::ofstream ccirFile(directory / fmt::format("ccir{}.asc", m + 11));
+        ccirFile << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (const auto& solar : data.ccir.at(m).F2)
+        {
+            for (const auto& spatial : solar)
+            {
+                for (const auto& coeff : spatial) { ccirFile << coeff << ' '; }
+                ccirFile << '\n';
+            }
+        }
+        for (const auto& solar : data.ccir.at(m).Fm3)
+        {
+            for (const auto& spatial : solar)
+            {
+                for (const auto& coeff : spatial) { ccirFile << coeff << ' '; }
+                ccirFile << '\n';
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("[NeQuickG] Model data files", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+    data->ccir.at(4).F2.at(1).at(75).at(12) = 1.5;
+    data->ccir.at(11).Fm3.at(0).at(48).at(8) = -2.5;
+
+    auto directory = std::filesystem::temp_directory_path() / "INSTINCT_NeQuickGTests";
+    std::filesystem::remove_all(directory);
+    writeOfficialFiles(*data, directory);
+
+    auto loaded = NeQuickG::LoadData(directory);
+    REQUIRE(loaded != nullptr);
+    REQUIRE(loaded->modip == data->modip);
+    for (size_t m = 0; m < 12; m++)
+    {
+        REQUIRE(loaded->ccir.at(m).F2 == data->ccir.at(m).F2);
+        REQUIRE(loaded->ccir.at(m).Fm3 == data->ccir.at(m).Fm3);
+    }
+
+    // Incomplete and missing files are rejected
+    {
+        std::ofstream ccirFile(directory / "ccir17.asc");
+        ccirFile << "1.0 2.0 3.0\n";
+    }
+    REQUIRE(NeQuickG::LoadData(directory) == nullptr);
+    std::filesystem::remove_all(directory);
+    REQUIRE(NeQuickG::LoadData(directory) == nullptr);
+
+    // Nodes refuse to initialize, if the data of the selected model is missing
+    REQUIRE(isIonosphereModelAvailable(IonosphereModel::Klobuchar));
+    REQUIRE(isIonosphereModelAvailable(IonosphereModel::NeQuickG) == (NeQuickG::DefaultData() != nullptr));
+}
+
+TEST_CASE("[NeQuickG] MODIP interpolation and ionisation level", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+
+    // The third order interpolation is exact for cubic polynomials
+    for (const auto& [lat, lon] : std::vector<std::pair<double, double>>{ { 12.3, 45.6 }, { -47.9, -170.2 }, { 0.0, 0.0 }, { 84.1, 179.9 } })
+    {
+        REQUIRE_THAT(NeQuickG::modip(*data, deg2rad(lat), deg2rad(lon)), Catch::Matchers::WithinAbs(modipPolynomial(lat, lon), 1e-9));
+    }
+    REQUIRE(NeQuickG::modip(*data, deg2rad(90.0), 0.0) == 90.0);
+    REQUIRE(NeQuickG::modip(*data, deg2rad(-90.0), 0.0) == -90.0);
+
+    REQUIRE(NeQuickG::effectiveIonisationLevel({ 0.0, 0.0, 0.0, 0.0 }, 20.0) == 63.7);
+    REQUIRE_THAT(NeQuickG::effectiveIonisationLevel({ 236.831641, -0.39362878, 0.00402826613, 0.0 }, 20.0),
+                 Catch::Matchers::WithinAbs(236.831641 - 0.39362878 * 20.0 + 0.00402826613 * 400.0, 1e-9));
+    REQUIRE(NeQuickG::effectiveIonisationLevel({ 500.0, 0.0, 0.0, 0.0 }, 20.0) == 400.0);
+    REQUIRE(NeQuickG::effectiveIonisationLevel({ -5.0, 0.0, 0.0, 0.0 }, 20.0) == 0.0);
+}
+
+TEST_CASE("[NeQuickG] Electron density profile", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+    Eigen::Vector3d lla(deg2rad(40.0), deg2rad(10.0), 0.0);
+
+    // NmF2 = 0.124 * foF2^2 [10^11 / m^3]
+    double NmF2 = 0.124 * 8.0 * 8.0 * 1e11;
+    double maxDensity = 0.0;
+    double hmF2 = 0.0;
+    for (double h = 50.0; h < 3000.0; h += 1.0)
+    {
+        lla(2) = h * 1e3;
+        double N = NeQuickG::electronDensity(*data, 4, 12.0, 100.0, lla);
+        REQUIRE(N >= 0.0);
+        REQUIRE(std::isfinite(N));
+        if (N > maxDensity)
+        {
+            maxDensity = N;
+            hmF2 = h;
+        }
+    }
+    REQUIRE_THAT(maxDensity, Catch::Matchers::WithinRel(NmF2, 0.05));
+    REQUIRE(hmF2 > 200.0);
+    REQUIRE(hmF2 < 450.0);
+
+    lla(2) = 60e3;
+    REQUIRE(NeQuickG::electronDensity(*data, 4, 12.0, 100.0, lla) < 1e-3 * NmF2);
+}
+
+TEST_CASE("[NeQuickG] Adaptive integration against dense quadrature", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+    std::array<double, 4> ai = { 120.0, 0.1, 0.001, 0.0 };
+    Eigen::Vector3d lla_pos(deg2rad(48.78), deg2rad(9.18), 250.0);
+    Eigen::Vector3d lla_satPos = lla_pos;
+    lla_satPos(2) = 20000e3;
+
+    // Vertical ray, so the dense quadrature can integrate the profile along the height
+    double Az = NeQuickG::effectiveIonisationLevel(ai, NeQuickG::modip(*data, lla_pos(0), lla_pos(1)));
+    double reference = 0.0;
+    for (double h = lla_pos(2); h < lla_satPos(2);)
+    {
+        double dh = h < 2000e3 ? 50.0 : 1000.0;
+        dh = std::min(dh, lla_satPos(2) - h);
+        Eigen::Vector3d a(lla_pos(0), lla_pos(1), h);
+        Eigen::Vector3d m(lla_pos(0), lla_pos(1), h + dh / 2.0);
+        Eigen::Vector3d b(lla_pos(0), lla_pos(1), h + dh);
+        reference += dh / 6.0
+                     * (NeQuickG::electronDensity(*data, 7, 15.0, Az, a)
+                        + 4.0 * NeQuickG::electronDensity(*data, 7, 15.0, Az, m)
+                        + NeQuickG::electronDensity(*data, 7, 15.0, Az, b));
+        h += dh;
+    }
+    reference *= 1e-16; // [TECU]
+
+    double stec = NeQuickG::calcSTEC(*data, 7, 15.0, ai, lla_pos, lla_satPos);
+    REQUIRE(stec > 1.0);
+    REQUIRE_THAT(stec, Catch::Matchers::WithinRel(reference, 1e-3));
+
+    // Slanted rays see more electrons
+    Eigen::Vector3d lla_satPosSlant(deg2rad(20.0), deg2rad(30.0), 20000e3);
+    REQUIRE(NeQuickG::calcSTEC(*data, 7, 15.0, ai, lla_pos, lla_satPosSlant) > stec);
+
+    // 1 TECU on L1 delays the signal by about 0.162 m
+    REQUIRE_THAT(NeQuickG::stec2timeDelay(1.0, G01, -128) * InsConst<>::C, Catch::Matchers::WithinAbs(0.16237, 1e-5));
+}
+
+TEST_CASE("[NeQuickG] Cached slant TEC", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+    std::array<double, 4> ai = { 80.0, 0.0, 0.0, 0.0 };
+    Eigen::Vector3d lla_pos(deg2rad(48.78), deg2rad(9.18), 250.0);
+    Eigen::Vector3d lla_satPos(deg2rad(30.0), deg2rad(20.0), 20000e3);
+
+    NeQuickG::Settings settings;
+    double stec = NeQuickG::calcSTECCached(*data, 1000.0, 3, 10.0, ai, lla_pos, lla_satPos, settings);
+    REQUIRE(stec == NeQuickG::calcSTEC(*data, 3, 10.0, ai, lla_pos, lla_satPos, settings));
+
+    // Satellite moved by about 1 km within the cache age
+    Eigen::Vector3d lla_satPosMoved = lla_satPos + Eigen::Vector3d(1e-5, 0.0, 0.0);
+    double cached = NeQuickG::calcSTECCached(*data, 1000.5, 3, 10.0, ai, lla_pos, lla_satPosMoved, settings);
+    REQUIRE(cached == stec);
+    REQUIRE_THAT(cached, Catch::Matchers::WithinRel(NeQuickG::calcSTEC(*data, 3, 10.0, ai, lla_pos, lla_satPosMoved, settings), 1e-3));
+
+    // Too old
+    double recalculated = NeQuickG::calcSTECCached(*data, 1002.0, 3, 10.0, ai, lla_pos, lla_satPosMoved, settings);
+    REQUIRE(recalculated == NeQuickG::calcSTEC(*data, 3, 10.0, ai, lla_pos, lla_satPosMoved, settings));
+
+    // Other satellite
+    Eigen::Vector3d lla_otherSatPos(deg2rad(60.0), deg2rad(-20.0), 20000e3);
+    REQUIRE(NeQuickG::calcSTECCached(*data, 1002.0, 3, 10.0, ai, lla_pos, lla_otherSatPos, settings)
+            == NeQuickG::calcSTEC(*data, 3, 10.0, ai, lla_pos, lla_otherSatPos, settings));
+}
+
+TEST_CASE("[NeQuickG] Conformance with the reference vectors", "[NeQuickG]")
+{
+    auto logger = initializeTestLogger();
+
+    // The official model data and the reference vectors are not part of the repository (see 'resources/data/NeQuickG/README.md')
+    auto data = NeQuickG::DefaultData();
+    std::ifstream file("resources/data/NeQuickG/validation.txt");
+    if (data == nullptr || !file.good())
+    {
+        SKIP("NeQuick-G model data or reference vectors not installed in 'resources/data/NeQuickG'");
+    }
+
+    // Each line: a0 a1 a2 [sfu, sfu/deg, sfu/deg^2], month, UT [h], receiver lon lat [deg] h [m], satellite lon lat [deg] h [m], STEC [TECU]
+    size_t nVectors = 0;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line.front() == '#') { continue; }
+        std::istringstream ss(line);
+        std::array<double, 4> ai{};
+        int month = 0;
+        double UT = 0.0;
+        Eigen::Vector3d lla_pos;
+        Eigen::Vector3d lla_satPos;
+        double stecRef = 0.0;
+        ss >> ai[0] >> ai[1] >> ai[2] >> month >> UT >> lla_pos(1) >> lla_pos(0) >> lla_pos(2) >> lla_satPos(1) >> lla_satPos(0) >> lla_satPos(2) >> stecRef;
+        REQUIRE(!ss.fail());
+        lla_pos.head<2>() = deg2rad(lla_pos.head<2>());
+        lla_satPos.head<2>() = deg2rad(lla_satPos.head<2>());
+
+        CAPTURE(nVectors, line);
+        double stec = NeQuickG::calcSTEC(*data, month, UT, ai, lla_pos, lla_satPos);
+        // The reference values are rounded to 0.01 TECU and the integration tolerance is 0.1 % below 1000 km
+        REQUIRE_THAT(stec, Catch::Matchers::WithinAbs(stecRef, 0.01 + 5e-3 * stecRef));
+        nVectors++;
+    }
+    REQUIRE(nVectors > 0);
+}
+
+TEST_CASE("[BeiDouKlobuchar] Vertical delay", "[BeiDouKlobuchar]")
+{
+    auto logger = initializeTestLogger();
+
+    std::array<double, 4> alpha = { 2.0e-8, 1.0e-8, 0.0, 0.0 };
+    std::array<double, 4> beta = { 90000.0, 0.0, 0.0, 0.0 };
+
+    // Zenith at the equator: the pierce point is the user position and the slant factor is 1
+    REQUIRE_THAT(calcIonosphericTimeDelay_BeiDouKlobuchar(50400.0, B02, -128, 0.0, 0.0, M_PI / 2.0, 0.0, alpha, beta),
+                 Catch::Matchers::WithinAbs(5e-9 + 2.0e-8, 1e-15));
+    // Outside of the day time cosine
+    REQUIRE_THAT(calcIonosphericTimeDelay_BeiDouKlobuchar(10000.0, B02, -128, 0.0, 0.0, M_PI / 2.0, 0.0, alpha, beta),
+                 Catch::Matchers::WithinAbs(5e-9, 1e-15));
+    // Local time at 90° longitude is 6 hours later
+    REQUIRE_THAT(calcIonosphericTimeDelay_BeiDouKlobuchar(50400.0 - 21600.0, B02, -128, 0.0, M_PI / 2.0, M_PI / 2.0, 0.0, alpha, beta),
+                 Catch::Matchers::WithinAbs(5e-9 + 2.0e-8, 1e-15));
+    // Latitude of 36° is 0.2 semi-circles
+    REQUIRE_THAT(calcIonosphericTimeDelay_BeiDouKlobuchar(50400.0, B02, -128, deg2rad(36.0), 0.0, M_PI / 2.0, 0.0, alpha, beta),
+                 Catch::Matchers::WithinAbs(5e-9 + 2.0e-8 + 0.2e-8, 1e-15));
+    // Other frequency
+    REQUIRE_THAT(calcIonosphericTimeDelay_BeiDouKlobuchar(50400.0, B01, -128, 0.0, 0.0, M_PI / 2.0, 0.0, alpha, beta),
+                 Catch::Matchers::WithinAbs((5e-9 + 2.0e-8) * std::pow(1561.098 / 1575.42, 2), 1e-15));
+
+    // Low elevation increases the delay
+    double slant = calcIonosphericTimeDelay_BeiDouKlobuchar(50400.0, B02, -128, 0.0, 0.0, deg2rad(10.0), 0.0, alpha, beta);
+    REQUIRE(slant > 2.0 * (5e-9 + 2.0e-8));
+}
+
+TEST_CASE("[NeQuickG] Slant TEC for 40 satellites", "[NeQuickG][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    auto data = syntheticData();
+    std::array<double, 4> ai = { 120.0, 0.1, 0.001, 0.0 };
+    Eigen::Vector3d lla_pos(deg2rad(48.78), deg2rad(9.18), 250.0);
+    std::vector<Eigen::Vector3d> satellites;
+    for (size_t i = 0; i < 40; i++)
+    {
+        satellites.emplace_back(deg2rad(-50.0 + 2.5 * static_cast<double>(i)), deg2rad(-60.0 + 3.0 * static_cast<double>(i)), 20000e3);
+    }
+
+    BENCHMARK("Uncached")
+    {
+        double sum = 0.0;
+        for (const auto& lla_satPos : satellites) { sum += NeQuickG::calcSTEC(*data, 5, 12.0, ai, lla_pos, lla_satPos); }
+        return sum;
+    };
+    double gpsTime = 0.0;
+    BENCHMARK("Cached at 10 Hz")
+    {
+        gpsTime += 0.1;
+        double sum = 0.0;
+        for (const auto& lla_satPos : satellites) { sum += NeQuickG::calcSTECCached(*data, gpsTime, 5, 12.0, ai, lla_pos, lla_satPos); }
+        return sum;
+    };
+}
+
+} // namespace NAV::TESTS::IonosphereModelsTests
@@ -0,0 +1,302 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AmbiguityResolutionTests.cpp
+/// @brief Tests for the LAMBDA integer ambiguity resolution
+/// @date 2026-10-18
+
+#include <random>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "CatchMatchers.hpp"
+
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+
+#include "Logger.hpp"
+#include "Navigation/GNSS/Ambiguity/AmbiguityResolution.hpp"
+
+namespace NAV::TESTS
+{
+
+namespace
+{
+
+/// @brief Float solution of a static double difference baseline
+struct Problem
+{
+    Eigen::VectorXd x_true;  ///< True baseline [m] and ambiguities [cycles]
+    Eigen::VectorXd x_float; ///< Float solution
+    Eigen::MatrixXd P;       ///< Covariance matrix of the float solution
+};
+
+/// @brief Simulates the float solution of a short static baseline with code and carrier phase observations
+/// @param[in] nAmbiguities Amount of double difference ambiguities
+/// @param[in] nEpochs Amount of epochs, the geometry changes slightly from epoch to epoch
+/// @param[in, out] gen Random number generator
+Problem simulateFloatSolution(size_t nAmbiguities, size_t nEpochs, std::mt19937& gen)
+{
+    constexpr double LAMBDA = 0.19;       // Wavelength [m]
+    constexpr double STDEV_CODE = 0.3;    // [m]
+    constexpr double STDEV_PHASE = 0.003; // [m]
+
+    auto n = static_cast<Eigen::Index>(nAmbiguities);
+    std::normal_distribution<double> normal;
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::uniform_int_distribution<int> integer(-1000, 1000);
+
+    // Line of sight vectors (azimuth, elevation) of the satellites, the last one is the reference satellite
+    Eigen::MatrixXd azEl(n + 1, 2);
+    for (Eigen::Index i = 0; i <= n; i++) { azEl.row(i) << 2.0 * M_PI * uniform(gen), 0.2 + 1.2 * uniform(gen); }
+    auto lineOfSight = [&](Eigen::Index i, double dAz) {
+        return Eigen::Vector3d{ std::cos(azEl(i, 1)) * std::sin(azEl(i, 0) + dAz), std::cos(azEl(i, 1)) * std::cos(azEl(i, 0) + dAz), std::sin(azEl(i, 1)) };
+    };
+
+    Eigen::MatrixXd N = Eigen::MatrixXd::Zero(3 + n, 3 + n);
+    for (size_t e = 0; e < nEpochs; e++)
+    {
+        double dAz = 0.005 * static_cast<double>(e);
+        Eigen::MatrixXd G(n, 3);
+        for (Eigen::Index i = 0; i < n; i++) { G.row(i) = (lineOfSight(i, dAz) - lineOfSight(n, dAz)).transpose(); }
+
+        Eigen::MatrixXd A_phase(n, 3 + n);
+        A_phase << G, LAMBDA * Eigen::MatrixXd::Identity(n, n);
+        Eigen::MatrixXd A_code = Eigen::MatrixXd::Zero(n, 3 + n);
+        A_code.leftCols<3>() = G;
+        N += A_phase.transpose() * A_phase / std::pow(STDEV_PHASE, 2) + A_code.transpose() * A_code / std::pow(STDEV_CODE, 2);
+    }
+
+    Problem problem;
+    problem.P = N.inverse();
+    problem.P = 0.5 * (problem.P + problem.P.transpose()).eval();
+    problem.x_true = Eigen::VectorXd(3 + n);
+    problem.x_true.head<3>() << 12.3, -45.6, 7.8;
+    for (Eigen::Index i = 0; i < n; i++) { problem.x_true(3 + i) = integer(gen); }
+
+    Eigen::VectorXd noise(3 + n);
+    for (auto& v : noise) { v = normal(gen); }
+    problem.x_float = problem.x_true + Eigen::MatrixXd(problem.P.llt().matrixL()) * noise;
+    return problem;
+}
+
+/// @brief Transforms the fixed integer combinations back into the original ambiguities (needs all ambiguities fixed)
+/// @param[in] resolution Result of the resolution
+Eigen::VectorXd fixedAmbiguities(const Ambiguity::Resolution& resolution)
+{
+    return (resolution.Z_fixed.transpose().partialPivLu().solve(resolution.z_fixed)).array().round();
+}
+
+} // namespace
+
+TEST_CASE("[AmbiguityResolution] Decorrelation", "[AmbiguityResolution]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(1);
+    auto problem = simulateFloatSolution(12, 3, gen);
+    Eigen::MatrixXd Q = problem.P.bottomRightCorner(12, 12);
+
+    Eigen::MatrixXd L;
+    Eigen::VectorXd D;
+    REQUIRE(Ambiguity::LtDLdecomposition(Q, L, D));
+    REQUIRE_THAT(Eigen::MatrixXd(L.transpose() * D.asDiagonal() * L), Catch::Matchers::WithinAbs(Q, 1e-8));
+
+    auto dec = Ambiguity::decorrelate(Q);
+    REQUIRE(dec.has_value());
+
+    // Z is an unimodular integer matrix
+    REQUIRE(dec->Z == dec->Z.array().round().matrix());
+    REQUIRE_THAT(std::abs(dec->Z.determinant()), Catch::Matchers::WithinRel(1.0, 1e-9));
+
+    // Zᵀ Q Z = Lᵀ D L with a reduced unit lower triangular matrix
+    Eigen::MatrixXd Q_z = dec->Z.transpose() * Q * dec->Z;
+    REQUIRE_THAT(Eigen::MatrixXd(dec->L.transpose() * dec->D.asDiagonal() * dec->L), Catch::Matchers::WithinAbs(Q_z, 1e-6 * Q_z.norm()));
+    for (Eigen::Index i = 0; i < dec->L.rows(); i++)
+    {
+        REQUIRE(dec->L(i, i) == 1.0);
+        for (Eigen::Index j = 0; j < i; j++) { REQUIRE(std::abs(dec->L(i, j)) <= 0.5 + 1e-12); }
+    }
+    for (Eigen::Index j = 0; j + 1 < dec->D.size(); j++)
+    {
+        REQUIRE(dec->D(j + 1) <= dec->D(j) + std::pow(dec->L(j + 1, j), 2) * dec->D(j + 1) + 1e-6);
+    }
+
+    // The decorrelation makes the search space much more spherical
+    REQUIRE(dec->D.maxCoeff() / dec->D.minCoeff() < 1e-3 * D.maxCoeff() / D.minCoeff());
+
+    REQUIRE_FALSE(Ambiguity::decorrelate(-Q).has_value());
+}
+
+TEST_CASE("[AmbiguityResolution] Search equals brute force integer least squares", "[AmbiguityResolution]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(2);
+    std::normal_distribution<double> normal;
+    for (size_t run = 0; run < 20; run++)
+    {
+        constexpr Eigen::Index n = 4;
+        Eigen::MatrixXd A(n, n);
+        for (auto& v : A.reshaped()) { v = normal(gen); }
+        Eigen::MatrixXd Q = 0.05 * A * A.transpose() + 0.01 * Eigen::MatrixXd::Identity(n, n);
+        Eigen::VectorXd a_float(n);
+        for (auto& v : a_float) { v = 3.0 * normal(gen); }
+
+        // Brute force over all integers around the rounded float solution
+        Eigen::MatrixXd Q_inv = Q.inverse();
+        Eigen::VectorXd a_round = a_float.array().round();
+        std::vector<double> norms;
+        for (int i = 0; i < 625; i++)
+        {
+            Eigen::VectorXd a = a_round + Eigen::Vector4d(i % 5 - 2, (i / 5) % 5 - 2, (i / 25) % 5 - 2, i / 125 - 2);
+            norms.push_back((a_float - a).transpose() * Q_inv * (a_float - a));
+        }
+        std::sort(norms.begin(), norms.end());
+
+        auto dec = Ambiguity::decorrelate(Q);
+        REQUIRE(dec.has_value());
+        auto candidates = Ambiguity::search(dec->L, dec->D, dec->Z.transpose() * a_float, 2);
+        REQUIRE(candidates.size() == 2);
+        REQUIRE_THAT(candidates.at(0).squaredNorm, Catch::Matchers::WithinRel(norms.at(0), 1e-8));
+        REQUIRE_THAT(candidates.at(1).squaredNorm, Catch::Matchers::WithinRel(norms.at(1), 1e-8));
+
+        // The bootstrapped solution can not be better than the integer least squares solution
+        auto bootstrapped = Ambiguity::bootstrap(dec->L, dec->D, dec->Z.transpose() * a_float);
+        REQUIRE(bootstrapped.squaredNorm >= candidates.at(0).squaredNorm - 1e-10);
+    }
+}
+
+TEST_CASE("[AmbiguityResolution] Full ambiguity resolution", "[AmbiguityResolution]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(3);
+    for (size_t n : { 5UL, 10UL, 20UL })
+    {
+        auto problem = simulateFloatSolution(n, 10, gen);
+        auto m = static_cast<Eigen::Index>(n);
+        Eigen::VectorXd a_float = problem.x_float.tail(m);
+        Eigen::MatrixXd Q = problem.P.bottomRightCorner(m, m);
+
+        for (auto estimator : { Ambiguity::Estimator::IntegerLeastSquares, Ambiguity::Estimator::Bootstrapping })
+        {
+            auto resolution = Ambiguity::resolve(a_float, Q, { .estimator = estimator, .strategy = Ambiguity::Strategy::Full });
+            REQUIRE(resolution.fixed);
+            REQUIRE(resolution.nFixed == n);
+            REQUIRE(resolution.successRate >= 0.999);
+            if (estimator == Ambiguity::Estimator::IntegerLeastSquares) { REQUIRE(resolution.ratio >= 3.0); }
+            REQUIRE(fixedAmbiguities(resolution) == problem.x_true.tail(m));
+        }
+    }
+}
+
+TEST_CASE("[AmbiguityResolution] Partial ambiguity resolution", "[AmbiguityResolution]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(4);
+    constexpr size_t n = 12;
+    auto problem = simulateFloatSolution(n, 10, gen);
+    Eigen::VectorXd a_float = problem.x_float.tail(n);
+    Eigen::MatrixXd Q = problem.P.bottomRightCorner(n, n);
+
+    // Three ambiguities are almost unknown (e.g. after a cycle-slip)
+    for (Eigen::Index i : { 1, 5, 8 })
+    {
+        Q(i, i) += 4.0;
+        a_float(i) += 1.7;
+    }
+
+    auto full = Ambiguity::resolve(a_float, Q, { .strategy = Ambiguity::Strategy::Full });
+    REQUIRE_FALSE(full.fixed);
+
+    auto partial = Ambiguity::resolve(a_float, Q, { .strategy = Ambiguity::Strategy::Partial });
+    REQUIRE(partial.fixed);
+    REQUIRE(partial.nFixed >= 4);
+    REQUIRE(partial.nFixed < n);
+    REQUIRE(partial.successRate >= 0.999);
+    REQUIRE(partial.ratio >= 3.0);
+    REQUIRE(partial.z_fixed == partial.Z_fixed.transpose() * problem.x_true.tail(n));
+
+    // Not enough well determined ambiguities
+    auto minFixed = Ambiguity::resolve(a_float, Q, { .strategy = Ambiguity::Strategy::Partial, .minFixed = n - 1 });
+    REQUIRE_FALSE(minFixed.fixed);
+}
+
+TEST_CASE("[AmbiguityResolution] Keyed state", "[AmbiguityResolution]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(5);
+    constexpr size_t n = 8;
+    auto problem = simulateFloatSolution(n, 10, gen);
+
+    std::vector<std::string> keys = { "PosX", "PosY", "PosZ" };
+    std::vector<std::string> ambiguityKeys;
+    for (size_t i = 0; i < n; i++) { ambiguityKeys.push_back(fmt::format("N{}", i)); }
+    keys.insert(keys.end(), ambiguityKeys.begin(), ambiguityKeys.end());
+
+    KeyedVectorXd<std::string> x(problem.x_float, keys);
+    KeyedMatrixXd<std::string> P(problem.P, keys, keys);
+
+    auto result = Ambiguity::resolve(x, P, ambiguityKeys);
+    REQUIRE(result.resolution.fixed);
+    REQUIRE(result.resolution.nFixed == n);
+
+    REQUIRE_THAT(Eigen::VectorXd(result.x(ambiguityKeys)), Catch::Matchers::WithinAbs(Eigen::VectorXd(problem.x_true.tail(n)), 1e-6));
+    REQUIRE_THAT(Eigen::MatrixXd(result.P(ambiguityKeys, ambiguityKeys)), Catch::Matchers::WithinAbs(Eigen::MatrixXd(Eigen::MatrixXd::Zero(n, n)), 1e-8));
+
+    // The fixed baseline is much more precise than the float baseline
+    std::vector<std::string> pos = { "PosX", "PosY", "PosZ" };
+    Eigen::Vector3d e_floatError = problem.x_float.head<3>() - problem.x_true.head<3>();
+    Eigen::Vector3d e_fixedError = result.x(pos) - problem.x_true.head<3>();
+    REQUIRE(e_fixedError.norm() < 0.01);
+    REQUIRE(e_fixedError.norm() < e_floatError.norm());
+    REQUIRE(result.P(pos, pos).trace() < 0.1 * P(pos, pos).trace());
+
+    // Nothing can be fixed, so the state stays unchanged
+    auto unchanged = Ambiguity::resolve(x, P, ambiguityKeys, { .ratioThreshold = std::numeric_limits<double>::infinity() });
+    REQUIRE_FALSE(unchanged.resolution.fixed);
+    REQUIRE(unchanged.x(all) == x(all));
+    REQUIRE(unchanged.P(all, all) == P(all, all));
+}
+
+TEST_CASE("[AmbiguityResolution] Benchmark", "[AmbiguityResolution][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937 gen(6);
+    for (size_t n : { 10UL, 20UL, 30UL, 40UL })
+    {
+        auto problem = simulateFloatSolution(n, 5, gen);
+        auto m = static_cast<Eigen::Index>(n);
+        Eigen::VectorXd a_float = problem.x_float.tail(m);
+        Eigen::MatrixXd Q = problem.P.bottomRightCorner(m, m);
+
+        auto dec = Ambiguity::decorrelate(Q);
+        REQUIRE(dec.has_value());
+        Eigen::VectorXd z_float = dec->Z.transpose() * (a_float - a_float.array().round().matrix());
+
+        BENCHMARK(fmt::format("Decorrelation n = {}", n))
+        {
+            return Ambiguity::decorrelate(Q);
+        };
+        BENCHMARK(fmt::format("Search n = {}", n))
+        {
+            return Ambiguity::search(dec->L, dec->D, z_float, 2);
+        };
+        BENCHMARK(fmt::format("Partial ambiguity resolution n = {}", n))
+        {
+            return Ambiguity::resolve(a_float, Q);
+        };
+    }
+}
+
+} // namespace NAV::TESTS
@@ -0,0 +1,156 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AntexTests.cpp
+/// @brief Tests for the ANTEX reader and the antenna phase center corrections
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "Logger.hpp"
+#include "Navigation/GNSS/Antenna/AntennaCorrections.hpp"
+#include "Navigation/GNSS/Antenna/Antex.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::AntexTests
+{
+
+constexpr const char* ANTEX_FILE = "test/data/GNSS/ANTEX/INSTINCT_test.atx";
+
+TEST_CASE("[Antex] Read receiver and satellite antennas", "[Antex]")
+{
+    auto logger = initializeTestLogger();
+
+    Antex antex;
+    REQUIRE(antex.read(ANTEX_FILE, { "TEST0001    NONE" }, "AntexTests"));
+    REQUIRE(!antex.empty());
+
+    // Receiver antennas which were not requested and individual calibrations are not read
+    REQUIRE(antex.receiverAntenna("OTHER0002 NONE") == nullptr);
+    const auto* receiverAntenna = antex.receiverAntenna("TEST0001        NONE");
+    REQUIRE(receiverAntenna != nullptr);
+    REQUIRE(antex.receiverAntenna("TEST0001") == receiverAntenna);
+    REQUIRE(receiverAntenna->frequencies() == (G01 | G02));
+
+    const auto* l1 = receiverAntenna->calibration(G01);
+    const auto* l2 = receiverAntenna->calibration(G02);
+    REQUIRE(l1 != nullptr);
+    REQUIRE(l2 != nullptr);
+    REQUIRE(l1->isAzimuthDependent());
+    REQUIRE_THAT((l1->pco() - Eigen::Vector3d(1.0, -2.0, 60.0) * 1e-3).norm(), Catch::Matchers::WithinAbs(0.0, 1e-12));
+    REQUIRE_THAT((l2->pco() - Eigen::Vector3d(0.5, 1.0, 55.0) * 1e-3).norm(), Catch::Matchers::WithinAbs(0.0, 1e-12));
+
+    // Frequencies without calibration use GPS L1 or L2
+    REQUIRE(receiverAntenna->calibration(E01) == l1);
+    REQUIRE(receiverAntenna->calibration(R01) == l1);
+    REQUIRE(receiverAntenna->calibration(E05) == l2);
+
+    // The grid is a bilinear function of zenith and azimuth, which the lookup table reproduces exactly
+    for (double zenith = 0.0; zenith <= 90.0; zenith += 3.7)
+    {
+        for (double azimuth = -20.0; azimuth < 380.0; azimuth += 7.3)
+        {
+            double a = azimuth - 360.0 * std::floor(azimuth / 360.0);
+            double expected = (0.1 * zenith + 0.02 * a) * 1e-3;
+            REQUIRE_THAT(l1->pcv(deg2rad(zenith), deg2rad(azimuth)), Catch::Matchers::WithinAbs(expected, 1e-9));
+            REQUIRE_THAT(l2->pcv(deg2rad(zenith), deg2rad(azimuth)), Catch::Matchers::WithinAbs(-expected, 1e-9));
+        }
+    }
+    // Below the horizon the last zenith angle of the grid is used
+    REQUIRE_THAT(l1->pcv(deg2rad(95.0), 0.0), Catch::Matchers::WithinAbs(9e-3, 1e-9));
+
+    // Satellite antennas are selected by the validity interval
+    REQUIRE(antex.satelliteAntenna(SatId(GPS, 1), InsTime(2010, 1, 1, 0, 0, 0.0, GPST)) == nullptr);
+    const auto* blockIIF = antex.satelliteAntenna(SatId(GPS, 1), InsTime(2015, 1, 1, 0, 0, 0.0, GPST));
+    const auto* blockIIIA = antex.satelliteAntenna(SatId(GPS, 1), InsTime(2023, 1, 8, 0, 0, 0.0, GPST));
+    REQUIRE(blockIIF != nullptr);
+    REQUIRE(blockIIIA != nullptr);
+    REQUIRE(blockIIF != blockIIIA);
+    REQUIRE_THAT(blockIIF->calibration(G01)->pco().z(), Catch::Matchers::WithinAbs(1.023, 1e-12));
+    REQUIRE_THAT(blockIIIA->calibration(G01)->pco().z(), Catch::Matchers::WithinAbs(1.2, 1e-12));
+    REQUIRE(!blockIIF->calibration(G01)->isAzimuthDependent());
+    REQUIRE_THAT(blockIIF->calibration(G01)->pcv(deg2rad(5.5), 1.0), Catch::Matchers::WithinAbs(-2.75e-3, 1e-9));
+    REQUIRE_THAT(blockIIF->calibration(G01)->pcv(deg2rad(14.0), 1.0), Catch::Matchers::WithinAbs(-5e-3, 1e-9));
+    REQUIRE_THAT(blockIIIA->calibration(G02)->pcv(deg2rad(12.25), 1.0), Catch::Matchers::WithinAbs(2.45e-3, 1e-9));
+
+    const auto* galileo = antex.satelliteAntenna(SatId(GAL, 1), InsTime(2023, 1, 8, 0, 0, 0.0, GPST));
+    REQUIRE(galileo != nullptr);
+    REQUIRE(galileo->frequencies() == (E01 | E05));
+    REQUIRE(galileo->calibration(E07) == nullptr);
+    REQUIRE(galileo->calibration(E01)->isAzimuthDependent());
+    REQUIRE_THAT(galileo->calibration(E05)->pcv(deg2rad(7.5), deg2rad(102.5)), Catch::Matchers::WithinAbs((0.3 * 7.5 + 0.01 * 102.5) * 1e-3, 1e-9));
+
+    antex.clear();
+    REQUIRE(antex.empty());
+    REQUIRE(!antex.read("test/data/GNSS/ANTEX/doesNotExist.atx", {}, "AntexTests"));
+}
+
+TEST_CASE("[Antex] Position of the Sun", "[Antex]")
+{
+    auto logger = initializeTestLogger();
+
+    // 2023-01-08 12:00 UTC: Declination -22.3 deg, equation of time -6.5 min, distance 0.9833 AU
+    auto e_sunPos = e_calcSunPosition(InsTime(2023, 1, 8, 12, 0, 0.0, UTC));
+    REQUIRE_THAT(rad2deg(std::asin(e_sunPos.z() / e_sunPos.norm())), Catch::Matchers::WithinAbs(-22.3, 0.2));
+    REQUIRE_THAT(rad2deg(std::atan2(e_sunPos.y(), e_sunPos.x())), Catch::Matchers::WithinAbs(1.6, 0.2));
+    REQUIRE_THAT(e_sunPos.norm(), Catch::Matchers::WithinRel(0.9833 * 1.495978707e11, 1e-3));
+}
+
+TEST_CASE("[Antex] Receiver and satellite antenna corrections", "[Antex]")
+{
+    auto logger = initializeTestLogger();
+
+    Antex antex;
+    REQUIRE(antex.read(ANTEX_FILE, { "TEST0001 NONE" }, "AntexTests"));
+    const auto& recvCalibration = *antex.receiverAntenna("TEST0001")->calibration(G01);
+    const auto& satCalibration = *antex.satelliteAntenna(SatId(GAL, 1), InsTime(2023, 1, 8, 0, 0, 0.0, GPST))->calibration(E01);
+
+    InsTime time(2023, 1, 8, 12, 0, 0.0, GPST);
+    Eigen::Vector3d e_sunPos = e_calcSunPosition(time);
+    Eigen::Vector3d lla_recvPos(deg2rad(48.78), deg2rad(9.18), 320.0);
+    Eigen::Vector3d e_recvPos = trafo::lla2ecef_WGS84(lla_recvPos);
+
+    for (const auto& e_satPos : { Eigen::Vector3d(15e6, 5e6, 23e6), Eigen::Vector3d(25e6, -10e6, 12e6), Eigen::Vector3d(5e6, 20e6, 20e6) })
+    {
+        Eigen::Vector3d e_pLOS = e_calcLineOfSightUnitVector(e_recvPos, e_satPos);
+        Eigen::Vector3d n_pLOS = trafo::n_Quat_e(lla_recvPos(0), lla_recvPos(1)) * e_pLOS;
+        double satElevation = calcSatElevation(n_pLOS);
+        double satAzimuth = calcSatAzimuth(n_pLOS);
+
+        // The offset correction is the range change to the phase center
+        Eigen::Vector3d n_pco(recvCalibration.pco()(0), recvCalibration.pco()(1), -recvCalibration.pco()(2));
+        Eigen::Vector3d e_recvApc = e_recvPos + trafo::e_Quat_n(lla_recvPos(0), lla_recvPos(1)) * n_pco;
+        double recvCorrection = calcReceiverAntennaCorrection(recvCalibration, lla_recvPos, e_pLOS, satElevation, satAzimuth);
+        REQUIRE_THAT(recvCorrection - recvCalibration.pcv(M_PI_2 - satElevation, satAzimuth),
+                     Catch::Matchers::WithinAbs((e_satPos - e_recvApc).norm() - (e_satPos - e_recvPos).norm(), 1e-8));
+
+        // Satellite body frame of the nominal yaw-steering attitude
+        Eigen::Vector3d e_z = -e_satPos.normalized();
+        Eigen::Vector3d e_y = e_z.cross(e_sunPos - e_satPos).normalized();
+        Eigen::Vector3d e_x = e_y.cross(e_z);
+        const auto& pco = satCalibration.pco();
+        Eigen::Vector3d e_satApc = e_satPos + pco(0) * e_x + pco(1) * e_y + pco(2) * e_z;
+        double nadir = std::acos(e_z.dot(-e_pLOS));
+        double azimuth = std::atan2(e_x.dot(-e_pLOS), e_y.dot(-e_pLOS));
+        double satCorrection = calcSatelliteAntennaCorrection(satCalibration, e_satPos, e_sunPos, e_pLOS);
+        REQUIRE_THAT(satCorrection - satCalibration.pcv(nadir, azimuth),
+                     Catch::Matchers::WithinAbs((e_satApc - e_recvPos).norm() - (e_satPos - e_recvPos).norm(), 1e-6));
+    }
+
+    // Satellite in the zenith of the receiver
+    Eigen::Vector3d e_satPos = e_recvPos.normalized() * 26e6;
+    Eigen::Vector3d e_pLOS = e_calcLineOfSightUnitVector(e_recvPos, e_satPos);
+    REQUIRE_THAT(calcReceiverAntennaCorrection(recvCalibration, lla_recvPos, e_pLOS, M_PI_2, 0.0), Catch::Matchers::WithinAbs(-0.06, 5e-5));
+}
+
+} // namespace NAV::TESTS::AntexTests
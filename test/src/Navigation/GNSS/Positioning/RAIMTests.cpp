@@ -0,0 +1,230 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RAIMTests.cpp
+/// @brief Tests for the robust estimation and the receiver autonomous integrity monitoring
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/GNSS/Positioning/RAIM.hpp"
+#include "Navigation/Math/RobustEstimation.hpp"
+#include "util/Container/STL.hpp"
+
+namespace NAV::TESTS::RAIMTests
+{
+
+namespace
+{
+
+/// @brief Linearized single point positioning problem with random satellite geometry
+struct Problem
+{
+    /// @brief Constructor
+    /// @param[in] nSatellites Amount of satellites
+    /// @param[in] seed Seed of the random number generator
+    Problem(Eigen::Index nSatellites, unsigned int seed)
+        : H(nSatellites, 4), w(nSatellites), dz(nSatellites)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> azimuth(0.0, 2.0 * M_PI);
+        std::uniform_real_distribution<double> elevation(10.0 * M_PI / 180.0, M_PI_2);
+        std::normal_distribution<double> noise(0.0, 1.0);
+
+        for (Eigen::Index i = 0; i < nSatellites; i++)
+        {
+            double az = azimuth(gen);
+            double el = elevation(gen);
+            // Line-of-sight in the local frame (North, East, Down)
+            Eigen::Vector3d n_lineOfSight(std::cos(el) * std::cos(az), std::cos(el) * std::sin(az), -std::sin(el));
+            H.row(i) << -n_lineOfSight.transpose(), 1.0;
+
+            double sigma = 0.5 / std::sin(el);
+            w(i) = 1.0 / (sigma * sigma);
+            dz(i) = H.row(i) * x + sigma * noise(gen);
+        }
+    }
+
+    Eigen::MatrixXd H;                          ///< Design matrix
+    Eigen::VectorXd w;                          ///< Weights
+    Eigen::VectorXd dz;                         ///< Residual vector
+    Eigen::Vector4d x{ 3.0, -2.0, 5.0, 100.0 }; ///< True solution (position and clock error)
+};
+
+/// @brief Solution and weighted sum of squared residuals without the excluded observations (solved again)
+/// @param[in] problem Linearized problem
+/// @param[in] excluded Indices of the excluded observations
+std::pair<Eigen::VectorXd, double> solveBruteForce(const Problem& problem, const std::vector<Eigen::Index>& excluded)
+{
+    Eigen::VectorXd w = problem.w;
+    for (const auto& i : excluded) { w(i) = 0.0; }
+    Eigen::VectorXd x = (problem.H.transpose() * w.asDiagonal() * problem.H).inverse() * problem.H.transpose() * w.asDiagonal() * problem.dz;
+    Eigen::VectorXd v = problem.dz - problem.H * x;
+    return { x, v.transpose() * w.asDiagonal() * v };
+}
+
+} // namespace
+
+TEST_CASE("[RobustEstimation] Weight functions", "[RobustEstimation]")
+{
+    auto logger = initializeTestLogger();
+
+    for (const auto& weightFunction : { RobustWeightFunction::None, RobustWeightFunction::Huber, RobustWeightFunction::IGG3, RobustWeightFunction::Danish })
+    {
+        INFO(to_string(weightFunction));
+        REQUIRE(robustWeightFactor(weightFunction, 0.0, 1.5, 3.0) == 1.0);
+        REQUIRE(robustWeightFactor(weightFunction, -1.5, 1.5, 3.0) == 1.0);
+        REQUIRE_THAT(robustWeightFactor(weightFunction, 1.5 + 1e-9, 1.5, 3.0), Catch::Matchers::WithinAbs(1.0, 1e-6)); // Continuous at k0
+        REQUIRE(robustWeightFactor(weightFunction, 2.5, 1.5, 3.0) >= robustWeightFactor(weightFunction, 2.9, 1.5, 3.0));
+    }
+    REQUIRE(robustWeightFactor(RobustWeightFunction::None, 100.0, 1.5, 3.0) == 1.0);
+    REQUIRE_THAT(robustWeightFactor(RobustWeightFunction::Huber, 3.0, 1.5, 3.0), Catch::Matchers::WithinAbs(0.5, 1e-12));
+    REQUIRE_THAT(robustWeightFactor(RobustWeightFunction::IGG3, 3.0, 1.5, 3.0), Catch::Matchers::WithinAbs(0.0, 1e-12));
+    REQUIRE(robustWeightFactor(RobustWeightFunction::IGG3, 3.1, 1.5, 3.0) == 0.0);
+    REQUIRE_THAT(robustWeightFactor(RobustWeightFunction::Danish, 3.0, 1.5, 3.0), Catch::Matchers::WithinAbs(std::exp(-3.0), 1e-12));
+}
+
+TEST_CASE("[RobustEstimation] Iteratively reweighted least squares with an outlier", "[RobustEstimation]")
+{
+    auto logger = initializeTestLogger();
+
+    Problem problem(12, 42);
+    problem.dz(5) += 30.0;
+
+    Eigen::Vector4d x_wlsq = (problem.H.transpose() * problem.w.asDiagonal() * problem.H).inverse() * problem.H.transpose() * problem.w.asDiagonal() * problem.dz;
+    INFO(fmt::format("WLSQ error {}", (x_wlsq - problem.x).transpose()));
+    REQUIRE((x_wlsq - problem.x).head<3>().norm() > 3.0);
+
+    for (const auto& weightFunction : { RobustWeightFunction::Huber, RobustWeightFunction::IGG3, RobustWeightFunction::Danish })
+    {
+        auto result = solveRobustWeightedLinearLeastSquaresUncertainties(problem.H, problem.w, problem.dz, weightFunction, 1.5, 3.0, 20);
+        INFO(fmt::format("{}: error {} after {} iterations, weight factors {}", to_string(weightFunction), (result.solution - problem.x).transpose(),
+                         result.iterations, result.weightFactors.transpose()));
+        REQUIRE(result.weightFactors(5) < 0.2);
+        REQUIRE((result.solution - problem.x).head<3>().norm() < (x_wlsq - problem.x).head<3>().norm() / 2.0);
+        REQUIRE(result.variance.rows() == 4);
+    }
+
+    auto none = solveRobustWeightedLinearLeastSquaresUncertainties(problem.H, problem.w, problem.dz, RobustWeightFunction::None, 1.5, 3.0);
+    REQUIRE(none.iterations == 0);
+    REQUIRE_THAT((none.solution - x_wlsq).norm(), Catch::Matchers::WithinAbs(0.0, 1e-9));
+}
+
+TEST_CASE("[RAIM] Consistent observations", "[RAIM]")
+{
+    auto logger = initializeTestLogger();
+
+    json j = { { "enabled", true } };
+    RAIM raim = j.get<RAIM>();
+    REQUIRE(raim.isEnabled());
+
+    Problem problem(10, 1);
+    auto result = raim.checkAndExclude(problem.H, problem.w, problem.dz, Eigen::Matrix3d::Identity());
+
+    REQUIRE(!result.faultDetected);
+    REQUIRE(result.consistent);
+    REQUIRE(result.excluded.empty());
+    REQUIRE(result.dof == 6);
+    REQUIRE(result.testStatistic <= result.threshold);
+    REQUIRE_THAT(result.threshold, Catch::Matchers::WithinAbs(22.4577, 1e-3)); // Chi-square quantile for 1 - 1e-3 and 6 dof
+
+    Eigen::Vector3d n_error = (result.solution - problem.x).head<3>();
+    INFO(fmt::format("error {}, HPL {}, VPL {}", n_error.transpose(), result.HPL, result.VPL));
+    REQUIRE(std::isfinite(result.HPL));
+    REQUIRE(std::isfinite(result.VPL));
+    REQUIRE(n_error.head<2>().norm() < result.HPL);
+    REQUIRE(std::abs(n_error(2)) < result.VPL);
+
+    // Without redundancy nothing can be checked
+    Problem minimal(4, 1);
+    auto noRedundancy = raim.checkAndExclude(minimal.H, minimal.w, minimal.dz, Eigen::Matrix3d::Identity());
+    REQUIRE(!noRedundancy.consistent);
+    REQUIRE(noRedundancy.dof == 0);
+    REQUIRE_THAT((minimal.dz - minimal.H * noRedundancy.solution).norm(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+}
+
+TEST_CASE("[RAIM] Exclusion of one and two faults", "[RAIM]")
+{
+    auto logger = initializeTestLogger();
+
+    RAIM raim = json{ { "enabled", true }, { "maxExclusions", 2 } }.get<RAIM>();
+
+    for (unsigned int seed = 0; seed < 10; seed++)
+    {
+        DYNAMIC_SECTION("Seed " << seed)
+        {
+            Problem problem(14, seed);
+
+            Problem oneFault = problem;
+            oneFault.dz(3) += 80.0;
+            auto result = raim.checkAndExclude(oneFault.H, oneFault.w, oneFault.dz, Eigen::Matrix3d::Identity());
+            INFO(fmt::format("One fault: excluded [{}], test statistic {}", joinToString(result.excluded), result.testStatistic));
+            REQUIRE(result.faultDetected);
+            REQUIRE(result.consistent);
+            REQUIRE(result.excluded == std::vector<Eigen::Index>{ 3 });
+            REQUIRE(result.dof == 9);
+            auto [x_ref, testStatistic_ref] = solveBruteForce(oneFault, result.excluded);
+            REQUIRE_THAT(result.testStatistic, Catch::Matchers::WithinRel(testStatistic_ref, 1e-9));
+            REQUIRE_THAT((result.solution - x_ref).norm(), Catch::Matchers::WithinAbs(0.0, 1e-9));
+
+            Problem twoFaults = problem;
+            twoFaults.dz(2) += 70.0;
+            twoFaults.dz(9) -= 90.0;
+            result = raim.checkAndExclude(twoFaults.H, twoFaults.w, twoFaults.dz, Eigen::Matrix3d::Identity());
+            INFO(fmt::format("Two faults: excluded [{}], test statistic {}", joinToString(result.excluded), result.testStatistic));
+            REQUIRE(result.faultDetected);
+            REQUIRE(result.consistent);
+            REQUIRE(result.excluded == std::vector<Eigen::Index>{ 2, 9 });
+            REQUIRE(result.dof == 8);
+            std::tie(x_ref, testStatistic_ref) = solveBruteForce(twoFaults, result.excluded);
+            REQUIRE_THAT(result.testStatistic, Catch::Matchers::WithinRel(testStatistic_ref, 1e-9));
+            REQUIRE_THAT((result.solution - x_ref).norm(), Catch::Matchers::WithinAbs(0.0, 1e-9));
+            REQUIRE(std::isfinite(result.HPL));
+        }
+    }
+
+    RAIM detectionOnly = json{ { "enabled", true }, { "maxExclusions", 0 } }.get<RAIM>();
+    Problem problem(14, 0);
+    problem.dz(3) += 80.0;
+    auto result = detectionOnly.checkAndExclude(problem.H, problem.w, problem.dz, Eigen::Matrix3d::Identity());
+    REQUIRE(result.faultDetected);
+    REQUIRE(!result.consistent);
+    REQUIRE(result.excluded.empty());
+}
+
+TEST_CASE("[RAIM] Fault detection and exclusion with 40 satellites", "[RAIM][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    RAIM raim = json{ { "enabled", true }, { "maxExclusions", 2 } }.get<RAIM>();
+    Problem problem(40, 7);
+    problem.dz(11) += 50.0;
+    problem.dz(27) -= 60.0;
+
+    BENCHMARK("Two faults")
+    {
+        return raim.checkAndExclude(problem.H, problem.w, problem.dz, Eigen::Matrix3d::Identity());
+    };
+    BENCHMARK("IGG-III reweighting")
+    {
+        return solveRobustWeightedLinearLeastSquaresUncertainties(problem.H, problem.w, problem.dz, RobustWeightFunction::IGG3, 1.5, 3.0);
+    };
+}
+
+} // namespace NAV::TESTS::RAIMTests
@@ -0,0 +1,330 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtkTests.cpp
+/// @brief Tests for the Real-Time Kinematic (RTK) float positioning
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Positioning/RTK/Algorithm.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::RtkTests
+{
+
+namespace
+{
+
+/// @brief GPS broadcast ephemeris (BRDC_20230080000 of G01) with modified mean anomaly and longitude of the ascending node
+/// @param[in] M_0 Mean anomaly at reference time [rad]
+/// @param[in] Omega_0 Longitude of the ascending node at weekly epoch [rad]
+std::shared_ptr<GPSEphemeris> gpsEphemeris(double M_0, double Omega_0)
+{
+    return std::make_shared<GPSEphemeris>(2023, 1, 8, 12, 0, 0, 2.270475961268e-04, -4.774847184308e-12, 0.000000000000e+00,
+                                          1.800000000000e+01, 4.412500000000e+01, 4.154815921903e-09, M_0,
+                                          2.287328243256e-06, 1.217866723891e-02, 9.965151548386e-07, 5.153653379440e+03,
+                                          4.320000000000e+04, -6.891787052155e-08, Omega_0, 1.434236764908e-07,
+                                          9.889891589796e-01, 3.767500000000e+02, 9.377162063410e-01, -8.364991292606e-09,
+                                          1.185763677531e-10, 1.000000000000e+00, 2.244000000000e+03, 0.000000000000e+00,
+                                          2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 1.800000000000e+01,
+                                          3.601800000000e+04, 4.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+}
+
+/// @brief Simulates error-free GPS L1/L2 observations of a static base station and a moving rover about 2 km apart
+class Simulation
+{
+  public:
+    /// @brief Constructor (6 orbital planes with 4 satellites each)
+    Simulation()
+    {
+        for (uint16_t plane = 0; plane < 6; plane++)
+        {
+            for (uint16_t slot = 0; slot < 4; slot++)
+            {
+                uint16_t satNum = static_cast<uint16_t>(plane * 4 + slot + 1);
+                auto eph = gpsEphemeris(0.1 + slot * M_PI_2 + plane * 0.5, -1.5 + plane * M_PI / 3.0);
+                gnssNavInfo.addSatelliteNavData(SatId(GPS, satNum), eph);
+                ephemerides.emplace_back(satNum, eph);
+            }
+        }
+    }
+
+    /// @brief True rover position [m]
+    /// @param[in] t Time since the start [s]
+    [[nodiscard]] Eigen::Vector3d e_roverPosition(double t) const
+    {
+        return e_basePosition + e_Quat_n * (n_baseline + n_velocity * t + 0.5 * n_acceleration * t * t);
+    }
+
+    /// @brief Integer ambiguity of a signal [cycles]
+    /// @param[in] satSigId Satellite signal identifier
+    /// @param[in] receiver Receiver
+    [[nodiscard]] static double ambiguity(const SatSigId& satSigId, RTK::Algorithm::ReceiverType receiver)
+    {
+        return receiver == RTK::Algorithm::Rover ? 1000.0 * satSigId.satNum + (satSigId.code == Code::G1C ? 0.0 : 500.0)
+                                                 : -37.0 * satSigId.satNum + (satSigId.code == Code::G1C ? 11.0 : -3.0);
+    }
+
+    /// @brief True double-differenced ambiguity [cycles]
+    /// @param[in] satSigId Satellite signal identifier
+    /// @param[in] refSatSigId Reference signal
+    [[nodiscard]] static double ambiguityDD(const SatSigId& satSigId, const SatSigId& refSatSigId)
+    {
+        return (ambiguity(satSigId, RTK::Algorithm::Rover) - ambiguity(satSigId, RTK::Algorithm::Base))
+               - (ambiguity(refSatSigId, RTK::Algorithm::Rover) - ambiguity(refSatSigId, RTK::Algorithm::Base));
+    }
+
+    /// @brief Simulates the observations of a receiver
+    /// @param[in] t Time since the start [s]
+    /// @param[in] receiver Receiver to simulate
+    [[nodiscard]] std::shared_ptr<GnssObs> observe(double t, RTK::Algorithm::ReceiverType receiver) const
+    {
+        double recvClk = receiver == RTK::Algorithm::Rover ? 1e-4 + 1e-7 * t : -3e-4 + 2e-8 * t;
+        InsTime recvTime = startTime + std::chrono::duration<double>(t + recvClk);
+        Eigen::Vector3d e_pos = receiver == RTK::Algorithm::Rover ? e_roverPosition(t) : e_basePosition;
+
+        std::vector<GnssObs::ObservationData> data;
+        for (const auto& [satNum, eph] : ephemerides)
+        {
+            for (auto code : { Code(Code::G1C), Code(Code::G2W) })
+            {
+                SatSigId satSigId(code, satNum);
+                double rho = 2e7;
+                double satClkBias = 0.0;
+                Eigen::Vector3d e_satPos;
+                for (size_t i = 0; i < 5; i++)
+                {
+                    auto satClk = eph->calcClockCorrections(recvTime, rho + InsConst<>::C * (recvClk - satClkBias), G01);
+                    satClkBias = satClk.bias;
+                    e_satPos = eph->calcSatellitePosVel(satClk.transmitTime).e_pos;
+                    rho = (e_satPos - e_pos).norm() + calcSagnacCorrection(e_pos, e_satPos);
+                }
+                double n_LOS_el = calcSatElevation(trafo::n_Quat_e(lla_basePosition(0), lla_basePosition(1)) * e_calcLineOfSightUnitVector(e_pos, e_satPos));
+                if (n_LOS_el < deg2rad(15.0)) { continue; }
+
+                double psr = rho + InsConst<>::C * (recvClk - satClkBias);
+                double lambda = InsConst<>::C / satSigId.freq().getFrequency(-128);
+                data.emplace_back(satSigId, GnssObs::ObservationData::Pseudorange{ .value = psr, .SSI = 0 },
+                                  GnssObs::ObservationData::CarrierPhase{ .value = psr / lambda + ambiguity(satSigId, receiver), .SSI = 0, .LLI = 0 },
+                                  std::nullopt, std::nullopt);
+            }
+        }
+        return std::make_shared<GnssObs>(recvTime, data, std::vector<GnssObs::SatelliteData>{});
+    }
+
+    GnssNavInfo gnssNavInfo;                                                    ///< Navigation data of all satellites
+    std::vector<std::pair<uint16_t, std::shared_ptr<GPSEphemeris>>> ephemerides; ///< Ephemerides of all satellites
+    InsTime startTime{ 2023, 1, 8, 12, 10, 0, GPST };                           ///< Time of the first epoch
+    Eigen::Vector3d lla_basePosition{ deg2rad(48.78), deg2rad(9.18), 300.0 };   ///< Base position (latitude, longitude, altitude)
+    Eigen::Vector3d e_basePosition = trafo::lla2ecef_WGS84(lla_basePosition);   ///< Base position in ECEF [m]
+    Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(lla_basePosition(0), lla_basePosition(1)); ///< Rotation at the base position
+    Eigen::Vector3d n_baseline{ 1200.0, -1500.0, 20.0 };                        ///< Initial baseline in NED [m]
+    Eigen::Vector3d n_velocity{ 15.0, -5.0, 0.2 };                              ///< Initial rover velocity in NED [m/s]
+    Eigen::Vector3d n_acceleration{ 0.5, 1.0, -0.1 };                           ///< Rover acceleration in NED [m/s²]
+};
+
+/// @brief Checks the estimated double-differenced ambiguities against the true ones
+/// @param[in] algorithm RTK algorithm
+/// @param[in] result Solution of the epoch
+/// @param[in] gnssObs Rover observation of the epoch
+/// @param[in] offsets Additional cycles of signals (slips)
+void checkAmbiguities(const RTK::Algorithm& algorithm, const RTK::Algorithm::Result& result, const GnssObs& gnssObs,
+                      const std::vector<std::pair<SatSigId, double>>& offsets = {})
+{
+    auto offset = [&](const SatSigId& satSigId) {
+        auto iter = std::find_if(offsets.begin(), offsets.end(), [&](const auto& o) { return o.first == satSigId; });
+        return iter == offsets.end() ? 0.0 : iter->second;
+    };
+
+    size_t nChecked = 0;
+    for (const auto& obsData : gnssObs.data)
+    {
+        auto ref = std::find_if(result.referenceSignals.begin(), result.referenceSignals.end(),
+                                [&](const SatSigId& refSatSigId) { return refSatSigId.code == obsData.satSigId.code; });
+        REQUIRE(ref != result.referenceSignals.end());
+        auto ambiguityDD = algorithm.ambiguityDD(obsData.satSigId);
+        if (!ambiguityDD) { continue; }
+
+        double trueAmbiguityDD = Simulation::ambiguityDD(obsData.satSigId, *ref) + offset(obsData.satSigId) - offset(*ref);
+        INFO(fmt::format("[{}] to [{}]: {} estimated, {} true", obsData.satSigId, *ref, *ambiguityDD, trueAmbiguityDD));
+        REQUIRE_THAT(*ambiguityDD, Catch::Matchers::WithinAbs(trueAmbiguityDD, 0.01));
+        nChecked++;
+    }
+    REQUIRE(nChecked == result.nSignals);
+}
+
+} // namespace
+
+TEST_CASE("[RTK] Float solution of a moving rover at 10 Hz with a 1 Hz base station", "[RTK]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+
+    RTK::Algorithm algorithm;
+    // The L1-L2 phase difference in cycles still contains the geometry, whose curvature exceeds the linear fit at 1 Hz
+    algorithm._cycleSlipDetector.setWindowSize(3, CycleSlipDetector::Detector::DualFrequency);
+    algorithm._cycleSlipDetector.setPolynomialDegree(2, CycleSlipDetector::Detector::DualFrequency);
+    algorithm.reset();
+    algorithm.setBasePosition(sim.e_basePosition);
+
+    REQUIRE(!algorithm.calcSolution(*sim.observe(0.0, RTK::Algorithm::Rover), gnssNavInfos, "RTK").has_value()); // No base yet
+
+    constexpr double DT = 0.1;
+    for (size_t k = 0; k <= 30; k++)
+    {
+        double t = static_cast<double>(k) * DT;
+        if (k % 10 == 0) { algorithm.addBaseObservation(*sim.observe(t, RTK::Algorithm::Base), gnssNavInfos, "RTK"); }
+
+        auto gnssObs = sim.observe(t, RTK::Algorithm::Rover);
+        auto result = algorithm.calcSolution(*gnssObs, gnssNavInfos, "RTK");
+        REQUIRE(result.has_value());
+        REQUIRE(algorithm.isInitialized());
+
+        INFO(fmt::format("t = {} s, position error {} [m], {} signals", t, (result->e_position - sim.e_roverPosition(t)).transpose(), result->nSignals));
+        REQUIRE_THAT(result->differentialAge, Catch::Matchers::WithinAbs(static_cast<double>(k % 10) * DT, 1e-3));
+        REQUIRE(result->nSatellites >= 5);
+        REQUIRE(result->nSignals == 2 * (result->nSatellites - 1));
+        REQUIRE(result->nAmbiguities == result->nSignals + 2);
+        REQUIRE(result->referenceSignals.size() == 2);
+        REQUIRE(result->cycleSlips.empty());
+        REQUIRE(result->outliers.empty());
+        // The solution refers to the receiver time tag, which differs by the rover clock error from the true time
+        REQUIRE_THAT((result->e_position - sim.e_roverPosition(t)).norm(), Catch::Matchers::WithinAbs(0.0, 0.01));
+        REQUIRE_THAT((result->e_baseline - (sim.e_roverPosition(t) - sim.e_basePosition)).norm(), Catch::Matchers::WithinAbs(0.0, 0.01));
+        REQUIRE(result->e_positionCovariance.diagonal().cwiseSqrt().maxCoeff() < 1.0);
+        if (k > 0)
+        {
+            Eigen::Vector3d e_velocity = sim.e_Quat_n * (sim.n_velocity + sim.n_acceleration * t);
+            REQUIRE_THAT((result->e_velocity - e_velocity).norm(), Catch::Matchers::WithinAbs(0.0, 0.5));
+        }
+
+        checkAmbiguities(algorithm, *result, *gnssObs);
+    }
+
+    // Outdated base station
+    REQUIRE(!algorithm.calcSolution(*sim.observe(15.0, RTK::Algorithm::Rover), gnssNavInfos, "RTK").has_value());
+}
+
+TEST_CASE("[RTK] Reference changes keep the ambiguities and slips reset only the affected ones", "[RTK]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+
+    RTK::Algorithm algorithm;
+    algorithm.reset();
+    algorithm.setBasePosition(sim.e_basePosition);
+
+    constexpr double DT = 0.1;
+    std::optional<SatId> removedSat;
+    std::optional<SatSigId> slipped;
+    size_t nAmbiguities = 0;
+    for (size_t k = 0; k <= 40; k++)
+    {
+        double t = static_cast<double>(k) * DT;
+        algorithm.addBaseObservation(*sim.observe(t, RTK::Algorithm::Base), gnssNavInfos, "RTK");
+
+        auto gnssObs = sim.observe(t, RTK::Algorithm::Rover);
+        if (removedSat) // Rover loses the reference satellite
+        {
+            std::erase_if(gnssObs->data, [&](const GnssObs::ObservationData& obsData) { return obsData.satSigId.toSatId() == *removedSat; });
+        }
+        if (slipped && k >= 25) // Slip of 7 cycles in epoch 25, which persists
+        {
+            auto obsData = std::find_if(gnssObs->data.begin(), gnssObs->data.end(), [&](const auto& obs) { return obs.satSigId == *slipped; });
+            obsData->carrierPhase->value += 7.0;
+            if (k == 25) { obsData->carrierPhase->LLI = 1; }
+        }
+
+        auto result = algorithm.calcSolution(*gnssObs, gnssNavInfos, "RTK");
+        REQUIRE(result.has_value());
+        INFO(fmt::format("k = {}, position error {} [m], {} signals", k, (result->e_position - sim.e_roverPosition(t)).transpose(), result->nSignals));
+        REQUIRE_THAT((result->e_position - sim.e_roverPosition(t)).norm(), Catch::Matchers::WithinAbs(0.0, 0.01));
+
+        if (k == 10)
+        {
+            removedSat = result->referenceSignals.front().toSatId();
+            nAmbiguities = result->nAmbiguities;
+        }
+        else if (k == 11)
+        {
+            for (const auto& ref : result->referenceSignals) { REQUIRE(ref.toSatId() != *removedSat); }
+            REQUIRE(result->nAmbiguities == nAmbiguities); // The ambiguities of the lost satellite are still kept
+        }
+        else if (k == 20)
+        {
+            slipped = std::find_if(gnssObs->data.begin(), gnssObs->data.end(), [&](const auto& obs) {
+                          return obs.satSigId.code == Code::G2W
+                                 && std::find(result->referenceSignals.begin(), result->referenceSignals.end(), obs.satSigId) == result->referenceSignals.end();
+                      })->satSigId;
+        }
+        else if (k == 25)
+        {
+            REQUIRE(std::find(result->cycleSlips.begin(), result->cycleSlips.end(), *slipped) != result->cycleSlips.end());
+        }
+        else if (k == 35)
+        {
+            REQUIRE(result->nAmbiguities == nAmbiguities - 2); // but removed after the maximum gap
+        }
+        if (k > 10 && k != 25) { REQUIRE(result->cycleSlips.empty()); }
+
+        std::vector<std::pair<SatSigId, double>> offsets;
+        if (slipped && k >= 25) { offsets.emplace_back(*slipped, 7.0); }
+        checkAmbiguities(algorithm, *result, *gnssObs, offsets);
+    }
+}
+
+TEST_CASE("[RTK] Float solution of an epoch", "[RTK][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+    std::vector<std::shared_ptr<GnssObs>> baseEpochs;
+    std::vector<std::shared_ptr<GnssObs>> roverEpochs;
+    for (size_t k = 0; k < 20; k++)
+    {
+        if (k % 10 == 0) { baseEpochs.push_back(sim.observe(static_cast<double>(k) * 0.1, RTK::Algorithm::Base)); }
+        roverEpochs.push_back(sim.observe(static_cast<double>(k) * 0.1, RTK::Algorithm::Rover));
+    }
+
+    BENCHMARK("20 rover epochs at 10 Hz")
+    {
+        RTK::Algorithm algorithm;
+        algorithm.reset();
+        algorithm.setBasePosition(sim.e_basePosition);
+        double sum = 0.0;
+        for (size_t k = 0; k < roverEpochs.size(); k++)
+        {
+            if (k % 10 == 0) { algorithm.addBaseObservation(*baseEpochs.at(k / 10), gnssNavInfos, "RTK"); }
+            if (auto result = algorithm.calcSolution(*roverEpochs.at(k), gnssNavInfos, "RTK"))
+            {
+                sum += result->e_baseline.x();
+            }
+        }
+        return sum;
+    };
+}
+
+} // namespace NAV::TESTS::RtkTests
@@ -0,0 +1,172 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SatelliteEpochCacheTests.cpp
+/// @brief Tests for the satellite states shared between receivers
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Positioning/SatelliteEpochCache.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+
+namespace NAV::TESTS::SatelliteEpochCacheTests
+{
+
+namespace
+{
+
+/// @brief GPS G01 broadcast ephemeris (BRDC_20230080000)
+std::shared_ptr<GPSEphemeris> gpsEphemeris()
+{
+    return std::make_shared<GPSEphemeris>(2023, 1, 8, 12, 0, 0, 2.270475961268e-04, -4.774847184308e-12, 0.000000000000e+00,
+                                          1.800000000000e+01, 4.412500000000e+01, 4.154815921903e-09, 9.534843171347e-02,
+                                          2.287328243256e-06, 1.217866723891e-02, 9.965151548386e-07, 5.153653379440e+03,
+                                          4.320000000000e+04, -6.891787052155e-08, -1.509394590195e+00, 1.434236764908e-07,
+                                          9.889891589796e-01, 3.767500000000e+02, 9.377162063410e-01, -8.364991292606e-09,
+                                          1.185763677531e-10, 1.000000000000e+00, 2.244000000000e+03, 0.000000000000e+00,
+                                          2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 1.800000000000e+01,
+                                          3.601800000000e+04, 4.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+}
+
+/// @brief GLONASS broadcast ephemeris
+std::shared_ptr<GLONASSEphemeris> glonassEphemeris()
+{
+    return std::make_shared<GLONASSEphemeris>(InsTime(2023, 1, 8, 11, 45, 0, UTC), 0.0, -4.28e-5, 1.8e-12, true,
+                                              Eigen::Vector3d(-14081.752701e3, 18358.958252e3, 10861.302124e3),
+                                              Eigen::Vector3d(-1.02576358e3, 1.08672147e3, -3.15732343e3),
+                                              Eigen::Vector3d::Zero(), int8_t(1));
+}
+
+/// @brief Receive time and pseudorange of a receiver
+struct Reception
+{
+    InsTime recvTime; ///< Receive time
+    double psr{};     ///< Pseudorange [m]
+};
+
+/// @brief Receivers of a continental network: receiver clock offsets of up to 1 ms and ranges differing by up to 3000 km
+/// @param[in] recvTime Receive time of the reference receiver
+/// @param[in] psr Pseudorange of the reference receiver [m]
+/// @param[in] nReceivers Amount of receivers
+std::vector<Reception> network(const InsTime& recvTime, double psr, size_t nReceivers)
+{
+    std::vector<Reception> receptions;
+    for (size_t r = 0; r < nReceivers; r++)
+    {
+        auto f = static_cast<double>(r) / static_cast<double>(std::max(nReceivers - 1, size_t(1)));
+        receptions.push_back({ .recvTime = recvTime + std::chrono::duration<double>(1e-3 * (2.0 * f - 1.0)),
+                               .psr = psr + 3e6 * f });
+    }
+    return receptions;
+}
+
+} // namespace
+
+TEST_CASE("[SatelliteEpochCache] Extrapolated states match the direct computation", "[SatelliteEpochCache]")
+{
+    auto logger = initializeTestLogger();
+
+    for (const auto& [satNavData, satSigId, recvTime] : std::vector<std::tuple<std::shared_ptr<SatNavData>, SatSigId, InsTime>>{
+             { gpsEphemeris(), SatSigId(Code::G1C, 1), InsTime(2023, 1, 8, 12, 10, 0, GPST) },
+             { gpsEphemeris(), SatSigId(Code::G2W, 1), InsTime(2023, 1, 8, 12, 10, 0, GPST) },
+             { glonassEphemeris(), SatSigId(Code::R1C, 5), InsTime(2023, 1, 8, 11, 55, 0, GPST) } })
+    {
+        auto receptions = network(recvTime, 2.25e7, 7);
+
+        SatelliteEpochCache cache;
+        cache.add(satNavData, satSigId, receptions.at(3).recvTime, receptions.at(3).psr);
+        REQUIRE(cache.nSatellites() == 1);
+        REQUIRE(cache.nSignals() == 1);
+
+        for (const auto& reception : receptions)
+        {
+            auto state = cache.get(satNavData.get(), satSigId, reception.recvTime, reception.psr);
+            REQUIRE(state.has_value());
+
+            auto satClk = satNavData->calcClockCorrections(reception.recvTime, reception.psr, satSigId.freq());
+            auto satPosVel = satNavData->calcSatellitePosVel(satClk.transmitTime);
+
+            REQUIRE_THAT(state->satClk.bias, Catch::Matchers::WithinAbs(satClk.bias, 1e-13));
+            REQUIRE_THAT(static_cast<double>((state->satClk.transmitTime - satClk.transmitTime).count()), Catch::Matchers::WithinAbs(0.0, 1e-13));
+            REQUIRE_THAT((state->satPosVel.e_pos - satPosVel.e_pos).norm(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+            REQUIRE_THAT((state->satPosVel.e_vel - satPosVel.e_vel).norm(), Catch::Matchers::WithinAbs(0.0, 1e-3));
+        }
+    }
+}
+
+TEST_CASE("[SatelliteEpochCache] States which can not be extrapolated", "[SatelliteEpochCache]")
+{
+    auto logger = initializeTestLogger();
+
+    auto eph = gpsEphemeris();
+    InsTime recvTime(2023, 1, 8, 12, 10, 0, GPST);
+    SatSigId satSigId(Code::G1C, 1);
+
+    SatelliteEpochCache cache(0.1);
+    cache.add(eph, satSigId, recvTime, 2.25e7);
+    cache.add(eph, satSigId, recvTime + std::chrono::seconds(1), 2.25e7); // The first receiver defines the reference state
+    REQUIRE(cache.nSignals() == 1);
+
+    REQUIRE(cache.get(eph.get(), satSigId, recvTime + std::chrono::milliseconds(50), 2.25e7).has_value());
+    REQUIRE(!cache.get(eph.get(), satSigId, recvTime + std::chrono::milliseconds(150), 2.25e7).has_value()); // Too far away
+    REQUIRE(!cache.get(eph.get(), SatSigId(Code::G2W, 1), recvTime, 2.25e7).has_value());                    // Signal not cached
+    REQUIRE(!cache.get(gpsEphemeris().get(), satSigId, recvTime, 2.25e7).has_value());                       // Other navigation data
+
+    cache.reset();
+    REQUIRE(cache.nSatellites() == 0);
+    REQUIRE(!cache.get(eph.get(), satSigId, recvTime, 2.25e7).has_value());
+}
+
+TEST_CASE("[SatelliteEpochCache] Satellite states for a network of receivers", "[SatelliteEpochCache][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    auto eph = gpsEphemeris();
+    SatSigId satSigId(Code::G1C, 1);
+    InsTime recvTime(2023, 1, 8, 12, 10, 0, GPST);
+
+    for (size_t nReceivers : { 1UL, 10UL, 100UL })
+    {
+        auto receptions = network(recvTime, 2.25e7, nReceivers);
+
+        BENCHMARK(fmt::format("Direct computation ({} receivers)", nReceivers))
+        {
+            double sum = 0.0;
+            for (const auto& reception : receptions)
+            {
+                auto satClk = eph->calcClockCorrections(reception.recvTime, reception.psr, satSigId.freq());
+                sum += satClk.bias + eph->calcSatellitePosVel(satClk.transmitTime).e_pos.x();
+            }
+            return sum;
+        };
+        BENCHMARK(fmt::format("Epoch cache ({} receivers)", nReceivers))
+        {
+            SatelliteEpochCache cache;
+            cache.add(eph, satSigId, receptions.front().recvTime, receptions.front().psr);
+            double sum = 0.0;
+            for (const auto& reception : receptions)
+            {
+                auto state = cache.get(eph.get(), satSigId, reception.recvTime, reception.psr);
+                sum += state->satClk.bias + state->satPosVel.e_pos.x();
+            }
+            return sum;
+        };
+    }
+}
+
+} // namespace NAV::TESTS::SatelliteEpochCacheTests
@@ -0,0 +1,183 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SppTests.cpp
+/// @brief Tests for the heap allocations of the Single Point Positioning (SPP) algorithm
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Positioning/SPP/Algorithm.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace
+{
+
+thread_local bool countAllocations = false; ///< Whether the calls to the global operator new of this thread are counted
+thread_local size_t allocations = 0;        ///< Amount of calls to the global operator new while counting
+
+} // namespace
+
+/// @brief Replaces the global operator new of the test executable, which counts the calls of this thread while the flag is set
+/// @param[in] size Size of the memory
+void* operator new(std::size_t size) // NOLINT(misc-new-delete-overloads)
+{
+    if (countAllocations) { allocations++; }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; } // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+    throw std::bad_alloc();
+}
+/// @brief Replaces the global operator delete matching the operator new above
+/// @param[in] ptr Pointer to the memory
+void operator delete(void* ptr) noexcept { std::free(ptr); } // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+/// @brief Replaces the global sized operator delete matching the operator new above
+/// @param[in] ptr Pointer to the memory
+void operator delete(void* ptr, std::size_t /* size */) noexcept { std::free(ptr); } // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+
+namespace NAV::TESTS::SppTests
+{
+
+namespace
+{
+
+/// @brief GPS broadcast ephemeris (BRDC_20230080000 of G01) with modified mean anomaly and longitude of the ascending node
+/// @param[in] M_0 Mean anomaly at reference time [rad]
+/// @param[in] Omega_0 Longitude of the ascending node at weekly epoch [rad]
+std::shared_ptr<GPSEphemeris> gpsEphemeris(double M_0, double Omega_0)
+{
+    return std::make_shared<GPSEphemeris>(2023, 1, 8, 12, 0, 0, 2.270475961268e-04, -4.774847184308e-12, 0.000000000000e+00,
+                                          1.800000000000e+01, 4.412500000000e+01, 4.154815921903e-09, M_0,
+                                          2.287328243256e-06, 1.217866723891e-02, 9.965151548386e-07, 5.153653379440e+03,
+                                          4.320000000000e+04, -6.891787052155e-08, Omega_0, 1.434236764908e-07,
+                                          9.889891589796e-01, 3.767500000000e+02, 9.377162063410e-01, -8.364991292606e-09,
+                                          1.185763677531e-10, 1.000000000000e+00, 2.244000000000e+03, 0.000000000000e+00,
+                                          2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 1.800000000000e+01,
+                                          3.601800000000e+04, 4.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+}
+
+/// @brief Simulates GPS L1 pseudorange and Doppler observations of a static receiver
+class Simulation
+{
+  public:
+    /// @brief Constructor (6 orbital planes with 4 satellites each)
+    Simulation()
+    {
+        for (uint16_t plane = 0; plane < 6; plane++)
+        {
+            for (uint16_t slot = 0; slot < 4; slot++)
+            {
+                auto satNum = static_cast<uint16_t>(plane * 4 + slot + 1);
+                auto eph = gpsEphemeris(0.1 + slot * M_PI_2 + plane * 0.5, -1.5 + plane * M_PI / 3.0);
+                navInfo.addSatelliteNavData(SatId(GPS, satNum), eph);
+                ephemerides.emplace_back(satNum, eph);
+            }
+        }
+        navInfo.ionosphericCorrections.insert(GPS, IonosphericCorrections::Alpha, { 2.0489e-08, 7.4506e-09, -1.1921e-07, 0.0 });
+        navInfo.ionosphericCorrections.insert(GPS, IonosphericCorrections::Beta, { 1.2698e+05, 0.0, -2.6214e+05, 1.9661e+05 });
+    }
+
+    /// @brief Observations of the receiver
+    /// @param[in] t Time since the start [s]
+    [[nodiscard]] std::shared_ptr<const GnssObs> observe(double t) const
+    {
+        InsTime recvTime = startTime + std::chrono::duration<double>(t + clockBias);
+
+        std::vector<GnssObs::ObservationData> data;
+        for (const auto& [satNum, eph] : ephemerides)
+        {
+            SatSigId satSigId(Code::G1C, satNum);
+
+            double range = 2e7;
+            double satClkBias = 0.0;
+            Eigen::Vector3d e_satPos;
+            Eigen::Vector3d e_satVel;
+            for (size_t i = 0; i < 5; i++) // Iterate the transmit time
+            {
+                auto satClk = eph->calcClockCorrections(recvTime, range + InsConst<>::C * (clockBias - satClkBias), satSigId.freq());
+                satClkBias = satClk.bias;
+                auto posVel = eph->calcSatellitePosVel(satClk.transmitTime);
+                e_satPos = posVel.e_pos;
+                e_satVel = posVel.e_vel;
+                range = (e_satPos - e_pos).norm() + calcSagnacCorrection(e_pos, e_satPos);
+            }
+            Eigen::Vector3d e_lineOfSight = e_calcLineOfSightUnitVector(e_pos, e_satPos);
+            if (calcSatElevation(trafo::n_Quat_e(lla_pos(0), lla_pos(1)) * e_lineOfSight) < deg2rad(5.0)) { continue; }
+
+            data.emplace_back(satSigId,
+                              GnssObs::ObservationData::Pseudorange{ .value = range + InsConst<>::C * (clockBias - satClkBias), .SSI = 0 },
+                              std::nullopt,
+                              -e_satVel.dot(e_lineOfSight) / (InsConst<>::C / satSigId.freq().getFrequency(-128)),
+                              45.0);
+        }
+        return std::make_shared<GnssObs>(recvTime, data, std::vector<GnssObs::SatelliteData>{});
+    }
+
+    GnssNavInfo navInfo;                                                       ///< Navigation data of the satellites
+    std::vector<std::pair<uint16_t, std::shared_ptr<GPSEphemeris>>> ephemerides; ///< Ephemerides with their satellite number
+    InsTime startTime{ 2023, 1, 8, 12, 10, 0, GPST };                          ///< Start time
+    double clockBias = 1e-4;                                                   ///< Receiver clock bias [s]
+    Eigen::Vector3d lla_pos{ deg2rad(48.78), deg2rad(9.18), 300.0 };           ///< Receiver position in latitude, longitude, altitude [rad, rad, m]
+    Eigen::Vector3d e_pos = trafo::lla2ecef_WGS84(lla_pos);                    ///< Receiver position in ECEF frame [m]
+};
+
+} // namespace
+
+TEST_CASE("[SPP] Steady-state epochs do not allocate", "[SPP]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation simulation;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &simulation.navInfo };
+
+    SPP::Algorithm algorithm;
+    algorithm._obsEstimator.initialize("SPP");
+    algorithm.reset();
+
+    std::string nameId = "SPP";
+    for (size_t epoch = 0; epoch < 20; epoch++)
+    {
+        auto gnssObs = simulation.observe(static_cast<double>(epoch));
+
+        // The first epochs are the warm-up, which allocates the buffers reused afterwards
+        bool counted = epoch >= 10;
+        auto logLevel = spdlog::default_logger()->level(); // Formatting log messages would allocate
+        if (counted) { spdlog::default_logger()->set_level(spdlog::level::warn); }
+
+        allocations = 0;
+        countAllocations = counted;
+        auto sppSol = algorithm.calcSppSolution(gnssObs, gnssNavInfos, nameId);
+        countAllocations = false;
+        size_t epochAllocations = allocations;
+
+        spdlog::default_logger()->set_level(logLevel);
+
+        CAPTURE(epoch);
+        REQUIRE(sppSol != nullptr);
+        REQUIRE_THAT((sppSol->e_position() - simulation.e_pos).norm(), Catch::Matchers::WithinAbs(0.0, 30.0));
+        REQUIRE(sppSol->e_CovarianceMatrix().has_value());
+        if (counted) { REQUIRE(epochAllocations == 0); }
+    }
+}
+
+} // namespace NAV::TESTS::SppTests
@@ -0,0 +1,267 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file TdcpTests.cpp
+/// @brief Tests for the Time-Differenced Carrier-Phase (TDCP) displacement estimation
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Functions.hpp"
+#include "Navigation/GNSS/Positioning/TDCP/Algorithm.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::TdcpTests
+{
+
+namespace
+{
+
+/// @brief GPS broadcast ephemeris (BRDC_20230080000 of G01) with modified mean anomaly and longitude of the ascending node
+/// @param[in] M_0 Mean anomaly at reference time [rad]
+/// @param[in] Omega_0 Longitude of the ascending node at weekly epoch [rad]
+std::shared_ptr<GPSEphemeris> gpsEphemeris(double M_0, double Omega_0)
+{
+    return std::make_shared<GPSEphemeris>(2023, 1, 8, 12, 0, 0, 2.270475961268e-04, -4.774847184308e-12, 0.000000000000e+00,
+                                          1.800000000000e+01, 4.412500000000e+01, 4.154815921903e-09, M_0,
+                                          2.287328243256e-06, 1.217866723891e-02, 9.965151548386e-07, 5.153653379440e+03,
+                                          4.320000000000e+04, -6.891787052155e-08, Omega_0, 1.434236764908e-07,
+                                          9.889891589796e-01, 3.767500000000e+02, 9.377162063410e-01, -8.364991292606e-09,
+                                          1.185763677531e-10, 1.000000000000e+00, 2.244000000000e+03, 0.000000000000e+00,
+                                          2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 1.800000000000e+01,
+                                          3.601800000000e+04, 4.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+}
+
+/// @brief Simulates error-free GPS L1/L2 observations of a moving receiver
+class Simulation
+{
+  public:
+    /// @brief Constructor (6 orbital planes with 4 satellites each)
+    Simulation()
+    {
+        for (uint16_t plane = 0; plane < 6; plane++)
+        {
+            for (uint16_t slot = 0; slot < 4; slot++)
+            {
+                uint16_t satNum = static_cast<uint16_t>(plane * 4 + slot + 1);
+                auto eph = gpsEphemeris(0.1 + slot * M_PI_2 + plane * 0.5, -1.5 + plane * M_PI / 3.0);
+                gnssNavInfo.addSatelliteNavData(SatId(GPS, satNum), eph);
+                ephemerides.emplace_back(satNum, eph);
+            }
+        }
+    }
+
+    /// @brief True receiver position [m]
+    /// @param[in] t Time since the start [s]
+    [[nodiscard]] Eigen::Vector3d e_position(double t) const
+    {
+        return e_startPosition + e_Quat_n * (n_velocity * t + 0.5 * n_acceleration * t * t);
+    }
+
+    /// @brief Receiver clock error [s]
+    /// @param[in] t Time since the start [s]
+    [[nodiscard]] static double recvClk(double t) { return 1e-4 + 1e-7 * t; }
+
+    /// @brief Simulates the observations
+    /// @param[in] t Time since the start [s]
+    [[nodiscard]] std::shared_ptr<GnssObs> observe(double t) const
+    {
+        InsTime recvTime = startTime + std::chrono::duration<double>(t + recvClk(t));
+        Eigen::Vector3d e_pos = e_position(t);
+
+        std::vector<GnssObs::ObservationData> data;
+        for (const auto& [satNum, eph] : ephemerides)
+        {
+            for (auto code : { Code(Code::G1C), Code(Code::G2W) })
+            {
+                SatSigId satSigId(code, satNum);
+                double rho = 2e7;
+                double satClkBias = 0.0;
+                Eigen::Vector3d e_satPos;
+                for (size_t i = 0; i < 5; i++)
+                {
+                    auto satClk = eph->calcClockCorrections(recvTime, rho + InsConst<>::C * (recvClk(t) - satClkBias), G01);
+                    satClkBias = satClk.bias;
+                    e_satPos = eph->calcSatellitePosVel(satClk.transmitTime).e_pos;
+                    rho = (e_satPos - e_pos).norm() + calcSagnacCorrection(e_pos, e_satPos);
+                }
+                double n_LOS_el = calcSatElevation(trafo::n_Quat_e(lla_startPosition(0), lla_startPosition(1)) * e_calcLineOfSightUnitVector(e_pos, e_satPos));
+                if (n_LOS_el < deg2rad(5.0)) { continue; }
+
+                double psr = rho + InsConst<>::C * (recvClk(t) - satClkBias);
+                double lambda = InsConst<>::C / satSigId.freq().getFrequency(-128);
+                double ambiguity = 1000.0 * satNum + (code == Code::G1C ? 0.0 : 500.0);
+                data.emplace_back(satSigId, GnssObs::ObservationData::Pseudorange{ .value = psr, .SSI = 0 },
+                                  GnssObs::ObservationData::CarrierPhase{ .value = psr / lambda + ambiguity, .SSI = 0, .LLI = 0 },
+                                  std::nullopt, std::nullopt);
+            }
+        }
+        return std::make_shared<GnssObs>(recvTime, data, std::vector<GnssObs::SatelliteData>{});
+    }
+
+    GnssNavInfo gnssNavInfo;                                                    ///< Navigation data of all satellites
+    std::vector<std::pair<uint16_t, std::shared_ptr<GPSEphemeris>>> ephemerides; ///< Ephemerides of all satellites
+    InsTime startTime{ 2023, 1, 8, 12, 10, 0, GPST };                           ///< Time of the first epoch
+    Eigen::Vector3d lla_startPosition{ deg2rad(48.78), deg2rad(9.18), 300.0 };  ///< Start position (latitude, longitude, altitude)
+    Eigen::Vector3d e_startPosition = trafo::lla2ecef_WGS84(lla_startPosition); ///< Start position in ECEF [m]
+    Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(lla_startPosition(0), lla_startPosition(1)); ///< Rotation to the start position
+    Eigen::Vector3d n_velocity{ 15.0, -5.0, 0.2 };                              ///< Initial velocity in NED [m/s]
+    Eigen::Vector3d n_acceleration{ 0.5, 1.0, -0.1 };                           ///< Acceleration in NED [m/s²]
+};
+
+} // namespace
+
+TEST_CASE("[TDCP] Displacement and velocity of a moving receiver at 20 Hz", "[TDCP]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+    Eigen::Vector3d e_approxError(3.0, -2.0, 4.0); // Error of the approximate (SPP) position in the first epoch
+
+    TDCP::Algorithm algorithm;
+    REQUIRE(!algorithm.calcDisplacement(*sim.observe(0.0), gnssNavInfos, sim.e_position(0.0) + e_approxError, "TDCP").has_value());
+    REQUIRE(algorithm.hasReference());
+
+    constexpr double DT = 0.05;
+    Eigen::Vector3d e_position = sim.e_position(0.0) + e_approxError;
+    for (size_t k = 1; k <= 40; k++)
+    {
+        double t = static_cast<double>(k) * DT;
+        auto result = algorithm.calcDisplacement(*sim.observe(t), gnssNavInfos, e_position, "TDCP");
+        REQUIRE(result.has_value());
+
+        Eigen::Vector3d e_displacement = sim.e_position(t) - sim.e_position(t - DT);
+        INFO(fmt::format("t = {} s, displacement error {} [m], {} signals", t, (result->e_displacement - e_displacement).transpose(), result->nSignals));
+        REQUIRE(result->nSignals >= 8);
+        REQUIRE(result->nSignals == 2 * result->nSatellites);
+        REQUIRE_THAT(result->dt, Catch::Matchers::WithinAbs(DT, 1e-8)); // Receiver time tags include the clock drift
+        REQUIRE_THAT((result->e_displacement - e_displacement).norm(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+        REQUIRE_THAT((result->e_velocity() - e_displacement / DT).norm(), Catch::Matchers::WithinAbs(0.0, 2e-3));
+        REQUIRE_THAT(result->recvClkChange, Catch::Matchers::WithinAbs(InsConst<>::C * 1e-7 * DT, 1e-3));
+        REQUIRE(result->e_displacementCovariance.diagonal().cwiseSqrt().maxCoeff() < 0.05);
+        REQUIRE(result->cycleSlips.empty());
+        REQUIRE(result->outliers.empty());
+
+        // The absolute position keeps the error of the first approximate position, which also slightly affects the line-of-sight
+        REQUIRE_THAT((result->e_position - (sim.e_position(t) + e_approxError)).norm(), Catch::Matchers::WithinAbs(0.0, 2e-3));
+        e_position = result->e_position + result->e_velocity() * DT;
+    }
+}
+
+TEST_CASE("[TDCP] Signals with cycle-slips are excluded", "[TDCP]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+
+    TDCP::Algorithm algorithm;
+    constexpr double DT = 0.05;
+    for (size_t k = 0; k <= 20; k++)
+    {
+        double t = static_cast<double>(k) * DT;
+        auto gnssObs = sim.observe(t);
+        auto nSignals = gnssObs->data.size();
+        REQUIRE(nSignals >= 10);
+
+        SatSigId slipped = gnssObs->data.at(2).satSigId;
+        if (k >= 5) { gnssObs->data.at(2).carrierPhase->value += 7.0; } // Slip of 7 cycles in epoch 5, which persists
+        if (k == 5) { gnssObs->data.at(2).carrierPhase->LLI = 1; }
+        if (k >= 12) { gnssObs->data.at(4).carrierPhase->value -= 0.5; } // Half cycle slip in epoch 12 without LLI
+
+        auto result = algorithm.calcDisplacement(*gnssObs, gnssNavInfos, sim.e_position(t), "TDCP");
+        if (k == 0)
+        {
+            REQUIRE(!result.has_value());
+            continue;
+        }
+        REQUIRE(result.has_value());
+
+        Eigen::Vector3d e_displacement = sim.e_position(t) - sim.e_position(t - DT);
+        INFO(fmt::format("k = {}, displacement error {} [m], {} signals", k, (result->e_displacement - e_displacement).transpose(), result->nSignals));
+        REQUIRE_THAT((result->e_displacement - e_displacement).norm(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+
+        if (k == 5)
+        {
+            REQUIRE(std::find(result->cycleSlips.begin(), result->cycleSlips.end(), slipped) != result->cycleSlips.end());
+            REQUIRE(result->nSignals < nSignals);
+        }
+        else if (k == 12)
+        {
+            SatSigId halfSlip = gnssObs->data.at(4).satSigId;
+            bool excluded = std::find(result->cycleSlips.begin(), result->cycleSlips.end(), halfSlip) != result->cycleSlips.end()
+                            || std::find(result->outliers.begin(), result->outliers.end(), halfSlip) != result->outliers.end();
+            REQUIRE(excluded);
+            REQUIRE(result->nSignals < nSignals);
+        }
+        else
+        {
+            // The slipped phase became the new reference, so the signal is used again in the following epochs
+            REQUIRE(result->nSignals == nSignals);
+        }
+    }
+}
+
+TEST_CASE("[TDCP] Gaps start with a new reference epoch", "[TDCP]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+
+    TDCP::Algorithm algorithm;
+    REQUIRE(!algorithm.calcDisplacement(*sim.observe(0.0), gnssNavInfos, sim.e_position(0.0), "TDCP").has_value());
+    REQUIRE(algorithm.calcDisplacement(*sim.observe(1.0), gnssNavInfos, sim.e_position(1.0), "TDCP").has_value());
+    REQUIRE(!algorithm.calcDisplacement(*sim.observe(5.0), gnssNavInfos, sim.e_position(5.0), "TDCP").has_value());
+
+    auto result = algorithm.calcDisplacement(*sim.observe(5.5), gnssNavInfos, sim.e_position(5.5), "TDCP");
+    REQUIRE(result.has_value());
+    REQUIRE_THAT((result->e_displacement - (sim.e_position(5.5) - sim.e_position(5.0))).norm(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+
+    algorithm.reset();
+    REQUIRE(!algorithm.hasReference());
+    REQUIRE(!algorithm.calcDisplacement(*sim.observe(6.0), gnssNavInfos, sim.e_position(6.0), "TDCP").has_value());
+}
+
+TEST_CASE("[TDCP] Displacement estimation of an epoch", "[TDCP][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    Simulation sim;
+    std::vector<const GnssNavInfo*> gnssNavInfos{ &sim.gnssNavInfo };
+    std::vector<std::shared_ptr<GnssObs>> epochs;
+    for (size_t k = 0; k < 21; k++) { epochs.push_back(sim.observe(static_cast<double>(k) * 0.05)); }
+
+    BENCHMARK("20 epochs at 20 Hz")
+    {
+        TDCP::Algorithm algorithm;
+        double sum = 0.0;
+        for (size_t k = 0; k < epochs.size(); k++)
+        {
+            if (auto result = algorithm.calcDisplacement(*epochs.at(k), gnssNavInfos, sim.e_position(static_cast<double>(k) * 0.05), "TDCP"))
+            {
+                sum += result->e_displacement.x();
+            }
+        }
+        return sum;
+    };
+}
+
+} // namespace NAV::TESTS::TdcpTests
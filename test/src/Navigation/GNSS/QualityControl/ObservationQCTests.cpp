@@ -0,0 +1,197 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ObservationQCTests.cpp
+/// @brief Tests for the quality control of GNSS observations
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <vector>
+
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/QualityControl/ObservationQC.hpp"
+#include "internal/ObservationQCBatch.hpp"
+#include "Nodes/DataProvider/GNSS/FileReader/RinexObsFile.hpp"
+
+namespace NAV::TESTS::ObservationQCTests
+{
+namespace
+{
+
+/// @brief Finds the report of a signal
+const ObservationQC::SignalReport& signalReport(const ObservationQC::Report& report, const SatSigId& satSigId)
+{
+    auto sat = std::find_if(report.satellites.begin(), report.satellites.end(), [&](const auto& s) { return s.satId == satSigId.toSatId(); });
+    REQUIRE(sat != report.satellites.end());
+    auto signal = std::find_if(sat->signals.begin(), sat->signals.end(), [&](const auto& s) { return s.code == satSigId.code; });
+    REQUIRE(signal != sat->signals.end());
+    return *signal;
+}
+
+} // namespace
+
+TEST_CASE("[ObservationQC] Multipath, cycle-slips, gaps and clock jumps of simulated observations", "[ObservationQC]")
+{
+    auto logger = initializeTestLogger();
+
+    constexpr double f1 = 1575.42e6;
+    constexpr double f2 = 1227.6e6;
+    constexpr double lambda1 = InsConst<>::C / f1;
+    constexpr double lambda2 = InsConst<>::C / f2;
+    constexpr double gamma = (f1 / f2) * (f1 / f2);
+
+    ObservationQC qc;
+    for (size_t k = 0; k < 100; k++)
+    {
+        if (k == 80 || k == 81) { continue; } // Gap
+
+        auto t = static_cast<double>(k);
+        double sign = k % 2 == 0 ? 1.0 : -1.0;
+        double clock = k >= 70 ? 1e-3 * InsConst<>::C : 0.0; // Millisecond jump of the receiver clock in the code
+        std::vector<GnssObs::ObservationData> data;
+        for (uint16_t satNum = 1; satNum <= 2; satNum++)
+        {
+            double range = 2e7 + 1e3 * satNum + 100.0 * t;
+            double iono = 5.0 + 0.01 * t;
+            uint8_t LLI = satNum == 1 && k == 50 ? 1 : 0;
+            data.emplace_back(SatSigId(Code::G1C, satNum),
+                              GnssObs::ObservationData::Pseudorange{ .value = range + iono + clock + 0.5 * sign, .SSI = 0 },
+                              GnssObs::ObservationData::CarrierPhase{ .value = (range - iono) / lambda1 + 1000.0, .SSI = 0, .LLI = LLI },
+                              std::nullopt, 45.0);
+            if (satNum == 2) { continue; } // Single frequency
+            data.emplace_back(SatSigId(Code::G2W, satNum),
+                              GnssObs::ObservationData::Pseudorange{ .value = range + gamma * iono + clock + 0.3 * sign, .SSI = 0 },
+                              GnssObs::ObservationData::CarrierPhase{ .value = (range - gamma * iono) / lambda2 - 500.0, .SSI = 0, .LLI = 0 },
+                              std::nullopt, k % 2 == 0 ? 40.0 : 42.0);
+        }
+        qc.addEpoch(GnssObs(InsTime(2, 230, t), data, {}));
+    }
+
+    auto report = qc.report();
+    REQUIRE(report.epochs == 98);
+    REQUIRE(report.expectedEpochs == 100);
+    REQUIRE(report.interval == 1.0);
+    REQUIRE(report.gaps == 1);
+    REQUIRE_THAT(report.completeness, Catch::Matchers::WithinAbs(0.98, 1e-12));
+
+    REQUIRE(report.cycleSlips == 1);
+    REQUIRE(signalReport(report, SatSigId(Code::G1C, 1)).cycleSlips == 1);
+
+    REQUIRE(report.clockJumps.size() == 1);
+    REQUIRE(report.clockJumps.front().insTime == InsTime(2, 230, 70.0));
+    REQUIRE_THAT(report.clockJumps.front().jump, Catch::Matchers::WithinAbs(1e-3, 1e-8));
+
+    // Arcs are split at the cycle-slip, the clock jump and the gap
+    const auto& g1c = signalReport(report, SatSigId(Code::G1C, 1));
+    REQUIRE(g1c.multipathEpochs == 98);
+    REQUIRE(g1c.multipathRMS.has_value());
+    REQUIRE_THAT(*g1c.multipathRMS, Catch::Matchers::WithinAbs(0.5, 1e-4));
+    const auto& g2w = signalReport(report, SatSigId(Code::G2W, 1));
+    REQUIRE(g2w.multipathRMS.has_value());
+    REQUIRE_THAT(*g2w.multipathRMS, Catch::Matchers::WithinAbs(0.3, 1e-4));
+    REQUIRE(!signalReport(report, SatSigId(Code::G1C, 2)).multipathRMS.has_value());
+
+    REQUIRE(g2w.CN0.count == 98);
+    REQUIRE(g2w.CN0.min == 40.0);
+    REQUIRE(g2w.CN0.max == 42.0);
+    REQUIRE_THAT(g2w.CN0.mean, Catch::Matchers::WithinAbs(41.0, 1e-12));
+    REQUIRE(g2w.completeness == 1.0);
+
+    json j = report;
+    REQUIRE(j.at("satellites").size() == 2);
+    REQUIRE(j.at("satellites").at(0).at("satellite") == "G01");
+    REQUIRE(j.at("multipath").contains("G2W"));
+}
+
+TEST_CASE("[ObservationQC] Parallel quality control of observation files", "[ObservationQC]")
+{
+    auto logger = initializeTestLogger();
+
+    std::vector<std::filesystem::path> paths = {
+        "test/data/GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Iono-none_tropo-none/Spirent_RINEX_MO.obs",
+        "test/data/GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Iono-none_tropo-none/Septentrio-PolaRx5T.obs",
+        "test/data/GNSS/Skydel_static_duration-4h_rate-5min_sys-GERCQIS/Iono-none_tropo-none/SkydelRINEX_S_20230080000_04H_MO.rnx",
+        "test/data/GNSS/does-not-exist.obs",
+    };
+
+    std::vector<ObservationQC::Report> reports(paths.size());
+    size_t calls = 0;
+    ObservationQCBatch::Settings settings;
+    settings.threads = 2;
+    ObservationQCBatch::analyzeFiles(paths, settings, [&](size_t index, const ObservationQC::Report& report) {
+        calls++;
+        reports.at(index) = report;
+    });
+    REQUIRE(calls == paths.size());
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        REQUIRE(reports.at(i).file == paths.at(i).string());
+        REQUIRE(reports.at(i).error.empty());
+        REQUIRE(reports.at(i).epochs == 49);
+        REQUIRE(reports.at(i).interval == 300.0);
+        REQUIRE(reports.at(i).completeness == 1.0);
+        REQUIRE(!reports.at(i).satellites.empty());
+
+        // Same result as reading the file alone
+        auto single = ObservationQCBatch::analyzeFile(paths.at(i));
+        REQUIRE(json(single) == json(reports.at(i)));
+    }
+    REQUIRE(!reports.back().error.empty());
+
+    auto files = ObservationQCBatch::collectFiles({ "test/data/GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI" });
+    REQUIRE(std::find(files.begin(), files.end(), paths.at(0)) != files.end());
+}
+
+TEST_CASE("[ObservationQC] Reuse of the parser for files with different headers", "[ObservationQC]")
+{
+    auto logger = initializeTestLogger();
+
+    std::filesystem::path first = "test/data/GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Iono-none_tropo-none/Septentrio-PolaRx5T.obs";
+    std::filesystem::path second = "test/data/GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Iono-none_tropo-none/Spirent_RINEX_MO.obs";
+
+    auto readAll = [](RinexObsFile& reader, const std::filesystem::path& path) {
+        REQUIRE(reader.openFile(std::filesystem::absolute(path)));
+        std::vector<std::shared_ptr<GnssObs>> epochs;
+        while (auto gnssObs = reader.readEpoch()) { epochs.push_back(gnssObs); }
+        return epochs;
+    };
+
+    RinexObsFile freshReader;
+    auto expected = readAll(freshReader, second);
+    REQUIRE(!expected.empty());
+
+    RinexObsFile reader;
+    REQUIRE(!readAll(reader, first).empty());
+    auto epochs = readAll(reader, second);
+
+    REQUIRE(epochs.size() == expected.size());
+    for (size_t i = 0; i < epochs.size(); i++)
+    {
+        REQUIRE(epochs.at(i)->insTime == expected.at(i)->insTime);
+        REQUIRE(epochs.at(i)->data.size() == expected.at(i)->data.size());
+        for (size_t s = 0; s < epochs.at(i)->data.size(); s++)
+        {
+            const auto& obsData = epochs.at(i)->data.at(s);
+            const auto& expectedData = expected.at(i)->data.at(s);
+            REQUIRE(obsData.satSigId == expectedData.satSigId);
+            REQUIRE(obsData.pseudorange.has_value() == expectedData.pseudorange.has_value());
+            if (obsData.pseudorange) { REQUIRE(obsData.pseudorange->value == expectedData.pseudorange->value); }
+            REQUIRE(obsData.carrierPhase.has_value() == expectedData.carrierPhase.has_value());
+            if (obsData.carrierPhase) { REQUIRE(obsData.carrierPhase->value == expectedData.carrierPhase->value); }
+        }
+    }
+}
+
+} // namespace NAV::TESTS::ObservationQCTests
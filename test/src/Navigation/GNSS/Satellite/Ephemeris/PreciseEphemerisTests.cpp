@@ -0,0 +1,144 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file PreciseEphemerisTests.cpp
+/// @brief Tests for the interpolation of precise orbit and clock products
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/PreciseEphemeris.hpp"
+
+namespace NAV::TESTS::PreciseEphemerisTests
+{
+namespace
+{
+
+/// @brief Reads the orbit and clock of a satellite from a SP3 file
+/// @param[in] satId Satellite to read
+/// @param[in] filepath Path of the SP3 file
+std::pair<std::vector<PreciseEphemeris::OrbitRecord>, std::vector<PreciseEphemeris::ClockRecord>> readSp3(const SatId& satId, const std::string& filepath)
+{
+    std::ifstream fs{ filepath, std::ios_base::binary };
+    REQUIRE(fs.good());
+
+    std::vector<PreciseEphemeris::OrbitRecord> orbit;
+    std::vector<PreciseEphemeris::ClockRecord> clock;
+    InsTime epoch;
+    std::string line;
+    while (std::getline(fs, line) && !line.starts_with("EOF"))
+    {
+        if (line.starts_with("* ")) // *  2023  1  8  0  0  0.00000000
+        {
+            epoch = InsTime{ std::stoi(line.substr(3, 4)), std::stoi(line.substr(8, 2)), std::stoi(line.substr(11, 2)),
+                             std::stoi(line.substr(14, 2)), std::stoi(line.substr(17, 2)), std::stold(line.substr(20)), GPST };
+        }
+        else if (line.starts_with('P')
+                 && SatId(SatelliteSystem::fromChar(line[1]), static_cast<uint16_t>(std::stoul(line.substr(2, 2)))) == satId)
+        {
+            orbit.push_back({ .epoch = epoch, .e_pos = 1e3 * Eigen::Vector3d(std::stod(line.substr(4, 14)), std::stod(line.substr(18, 14)), std::stod(line.substr(32, 14))) });
+            clock.push_back({ .epoch = epoch, .bias = std::stod(line.substr(46, 14)) * 1e-6 });
+        }
+    }
+    return { orbit, clock };
+}
+
+} // namespace
+
+TEST_CASE("[PreciseEphemeris] Interpolation of held-out SP3 epochs (COD0OPSFIN_20230080000_01D_05M_ORB.SP3)", "[Ephemeris]")
+{
+    auto logger = initializeTestLogger();
+
+    for (const auto& satId : { SatId(GPS, 1), SatId(GAL, 1), SatId(GLO, 1) })
+    {
+        LOG_TRACE("{}", satId);
+        auto [orbit, clock] = readSp3(satId, "test/data/GNSS/BRDC_20230080000/COD0OPSFIN_20230080000_01D_05M_ORB.SP3");
+        REQUIRE(orbit.size() == 289);
+
+        // Every second epoch is used to interpolate the other epochs
+        std::vector<PreciseEphemeris::OrbitRecord> orbitEven;
+        std::vector<PreciseEphemeris::ClockRecord> clockEven;
+        for (size_t i = 0; i < orbit.size(); i += 2)
+        {
+            orbitEven.push_back(orbit.at(i));
+            clockEven.push_back(clock.at(i));
+        }
+        PreciseEphemeris eph(orbitEven, clockEven, 0.02);
+        REQUIRE(eph.type == SatNavData::PreciseEphemeris);
+        REQUIRE(eph.firstEpoch() == orbit.front().epoch);
+        REQUIRE(eph.lastEpoch() == orbit.back().epoch);
+        REQUIRE_THAT(eph.calcSatellitePositionVariance(), Catch::Matchers::WithinAbs(4e-4, 1e-12));
+
+        for (size_t i = 1; i < orbit.size(); i += 2)
+        {
+            const auto& epoch = orbit.at(i).epoch;
+            REQUIRE(eph.isAvailable(epoch));
+
+            auto posVel = eph.calcSatellitePosVel(epoch);
+            REQUIRE_THAT((posVel.e_pos - orbit.at(i).e_pos).norm(), Catch::Matchers::WithinAbs(0.0, 0.05));
+
+            // The interpolated clock contains the relativistic correction
+            auto satClk = eph.calcClockCorrections(epoch, 0.0, G01);
+            double dt_r = -2.0 * posVel.e_pos.dot(posVel.e_vel) / std::pow(InsConst<>::C, 2);
+            REQUIRE_THAT(satClk.bias - dt_r - clock.at(i).bias, Catch::Matchers::WithinAbs(0.0, 1e-9));
+            REQUIRE_THAT(static_cast<double>((epoch - satClk.transmitTime).count()) - satClk.bias, Catch::Matchers::WithinAbs(0.0, 1e-12));
+
+            // Velocity and acceleration are the derivatives of the interpolated position
+            constexpr double dt = 0.5;
+            auto posVelAccel = eph.calcSatellitePosVelAccel(epoch);
+            auto posBefore = eph.calcSatellitePos(epoch - std::chrono::duration<double>(dt)).e_pos;
+            auto posAfter = eph.calcSatellitePos(epoch + std::chrono::duration<double>(dt)).e_pos;
+            REQUIRE_THAT((posVelAccel.e_vel - (posAfter - posBefore) / (2.0 * dt)).norm(), Catch::Matchers::WithinAbs(0.0, 1e-5));
+            REQUIRE_THAT((posVelAccel.e_accel - (posAfter - 2.0 * posVelAccel.e_pos + posBefore) / (dt * dt)).norm(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+            REQUIRE_THAT((posVelAccel.e_pos - posVel.e_pos).norm(), Catch::Matchers::WithinAbs(0.0, 1e-9));
+        }
+
+        // The product epochs are reproduced
+        PreciseEphemeris ephAll(orbit, clock, 0.02);
+        for (size_t i = 0; i < orbit.size(); i++)
+        {
+            REQUIRE_THAT((ephAll.calcSatellitePos(orbit.at(i).epoch).e_pos - orbit.at(i).e_pos).norm(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+        }
+
+        REQUIRE(!eph.isAvailable(orbit.front().epoch - std::chrono::duration<double>(60.0)));
+        REQUIRE(!eph.isAvailable(orbit.back().epoch + std::chrono::duration<double>(60.0)));
+    }
+}
+
+TEST_CASE("[PreciseEphemeris] Data gaps are not bridged", "[Ephemeris]")
+{
+    auto logger = initializeTestLogger();
+
+    auto [orbit, clock] = readSp3(SatId(GPS, 2), "test/data/GNSS/BRDC_20230080000/COD0OPSFIN_20230080000_01D_05M_ORB.SP3");
+    REQUIRE(orbit.size() == 289);
+
+    // Gap of 30 minutes in the clocks
+    auto clockGap = clock;
+    clockGap.erase(clockGap.begin() + 100, clockGap.begin() + 105);
+    PreciseEphemeris eph(orbit, clockGap, 0.02);
+
+    REQUIRE(eph.isAvailable(orbit.at(99).epoch));
+    REQUIRE(!eph.isAvailable(orbit.at(102).epoch));
+    REQUIRE(eph.isAvailable(orbit.at(106).epoch));
+
+    PreciseEphemeris noClock(orbit, {}, 0.02);
+    REQUIRE(!noClock.isAvailable(orbit.at(100).epoch));
+}
+
+} // namespace NAV::TESTS::PreciseEphemerisTests
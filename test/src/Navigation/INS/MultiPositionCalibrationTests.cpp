@@ -0,0 +1,237 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file MultiPositionCalibrationTests.cpp
+/// @brief Tests for the multi-position IMU calibration
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <Eigen/Geometry>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/INS/MultiPositionCalibration.hpp"
+#include "util/Random/RandomNumberGenerator.hpp"
+
+namespace NAV::TESTS::MultiPositionCalibrationTests
+{
+namespace
+{
+
+/// @brief Raw IMU sample
+struct Sample
+{
+    double time = 0.0;     ///< Time [s]
+    Eigen::Vector3d accel; ///< Raw accelerometer measurement [m/s^2]
+    Eigen::Vector3d gyro;  ///< Raw gyroscope measurement [rad/s]
+};
+
+/// Latitude of the simulated tumble test [rad]
+constexpr double LATITUDE = 48.78 * std::numbers::pi / 180.0;
+
+/// @brief Sensor errors of the simulated IMU
+ImuCalibrationParameters trueParameters()
+{
+    ImuCalibrationParameters params;
+    params.accelScaleMisalignment << 1.002, 0.001, -0.002,
+        0.0, 0.998, 0.0015,
+        0.0, 0.0, 1.003;
+    params.accelBias << 0.05, -0.03, 0.08;
+    params.gyroScaleMisalignment << 1.01, 0.002, -0.003,
+        -0.001, 0.99, 0.004,
+        0.002, -0.002, 1.005;
+    params.gyroBias << 2e-3, -1e-3, 1.5e-3;
+    return params;
+}
+
+/// @brief Simulates a tumble test with an initial static period and rotations about random axes in between static positions
+/// @param[in] rate Sample rate [Hz]
+/// @param[in] positions Amount of positions after the initial one
+/// @param[in] rng Random number generator
+/// @return Raw samples
+std::vector<Sample> simulateTumble(double rate, size_t positions, RandomNumberGenerator& rng)
+{
+    constexpr double initialStaticTime = 40.0;
+    constexpr double staticTime = 5.0;
+    constexpr double motionTime = 2.0;
+    constexpr double gravity = 9.81;
+    constexpr double accelNoise = 5e-3;
+    constexpr double gyroNoise = 5e-4;
+
+    auto params = trueParameters();
+    Eigen::Matrix3d accelInverse = params.accelScaleMisalignment.inverse();
+    Eigen::Matrix3d gyroInverse = params.gyroScaleMisalignment.inverse();
+
+    const Eigen::Vector3d n_gravity(0.0, 0.0, gravity); // ENU
+    const Eigen::Vector3d n_omega_ie(0.0, InsConst<>::omega_ie * std::cos(LATITUDE), InsConst<>::omega_ie * std::sin(LATITUDE));
+
+    std::vector<Sample> samples;
+    double dt = 1.0 / rate;
+    Eigen::Matrix3d n_Dcm_b = Eigen::Matrix3d::Identity();
+    auto addSample = [&](double time, const Eigen::Vector3d& b_omega) {
+        Eigen::Vector3d b_accel = n_Dcm_b.transpose() * n_gravity;
+        Eigen::Vector3d b_gyro = b_omega + n_Dcm_b.transpose() * n_omega_ie;
+        Sample sample{ .time = time, .accel = accelInverse * b_accel + params.accelBias, .gyro = gyroInverse * b_gyro + params.gyroBias };
+        for (Eigen::Index i = 0; i < 3; i++)
+        {
+            sample.accel(i) += rng.getRand_normalDist(0.0, accelNoise);
+            sample.gyro(i) += rng.getRand_normalDist(0.0, gyroNoise);
+        }
+        samples.push_back(sample);
+    };
+
+    double time = 0.0;
+    for (; time < initialStaticTime; time += dt) { addSample(time, Eigen::Vector3d::Zero()); }
+    for (size_t p = 0; p < positions; p++)
+    {
+        Eigen::Vector3d axis(rng.getRand_normalDist(0.0, 1.0), rng.getRand_normalDist(0.0, 1.0), rng.getRand_normalDist(0.0, 1.0));
+        axis.normalize();
+        double angle = rng.getRand_uniformRealDist(60.0, 150.0) * std::numbers::pi / 180.0;
+
+        // Smooth rotation about a body fixed axis, starting and ending at rest
+        Eigen::Matrix3d n_Dcm_b0 = n_Dcm_b;
+        double start = time;
+        for (; time < start + motionTime; time += dt)
+        {
+            double s = (time - start) / motionTime;
+            double theta = angle * (s - std::sin(2.0 * std::numbers::pi * s) / (2.0 * std::numbers::pi));
+            double thetaDot = angle / motionTime * (1.0 - std::cos(2.0 * std::numbers::pi * s));
+            n_Dcm_b = n_Dcm_b0 * Eigen::AngleAxisd(theta, axis).toRotationMatrix();
+            addSample(time, axis * thetaDot);
+        }
+        n_Dcm_b = n_Dcm_b0 * Eigen::AngleAxisd(angle, axis).toRotationMatrix();
+
+        start = time;
+        for (; time < start + staticTime; time += dt) { addSample(time, Eigen::Vector3d::Zero()); }
+    }
+
+    return samples;
+}
+
+/// @brief Options matching the simulated tumble test
+MultiPositionCalibration::Options tumbleOptions()
+{
+    MultiPositionCalibration::Options options;
+    options.initialStaticTime = 30.0;
+    options.gravity = 9.81;
+    options.latitude = LATITUDE;
+    return options;
+}
+
+} // namespace
+
+TEST_CASE("[MultiPositionCalibration] Static intervals are detected in a tumble test", "[MultiPositionCalibration]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 1;
+    rng.resetSeed();
+    auto samples = simulateTumble(200.0, 30, rng);
+
+    MultiPositionCalibration calibration(tumbleOptions());
+    for (const auto& sample : samples) { calibration.addSample(sample.time, sample.accel, sample.gyro); }
+    REQUIRE(calibration.sampleCount() == samples.size());
+
+    // Initial period and one interval per position
+    const auto& intervals = calibration.staticIntervals();
+    REQUIRE(intervals.size() == 31);
+    REQUIRE(intervals.front().endTime - intervals.front().startTime > 35.0);
+    for (size_t i = 1; i < intervals.size(); i++)
+    {
+        // 5 s of rest shortened by the detection window at both ends
+        double duration = intervals.at(i).endTime - intervals.at(i).startTime;
+        REQUIRE(duration > 2.5);
+        REQUIRE(duration < 5.0);
+        REQUIRE_THAT(intervals.at(i).accel.norm(), Catch::Matchers::WithinAbs(9.81, 0.2));
+    }
+}
+
+TEST_CASE("[MultiPositionCalibration] Scale factors, misalignments and biases are recovered", "[MultiPositionCalibration]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 2;
+    rng.resetSeed();
+    auto samples = simulateTumble(200.0, 30, rng);
+
+    MultiPositionCalibration calibration(tumbleOptions());
+    for (const auto& sample : samples) { calibration.addSample(sample.time, sample.accel, sample.gyro); }
+
+    auto result = calibration.solve();
+    REQUIRE(result.has_value());
+    REQUIRE(result->staticIntervals == 31);
+    REQUIRE(result->motions == 30);
+    REQUIRE(result->accelResidualRms < 2e-3);
+    REQUIRE(result->gyroResidualRms < 1e-3);
+
+    auto truth = trueParameters();
+    const auto& params = result->parameters;
+    LOG_DEBUG("Accelerometer matrix error\n{}", params.accelScaleMisalignment - truth.accelScaleMisalignment);
+    LOG_DEBUG("Gyroscope matrix error\n{}", params.gyroScaleMisalignment - truth.gyroScaleMisalignment);
+    REQUIRE((params.accelScaleMisalignment - truth.accelScaleMisalignment).cwiseAbs().maxCoeff() < 3e-4);
+    REQUIRE((params.accelBias - truth.accelBias).cwiseAbs().maxCoeff() < 3e-3);
+    REQUIRE((params.gyroScaleMisalignment - truth.gyroScaleMisalignment).cwiseAbs().maxCoeff() < 5e-4);
+    // The horizontal Earth rotation (about 5e-5 rad/s here) is separated from the gyroscope bias
+    REQUIRE((params.gyroBias - truth.gyroBias).cwiseAbs().maxCoeff() < 8e-6);
+
+    // Calibrated measurements of a static interval match gravity and the Earth rotation
+    const auto& interval = calibration.staticIntervals().at(10);
+    REQUIRE_THAT(params.calibrateAccel(interval.accel).norm(), Catch::Matchers::WithinAbs(9.81, 2e-3));
+    REQUIRE(params.calibrateGyro(interval.gyro).norm() < 1.5e-4);
+    REQUIRE_THAT(params.calibrateGyro(calibration.staticIntervals().front().gyro).norm(), Catch::Matchers::WithinAbs(InsConst<>::omega_ie, 1.5e-5));
+
+    // Round trip through json
+    json j = params;
+    auto restored = j.get<ImuCalibrationParameters>();
+    REQUIRE(restored.accelScaleMisalignment == params.accelScaleMisalignment);
+    REQUIRE(restored.gyroBias == params.gyroBias);
+}
+
+TEST_CASE("[MultiPositionCalibration] Too few positions are rejected", "[MultiPositionCalibration]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 3;
+    rng.resetSeed();
+    auto samples = simulateTumble(100.0, 5, rng);
+
+    MultiPositionCalibration calibration(tumbleOptions());
+    for (const auto& sample : samples) { calibration.addSample(sample.time, sample.accel, sample.gyro); }
+    REQUIRE(calibration.staticIntervals().size() == 6);
+    REQUIRE(!calibration.solve().has_value());
+}
+
+TEST_CASE("[MultiPositionCalibration] Benchmark", "[.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 4;
+    rng.resetSeed();
+    auto samples = simulateTumble(1000.0, 40, rng);
+    LOG_INFO("Calibrating from {} samples at 1 kHz", samples.size());
+
+    BENCHMARK("Detection and calibration")
+    {
+        MultiPositionCalibration calibration(tumbleOptions());
+        for (const auto& sample : samples) { calibration.addSample(sample.time, sample.accel, sample.gyro); }
+        return calibration.solve();
+    };
+}
+
+} // namespace NAV::TESTS::MultiPositionCalibrationTests
@@ -0,0 +1,203 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file PreintegrationTests.cpp
+/// @brief Tests for the IMU preintegration
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include "CatchMatchers.hpp"
+
+#include "Logger.hpp"
+#include "Navigation/INS/Preintegration.hpp"
+#include "Navigation/INS/EcefFrame/ErrorEquations.hpp"
+#include "Navigation/INS/EcefFrame/Mechanization.hpp"
+#include "Navigation/Math/Math.hpp"
+#include "Navigation/Math/NumericalIntegration.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS
+{
+
+TEST_CASE("[Preintegration] Compare with sample-wise mechanization", "[Preintegration]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d lla_position{ deg2rad(48.78), deg2rad(9.18), 300.0 };
+    Eigen::Vector3d e_position = trafo::lla2ecef_WGS84(lla_position);
+    Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(lla_position(0), lla_position(1));
+    Eigen::Vector3d e_velocity = e_Quat_n * Eigen::Vector3d{ 10.0, 5.0, -0.5 };
+    Eigen::Quaterniond e_Quat_b = e_Quat_n * trafo::n_Quat_b(deg2rad(2.0), deg2rad(-3.0), deg2rad(45.0));
+
+    Eigen::Vector3d b_specForce{ 0.8, -0.3, -9.7 };
+    Eigen::Vector3d b_omega_ib{ deg2rad(1.0), deg2rad(-2.0), deg2rad(10.0) };
+
+    constexpr double dt = 0.01;
+    constexpr size_t N = 100;
+
+    // Sample-wise reference solution
+    Eigen::Matrix<double, 16, 1> y;
+    y.segment<4>(0) = Eigen::Vector4d{ e_Quat_b.w(), e_Quat_b.x(), e_Quat_b.y(), e_Quat_b.z() };
+    y.segment<3>(4) = e_velocity;
+    y.segment<3>(7) = e_position;
+    y.segment<3>(10) = b_specForce;
+    y.segment<3>(13) = b_omega_ib;
+    PosVelAttDerivativeConstants_e c;
+    c.b_omega_ib_dot.setZero();
+    c.b_measuredForce_dot.setZero();
+
+    ImuPreintegrator preintegrator;
+    preintegrator.reset();
+    for (size_t i = 0; i < N; i++)
+    {
+        y = RungeKutta4(e_calcPosVelAttDerivative, dt, y, c);
+        y.segment<4>(0).normalize();
+        preintegrator.integrate(b_specForce, b_omega_ib, dt);
+    }
+    REQUIRE(preintegrator.size() == N);
+    REQUIRE_THAT(preintegrator.deltaTime(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+
+    auto state = preintegrator.predict(e_position, e_velocity, e_Quat_b);
+
+    Eigen::Quaterniond e_Quat_b_ref{ y(0), y(1), y(2), y(3) };
+    LOG_DEBUG("Position difference: {} [m]", (state.e_position - y.segment<3>(7)).transpose());
+    LOG_DEBUG("Velocity difference: {} [m/s]", (state.e_velocity - y.segment<3>(4)).transpose());
+    LOG_DEBUG("Attitude difference: {} [rad]", state.e_Quat_b.angularDistance(e_Quat_b_ref));
+
+    // Gravitation, Coriolis and centrifugal terms are held constant over the interval
+    REQUIRE((state.e_position - y.segment<3>(7)).norm() < 5e-3);
+    REQUIRE((state.e_velocity - y.segment<3>(4)).norm() < 5e-3);
+    REQUIRE(state.e_Quat_b.angularDistance(e_Quat_b_ref) < 1e-6);
+}
+
+TEST_CASE("[Preintegration] First order bias correction", "[Preintegration]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d b_biasAccel{ 0.01, -0.02, 0.015 };
+    Eigen::Vector3d b_biasGyro = deg2rad(Eigen::Vector3d{ 0.05, -0.03, 0.02 });
+
+    ImuPreintegrator preintegrator;
+    ImuPreintegrator preintegratorWithBias;
+    preintegrator.reset();
+    preintegratorWithBias.reset(b_biasAccel, b_biasGyro);
+
+    constexpr double dt = 0.005;
+    for (size_t i = 0; i < 400; i++)
+    {
+        double t = static_cast<double>(i) * dt;
+        Eigen::Vector3d b_specForce{ 0.5 * std::sin(t), 0.2 * std::cos(2 * t), -9.81 + 0.1 * t };
+        Eigen::Vector3d b_omega_ib{ 0.1 * std::cos(t), -0.05, 0.3 * std::sin(0.5 * t) };
+        preintegrator.integrate(b_specForce, b_omega_ib, dt);
+        preintegratorWithBias.integrate(b_specForce, b_omega_ib, dt);
+    }
+
+    Eigen::Quaterniond deltaQuat = preintegrator.deltaQuat(b_biasGyro);
+    Eigen::Vector3d deltaVelocity = preintegrator.deltaVelocity(b_biasAccel, b_biasGyro);
+    Eigen::Vector3d deltaPosition = preintegrator.deltaPosition(b_biasAccel, b_biasGyro);
+
+    LOG_DEBUG("Velocity difference: {} [m/s]", (deltaVelocity - preintegratorWithBias.deltaVelocity()).transpose());
+    LOG_DEBUG("Position difference: {} [m]", (deltaPosition - preintegratorWithBias.deltaPosition()).transpose());
+
+    REQUIRE(deltaQuat.angularDistance(preintegratorWithBias.deltaQuat()) < 1e-7);
+    REQUIRE((deltaVelocity - preintegratorWithBias.deltaVelocity()).norm() < 5e-5);
+    REQUIRE((deltaPosition - preintegratorWithBias.deltaPosition()).norm() < 5e-5);
+
+    // Without correction the difference is orders of magnitude larger
+    REQUIRE((preintegrator.deltaPosition() - preintegratorWithBias.deltaPosition()).norm() > 1e-3);
+}
+
+TEST_CASE("[Preintegration] Error state transition matches the sample-wise error propagation", "[Preintegration]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d lla_position{ deg2rad(48.78), deg2rad(9.18), 300.0 };
+    Eigen::Quaterniond e_Quat_b = trafo::e_Quat_n(lla_position(0), lla_position(1)) * trafo::n_Quat_b(deg2rad(2.0), deg2rad(-3.0), deg2rad(45.0));
+
+    Eigen::Vector3d sigma2_ra = Eigen::Vector3d::Constant(1e-6);
+    Eigen::Vector3d sigma2_rg = Eigen::Vector3d::Constant(1e-8);
+    ImuPreintegrator preintegrator(sigma2_ra, sigma2_rg);
+    preintegrator.reset();
+
+    // Sample-wise propagation with the system matrix of the Kalman filters (Earth rotation and gravity gradient neglected).
+    // The first order discretization converges linearly with the sample interval towards the preintegrated solution.
+    Eigen::Matrix<double, 15, 15> Phi = Eigen::Matrix<double, 15, 15>::Identity();
+    Eigen::Matrix<double, 15, 15> P = Eigen::Matrix<double, 15, 15>::Zero();
+
+    constexpr double dt = 0.005;
+    for (size_t i = 0; i < 200; i++)
+    {
+        double t = static_cast<double>(i) * dt;
+        Eigen::Vector3d b_specForce{ 0.5 * std::sin(t), 0.2 * std::cos(2 * t), -9.81 + 0.1 * t };
+        Eigen::Vector3d b_omega_ib{ 0.1 * std::cos(t), -0.05, 0.3 * std::sin(0.5 * t) };
+
+        Eigen::Matrix3d e_Dcm_b = (e_Quat_b * preintegrator.deltaQuat()).toRotationMatrix();
+        Eigen::Matrix<double, 15, 15> F = Eigen::Matrix<double, 15, 15>::Zero();
+        F.block<3, 3>(0, 12) = e_F_dpsi_dw(e_Dcm_b);
+        F.block<3, 3>(3, 0) = e_F_dv_dpsi(e_Dcm_b * b_specForce);
+        F.block<3, 3>(3, 9) = e_F_dv_df(e_Dcm_b);
+        F.block<3, 3>(6, 3) = e_F_dr_dv();
+        Eigen::Matrix<double, 15, 15> Phi_k = Eigen::Matrix<double, 15, 15>::Identity() + F * dt + 0.5 * F * F * dt * dt;
+
+        Eigen::Matrix<double, 15, 6> G = Eigen::Matrix<double, 15, 6>::Zero();
+        G.block<3, 3>(0, 3) = -e_Dcm_b;
+        G.block<3, 3>(3, 0) = e_Dcm_b;
+        Eigen::Matrix<double, 6, 1> W;
+        W << sigma2_ra, sigma2_rg;
+
+        Phi = Phi_k * Phi;
+        P = Phi_k * P * Phi_k.transpose() + Phi_k * G * W.asDiagonal() * G.transpose() * Phi_k.transpose() * dt;
+
+        preintegrator.integrate(b_specForce, b_omega_ib, dt);
+    }
+
+    Eigen::Matrix<double, 15, 15> PhiPreint = preintegrator.errorTransitionMatrix(e_Quat_b);
+    Eigen::Matrix<double, 9, 9> PPreint = preintegrator.errorCovariance(e_Quat_b);
+    LOG_DEBUG("Phi difference\n{}", PhiPreint - Phi);
+    LOG_DEBUG("P difference\n{}", PPreint - P.topLeftCorner<9, 9>());
+
+    for (Eigen::Index r = 0; r < 9; r += 3)
+    {
+        for (Eigen::Index c = 0; c < 15; c += 3)
+        {
+            CAPTURE(r, c);
+            double scale = std::max(Phi.block<3, 3>(r, c).cwiseAbs().maxCoeff(), 1e-3);
+            REQUIRE((PhiPreint.block<3, 3>(r, c) - Phi.block<3, 3>(r, c)).cwiseAbs().maxCoeff() < 1e-2 * scale);
+        }
+    }
+    REQUIRE((PPreint - P.topLeftCorner<9, 9>()).cwiseAbs().maxCoeff() < 1e-2 * P.topLeftCorner<9, 9>().cwiseAbs().maxCoeff());
+    for (Eigen::Index i = 0; i < 9; i++)
+    {
+        REQUIRE_THAT(PPreint(i, i), Catch::Matchers::WithinRel(P(i, i), 1e-2));
+    }
+}
+
+TEST_CASE("[Preintegration] Covariance grows with time", "[Preintegration]")
+{
+    auto logger = initializeTestLogger();
+
+    ImuPreintegrator preintegrator(Eigen::Vector3d::Constant(1e-6), Eigen::Vector3d::Constant(1e-8));
+    preintegrator.reset();
+
+    double lastTrace = 0.0;
+    for (size_t i = 0; i < 100; i++)
+    {
+        preintegrator.integrate(Eigen::Vector3d{ 0.0, 0.0, -9.81 }, Eigen::Vector3d{ 0.0, 0.0, 0.1 }, 0.01);
+        const auto& P = preintegrator.covariance();
+        REQUIRE((P - P.transpose()).cwiseAbs().maxCoeff() < 1e-15);
+        REQUIRE(P.trace() > lastTrace);
+        lastTrace = P.trace();
+    }
+    // Attitude random walk: σ² = PSD · Δt
+    REQUIRE_THAT(preintegrator.covariance()(2, 2), Catch::Matchers::WithinRel(1e-8, 1e-6));
+    // Velocity random walk on the vertical axis: σ² = PSD · Δt
+    REQUIRE_THAT(preintegrator.covariance()(5, 5), Catch::Matchers::WithinRel(1e-6, 1e-2));
+}
+
+} // namespace NAV::TESTS
@@ -0,0 +1,282 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SlidingWindowSmootherTests.cpp
+/// @brief Tests for the sliding window smoother
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "CatchMatchers.hpp"
+
+#include <random>
+
+#include "Logger.hpp"
+#include "Navigation/INS/SlidingWindowSmoother.hpp"
+#include "Navigation/INS/EcefFrame/Mechanization.hpp"
+#include "Navigation/Math/NumericalIntegration.hpp"
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS
+{
+
+namespace
+{
+
+/// @brief Simulated IMU measurements between two aiding epochs together with the true state at the end of the interval
+struct SimulatedEpoch
+{
+    std::vector<std::pair<Eigen::Vector3d, Eigen::Vector3d>> imu; ///< Specific force and angular rate measurements
+    SlidingWindowSmoother::NavState truth;                         ///< True state at the end of the interval
+};
+
+/// @brief Simulates a trajectory with the sample-wise mechanization
+/// @param[in] initial True initial state
+/// @param[in] nEpochs Amount of aiding epochs
+/// @param[in] imuPerEpoch IMU samples per aiding epoch
+/// @param[in] dt IMU sample interval in [s]
+/// @param[in] b_biasAccel Accelerometer bias added to the measurements
+/// @param[in] b_biasGyro Gyroscope bias added to the measurements
+std::vector<SimulatedEpoch> simulate(const SlidingWindowSmoother::NavState& initial, size_t nEpochs, size_t imuPerEpoch, double dt,
+                                     const Eigen::Vector3d& b_biasAccel, const Eigen::Vector3d& b_biasGyro)
+{
+    Eigen::Matrix<double, 16, 1> y;
+    y.segment<4>(0) = Eigen::Vector4d{ initial.e_Quat_b.w(), initial.e_Quat_b.x(), initial.e_Quat_b.y(), initial.e_Quat_b.z() };
+    y.segment<3>(4) = initial.e_velocity;
+    y.segment<3>(7) = initial.e_position;
+    PosVelAttDerivativeConstants_e c;
+    c.b_omega_ib_dot.setZero();
+    c.b_measuredForce_dot.setZero();
+    c.gravitationModel = GravitationModel::Somigliana;
+
+    std::vector<SimulatedEpoch> epochs(nEpochs);
+    double t = 0.0;
+    for (auto& epoch : epochs)
+    {
+        for (size_t i = 0; i < imuPerEpoch; i++)
+        {
+            Eigen::Vector3d b_specForce{ 0.3 * std::sin(0.5 * t), 0.2 * std::cos(0.3 * t), -9.805 };
+            Eigen::Vector3d b_omega_ib{ 0.01 * std::sin(t), 0.01 * std::cos(t), 0.05 };
+            y.segment<3>(10) = b_specForce;
+            y.segment<3>(13) = b_omega_ib;
+            y = RungeKutta4(e_calcPosVelAttDerivative, dt, y, c);
+            y.segment<4>(0).normalize();
+            epoch.imu.emplace_back(b_specForce + b_biasAccel, b_omega_ib + b_biasGyro);
+            t += dt;
+        }
+        epoch.truth.insTime = initial.insTime + std::chrono::duration<double>(t);
+        epoch.truth.e_Quat_b = Eigen::Quaterniond(y(0), y(1), y(2), y(3));
+        epoch.truth.e_velocity = y.segment<3>(4);
+        epoch.truth.e_position = y.segment<3>(7);
+        epoch.truth.b_biasAccel = b_biasAccel;
+        epoch.truth.b_biasGyro = b_biasGyro;
+    }
+    return epochs;
+}
+
+/// @brief True initial state of the simulations
+SlidingWindowSmoother::NavState initialState()
+{
+    Eigen::Vector3d lla_position{ deg2rad(48.78), deg2rad(9.18), 300.0 };
+    Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(lla_position(0), lla_position(1));
+
+    SlidingWindowSmoother::NavState state;
+    state.insTime = InsTime(2023, 1, 8, 10, 0, 0);
+    state.e_position = trafo::lla2ecef_WGS84(lla_position);
+    state.e_velocity = e_Quat_n * Eigen::Vector3d{ 5.0, 2.0, 0.0 };
+    state.e_Quat_b = e_Quat_n * trafo::n_Quat_b(0.0, 0.0, deg2rad(30.0));
+    return state;
+}
+
+/// @brief Initial covariance of the simulations
+SlidingWindowSmoother::StateMatrix initialCovariance()
+{
+    SlidingWindowSmoother::StateVector variances;
+    variances << Eigen::Vector3d::Constant(std::pow(deg2rad(1.0), 2)),
+        Eigen::Vector3d::Constant(0.1),
+        Eigen::Vector3d::Constant(1.0),
+        Eigen::Vector3d::Constant(1e-2),
+        Eigen::Vector3d::Constant(std::pow(deg2rad(0.1), 2));
+    return variances.asDiagonal();
+}
+
+/// @brief Runs the smoother over the simulated epochs
+/// @param[in] smoother Smoother initialized with the initial state
+/// @param[in] epochs Simulated epochs
+/// @param[in] dt IMU sample interval in [s]
+/// @param[in] noise Standard deviation of the GNSS position noise in [m]
+/// @param[out] filtered Latest state of the window after every epoch
+/// @param[out] smoothed States marginalized from the window
+void run(SlidingWindowSmoother& smoother, const std::vector<SimulatedEpoch>& epochs, double dt, double noise,
+         std::vector<SlidingWindowSmoother::NavState>& filtered, std::vector<SlidingWindowSmoother::NavState>& smoothed)
+{
+    std::mt19937 gen(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::normal_distribution<double> positionNoise(0.0, noise);
+
+    ImuPreintegrator preintegrator(Eigen::Vector3d::Constant(1e-6), Eigen::Vector3d::Constant(1e-10));
+    for (const auto& epoch : epochs)
+    {
+        preintegrator.reset(smoother.latest().b_biasAccel, smoother.latest().b_biasGyro);
+        for (const auto& [b_specForce, b_omega_ib] : epoch.imu)
+        {
+            preintegrator.integrate(b_specForce, b_omega_ib, dt);
+        }
+        smoother.addImuFactor(preintegrator, epoch.truth.insTime);
+        Eigen::Vector3d e_position = epoch.truth.e_position + Eigen::Vector3d{ positionNoise(gen), positionNoise(gen), positionNoise(gen) };
+        smoother.addPositionMeasurement(e_position, Eigen::Matrix3d::Identity() * std::pow(std::max(noise, 1e-3), 2));
+        smoother.optimize();
+        filtered.push_back(smoother.latest());
+        auto marginalized = smoother.marginalize();
+        smoothed.insert(smoothed.end(), marginalized.begin(), marginalized.end());
+    }
+}
+
+/// @brief Root mean square position error of the states against the simulated truth
+double positionRMS(const std::vector<SlidingWindowSmoother::NavState>& states, const std::vector<SimulatedEpoch>& epochs)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        sum += (states.at(i).e_position - epochs.at(i).truth.e_position).squaredNorm();
+    }
+    return std::sqrt(sum / static_cast<double>(states.size()));
+}
+
+} // namespace
+
+TEST_CASE("[SlidingWindowSmoother] Converges to the true trajectory", "[SlidingWindowSmoother]")
+{
+    auto logger = initializeTestLogger();
+
+    constexpr double dt = 0.01;
+    Eigen::Vector3d b_biasAccel{ 0.02, -0.01, 0.03 };
+    Eigen::Vector3d b_biasGyro = deg2rad(Eigen::Vector3d{ 0.01, -0.02, 0.015 });
+
+    auto truth = initialState();
+    auto epochs = simulate(truth, 200, 10, dt, b_biasAccel, b_biasGyro);
+
+    // Start with a wrong attitude and position
+    auto initial = truth;
+    initial.e_Quat_b = initial.e_Quat_b * math::expMapQuat(deg2rad(Eigen::Vector3d{ 0.5, -0.5, 1.0 }));
+    initial.e_position += Eigen::Vector3d{ 0.5, -0.3, 0.8 };
+
+    SlidingWindowSmoother::Parameters parameters;
+    parameters.windowLength = 2.0;
+    parameters.maxIterations = 5;
+    parameters.gravitationModel = GravitationModel::Somigliana;
+    SlidingWindowSmoother smoother(parameters);
+    smoother.initialize(initial, initialCovariance());
+
+    std::vector<SlidingWindowSmoother::NavState> filtered;
+    std::vector<SlidingWindowSmoother::NavState> smoothed;
+    run(smoother, epochs, dt, 0.0, filtered, smoothed);
+
+    REQUIRE(smoother.size() <= 21);
+    REQUIRE(smoothed.size() + smoother.size() == epochs.size() + 1);
+
+    const auto& latest = smoother.latest();
+    const auto& latestTruth = epochs.back().truth;
+    LOG_DEBUG("Position error: {} [m]", (latest.e_position - latestTruth.e_position).transpose());
+    LOG_DEBUG("Velocity error: {} [m/s]", (latest.e_velocity - latestTruth.e_velocity).transpose());
+    LOG_DEBUG("Attitude error: {} [deg]", rad2deg(latest.e_Quat_b.angularDistance(latestTruth.e_Quat_b)));
+    LOG_DEBUG("Accel bias: {} [m/s^2]", latest.b_biasAccel.transpose());
+
+    REQUIRE((latest.e_position - latestTruth.e_position).norm() < 1e-2);
+    REQUIRE((latest.e_velocity - latestTruth.e_velocity).norm() < 1e-2);
+    REQUIRE(latest.e_Quat_b.angularDistance(latestTruth.e_Quat_b) < deg2rad(0.05));
+    REQUIRE((latest.b_biasAccel - b_biasAccel).norm() < 5e-3);
+
+    auto P = smoother.latestCovariance();
+    REQUIRE((P - P.transpose()).cwiseAbs().maxCoeff() < 1e-9);
+    REQUIRE(P.diagonal().minCoeff() > 0.0);
+}
+
+TEST_CASE("[SlidingWindowSmoother] Marginalization keeps the information", "[SlidingWindowSmoother]")
+{
+    auto logger = initializeTestLogger();
+
+    constexpr double dt = 0.01;
+    auto truth = initialState();
+    auto epochs = simulate(truth, 60, 10, dt, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero());
+
+    SlidingWindowSmoother::Parameters parameters;
+    parameters.maxIterations = 5;
+    parameters.gravitationModel = GravitationModel::Somigliana;
+
+    parameters.windowLength = 100.0;
+    SlidingWindowSmoother fullSmoother(parameters);
+    fullSmoother.initialize(truth, initialCovariance());
+
+    parameters.windowLength = 1.0;
+    SlidingWindowSmoother fixedLagSmoother(parameters);
+    fixedLagSmoother.initialize(truth, initialCovariance());
+
+    std::vector<SlidingWindowSmoother::NavState> filtered;
+    std::vector<SlidingWindowSmoother::NavState> smoothed;
+    run(fullSmoother, epochs, dt, 0.5, filtered, smoothed);
+    REQUIRE(smoothed.empty());
+    run(fixedLagSmoother, epochs, dt, 0.5, filtered, smoothed);
+    REQUIRE(!smoothed.empty());
+
+    LOG_DEBUG("Latest position difference: {} [m]", (fullSmoother.latest().e_position - fixedLagSmoother.latest().e_position).transpose());
+    REQUIRE((fullSmoother.latest().e_position - fixedLagSmoother.latest().e_position).norm() < 1e-2);
+    REQUIRE((fullSmoother.latest().e_velocity - fixedLagSmoother.latest().e_velocity).norm() < 1e-3);
+
+    auto P_full = fullSmoother.latestCovariance();
+    auto P_fixedLag = fixedLagSmoother.latestCovariance();
+    REQUIRE_THAT(P_fixedLag.diagonal().segment<3>(6).sum(), Catch::Matchers::WithinRel(P_full.diagonal().segment<3>(6).sum(), 0.05));
+}
+
+TEST_CASE("[SlidingWindowSmoother] Benchmark against the filtered solution", "[SlidingWindowSmoother][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    // 100 Hz aiding with 200 Hz IMU
+    constexpr double dt = 0.005;
+    Eigen::Vector3d b_biasAccel{ 0.02, -0.01, 0.03 };
+    Eigen::Vector3d b_biasGyro = deg2rad(Eigen::Vector3d{ 0.01, -0.02, 0.015 });
+    auto truth = initialState();
+    auto epochs = simulate(truth, 1500, 2, dt, b_biasAccel, b_biasGyro);
+
+    for (double windowLength : { 2.0, 5.0 })
+    {
+        SlidingWindowSmoother::Parameters parameters;
+        parameters.windowLength = windowLength;
+        parameters.maxIterations = 1;
+        parameters.gravitationModel = GravitationModel::Somigliana;
+        SlidingWindowSmoother smoother(parameters);
+        smoother.initialize(truth, initialCovariance());
+
+        std::vector<SlidingWindowSmoother::NavState> filtered;
+        std::vector<SlidingWindowSmoother::NavState> smoothed;
+        run(smoother, epochs, dt, 0.5, filtered, smoothed);
+
+        LOG_INFO("Window {} s: Position RMS filtered {:.3f} m, smoothed {:.3f} m", windowLength, positionRMS(filtered, epochs), positionRMS(smoothed, epochs));
+        REQUIRE(positionRMS(smoothed, epochs) < positionRMS(filtered, epochs));
+
+        // Steady state epoch: add one state, optimize, marginalize one state
+        ImuPreintegrator preintegrator(Eigen::Vector3d::Constant(1e-6), Eigen::Vector3d::Constant(1e-10));
+        for (const auto& [b_specForce, b_omega_ib] : epochs.front().imu)
+        {
+            preintegrator.integrate(b_specForce, b_omega_ib, dt);
+        }
+        InsTime insTime = smoother.latest().insTime;
+        Eigen::Vector3d e_position = smoother.latest().e_position;
+        BENCHMARK(fmt::format("Epoch with {} s window at 100 Hz", windowLength))
+        {
+            insTime += std::chrono::duration<double>(0.01);
+            smoother.addImuFactor(preintegrator, insTime);
+            smoother.addPositionMeasurement(e_position, Eigen::Matrix3d::Identity() * 0.25);
+            smoother.optimize();
+            return smoother.marginalize().size();
+        };
+    }
+}
+
+} // namespace NAV::TESTS
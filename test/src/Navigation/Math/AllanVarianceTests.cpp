@@ -0,0 +1,153 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AllanVarianceTests.cpp
+/// @brief Tests for the streaming Allan variance and the noise fit
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "Navigation/Math/AllanVariance.hpp"
+#include "util/Random/RandomNumberGenerator.hpp"
+
+namespace NAV::TESTS::AllanVarianceTests
+{
+
+TEST_CASE("[AllanVariance] Streaming estimate equals the batch overlapping estimate", "[AllanVariance]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 1;
+    rng.resetSeed();
+
+    constexpr size_t N = 5000;
+    std::vector<double> x(N);
+    for (size_t i = 0; i < N; i++) { x[i] = rng.getRand_normalDist(0.3, 1.0) + 1e-4 * static_cast<double>(i); }
+
+    AllanVariance allan(2, 1000, 10, true);
+    for (const auto& value : x) { allan.addSample(Eigen::Vector2d(value, -2.0 * value)); }
+    REQUIRE(allan.sampleCount() == N);
+
+    std::vector<double> theta(N + 1, 0.0);
+    for (size_t i = 0; i < N; i++) { theta[i + 1] = theta[i] + x[i]; }
+
+    auto clusters = allan.clusters();
+    REQUIRE(clusters.size() > 25);
+    REQUIRE(clusters.front().m == 1);
+    REQUIRE(clusters.back().m == 1008);
+    for (const auto& cluster : clusters)
+    {
+        // Batch estimate with the same stride as the decimation
+        size_t m = cluster.m;
+        size_t stride = m < 64 ? 1 : size_t(1) << static_cast<size_t>(std::log2(static_cast<double>(m) / 32.0));
+        double sum = 0.0;
+        double hadamardSum = 0.0;
+        size_t terms = 0;
+        size_t hadamardTerms = 0;
+        for (size_t k = 0; k + 2 * m <= N; k += stride)
+        {
+            sum += std::pow(theta[k + 2 * m] - 2.0 * theta[k + m] + theta[k], 2);
+            terms++;
+            if (k + 3 * m <= N)
+            {
+                hadamardSum += std::pow(theta[k + 3 * m] - 3.0 * theta[k + 2 * m] + 3.0 * theta[k + m] - theta[k], 2);
+                hadamardTerms++;
+            }
+        }
+        REQUIRE(cluster.terms == terms);
+        REQUIRE(cluster.hadamardTerms == hadamardTerms);
+        double avar = sum / (2.0 * static_cast<double>(m * m * terms));
+        REQUIRE_THAT(cluster.allanVariance(0), Catch::Matchers::WithinRel(avar, 1e-9));
+        REQUIRE_THAT(cluster.allanVariance(1), Catch::Matchers::WithinRel(4.0 * avar, 1e-9));
+        if (hadamardTerms > 0)
+        {
+            REQUIRE_THAT(cluster.hadamardVariance(0), Catch::Matchers::WithinRel(hadamardSum / (6.0 * static_cast<double>(m * m * hadamardTerms)), 1e-9));
+        }
+    }
+}
+
+TEST_CASE("[AllanVariance] Fit of white noise and rate random walk", "[AllanVariance]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 2;
+    rng.resetSeed();
+
+    constexpr double dt = 0.01;   // 100 Hz
+    constexpr double N = 2e-3;    // White noise [unit/√(Hz)]
+    constexpr double K = 1e-5;    // Rate random walk [unit*√(Hz)]
+    constexpr size_t SAMPLES = 1000000;
+
+    AllanVariance allan(1, SAMPLES / 10);
+    double bias = 0.0;
+    for (size_t i = 0; i < SAMPLES; i++)
+    {
+        bias += rng.getRand_normalDist(0.0, K * std::sqrt(dt));
+        allan.addSample(Eigen::Matrix<double, 1, 1>(0.5 + bias + rng.getRand_normalDist(0.0, N / std::sqrt(dt))));
+    }
+
+    std::vector<double> tau;
+    std::vector<double> avar;
+    std::vector<double> edf;
+    for (const auto& cluster : allan.clusters())
+    {
+        tau.push_back(static_cast<double>(cluster.m) * dt);
+        avar.push_back(cluster.allanVariance(0));
+        edf.push_back(allanVarianceDegreesOfFreedom(allan.sampleCount(), cluster.m));
+    }
+    // White noise at short averaging times
+    REQUIRE_THAT(std::sqrt(avar.at(10)), Catch::Matchers::WithinRel(N / std::sqrt(tau.at(10)), 0.02));
+
+    auto params = fitAllanNoiseParameters(tau, avar, edf);
+    REQUIRE_THAT(params.whiteNoise, Catch::Matchers::WithinRel(N, 0.02));
+    REQUIRE_THAT(params.randomWalk, Catch::Matchers::WithinRel(K, 0.3));
+    REQUIRE(params.rateRamp < 1e-6);
+    REQUIRE(params.gaussMarkovStdDev > 0.0);
+    REQUIRE(params.gaussMarkovCorrelationTime > 0.0);
+
+    // The fitted curve passes through the estimates
+    for (size_t i = 0; i < tau.size(); i += 5)
+    {
+        REQUIRE_THAT(params.allanVariance(tau.at(i)), Catch::Matchers::WithinRel(avar.at(i), 0.5));
+    }
+}
+
+TEST_CASE("[AllanVariance] Bias instability", "[AllanVariance]")
+{
+    auto logger = initializeTestLogger();
+
+    // Exact Allan variance of the model is recovered
+    AllanNoiseParameters truth{ .whiteNoise = 1e-3, .biasInstability = 5e-4, .randomWalk = 1e-6 };
+    std::vector<double> tau;
+    std::vector<double> avar;
+    std::vector<double> edf;
+    for (double t = 0.01; t < 1e4; t *= 1.3)
+    {
+        tau.push_back(t);
+        avar.push_back(truth.allanVariance(t));
+        edf.push_back(100.0);
+    }
+    auto params = fitAllanNoiseParameters(tau, avar, edf);
+    REQUIRE_THAT(params.whiteNoise, Catch::Matchers::WithinRel(truth.whiteNoise, 1e-6));
+    REQUIRE_THAT(params.biasInstability, Catch::Matchers::WithinRel(truth.biasInstability, 1e-6));
+    REQUIRE_THAT(params.randomWalk, Catch::Matchers::WithinRel(truth.randomWalk, 1e-6));
+    REQUIRE(params.quantization < 1e-9);
+    REQUIRE(params.rateRamp < 1e-12);
+
+    // Constant input
+    REQUIRE(fitAllanNoiseParameters(tau, std::vector<double>(tau.size(), 0.0), edf).whiteNoise == 0.0);
+}
+
+} // namespace NAV::TESTS::AllanVarianceTests
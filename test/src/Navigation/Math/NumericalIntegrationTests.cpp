@@ -0,0 +1,248 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NumericalIntegrationTests.cpp
+/// @brief Tests for the numerical integration methods
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "CatchMatchers.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "Logger.hpp"
+#include "Navigation/Math/NumericalIntegration.hpp"
+#include "Navigation/INS/LocalNavFrame/Mechanization.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "util/Eigen.hpp"
+
+namespace NAV::TESTS::NumericalIntegrationTests
+{
+
+namespace
+{
+
+constexpr double MU = 398600.44e9;        ///< Gravitational constant of the Earth [m^3/s^2]
+constexpr double ORBIT_RADIUS = 25510e3; ///< Radius of a GLONASS like circular orbit [m]
+
+/// @brief Two body problem
+/// @param[in] y State [x, y, z, v_x, v_y, v_z]^T
+/// @param[in] nEvaluations Counter for the function evaluations
+/// @return The derivative ∂/∂t [x, y, z, v_x, v_y, v_z]^T
+Eigen::Vector<double, 6> twoBody(const Eigen::Vector<double, 6>& y, size_t* nEvaluations)
+{
+    (*nEvaluations)++;
+    Eigen::Vector<double, 6> y_dot;
+    double r = y.head<3>().norm();
+    y_dot << y.tail<3>(), -MU / (r * r * r) * y.head<3>();
+    return y_dot;
+}
+
+/// @brief Analytic solution of the circular orbit
+/// @param[in] t Time since the start in [s]
+/// @return State [x, y, z, v_x, v_y, v_z]^T
+Eigen::Vector<double, 6> circularOrbit(double t)
+{
+    double n = std::sqrt(MU / (ORBIT_RADIUS * ORBIT_RADIUS * ORBIT_RADIUS));
+    double v = n * ORBIT_RADIUS;
+    Eigen::Vector<double, 6> y;
+    y << ORBIT_RADIUS * std::cos(n * t), ORBIT_RADIUS * std::sin(n * t), 0.0,
+        -v * std::sin(n * t), v * std::cos(n * t), 0.0;
+    return y;
+}
+
+/// @brief Propagates the circular orbit with fixed RK4 steps
+/// @param[in] duration Time to integrate in [s]
+/// @param[in] h Integration step in [s]
+/// @param[in] nEvaluations Counter for the function evaluations
+/// @return State at the end
+Eigen::Vector<double, 6> propagateRungeKutta4(double duration, double h, size_t* nEvaluations)
+{
+    Eigen::Vector<double, 6> y = circularOrbit(0.0);
+    for (double t = 0.0; t < duration - 1e-9; t += h)
+    {
+        y = RungeKutta4(twoBody, std::min(h, duration - t), y, nEvaluations);
+    }
+    return y;
+}
+
+/// @brief Harmonic oscillator y'' = -y
+/// @param[in] y State [y, y']^T
+/// @param[in] t Time in [s]
+/// @return The derivative [y', y'']^T
+Eigen::Vector2d oscillator(const Eigen::Vector2d& y, double /* t */, int /* c */)
+{
+    return { y(1), -y(0) };
+}
+
+} // namespace
+
+TEST_CASE("[NumericalIntegration] Dormand-Prince convergence order", "[NumericalIntegration]")
+{
+    auto logger = initializeTestLogger();
+
+    // y' = -y with y(0) = 1, integrated till t = 1 with fixed steps
+    auto f = [](const double& y, const double& /* t */, const int& /* c */) { return -y; };
+    auto globalError = [&](size_t nSteps) {
+        double h = 1.0 / static_cast<double>(nSteps);
+        double y = 1.0;
+        for (size_t i = 0; i < nSteps; i++) { y = DormandPrince45(f, h, y, static_cast<double>(i) * h, 0); }
+        return std::abs(y - std::exp(-1.0));
+    };
+
+    double e10 = globalError(10);
+    double e20 = globalError(20);
+    LOG_DEBUG("Errors {} and {}, ratio {}", e10, e20, e10 / e20);
+    REQUIRE(e10 < 1e-8);
+    REQUIRE(e10 / e20 > 25.0); // 5th order: 2^5 = 32
+    REQUIRE(e10 / e20 < 40.0);
+
+    // Autonomous overload
+    REQUIRE(DormandPrince45([](const double& y, const int&) { return -y; }, 0.1, 1.0, 0) == DormandPrince45(f, 0.1, 1.0, 0.0, 0));
+}
+
+TEST_CASE("[NumericalIntegration] Adaptive Dormand-Prince with dense output", "[NumericalIntegration]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector2d y0(0.0, 1.0); // y = sin(t)
+    double t1 = 4.0 * std::numbers::pi;
+
+    std::vector<DenseOutput<Eigen::Vector2d, double>> steps;
+    AdaptiveStepStatistics<double> statistics;
+    Eigen::Vector2d y = DormandPrince45Adaptive(oscillator, 0.0, t1, y0, 0, AdaptiveStepOptions<double>{ .absTol = 1e-10, .relTol = 1e-10 }, &statistics,
+                                                [&](const DenseOutput<Eigen::Vector2d, double>& step) { steps.push_back(step); });
+
+    LOG_DEBUG("Accepted {}, rejected {}, evaluations {}", statistics.acceptedSteps, statistics.rejectedSteps, statistics.functionEvaluations);
+    REQUIRE(statistics.success);
+    REQUIRE(statistics.acceptedSteps == steps.size());
+    REQUIRE(statistics.functionEvaluations <= 2 + 6 * (statistics.acceptedSteps + statistics.rejectedSteps));
+    REQUIRE_THAT(y(0), Catch::Matchers::WithinAbs(std::sin(t1), 1e-8));
+    REQUIRE_THAT(y(1), Catch::Matchers::WithinAbs(std::cos(t1), 1e-8));
+
+    // Steps are continuous and cover the whole interval
+    REQUIRE(steps.front().t0() == 0.0);
+    REQUIRE(steps.back().t1() == t1);
+    for (size_t i = 1; i < steps.size(); i++) { REQUIRE(steps.at(i).t0() == steps.at(i - 1).t1()); }
+
+    // Dense output reproduces the start state and the result of every step
+    REQUIRE(steps.front()(steps.front().t0()) == y0);
+    for (size_t i = 0; i < steps.size(); i++)
+    {
+        const auto& step = steps.at(i);
+        Eigen::Vector2d yStepEnd = i + 1 < steps.size() ? steps.at(i + 1)(steps.at(i + 1).t0()) : y;
+        REQUIRE_THAT((step(step.t1()) - yStepEnd).norm(), Catch::Matchers::WithinAbs(0.0, 1e-15));
+    }
+
+    // Dense output between the steps
+    for (const auto& step : steps)
+    {
+        for (double theta : { 0.0, 0.25, 0.5, 0.75, 1.0 })
+        {
+            double t = step.t0() + theta * (step.t1() - step.t0());
+            REQUIRE_THAT(step(t)(0), Catch::Matchers::WithinAbs(std::sin(t), 1e-7));
+            REQUIRE_THAT(step(t)(1), Catch::Matchers::WithinAbs(std::cos(t), 1e-7));
+        }
+    }
+
+    // Backwards in time
+    Eigen::Vector2d yBack = DormandPrince45Adaptive(oscillator, t1, 0.0, y, 0, AdaptiveStepOptions<double>{ .absTol = 1e-10, .relTol = 1e-10 }, &statistics);
+    REQUIRE(statistics.success);
+    REQUIRE_THAT((yBack - y0).norm(), Catch::Matchers::WithinAbs(0.0, 1e-8));
+
+    // Zero length interval
+    REQUIRE(DormandPrince45Adaptive(oscillator, 1.0, 1.0, y0, 0) == y0);
+
+    // Step limit
+    DormandPrince45Adaptive(oscillator, 0.0, t1, y0, 0, AdaptiveStepOptions<double>{ .absTol = 1e-10, .relTol = 1e-10, .maxSteps = 5 }, &statistics);
+    REQUIRE(!statistics.success);
+}
+
+TEST_CASE("[NumericalIntegration] Accuracy per function evaluation on an orbit", "[NumericalIntegration]")
+{
+    auto logger = initializeTestLogger();
+
+    // Quarter of a GLONASS like orbit (about 2.8h)
+    double n = std::sqrt(MU / (ORBIT_RADIUS * ORBIT_RADIUS * ORBIT_RADIUS));
+    double duration = 0.5 * std::numbers::pi / n;
+    Eigen::Vector<double, 6> y_ref = circularOrbit(duration);
+
+    size_t nEvaluationsRK4 = 0;
+    Eigen::Vector<double, 6> y_RK4 = propagateRungeKutta4(duration, 60.0, &nEvaluationsRK4);
+    double errorRK4 = (y_RK4.head<3>() - y_ref.head<3>()).norm();
+
+    size_t nEvaluationsDP = 0;
+    AdaptiveStepStatistics<double> statistics;
+    Eigen::Vector<double, 6> y_DP = DormandPrince45Adaptive(twoBody, 0.0, duration, circularOrbit(0.0), &nEvaluationsDP,
+                                                            AdaptiveStepOptions<double>{ .absTol = 1e-5, .relTol = 3e-11 }, &statistics);
+    double errorDP = (y_DP.head<3>() - y_ref.head<3>()).norm();
+
+    LOG_INFO("RK4 (60s): error {:.2e} m with {} evaluations", errorRK4, nEvaluationsRK4);
+    LOG_INFO("DP45 (adaptive): error {:.2e} m with {} evaluations in {} steps", errorDP, nEvaluationsDP, statistics.acceptedSteps);
+    REQUIRE(statistics.functionEvaluations == nEvaluationsDP);
+    REQUIRE(errorDP <= errorRK4);
+    REQUIRE(nEvaluationsDP < nEvaluationsRK4);
+}
+
+TEST_CASE("[NumericalIntegration] Benchmark orbit propagation", "[NumericalIntegration][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    double n = std::sqrt(MU / (ORBIT_RADIUS * ORBIT_RADIUS * ORBIT_RADIUS));
+    double duration = 0.5 * std::numbers::pi / n;
+
+    size_t nEvaluations = 0;
+    BENCHMARK("RK4 60s steps")
+    {
+        return propagateRungeKutta4(duration, 60.0, &nEvaluations);
+    };
+    BENCHMARK("DP45 adaptive")
+    {
+        return DormandPrince45Adaptive(twoBody, 0.0, duration, circularOrbit(0.0), &nEvaluations, AdaptiveStepOptions<double>{ .absTol = 1e-5, .relTol = 3e-11 });
+    };
+}
+
+TEST_CASE("[NumericalIntegration] Benchmark local-navigation frame mechanization", "[NumericalIntegration][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    // Vehicle in a turn with increasing rotation rate and specific force, integrated over one second
+    //  0  1  2  3   4    5    6   7  8  9  10  11  12  13  14  15
+    // [w, x, y, z, v_N, v_E, v_D, 𝜙, λ, h, fx, fy, fz, ωx, ωy, ωz]^T
+    Eigen::Matrix<double, 16, 1> y0;
+    y0 << 1.0, 0.0, 0.0, 0.0, 10.0, 0.0, 0.0, deg2rad(48.78), deg2rad(9.18), 300.0, 0.5, 1.0, -9.81, 0.0, 0.0, deg2rad(10.0);
+    PosVelAttDerivativeConstants_n c;
+    c.b_omega_ib_dot = Eigen::Vector3d(0.0, 0.0, deg2rad(5.0));
+    c.b_measuredForce_dot = Eigen::Vector3d(0.1, 0.2, 0.0);
+    c.gravitationModel = GravitationModel::Somigliana;
+
+    auto reference = DormandPrince45Adaptive(n_calcPosVelAttDerivative, 0.0, 1.0, y0, c, AdaptiveStepOptions<double>{ .absTol = 1e-14, .relTol = 1e-14 });
+    auto rk4 = [&](size_t nSteps) {
+        Eigen::Matrix<double, 16, 1> y = y0;
+        for (size_t i = 0; i < nSteps; i++) { y = RungeKutta4(n_calcPosVelAttDerivative, 1.0 / static_cast<double>(nSteps), y, c); }
+        return y;
+    };
+    AdaptiveStepStatistics<double> statistics;
+    auto dp = DormandPrince45Adaptive(n_calcPosVelAttDerivative, 0.0, 1.0, y0, c, AdaptiveStepOptions<double>{ .absTol = 1e-9, .relTol = 1e-12 }, &statistics);
+    LOG_INFO("RK4 (100 steps): velocity error {:.2e} m/s with 400 evaluations", (rk4(100).segment<3>(4) - reference.segment<3>(4)).norm());
+    LOG_INFO("DP45 (adaptive): velocity error {:.2e} m/s with {} evaluations", (dp.segment<3>(4) - reference.segment<3>(4)).norm(), statistics.functionEvaluations);
+
+    BENCHMARK("RK4 100 steps")
+    {
+        return rk4(100);
+    };
+    BENCHMARK("DP45 adaptive")
+    {
+        return DormandPrince45Adaptive(n_calcPosVelAttDerivative, 0.0, 1.0, y0, c, AdaptiveStepOptions<double>{ .absTol = 1e-9, .relTol = 1e-12 });
+    };
+}
+
+} // namespace NAV::TESTS::NumericalIntegrationTests
@@ -326,7 +326,7 @@ inline bool operator==(const GnssNavInfo& lhs, const GnssNavInfo& rhs)
     {
         LOG_DEBUG(" [{}]", satId);
         REQUIRE(rhs.m_satellites.contains(satId));
-        REQUIRE(sat == rhs.m_satellites.at(satId));
+        REQUIRE(*sat == *rhs.m_satellites.at(satId));
     }
     return true;
 }
@@ -0,0 +1,246 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file GnssNavInfoTests.cpp
+/// @brief Tests for the versioned navigation data
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Logger.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+
+namespace NAV::TESTS::GnssNavInfoTests
+{
+
+TEST_CASE("[GnssNavInfo] Versions known at a time", "[GnssNavInfo]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0, GPST);
+
+    GnssNavInfo gnssNavInfo;
+    int consumer = 0;
+    REQUIRE(gnssNavInfo.latest() == nullptr);
+    REQUIRE(gnssNavInfo.knownAt(startTime, &consumer) == nullptr);
+
+    gnssNavInfo.satelliteSystems |= GPS;
+    gnssNavInfo.addSatelliteNavData({ GPS, 1 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(10));
+    auto version1 = gnssNavInfo.latest();
+    REQUIRE(version1 != nullptr);
+
+    gnssNavInfo.addSatelliteNavData({ GPS, 2 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.timeSysCorr[{ GPST, UTC }] = GnssNavInfo::TimeSystemCorrections{ .a0 = 1e-9, .a1 = 0.0 };
+    gnssNavInfo.publish(startTime + std::chrono::seconds(20));
+    auto version2 = gnssNavInfo.latest();
+    REQUIRE(version2 != version1);
+
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(9), &consumer) == nullptr);
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(10), &consumer) == version1.get());
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(15), &consumer) == version1.get());
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(20), &consumer) == version2.get());
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::hours(1), &consumer) == version2.get());
+
+    // Versions are immutable
+    gnssNavInfo.addSatelliteNavData({ GPS, 3 }, std::make_shared<GPSEphemeris>(startTime));
+    REQUIRE(version1->nSatellites() == 1);
+    REQUIRE(version1->timeSysCorr.empty());
+    REQUIRE(version1->searchNavigationData({ GPS, 2 }, startTime) == nullptr);
+    REQUIRE(version2->nSatellites() == 2);
+    REQUIRE(version2->timeSysCorr.size() == 1);
+    REQUIRE(version2->searchNavigationData({ GPS, 2 }, startTime) != nullptr);
+    REQUIRE(version2->satelliteSystems == GPS);
+
+    // Data known from the start
+    gnssNavInfo.publish();
+    REQUIRE(gnssNavInfo.knownAt(startTime - std::chrono::hours(1), &consumer)->nSatellites() == 3);
+
+    gnssNavInfo.reset();
+    REQUIRE(gnssNavInfo.latest() == nullptr);
+    REQUIRE(gnssNavInfo.nSatellites() == 0);
+}
+
+TEST_CASE("[GnssNavInfo] Consumers wait for the provider in post-processing", "[GnssNavInfo]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0, GPST);
+
+    GnssNavInfo gnssNavInfo;
+    gnssNavInfo.setKnownUntil(InsTime{});
+
+    std::atomic<bool> done = false;
+    const GnssNavInfo* result = nullptr;
+    std::thread consumer([&]() {
+        result = gnssNavInfo.knownAt(startTime + std::chrono::seconds(15), &done);
+        done = true;
+    });
+
+    gnssNavInfo.addSatelliteNavData({ GPS, 1 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(10));
+    gnssNavInfo.setKnownUntil(startTime + std::chrono::seconds(12));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(!done);
+
+    gnssNavInfo.addSatelliteNavData({ GPS, 2 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(14));
+    gnssNavInfo.addSatelliteNavData({ GPS, 3 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(16)); // Not known yet at the time of the consumer
+    gnssNavInfo.setKnownUntil(startTime + std::chrono::seconds(16));
+
+    consumer.join();
+    REQUIRE(done);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->nSatellites() == 2);
+
+    // After the input is processed completely, nobody waits anymore
+    gnssNavInfo.setComplete();
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::hours(24), &done)->nSatellites() == 3);
+}
+
+TEST_CASE("[GnssNavInfo] Concurrent provider and consumers", "[GnssNavInfo]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0, GPST);
+    constexpr uint16_t N_SATELLITES = 32;
+
+    GnssNavInfo gnssNavInfo;
+    gnssNavInfo.setKnownUntil(InsTime{});
+
+    // Consumers query the data every second and expect one new satellite every 10 seconds
+    std::vector<std::thread> consumers;
+    std::vector<int> consistent(4, 0);
+    for (const auto& c : consistent) { gnssNavInfo.addConsumer(&c); }
+    for (size_t c = 0; c < consistent.size(); c++)
+    {
+        consumers.emplace_back([&, c]() {
+            bool ok = true;
+            for (int t = 0; t < 10 * N_SATELLITES; t++)
+            {
+                const auto* navInfo = gnssNavInfo.knownAt(startTime + std::chrono::seconds(t), &consistent.at(c));
+                ok &= navInfo != nullptr && navInfo->nSatellites() == static_cast<size_t>(t / 10 + 1);
+            }
+            consistent.at(c) = ok;
+        });
+    }
+
+    for (uint16_t satNum = 1; satNum <= N_SATELLITES; satNum++)
+    {
+        auto insTime = startTime + std::chrono::seconds(10 * (satNum - 1));
+        gnssNavInfo.addSatelliteNavData({ GPS, satNum }, std::make_shared<GPSEphemeris>(insTime));
+        gnssNavInfo.publish(insTime);
+        gnssNavInfo.setKnownUntil(insTime + std::chrono::seconds(9));
+    }
+    gnssNavInfo.setComplete();
+
+    for (auto& consumer : consumers) { consumer.join(); }
+    for (const auto& ok : consistent) { REQUIRE(ok); }
+}
+
+TEST_CASE("[GnssNavInfo] Versions share unchanged satellites and are discarded when no consumer needs them", "[GnssNavInfo]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0, GPST);
+
+    GnssNavInfo gnssNavInfo;
+    int consumer1 = 0;
+    int consumer2 = 0;
+    gnssNavInfo.addConsumer(&consumer1);
+    gnssNavInfo.addConsumer(&consumer2);
+
+    auto ephemeris = std::make_shared<GPSEphemeris>(startTime);
+    REQUIRE(gnssNavInfo.addSatelliteNavData({ GPS, 1 }, ephemeris));
+    REQUIRE(gnssNavInfo.addSatelliteNavData({ GPS, 2 }, std::make_shared<GPSEphemeris>(startTime)));
+    REQUIRE(!gnssNavInfo.addSatelliteNavData({ GPS, 1 }, ephemeris)); // Repeated data is not stored again
+    gnssNavInfo.publish(startTime);
+
+    REQUIRE(gnssNavInfo.addSatelliteNavData({ GPS, 1 }, std::make_shared<GPSEphemeris>(startTime + std::chrono::hours(2))));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(10));
+    REQUIRE(gnssNavInfo.nVersions() == 2);
+
+    // Only the modified satellite is copied
+    const auto* version1 = gnssNavInfo.knownAt(startTime, &consumer1);
+    const auto* version2 = gnssNavInfo.knownAt(startTime + std::chrono::seconds(10), &consumer2);
+    REQUIRE(version1->satellites().at({ GPS, 1 }) != version2->satellites().at({ GPS, 1 }));
+    REQUIRE(version1->satellites().at({ GPS, 1 })->getNavigationData().size() == 1);
+    REQUIRE(version2->satellites().at({ GPS, 1 })->getNavigationData().size() == 2);
+    REQUIRE(version1->satellites().at({ GPS, 2 }) == version2->satellites().at({ GPS, 2 }));
+
+    // The first consumer can still ask for the first version
+    gnssNavInfo.publish(startTime + std::chrono::seconds(20));
+    REQUIRE(gnssNavInfo.nVersions() == 3);
+    REQUIRE(version1->nSatellites() == 2);
+
+    // After all consumers asked for later times, only the versions they can still get are kept
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(15), &consumer1) == version2);
+    gnssNavInfo.publish(startTime + std::chrono::seconds(30));
+    REQUIRE(gnssNavInfo.nVersions() == 3);
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(15), &consumer2) == version2);
+
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(25), &consumer1) != nullptr);
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(30), &consumer2) != nullptr);
+    gnssNavInfo.publish(startTime + std::chrono::seconds(40));
+    REQUIRE(gnssNavInfo.nVersions() == 3);
+
+    // Removed consumers do not keep versions
+    gnssNavInfo.removeConsumer(&consumer1);
+    gnssNavInfo.publish(startTime + std::chrono::seconds(50));
+    REQUIRE(gnssNavInfo.nVersions() == 3);
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(50), &consumer2) != nullptr);
+    gnssNavInfo.publish(startTime + std::chrono::seconds(60));
+    REQUIRE(gnssNavInfo.nVersions() == 2);
+}
+
+TEST_CASE("[GnssNavInfo] Versions in use are kept and only the latest one without consumers", "[GnssNavInfo]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0, GPST);
+
+    GnssNavInfo gnssNavInfo;
+    for (uint16_t satNum = 1; satNum <= 5; satNum++)
+    {
+        gnssNavInfo.addSatelliteNavData({ GPS, satNum }, std::make_shared<GPSEphemeris>(startTime));
+        gnssNavInfo.publish(startTime + std::chrono::seconds(10 * satNum));
+        REQUIRE(gnssNavInfo.nVersions() == 1);
+    }
+
+    int consumer = 0;
+    const auto* version = gnssNavInfo.knownAt(startTime + std::chrono::seconds(100), &consumer);
+    REQUIRE(version->nSatellites() == 5);
+
+    // Data published later, but known before the time of the consumer, does not discard the version the consumer uses
+    gnssNavInfo.addSatelliteNavData({ GPS, 6 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(60));
+    gnssNavInfo.addSatelliteNavData({ GPS, 7 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(70));
+    REQUIRE(gnssNavInfo.nVersions() == 3);
+    REQUIRE(version->nSatellites() == 5);
+
+    REQUIRE(gnssNavInfo.knownAt(startTime + std::chrono::seconds(100), &consumer)->nSatellites() == 7);
+    gnssNavInfo.addSatelliteNavData({ GPS, 8 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(200));
+    REQUIRE(gnssNavInfo.nVersions() == 2);
+
+    gnssNavInfo.removeConsumer(&consumer);
+    gnssNavInfo.addSatelliteNavData({ GPS, 9 }, std::make_shared<GPSEphemeris>(startTime));
+    gnssNavInfo.publish(startTime + std::chrono::seconds(210));
+    REQUIRE(gnssNavInfo.nVersions() == 1);
+}
+
+} // namespace NAV::TESTS::GnssNavInfoTests
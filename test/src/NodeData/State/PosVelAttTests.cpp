@@ -14,6 +14,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include "CatchMatchers.hpp"
 
+#include <array>
+#include <thread>
+#include <vector>
+
 #include "NodeData/State/PosVelAtt.hpp"
 #include "fmt/core.h"
 #include "Navigation/Transformations/Units.hpp"
@@ -136,4 +140,71 @@ TEST_CASE("[PosVelAtt] Attitude RollPitchYaw", "[PosVelAtt]")
     }
 }
 
+TEST_CASE("[PosVelAtt] Lazy frame conversions", "[PosVelAtt]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d lla_position{ deg2rad(48.78081), deg2rad(9.172012), 254 };
+    Eigen::Vector3d e_position = trafo::lla2ecef_WGS84(lla_position);
+    Eigen::Vector3d lla_position2{ deg2rad(-33.9), deg2rad(151.2), 50 };
+    Eigen::Vector3d e_vel{ 30, -25.5, 4.7 };
+    Eigen::Quaterniond n_Quat_b = trafo::n_Quat_b(deg2rad(5), deg2rad(-30), deg2rad(66));
+
+    // Results have to be bit-identical to converting when setting the values
+    PosVelAtt state;
+    state.setState_e(e_position, e_vel, trafo::e_Quat_n(lla_position(0), lla_position(1)) * n_Quat_b);
+    Eigen::Vector3d lla_expected = trafo::ecef2lla_WGS84(e_position);
+    Eigen::Quaterniond n_Quat_e_expected = trafo::e_Quat_n(lla_expected(0), lla_expected(1)).conjugate();
+    PosVelAtt copy = state; // Copies the stale values
+    CHECK(state.lla_position() == lla_expected);
+    CHECK(state.n_velocity() == n_Quat_e_expected * e_vel);
+    CHECK(state.n_Quat_b().coeffs() == (n_Quat_e_expected * state.e_Quat_b()).coeffs());
+    CHECK(copy.lla_position() == state.lla_position());
+    CHECK(copy.n_velocity() == state.n_velocity());
+    CHECK(copy.n_Quat_b().coeffs() == state.n_Quat_b().coeffs());
+
+    // Values depending on the old position keep being calculated with it
+    state.setState_n(lla_position, e_vel, n_Quat_b);
+    state.setPosition_lla(lla_position2);
+    Eigen::Quaterniond e_Quat_n_old = trafo::e_Quat_n(lla_position(0), lla_position(1));
+    CHECK(state.e_position() == trafo::lla2ecef_WGS84(lla_position2));
+    CHECK(state.e_velocity() == e_Quat_n_old * e_vel);
+    CHECK(state.e_Quat_b().coeffs() == (e_Quat_n_old * n_Quat_b).coeffs());
+}
+
+TEST_CASE("[PosVelAtt] Lazy frame conversions from multiple threads", "[PosVelAtt]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d e_position = trafo::lla2ecef_WGS84(Eigen::Vector3d{ deg2rad(48.78081), deg2rad(9.172012), 254 });
+    Eigen::Vector3d e_vel{ 30, -25.5, 4.7 };
+
+    PosVelAtt reference;
+    reference.setState_e(e_position, e_vel, Eigen::Quaterniond::UnitRandom());
+    std::ignore = reference.lla_position();
+    std::ignore = reference.n_velocity();
+    std::ignore = reference.n_Quat_b();
+
+    for (size_t run = 0; run < 20; run++)
+    {
+        PosVelAtt shared;
+        shared.setState_e(reference.e_position(), reference.e_velocity(), reference.e_Quat_b());
+        const PosVelAtt& state = shared;
+
+        constexpr size_t N_THREADS = 8;
+        std::array<bool, N_THREADS> equal{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < N_THREADS; t++)
+        {
+            threads.emplace_back([&, t]() {
+                equal.at(t) = state.n_Quat_b().coeffs() == reference.n_Quat_b().coeffs()
+                              && state.n_velocity() == reference.n_velocity()
+                              && state.lla_position() == reference.lla_position();
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        for (size_t t = 0; t < N_THREADS; t++) { REQUIRE(equal.at(t)); }
+    }
+}
+
 } // namespace NAV::TESTS::PosVelAttTests
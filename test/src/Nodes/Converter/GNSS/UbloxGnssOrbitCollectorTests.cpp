@@ -77,4 +77,37 @@ TEST_CASE("[UbloxGnssOrbitCollectorTests][flow] Spirent_ublox-F9P_static_duratio
     REQUIRE(testFlow("test/flow/Nodes/Converter/GNSS/UbloxGnssOrbitCollector.flow"));
 }
 
+TEST_CASE("[UbloxGnssOrbitCollectorTests][flow] Versions are only published for new navigation data", "[UbloxGnssOrbitCollectorTests][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // UbloxFile (2)                    UbloxGnssOrbitCollector (5)
+    //  (1) UbloxObs |>  --(6)-->  |> UbloxObs (3)  (4) GnssNavInfo <>
+    constexpr size_t NODE_ID_UBLOX_FILE = 2;
+    constexpr size_t PIN_ID_UBLOX_RINEX_NAV_INFO = 4;
+    constexpr size_t NODE_ID_RINEX_NAV_FILE = 8;
+
+    nm::RegisterPreInitCallback([&]() {
+        dynamic_cast<UbloxFile*>(nm::FindNode(NODE_ID_UBLOX_FILE))->_path = "Converter/GNSS/Ublox/Spirent_ublox-F9P_static_duration-15min_sys-GPS-GAL_iono-Klobuchar_tropo-Saastamoinen.ubx";
+        dynamic_cast<RinexNavFile*>(nm::FindNode(NODE_ID_RINEX_NAV_FILE))->_path = "Converter/GNSS/Ublox/Spirent_ublox-F9P_static_duration-15min_sys-GPS-GAL_iono-Klobuchar_tropo-Saastamoinen.nav";
+    });
+
+    nm::RegisterCleanupCallback([&]() {
+        auto* ubloxCollectorPin = nm::FindOutputPin(PIN_ID_UBLOX_RINEX_NAV_INFO);
+        REQUIRE(ubloxCollectorPin != nullptr);
+        const auto* gnssNavInfo = static_cast<const GnssNavInfo*>(std::get<const void*>(ubloxCollectorPin->data));
+
+        size_t nNavData = 0;
+        for (const auto& satellite : gnssNavInfo->satellites()) { nNavData += satellite.second->getNavigationData().size(); }
+
+        // The subframes are repeated every 30 s, which published several hundred versions if every one was published.
+        // Nobody consumes the data in this flow, so no version is discarded.
+        LOG_INFO("{} versions for {} ephemerides", gnssNavInfo->nVersions(), nNavData);
+        REQUIRE(nNavData > 0);
+        REQUIRE(gnssNavInfo->nVersions() <= 2 * nNavData);
+    });
+
+    REQUIRE(testFlow("test/flow/Nodes/Converter/GNSS/UbloxGnssOrbitCollector.flow"));
+}
+
 } // namespace NAV::TESTS::UbloxGnssOrbitCollectorTests
\ No newline at end of file
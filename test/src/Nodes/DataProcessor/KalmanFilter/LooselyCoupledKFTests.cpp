@@ -272,4 +272,46 @@ TEST_CASE("[LooselyCoupledKF][flow] Test flow with IMU data arriving after GNSS
     testLCKFwithImuFile("VectorNav/Static/vn310-imu-after.csv", MESSAGE_COUNT_GNSS, MESSAGE_COUNT_GNSS_FIX, MESSAGE_COUNT_IMU, MESSAGE_COUNT_IMU);
 }
 
+TEST_CASE("[LooselyCoupledKF][flow] Preintegrated prediction matches the per-sample prediction", "[LooselyCoupledKF][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    auto runFlow = [](bool preintegrate) {
+        std::vector<std::shared_ptr<const LcKfInsGnssErrors>> errors;
+
+        nm::RegisterPreInitCallback([&]() {
+            dynamic_cast<VectorNavFile*>(nm::FindNode(324))->_path = "VectorNav/Static/vn310-imu.csv";
+            auto* lckf = dynamic_cast<LooselyCoupledKF*>(nm::FindNode(239));
+            lckf->_preintegrateBetweenUpdates = preintegrate;
+            lckf->_preintegrationMaxInterval = 10.0;
+        });
+
+        // ImuIntegrator (163) |> PVAError (224)
+        nm::RegisterWatcherCallbackToInputPin(224, [&](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+            errors.push_back(std::static_pointer_cast<const LcKfInsGnssErrors>(queue.back()));
+        });
+
+        REQUIRE(testFlow("test/flow/Nodes/DataProcessor/KalmanFilter/LooselyCoupledKF.flow"));
+        return errors;
+    };
+
+    auto perSample = runFlow(false);
+    auto preintegrated = runFlow(true);
+
+    REQUIRE(!perSample.empty());
+    REQUIRE(perSample.size() == preintegrated.size());
+    for (size_t i = 0; i < perSample.size(); i++)
+    {
+        CAPTURE(i);
+        REQUIRE(preintegrated.at(i)->insTime == perSample.at(i)->insTime);
+        REQUIRE((preintegrated.at(i)->attitudeError - perSample.at(i)->attitudeError).cwiseAbs().maxCoeff() < deg2rad(0.05));
+        REQUIRE((preintegrated.at(i)->velocityError - perSample.at(i)->velocityError).cwiseAbs().maxCoeff() < 1e-2);
+        // Latitude and longitude errors are given in [rad]
+        Eigen::Vector3d positionTolerance = perSample.at(i)->frame == LcKfInsGnssErrors::Frame::NED ? Eigen::Vector3d(1e-8, 1e-8, 5e-2) : Eigen::Vector3d::Constant(5e-2);
+        REQUIRE(((preintegrated.at(i)->positionError - perSample.at(i)->positionError).cwiseAbs().array() < positionTolerance.array()).all());
+        REQUIRE((preintegrated.at(i)->b_biasAccel - perSample.at(i)->b_biasAccel).cwiseAbs().maxCoeff() < 1e-2);
+        REQUIRE((preintegrated.at(i)->b_biasGyro - perSample.at(i)->b_biasGyro).cwiseAbs().maxCoeff() < 1e-4);
+    }
+}
+
 } // namespace NAV::TESTS::LooselyCoupledKFTests
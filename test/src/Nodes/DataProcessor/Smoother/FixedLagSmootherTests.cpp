@@ -0,0 +1,136 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FixedLagSmootherTests.cpp
+/// @brief Tests for the fixed-lag smoother node
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+#include "CatchMatchers.hpp"
+#include "FlowTester.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "Logger.hpp"
+
+#include "Navigation/Transformations/CoordinateFrames.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+
+// This is a small hack, which lets us change private/protected parameters
+#pragma GCC diagnostic push
+#if defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wkeyword-macro"
+    #pragma GCC diagnostic ignored "-Wmacro-redefined"
+#endif
+#define protected public
+#define private public
+#include "Nodes/DataProcessor/Smoother/FixedLagSmoother.hpp"
+#undef protected
+#undef private
+#pragma GCC diagnostic pop
+
+namespace NAV::TESTS::FixedLagSmootherTests
+{
+
+namespace
+{
+
+/// @brief Checks the states which the smoother sends to the plot
+class OutputChecker
+{
+  public:
+    /// @brief Registers the watcher on the input pin of the plot
+    /// @param[in] firstOutputDelay Time between the start of the simulation and the first output [s]
+    explicit OutputChecker(int firstOutputDelay)
+        : firstTime(startTime + std::chrono::seconds(firstOutputDelay))
+    {
+        nm::RegisterWatcherCallbackToInputPin(12, [&](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+            auto posVelAtt = std::dynamic_pointer_cast<const PosVelAtt>(queue.front());
+            REQUIRE(posVelAtt != nullptr);
+
+            CAPTURE(messageCounter);
+            REQUIRE(!posVelAtt->insTime.empty());
+            if (messageCounter == 0)
+            {
+                REQUIRE(posVelAtt->insTime == firstTime);
+            }
+            else
+            {
+                REQUIRE(posVelAtt->insTime > lastTime);
+            }
+            REQUIRE(posVelAtt->insTime <= startTime + std::chrono::seconds(10));
+            REQUIRE_THAT((posVelAtt->e_position() - e_position).norm(), Catch::Matchers::WithinAbs(0.0, 1.0));
+
+            lastTime = posVelAtt->insTime;
+            messageCounter++;
+        });
+    }
+
+    size_t messageCounter = 0; ///< Amount of received states
+    InsTime lastTime;          ///< Time of the last received state
+
+  private:
+    /// Start time of the simulation
+    InsTime startTime{ 2000, 1, 1, 0, 0, 0, UTC };
+    /// Expected time of the first output
+    InsTime firstTime;
+    /// Position of the static IMU in ECEF frame [m]
+    Eigen::Vector3d e_position = trafo::lla2ecef_WGS84(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), 300.0));
+};
+
+} // namespace
+
+TEST_CASE("[FixedLagSmoother][flow] Initialization without a time and fixed-lag output", "[FixedLagSmoother][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                           FixedLagSmoother.flow
+    // ###########################################################################################################
+    //
+    //  ImuSimulator (1)                    FixedLagSmoother (6)                              Plot (11)
+    //     (2) ImuObs |>  ---(13)-->  |> ImuObs (7)                (10) PosVelAtt |>  ---(16)-->  |> Pin 1 (12)
+    //  (3) PosVelAtt |>  ---(14)-->  |> GNSSNavigationSolution (8)
+    //                          /-->  |> PosVelAttInit (9)
+    //  PosVelAttInitializer (4)    |
+    //  (5) PosVelAtt |>  ---(15)--/
+    //
+    // ###########################################################################################################
+
+    // The initializer sends the state without a time, so it has to get the time of the first IMU observation
+    OutputChecker checker(0);
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProcessor/Smoother/FixedLagSmoother.flow"));
+
+    // Every state in the window is sent once it leaves the window or the data ends
+    REQUIRE(checker.messageCounter >= 10);
+}
+
+TEST_CASE("[FixedLagSmoother][flow] Initialization without a time and real-time output", "[FixedLagSmoother][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    nm::RegisterPreInitCallback([&]() {
+        dynamic_cast<FixedLagSmoother*>(nm::FindNode(6))->_outputMode = FixedLagSmoother::OutputMode::RealTime;
+    });
+
+    // The first state is sent after the first GNSS epoch following the initial state
+    OutputChecker checker(1);
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProcessor/Smoother/FixedLagSmoother.flow"));
+
+    // The latest state is sent after every GNSS epoch, except the one at the time of the initial state
+    REQUIRE(checker.messageCounter >= 9);
+}
+
+} // namespace NAV::TESTS::FixedLagSmootherTests
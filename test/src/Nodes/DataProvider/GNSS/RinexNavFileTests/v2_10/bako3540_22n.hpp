@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_bako3540_22n = {
         { { GPST, UTC }, { 2.793967723846e-09, 2.664535259100e-15 } },
     },
     .m_satellites = {
-        { { GPS, 1 }, Satellite{
+        { { GPS, 1 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2022, 12, 19, 14, 0, 0.0, 2.356213517487e-04, -5.115907697473e-12, 0.000000000000e+00, //
                                                              3.200000000000e+01, -9.478125000000e+01, 3.792300695693e-09, 4.271765015474e-01,       //
@@ -52,8 +52,8 @@ const GnssNavInfo gnssNavInfo_bako3540_22n = {
                                                              2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 3.200000000000e+01,        //
                                                              1.295400000000e+05, 0.000000000000e+00),                                               //
                           },
-                      } },
-        { { GPS, 2 }, Satellite{
+                      }) },
+        { { GPS, 2 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2022, 12, 20, 0, 0, 0.0, -6.321193650365e-04, 2.046363078989e-12, 0.000000000000e+00, //
                                                              6.600000000000e+01, -1.198437500000e+02, 4.350181104229e-09, -1.560460888100e+00,     //
@@ -72,7 +72,7 @@ const GnssNavInfo gnssNavInfo_bako3540_22n = {
                                                              2.000000000000e+00, 0.000000000000e+00, -1.769512891769e-08, 6.700000000000e+01,      //
                                                              1.727400000000e+05, 0.000000000000e+00),                                              //
                           },
-                      } },
+                      }) },
     },
 };
 
@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_Allo060xA_22n = {
         { { GPST, UTC }, { 0.465661287308e-08, 0.710542735760e-14 } },
     },
     .m_satellites = {
-        { { GPS, 1 }, Satellite{
+        { { GPS, 1 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2022, 3, 2, 0, 0, 0.0, 0.419155228883e-03, -0.932232069317e-11, 0.000000000000e+00, //
                                                              0.230000000000e+02, 0.110718750000e+03, 0.418696011798e-08, 0.152290926733e+01,     //
@@ -52,8 +52,8 @@ const GnssNavInfo gnssNavInfo_Allo060xA_22n = {
                                                              0.200000000000e+01, 0.000000000000e+00, 0.512227416039e-08, 0.230000000000e+02,     //
                                                              0.252018000000e+06, 0.400000000000e+01, 0.000000000000e+00, 0.000000000000e+00),    //
                           },
-                      } },
-        { { GPS, 31 }, Satellite{
+                      }) },
+        { { GPS, 31 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GPSEphemeris>(2022, 3, 1, 23, 59, 44.0, -0.167020596564e-03, -0.170530256582e-11, 0.000000000000e+00, //
                                                               0.200000000000e+01, 0.460937500000e+02, 0.485163066132e-08, 0.395455163769e+00,         //
@@ -64,8 +64,8 @@ const GnssNavInfo gnssNavInfo_Allo060xA_22n = {
                                                               0.200000000000e+01, 0.000000000000e+00, -0.135041773319e-07, 0.200000000000e+01,        //
                                                               0.254286000000e+06, 0.400000000000e+01, 0.000000000000e+00, 0.000000000000e+00),        //
                            },
-                       } },
-        { { GPS, 14 }, Satellite{
+                       }) },
+        { { GPS, 14 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GPSEphemeris>(2022, 3, 2, 0, 0, 0.0, -0.895131379366e-04, -0.409272615798e-11, 0.000000000000e+00, //
                                                               0.820000000000e+02, -0.481875000000e+02, 0.508699760815e-08, 0.268765011279e+00,     //
@@ -76,7 +76,7 @@ const GnssNavInfo gnssNavInfo_Allo060xA_22n = {
                                                               0.200000000000e+01, 0.000000000000e+00, -0.745058059692e-08, 0.338000000000e+03,     //
                                                               0.252018000000e+06, 0.400000000000e+01, 0.000000000000e+00, 0.000000000000e+00),     //
                            },
-                       } },
+                       }) },
     },
 };
 
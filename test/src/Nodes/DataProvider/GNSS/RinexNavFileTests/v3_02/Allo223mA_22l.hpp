@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
         { { GST, GPST }, { 0.1600710675e-08, 0.355271368e-14 } },
     },
     .m_satellites = {
-        { { GAL, 12 }, Satellite{
+        { { GAL, 12 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GalileoEphemeris>(2022, 8, 11, 11, 10, 0, -0.109432556201e-03, -0.200373051484e-10, 0.000000000000e+00, //
                                                                   0.300000000000e+01, 0.152093750000e+03, 0.296619498250e-08, 0.594633784838e+00,       //
@@ -52,8 +52,8 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
                                                                   0.312000000000e+01, 0.000000000000e+00, -0.102445483208e-07, -0.100117176771e-07,     //
                                                                   0.386485000000e+06, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00),      //
                            },
-                       } },
-        { { GAL, 4 }, Satellite{
+                       }) },
+        { { GAL, 4 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GalileoEphemeris>(2022, 8, 11, 11, 10, 0, -0.109109678306e-02, -0.828492829896e-11, 0.000000000000e+00, //
                                                                  0.300000000000e+01, -0.114000000000e+03, 0.270439836333e-08, 0.779660129094e+00,      //
@@ -64,8 +64,8 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
                                                                  0.312000000000e+01, 0.000000000000e+00, -0.279396772385e-08, -0.302679836750e-08,     //
                                                                  0.386464000000e+06, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00),      //
                           },
-                      } },
-        { { GAL, 10 }, Satellite{
+                      }) },
+        { { GAL, 10 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GalileoEphemeris>(2022, 8, 11, 11, 50, 0, -0.506716956987e-03, -0.262900812231e-11, 0.000000000000e+00, //
                                                                   0.700000000000e+01, 0.152312500000e+03, 0.292583615853e-08, -0.529350941203e+00,      //
@@ -76,7 +76,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
                                                                   0.360000000000e+01, 0.455000000000e+03, 0.465661287308e-09, 0.116415321827e-08,       //
                                                                   0.391965000000e+06, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00),      //
                            },
-                       } },
+                       }) },
     },
 };
 
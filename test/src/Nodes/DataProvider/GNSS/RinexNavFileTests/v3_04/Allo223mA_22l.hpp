@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
         { { GST, GPST }, { 0.1600710675e-08, 0.355271368e-14 } },
     },
     .m_satellites = {
-        { { GAL, 12 }, Satellite{
+        { { GAL, 12 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GalileoEphemeris>(2022, 8, 11, 11, 10, 0, -0.109432556201e-03, -0.200373051484e-10, 0.000000000000e+00, //
                                                                   0.300000000000e+01, 0.152093750000e+03, 0.296619498250e-08, 0.594633784838e+00,       //
@@ -60,8 +60,8 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
                                                                   0.312000000000e+01, 0.000000000000e+00, -0.102445483208e-07, -0.100117176771e-07,     //
                                                                   0.390175000000e+06, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00),      //
                            },
-                       } },
-        { { GAL, 25 }, Satellite{
+                       }) },
+        { { GAL, 25 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GalileoEphemeris>(2022, 8, 11, 11, 0, 0, -0.584173365496e-03, -0.126476606965e-11, 0.000000000000e+00, //
                                                                   0.200000000000e+01, -0.361562500000e+02, 0.322799160166e-08, -0.274072844385e+01,    //
@@ -72,7 +72,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22l = {
                                                                   0.312000000000e+01, 0.000000000000e+00, 0.372529029846e-08, 0.419095158577e-08,      //
                                                                   0.385885000000e+06, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00),     //
                            },
-                       } },
+                       }) },
     },
 };
 
@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22n = {
         { { GPST, UTC }, { -0.9313225746e-09, 0.000000000e+00 } },
     },
     .m_satellites = {
-        { { GPS, 14 }, Satellite{
+        { { GPS, 14 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GPSEphemeris>(2022, 8, 11, 12, 0, 0, -0.109632965177e-03, 0.136424205266e-11, 0.000000000000e+00, //
                                                               0.310000000000e+02, -0.260312500000e+02, 0.486877423256e-08, -0.379655971818e+00,   //
@@ -52,8 +52,8 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22n = {
                                                               0.200000000000e+01, 0.000000000000e+00, -0.791624188423e-08, 0.543000000000e+03,    //
                                                               0.381618000000e+06, 0.400000000000e+01, 0.000000000000e+00, 0.000000000000e+00),    //
                            },
-                       } },
-        { { GPS, 22 }, Satellite{
+                       }) },
+        { { GPS, 22 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GPSEphemeris>(2022, 8, 11, 12, 0, 0, 0.307971611619e-03, 0.659383658785e-11, 0.000000000000e+00, //
                                                               0.780000000000e+02, -0.598750000000e+02, 0.393516391537e-08, 0.306181691022e+01,   //
@@ -64,7 +64,7 @@ const GnssNavInfo gnssNavInfo_Allo223mA_22n = {
                                                               0.200000000000e+01, 0.000000000000e+00, -0.791624188423e-08, 0.780000000000e+02,   //
                                                               0.381618000000e+06, 0.400000000000e+01, 0.000000000000e+00, 0.000000000000e+00),   //
                            },
-                       } },
+                       }) },
     },
 };
 
@@ -50,15 +50,15 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
         { { GST, GPST }, { -.1193257049e-08, -.666133815e-14 } },
     },
     .m_satellites = {
-        { { GLO, 18 }, Satellite{
+        { { GLO, 18 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GLONASSEphemeris>(2022, 11, 14, 18, 45, 0, .519901514053e-04, .181898940355e-11, .154770000000e+06, //
                                                                   .560945361328e+04, -.265369510651e+01, -.186264514923e-08, .000000000000e+00,     //
                                                                   .127987656250e+05, -.123060035706e+01, .931322574615e-09, -.300000000000e+01,     //
                                                                   .213490947266e+05, .144019031525e+01, -.931322574615e-09, .000000000000e+00),     //
                            },
-                       } },
-        { { GPS, 32 }, Satellite{
+                       }) },
+        { { GPS, 32 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GPSEphemeris>(2022, 11, 14, 20, 0, 0, -.296252779663e-03, -.126192389871e-10, .000000000000e+00, //
                                                               .520000000000e+02, -.325312500000e+02, .462376402690e-08, -.990179826541e+00,      //
@@ -69,8 +69,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                               .200000000000e+01, .000000000000e+00, .465661287308e-09, .520000000000e+02,        //
                                                               .151218000000e+06, .400000000000e+01),                                             //
                            },
-                       } },
-        { { BDS, 46 }, Satellite{
+                       }) },
+        { { BDS, 46 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<BDSEphemeris>(2022, 11, 14, 18, 0, 0, -.129309482872e-04, -.238742359215e-11, .000000000000e+00, //
                                                               .100000000000e+01, .248593750000e+02, .419124601079e-08, .240455317689e+01,        //
@@ -81,8 +81,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                               .200000000000e+01, .000000000000e+00, .188999997874e-07, .189000000000e-07,        //
                                                               .151200000000e+06, .100000000000e+01),                                             //
                            },
-                       } },
-        { { BDS, 36 }, Satellite{
+                       }) },
+        { { BDS, 36 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<BDSEphemeris>(2022, 11, 14, 18, 0, 0, -.841412344016e-03, .290620860710e-10, .000000000000e+00, //
                                                               .100000000000e+01, .221562500000e+02, .431696553323e-08, .290629546728e+01,       //
@@ -93,8 +93,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                               .200000000000e+01, .000000000000e+00, -.206999999364e-07, -.207000000000e-07,     //
                                                               .151200000000e+06, .100000000000e+01),                                            //
                            },
-                       } },
-        { { GLO, 9 }, Satellite{
+                       }) },
+        { { GLO, 9 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GLONASSEphemeris>(2022, 11, 14, 18, 45, 0, .875927507877e-04, .272848410532e-11, .154770000000e+06, //
                                                                  .113761904297e+05, .502119064331e+00, -.931322574615e-09, .000000000000e+00,      //
@@ -105,8 +105,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                                  .494732031250e+04, .281835746765e+01, .931322574615e-09, -.200000000000e+01,      //
                                                                  .215999653320e+05, -.116867733002e+01, -.931322574615e-09, .000000000000e+00),    //
                           },
-                      } },
-        { { GPS, 2 }, Satellite{
+                      }) },
+        { { GPS, 2 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2022, 11, 14, 20, 0, 0, -.637842342257e-03, .170530256582e-11, .000000000000e+00, //
                                                              .750000000000e+02, -.906250000000e+00, .437946813671e-08, .138757332166e+01,      //
@@ -117,8 +117,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                              .200000000000e+01, .000000000000e+00, -.176951289177e-07, .750000000000e+02,      //
                                                              .154758000000e+06, .400000000000e+01),                                            //
                           },
-                      } },
-        { { GAL, 21 }, Satellite{
+                      }) },
+        { { GAL, 21 }, std::make_shared<Satellite>(Satellite{
                            .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                                std::make_shared<GalileoEphemeris>(2022, 11, 14, 18, 20, 0, -.494624779094e-03, -.211741735257e-11, .000000000000e+00, //
                                                                   .126000000000e+03, .570000000000e+02, .301369696115e-08, .236341164000e+01,         //
@@ -129,8 +129,8 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                                   .360000000000e+01, .000000000000e+00, .209547579288e-08, .209547579288e-08,         //
                                                                   .153085000000e+06),                                                                 //
                            },
-                       } },
-        { { GAL, 9 }, Satellite{
+                       }) },
+        { { GAL, 9 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GalileoEphemeris>(2022, 11, 14, 18, 40, 0, -.729114806745e-03, -.134292577059e-10, .000000000000e+00, //
                                                                  .000000000000e+00, -.470937500000e+02, .311584407313e-08, .102047271698e+01,        //
@@ -141,7 +141,7 @@ const GnssNavInfo gnssNavInfo_INSA11DEU_R_20223181900_01H_01S_MN_RNX = {
                                                                  .312000000000e+01, .000000000000e+00, .139698386192e-08, .162981450558e-08,         //
                                                                  .154285000000e+06),                                                                 //
                           },
-                      } },
+                      }) },
     },
 };
 
@@ -36,7 +36,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19I = {
     .ionosphericCorrections = {},
     .timeSysCorr = {},
     .m_satellites = {
-        { { BDS, 5 }, Satellite{
+        { { BDS, 5 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<BDSEphemeris>(2019, 6, 6, 22, 0, 0, -2.213711850345e-04, -4.911271389574e-11, 0.000000000000e+00, //
                                                              1.000000000000e+00, -4.562968750000e+02, -3.752656313198e-09, -1.273125246548e+00,  //
@@ -55,8 +55,8 @@ const GnssNavInfo gnssNavInfo_INS_1580_19I = {
                                                              2.000000000000e+00, 0.000000000000e+00, -4.000000000000e-10, -8.900000000000e-09,   //
                                                              4.284276000000e+05, 0.000000000000e+00),                                            //
                           },
-                      } },
-        { { BDS, 6 }, Satellite{
+                      }) },
+        { { BDS, 6 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<BDSEphemeris>(2019, 6, 6, 20, 0, 0, 9.215852478519e-04, -3.255529179569e-11, 0.000000000000e+00, //
                                                              1.000000000000e+00, 7.567187500000e+01, 1.792931825664e-09, -1.855979805191e+00,   //
@@ -67,7 +67,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19I = {
                                                              2.000000000000e+00, 0.000000000000e+00, 8.100000000000e-09, -1.800000000000e-09,   //
                                                              4.176180000000e+05, 0.000000000000e+00),                                           //
                           },
-                      } },
+                      }) },
     },
 };
 
@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19L = {
         { { GST, UTC }, { -9.3132257462e-10, 0.000000000e+00 } },
     },
     .m_satellites = {
-        { { GAL, 2 }, Satellite{
+        { { GAL, 2 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GalileoEphemeris>(2019, 6, 6, 22, 40, 0, 6.366008892655e-05, 1.733724275255e-12, 0.000000000000e+00, //
                                                                  7.200000000000e+01, 1.047812500000e+02, 2.312596328920e-09, -7.626860954287e-01,   //
@@ -60,8 +60,8 @@ const GnssNavInfo gnssNavInfo_INS_1580_19L = {
                                                                  3.120000000000e+00, 0.000000000000e+00, -3.259629011154e-09, -4.190951585770e-09,  //
                                                                  4.284650000000e+05),                                                               //
                           },
-                      } },
-        { { GAL, 3 }, Satellite{
+                      }) },
+        { { GAL, 3 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GalileoEphemeris>(2019, 6, 6, 22, 50, 0, -1.744942856021e-04, -4.149569576839e-12, 0.000000000000e+00, //
                                                                  7.300000000000e+01, 1.693750000000e+01, 3.498717164185e-09, -2.962133938551e+00,     //
@@ -72,7 +72,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19L = {
                                                                  3.120000000000e+00, 0.000000000000e+00, 6.984919309616e-10, 9.313225746155e-10,      //
                                                                  4.284650000000e+05),                                                                 //
                           },
-                      } },
+                      }) },
     },
 };
 
@@ -41,7 +41,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19N = {
         { { GPST, UTC }, { -3.7252902985e-09, -7.105427358e-15 } },
     },
     .m_satellites = {
-        { { GPS, 1 }, Satellite{
+        { { GPS, 1 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2019, 6, 6, 22, 0, 0, -3.462424501777e-05, -9.436007530894e-12, 0.000000000000e+00, //
                                                              4.100000000000e+01, -1.273437500000e+02, 4.150530029093e-09, 2.600635796634e+00,    //
@@ -60,8 +60,8 @@ const GnssNavInfo gnssNavInfo_INS_1580_19N = {
                                                              2.000000000000e+00, 0.000000000000e+00, 5.587935447693e-09, 5.100000000000e+01,     //
                                                              4.248180000000e+05, 4.000000000000e+00),                                            //
                           },
-                      } },
-        { { GPS, 2 }, Satellite{
+                      }) },
+        { { GPS, 2 }, std::make_shared<Satellite>(Satellite{
                           .m_navigationData /* std::vector<std::shared_ptr<SatNavData>> */ = {
                               std::make_shared<GPSEphemeris>(2019, 6, 6, 22, 0, 0, -2.312315627933e-04, -8.981260180008e-12, 0.000000000000e+00, //
                                                              6.600000000000e+01, -1.488750000000e+02, 4.714482091388e-09, 2.879261055706e+00,    //
@@ -72,7 +72,7 @@ const GnssNavInfo gnssNavInfo_INS_1580_19N = {
                                                              2.000000000000e+00, 0.000000000000e+00, -2.048909664154e-08, 6.600000000000e+01,    //
                                                              4.240260000000e+05, 4.000000000000e+00),                                            //
                           },
-                      } },
+                      }) },
     },
 };
 
@@ -0,0 +1,142 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Sp3FileTests.cpp
+/// @brief Tests for the Sp3File node
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include "CatchMatchers.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "FlowTester.hpp"
+#include "Logger.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "Navigation/Constants.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/PreciseEphemeris.hpp"
+
+// This is a small hack, which lets us change private/protected parameters
+#pragma GCC diagnostic push
+#if defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wkeyword-macro"
+    #pragma GCC diagnostic ignored "-Wmacro-redefined"
+#endif
+#define protected public
+#define private public
+#include "Nodes/DataProvider/GNSS/FileReader/Sp3File.hpp"
+#undef protected
+#undef private
+#pragma GCC diagnostic pop
+
+namespace NAV::TESTS::Sp3FileTests
+{
+
+constexpr const char* SP3_FILE = "GNSS/BRDC_20230080000/COD0OPSFIN_20230080000_01D_05M_ORB.SP3";
+constexpr const char* CLK_FILE = "GNSS/BRDC_20230080000/COD0OPSFIN_20230080000_02H_05M_CLK_G01-G02-E01.CLK";
+
+/// @brief Runs the Sp3File.flow and checks the navigation data against the SP3 records
+/// @param[in] clockPath Path of the RINEX clock file
+/// @param[in] check Additional checks of the navigation data
+void testSp3FileFlow(const std::string& clockPath, const std::function<void(const GnssNavInfo&)>& check)
+{
+    auto logger = initializeTestLogger();
+
+    nm::RegisterPreInitCallback([&]() {
+        auto* node = dynamic_cast<Sp3File*>(nm::FindNode(2));
+        node->_path = SP3_FILE;
+        node->_clockPath = clockPath;
+    });
+
+    size_t nChecked = 0;
+    nm::RegisterCleanupCallback([&]() {
+        auto* pin = nm::FindOutputPin(1);
+        REQUIRE(pin != nullptr);
+        const auto* gnssNavInfo = static_cast<const GnssNavInfo*>(std::get<const void*>(pin->data));
+        REQUIRE(gnssNavInfo->nSatellites() == 77);
+
+        // The positions and clocks of the product epochs are reproduced
+        std::ifstream fs{ std::string("test/data/") + SP3_FILE, std::ios_base::binary };
+        REQUIRE(fs.good());
+        InsTime epoch;
+        std::string line;
+        while (std::getline(fs, line) && !line.starts_with("EOF"))
+        {
+            if (line.starts_with("* "))
+            {
+                epoch = InsTime{ std::stoi(line.substr(3, 4)), std::stoi(line.substr(8, 2)), std::stoi(line.substr(11, 2)),
+                                 std::stoi(line.substr(14, 2)), std::stoi(line.substr(17, 2)), std::stold(line.substr(20)), GPST };
+            }
+            else if (line.starts_with('P'))
+            {
+                SatId satId(SatelliteSystem::fromChar(line[1]), static_cast<uint16_t>(std::stoul(line.substr(2, 2))));
+                auto satNavData = gnssNavInfo->searchNavigationData(satId, epoch);
+                if (satNavData == nullptr) { continue; }
+                REQUIRE(satNavData->type == SatNavData::PreciseEphemeris);
+
+                auto e_refPos = 1e3 * Eigen::Vector3d(std::stod(line.substr(4, 14)), std::stod(line.substr(18, 14)), std::stod(line.substr(32, 14)));
+                REQUIRE_THAT((satNavData->calcSatellitePos(epoch).e_pos - e_refPos).norm(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+
+                auto posVel = satNavData->calcSatellitePosVel(epoch);
+                double dt_r = -2.0 * posVel.e_pos.dot(posVel.e_vel) / std::pow(InsConst<>::C, 2);
+                auto satClk = satNavData->calcClockCorrections(epoch, 0.0, G01);
+                REQUIRE_THAT(satClk.bias - dt_r - std::stod(line.substr(46, 14)) * 1e-6, Catch::Matchers::WithinAbs(0.0, 1e-12));
+                nChecked++;
+            }
+        }
+
+        check(*gnssNavInfo);
+    });
+
+    // ###########################################################################################################
+    //                                               Sp3File.flow
+    // ###########################################################################################################
+    //
+    //  2 Sp3File
+    //      1 GnssNavInfo <>
+    //
+    // ###########################################################################################################
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProvider/GNSS/Sp3File.flow"));
+    REQUIRE(nChecked > 0);
+}
+
+TEST_CASE("[Sp3File][flow] Read COD0OPSFIN_20230080000_01D_05M_ORB.SP3", "[Sp3File][flow]")
+{
+    testSp3FileFlow("", [](const GnssNavInfo& gnssNavInfo) {
+        auto satNavData = gnssNavInfo.searchNavigationData(SatId(GPS, 1), InsTime(2023, 1, 8, 12, 2, 30.0, GPST));
+        REQUIRE(satNavData != nullptr);
+        const auto& eph = dynamic_cast<const PreciseEphemeris&>(*satNavData);
+        REQUIRE(eph.firstEpoch() == InsTime(2023, 1, 8, 0, 0, 0.0, GPST));
+        REQUIRE(eph.lastEpoch() == InsTime(2023, 1, 9, 0, 0, 0.0, GPST));
+        REQUIRE_THAT(eph.calcSatellitePositionVariance(), Catch::Matchers::WithinAbs(std::pow(16e-3, 2), 1e-12)); // Accuracy exponent 4
+
+        REQUIRE(gnssNavInfo.searchNavigationData(SatId(GPS, 1), InsTime(2023, 1, 9, 0, 10, 0.0, GPST)) == nullptr);
+    });
+}
+
+TEST_CASE("[Sp3File][flow] Read COD0OPSFIN_20230080000_01D_05M_ORB.SP3 with RINEX clocks", "[Sp3File][flow]")
+{
+    testSp3FileFlow(CLK_FILE, [](const GnssNavInfo& gnssNavInfo) {
+        // The clock file covers the first two hours of G01, G02 and E01
+        InsTime afterClockFile(2023, 1, 8, 3, 0, 0.0, GPST);
+        REQUIRE(gnssNavInfo.searchNavigationData(SatId(GPS, 1), InsTime(2023, 1, 8, 1, 0, 0.0, GPST)) != nullptr);
+        REQUIRE(gnssNavInfo.searchNavigationData(SatId(GPS, 1), afterClockFile) == nullptr);
+        REQUIRE(gnssNavInfo.searchNavigationData(SatId(GAL, 1), afterClockFile) == nullptr);
+        REQUIRE(gnssNavInfo.searchNavigationData(SatId(GPS, 3), afterClockFile) != nullptr);
+    });
+}
+
+} // namespace NAV::TESTS::Sp3FileTests
@@ -0,0 +1,369 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SensorWatchdogTests.cpp
+/// @brief Tests for the sensor watchdog against pseudo-terminals which disappear and come back
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <cerrno>
+    #include <cstdlib>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <termios.h>
+    #include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "Logger.hpp"
+#include "Nodes/DataProvider/Protocol/SensorWatchdog.hpp"
+
+namespace NAV::TESTS::SensorWatchdogTests
+{
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+/// @brief Polls the condition until it is true or the timeout is reached
+/// @param[in] condition Condition to wait for
+/// @param[in] timeout Maximum time to wait
+bool waitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout = 3s)
+{
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        if (condition()) { return true; }
+        std::this_thread::sleep_for(5ms);
+    }
+    return condition();
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+
+/// @brief Simulated sensor, which writes lines into the master side of a pseudo-terminal.
+///        The slave side is reachable over a fixed symlink, like a udev rule would provide it for a real device.
+class PtyDevice
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] link Path of the symlink to the slave side
+    explicit PtyDevice(std::filesystem::path link) : _link(std::move(link)) {}
+    /// @brief Destructor
+    ~PtyDevice() { unplug(); }
+    /// @brief Copy constructor
+    PtyDevice(const PtyDevice&) = delete;
+    /// @brief Move constructor
+    PtyDevice(PtyDevice&&) = delete;
+    /// @brief Copy assignment operator
+    PtyDevice& operator=(const PtyDevice&) = delete;
+    /// @brief Move assignment operator
+    PtyDevice& operator=(PtyDevice&&) = delete;
+
+    /// @brief Creates a new pseudo-terminal and starts sending lines
+    void plugIn()
+    {
+        _master = posix_openpt(O_RDWR | O_NOCTTY);
+        REQUIRE(_master >= 0);
+        REQUIRE(grantpt(_master) == 0);
+        REQUIRE(unlockpt(_master) == 0);
+        std::string slaveName = ptsname(_master); // NOLINT(concurrency-mt-unsafe)
+
+        // Raw mode, so the line discipline does not echo the data back into the master
+        int slave = open(slaveName.c_str(), O_RDWR | O_NOCTTY); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        REQUIRE(slave >= 0);
+        termios tio{};
+        tcgetattr(slave, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(slave, TCSANOW, &tio);
+        close(slave);
+
+        std::filesystem::remove(_link);
+        std::filesystem::create_symlink(slaveName, _link);
+
+        _running = true;
+        _writer = std::thread([this]() {
+            while (_running)
+            {
+                std::string line = _sendCorrupt.exchange(false) ? "$CORRUPT\n" : "$DATA\n";
+                [[maybe_unused]] auto n = write(_master, line.data(), line.size());
+                std::this_thread::sleep_for(5ms);
+            }
+        });
+    }
+
+    /// @brief Stops sending and removes the pseudo-terminal, like a device which resets or a cable which is pulled
+    void unplug()
+    {
+        _running = false;
+        if (_writer.joinable()) { _writer.join(); }
+        if (_master >= 0)
+        {
+            close(_master);
+            _master = -1;
+        }
+        std::filesystem::remove(_link);
+    }
+
+    /// @brief Sends a line with a wrong checksum
+    void sendCorrupt() { _sendCorrupt = true; }
+
+  private:
+    std::filesystem::path _link;                ///< Path of the symlink to the slave side
+    int _master = -1;                           ///< File descriptor of the master side
+    std::atomic<bool> _running = false;         ///< Flag whether the writer should run
+    std::atomic<bool> _sendCorrupt = false;     ///< Flag to send a corrupt line
+    std::thread _writer;                        ///< Thread writing the lines
+};
+
+/// @brief Minimal reader in the style of the uart library. The read thread ends silently, when the device disappears.
+class PtyReader
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] link Path of the device
+    /// @param[in] watchdog Watchdog to report the packets to
+    PtyReader(std::filesystem::path link, SensorWatchdog& watchdog) : _link(std::move(link)), _watchdog(watchdog) {}
+    /// @brief Destructor
+    ~PtyReader() { disconnect(); }
+    /// @brief Copy constructor
+    PtyReader(const PtyReader&) = delete;
+    /// @brief Move constructor
+    PtyReader(PtyReader&&) = delete;
+    /// @brief Copy assignment operator
+    PtyReader& operator=(const PtyReader&) = delete;
+    /// @brief Move assignment operator
+    PtyReader& operator=(PtyReader&&) = delete;
+
+    /// @brief Opens the device and starts the read thread
+    /// @return True if the device could be opened
+    bool connect()
+    {
+        int fd = open(_link.c_str(), O_RDONLY | O_NOCTTY); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        if (fd < 0) { return false; }
+        _fd = fd;
+        _stop = false;
+        _reader = std::thread([this]() {
+            std::string line;
+            std::array<char, 64> buffer{};
+            while (!_stop)
+            {
+                pollfd pfd{ .fd = _fd, .events = POLLIN, .revents = 0 };
+                if (poll(&pfd, 1, 10) == 0) { continue; }
+                auto n = read(_fd, buffer.data(), buffer.size());
+                if (n <= 0 && errno == EINTR) { continue; }
+                if (n <= 0) { break; } // Device disappeared (EIO) or was closed
+                for (ssize_t i = 0; i < n; i++)
+                {
+                    if (buffer.at(static_cast<size_t>(i)) != '\n')
+                    {
+                        line.push_back(buffer.at(static_cast<size_t>(i)));
+                        continue;
+                    }
+                    if (line == "$DATA") { _watchdog.notifyPacket(); }
+                    else { _watchdog.notifyChecksumError(); }
+                    line.clear();
+                }
+            }
+        });
+        return true;
+    }
+
+    /// @brief Closes the device
+    void disconnect()
+    {
+        _stop = true;
+        if (_reader.joinable()) { _reader.join(); }
+        if (_fd >= 0)
+        {
+            close(_fd);
+            _fd = -1;
+        }
+    }
+
+    /// @brief Disconnects and connects again (the reconnect function of the watchdog)
+    bool reconnect()
+    {
+        disconnect();
+        return connect();
+    }
+
+  private:
+    std::filesystem::path _link;     ///< Path of the device
+    SensorWatchdog& _watchdog;       ///< Watchdog to report the packets to
+    int _fd = -1;                    ///< File descriptor of the opened device
+    std::atomic<bool> _stop = false; ///< Flag to stop the read thread
+    std::thread _reader;             ///< Read thread
+};
+
+#endif
+
+} // namespace
+
+TEST_CASE("[SensorWatchdog] Settings are restored from json", "[SensorWatchdog]")
+{
+    auto logger = initializeTestLogger();
+
+    SensorWatchdog watchdog;
+    watchdog.enabled = false;
+    watchdog.timeout = 1.5;
+    watchdog.initialBackoff = 0.25;
+    watchdog.maxBackoff = 8.0;
+    json j = watchdog;
+
+    SensorWatchdog restored;
+    j.get_to(restored);
+    REQUIRE(restored.enabled == false);
+    REQUIRE(restored.timeout == 1.5);
+    REQUIRE(restored.initialBackoff == 0.25);
+    REQUIRE(restored.maxBackoff == 8.0);
+
+    // Disabled watchdogs count, but do not monitor
+    restored.start("Disabled", []() { return true; });
+    REQUIRE(!restored.isRunning());
+    restored.notifyPacket();
+    REQUIRE(restored.health().packets == 1);
+}
+
+TEST_CASE("[SensorWatchdog] No reconnect while data is flowing", "[SensorWatchdog]")
+{
+    auto logger = initializeTestLogger();
+
+    SensorWatchdog watchdog;
+    watchdog.timeout = 0.1;
+
+    std::atomic<size_t> reconnects = 0;
+    watchdog.start("Flowing", [&]() { reconnects++; return true; });
+    REQUIRE(watchdog.isRunning());
+
+    auto end = std::chrono::steady_clock::now() + 400ms;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        watchdog.notifyPacket();
+        std::this_thread::sleep_for(10ms);
+    }
+    watchdog.stop();
+
+    auto health = watchdog.health();
+    REQUIRE(reconnects == 0);
+    REQUIRE(health.gaps == 0);
+    REQUIRE(health.packets >= 20);
+    REQUIRE(!watchdog.isRunning());
+}
+
+TEST_CASE("[SensorWatchdog] Exponential backoff", "[SensorWatchdog]")
+{
+    auto logger = initializeTestLogger();
+
+    SensorWatchdog watchdog;
+    watchdog.timeout = 0.05;
+    watchdog.initialBackoff = 0.02;
+    watchdog.maxBackoff = 0.08;
+
+    std::mutex mutex;
+    std::vector<std::chrono::steady_clock::time_point> attempts;
+    watchdog.start("Backoff", [&]() {
+        std::scoped_lock lk(mutex);
+        attempts.push_back(std::chrono::steady_clock::now());
+        if (attempts.size() == 3) { throw std::runtime_error("Device not found"); } // Exceptions count as failed attempts
+        return false;
+    });
+
+    REQUIRE(waitFor([&]() { std::scoped_lock lk(mutex); return attempts.size() >= 7; }));
+    auto stopRequest = std::chrono::steady_clock::now();
+    watchdog.stop();
+    REQUIRE(std::chrono::steady_clock::now() - stopRequest < 200ms); // Stop does not wait for the backoff to elapse
+
+    auto health = watchdog.health();
+    REQUIRE(health.gaps == 1);
+    REQUIRE(health.reconnects == 0);
+    REQUIRE(health.failedReconnects >= 6);
+
+    std::scoped_lock lk(mutex);
+    std::vector<double> expected = { 0.02, 0.04, 0.08, 0.08, 0.08, 0.08 };
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        double delay = std::chrono::duration<double>(attempts.at(i + 1) - attempts.at(i)).count();
+        INFO("Delay " << i << ": " << delay << " s (expected " << expected.at(i) << " s)");
+        REQUIRE(delay >= expected.at(i) * 0.9);
+        REQUIRE(delay < expected.at(i) + 1.0); // Only catches a broken backoff, as the scheduling on loaded machines is arbitrary
+    }
+}
+
+#if defined(__linux__) || defined(__APPLE__)
+
+TEST_CASE("[SensorWatchdog] Reconnect to a pseudo-terminal which disappears and comes back", "[SensorWatchdog]")
+{
+    auto logger = initializeTestLogger();
+
+    auto link = std::filesystem::temp_directory_path() / fmt::format("INSTINCT_SensorWatchdogTests_{}", getpid());
+
+    SensorWatchdog watchdog;
+    watchdog.timeout = 0.1;
+    watchdog.initialBackoff = 0.02;
+    watchdog.maxBackoff = 0.1;
+
+    PtyDevice device(link);
+    PtyReader reader(link, watchdog);
+
+    device.plugIn();
+    REQUIRE(reader.connect());
+    watchdog.start("PTY", [&]() { return reader.reconnect(); });
+
+    REQUIRE(waitFor([&]() { return watchdog.health().packets >= 10; }));
+    device.sendCorrupt();
+    REQUIRE(waitFor([&]() { return watchdog.health().checksumErrors == 1; }));
+    REQUIRE(watchdog.health().gaps == 0);
+
+    // Device disappears: the reader goes silent and the reconnect attempts fail, until the device is back
+    device.unplug();
+    REQUIRE(waitFor([&]() { return watchdog.health().failedReconnects >= 2; }));
+    auto health = watchdog.health();
+    REQUIRE(health.gaps == 1);
+    REQUIRE(health.reconnects == 0);
+    REQUIRE(!health.connected);
+
+    size_t packetsBefore = health.packets;
+    device.plugIn();
+    REQUIRE(waitFor([&]() { return watchdog.health().reconnects == 1; }));
+    REQUIRE(waitFor([&]() { return watchdog.health().packets >= packetsBefore + 10; }));
+    health = watchdog.health();
+    REQUIRE(health.connected);
+    REQUIRE(health.gaps == 1);
+
+    // A second outage is detected as well
+    device.unplug();
+    REQUIRE(waitFor([&]() { return watchdog.health().gaps == 2; }));
+    device.plugIn();
+    REQUIRE(waitFor([&]() { return watchdog.health().reconnects == 2; }));
+    REQUIRE(waitFor([&]() { return watchdog.health().timeSinceLastPacket < 50ms; }));
+
+    watchdog.stop();
+    reader.disconnect();
+    device.unplug();
+    REQUIRE(!std::filesystem::exists(link));
+}
+
+#endif
+
+} // namespace NAV::TESTS::SensorWatchdogTests
@@ -0,0 +1,156 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file EngineTests.cpp
+/// @brief Tests for embedding the flow engine
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Logger.hpp"
+#include "internal/Engine.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "NodeRegistry.hpp"
+#include "Nodes/Utility/Merger.hpp"
+
+namespace NAV::TESTS::EngineTests
+{
+namespace
+{
+
+/// @brief Options of the engine using the test directories
+Engine::Options testOptions()
+{
+    Engine::Options options;
+    options.inputPath = "test/data";
+    options.outputPath = "test/logs";
+    return options;
+}
+
+/// @brief Creates data at the given time of week
+std::shared_ptr<const NodeData> makeData(double tow)
+{
+    auto data = std::make_shared<NodeData>();
+    data->insTime = InsTime(2, 230, tow);
+    return data;
+}
+
+/// @brief Checks that the received data is sorted by time
+bool isSorted(const std::vector<std::shared_ptr<const NodeData>>& data)
+{
+    return std::is_sorted(data.begin(), data.end(), [](const auto& lhs, const auto& rhs) { return lhs->insTime < rhs->insTime; });
+}
+
+/// @brief Amount of registered node types
+size_t registeredNodeTypes()
+{
+    size_t count = 0;
+    for (const auto& [category, nodeInfos] : NodeRegistry::RegisteredNodes()) { count += nodeInfos.size(); }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("[Engine] Run a constructed flow repeatedly", "[Engine]")
+{
+    auto logger = initializeTestLogger();
+
+    size_t nodeTypes = 0;
+    for (size_t iteration = 0; iteration < 5; iteration++)
+    {
+        {
+            Engine engine(testOptions());
+            if (iteration == 0) { nodeTypes = registeredNodeTypes(); }
+            REQUIRE(registeredNodeTypes() == nodeTypes);
+            REQUIRE(nm::m_Nodes().empty());
+
+            auto* inputA = engine.addInput("A");
+            auto* inputB = engine.addInput("B");
+            auto* merger = engine.addNode<Merger>();
+            auto* output = engine.addOutput("Output");
+            REQUIRE(Engine::link(inputA, 0, merger, 0));
+            REQUIRE(Engine::link(inputB, 0, merger, 1));
+            REQUIRE(Engine::link(merger, 0, output, 0));
+            REQUIRE(!Engine::link(merger, 1, output, 0));
+            REQUIRE(Engine::findNode("Output") == output);
+
+            // Pushed out of order, sent in order
+            for (size_t i = 10; i-- > 0;)
+            {
+                inputA->push(makeData(static_cast<double>(2 * i)));
+                inputB->push(makeData(static_cast<double>(2 * i + 1)));
+            }
+            REQUIRE(inputA->size() == 10);
+
+            REQUIRE(engine.run());
+            REQUIRE(output->received().size() == 20);
+            REQUIRE(isSorted(output->received()));
+
+            // The inputs replay their data on every run
+            output->clear();
+            REQUIRE(engine.run());
+            REQUIRE(output->received().size() == 20);
+            REQUIRE(isSorted(output->received()));
+
+            size_t calls = 0;
+            output->setCallback([&calls](const std::shared_ptr<const NodeData>&) { calls++; });
+            REQUIRE(engine.run());
+            REQUIRE(calls == 20);
+        }
+        REQUIRE(nm::m_Nodes().empty());
+    }
+}
+
+TEST_CASE("[Engine] Step a flow in time", "[Engine]")
+{
+    auto logger = initializeTestLogger();
+
+    Engine engine(testOptions());
+
+    auto* inputA = engine.addInput("A");
+    auto* inputB = engine.addInput("B");
+    auto* merger = engine.addNode<Merger>();
+    auto* output = engine.addOutput("Output");
+    REQUIRE(Engine::link(inputA, 0, merger, 0));
+    REQUIRE(Engine::link(inputB, 0, merger, 1));
+    REQUIRE(Engine::link(merger, 0, output, 0));
+
+    REQUIRE(!engine.stepUntil(InsTime(2, 230, 100.0))); // Not started
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        inputA->push(makeData(static_cast<double>(2 * i)));
+        inputB->push(makeData(static_cast<double>(2 * i + 1)));
+    }
+    REQUIRE(engine.start());
+
+    REQUIRE(engine.stepUntil(InsTime(2, 230, 3.0)));
+    REQUIRE(output->received().size() == 4);
+    REQUIRE(engine.stepUntil(InsTime(2, 230, 3.5)));
+    REQUIRE(output->received().size() == 4);
+
+    // Data can be fed while the flow is running
+    inputA->push(makeData(10.0));
+    REQUIRE(engine.stepUntil(InsTime(2, 230, 100.0)));
+    REQUIRE(output->received().size() == 11);
+    REQUIRE(isSorted(output->received()));
+
+    engine.stop();
+
+    // Running to completion after stepping replays all data
+    output->clear();
+    REQUIRE(engine.run());
+    REQUIRE(output->received().size() == 11);
+}
+
+} // namespace NAV::TESTS::EngineTests
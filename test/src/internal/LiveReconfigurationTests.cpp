@@ -0,0 +1,148 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LiveReconfigurationTests.cpp
+/// @brief Tests for the live reconfiguration of node parameters
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Logger.hpp"
+#include "internal/LiveReconfiguration.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "Nodes/DataProcessor/KalmanFilter/LooselyCoupledKF.hpp"
+#include "util/Eigen.hpp"
+
+namespace NAV::TESTS::LiveReconfigurationTests
+{
+
+TEST_CASE("[LiveReconfiguration] Parameters requiring a restart", "[LiveReconfiguration]")
+{
+    auto logger = initializeTestLogger();
+
+    std::vector<std::string> liveParameters = { "/stdev_ra", "/algorithm/raim", "/algorithm/robustK0" };
+
+    REQUIRE(LiveReconfiguration::restartParameters(json::object(), liveParameters).empty());
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "stdev_ra", { 1.0, 2.0, 3.0 } } }, liveParameters).empty());
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "algorithm", { { "robustK0", 2.0 } } } }, liveParameters).empty());
+    // A pointer includes all its children
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "algorithm", { { "raim", { { "enabled", true }, { "maxExclusions", 2 } } } } } }, liveParameters).empty());
+
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "frame", 1 } }, liveParameters) == std::vector<std::string>{ "/frame" });
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "algorithm", { { "robustK0", 2.0 }, { "robustK1", 4.0 } } } }, liveParameters)
+            == std::vector<std::string>{ "/algorithm/robustK1" });
+    // Only complete keys match, not prefixes of the names
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "stdev_ra2", 1.0 } }, liveParameters) == std::vector<std::string>{ "/stdev_ra2" });
+    REQUIRE(LiveReconfiguration::restartParameters(json{ { "stdev_ra", 1.0 } }, {}) == std::vector<std::string>{ "/stdev_ra" });
+}
+
+TEST_CASE("[LiveReconfiguration] Types and enum values", "[LiveReconfiguration]")
+{
+    auto logger = initializeTestLogger();
+
+    json reference = {
+        { "flag", true },
+        { "value", 1.0 },
+        { "vector", Eigen::Vector3d(1.0, std::nan(""), 3.0) },
+        { "list", { 1, 2 } },
+        { "unit", 1 },
+        { "optional", nullptr },
+    };
+
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "flag", false }, { "value", 2 }, { "unit", 0 } }, reference).empty());
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "vector", Eigen::Vector3d(4.0, 5.0, std::nan("")) } }, reference).empty());
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "optional", "text" }, { "unknown", "text" } }, reference).empty());
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "flag", 1 } }, reference) == std::vector<std::string>{ "/flag" });
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "value", "1.0" } }, reference) == std::vector<std::string>{ "/value" });
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "vector", { 4.0, 5.0, 6.0 } } }, reference) == std::vector<std::string>{ "/vector" });
+    REQUIRE(LiveReconfiguration::typeMismatches(json{ { "list", { 1, true } } }, reference) == std::vector<std::string>{ "/list/1" });
+
+    json current = LiveReconfiguration::currentValues(json{ { "vector", { { "1", { { "0", 2.0 } } } } }, { "unit", 0 }, { "unknown", 1 } }, reference);
+    REQUIRE(current == json{ { "vector", { { "1", { { "0", "NaN" } } } } }, { "unit", 1 } });
+
+    REQUIRE(LiveReconfiguration::isValidEnumValue(json{ { "unit", 1 } }, "/unit", 2));
+    REQUIRE(LiveReconfiguration::isValidEnumValue(json{ { "other", 5 } }, "/unit", 2));
+    REQUIRE(!LiveReconfiguration::isValidEnumValue(json{ { "unit", 2 } }, "/unit", 2));
+    REQUIRE(!LiveReconfiguration::isValidEnumValue(json{ { "unit", -1 } }, "/unit", 2));
+    REQUIRE(!LiveReconfiguration::isValidEnumValue(json{ { "unit", 0.5 } }, "/unit", 2));
+}
+
+TEST_CASE("[LiveReconfiguration] Apply to a node", "[LiveReconfiguration]")
+{
+    auto logger = initializeTestLogger();
+
+    auto* node = new LooselyCoupledKF(); // NOLINT(cppcoreguidelines-owning-memory)
+    nm::AddNode(node);
+
+    REQUIRE(LiveReconfiguration::findNode(std::to_string(size_t(node->id))) == node);
+    REQUIRE(LiveReconfiguration::findNode(fmt::format("node-{}", size_t(node->id))) == node);
+    REQUIRE(LiveReconfiguration::findNode(node->name) == node);
+    REQUIRE(LiveReconfiguration::findNode("NotExistingNode") == nullptr);
+
+    REQUIRE(!node->liveParameters().empty());
+    REQUIRE(!LiveReconfiguration::apply(json{ { "NotExistingNode", { { "tau_bad", 1.0 } } } }));
+    REQUIRE(!LiveReconfiguration::apply(json{ { node->name, 1.0 } }));
+    REQUIRE(!LiveReconfiguration::apply(json::array()));
+
+    // While the node is not initialized, every parameter can be changed
+    json tau_bad = node->save().at("tau_bad");
+    json newTau_bad = Eigen::Vector3d(10.0, 20.0, 30.0);
+    REQUIRE(LiveReconfiguration::apply(json{ { node->name, { { "tau_bad", newTau_bad }, { "preintegrateBetweenUpdates", true } } } }));
+    json j = node->save();
+    REQUIRE(j.at("tau_bad") == newTau_bad);
+    REQUIRE(j.at("tau_bad") != tau_bad);
+    REQUIRE(j.at("preintegrateBetweenUpdates") == true);
+
+    nm::DeleteAllNodes();
+}
+
+TEST_CASE("[LiveReconfiguration] Invalid parameters of an initialized node are rejected", "[LiveReconfiguration]")
+{
+    auto logger = initializeTestLogger();
+
+    auto* node = new LooselyCoupledKF(); // NOLINT(cppcoreguidelines-owning-memory)
+    nm::AddNode(node);
+    auto* other = new LooselyCoupledKF(); // NOLINT(cppcoreguidelines-owning-memory)
+    nm::AddNode(other);
+    REQUIRE(node->doInitialize(true));
+    REQUIRE(other->doInitialize(true));
+    std::string id = std::to_string(size_t(node->id));
+    std::string otherId = std::to_string(size_t(other->id));
+
+    json saved = node->save();
+    json otherSaved = other->save();
+
+    // Wrong types
+    REQUIRE(!LiveReconfiguration::apply(json{ { id, { { "checkKalmanMatricesRanks", "yes" } } } }));
+    REQUIRE(!LiveReconfiguration::apply(json{ { id, { { "stdev_ra", { 1.0, 2.0, 3.0 } } } } }));
+    REQUIRE(!node->doReconfigure(json{ { "stdevAccelNoiseUnits", "mg_sqrtHz" } }));
+    // Units out of range
+    REQUIRE(!LiveReconfiguration::apply(json{ { id, { { "stdevAccelNoiseUnits", 2 } } } }));
+    REQUIRE(!node->doReconfigure(json{ { "gnssMeasurementUncertaintyPositionUnit", -1 } }));
+    REQUIRE(node->save() == saved);
+
+    // Nothing is applied if the parameters of one node are invalid
+    REQUIRE(!LiveReconfiguration::apply(json{ { id, { { "stdevAccelNoiseUnits", 1 } } }, { otherId, { { "stdevGyroNoiseUnits", 5 } } } }));
+    REQUIRE(node->save() == saved);
+    REQUIRE(other->save() == otherSaved);
+
+    REQUIRE(node->isInitialized());
+    REQUIRE(LiveReconfiguration::apply(json{ { id, { { "stdevAccelNoiseUnits", 1 } } }, { otherId, { { "stdevGyroNoiseUnits", 1 } } } }));
+    REQUIRE(node->save().at("stdevAccelNoiseUnits") == 1);
+    REQUIRE(other->save().at("stdevGyroNoiseUnits") == 1);
+
+    nm::DeleteAllNodes();
+}
+
+} // namespace NAV::TESTS::LiveReconfigurationTests
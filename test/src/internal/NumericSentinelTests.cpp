@@ -0,0 +1,199 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NumericSentinelTests.cpp
+/// @brief Tests for the checks of the data published on output pins
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include "Logger.hpp"
+#include "internal/Engine.hpp"
+#include "internal/NumericSentinel.hpp"
+#include "NodeData/General/DynamicData.hpp"
+#include "NodeData/IMU/ImuObs.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::NumericSentinelTests
+{
+namespace
+{
+
+/// @brief Creates a valid state
+std::shared_ptr<PosVelAtt> makeState()
+{
+    auto state = std::make_shared<PosVelAtt>();
+    state->insTime = InsTime(2, 230, 100.0);
+    state->setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), 300.0), Eigen::Vector3d(1.0, 2.0, 0.1),
+                      Eigen::Quaterniond::Identity());
+    return state;
+}
+
+} // namespace
+
+TEST_CASE("[NumericSentinel] Detect NaN, Inf and implausible magnitudes", "[NumericSentinel]")
+{
+    auto logger = initializeTestLogger();
+
+    NumericSentinel::setSettings(NumericSentinel::Settings{});
+    NumericSentinel::reset();
+    Engine::Input node("Publisher", { PosVelAtt::type() });
+
+    REQUIRE(NumericSentinel::check(node, 0, *makeState()));
+    REQUIRE(!NumericSentinel::firstViolation().has_value());
+    REQUIRE(NumericSentinel::violationCount() == 0);
+
+    auto state = makeState();
+    state->setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), 300.0), Eigen::Vector3d(1.0, std::nan(""), 0.1),
+                      Eigen::Quaterniond::Identity());
+    REQUIRE(NumericSentinel::check(node, 0, *state)); // Not halting
+    auto violation = NumericSentinel::firstViolation();
+    REQUIRE(violation.has_value());
+    REQUIRE(violation->node == node.nameId());
+    REQUIRE(violation->pin == "Output");
+    REQUIRE(violation->insTime == state->insTime);
+    REQUIRE(violation->field == "Velocity norm [m/s]"); // First field depending on the velocity
+    REQUIRE(violation->reason == "NaN");
+
+    // Only the first violation is recorded
+    auto infState = makeState();
+    infState->insTime = InsTime(2, 230, 101.0);
+    infState->setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), std::numeric_limits<double>::infinity()),
+                         Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+    REQUIRE(NumericSentinel::check(node, 0, *infState));
+    REQUIRE(NumericSentinel::violationCount() == 2);
+    REQUIRE(NumericSentinel::firstViolation()->insTime == state->insTime);
+
+    // Implausible magnitude
+    NumericSentinel::reset();
+    auto fastState = makeState();
+    fastState->setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), 300.0), Eigen::Vector3d(2e5, 0.0, 0.0),
+                          Eigen::Quaterniond::Identity());
+    REQUIRE(NumericSentinel::check(node, 0, *fastState));
+    REQUIRE(NumericSentinel::firstViolation()->field == "Velocity norm [m/s]");
+    REQUIRE(NumericSentinel::firstViolation()->value == 2e5);
+
+    // Ignored fields and dynamic data
+    NumericSentinel::reset();
+    auto settings = NumericSentinel::settings();
+    settings.ignored = { "velocity", "Velocity" };
+    NumericSentinel::setSettings(settings);
+    REQUIRE(NumericSentinel::check(node, 0, *fastState));
+    REQUIRE(NumericSentinel::violationCount() == 0);
+
+    auto dynamicData = std::make_shared<DynamicData>();
+    dynamicData->insTime = InsTime(2, 230, 102.0);
+    dynamicData->data.push_back(DynamicData::Data{ .description = "Residual [m]", .value = 1.0, .events = {} });
+    dynamicData->data.push_back(DynamicData::Data{ .description = "Innovation [m]", .value = -1e13, .events = {} });
+    REQUIRE(NumericSentinel::check(node, 0, *dynamicData));
+    REQUIRE(NumericSentinel::firstViolation()->field == "Innovation [m]");
+
+    NumericSentinel::setSettings(NumericSentinel::Settings{});
+    NumericSentinel::reset();
+}
+
+TEST_CASE("[NumericSentinel] Time stamps in nanoseconds are not limited", "[NumericSentinel]")
+{
+    auto logger = initializeTestLogger();
+
+    NumericSentinel::setSettings(NumericSentinel::Settings{});
+    NumericSentinel::reset();
+    Engine::Input node("Publisher", { ImuObs::type() });
+
+    ImuPos imuPos;
+    auto obs = std::make_shared<ImuObs>(imuPos);
+    obs->insTime = InsTime(2, 230, 100.0);
+    obs->timeSinceStartup = 8ULL * 3600ULL * 1000000000ULL; // 8 hours after the start of the sensor
+    obs->accelUncompXYZ = Eigen::Vector3d(0.1, -0.2, -9.81);
+    obs->gyroUncompXYZ = Eigen::Vector3d(1e-3, 2e-3, -1e-3);
+    REQUIRE(NumericSentinel::check(node, 0, *obs));
+    REQUIRE(NumericSentinel::violationCount() == 0);
+
+    // The other fields are still checked
+    obs->accelUncompXYZ = Eigen::Vector3d(0.1, std::nan(""), -9.81);
+    REQUIRE(NumericSentinel::check(node, 0, *obs));
+    REQUIRE(NumericSentinel::firstViolation()->field == "Accel uncomp Y [m/s^2]");
+
+    NumericSentinel::setSettings(NumericSentinel::Settings{});
+    NumericSentinel::reset();
+}
+
+TEST_CASE("[NumericSentinel] Halt at the pin boundary", "[NumericSentinel]")
+{
+    auto logger = initializeTestLogger();
+
+    Engine engine;
+    NumericSentinel::Settings settings;
+    settings.halt = true;
+    NumericSentinel::setSettings(settings);
+    NumericSentinel::reset();
+
+    auto* input = engine.addInput("Input", { PosVelAtt::type() });
+    auto* output = engine.addOutput("Output", { PosVelAtt::type() });
+    REQUIRE(Engine::link(input, 0, output, 0));
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        auto state = makeState();
+        state->insTime = InsTime(2, 230, 100.0 + static_cast<double>(i));
+        if (i == 5)
+        {
+            state->setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(200.0), 300.0), Eigen::Vector3d::Zero(), Eigen::Quaterniond::Identity());
+        }
+        input->push(state);
+    }
+
+    NumericSentinel::setEnabled(true);
+    engine.run();
+    NumericSentinel::setEnabled(false);
+
+    auto violation = NumericSentinel::firstViolation();
+    REQUIRE(violation.has_value());
+    REQUIRE(violation->node == input->nameId());
+    REQUIRE(violation->insTime == InsTime(2, 230, 105.0));
+    REQUIRE(violation->field == "Longitude [deg]");
+    // Neither the offending message nor later messages are passed on
+    REQUIRE(output->received().size() <= 5);
+    for (const auto& data : output->received()) { REQUIRE(data->insTime < violation->insTime); }
+
+    NumericSentinel::setSettings(NumericSentinel::Settings{});
+    NumericSentinel::reset();
+}
+
+TEST_CASE("[NumericSentinel] Overhead at the pin boundary", "[NumericSentinel][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    Engine::Input node("Publisher", { PosVelAtt::type() });
+    node.callbacksEnabled = true;
+    std::shared_ptr<const NodeData> state = makeState();
+
+    NumericSentinel::setEnabled(false);
+    BENCHMARK("Disabled")
+    {
+        for (size_t i = 0; i < 1000; i++) { node.invokeCallbacks(0, state); }
+        return state.use_count();
+    };
+
+    NumericSentinel::setEnabled(true);
+    BENCHMARK("Enabled")
+    {
+        for (size_t i = 0; i < 1000; i++) { node.invokeCallbacks(0, state); }
+        return state.use_count();
+    };
+    NumericSentinel::setEnabled(false);
+    REQUIRE(NumericSentinel::violationCount() == 0);
+}
+
+} // namespace NAV::TESTS::NumericSentinelTests
@@ -0,0 +1,226 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file CommonLogTests.cpp
+/// @brief Tests for the run context shared by the loggers
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <latch>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "util/Logger/CommonLog.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::TESTS::CommonLogTests
+{
+
+namespace
+{
+
+/// @brief Logger which exposes the run context
+class TestLog : public CommonLog
+{
+  public:
+    TestLog() = default;
+    using CommonLog::startTime;
+};
+
+/// @brief Calls the run context functions from several threads, which all start at the same time
+/// @param[in] runContext Context shared by the threads
+/// @param[in] nThreads Amount of threads
+/// @param[in] nSamples Amount of samples per thread
+/// @param[in] startTime Time of the first sample of the first thread
+/// @return Sum of all results (to prevent the calls from being optimized away)
+double logFromThreads(CommonLog::RunContext& runContext, size_t nThreads, size_t nSamples, const InsTime& startTime)
+{
+    std::latch start(static_cast<std::ptrdiff_t>(nThreads));
+    std::vector<double> sums(nThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            start.arrive_and_wait();
+            double sum = 0.0;
+            for (size_t i = 0; i < nSamples; i++)
+            {
+                auto dt = static_cast<double>(t + i) * 0.01;
+                sum += runContext.calcTimeIntoRun(startTime + std::chrono::duration<double>(dt));
+                auto localPosition = runContext.calcLocalPosition(Eigen::Vector3d(deg2rad(48.78 + 1e-6 * dt), deg2rad(9.18 + 1e-6 * dt), 300.0));
+                sum += localPosition.northSouth + localPosition.eastWest;
+            }
+            sums.at(t) = sum;
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    return std::accumulate(sums.begin(), sums.end(), 0.0);
+}
+
+} // namespace
+
+TEST_CASE("[CommonLog] First sample defines the run context", "[CommonLog]")
+{
+    auto logger = initializeTestLogger();
+
+    TestLog log;
+    REQUIRE(log.startTime().empty());
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0);
+    REQUIRE(log.calcTimeIntoRun(startTime) == 0.0);
+    REQUIRE_THAT(log.calcTimeIntoRun(startTime + std::chrono::seconds(10)), Catch::Matchers::WithinAbs(10.0, 1e-9));
+    REQUIRE_THAT(log.calcTimeIntoRun(startTime - std::chrono::seconds(2)), Catch::Matchers::WithinAbs(-2.0, 1e-9));
+    REQUIRE(log.startTime() == startTime);
+
+    // Positions without latitude or longitude do not define the origin
+    auto localPosition = log.calcLocalPosition(Eigen::Vector3d(std::nan(""), deg2rad(9.0), 0.0));
+    REQUIRE(std::isnan(localPosition.northSouth));
+    REQUIRE(std::isnan(localPosition.eastWest));
+
+    Eigen::Vector3d lla_origin(deg2rad(48.0), deg2rad(9.0), 300.0);
+    localPosition = log.calcLocalPosition(lla_origin);
+    REQUIRE(localPosition.northSouth == 0.0);
+    REQUIRE(localPosition.eastWest == 0.0);
+
+    localPosition = log.calcLocalPosition(Eigen::Vector3d(deg2rad(48.001), deg2rad(8.999), 300.0));
+    REQUIRE(localPosition.northSouth > 100.0);
+    REQUIRE(localPosition.eastWest < -70.0);
+
+    // A new run gets a new context
+    log.setRunContext(std::make_shared<CommonLog::RunContext>());
+    REQUIRE(log.startTime().empty());
+    REQUIRE(log.calcTimeIntoRun(startTime + std::chrono::seconds(10)) == 0.0);
+    localPosition = log.calcLocalPosition(Eigen::Vector3d(deg2rad(48.001), deg2rad(8.999), 300.0));
+    REQUIRE(localPosition.northSouth == 0.0);
+    REQUIRE(localPosition.eastWest == 0.0);
+}
+
+TEST_CASE("[CommonLog] Loggers share the run context of their flow only", "[CommonLog]")
+{
+    auto logger = initializeTestLogger();
+
+    auto flow1 = std::make_shared<CommonLog::RunContext>();
+    auto flow2 = std::make_shared<CommonLog::RunContext>();
+
+    TestLog log1;
+    TestLog log2;
+    TestLog log3;
+    log1.setRunContext(flow1);
+    log2.setRunContext(flow1);
+    log3.setRunContext(flow2);
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0);
+    REQUIRE(log1.calcTimeIntoRun(startTime) == 0.0);
+    REQUIRE(log2.startTime() == startTime);
+    REQUIRE(log3.startTime().empty());
+
+    REQUIRE(log3.calcTimeIntoRun(startTime + std::chrono::seconds(5)) == 0.0);
+    REQUIRE_THAT(log2.calcTimeIntoRun(startTime + std::chrono::seconds(5)), Catch::Matchers::WithinAbs(5.0, 1e-9));
+    REQUIRE(log1.startTime() == startTime);
+    REQUIRE(log3.startTime() == startTime + std::chrono::seconds(5));
+
+    auto localPosition = log3.calcLocalPosition(Eigen::Vector3d(deg2rad(48.0), deg2rad(9.0), 300.0));
+    REQUIRE(localPosition.northSouth == 0.0);
+    localPosition = log1.calcLocalPosition(Eigen::Vector3d(deg2rad(48.001), deg2rad(8.999), 300.0));
+    REQUIRE(localPosition.northSouth == 0.0);
+    REQUIRE(localPosition.eastWest == 0.0);
+}
+
+TEST_CASE("[CommonLog] Concurrent first samples define one run context", "[CommonLog]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime startTime(2023, 8, 1, 12, 0, 0);
+
+    for (size_t run = 0; run < 20; run++)
+    {
+        CommonLog::RunContext runContext;
+
+        constexpr size_t N_THREADS = 8;
+        std::latch start(N_THREADS);
+        std::vector<InsTime> firstSamples(N_THREADS);
+        std::array<bool, N_THREADS> consistent{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < N_THREADS; t++)
+        {
+            firstSamples.at(t) = startTime + std::chrono::seconds(t);
+            threads.emplace_back([&, t]() {
+                start.arrive_and_wait();
+                bool ok = true;
+                for (size_t i = 0; i < 1000; i++)
+                {
+                    InsTime insTime = firstSamples.at(t) + std::chrono::milliseconds(i);
+                    double timeIntoRun = runContext.calcTimeIntoRun(insTime);
+                    ok &= runContext.startTime() + std::chrono::duration<double>(timeIntoRun) == insTime;
+                }
+                consistent.at(t) = ok;
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+
+        REQUIRE(std::all_of(consistent.begin(), consistent.end(), [](bool ok) { return ok; }));
+        REQUIRE(std::find(firstSamples.begin(), firstSamples.end(), runContext.startTime()) != firstSamples.end());
+    }
+}
+
+TEST_CASE("[CommonLog] Scaling of the loggers with the amount of threads", "[CommonLog][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    CommonLog::RunContext runContext;
+    InsTime startTime(2023, 8, 1, 12, 0, 0);
+
+    // Every thread does the same amount of work, so the time stays constant when the loggers scale linearly
+    std::vector<size_t> threadCounts;
+    for (size_t nThreads = 1; nThreads <= std::min(8U, std::max(1U, std::thread::hardware_concurrency())); nThreads *= 2)
+    {
+        threadCounts.push_back(nThreads);
+    }
+
+    std::vector<double> bestDurations;
+    for (size_t nThreads : threadCounts)
+    {
+        BENCHMARK(fmt::format("100000 samples per thread with {} threads", nThreads))
+        {
+            return logFromThreads(runContext, nThreads, 100000, startTime);
+        };
+
+        double best = std::numeric_limits<double>::infinity();
+        for (size_t repetition = 0; repetition < 5; repetition++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            [[maybe_unused]] volatile double sum = logFromThreads(runContext, nThreads, 100000, startTime);
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        bestDurations.push_back(best);
+    }
+
+    // Only the threads with their own core are compared. A lock on every sample would serialize them instead.
+    if (threadCounts.size() == 1) { SKIP("The scaling needs at least two hardware threads"); }
+    for (size_t i = 1; i < threadCounts.size(); i++)
+    {
+        CAPTURE(threadCounts.at(i), bestDurations.front(), bestDurations.at(i));
+        REQUIRE(bestDurations.at(i) < 2.0 * bestDurations.front());
+    }
+}
+
+} // namespace NAV::TESTS::CommonLogTests
@@ -0,0 +1,257 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file EpochArenaTests.cpp
+/// @brief Tests for the epoch arena memory resource
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Logger.hpp"
+#include "util/Memory/EpochArena.hpp"
+#include "util/Container/Unordered_map.hpp"
+#include "Navigation/GNSS/Positioning/Observation.hpp"
+
+namespace NAV::TESTS::EpochArenaTests
+{
+
+namespace
+{
+
+/// @brief Memory resource which counts the allocations passed through to the new/delete resource
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    /// @brief Amount of allocations
+    size_t allocations = 0;
+
+  private:
+    /// @brief Allocates memory
+    /// @param[in] bytes Size of the memory
+    /// @param[in] alignment Alignment of the memory
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    /// @brief Deallocates memory
+    /// @param[in] p Pointer to the memory
+    /// @param[in] bytes Size of the memory
+    /// @param[in] alignment Alignment of the memory
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    /// @brief Compares the resources for equality
+    /// @param[in] other Other resource
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+/// @brief Installs a counting resource as upstream of the arena and as default resource while in scope,
+///        so that memory taken from the heap by the arena or by containers without the arena is counted
+class AllocationCounter
+{
+  public:
+    /// @brief Constructor
+    AllocationCounter()
+        : _previousDefault(std::pmr::set_default_resource(&_resource)) {}
+    /// @brief Destructor
+    ~AllocationCounter() { std::pmr::set_default_resource(_previousDefault); }
+    /// @brief Copy constructor
+    AllocationCounter(const AllocationCounter&) = delete;
+    /// @brief Move constructor
+    AllocationCounter(AllocationCounter&&) = delete;
+    /// @brief Copy assignment operator
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+    /// @brief Move assignment operator
+    AllocationCounter& operator=(AllocationCounter&&) = delete;
+
+    /// @brief Resource to use as upstream of the arena
+    std::pmr::memory_resource* resource() { return &_resource; }
+
+    /// @brief Counts the allocations during the execution of the function
+    /// @param[in] func Function to execute
+    /// @return Amount of allocations from the counting resource
+    template<typename Func>
+    size_t count(Func&& func)
+    {
+        auto before = _resource.allocations;
+        std::forward<Func>(func)();
+        return _resource.allocations - before;
+    }
+
+  private:
+    CountingResource _resource;                  ///< Counting resource
+    std::pmr::memory_resource* _previousDefault; ///< Default resource before the counter was installed
+};
+
+/// @brief Typical workload of an epoch with containers of varying size
+/// @param[in] resource Memory resource to use
+/// @param[in] n Amount of elements
+/// @return True if all containers have the expected size
+bool simulateEpoch(std::pmr::memory_resource* resource, size_t n)
+{
+    std::pmr::vector<double> values(resource);
+    pmr::unordered_map<size_t, std::pmr::vector<double>> map(resource);
+    std::pmr::set<size_t> set(resource);
+    std::pmr::unordered_set<size_t> unorderedSet(resource);
+    for (size_t i = 0; i < n; i++)
+    {
+        values.push_back(static_cast<double>(i));
+        map[i].assign(i % 5 + 1, 1.0);
+        set.insert(i);
+        unorderedSet.insert(i);
+    }
+    return values.size() == n && map.size() == n && set.size() == n && unorderedSet.size() == n;
+}
+
+} // namespace
+
+TEST_CASE("[EpochArena] Steady-state epochs do not allocate", "[EpochArena]")
+{
+    auto logger = initializeTestLogger();
+
+    AllocationCounter counter;
+    EpochArena arena(0, counter.resource());
+    REQUIRE(arena.capacity() == 0);
+
+    // Warm-up epoch overflows into the upstream resource
+    bool success = false;
+    REQUIRE(counter.count([&]() { success = simulateEpoch(&arena, 40); }) > 0);
+    REQUIRE(success);
+    REQUIRE(arena.overflowCount() > 0);
+    arena.reset();
+    REQUIRE(arena.capacity() >= arena.highWaterMark());
+    REQUIRE(arena.overflowCount() == 0);
+    REQUIRE(arena.used() == 0);
+
+    for (size_t epoch = 0; epoch < 10; epoch++)
+    {
+        REQUIRE(counter.count([&]() {
+                    arena.reset();
+                    success = simulateEpoch(&arena, 40 - epoch);
+                })
+                == 0);
+        REQUIRE(success);
+        REQUIRE(arena.overflowCount() == 0);
+    }
+
+    // A larger epoch grows the buffer once more
+    size_t capacity = arena.capacity();
+    arena.reset();
+    REQUIRE(simulateEpoch(&arena, 200));
+    REQUIRE(arena.overflowCount() > 0);
+    arena.reset();
+    REQUIRE(arena.capacity() > capacity);
+    REQUIRE(counter.count([&]() {
+                arena.reset();
+                success = simulateEpoch(&arena, 200);
+            })
+            == 0);
+    REQUIRE(success);
+}
+
+TEST_CASE("[EpochArena] Alignment and copies", "[EpochArena]")
+{
+    auto logger = initializeTestLogger();
+
+    EpochArena arena(256);
+    REQUIRE(arena.capacity() >= 256);
+
+    void* p1 = arena.allocate(3, 1);
+    void* p2 = arena.allocate(8, 64);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % 64 == 0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    REQUIRE(p1 != p2);
+
+    // Overflow allocations are aligned as well
+    void* p3 = arena.allocate(1000, 128);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p3) % 128 == 0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    REQUIRE(arena.overflowCount() == 1);
+    arena.reset();
+    REQUIRE(arena.capacity() >= 1000);
+    REQUIRE(arena.used() == 0);
+
+    EpochArena copy = arena; // NOLINT(performance-unnecessary-copy-initialization)
+    REQUIRE(copy.capacity() == 0);
+    REQUIRE(!copy.is_equal(arena));
+    REQUIRE(arena.is_equal(arena));
+}
+
+TEST_CASE("[EpochArena] Observations allocated in the arena", "[EpochArena]")
+{
+    auto logger = initializeTestLogger();
+
+    auto gnssObs = std::make_shared<GnssObs>();
+    for (uint16_t satNum = 1; satNum <= 12; satNum++)
+    {
+        gnssObs->data.emplace_back(SatSigId(Code::G1C, satNum));
+        gnssObs->data.emplace_back(SatSigId(Code::G5Q, satNum));
+    }
+
+    Eigen::Vector3d e_recPos(4157222.0, 671172.0, 4774690.0);
+    Eigen::Vector3d lla_recPos(0.8518, 0.1600, 300.0);
+    Eigen::Vector3d e_satPos(15e6, 10e6, 20e6);
+
+    AllocationCounter counter;
+    EpochArena arena(0, counter.resource());
+    size_t nSignals = 0;
+    size_t nSatellites = 0;
+    size_t nSystems = 0;
+    bool propagated = false;
+    double doppler = 0.0;
+    auto calcEpoch = [&]() {
+        arena.reset();
+        Observations observations{ Observations::allocator_type(&arena) };
+        observations.signals.reserve(gnssObs->data.size());
+        for (size_t i = 0; i < gnssObs->data.size(); i++)
+        {
+            const auto& satSigId = gnssObs->data.at(i).satSigId;
+            Observations::SignalObservation sigObs(nullptr, -128, Observations::allocator_type(&arena));
+            sigObs.recvObs.reserve(1);
+            sigObs.recvObs.emplace_back(gnssObs, i, e_recPos, lla_recPos, Eigen::Vector3d::Zero(), e_satPos, Eigen::Vector3d::Zero(), Clock::Corrections{});
+            sigObs.recvObs.back().obs[GnssObs::Pseudorange].measurement = 2e7;
+            sigObs.recvObs.back().obs[GnssObs::Doppler].measurement = 100.0;
+
+            observations.systems.insert(satSigId.toSatId().satSys);
+            observations.satellites.insert(satSigId.toSatId());
+            observations.signals.emplace(satSigId, std::move(sigObs));
+        }
+        nSignals = observations.signals.size();
+        nSatellites = observations.satellites.size();
+        nSystems = observations.systems.size();
+
+        // The memory resource is propagated down to the innermost container
+        const auto& recvObs = observations.signals.at(SatSigId(Code::G5Q, 7)).recvObs;
+        propagated = recvObs.get_allocator().resource() == &arena
+                     && recvObs.front().obs.get_allocator().resource() == &arena;
+        doppler = recvObs.front().obs.at(GnssObs::Doppler).measurement;
+    };
+
+    calcEpoch();
+    calcEpoch();
+    REQUIRE(counter.count(calcEpoch) == 0);
+    REQUIRE(arena.overflowCount() == 0);
+    REQUIRE(nSignals == gnssObs->data.size());
+    REQUIRE(nSatellites == 12);
+    REQUIRE(nSystems == 1);
+    REQUIRE(propagated);
+    REQUIRE(doppler == 100.0);
+}
+
+} // namespace NAV::TESTS::EpochArenaTests
@@ -0,0 +1,253 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AsciiSentenceTests.cpp
+/// @brief Tests for the decoding of ASCII sentences
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "util/Parsing/AsciiSentence.hpp"
+#include "util/StringUtil.hpp"
+
+namespace NAV::TESTS::AsciiSentenceTests
+{
+
+namespace
+{
+
+/// @brief Appends the checksum to the payload
+/// @param[in] payload Sentence without '$' and '*hh'
+/// @return The complete sentence
+std::string nmeaSentence(std::string_view payload)
+{
+    return fmt::format("${}*{:02X}\r\n", payload, ascii::nmea::checksum(payload));
+}
+
+/// @brief Generates a log with GGA, ZDA and RMC sentences
+/// @param[in] nEpochs Amount of epochs
+/// @return The log
+std::string generateNmeaLog(size_t nEpochs)
+{
+    std::string log;
+    for (size_t i = 0; i < nEpochs; i++)
+    {
+        auto hour = (i / 36000) % 24;
+        auto minute = (i / 600) % 60;
+        auto second = static_cast<double>(i % 600) / 10.0;
+        log += nmeaSentence(fmt::format("GPZDA,{:02}{:02}{:05.2f},01,08,2023,00,00", hour, minute, second));
+        log += nmeaSentence(fmt::format("GPGGA,{:02}{:02}{:05.2f},{:09.4f},N,{:010.4f},E,1,12,0.8,{:.3f},M,47.9,M,,",
+                                        hour, minute, second, 4846.0 + static_cast<double>(i % 1000) * 1e-3, 910.0 + static_cast<double>(i % 500) * 1e-3, 300.0 + static_cast<double>(i % 100) * 1e-3));
+        log += nmeaSentence(fmt::format("GPRMC,{:02}{:02}{:05.2f},A,4846.1234,N,00910.5678,E,0.02,31.66,010823,,,A", hour, minute, second));
+    }
+    return log;
+}
+
+/// @brief Decoded values of the GGA sentences
+struct Decoded
+{
+    size_t sentences = 0; ///< Amount of decoded sentences
+    double sum = 0.0;     ///< Sum of the decoded values
+};
+
+/// @brief Decodes the log with the allocation free decoder
+/// @param[in] log Log to decode
+/// @return The decoded values
+Decoded decodeAscii(std::string_view log)
+{
+    Decoded decoded;
+    for (size_t start = 0; start < log.size();)
+    {
+        size_t end = log.find('\n', start);
+        auto line = log.substr(start, end - start);
+        start = end == std::string_view::npos ? log.size() : end + 1;
+
+        auto payload = ascii::nmea::validate(line);
+        if (!payload) { continue; }
+        ascii::Fields<> fields(*payload, ',');
+        if (ascii::nmea::sentenceFormatter(fields[0]) != "GGA") { continue; }
+
+        auto latMin = ascii::parse<double>(fields[2].substr(2));
+        auto lonMin = ascii::parse<double>(fields[4].substr(3));
+        auto height = ascii::parse<double>(fields[9]);
+        if (!latMin || !lonMin || !height) { continue; }
+        decoded.sentences++;
+        decoded.sum += *latMin + *lonMin + *height;
+    }
+    return decoded;
+}
+
+/// @brief Decodes the log like the file readers did before, with strings for every line and field
+/// @param[in] log Log to decode
+/// @return The decoded values
+Decoded decodeStrings(const std::string& log)
+{
+    Decoded decoded;
+    for (const auto& line : str::split(log, '\n'))
+    {
+        auto posStar = line.find('*');
+        if (line.empty() || line.at(0) != '$' || posStar == std::string::npos) { continue; }
+        uint8_t checksum = 0;
+        for (size_t i = 1; i < posStar; i++) { checksum ^= static_cast<uint8_t>(line.at(i)); }
+        if (std::stoul(line.substr(posStar + 1, 2), nullptr, 16) != checksum) { continue; }
+
+        auto fields = str::split(line.substr(1, posStar - 1), ',');
+        if (fields.at(0).substr(2) != "GGA") { continue; }
+
+        decoded.sentences++;
+        decoded.sum += std::stod(fields.at(2).substr(2)) + std::stod(fields.at(4).substr(3)) + std::stod(fields.at(9));
+    }
+    return decoded;
+}
+
+} // namespace
+
+TEST_CASE("[AsciiSentence] Split fields", "[AsciiSentence]")
+{
+    auto logger = initializeTestLogger();
+
+    ascii::Fields<> fields("GPGGA,,1.5,,", ',');
+    REQUIRE(fields.size() == 5);
+    REQUIRE(fields[0] == "GPGGA");
+    REQUIRE(fields[1].empty());
+    REQUIRE(fields[2] == "1.5");
+    REQUIRE(fields[4].empty());
+    REQUIRE(fields[5].empty()); // Out of range
+    REQUIRE(!fields.truncated());
+
+    ascii::Fields<3> truncated("1/2/3/4", '/');
+    REQUIRE(truncated.size() == 3);
+    REQUIRE(truncated.truncated());
+    REQUIRE(truncated[2] == "3");
+
+    auto cells = ascii::Fields<>::splitWhitespace("  2023/08/01 12:00:00.000\t 48.78  9.18\r\n");
+    REQUIRE(cells.size() == 4);
+    REQUIRE(cells[0] == "2023/08/01");
+    REQUIRE(cells[3] == "9.18");
+    REQUIRE(ascii::Fields<>::splitWhitespace(" \r\n").empty());
+
+    std::vector<std::string_view> iterated(cells.begin(), cells.end());
+    REQUIRE(iterated.size() == 4);
+    REQUIRE(iterated.at(1) == "12:00:00.000");
+}
+
+TEST_CASE("[AsciiSentence] Parse numbers", "[AsciiSentence]")
+{
+    auto logger = initializeTestLogger();
+
+    REQUIRE(ascii::parse<int>("42") == 42);
+    REQUIRE(ascii::parse<int>("+42") == 42);
+    REQUIRE(ascii::parse<int>("-7") == -7);
+    REQUIRE(ascii::parse<uint8_t>("4F", 16) == 0x4F);
+    REQUIRE(ascii::parse<uint8_t>("256") == std::nullopt); // Out of range
+    REQUIRE(ascii::parse<int>("") == std::nullopt);
+    REQUIRE(ascii::parse<int>("+") == std::nullopt);
+    REQUIRE(ascii::parse<int>("12a") == std::nullopt); // Partially consumed
+    REQUIRE(ascii::parse<int>("1.5") == std::nullopt);
+
+    REQUIRE(ascii::parse<double>("4846.1234") == 4846.1234);
+    REQUIRE(ascii::parse<double>("-0.5e-3") == -0.5e-3);
+    REQUIRE(ascii::parse<double>("+300.25") == 300.25);
+    REQUIRE(ascii::parse<double>("1.2.3") == std::nullopt);
+    REQUIRE(ascii::parse<double>("abc") == std::nullopt);
+    REQUIRE_THAT(*ascii::parse<long double>("59.999"), Catch::Matchers::WithinAbs(59.999, 1e-12));
+
+    REQUIRE(ascii::to<uint16_t>("2023") == 2023);
+    REQUIRE_THROWS_AS(ascii::to<double>("nan?"), std::invalid_argument);
+}
+
+TEST_CASE("[AsciiSentence] Validate NMEA sentences", "[AsciiSentence]")
+{
+    auto logger = initializeTestLogger();
+
+    std::string_view zda = "$GPZDA,160012.71,11,03,2004,-1,00*7D\r\n";
+    REQUIRE(ascii::nmea::validate(zda) == "GPZDA,160012.71,11,03,2004,-1,00");
+    REQUIRE(ascii::nmea::validate("$GPZDA,160012.71,11,03,2004,-1,00*7d") == "GPZDA,160012.71,11,03,2004,-1,00");
+    REQUIRE(ascii::nmea::validate("$GPZDA,160012.71,11,03,2004,-1,00*7E") == std::nullopt); // Wrong checksum
+    REQUIRE(ascii::nmea::validate("$GPZDA,160012.71,11,03,2004,-1,01*7D") == std::nullopt); // Corrupted payload
+    REQUIRE(ascii::nmea::validate("$GPZDA,160012.71,11,03,2004,-1,00") == std::nullopt);    // No checksum
+    REQUIRE(ascii::nmea::validate("GPZDA,160012.71,11,03,2004,-1,00*7D") == std::nullopt);  // No start character
+    REQUIRE(ascii::nmea::validate("$*00") == "");
+    REQUIRE(ascii::nmea::validate("") == std::nullopt);
+
+    REQUIRE(ascii::nmea::checksum("GPZDA,160012.71,11,03,2004,-1,00") == 0x7D);
+
+    REQUIRE(ascii::nmea::sentenceFormatter("GPGGA") == "GGA");
+    REQUIRE(ascii::nmea::sentenceFormatter("GNRMC") == "RMC");
+    REQUIRE(ascii::nmea::sentenceFormatter("PUBX") == "PUBX");
+
+    REQUIRE(ascii::trimLeadingNonPrintable("\xEF\xBB\xBF$GPGGA") == "$GPGGA");
+    REQUIRE(ascii::trimLeadingNonPrintable(std::string_view("\0 $GPGGA", 8)) == "$GPGGA");
+}
+
+TEST_CASE("[AsciiSentence] Assemble lines from a byte stream", "[AsciiSentence]")
+{
+    auto logger = initializeTestLogger();
+
+    ascii::LineAssembler<16> assembler;
+    std::vector<std::string> lines;
+    for (char c : std::string_view("$GPZDA*00\r\n\r\n$THIS_LINE_IS_WAY_TOO_LONG*00\r\n$A*41\n$B"))
+    {
+        if (auto line = assembler.push(c)) { lines.emplace_back(*line); }
+    }
+    REQUIRE(lines == std::vector<std::string>{ "$GPZDA*00", "$A*41" });
+    REQUIRE(assembler.droppedLines() == 1);
+
+    // Sentences split over several received packets
+    ascii::LineAssembler<> streamAssembler;
+    std::string sentence = nmeaSentence("GPZDA,160012.71,11,03,2004,-1,00");
+    std::optional<std::string_view> payload;
+    for (char c : sentence)
+    {
+        if (auto line = streamAssembler.push(c)) { payload = ascii::nmea::validate(*line); }
+    }
+    REQUIRE(payload == "GPZDA,160012.71,11,03,2004,-1,00");
+}
+
+TEST_CASE("[AsciiSentence] Decode a generated NMEA log", "[AsciiSentence]")
+{
+    auto logger = initializeTestLogger();
+
+    auto log = generateNmeaLog(1000);
+    auto decoded = decodeAscii(log);
+    auto reference = decodeStrings(log);
+    REQUIRE(decoded.sentences == 1000);
+    REQUIRE(decoded.sentences == reference.sentences);
+    REQUIRE_THAT(decoded.sum, Catch::Matchers::WithinRel(reference.sum, 1e-12));
+}
+
+TEST_CASE("[AsciiSentence] Throughput of the NMEA decoding", "[AsciiSentence][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    auto log = generateNmeaLog(100000);
+    LOG_INFO("Decoding {:.1f} MB of NMEA sentences", static_cast<double>(log.size()) * 1e-6);
+
+    BENCHMARK("Allocation free decoder")
+    {
+        return decodeAscii(log).sum;
+    };
+    BENCHMARK("Strings and std::stod")
+    {
+        return decodeStrings(log).sum;
+    };
+}
+
+} // namespace NAV::TESTS::AsciiSentenceTests
@@ -0,0 +1,156 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RandomNumberGeneratorTests.cpp
+/// @brief Tests for the counter-based random number generator
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "CatchMatchers.hpp"
+#include "Logger.hpp"
+#include "util/Random/Philox.hpp"
+#include "util/Random/RandomNumberGenerator.hpp"
+
+namespace NAV::TESTS::RandomNumberGeneratorTests
+{
+
+TEST_CASE("[RandomNumberGenerator] Philox4x32-10 known answers", "[RandomNumberGenerator]")
+{
+    auto logger = initializeTestLogger();
+
+    // Known answer tests from the reference implementation (Random123)
+    REQUIRE(Philox4x32::generate({ 0, 0, 0, 0 }, { 0, 0 })
+            == Philox4x32::Counter{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 });
+    REQUIRE(Philox4x32::generate({ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff })
+            == Philox4x32::Counter{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd });
+    REQUIRE(Philox4x32::generate({ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 })
+            == Philox4x32::Counter{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 });
+}
+
+TEST_CASE("[RandomNumberGenerator] Draws only depend on seed and sample index", "[RandomNumberGenerator]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 42;
+    rng.resetSeed();
+
+    constexpr size_t N = 1000;
+    std::vector<double> sequential(N);
+    for (auto& value : sequential) { value = rng.getRand_normalDist(1.0, 2.0); }
+    REQUIRE(rng.sampleIndex() == N);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        REQUIRE(rng.getRand_normalDistAt(i, 1.0, 2.0) == sequential[i]);
+    }
+
+    // Batches of different size
+    rng.resetSeed();
+    std::vector<double> batched(N);
+    rng.fillRand_normalDist(std::span(batched).first(7), 1.0, 2.0);
+    rng.fillRand_normalDist(std::span(batched).subspan(7), 1.0, 2.0);
+    REQUIRE(batched == sequential);
+
+    // Jump ahead
+    rng.resetSeed();
+    rng.jumpAhead(500);
+    REQUIRE(rng.getRand_normalDist(1.0, 2.0) == sequential[500]);
+    rng.setSampleIndex(3);
+    Eigen::Vector3d vector = rng.getRand_normalDistVector(Eigen::Vector3d(2.0, 2.0, 2.0));
+    REQUIRE_THAT((vector - Eigen::Vector3d(sequential[3] - 1.0, sequential[4] - 1.0, sequential[5] - 1.0)).norm(), Catch::Matchers::WithinAbs(0.0, 1e-12));
+    REQUIRE(rng.sampleIndex() == 6);
+
+    // Several threads, each drawing every fourth sample
+    std::vector<double> threaded(N);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < N; i += 4) { threaded[i] = rng.getRand_normalDistAt(i, 1.0, 2.0); }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    REQUIRE(threaded == sequential);
+
+    // Other seed gives other numbers
+    RandomNumberGenerator other;
+    other.seed = 43;
+    other.resetSeed();
+    REQUIRE(other.getRand_normalDistAt(0, 1.0, 2.0) != sequential[0]);
+}
+
+TEST_CASE("[RandomNumberGenerator] Distributions", "[RandomNumberGenerator]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.seed = 7;
+    rng.resetSeed();
+
+    constexpr size_t N = 200000;
+    std::vector<double> normal(N);
+    rng.fillRand_normalDist(normal, 3.0, 0.5);
+    double mean = 0.0;
+    for (const auto& value : normal) { mean += value; }
+    mean /= N;
+    double variance = 0.0;
+    for (const auto& value : normal) { variance += (value - mean) * (value - mean); }
+    variance /= N - 1;
+    REQUIRE_THAT(mean, Catch::Matchers::WithinAbs(3.0, 5e-3));
+    REQUIRE_THAT(std::sqrt(variance), Catch::Matchers::WithinAbs(0.5, 5e-3));
+
+    double uniformMean = 0.0;
+    std::vector<size_t> counts(6, 0);
+    for (size_t i = 0; i < N; i++)
+    {
+        double u = rng.getRand_uniformRealDist(-1.0, 3.0);
+        REQUIRE(u > -1.0);
+        REQUIRE(u < 3.0);
+        uniformMean += u / N;
+
+        auto k = rng.getRand_uniformIntDistAt<int>(i, -2, 3);
+        REQUIRE(k >= -2);
+        REQUIRE(k <= 3);
+        counts.at(static_cast<size_t>(k + 2))++;
+    }
+    REQUIRE_THAT(uniformMean, Catch::Matchers::WithinAbs(1.0, 1e-2));
+    for (const auto& count : counts)
+    {
+        REQUIRE_THAT(static_cast<double>(count) / N, Catch::Matchers::WithinAbs(1.0 / 6.0, 5e-3));
+    }
+}
+
+TEST_CASE("[RandomNumberGenerator] Bulk normal draws", "[RandomNumberGenerator][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    RandomNumberGenerator rng;
+    rng.resetSeed();
+    std::vector<double> values(100000);
+
+    BENCHMARK("Counter-based bulk")
+    {
+        rng.fillRand_normalDist(values);
+        return values.back();
+    };
+    BENCHMARK("Counter-based sequential")
+    {
+        for (auto& value : values) { value = rng.getRand_normalDist(); }
+        return values.back();
+    };
+}
+
+} // namespace NAV::TESTS::RandomNumberGeneratorTests
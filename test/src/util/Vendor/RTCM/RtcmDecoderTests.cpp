@@ -0,0 +1,638 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RtcmDecoderTests.cpp
+/// @brief Tests for the RTCM 3 decoder
+/// @date 2026-10-18
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "Navigation/Constants.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GalileoEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "NodeData/GNSS/GnssNavInfo.hpp"
+#include "util/Vendor/RTCM/RtcmDecoder.hpp"
+
+namespace NAV::TESTS::RtcmDecoderTests
+{
+namespace rtcm = vendor::rtcm;
+
+/// Distance light travels in one millisecond [m]
+constexpr double RANGE_MS = InsConst<>::C * 1e-3;
+
+/// @brief Writes big-endian bit fields
+class BitWriter
+{
+  public:
+    /// @brief Appends an unsigned or two's complement value. Fields longer than 64 bits are sign-extended.
+    void u(size_t nBits, int64_t value)
+    {
+        for (size_t i = nBits; i > 0; i--) { push(i > 64 ? value < 0 : (static_cast<uint64_t>(value) >> (i - 1)) & 1); }
+    }
+    /// @brief Appends a value in sign-magnitude representation
+    void sm(size_t nBits, int64_t value)
+    {
+        push(value < 0);
+        u(nBits - 1, std::abs(value));
+    }
+    /// @brief Returns the message padded to full bytes
+    [[nodiscard]] const std::vector<uint8_t>& data() const { return _data; }
+
+  private:
+    void push(uint64_t bit)
+    {
+        if (_nBits % 8 == 0) { _data.push_back(0); }
+        _data.back() |= static_cast<uint8_t>(bit << (7 - _nBits % 8));
+        _nBits++;
+    }
+    std::vector<uint8_t> _data;
+    size_t _nBits = 0;
+};
+
+/// @brief Wraps a message into a frame
+std::vector<uint8_t> frame(const std::vector<uint8_t>& message)
+{
+    std::vector<uint8_t> frame{ rtcm::PREAMBLE, static_cast<uint8_t>(message.size() >> 8), static_cast<uint8_t>(message.size() & 0xFF) };
+    frame.insert(frame.end(), message.begin(), message.end());
+    auto crc = rtcm::crc24q(frame);
+    frame.push_back(static_cast<uint8_t>(crc >> 16));
+    frame.push_back(static_cast<uint8_t>(crc >> 8));
+    frame.push_back(static_cast<uint8_t>(crc));
+    return frame;
+}
+
+/// @brief Signal of a satellite in an MSM7 message
+struct Signal
+{
+    uint8_t signalId;    ///< Signal ID
+    double range;        ///< Pseudorange [m]
+    double phaserange;   ///< Carrier phase [m]
+    double rate;         ///< Phaserange rate [m/s]
+    uint16_t lockTime;   ///< Extended lock time indicator
+    bool halfCycle;      ///< Half-cycle ambiguity indicator
+    double cn0;          ///< Carrier-to-noise density [dBHz]
+};
+
+/// @brief Satellite in an MSM7 message
+struct Satellite
+{
+    uint8_t satelliteId;         ///< Satellite ID
+    uint8_t extendedInfo;        ///< Extended satellite information
+    std::vector<Signal> signals; ///< Signals ordered by the signal ID
+};
+
+/// @brief Encodes an MSM7 message. The signal mask contains all signals, so that cells can be missing.
+std::vector<uint8_t> encodeMsm7(uint16_t messageNumber, uint16_t stationId, uint32_t epochTime, bool multipleMessage, const std::vector<Satellite>& satellites)
+{
+    uint64_t satMask = 0;
+    uint32_t sigMask = 0;
+    for (const auto& sat : satellites)
+    {
+        satMask |= uint64_t(1) << (64 - sat.satelliteId);
+        for (const auto& signal : sat.signals) { sigMask |= uint32_t(1) << (32 - signal.signalId); }
+    }
+    std::vector<uint8_t> signalIds;
+    for (uint8_t i = 1; i <= 32; i++)
+    {
+        if (sigMask & (uint32_t(1) << (32 - i))) { signalIds.push_back(i); }
+    }
+
+    BitWriter bits;
+    bits.u(12, messageNumber);
+    bits.u(12, stationId);
+    bits.u(30, epochTime);
+    bits.u(1, multipleMessage);
+    bits.u(3 + 7 + 2 + 2 + 1 + 3, 0);
+    bits.u(64, static_cast<int64_t>(satMask));
+    bits.u(32, sigMask);
+    std::vector<const Signal*> cells;
+    for (const auto& sat : satellites)
+    {
+        for (const auto& signalId : signalIds)
+        {
+            auto signal = std::find_if(sat.signals.begin(), sat.signals.end(), [&](const Signal& s) { return s.signalId == signalId; });
+            bits.u(1, signal != sat.signals.end());
+            if (signal != sat.signals.end()) { cells.push_back(&*signal); }
+        }
+    }
+
+    std::vector<double> roughRange;
+    std::vector<double> roughRate;
+    for (const auto& sat : satellites)
+    {
+        roughRange.push_back(std::round(sat.signals.front().range / RANGE_MS * 1024.0) / 1024.0);
+        roughRate.push_back(std::round(sat.signals.front().rate));
+    }
+    for (const auto& r : roughRange) { bits.u(8, static_cast<int64_t>(std::floor(r))); }
+    for (const auto& sat : satellites) { bits.u(4, sat.extendedInfo); }
+    for (const auto& r : roughRange) { bits.u(10, std::llround((r - std::floor(r)) * 1024.0)); }
+    for (const auto& r : roughRate) { bits.u(14, static_cast<int64_t>(r)); }
+
+    auto rough = [&](const Signal* cell) {
+        for (size_t s = 0; s < satellites.size(); s++)
+        {
+            for (const auto& signal : satellites[s].signals)
+            {
+                if (&signal == cell) { return s; }
+            }
+        }
+        return size_t(0);
+    };
+    for (const auto* cell : cells) { bits.u(20, std::llround((cell->range / RANGE_MS - roughRange[rough(cell)]) * std::pow(2.0, 29))); }
+    for (const auto* cell : cells) { bits.u(24, std::llround((cell->phaserange / RANGE_MS - roughRange[rough(cell)]) * std::pow(2.0, 31))); }
+    for (const auto* cell : cells) { bits.u(10, cell->lockTime); }
+    for (const auto* cell : cells) { bits.u(1, cell->halfCycle); }
+    for (const auto* cell : cells) { bits.u(10, std::llround(cell->cn0 * 16.0)); }
+    for (const auto* cell : cells) { bits.u(15, std::llround((cell->rate - roughRate[rough(cell)]) * 1e4)); }
+    return frame(bits.data());
+}
+
+/// @brief Changes the epoch time of an encoded MSM frame and updates the checksum
+/// @param[in, out] frame Frame to change
+/// @param[in] epochTime New epoch time
+void setEpochTime(std::vector<uint8_t>& frame, uint32_t epochTime)
+{
+    // The epoch time follows the message number and the station ID in the message after the 3 header bytes
+    for (size_t i = 0; i < 30; i++)
+    {
+        size_t bit = 3 * 8 + 12 + 12 + i;
+        auto mask = static_cast<uint8_t>(1U << (7 - bit % 8));
+        if ((epochTime >> (29 - i)) & 1U) { frame.at(bit / 8) |= mask; }
+        else { frame.at(bit / 8) &= static_cast<uint8_t>(~mask); }
+    }
+    auto crc = rtcm::crc24q(std::span(frame).first(frame.size() - 3));
+    frame.at(frame.size() - 3) = static_cast<uint8_t>(crc >> 16);
+    frame.at(frame.size() - 2) = static_cast<uint8_t>(crc >> 8);
+    frame.at(frame.size() - 1) = static_cast<uint8_t>(crc);
+}
+
+/// @brief Encodes a Galileo I/NAV ephemeris message 1046
+std::vector<uint8_t> encodeGalileoInav(uint8_t prn, uint16_t week, uint16_t IODnav, uint16_t toe, int64_t sqrt_A)
+{
+    BitWriter bits;
+    bits.u(12, 1046);
+    bits.u(6, prn);
+    bits.u(12, week);
+    bits.u(10, IODnav);
+    bits.u(8, 107); // SISA
+    bits.u(14, -100);
+    bits.u(14, toe);
+    bits.u(6, 0);
+    bits.u(21, -1000);
+    bits.u(31, 123456); // af0
+    bits.u(16, 200);
+    bits.u(16, 300);
+    bits.u(32, 1000000000); // M_0
+    bits.u(16, -50);
+    bits.u(32, 1000000); // e
+    bits.u(16, 50);
+    bits.u(32, sqrt_A);
+    bits.u(14, toe);
+    bits.u(16, 10);
+    bits.u(32, -500000000); // Omega_0
+    bits.u(16, -10);
+    bits.u(32, 600000000); // i_0
+    bits.u(16, 400);
+    bits.u(32, 700000000); // omega
+    bits.u(24, -5000);
+    bits.u(10, -3);
+    bits.u(10, 4);
+    bits.u(2, 0);
+    bits.u(1, 0);
+    bits.u(2, 0);
+    bits.u(1, 0);
+    bits.u(2, 0); // Reserved
+    return frame(bits.data());
+}
+
+TEST_CASE("[RtcmDecoder] CRC-24Q", "[RtcmDecoder]")
+{
+    // Message 1005 of the RTCM standard
+    std::vector<uint8_t> data{ 0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34, 0xB4, 0xBD, 0x62,
+                               0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98 };
+    REQUIRE(rtcm::crc24q(std::span(data).first(22)) == 0x360B98);
+    REQUIRE(rtcm::crc24q(data) == 0);
+}
+
+TEST_CASE("[RtcmDecoder] Decode MSM7 observations from a fragmented stream", "[RtcmDecoder]")
+{
+    auto logger = initializeTestLogger();
+
+    // 2023-01-08 12:00:00 GPST is a Sunday
+    InsTime epoch(2023, 1, 8, 12, 0, 0.0, GPST);
+    constexpr uint32_t GPS_TOW_MS = 43'200'000;
+    constexpr uint32_t GLO_EPOCH = (0U << 27) | ((14 * 3600 + 59 * 60 + 42) * 1000U); // UTC 11:59:42 in Moscow time
+    double lambdaL1 = InsConst<>::C / 1575.42e6;
+    double lambdaL2 = InsConst<>::C / 1227.60e6;
+    double lambdaR1 = InsConst<>::C / (1602e6 + 3 * 0.5625e6);
+
+    std::vector<Satellite> gpsSatellites = {
+        { 5, 0, { { 2, 21'000'123.456, 21'000'123.789, -512.3456, 700, false, 45.25 }, { 10, 21'000'126.0, 21'000'125.5, -512.3, 700, true, 38.5 } } },
+        { 12, 0, { { 2, 23'456'789.012, 23'456'788.0, 321.987, 100, false, 41.0 } } },
+    };
+    std::vector<Satellite> gloSatellites = {
+        { 7, 3 + 7, { { 2, 20'100'000.5, 20'100'001.0, 1000.25, 500, false, 47.0 } } },
+    };
+
+    std::vector<uint8_t> stream{ 0x01, rtcm::PREAMBLE, 0x00 }; // Garbage before the first frame
+    auto gps = encodeMsm7(1077, 42, GPS_TOW_MS, true, gpsSatellites);
+    auto glo = encodeMsm7(1087, 42, GLO_EPOCH, false, gloSatellites);
+    auto corrupt = gps;
+    corrupt.at(20) ^= 0x10;
+    for (const auto& f : { gps, corrupt, glo }) { stream.insert(stream.end(), f.begin(), f.end()); }
+
+    for (size_t chunkSize : { size_t(1), size_t(7), size_t(64), stream.size() })
+    {
+        CAPTURE(chunkSize);
+        std::vector<std::shared_ptr<GnssObs>> epochs;
+        rtcm::RtcmDecoder decoder("RtcmDecoderTests");
+        decoder.setObsHandler([&](const std::shared_ptr<GnssObs>& gnssObs) { epochs.push_back(gnssObs); });
+        decoder.setReferenceTime(epoch + std::chrono::hours(50));
+
+        for (size_t i = 0; i < stream.size(); i += chunkSize)
+        {
+            decoder.feed(std::span(stream).subspan(i, std::min(chunkSize, stream.size() - i)));
+        }
+        // The garbage looks like the header of a frame which is longer than the stream
+        REQUIRE(decoder.statistics().frames == 0);
+        decoder.flush();
+        REQUIRE(decoder.statistics().frames == 2);
+        REQUIRE(decoder.statistics().crcErrors == 1);
+        REQUIRE(decoder.stationId() == 42);
+        REQUIRE(epochs.size() == 1);
+
+        const auto& obs = *epochs.front();
+        REQUIRE(obs.insTime == epoch);
+        REQUIRE(obs.data.size() == 4);
+
+        const auto& g05L1 = obs.data.at(0);
+        REQUIRE(g05L1.satSigId == SatSigId(Code::G1C, 5));
+        REQUIRE_THAT(g05L1.pseudorange->value, Catch::Matchers::WithinAbs(21'000'123.456, 1e-3));
+        REQUIRE_THAT(g05L1.carrierPhase->value, Catch::Matchers::WithinAbs(21'000'123.789 / lambdaL1, 1e-3));
+        REQUIRE(g05L1.carrierPhase->LLI == 1); // First epoch
+        REQUIRE_THAT(*g05L1.doppler, Catch::Matchers::WithinAbs(512.3456 / lambdaL1, 1e-3));
+        REQUIRE_THAT(*g05L1.CN0, Catch::Matchers::WithinAbs(45.25, 1e-9));
+
+        const auto& g05L2 = obs.data.at(1);
+        REQUIRE(g05L2.satSigId == SatSigId(Code::G2W, 5));
+        REQUIRE_THAT(g05L2.carrierPhase->value, Catch::Matchers::WithinAbs(21'000'125.5 / lambdaL2, 1e-3));
+        REQUIRE(g05L2.carrierPhase->LLI == 3); // Half-cycle ambiguity
+        REQUIRE(obs.data.at(2).satSigId == SatSigId(Code::G1C, 12));
+
+        const auto& r07 = obs.data.at(3);
+        REQUIRE(r07.satSigId == SatSigId(Code::R1C, 7));
+        REQUIRE_THAT(r07.pseudorange->value, Catch::Matchers::WithinAbs(20'100'000.5, 1e-3));
+        REQUIRE_THAT(r07.carrierPhase->value, Catch::Matchers::WithinAbs(20'100'001.0 / lambdaR1, 1e-3));
+        REQUIRE_THAT(*r07.doppler, Catch::Matchers::WithinAbs(-1000.25 / lambdaR1, 1e-3));
+    }
+
+    // Cycle slips are detected from the lock time
+    std::vector<std::shared_ptr<GnssObs>> epochs;
+    rtcm::RtcmDecoder decoder("RtcmDecoderTests");
+    decoder.setObsHandler([&](const std::shared_ptr<GnssObs>& gnssObs) { epochs.push_back(gnssObs); });
+    decoder.setReferenceTime(epoch);
+    decoder.feed(encodeMsm7(1077, 42, GPS_TOW_MS, false, gpsSatellites));
+    gpsSatellites[0].signals[0].lockTime = 704; // Lock time increased
+    gpsSatellites[1].signals[0].lockTime = 90;  // Lock time decreased
+    decoder.feed(encodeMsm7(1077, 42, GPS_TOW_MS + 1000, false, gpsSatellites));
+    decoder.feed(encodeMsm7(1077, 7, GPS_TOW_MS + 2000, false, gpsSatellites)); // Other station
+    REQUIRE(epochs.size() == 2);
+    REQUIRE(epochs[1]->insTime == epoch + std::chrono::seconds(1));
+    REQUIRE(epochs[1]->data.at(0).carrierPhase->LLI == 0);
+    REQUIRE(epochs[1]->data.at(2).carrierPhase->LLI == 1);
+    REQUIRE(decoder.statistics().discarded == 1);
+}
+
+TEST_CASE("[RtcmDecoder] Emit epochs completed inside a fragmented frame", "[RtcmDecoder]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime epoch(2023, 1, 8, 12, 0, 0.0, GPST);
+    constexpr uint32_t GPS_TOW_MS = 43'200'000;
+    std::vector<Satellite> gpsSatellites = {
+        { 5, 0, { { 2, 21'000'123.456, 21'000'123.789, -512.3456, 700, false, 45.25 } } },
+    };
+
+    // Every message completes its epoch, so the epoch is emitted while the frame is decoded from the buffer
+    std::vector<uint8_t> stream;
+    for (uint32_t k = 0; k < 3; k++)
+    {
+        auto f = encodeMsm7(1077, 42, GPS_TOW_MS + k * 1000, false, gpsSatellites);
+        stream.insert(stream.end(), f.begin(), f.end());
+    }
+
+    for (size_t chunkSize : { size_t(1), size_t(5), size_t(33) })
+    {
+        CAPTURE(chunkSize);
+        std::vector<std::shared_ptr<GnssObs>> epochs;
+        rtcm::RtcmDecoder decoder("RtcmDecoderTests");
+        decoder.setObsHandler([&](const std::shared_ptr<GnssObs>& gnssObs) { epochs.push_back(gnssObs); });
+        decoder.setReferenceTime(epoch);
+
+        for (size_t i = 0; i < stream.size(); i += chunkSize)
+        {
+            decoder.feed(std::span(stream).subspan(i, std::min(chunkSize, stream.size() - i)));
+        }
+        REQUIRE(decoder.statistics().frames == 3);
+        REQUIRE(decoder.statistics().crcErrors == 0);
+        REQUIRE(epochs.size() == 3);
+        for (size_t k = 0; k < epochs.size(); k++)
+        {
+            REQUIRE(epochs.at(k)->insTime == epoch + std::chrono::seconds(k));
+        }
+
+        decoder.flush();
+        REQUIRE(decoder.statistics().frames == 3);
+        REQUIRE(epochs.size() == 3);
+    }
+}
+
+TEST_CASE("[RtcmDecoder] Decode ephemerides", "[RtcmDecoder]")
+{
+    auto logger = initializeTestLogger();
+
+    std::vector<std::pair<SatId, std::shared_ptr<SatNavData>>> navData;
+    std::vector<std::shared_ptr<GnssObs>> epochs;
+    rtcm::RtcmDecoder decoder("RtcmDecoderTests");
+    decoder.setNavHandler([&](const SatId& satId, const std::shared_ptr<SatNavData>& satNavData) { navData.emplace_back(satId, satNavData); });
+    decoder.setObsHandler([&](const std::shared_ptr<GnssObs>& gnssObs) { epochs.push_back(gnssObs); });
+
+    // Observations are discarded till the week is known
+    std::vector<Satellite> satellites = { { 5, 0, { { 2, 21'000'123.456, 21'000'123.789, -512.3456, 700, false, 45.25 } } } };
+    decoder.feed(encodeMsm7(1077, 1, 43'200'000, false, satellites));
+    REQUIRE(epochs.empty());
+
+    // Galileo week 1220 is GPS week 2244
+    auto inav = encodeGalileoInav(11, 1220, 77, 720, std::llround(5440.6 * std::pow(2.0, 19)));
+    decoder.feed(inav);
+    decoder.feed(inav); // Repeated ephemerides are not passed on again
+    REQUIRE(navData.size() == 1);
+    REQUIRE(navData[0].first == SatId(GAL, 11));
+    auto eph = std::dynamic_pointer_cast<GalileoEphemeris>(navData[0].second);
+    REQUIRE(eph != nullptr);
+    REQUIRE(eph->toe == InsTime(2023, 1, 8, 12, 0, 0.0, GST));
+    REQUIRE(eph->toc == eph->toe);
+    REQUIRE(eph->IODnav == 77);
+    REQUIRE(eph->dataSource[0]);
+    REQUIRE_THAT(eph->sqrt_A, Catch::Matchers::WithinAbs(5440.6, 1e-5));
+    REQUIRE_THAT(eph->e, Catch::Matchers::WithinAbs(1e6 * std::pow(2.0, -33), 1e-15));
+    REQUIRE_THAT(eph->M_0, Catch::Matchers::WithinAbs(semicircles2rad(1e9 * std::pow(2.0, -31)), 1e-12));
+    REQUIRE_THAT(eph->Omega_0, Catch::Matchers::WithinAbs(semicircles2rad(-5e8 * std::pow(2.0, -31)), 1e-12));
+    REQUIRE_THAT(eph->BGD_E1_E5a, Catch::Matchers::WithinAbs(-3.0 * std::pow(2.0, -32), 1e-20));
+    REQUIRE_THAT(eph->BGD_E1_E5b, Catch::Matchers::WithinAbs(4.0 * std::pow(2.0, -32), 1e-20));
+    REQUIRE(decoder.referenceTime() == eph->toe);
+
+    decoder.feed(encodeMsm7(1077, 1, 43'201'000, false, satellites));
+    REQUIRE(epochs.size() == 1);
+    REQUIRE(epochs[0]->insTime == InsTime(2023, 1, 8, 12, 0, 1.0, GPST));
+
+    // GPS week is resolved from the reference time (2244 mod 1024 = 196)
+    BitWriter gps;
+    gps.u(12, 1019);
+    gps.u(6, 3);
+    gps.u(10, 196);
+    gps.u(4, 2);
+    gps.u(2, 1);
+    gps.u(14, 0);
+    gps.u(8, 55);
+    gps.u(16, 2700); // toc
+    gps.u(8 + 16 + 22, 0);
+    gps.u(10, 55);
+    gps.u(16 + 16 + 32 + 16, 0);
+    gps.u(32, 2000000);
+    gps.u(16, 0);
+    gps.u(32, std::llround(5153.7 * std::pow(2.0, 19)));
+    gps.u(16, 2700); // toe
+    gps.u(16 + 32 + 16 + 32 + 16 + 32 + 24 + 8, 0);
+    gps.u(6, 0);
+    gps.u(1, 0);
+    gps.u(1, 1);
+    decoder.feed(frame(gps.data()));
+    REQUIRE(navData.size() == 2);
+    auto gpsEph = std::dynamic_pointer_cast<GPSEphemeris>(navData[1].second);
+    REQUIRE(navData[1].first == SatId(GPS, 3));
+    REQUIRE(gpsEph->toe == InsTime(2023, 1, 8, 12, 0, 0.0, GPST));
+    REQUIRE(gpsEph->IODE == 55);
+    REQUIRE_THAT(gpsEph->svAccuracy, Catch::Matchers::WithinAbs(4.0, 1e-12));
+    REQUIRE_THAT(gpsEph->fitInterval, Catch::Matchers::WithinAbs(8.0, 1e-12));
+
+    // GLONASS ephemeris at t_b = 60 (15:00 Moscow time = 12:00 UTC)
+    BitWriter glo;
+    glo.u(12, 1020);
+    glo.u(6, 7);
+    glo.u(5, 3 + 7);
+    glo.u(4 + 5 + 6 + 1, 0);
+    glo.u(1, 0);
+    glo.u(1, 0);
+    glo.u(7, 60);
+    glo.sm(24, -1000000);
+    glo.sm(27, 10000000);
+    glo.sm(5, 2);
+    glo.sm(24, 0);
+    glo.sm(27, -5000000);
+    glo.sm(5, 0);
+    glo.sm(24, 0);
+    glo.sm(27, 20000000);
+    glo.sm(5, 0);
+    glo.u(1, 0);
+    glo.sm(11, -3);
+    glo.u(3, 0);
+    glo.sm(22, -12345);
+    glo.u(5 + 5 + 4 + 11 + 2 + 1 + 11 + 32 + 5 + 22 + 1 + 7, 0);
+    decoder.feed(frame(glo.data()));
+    REQUIRE(navData.size() == 3);
+    auto gloEph = std::dynamic_pointer_cast<GLONASSEphemeris>(navData[2].second);
+    REQUIRE(gloEph->toc == InsTime(2023, 1, 8, 12, 0, 0.0, UTC));
+    REQUIRE(gloEph->frequencyNumber == 3);
+    REQUIRE_THAT(gloEph->PZ90_pos.x(), Catch::Matchers::WithinAbs(1e7 * std::pow(2.0, -11) * 1e3, 1e-6));
+    REQUIRE_THAT(gloEph->PZ90_pos.y(), Catch::Matchers::WithinAbs(-5e6 * std::pow(2.0, -11) * 1e3, 1e-6));
+    REQUIRE_THAT(gloEph->PZ90_vel.x(), Catch::Matchers::WithinAbs(-1e6 * std::pow(2.0, -20) * 1e3, 1e-9));
+    REQUIRE_THAT(gloEph->tau_n, Catch::Matchers::WithinAbs(-12345 * std::pow(2.0, -30), 1e-15));
+}
+
+TEST_CASE("[RtcmDecoder] Conformance with a real recording", "[RtcmDecoder]")
+{
+    auto logger = initializeTestLogger();
+
+    // The recording and its reference values are not part of the repository (see 'test/data/GNSS/RTCM/README.md')
+    std::ifstream recording("test/data/GNSS/RTCM/recording.rtcm3", std::ios::binary);
+    std::ifstream observations("test/data/GNSS/RTCM/observations.txt");
+    std::ifstream satellitePositions("test/data/GNSS/RTCM/satellitePositions.txt");
+    if (!recording.good() || !observations.good() || !satellitePositions.good())
+    {
+        SKIP("RTCM 3 recording or reference values not installed in 'test/data/GNSS/RTCM'");
+    }
+    std::vector<uint8_t> stream((std::istreambuf_iterator<char>(recording)), std::istreambuf_iterator<char>());
+
+    // Reads the next line of a reference file, which is not empty or a comment
+    auto nextLine = [](std::ifstream& file, std::istringstream& ss) {
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (!line.empty() && line.front() != '#')
+            {
+                ss = std::istringstream(line);
+                return true;
+            }
+        }
+        return false;
+    };
+    // Reads the GPS week and time of week and the satellite of a reference line
+    auto readTimeAndSatellite = [](std::istringstream& ss) {
+        uint16_t week = 0;
+        std::string tow;
+        std::string sat;
+        ss >> week >> tow >> sat;
+        REQUIRE(!ss.fail());
+        return std::make_pair(InsTime(0, week, std::stold(tow), GPST), SatId(SatelliteSystem::fromChar(sat.front()), static_cast<uint16_t>(std::stoi(sat.substr(1)))));
+    };
+
+    std::istringstream ss;
+    REQUIRE(nextLine(observations, ss));
+    auto referenceTime = readTimeAndSatellite(ss).first;
+    observations.seekg(0);
+
+    GnssNavInfo gnssNavInfo;
+    std::map<InsTime, std::shared_ptr<GnssObs>> epochs;
+    rtcm::RtcmDecoder decoder("RtcmDecoderTests");
+    decoder.setReferenceTime(referenceTime);
+    decoder.setNavHandler([&](const SatId& satId, const std::shared_ptr<SatNavData>& satNavData) { gnssNavInfo.addSatelliteNavData(satId, satNavData); });
+    decoder.setObsHandler([&](const std::shared_ptr<GnssObs>& gnssObs) { epochs.emplace(gnssObs->insTime, gnssObs); });
+    decoder.feed(stream);
+    decoder.flush();
+    REQUIRE(decoder.statistics().crcErrors == 0);
+
+    // Each line: GPS week, time of week [s], satellite, RINEX code, pseudorange [m], carrier phase [cycles], Doppler [Hz], C/N0 [dBHz]
+    size_t nObservations = 0;
+    while (nextLine(observations, ss))
+    {
+        auto [insTime, satId] = readTimeAndSatellite(ss);
+        std::string code;
+        std::array<std::string, 4> values;
+        ss >> code >> values[0] >> values[1] >> values[2] >> values[3];
+        REQUIRE(!ss.fail());
+        CAPTURE(nObservations, insTime.toGPSweekTow(), satId, code);
+
+        auto epoch = epochs.find(insTime);
+        REQUIRE(epoch != epochs.end());
+        auto obs = std::find_if(epoch->second->data.begin(), epoch->second->data.end(), [&](const GnssObs::ObservationData& data) {
+            return data.satSigId.toSatId() == satId && std::string(data.satSigId.code).substr(1) == code;
+        });
+        REQUIRE(obs != epoch->second->data.end());
+
+        // RINEX files have 3 decimals, which is coarser than the resolution of the MSM messages
+        if (double value = std::stod(values[0]); !std::isnan(value)) { REQUIRE_THAT(obs->pseudorange->value, Catch::Matchers::WithinAbs(value, 2e-3)); }
+        if (double value = std::stod(values[1]); !std::isnan(value)) { REQUIRE_THAT(obs->carrierPhase->value, Catch::Matchers::WithinAbs(value, 2e-3)); }
+        if (double value = std::stod(values[2]); !std::isnan(value)) { REQUIRE_THAT(*obs->doppler, Catch::Matchers::WithinAbs(value, 2e-3)); }
+        if (double value = std::stod(values[3]); !std::isnan(value)) { REQUIRE_THAT(*obs->CN0, Catch::Matchers::WithinAbs(value, 2e-3)); }
+        nObservations++;
+    }
+    REQUIRE(nObservations > 0);
+
+    // Each line: GPS week, time of week [s], satellite, ECEF position x, y, z [m] from the broadcast ephemerides in the RINEX navigation file
+    size_t nPositions = 0;
+    while (nextLine(satellitePositions, ss))
+    {
+        auto [insTime, satId] = readTimeAndSatellite(ss);
+        Eigen::Vector3d e_posRef;
+        ss >> e_posRef.x() >> e_posRef.y() >> e_posRef.z();
+        REQUIRE(!ss.fail());
+        CAPTURE(nPositions, insTime.toGPSweekTow(), satId);
+
+        REQUIRE(gnssNavInfo.searchNavigationData(satId, insTime) != nullptr);
+        // GLONASS orbits are integrated numerically, which differs between implementations
+        REQUIRE_THAT((gnssNavInfo.calcSatellitePos(satId, insTime).e_pos - e_posRef).norm(), Catch::Matchers::WithinAbs(0.0, satId.satSys == GLO ? 1.0 : 0.05));
+        nPositions++;
+    }
+    REQUIRE(nPositions > 0);
+}
+
+TEST_CASE("[RtcmDecoder] Throughput for a day-long multi-station recording", "[RtcmDecoder][.][benchmark]")
+{
+    auto logger = initializeTestLogger();
+
+    // 4 stations with 10 GPS satellites on two signals and 8 Galileo satellites on one signal, 1 Hz for 24 hours
+    constexpr uint16_t N_STATIONS = 4;
+    constexpr uint32_t N_EPOCHS = 24 * 3600;
+    InsTime epoch(2023, 1, 8, 0, 0, 0.0, GPST); // Sunday, so the epoch time starts at 0
+
+    std::vector<Satellite> gpsSatellites;
+    for (uint8_t satId = 1; satId <= 10; satId++)
+    {
+        double range = 2.0e7 + satId * 1.0e5;
+        gpsSatellites.push_back({ satId, 0, { { 2, range, range + 0.5, -500.0 + satId, 700, false, 45.0 }, { 10, range + 3.0, range + 2.5, -500.0 + satId, 700, false, 38.0 } } });
+    }
+    std::vector<Satellite> galSatellites;
+    for (uint8_t satId = 1; satId <= 8; satId++)
+    {
+        double range = 2.3e7 + satId * 1.0e5;
+        galSatellites.push_back({ satId, 0, { { 2, range, range + 0.5, 300.0 - satId, 700, false, 44.0 } } });
+    }
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint16_t station = 1; station <= N_STATIONS; station++)
+    {
+        frames.push_back(encodeMsm7(1077, station, 0, true, gpsSatellites));
+        frames.push_back(encodeMsm7(1097, station, 0, false, galSatellites));
+    }
+
+    std::vector<rtcm::RtcmDecoder> decoders;
+    std::vector<size_t> nEpochs(N_STATIONS);
+    decoders.reserve(N_STATIONS);
+    for (uint16_t station = 1; station <= N_STATIONS; station++)
+    {
+        auto& decoder = decoders.emplace_back("RtcmDecoderTests");
+        decoder.setStationId(station);
+        decoder.setReferenceTime(epoch);
+        decoder.setObsHandler([&nEpochs, station](const std::shared_ptr<GnssObs>& /* gnssObs */) { nEpochs.at(station - 1)++; });
+    }
+
+    // Every station has its own decoder, which reads the whole stream in chunks of an hour
+    std::chrono::steady_clock::duration duration{};
+    size_t nBytes = 0;
+    std::vector<uint8_t> stream;
+    for (uint32_t hour = 0; hour < N_EPOCHS / 3600; hour++)
+    {
+        stream.clear();
+        for (uint32_t k = hour * 3600; k < (hour + 1) * 3600; k++)
+        {
+            for (auto& f : frames)
+            {
+                setEpochTime(f, k * 1000);
+                stream.insert(stream.end(), f.begin(), f.end());
+            }
+        }
+        nBytes += stream.size();
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto& decoder : decoders) { decoder.feed(stream); }
+        duration += std::chrono::steady_clock::now() - start;
+    }
+    for (auto& decoder : decoders) { decoder.flush(); }
+
+    double seconds = std::chrono::duration<double>(duration).count();
+    LOG_INFO("Decoded {} MB of RTCM 3 data for {} stations in {:.2f} s", nBytes / 1000000, N_STATIONS, seconds);
+    for (size_t n : nEpochs) { REQUIRE(n == N_EPOCHS); }
+    REQUIRE(seconds < 15.0);
+}
+
+} // namespace NAV::TESTS::RtcmDecoderTests